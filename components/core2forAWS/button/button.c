@@ -8,6 +8,8 @@
 
 Button_t* button_ahead = NULL;
 static SemaphoreHandle_t button_lock = NULL;
+static TaskHandle_t button_notify_task = NULL;
+static uint32_t button_notify_bits = 0;
 static void Button_UpdateTask(void *arg);
 
 void Button_Init() {
@@ -56,6 +58,13 @@ uint8_t Button_WasReleased(Button_t* button) {
     return result;
 }
 
+void Button_SetNotify(TaskHandle_t task, uint32_t notify_bits) {
+    xSemaphoreTake(button_lock, portMAX_DELAY);
+    button_notify_task = task;
+    button_notify_bits = notify_bits;
+    xSemaphoreGive(button_lock);
+}
+
 void Button_SetLongPressTime(Button_t* button, uint32_t million_second) {
     xSemaphoreTake(button_lock, portMAX_DELAY);
     button->long_press_time = pdMS_TO_TICKS(million_second);
@@ -113,15 +122,25 @@ static void Button_UpdateTask(void *arg) {
     Button_t* button;
     uint16_t x, y;
     bool press;
+    bool last_press = false;
+    bool changed;
 
     for (;;) {
         FT6336U_GetTouch(&x, &y, &press);
         xSemaphoreTake(button_lock, portMAX_DELAY);
+        changed = (press != last_press);
+        last_press = press;
         button = button_ahead;
         while (button != NULL) {
+            uint8_t state = button->state;
+            uint8_t value = button->value;
             Button_Update(button, press, x, y);
+            changed |= (state != button->state) || (value != button->value);
             button = button->next;
         }
+        if (changed && button_notify_task != NULL) {
+            xTaskNotify(button_notify_task, button_notify_bits, eSetBits);
+        }
         xSemaphoreGive(button_lock);
         vTaskDelay(pdMS_TO_TICKS(20));
     }
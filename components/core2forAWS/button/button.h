@@ -6,6 +6,8 @@
 #pragma once
 
 #include "stdio.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 
 /**
  * @brief List of possible virtual button press events.
@@ -128,3 +130,15 @@ uint8_t Button_WasLongPress(Button_t* button);
 /* @[declare_button_waslongpress] */
 
 void Button_SetLongPressTime(Button_t* button, uint32_t million_second);
+
+/**
+ * @brief Set notify bits on a task whenever a virtual button changes state
+ * or the touch panel is pressed or released anywhere, so the task can block
+ * instead of polling the press events.
+ * 
+ * @param[in] task The task to notify, NULL stops the notifications.
+ * @param[in] notify_bits The bits set with xTaskNotify eSetBits.
+ */
+/* @[declare_button_setnotify] */
+void Button_SetNotify(TaskHandle_t task, uint32_t notify_bits);
+/* @[declare_button_setnotify] */
@@ -274,6 +274,8 @@ void Core2ForAWS_Sk6812_Clear(void) {
 
 #define DISPLAY_BRIGHTNESS_MIN_VOLT 2350
 #define DISPLAY_BRIGHTNESS_MAX_VOLT 3150
+/* The ILI9342C takes 5 ms to enter or leave sleep before it accepts the next command */
+#define DISPLAY_SLEEP_SETTLE_MS 10
 #define LV_TICK_PERIOD_MS 1
 
 SemaphoreHandle_t xGuiSemaphore;
@@ -302,8 +304,16 @@ void Core2ForAWS_Display_Init(void) {
     static lv_disp_buf_t disp_buf;
 
     uint32_t size_in_px = DISP_BUF_SIZE;
-    lv_color_t *buf1 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT); //Assuming max size of lv_color_t = 16bit, DISP_BUF_SIZE calculated from max horizontal display size 480
-    lv_color_t *buf2 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT); //Assuming max size of lv_color_t = 16bit, DISP_BUF_SIZE calculated from max horizontal display size 480
+    /* Internal DMA capable buffers go to the SPI DMA as they are, PSRAM ones only when internal RAM is short, through a bounce buffer */
+    lv_color_t *buf1 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    lv_color_t *buf2 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_DMA | MALLOC_CAP_INTERNAL);
+    if (buf1 == NULL || buf2 == NULL) {
+        ESP_LOGW(TAG, "No internal DMA memory for the display buffers, falling back to PSRAM");
+        heap_caps_free(buf1);
+        heap_caps_free(buf2);
+        buf1 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT); //Assuming max size of lv_color_t = 16bit, DISP_BUF_SIZE calculated from max horizontal display size 480
+        buf2 = heap_caps_malloc(DISP_BUF_SIZE * sizeof(lv_color_t), MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT); //Assuming max size of lv_color_t = 16bit, DISP_BUF_SIZE calculated from max horizontal display size 480
+    }
     
     /* Initialize the working buffer depending on the selected display */
     lv_disp_buf_init(&disp_buf, buf1, buf2, size_in_px);
@@ -311,6 +321,8 @@ void Core2ForAWS_Display_Init(void) {
     lv_disp_drv_t disp_drv;
     lv_disp_drv_init(&disp_drv);
     disp_drv.flush_cb = disp_driver_flush;
+    disp_drv.wait_cb = disp_spi_wait_flush;
+    disp_drv.monitor_cb = disp_driver_monitor;
 
     disp_drv.buffer = &disp_buf;
     lv_disp_drv_register(&disp_drv);
@@ -350,6 +362,22 @@ void Core2ForAWS_Display_SetBrightness(uint8_t brightness) {
     Axp192_SetDCDC3Volt(volt);
 }
 
+void Core2ForAWS_Display_Sleep(bool sleep) {
+    lv_disp_t * disp = lv_disp_get_default();
+    if (sleep) {
+        lv_task_set_prio(disp->refr_task, LV_TASK_PRIO_OFF);
+        disp_wait_for_pending_transactions();
+        Axp192_EnableDCDC3(0);
+        ili9341_sleep_in();
+        vTaskDelay(pdMS_TO_TICKS(DISPLAY_SLEEP_SETTLE_MS));
+    } else {
+        ili9341_sleep_out();
+        vTaskDelay(pdMS_TO_TICKS(DISPLAY_SLEEP_SETTLE_MS));
+        Axp192_EnableDCDC3(1);
+        lv_task_set_prio(disp->refr_task, LV_REFR_TASK_PRIO);
+    }
+}
+
 void Core2ForAWS_LED_Enable(uint8_t enable) {
     uint8_t value = enable ? 0 : 1;
     Axp192_SetGPIO1Mode(value);
@@ -468,6 +468,34 @@ void Core2ForAWS_Display_Init(void);
 /* @[declare_core2foraws_display_setbrightness] */
 void Core2ForAWS_Display_SetBrightness(uint8_t brightness);
 /* @[declare_core2foraws_display_setbrightness] */
+
+/**
+ * @brief Puts the display to sleep or wakes it up.
+ *
+ * Sleeping pauses the LVGL refresh task, waits for the last
+ * flush, sends the ILI9342C sleep in command and turns the
+ * backlight off. Objects changed while the display sleeps
+ * stay invalidated and are drawn by the first refresh after
+ * waking, the panel keeps its frame memory meanwhile. Both
+ * directions wait for the controller to settle, so it must
+ * not be called from an interrupt.
+ *
+ * @note Take the xGuiSemaphore mutex prior to use.
+ *
+ * **Example:**
+ *
+ * Turn the display off.
+ * @code{c}
+ *  xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+ *  Core2ForAWS_Display_Sleep(true);
+ *  xSemaphoreGive(xGuiSemaphore);
+ * @endcode
+ *
+ * @param[in] sleep true to sleep, false to wake up.
+ */
+/* @[declare_core2foraws_display_sleep] */
+void Core2ForAWS_Display_Sleep(bool sleep);
+/* @[declare_core2foraws_display_sleep] */
 #endif
 
 /**
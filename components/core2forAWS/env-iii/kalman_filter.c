@@ -0,0 +1,120 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "kalman_filter.h"
+
+/* Initial uncertainty, large enough to let the first barometric samples take over immediately */
+#define KALMAN_INITIAL_ALTITUDE_VARIANCE        (100.0f)
+#define KALMAN_INITIAL_VELOCITY_VARIANCE        (1.0f)
+#define KALMAN_INITIAL_BIAS_VARIANCE            (1.0f)
+
+kalman_filter_t * init_kalman_filter(float accel_noise, float bias_noise, float altitude_noise) {
+    kalman_filter_t * filter = malloc(sizeof(kalman_filter_t));
+    if (filter == NULL) {
+        return NULL;
+    }
+
+    memset(filter, 0, sizeof(kalman_filter_t));
+    filter->covariance[0][0] = KALMAN_INITIAL_ALTITUDE_VARIANCE;
+    filter->covariance[1][1] = KALMAN_INITIAL_VELOCITY_VARIANCE;
+    filter->covariance[2][2] = KALMAN_INITIAL_BIAS_VARIANCE;
+    kalman_filter_set_noise(filter, accel_noise, bias_noise, altitude_noise);
+
+    return filter;
+}
+
+void deinit_kalman_filter(kalman_filter_t * filter) {
+    if (filter != NULL) {
+        free(filter);
+    }
+}
+
+/*
+    accel_noise:    standard deviation of the vertical acceleration input, m/s^2
+    bias_noise:     random walk of the acceleration bias, m/s^2 per square root of second
+    altitude_noise: standard deviation of the barometric altitude, m
+*/
+void kalman_filter_set_noise(kalman_filter_t * filter, float accel_noise, float bias_noise, float altitude_noise) {
+    filter->accel_variance = accel_noise * accel_noise;
+    filter->bias_variance = bias_noise * bias_noise;
+    filter->altitude_variance = altitude_noise * altitude_noise;
+}
+
+/*
+    x' = F * x + B * accel, with
+        |1  dt  -dt^2/2|        |dt^2/2|
+    F = |0  1   -dt    |    B = |dt    |
+        |0  0    1     |        |0     |
+    P' = F * P * F^T + B * B^T * accel_variance + diag(0, 0, bias_variance * dt)
+*/
+void kalman_filter_predict(kalman_filter_t * filter, float accel, float delta_time) {
+    if (!filter->initialized || delta_time <= 0.0f) {
+        return;
+    }
+
+    float dt = delta_time;
+    float dt2 = dt * dt / 2.0f;
+    float a = accel - filter->accel_bias;
+
+    filter->altitude += filter->velocity * dt + a * dt2;
+    filter->velocity += a * dt;
+
+    float (*p)[3] = filter->covariance;
+
+    /* F * P */
+    float fp[3][3];
+    for (int j=0; j<3; j++) {
+        fp[0][j] = p[0][j] + dt * p[1][j] - dt2 * p[2][j];
+        fp[1][j] = p[1][j] - dt * p[2][j];
+        fp[2][j] = p[2][j];
+    }
+
+    /* (F * P) * F^T */
+    for (int i=0; i<3; i++) {
+        p[i][0] = fp[i][0] + dt * fp[i][1] - dt2 * fp[i][2];
+        p[i][1] = fp[i][1] - dt * fp[i][2];
+        p[i][2] = fp[i][2];
+    }
+
+    float b[2] = {dt2, dt};
+    for (int i=0; i<2; i++) {
+        for (int j=0; j<2; j++) {
+            p[i][j] += b[i] * b[j] * filter->accel_variance;
+        }
+    }
+    p[2][2] += filter->bias_variance * dt;
+}
+
+/*
+    H = |1 0 0|, S = P[0][0] + R, K = P[.][0] / S
+    x' = x + K * (altitude - x[0]), P' = P - K * P[0][.]
+*/
+void kalman_filter_update(kalman_filter_t * filter, float altitude) {
+    kalman_filter_update_with_variance(filter, altitude, filter->altitude_variance);
+}
+
+void kalman_filter_update_with_variance(kalman_filter_t * filter, float altitude, float variance) {
+    if (!filter->initialized) {
+        filter->altitude = altitude;
+        filter->velocity = 0.0f;
+        filter->accel_bias = 0.0f;
+        filter->initialized = 1;
+        return;
+    }
+
+    float (*p)[3] = filter->covariance;
+    float s = p[0][0] + variance;
+    float k[3] = {p[0][0] / s, p[1][0] / s, p[2][0] / s};
+    float innovation = altitude - filter->altitude;
+
+    filter->altitude += k[0] * innovation;
+    filter->velocity += k[1] * innovation;
+    filter->accel_bias += k[2] * innovation;
+
+    float p0[3] = {p[0][0], p[0][1], p[0][2]};
+    for (int i=0; i<3; i++) {
+        for (int j=0; j<3; j++) {
+            p[i][j] -= k[i] * p0[j];
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+    Vertical motion estimator, state is |altitude|velocity|acceleration bias|.
+    Prediction is driven by the gravity compensated vertical acceleration from the IMU,
+    correction by the barometric altitude. Units are meter and second.
+*/
+typedef struct {
+    float altitude;
+    float velocity;
+    float accel_bias;
+    float covariance[3][3];
+    float accel_variance;
+    float bias_variance;
+    float altitude_variance;
+    uint32_t initialized;
+} kalman_filter_t;
+
+kalman_filter_t * init_kalman_filter(float accel_noise, float bias_noise, float altitude_noise);
+void deinit_kalman_filter(kalman_filter_t * filter);
+void kalman_filter_set_noise(kalman_filter_t * filter, float accel_noise, float bias_noise, float altitude_noise);
+void kalman_filter_predict(kalman_filter_t * filter, float accel, float delta_time);
+void kalman_filter_update(kalman_filter_t * filter, float altitude);
+/* Same correction with the variance of this particular altitude instead of the configured one */
+void kalman_filter_update_with_variance(kalman_filter_t * filter, float altitude, float variance);
\ No newline at end of file
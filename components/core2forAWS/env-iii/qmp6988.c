@@ -1,3 +1,5 @@
+#include <math.h>
+
 #include "esp_log.h"
 #include "esp_err.h"
 
@@ -49,8 +51,21 @@ qmp6988_device_t * qmp6988_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_
             i2c_free_device(device->i2c_interface);
             free(device);
             return NULL;
+        }
+
+        io_setup_register_t io_setup_reg;
+        measurement_control_register_t control_reg;
+        if (ESP_OK != i2c_read_byte(device->i2c_interface, QMP6988_REGISTER_IO_SETUP, &(io_setup_reg.data)) ||
+            ESP_OK != i2c_read_byte(device->i2c_interface, QMP6988_REGISTER_MEASUREMENT_CONTROL, &(control_reg.data))) {
+            log_e("Read measurement condition failed");
+            i2c_free_device(device->i2c_interface);
+            free(device);
+            return NULL;
         } else {
-          return device;
+            device->standby_time = io_setup_reg.standby_time;
+            device->temperature_oversampling = control_reg.temperature_oversampling;
+            device->pressure_oversampling = control_reg.pressure_oversamping;
+            return device;
         }
     } else {
         log_e("New QMP6988 device initialization failed");
@@ -135,6 +150,19 @@ esp_err_t qmp6988_get_compensation_coefficients(qmp6988_device_t * device) {
     device->coes.b21 = +2.10e-15f + (+1.20e-14f) * ((int16_t)((coe_regs.b21_1 << 8) | coe_regs.b21_0)) / 32767.0f;
     device->coes.bp3 = +1.30e-16f + (+7.90e-17f) * ((int16_t)((coe_regs.bp3_1 << 8) | coe_regs.bp3_0)) / 32767.0f;
 
+    device->coes_fixed.a0  = llround(ldexp(device->coes.a0,  36));
+    device->coes_fixed.a1  = llround(ldexp(device->coes.a1,  40));
+    device->coes_fixed.a2  = llround(ldexp(device->coes.a2,  64));
+    device->coes_fixed.b00 = llround(ldexp(device->coes.b00, 40));
+    device->coes_fixed.bt1 = llround(ldexp(device->coes.bt1, 40));
+    device->coes_fixed.bt2 = llround(ldexp(device->coes.bt2, 56));
+    device->coes_fixed.bp1 = llround(ldexp(device->coes.bp1, 40));
+    device->coes_fixed.b11 = llround(ldexp(device->coes.b11, 60));
+    device->coes_fixed.bp2 = llround(ldexp(device->coes.bp2, 60));
+    device->coes_fixed.b12 = llround(ldexp(device->coes.b12, 72));
+    device->coes_fixed.b21 = llround(ldexp(device->coes.b21, 76));
+    device->coes_fixed.bp3 = llround(ldexp(device->coes.bp3, 84));
+
     log_i("compensation coefficients registers:");
     log_reg(coe_regs.data_array, QMP6988_COMPENSATION_COES_LENGTH);
     log_i("coes.a0: %e, coes.a1: %e, coes.a2: %e", device->coes.a0, device->coes.a1, device->coes.a2);
@@ -168,6 +196,8 @@ esp_err_t qmp6988_set_standby(qmp6988_device_t * device, uint8_t standby_time) {
 
     if (return_value != ESP_OK) {
         log_e("qmp6988_get_compensation_coefficients->i2c_write_byte faild");
+    } else {
+        device->standby_time = standby_time;
     }
 
     return return_value;
@@ -190,6 +220,9 @@ esp_err_t qmp6988_set_oversampling(qmp6988_device_t * device, uint8_t temperatur
 
     if (return_value != ESP_OK) {
         log_e("qmp6988_set_oversampling->i2c_write_byte faild");
+    } else {
+        device->temperature_oversampling = temperature_oversamping;
+        device->pressure_oversampling = pressure_oversampling;
     }
 
     return return_value;
@@ -237,6 +270,19 @@ esp_err_t qmp6988_set_iir_response_depth(qmp6988_device_t * device, uint8_t resp
     return return_value;
 }
 
+uint32_t qmp6988_get_measurement_period(qmp6988_device_t * device) {
+    static const uint32_t standby_us[] = {1000, 5000, 50000, 250000, 500000, 1000000, 2000000, 4000000};
+
+    /* Oversampling code n means 2^(n-1) conversions, code 0 skips the measurement */
+    uint32_t temperature_count = (device->temperature_oversampling == QMP6988_OVERSAMPLING_COUNT_SKIPPED) ? 0 : (1 << (device->temperature_oversampling - 1));
+    uint32_t pressure_count = (device->pressure_oversampling == QMP6988_OVERSAMPLING_COUNT_SKIPPED) ? 0 : (1 << (device->pressure_oversampling - 1));
+
+    return QMP6988_MEASUREMENT_TIME_BASE_US +
+        QMP6988_MEASUREMENT_TIME_TEMPERATURE_US * temperature_count +
+        QMP6988_MEASUREMENT_TIME_PRESSURE_US * pressure_count +
+        standby_us[device->standby_time & 0x07];
+}
+
 static esp_err_t qmp6988_set_power_mode(qmp6988_device_t * device, uint8_t power_mode) {
     measurement_control_register_t control_reg;
 
@@ -291,40 +337,90 @@ esp_err_t qmp6988_stop_periodic_measure(qmp6988_device_t * device) {
     return return_value;
 }
 
-esp_err_t qmp6988_fetch_result(qmp6988_device_t * device, double * temperature, double * pressure) {
+static esp_err_t qmp6988_fetch_raw(qmp6988_device_t * device, int32_t * t_raw, int32_t * p_raw) {
     measurement_result_registers_t otps;
 
     esp_err_t return_value = i2c_read_bytes(device->i2c_interface, QMP6988_REGISTER_RESULT_START, otps.data_array, QMP6988_REGISTER_RESULT_LENGTH);
 
     if (return_value != ESP_OK) {
-        log_e("qmp6988_fetch_result->i2c_read_bytes faild");
+        log_e("qmp6988_fetch_raw->i2c_read_bytes faild");
     } else {
-        int32_t t_raw = (((uint32_t)otps.t_txd2 << 16) | ((uint32_t)otps.t_txd1 << 8) | (uint32_t)otps.t_txd0) - QMP6988_RESULT_ADJUSTMENT;
-        int32_t p_raw = (((uint32_t)otps.p_txd2 << 16) | ((uint32_t)otps.p_txd1 << 8) | (uint32_t)otps.p_txd0) - QMP6988_RESULT_ADJUSTMENT;
+        *t_raw = (((uint32_t)otps.t_txd2 << 16) | ((uint32_t)otps.t_txd1 << 8) | (uint32_t)otps.t_txd0) - QMP6988_RESULT_ADJUSTMENT;
+        *p_raw = (((uint32_t)otps.p_txd2 << 16) | ((uint32_t)otps.p_txd1 << 8) | (uint32_t)otps.p_txd0) - QMP6988_RESULT_ADJUSTMENT;
+    }
 
-        //log_i("t_raw: %d, p_raw: %d", t_raw, p_raw);
+    return return_value;
+}
 
-        double t_res = device->coes.a0 + device->coes.a1 * t_raw + device->coes.a2 * t_raw * t_raw;
+void qmp6988_compensate(qmp6988_device_t * device, int32_t t_raw, int32_t p_raw, double * temperature, double * pressure) {
+    double t_res = device->coes.a0 + device->coes.a1 * t_raw + device->coes.a2 * t_raw * t_raw;
 
-        double p_res =
-            device->coes.b00 +
-            device->coes.bt1 * t_res +
-            device->coes.bp1 * p_raw +
-            device->coes.b11 * t_res * p_raw +
-            device->coes.bt2 * t_res * t_res +
-            device->coes.bp2 * p_raw * p_raw +
-            device->coes.b12 * p_raw * t_res * t_res +
-            device->coes.b21 * p_raw * p_raw * t_res +
-            device->coes.bp3 * p_raw * p_raw * p_raw ;
+    double p_res =
+        device->coes.b00 +
+        device->coes.bt1 * t_res +
+        device->coes.bp1 * p_raw +
+        device->coes.b11 * t_res * p_raw +
+        device->coes.bt2 * t_res * t_res +
+        device->coes.bp2 * p_raw * p_raw +
+        device->coes.b12 * p_raw * t_res * t_res +
+        device->coes.b21 * p_raw * p_raw * t_res +
+        device->coes.bp3 * p_raw * p_raw * p_raw ;
 
-        log_i("t_res: %f, p_res: %f", t_res, p_res);
+    log_i("t_res: %f, p_res: %f", t_res, p_res);
 
-        if (temperature) {
-            (*temperature) = t_res / 256.0;
-        }
-        if (pressure) {
-            *pressure = p_res;
-        }
+    if (temperature) {
+        (*temperature) = t_res / 256.0;
+    }
+    if (pressure) {
+        *pressure = p_res;
+    }
+}
+
+/*
+    Same polynomial as qmp6988_compensate on int64, the ESP32 has no double precision FPU.
+    p = b00 + t * (bt1 + bt2 * t) + p_raw * (bp1 + b11 * t + b12 * t^2 + p_raw * (bp2 + b21 * t + bp3 * p_raw))
+*/
+void qmp6988_compensate_fixed(qmp6988_device_t * device, int32_t t_raw, int32_t p_raw, int32_t * temperature, int32_t * pressure) {
+    const compensation_coefficients_fixed_t * coes = &(device->coes_fixed);
+    int64_t dt = t_raw;
+    int64_t dp = p_raw;
+
+    int64_t t_res = coes->a0 + ((coes->a1 * dt) >> 4) + (((coes->a2 * dt) >> 28) * dt);    /* Q36 */
+    int64_t t = t_res >> 28;                                                                /* Q8 */
+
+    int64_t inner2 = coes->bp2 + ((coes->b21 * t) >> 24) + ((coes->bp3 * dp) >> 24);                          /* Q60 */
+    int64_t inner1 = coes->bp1 + ((coes->b11 * t) >> 28) + ((((coes->b12 * t) >> 24) * t) >> 24) + ((inner2 * dp) >> 20);   /* Q40 */
+    int64_t p_res = coes->b00 + (((coes->bt1 + ((coes->bt2 * t) >> 24)) * t) >> 8) + inner1 * dp;             /* Q40 */
+
+    if (temperature) {
+        *temperature = (t_res * QMP6988_FIXED_TEMPERATURE_SCALE + ((int64_t)1 << 43)) >> 44;
+    }
+    if (pressure) {
+        *pressure = (p_res + ((int64_t)1 << (39 - QMP6988_FIXED_PRESSURE_SHIFT))) >> (40 - QMP6988_FIXED_PRESSURE_SHIFT);
+    }
+}
+
+esp_err_t qmp6988_fetch_result(qmp6988_device_t * device, double * temperature, double * pressure) {
+    int32_t t_raw;
+    int32_t p_raw;
+
+    esp_err_t return_value = qmp6988_fetch_raw(device, &t_raw, &p_raw);
+
+    if (return_value == ESP_OK) {
+        qmp6988_compensate(device, t_raw, p_raw, temperature, pressure);
+    }
+
+    return return_value;
+}
+
+esp_err_t qmp6988_fetch_result_fixed(qmp6988_device_t * device, int32_t * temperature, int32_t * pressure) {
+    int32_t t_raw;
+    int32_t p_raw;
+
+    esp_err_t return_value = qmp6988_fetch_raw(device, &t_raw, &p_raw);
+
+    if (return_value == ESP_OK) {
+        qmp6988_compensate_fixed(device, t_raw, p_raw, temperature, pressure);
     }
 
     return return_value;
@@ -63,6 +63,25 @@ typedef struct {
     double bp3;
 } compensation_coefficients_t;
 
+/*
+    Compensation coefficients scaled for the int64 evaluation, Qn is the number of fractional bits.
+    Temperature terms take t_res in Q8 (t_res * 256), so every product fits in 63 bits over the sensor range.
+*/
+typedef struct {
+    int64_t a0;     /* Q36 */
+    int64_t a1;     /* Q40 */
+    int64_t a2;     /* Q64 */
+    int64_t b00;    /* Q40 */
+    int64_t bt1;    /* Q40 */
+    int64_t bt2;    /* Q56 */
+    int64_t bp1;    /* Q40 */
+    int64_t b11;    /* Q60 */
+    int64_t bp2;    /* Q60 */
+    int64_t b12;    /* Q72 */
+    int64_t b21;    /* Q76 */
+    int64_t bp3;    /* Q84 */
+} compensation_coefficients_fixed_t;
+
 /* Chip ID register & value */
 #define QMP6988_REGISTER_CHIP_ID                (0xD1)
 #define QMP6988_CHIP_ID                         (0x5C)
@@ -196,9 +215,22 @@ typedef union {
     };
 } measurement_result_registers_t;
 
+/* Fixed point results: temperature in 0.01 degree C, pressure in 1/256 Pa */
+#define QMP6988_FIXED_TEMPERATURE_SCALE         (100)
+#define QMP6988_FIXED_PRESSURE_SHIFT            (8)
+
+/* Measurement time model fitted to the datasheet table, in microseconds */
+#define QMP6988_MEASUREMENT_TIME_BASE_US        (2600)
+#define QMP6988_MEASUREMENT_TIME_PRESSURE_US    (950)
+#define QMP6988_MEASUREMENT_TIME_TEMPERATURE_US (1000)
+
 typedef struct {
     I2CDevice_t i2c_interface;
     compensation_coefficients_t coes;
+    compensation_coefficients_fixed_t coes_fixed;
+    uint8_t standby_time;
+    uint8_t temperature_oversampling;
+    uint8_t pressure_oversampling;
 } qmp6988_device_t;
 
 qmp6988_device_t * qmp6988_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl, uint32_t freq, uint8_t device_addr);
@@ -213,8 +245,13 @@ esp_err_t qmp6988_set_standby(qmp6988_device_t * device, uint8_t standby_time);
 esp_err_t qmp6988_set_oversampling(qmp6988_device_t * device, uint8_t temperature_oversamping, uint8_t pressure_oversampling);
 esp_err_t qmp6988_set_master_code(qmp6988_device_t * device, uint8_t master_code);
 esp_err_t qmp6988_set_iir_response_depth(qmp6988_device_t * device, uint8_t response_depth);
+uint32_t qmp6988_get_measurement_period(qmp6988_device_t * device);
 
 esp_err_t qmp6988_do_single_shot_measure(qmp6988_device_t * device, double * temperature, double * pressure);
 esp_err_t qmp6988_start_periodic_measure(qmp6988_device_t * device);
 esp_err_t qmp6988_stop_periodic_measure(qmp6988_device_t * device);
 esp_err_t qmp6988_fetch_result(qmp6988_device_t * device, double * temperature, double * pressure);
+esp_err_t qmp6988_fetch_result_fixed(qmp6988_device_t * device, int32_t * temperature, int32_t * pressure);
+
+void qmp6988_compensate(qmp6988_device_t * device, int32_t t_raw, int32_t p_raw, double * temperature, double * pressure);
+void qmp6988_compensate_fixed(qmp6988_device_t * device, int32_t t_raw, int32_t p_raw, int32_t * temperature, int32_t * pressure);
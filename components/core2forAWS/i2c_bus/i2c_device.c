@@ -1,9 +1,15 @@
+#include <stdio.h>
+#include <string.h>
+
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
 #include "freertos/semphr.h"
 
 #include "driver/i2c.h"
 #include "esp_log.h"
 #include "esp_err.h"
+#include "esp_timer.h"
 
 #include "i2c_device.h"
 
@@ -27,8 +33,21 @@
 #define log_reg(buffer, buffer_len)
 #endif
 
+#ifdef CONFIG_I2C_DEVICE_REPLAY_RECORD
+#define record_read(device, op, reg_addr, data, length) i2c_record_read(device, op, reg_addr, data, length)
+#else
+#define record_read(device, op, reg_addr, data, length)
+#endif
+
 #define I2C_TIMEOUT_MS (100)
 
+/* Above the sensor tasks, the worker only runs while transactions wait */
+#define I2C_WORKER_PRIORITY             (tskIDLE_PRIORITY + 6)
+#define I2C_WORKER_STACK_SIZE           (4096)
+#define I2C_QUEUE_LENGTH                (8)
+/* Transactions of one window before the bus is released to direct users like the ATECC608 HAL */
+#define I2C_WINDOW_MAX                  (16)
+
 typedef struct _i2c_port_obj_t {
     i2c_port_t port;
     gpio_num_t scl;
@@ -39,22 +58,63 @@ typedef struct _i2c_port_obj_t {
 typedef struct _i2c_device_t {
     i2c_port_obj_t* i2c_port;
     uint8_t addr;
+    i2c_priority_t priority;
+    i2c_latency_t latency;
 } i2c_device_t;
 
+/*
+    One driver per bus, installed by the first device and kept for good. Devices only carry the clock they want,
+    switching between devices of different speed rewrites the timing registers of the running driver. The driver
+    is installed again only when a device comes with other pins on the same port.
+    Transactions are queued by priority and run by the worker task of the bus. The worker takes the bus once for
+    everything queued when it wakes and looks at the higher queues again after every transaction, so a barometer
+    read waits at most for the one transfer already on the wire.
+*/
+typedef struct {
+    bool installed;
+    gpio_num_t sda;
+    gpio_num_t scl;
+    uint32_t freq;
+    TaskHandle_t worker;
+    QueueHandle_t queues[I2C_PRIORITY_COUNT];
+    i2c_bus_stats_t stats;
+} i2c_bus_t;
+
 static SemaphoreHandle_t i2c_mutex[I2C_NUM_MAX];
-static i2c_port_obj_t *i2c_port_used[2] = { NULL, NULL };
+static i2c_bus_t i2c_buses[I2C_NUM_MAX];
+
+static void i2c_bus_start_worker(i2c_port_t port);
+
+#ifdef CONFIG_I2C_DEVICE_REPLAY_RECORD
+/*
+    One line per read, consumed by the host replay harness:
+    <timestamp us> <port> <address> <r|f> <register> <bytes...>
+    'f' marks FIFO pops, which the replay serves in order instead of storing into the register map
+*/
+static void i2c_record_read(i2c_device_t * device, char op, uint32_t reg_addr, const uint8_t * data, uint32_t length) {
+    char line[64 + 3 * 128];
+    int offset = snprintf(line, sizeof(line), "%lld %d %02x %c %02x", esp_timer_get_time(), device->i2c_port->port, device->addr, op, reg_addr & 0xff);
+    for (uint32_t i = 0; i < length && offset < sizeof(line) - 4; i++) {
+        offset += snprintf(line + offset, sizeof(line) - offset, " %02x", data[i]);
+    }
+    printf("%s\n", line);
+}
+#endif
 
 I2CDevice_t i2c_malloc_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl, uint32_t freq, uint8_t device_addr) {
     if (i2c_num > I2C_NUM_MAX) {
         i2c_num = I2C_NUM_MAX;
     }
 
+    // The first device comes from app_main, before any sensor task can race for the workers
     if (i2c_mutex[0] == NULL) {
         i2c_mutex[0] = xSemaphoreCreateRecursiveMutex();
+        i2c_bus_start_worker(I2C_NUM_0);
     }
 
     if (i2c_mutex[1] == NULL) {
         i2c_mutex[1] = xSemaphoreCreateRecursiveMutex(); 
+        i2c_bus_start_worker(I2C_NUM_1);
     }
 
     i2c_port_obj_t* new_device_port = (i2c_port_obj_t *)malloc(sizeof(i2c_port_obj_t));
@@ -74,6 +134,8 @@ I2CDevice_t i2c_malloc_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl
 
     device->i2c_port = new_device_port;
     device->addr = device_addr;
+    device->priority = I2C_PRIORITY_NORMAL;
+    memset(&device->latency, 0, sizeof(device->latency));
     log_i("New device malloc, scl: %d, sda: %d, freq: %d HZ",
         device->i2c_port->scl, device->i2c_port->sda, device->i2c_port->freq);
 
@@ -85,15 +147,7 @@ void i2c_free_device(I2CDevice_t i2c_device) {
         return ;
     }
 
-    i2c_device_t * device  = (i2c_device_t*) i2c_device;
-//    i2c_port_obj_t * used_port = i2c_port_used[device->i2c_port->port];
-    if (i2c_port_used[device->i2c_port->port] == device->i2c_port) {
-        i2c_port_used[device->i2c_port->port] = NULL;
-    }
-//    if (used_port != NULL && (device->i2c_port->sda == used_port->sda) && (device->i2c_port->scl == used_port->scl)) {
-//        i2c_port_used[device->i2c_port->port] = NULL;
-//    }
-
+    // The bus keeps its driver for the other devices on it
     free(((i2c_device_t *)i2c_device)->i2c_port);
     free(i2c_device);
 }
@@ -114,50 +168,71 @@ BaseType_t i2c_free_port(i2c_port_t i2c_num) {
     return xSemaphoreGiveRecursive(i2c_mutex[i2c_num]);
 }
 
-esp_err_t i2c_apply_bus(I2CDevice_t i2c_device) {
-    if (i2c_device == NULL) {
-        return ESP_FAIL;
-    }
-
-    i2c_device_t* device = (i2c_device_t *)i2c_device;
-    xSemaphoreTakeRecursive(i2c_mutex[device->i2c_port->port], portMAX_DELAY);
-    i2c_port_obj_t* used_port = i2c_port_used[device->i2c_port->port];
-    
-    if (used_port == device->i2c_port) {
-        return ESP_OK;
-    }
-
-    if ((used_port != NULL) && 
-        (device->i2c_port->sda == used_port->sda) && 
-        (device->i2c_port->scl == used_port->scl) && 
-        ((device->i2c_port->freq == used_port->freq))) {
-            i2c_port_used[device->i2c_port->port] = device->i2c_port;
-            return ESP_OK;    
-    }
+/* Same periods i2c_param_config derives from clk_speed, in APB clock cycles */
+static void i2c_bus_set_clock(i2c_port_t port, uint32_t freq) {
+    int half_cycle = I2C_APB_CLK_FREQ / freq / 2;
+    i2c_set_period(port, half_cycle, half_cycle);
+    i2c_set_start_timing(port, half_cycle, half_cycle);
+    i2c_set_stop_timing(port, half_cycle, half_cycle);
+    i2c_set_data_timing(port, half_cycle / 2, half_cycle / 2);
+    i2c_set_timeout(port, half_cycle * 20);
+}
 
-    if (used_port != NULL) {
-        i2c_driver_delete(device->i2c_port->port);
-        if ((device->i2c_port->sda != used_port->sda) || (device->i2c_port->scl != used_port->scl)) {
-            gpio_reset_pin(used_port->sda);
-            gpio_reset_pin(used_port->scl);
-        }
+static esp_err_t i2c_bus_install(i2c_port_obj_t * port) {
+    i2c_bus_t * bus = &i2c_buses[port->port];
+    if (bus->installed) {
+        i2c_driver_delete(port->port);
+        gpio_reset_pin(bus->sda);
+        gpio_reset_pin(bus->scl);
+        bus->installed = false;
     }
 
     i2c_config_t conf = {
         .mode = I2C_MODE_MASTER,
-        .sda_io_num = device->i2c_port->sda,
+        .sda_io_num = port->sda,
         .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_io_num = device->i2c_port->scl,
+        .scl_io_num = port->scl,
         .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = device->i2c_port->freq,
+        .master.clk_speed = port->freq,
     };
 
-    i2c_param_config(device->i2c_port->port, &conf);
-    i2c_driver_install(device->i2c_port->port, I2C_MODE_MASTER, 0, 0, 0);
+    esp_err_t err = i2c_param_config(port->port, &conf);
+    if (err == ESP_OK) {
+        err = i2c_driver_install(port->port, I2C_MODE_MASTER, 0, 0, 0);
+    }
+    if (err != ESP_OK) {
+        log_e("I2C driver install failed, port: %d, Code: 0x%x", port->port, err);
+        return err;
+    }
 
-    i2c_port_used[device->i2c_port->port] = device->i2c_port;
-    log_i("I2C config update, scl: %d, sda: %d, freq: %d HZ",
-            device->i2c_port->scl, device->i2c_port->sda, device->i2c_port->freq);
+    bus->installed = true;
+    bus->sda = port->sda;
+    bus->scl = port->scl;
+    bus->freq = port->freq;
+    bus->stats.installs++;
+    log_i("I2C driver installed, scl: %d, sda: %d, freq: %d HZ", port->scl, port->sda, port->freq);
+    return ESP_OK;
+}
+
+esp_err_t i2c_apply_bus(I2CDevice_t i2c_device) {
+    if (i2c_device == NULL) {
+        return ESP_FAIL;
+    }
+
+    i2c_device_t* device = (i2c_device_t *)i2c_device;
+    i2c_port_obj_t * port = device->i2c_port;
+    i2c_bus_t * bus = &i2c_buses[port->port];
+    xSemaphoreTakeRecursive(i2c_mutex[port->port], portMAX_DELAY);
+
+    if (!bus->installed || bus->sda != port->sda || bus->scl != port->scl) {
+        return i2c_bus_install(port);
+    }
+
+    if (bus->freq != port->freq) {
+        i2c_bus_set_clock(port->port, port->freq);
+        bus->freq = port->freq;
+        bus->stats.clock_changes++;
+    }
     return ESP_OK;
 }
 
@@ -169,90 +244,313 @@ esp_err_t i2c_free_bus(I2CDevice_t i2c_device) {
     return (xSemaphoreGiveRecursive(i2c_mutex[device->i2c_port->port]) == pdTRUE) ? ESP_OK : ESP_FAIL;
 }
 
-esp_err_t i2c_read_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
-    if (i2c_device == NULL || (length > 0 && data == NULL)) {
-        return ESP_ERR_INVALID_ARG;
+/* The link is given up at the first command the driver can not add */
+#define I2C_LINK_APPEND(err, call) do { if ((err) == ESP_OK) { (err) = (call); } } while (0)
+
+static esp_err_t i2c_transaction_append(const i2c_transaction_t * transaction, i2c_cmd_handle_t cmd) {
+    i2c_device_t* device = (i2c_device_t *)transaction->device;
+    esp_err_t err = ESP_OK;
+
+    if (transaction->kind == I2C_TRANSACTION_WRITE) {
+        I2C_LINK_APPEND(err, i2c_master_start(cmd));
+        I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1));
+        if(!(transaction->reg_addr & I2C_NO_REG)){
+            I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, transaction->reg_addr, 1));
+        }
+        if (transaction->length > 0) {
+            I2C_LINK_APPEND(err, i2c_master_write(cmd, transaction->data, transaction->length, 1));
+        }
+    } else if (transaction->kind == I2C_TRANSACTION_PROBE) {
+        I2C_LINK_APPEND(err, i2c_master_start(cmd));
+        I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1));
+    } else {
+        // A FIFO drain reads the same register window count times in one transaction
+        for (uint16_t i = 0; i < transaction->count; i++) {
+            uint8_t * entry = transaction->data + i * transaction->length;
+
+            if(!(transaction->reg_addr & I2C_NO_REG)){
+                I2C_LINK_APPEND(err, i2c_master_start(cmd));
+                I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1));
+                I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, transaction->reg_addr, 1));
+            }
+
+            I2C_LINK_APPEND(err, i2c_master_start(cmd));
+            I2C_LINK_APPEND(err, i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_READ, 1));
+            if (transaction->length > 1) {
+                I2C_LINK_APPEND(err, i2c_master_read(cmd, entry, transaction->length - 1, I2C_MASTER_ACK));
+            }
+            if (transaction->length > 0) {
+                I2C_LINK_APPEND(err, i2c_master_read_byte(cmd, &entry[transaction->length-1], I2C_MASTER_NACK));
+            }
+        }
     }
+    I2C_LINK_APPEND(err, i2c_master_stop(cmd));
 
-    i2c_device_t* device = (i2c_device_t *)i2c_device;
+    return err;
+}
 
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
+/* Built before the bus is taken, so the allocations of the link never hold up the other devices of the bus */
+static esp_err_t i2c_link_build(const i2c_transaction_t * transaction, i2c_cmd_handle_t * cmd) {
+    *cmd = i2c_cmd_link_create();
+    if (*cmd == NULL) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t err = i2c_transaction_append(transaction, *cmd);
+    if (err != ESP_OK) {
+        i2c_cmd_link_delete(*cmd);
+        *cmd = NULL;
+    }
+    return err;
+}
 
-    if(!(reg_addr & I2C_NO_REG)){
-        i2c_master_start(cmd);
-        i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1);
-        i2c_master_write_byte(cmd, reg_addr, 1);
+static void i2c_transaction_log(const i2c_transaction_t * transaction, esp_err_t err) {
+#if defined(CONFIG_I2C_DEVICE_DEBUG_INFO) || defined(CONFIG_I2C_DEVICE_DEBUG_ERROR) || defined(CONFIG_I2C_DEVICE_REPLAY_RECORD)
+    i2c_device_t* device = (i2c_device_t *)transaction->device;
+    uint32_t reg_addr = transaction->reg_addr;
+    uint16_t length = transaction->length;
+    uint16_t count = transaction->count;
+
+    if (transaction->kind == I2C_TRANSACTION_WRITE) {
+        if (err != ESP_OK) {
+            log_e("I2C Write Error, addr: 0x%02x, reg: 0x%02x, length: %d, Code: 0x%x", device->addr, reg_addr, length, err);
+        } else {
+            log_i("I2C Write Success, addr: 0x%02x, reg: 0x%02x, length: %d", device->addr, reg_addr, length);
+            log_reg(transaction->data, length);
+        }
+    } else if (transaction->kind == I2C_TRANSACTION_READ_REPEATED) {
+        if (err != ESP_OK) {
+            log_e("I2C Repeated Read Error: 0x%02x, reg: 0x%02x, length: %d, count: %d, Code: 0x%x", device->addr, reg_addr, length, count, err);
+        } else {
+            log_i("I2C Repeated Read Success: 0x%02x, reg: 0x%02x, length: %d, count: %d", device->addr, reg_addr, length, count);
+            log_reg(transaction->data, length * count);
+            record_read(device, 'f', reg_addr, transaction->data, length * count);
+        }
+    } else if (transaction->kind == I2C_TRANSACTION_READ) {
+        if (err != ESP_OK) {
+            log_e("I2C Read Error: 0x%02x, reg: 0x%02x, length: %d, Code: 0x%x", device->addr, reg_addr, length, err);
+        } else {
+            log_i("I2C Read Success: 0x%02x, reg: 0x%02x, length: %d", device->addr, reg_addr, length);
+            log_reg(transaction->data, length);
+            record_read(device, 'r', reg_addr, transaction->data, length);
+        }
     }
- 
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_READ, 1);
-    if (length > 1) {
-        i2c_master_read(cmd, data, length - 1, I2C_MASTER_ACK);
+#endif
+}
+
+/* Power of two buckets of microseconds, 0 holds everything below 2 us */
+static void i2c_latency_record(i2c_latency_t * latency, uint32_t latency_us) {
+    uint32_t bucket = 0;
+    while (bucket < I2C_LATENCY_BUCKETS - 1 && (latency_us >> (bucket + 1)) != 0) {
+        bucket++;
     }
-    if (length > 0) {
-        i2c_master_read_byte(cmd, &data[length-1], I2C_MASTER_NACK);
+    latency->counts[bucket]++;
+    latency->max_us = (latency_us > latency->max_us) ? latency_us : latency->max_us;
+}
+
+/* Takes the bus, applies the clock of the device and counts the transfer */
+static esp_err_t i2c_transaction_execute(i2c_transaction_t * transaction) {
+    i2c_device_t* device = (i2c_device_t *)transaction->device;
+    i2c_bus_t * bus = &i2c_buses[device->i2c_port->port];
+
+    i2c_cmd_handle_t cmd = NULL;
+    esp_err_t err = i2c_link_build(transaction, &cmd);
+    bool taken = (err == ESP_OK);
+    if (taken) {
+        err = i2c_apply_bus(device);
+    }
+    int64_t begin = esp_timer_get_time();
+    if (err == ESP_OK) {
+        err = i2c_master_cmd_begin(device->i2c_port->port, cmd, pdMS_TO_TICKS(I2C_TIMEOUT_MS));
+    }
+    int64_t end = esp_timer_get_time();
+
+    uint32_t wait_us = (uint32_t)(begin - transaction->submitted);
+    uint32_t latency_us = (uint32_t)(end - begin);
+    bus->stats.transactions++;
+    bus->stats.errors += (err != ESP_OK);
+    bus->stats.timeouts += (err == ESP_ERR_TIMEOUT);
+    bus->stats.wait_us += wait_us;
+    bus->stats.wait_max_us = (wait_us > bus->stats.wait_max_us) ? wait_us : bus->stats.wait_max_us;
+    bus->stats.latency_us += latency_us;
+    bus->stats.latency_max_us = (latency_us > bus->stats.latency_max_us) ? latency_us : bus->stats.latency_max_us;
+    i2c_latency_record(&device->latency, (uint32_t)(end - transaction->submitted));
+    if (taken) {
+        i2c_free_bus(device);
+    }
+    if (cmd != NULL) {
+        i2c_cmd_link_delete(cmd);
+    }
+
+    i2c_transaction_log(transaction, err);
+    transaction->result = err;
+    return err;
+}
+
+static i2c_transaction_t * i2c_bus_next(i2c_bus_t * bus) {
+    i2c_transaction_t * transaction = NULL;
+    for (int i = 0; i < I2C_PRIORITY_COUNT; i++) {
+        if (xQueueReceive(bus->queues[i], &transaction, 0) == pdTRUE) {
+            return transaction;
+        }
     }
-    i2c_master_stop(cmd);
-    i2c_apply_bus(i2c_device);
-    
-    esp_err_t err = ESP_FAIL;
+    return NULL;
+}
 
-    err = i2c_master_cmd_begin(device->i2c_port->port, cmd, pdMS_TO_TICKS(I2C_TIMEOUT_MS));
-    i2c_free_bus(i2c_device);
-    i2c_cmd_link_delete(cmd);
+static void i2c_bus_worker(void * arguments) {
+    i2c_port_t port = (i2c_port_t)(intptr_t)arguments;
+    i2c_bus_t * bus = &i2c_buses[port];
+
+    for ( ; ; ) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Everything queued by now makes one window, the bus is taken once for all of it
+        xSemaphoreTakeRecursive(i2c_mutex[port], portMAX_DELAY);
+        uint32_t served = 0;
+        i2c_transaction_t * transaction;
+        while (served < I2C_WINDOW_MAX && (transaction = i2c_bus_next(bus)) != NULL) {
+            esp_err_t err = i2c_transaction_execute(transaction);
+            // Called with the bus held, a follow up submitted by the callback is served in this same window
+            transaction->callback(transaction, err);
+            served++;
+        }
+        bus->stats.windows++;
+        xSemaphoreGiveRecursive(i2c_mutex[port]);
 
-    if (err != ESP_OK) {
-        log_e("I2C Read Error: 0x%02x, reg: 0x%02x, length: %d, Code: 0x%x", device->addr, reg_addr, length, err);
-    } else {
-        log_i("I2C Read Success: 0x%02x, reg: 0x%02x, length: %d", device->addr, reg_addr, length);
-        log_reg(data, length);
+        if (served == I2C_WINDOW_MAX) {
+            xTaskNotifyGive(bus->worker);
+        }
     }
+}
 
-    return err;
+static void i2c_bus_start_worker(i2c_port_t port) {
+    i2c_bus_t * bus = &i2c_buses[port];
+    for (int i = 0; i < I2C_PRIORITY_COUNT; i++) {
+        bus->queues[i] = xQueueCreate(I2C_QUEUE_LENGTH, sizeof(i2c_transaction_t *));
+        if (bus->queues[i] == NULL) {
+            log_e("I2C queue create failed, port: %d", port);
+            return;
+        }
+    }
+
+    if (xTaskCreate(i2c_bus_worker, "I2cWorker", I2C_WORKER_STACK_SIZE, (void *)(intptr_t)port, I2C_WORKER_PRIORITY, &bus->worker) != pdPASS) {
+        log_e("I2C worker create failed, port: %d", port);
+        bus->worker = NULL;
+    }
 }
 
-esp_err_t i2c_read_bytes_no_stop(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
-    if (i2c_device == NULL || (length > 0 && data == NULL)) {
+void i2c_transaction_init(i2c_transaction_t * transaction, I2CDevice_t i2c_device, i2c_transaction_kind_t kind,
+                          uint32_t reg_addr, uint8_t * data, uint16_t length, uint16_t count) {
+    transaction->device = i2c_device;
+    transaction->kind = kind;
+    transaction->reg_addr = reg_addr;
+    transaction->data = data;
+    transaction->length = length;
+    transaction->count = (kind == I2C_TRANSACTION_READ_REPEATED) ? count : 1;
+    transaction->priority = (i2c_device != NULL) ? ((i2c_device_t *)i2c_device)->priority : I2C_PRIORITY_NORMAL;
+    transaction->callback = NULL;
+    transaction->arg = NULL;
+    transaction->submitted = 0;
+    transaction->result = ESP_OK;
+}
+
+esp_err_t i2c_submit(i2c_transaction_t * transaction, i2c_transaction_cb_t callback, void * arg) {
+    if (transaction == NULL || transaction->device == NULL || callback == NULL || transaction->priority >= I2C_PRIORITY_COUNT) {
         return ESP_ERR_INVALID_ARG;
     }
 
-    i2c_device_t* device = (i2c_device_t *)i2c_device;
+    i2c_device_t* device = (i2c_device_t *)transaction->device;
+    i2c_bus_t * bus = &i2c_buses[device->i2c_port->port];
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    transaction->callback = callback;
+    transaction->arg = arg;
+    transaction->submitted = esp_timer_get_time();
 
-    i2c_cmd_handle_t cmd = i2c_cmd_link_create();
-    
-    if(!(reg_addr & I2C_NO_REG)){
-        i2c_master_start(cmd);
-        i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1);
-        i2c_master_write_byte(cmd, reg_addr, 1);
+    // Without a worker, or from a task holding the bus, the queue would never be served, run it at once
+    if (bus->worker == NULL || (bus->worker != current && xSemaphoreGetMutexHolder(i2c_mutex[device->i2c_port->port]) == current)) {
+        esp_err_t err = i2c_transaction_execute(transaction);
+        callback(transaction, err);
+        return ESP_OK;
     }
 
-    i2c_master_start(cmd);
-    i2c_master_write_byte(cmd, (device->addr << 1) | I2C_MASTER_READ, 1);
-    if (length > 1) {
-        i2c_master_read(cmd, data, length - 1, I2C_MASTER_ACK);
+    // The worker cannot wait for room in its own queue, a follow up from a callback fails instead
+    TickType_t ticks = (bus->worker == current) ? 0 : portMAX_DELAY;
+    if (xQueueSend(bus->queues[transaction->priority], &transaction, ticks) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
     }
-    if (length > 0) {
-        i2c_master_read_byte(cmd, &data[length-1], I2C_MASTER_NACK);
+    if (bus->worker != current) {
+        xTaskNotifyGive(bus->worker);
     }
-    i2c_master_stop(cmd);
-    i2c_apply_bus(i2c_device);
+    return ESP_OK;
+}
 
-    esp_err_t err = ESP_FAIL;
-    
-    err = i2c_master_cmd_begin(device->i2c_port->port, cmd, pdMS_TO_TICKS(I2C_TIMEOUT_MS));
-    i2c_free_bus(i2c_device);
-    i2c_cmd_link_delete(cmd);
+void i2c_completion_init(i2c_completion_t * completion) {
+    completion->done = xSemaphoreCreateBinaryStatic(&completion->buffer);
+    completion->result = ESP_OK;
+}
 
-    if (err != ESP_OK) {
-        log_e("I2C Read Error: 0x%02x, reg: 0x%02x, length: %d, Code: 0x%x", device->addr, reg_addr, length, err);
-    } else {
-        log_i("I2C Read Success: 0x%02x, reg: 0x%02x, length: %d", device->addr, reg_addr, length);
-        log_reg(data, length);
+void i2c_completion_signal(i2c_completion_t * completion, esp_err_t result) {
+    completion->result = result;
+    xSemaphoreGive(completion->done);
+}
+
+esp_err_t i2c_completion_wait(i2c_completion_t * completion) {
+    xSemaphoreTake(completion->done, portMAX_DELAY);
+    return completion->result;
+}
+
+static void i2c_transaction_wake(i2c_transaction_t * transaction, esp_err_t err) {
+    xSemaphoreGive((SemaphoreHandle_t)transaction->arg);
+}
+
+/*
+    Blocking calls queue like every other transaction. The worker itself and a task already holding the bus
+    through i2c_take_port or i2c_apply_bus run them at once, queueing would wait for their own mutex.
+*/
+static esp_err_t i2c_transaction_run(i2c_transaction_t * transaction) {
+    i2c_device_t* device = (i2c_device_t *)transaction->device;
+    i2c_bus_t * bus = &i2c_buses[device->i2c_port->port];
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+
+    if (bus->worker == NULL || bus->worker == current || xSemaphoreGetMutexHolder(i2c_mutex[device->i2c_port->port]) == current) {
+        transaction->submitted = esp_timer_get_time();
+        return i2c_transaction_execute(transaction);
     }
 
+    StaticSemaphore_t done_buffer;
+    SemaphoreHandle_t done = xSemaphoreCreateBinaryStatic(&done_buffer);
+    esp_err_t err = i2c_submit(transaction, i2c_transaction_wake, done);
+    if (err == ESP_OK) {
+        xSemaphoreTake(done, portMAX_DELAY);
+        err = transaction->result;
+    }
+    vSemaphoreDelete(done);
     return err;
 }
 
+esp_err_t i2c_read_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
+    if (i2c_device == NULL || (length > 0 && data == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2c_transaction_t transaction;
+    i2c_transaction_init(&transaction, i2c_device, I2C_TRANSACTION_READ, reg_addr, data, length, 1);
+    return i2c_transaction_run(&transaction);
+}
+
+esp_err_t i2c_read_bytes_no_stop(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
+    return i2c_read_bytes(i2c_device, reg_addr, data, length);
+}
+
+esp_err_t i2c_read_bytes_repeated(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length, uint16_t count) {
+    if (i2c_device == NULL || length == 0 || count == 0 || data == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2c_transaction_t transaction;
+    i2c_transaction_init(&transaction, i2c_device, I2C_TRANSACTION_READ_REPEATED, reg_addr, data, length, count);
+    return i2c_transaction_run(&transaction);
+}
+
 esp_err_t i2c_read_byte(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t* data) {
     return i2c_read_bytes(i2c_device, reg_addr, data, 1);
 }
@@ -296,35 +594,9 @@ esp_err_t i2c_write_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *da
         return ESP_FAIL;
     }
 
-    i2c_device_t* device = (i2c_device_t *)i2c_device;
-
-    i2c_cmd_handle_t write_cmd = i2c_cmd_link_create();
-    i2c_master_start(write_cmd);
-    i2c_master_write_byte(write_cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1);
-    if(!(reg_addr & I2C_NO_REG)){
-        i2c_master_write_byte(write_cmd, reg_addr, 1);
-    }
-    if (length > 0) {
-        i2c_master_write(write_cmd, data, length, 1);
-    }
-    i2c_master_stop(write_cmd);
-
-    esp_err_t err = ESP_FAIL;
-
-    i2c_apply_bus(i2c_device);
-    err = i2c_master_cmd_begin(device->i2c_port->port, write_cmd, pdMS_TO_TICKS(I2C_TIMEOUT_MS));
-    i2c_free_bus(i2c_device);
-
-    i2c_cmd_link_delete(write_cmd);
-
-    if (err != ESP_OK) {
-        log_e("I2C Write Error, addr: 0x%02x, reg: 0x%02x, length: %d, Code: 0x%x", device->addr, reg_addr, length, err);
-    } else {
-        log_i("I2C Write Success, addr: 0x%02x, reg: 0x%02x, length: %d", device->addr, reg_addr, length);
-        log_reg(data, length);
-    }
-
-    return err;
+    i2c_transaction_t transaction;
+    i2c_transaction_init(&transaction, i2c_device, I2C_TRANSACTION_WRITE, reg_addr, data, length, 1);
+    return i2c_transaction_run(&transaction);
 }
 
 esp_err_t i2c_write_byte(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data) {
@@ -363,43 +635,69 @@ esp_err_t i2c_write_bits(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data
     return i2c_write_byte(i2c_device, reg_addr, value);
 }
 
+/* Takes effect at the next transaction of the device, the bus driver stays */
 esp_err_t i2c_device_change_freq(I2CDevice_t i2c_device, uint32_t freq) {
     if (i2c_device == NULL) {
         return ESP_FAIL;
     }
     i2c_device_t* device = (i2c_device_t *)i2c_device;
     xSemaphoreTakeRecursive(i2c_mutex[device->i2c_port->port], portMAX_DELAY);
-    if (device->i2c_port->freq == freq) {
-        xSemaphoreGiveRecursive(i2c_mutex[device->i2c_port->port]);
-        return ESP_OK;
+    device->i2c_port->freq = freq;
+    xSemaphoreGiveRecursive(i2c_mutex[device->i2c_port->port]);
+    return ESP_OK;
+}
+
+void i2c_device_set_priority(I2CDevice_t i2c_device, i2c_priority_t priority) {
+    if (i2c_device != NULL && priority < I2C_PRIORITY_COUNT) {
+        ((i2c_device_t *)i2c_device)->priority = priority;
     }
+}
 
-    device->i2c_port->freq = freq;
-    if (i2c_port_used[device->i2c_port->port] == device->i2c_port) {
-        i2c_port_used[device->i2c_port->port] = NULL;
+esp_err_t i2c_device_get_latency(I2CDevice_t i2c_device, i2c_latency_t * latency) {
+    if (i2c_device == NULL || latency == NULL) {
+        return ESP_ERR_INVALID_ARG;
     }
+
+    i2c_device_t* device = (i2c_device_t *)i2c_device;
+    xSemaphoreTakeRecursive(i2c_mutex[device->i2c_port->port], portMAX_DELAY);
+    *latency = device->latency;
     xSemaphoreGiveRecursive(i2c_mutex[device->i2c_port->port]);
     return ESP_OK;
 }
 
+uint32_t i2c_latency_percentile(const i2c_latency_t * latency, uint32_t percent) {
+    uint32_t total = 0;
+    for (int i = 0; i < I2C_LATENCY_BUCKETS; i++) {
+        total += latency->counts[i];
+    }
+
+    uint32_t seen = 0;
+    for (int i = 0; i < I2C_LATENCY_BUCKETS; i++) {
+        seen += latency->counts[i];
+        if (total > 0 && (uint64_t)seen * 100 >= (uint64_t)total * percent) {
+            return (i < I2C_LATENCY_BUCKETS - 1) ? (2UL << i) : latency->max_us;
+        }
+    }
+    return 0;
+}
+
 esp_err_t i2c_device_valid(I2CDevice_t i2c_device) {
     if (i2c_device == NULL ) {
         return ESP_FAIL;
     }
 
-    i2c_device_t* device = (i2c_device_t *)i2c_device;
-
-    i2c_cmd_handle_t write_cmd = i2c_cmd_link_create();
-    i2c_master_start(write_cmd);
-    i2c_master_write_byte(write_cmd, (device->addr << 1) | I2C_MASTER_WRITE, 1);
-    i2c_master_stop(write_cmd);
-
-    esp_err_t err = ESP_FAIL;
+    i2c_transaction_t transaction;
+    i2c_transaction_init(&transaction, i2c_device, I2C_TRANSACTION_PROBE, I2C_NO_REG, NULL, 0, 1);
+    return i2c_transaction_run(&transaction);
+}
 
-    i2c_apply_bus(i2c_device);
-    err = i2c_master_cmd_begin(device->i2c_port->port, write_cmd, pdMS_TO_TICKS(I2C_TIMEOUT_MS));
-    i2c_free_bus(i2c_device);
+esp_err_t i2c_get_bus_stats(i2c_port_t i2c_num, i2c_bus_stats_t * stats) {
+    if (i2c_num >= I2C_NUM_MAX || i2c_mutex[i2c_num] == NULL || stats == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
-    i2c_cmd_link_delete(write_cmd);
-    return err;
-}
\ No newline at end of file
+    xSemaphoreTakeRecursive(i2c_mutex[i2c_num], portMAX_DELAY);
+    *stats = i2c_buses[i2c_num].stats;
+    xSemaphoreGiveRecursive(i2c_mutex[i2c_num]);
+    return ESP_OK;
+}
@@ -5,6 +5,8 @@ extern "C" {
 #endif
 
 #include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "driver/gpio.h"
 #include "driver/i2c.h"
 
@@ -41,6 +43,103 @@ extern "C" {
 typedef void * I2CDevice_t;
 /* @[declare_i2cdevice_t] */
 
+/**
+ * @brief Counters of one I2C bus since boot.
+ *
+ * Every bus has one driver installed by its first device. Devices
+ * of different speed on the same bus only change its clock, the
+ * driver is installed again only for a device on other pins.
+ */
+/* @[declare_i2c_bus_stats_t] */
+typedef struct {
+    uint32_t installs;          /* driver installs, one unless pins change */
+    uint32_t clock_changes;     /* timing register updates between devices */
+    uint32_t transactions;
+    uint32_t errors;
+    uint32_t timeouts;
+    uint64_t wait_us;           /* waiting for the bus */
+    uint32_t wait_max_us;
+    uint64_t latency_us;        /* on the bus */
+    uint32_t latency_max_us;
+    uint32_t windows;           /* worker wake ups, each takes the bus once */
+} i2c_bus_stats_t;
+/* @[declare_i2c_bus_stats_t] */
+
+/**
+ * @brief Queue of a transaction on its bus.
+ *
+ * Each bus has a worker task serving its queues highest first and
+ * looking at them again after every transaction. Devices start at
+ * I2C_PRIORITY_NORMAL.
+ */
+/* @[declare_i2c_priority_t] */
+typedef enum {
+    I2C_PRIORITY_HIGH = 0,
+    I2C_PRIORITY_NORMAL,
+    I2C_PRIORITY_LOW,
+    I2C_PRIORITY_COUNT,
+} i2c_priority_t;
+/* @[declare_i2c_priority_t] */
+
+typedef enum {
+    I2C_TRANSACTION_READ = 0,
+    I2C_TRANSACTION_READ_REPEATED,
+    I2C_TRANSACTION_WRITE,
+    I2C_TRANSACTION_PROBE,
+} i2c_transaction_kind_t;
+
+typedef struct _i2c_transaction_t i2c_transaction_t;
+
+/* Called by the bus worker with the bus held, keep it short, it delays everything queued behind */
+typedef void (* i2c_transaction_cb_t)(i2c_transaction_t * transaction, esp_err_t err);
+
+/**
+ * @brief One queued bus transaction.
+ *
+ * Owned by the caller until its callback runs, data and the
+ * descriptor itself must stay valid until then.
+ */
+/* @[declare_i2c_transaction_t] */
+struct _i2c_transaction_t {
+    I2CDevice_t device;
+    i2c_transaction_kind_t kind;
+    uint32_t reg_addr;
+    uint8_t * data;
+    uint16_t length;
+    uint16_t count;             /* register windows of a repeated read */
+    i2c_priority_t priority;    /* of the device unless changed after init */
+    i2c_transaction_cb_t callback;
+    void * arg;
+    int64_t submitted;          /* us */
+    esp_err_t result;
+};
+/* @[declare_i2c_transaction_t] */
+
+/**
+ * @brief Completion of a chain of transactions.
+ */
+/* @[declare_i2c_completion_t] */
+typedef struct {
+    SemaphoreHandle_t done;
+    StaticSemaphore_t buffer;
+    esp_err_t result;
+} i2c_completion_t;
+/* @[declare_i2c_completion_t] */
+
+/**
+ * @brief Time from submit to completion of a device's transactions.
+ *
+ * Bucket i counts latencies below 2^(i+1) us, the last one
+ * everything above.
+ */
+/* @[declare_i2c_latency_t] */
+#define I2C_LATENCY_BUCKETS     (16)
+typedef struct {
+    uint32_t counts[I2C_LATENCY_BUCKETS];
+    uint32_t max_us;
+} i2c_latency_t;
+/* @[declare_i2c_latency_t] */
+
 I2CDevice_t i2c_malloc_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl, uint32_t freq, uint8_t device_addr);
 
 void i2c_free_device(I2CDevice_t i2c_device);
@@ -70,6 +169,14 @@ esp_err_t i2c_write_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *da
 
 esp_err_t i2c_read_bytes_no_stop(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length);
 
+/*
+    Read the same register window several times in one bus transaction,
+    used to drain hardware FIFOs which pop one entry per register read.
+    reg_addr = 0x00, length = 3, count = 4
+    data -> |entry 0 (3 bytes)|entry 1|entry 2|entry 3|
+*/
+esp_err_t i2c_read_bytes_repeated(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length, uint16_t count);
+
 esp_err_t i2c_write_byte(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data);
 
 esp_err_t i2c_write_bit(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data, uint8_t bit_pos);
@@ -91,6 +198,36 @@ BaseType_t i2c_take_port(i2c_port_t i2c_num, uint32_t timeout);
 
 BaseType_t i2c_free_port(i2c_port_t i2c_num);
 
+esp_err_t i2c_get_bus_stats(i2c_port_t i2c_num, i2c_bus_stats_t * stats);
+
+void i2c_device_set_priority(I2CDevice_t i2c_device, i2c_priority_t priority);
+
+void i2c_transaction_init(i2c_transaction_t * transaction, I2CDevice_t i2c_device, i2c_transaction_kind_t kind,
+                          uint32_t reg_addr, uint8_t * data, uint16_t length, uint16_t count);
+
+/*
+    Queue a transaction and return, callback runs on the bus worker when it is done.
+    The blocking calls above go through the same queues and wait for their own callback.
+    A callback may submit the next transaction of a chain, it never waits for room in the queue
+    and gets ESP_ERR_TIMEOUT when it is full.
+*/
+esp_err_t i2c_submit(i2c_transaction_t * transaction, i2c_transaction_cb_t callback, void * arg);
+
+/*
+    End of a chain of submitted transactions, signalled by its last callback.
+    A driver keeps one per chain in flight, the task that submitted the chain waits on it.
+*/
+void i2c_completion_init(i2c_completion_t * completion);
+
+void i2c_completion_signal(i2c_completion_t * completion, esp_err_t result);
+
+esp_err_t i2c_completion_wait(i2c_completion_t * completion);
+
+esp_err_t i2c_device_get_latency(I2CDevice_t i2c_device, i2c_latency_t * latency);
+
+/* Upper bound of the bucket holding the percentile, in us, 0 without samples */
+uint32_t i2c_latency_percentile(const i2c_latency_t * latency, uint32_t percent);
+
 
 #ifdef __cplusplus
 }
@@ -1,12 +1,49 @@
 #include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "esp_attr.h"
+#include "esp_timer.h"
 #include "i2c_device.h"
 #include "mpu6886.h"
 
+#ifndef CONFIG_MPU6886_INT_GPIO
+#define CONFIG_MPU6886_INT_GPIO -1
+#endif
+
+/* USER_CTRL and CONFIG bits of the FIFO, the FIFO stops when full instead of overwriting frames in part */
+#define MPU6886_USER_CTRL_FIFO_EN   (0x01 << 6)
+#define MPU6886_USER_CTRL_FIFO_RST  (0x01 << 2)
+#define MPU6886_CONFIG_FIFO_MODE    (0x01 << 6)
+#define MPU6886_CONFIG_DLPF_176HZ   (0x01)
+#define MPU6886_FIFO_EN_GYRO_ACCEL  ((0x01 << 4) | (0x01 << 3))
+#define MPU6886_INT_FIFO_OFLOW_EN   (0x01 << 4)
+/* Latched, active high, cleared by any read, the FIFO drain itself acknowledges the watermark */
+#define MPU6886_INT_PIN_LATCH_CLEAR ((0x01 << 5) | (0x01 << 4))
+
 static I2CDevice_t mpu6886_device;
 static gyro_scale_t gyro_scale = MPU6886_GFS_2000DPS;
 static acc_scale_t acc_scale = MPU6886_AFS_8G;
 static float acc_res, gyro_res;
 
+static bool stream_running = false;
+static uint32_t stream_period_us;
+static uint32_t stream_watermark;
+static uint32_t stream_overflows;
+static TickType_t stream_wake_ticks;
+static uint8_t stream_buffer[MPU6886_FIFO_FRAMES_MAX * MPU6886_FIFO_FRAME_LENGTH];
+/* Count read and drain of one batch, chained on the bus worker */
+static i2c_transaction_t stream_count_transaction;
+static i2c_transaction_t stream_fifo_transaction;
+static i2c_completion_t stream_done;
+static uint8_t stream_count[2];
+static uint32_t stream_max_frames;
+static uint32_t stream_frames;
+static int64_t stream_read_time;
+#if CONFIG_MPU6886_INT_GPIO >= 0
+static SemaphoreHandle_t stream_ready = NULL;
+#endif
+
 static void MPU6886_I2CInit() {
     mpu6886_device = i2c_malloc_device(I2C_NUM_1, 21, 22, 400000, MPU6886_ADDRESS);
 }
@@ -19,10 +56,17 @@ static void MPU6886_I2CWriteBytes(uint8_t start_Addr, uint8_t number_Bytes, uint
     i2c_write_bytes(mpu6886_device, start_Addr, write_Buffer, number_Bytes);
 }
 
+/* Stream setup checks every write, a stream started on a dead bus would only ever fail its reads */
+static int MPU6886_StreamWrite(uint8_t reg, uint8_t value) {
+    return (i2c_write_bytes(mpu6886_device, reg, &value, 1) == ESP_OK) ? 0 : -1;
+}
+
 int MPU6886_Init(void) {
     unsigned char tempdata[1];
     unsigned char regdata;
     MPU6886_I2CInit();
+    // Once for the device, every stream started later waits its batches on the same completion
+    i2c_completion_init(&stream_done);
 
     MPU6886_I2CReadBytes(MPU6886_WHOAMI, 1, tempdata);
     if (tempdata[0] != 0x19) {
@@ -187,3 +231,194 @@ void MPU6886_GetTempData(float *t) {
     MPU6886_GetTempAdc(&temp);
     *t = (float)temp / 326.8 + 25.0;
 }
+
+#if CONFIG_MPU6886_INT_GPIO >= 0
+static void IRAM_ATTR MPU6886_StreamISRHandler(void* arg) {
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(stream_ready, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static int MPU6886_StreamInterruptInit(void) {
+    if (stream_ready == NULL) {
+        stream_ready = xSemaphoreCreateBinary();
+        if (stream_ready == NULL) {
+            return -1;
+        }
+
+        gpio_config_t io_conf;
+        io_conf.intr_type = GPIO_INTR_POSEDGE;
+        io_conf.pin_bit_mask = (1ULL << CONFIG_MPU6886_INT_GPIO);
+        io_conf.mode = GPIO_MODE_INPUT;
+        io_conf.pull_up_en = 0;
+        io_conf.pull_down_en = 1;
+        gpio_config(&io_conf);
+        // Already installed by the touch driver when it is enabled
+        gpio_install_isr_service(0);
+        gpio_isr_handler_add(CONFIG_MPU6886_INT_GPIO, MPU6886_StreamISRHandler, NULL);
+    }
+
+    if (MPU6886_StreamWrite(MPU6886_INT_PIN_CFG, MPU6886_INT_PIN_LATCH_CLEAR) != 0) {
+        return -1;
+    }
+    xSemaphoreTake(stream_ready, 0);
+    return 0;
+}
+#endif
+
+int MPU6886_StartStream(uint32_t odr_hz, uint32_t watermark) {
+    if (odr_hz < 4 || odr_hz > MPU6886_SAMPLE_RATE_HZ || watermark == 0 || watermark > MPU6886_FIFO_FRAMES_MAX / 2) {
+        return -1;
+    }
+
+    uint32_t divider = (MPU6886_SAMPLE_RATE_HZ + odr_hz / 2) / odr_hz;
+    divider = (divider > 256) ? 256 : divider;
+
+    // The watermark is in bytes over ten bits, a non zero threshold arms the watermark interrupt
+    uint32_t watermark_bytes = watermark * MPU6886_FIFO_FRAME_LENGTH;
+    if (MPU6886_StreamWrite(MPU6886_FIFO_EN, 0x00) != 0 ||
+        MPU6886_StreamWrite(MPU6886_USER_CTRL, 0x00) != 0 ||
+        MPU6886_StreamWrite(MPU6886_SMPLRT_DIV, divider - 1) != 0 ||
+        MPU6886_StreamWrite(MPU6886_CONFIG, MPU6886_CONFIG_FIFO_MODE | MPU6886_CONFIG_DLPF_176HZ) != 0 ||
+        MPU6886_StreamWrite(MPU6886_FIFO_WM_TH1, (watermark_bytes >> 8) & 0x03) != 0 ||
+        MPU6886_StreamWrite(MPU6886_FIFO_WM_TH2, watermark_bytes & 0xff) != 0 ||
+        // Data ready interrupts would fire for every sample, only the watermark and overflows do now
+        MPU6886_StreamWrite(MPU6886_INT_ENABLE, MPU6886_INT_FIFO_OFLOW_EN) != 0) {
+        return -1;
+    }
+
+#if CONFIG_MPU6886_INT_GPIO >= 0
+    if (MPU6886_StreamInterruptInit() != 0) {
+        return -1;
+    }
+#endif
+
+    if (MPU6886_StreamWrite(MPU6886_USER_CTRL, MPU6886_USER_CTRL_FIFO_RST) != 0) {
+        return -1;
+    }
+    vTaskDelay(1);
+    if (MPU6886_StreamWrite(MPU6886_USER_CTRL, MPU6886_USER_CTRL_FIFO_EN) != 0 ||
+        MPU6886_StreamWrite(MPU6886_FIFO_EN, MPU6886_FIFO_EN_GYRO_ACCEL) != 0) {
+        return -1;
+    }
+
+    stream_period_us = divider * (1000000 / MPU6886_SAMPLE_RATE_HZ);
+    stream_watermark = watermark;
+    stream_overflows = 0;
+    stream_wake_ticks = xTaskGetTickCount();
+    stream_running = true;
+    return 0;
+}
+
+void MPU6886_StopStream(void) {
+    unsigned char regdata = 0x00;
+    MPU6886_I2CWriteBytes(MPU6886_FIFO_EN, 1, &regdata);
+    MPU6886_I2CWriteBytes(MPU6886_USER_CTRL, 1, &regdata);
+
+    // Back to the single shot configuration of MPU6886_Init
+    regdata = MPU6886_CONFIG_DLPF_176HZ;
+    MPU6886_I2CWriteBytes(MPU6886_CONFIG, 1, &regdata);
+    regdata = 0x05;
+    MPU6886_I2CWriteBytes(MPU6886_SMPLRT_DIV, 1, &regdata);
+    regdata = 0x01;
+    MPU6886_I2CWriteBytes(MPU6886_INT_ENABLE, 1, &regdata);
+    stream_running = false;
+}
+
+int MPU6886_WaitStream(TickType_t timeout) {
+    if (!stream_running) {
+        return -1;
+    }
+
+#if CONFIG_MPU6886_INT_GPIO >= 0
+    return (xSemaphoreTake(stream_ready, timeout) == pdTRUE) ? 0 : -1;
+#else
+    // Without the interrupt line a batch is due every watermark samples
+    TickType_t batch_ticks = pdMS_TO_TICKS(stream_watermark * stream_period_us / 1000);
+    vTaskDelayUntil(&stream_wake_ticks, (batch_ticks > 0) ? batch_ticks : 1);
+    return 0;
+#endif
+}
+
+static void MPU6886_StreamFifoDone(i2c_transaction_t *transaction, esp_err_t err) {
+    i2c_completion_signal(&stream_done, err);
+}
+
+/* On the bus worker, the drain of the counted frames follows in the same window */
+static void MPU6886_StreamCountDone(i2c_transaction_t *transaction, esp_err_t err) {
+    stream_frames = 0;
+    if (err != ESP_OK) {
+        i2c_completion_signal(&stream_done, err);
+        return;
+    }
+    stream_read_time = esp_timer_get_time();
+
+    uint32_t count = (((uint32_t)stream_count[0] & 0x1f) << 8) | stream_count[1];
+    if (count > MPU6886_FIFO_SIZE - MPU6886_FIFO_FRAME_LENGTH) {
+        unsigned char regdata = MPU6886_USER_CTRL_FIFO_EN | MPU6886_USER_CTRL_FIFO_RST;
+        MPU6886_I2CWriteBytes(MPU6886_USER_CTRL, 1, &regdata);
+        stream_overflows++;
+        i2c_completion_signal(&stream_done, ESP_OK);
+        return;
+    }
+
+    uint32_t frame_count = count / MPU6886_FIFO_FRAME_LENGTH;
+    frame_count = (frame_count > stream_max_frames) ? stream_max_frames : frame_count;
+    if (frame_count == 0) {
+        i2c_completion_signal(&stream_done, ESP_OK);
+        return;
+    }
+
+    // The whole batch in one transaction, every read of FIFO_R_W pops the next byte
+    stream_frames = frame_count;
+    i2c_transaction_init(&stream_fifo_transaction, mpu6886_device, I2C_TRANSACTION_READ_REPEATED, MPU6886_FIFO_R_W,
+                         stream_buffer, frame_count * MPU6886_FIFO_FRAME_LENGTH, 1);
+    err = i2c_submit(&stream_fifo_transaction, MPU6886_StreamFifoDone, NULL);
+    if (err != ESP_OK) {
+        i2c_completion_signal(&stream_done, err);
+    }
+}
+
+int MPU6886_ReadStream(mpu6886_frame_t *frames, uint32_t max_frames) {
+    if (!stream_running) {
+        return -1;
+    }
+
+    // The task wakes once per batch, the count read and the drain run back to back on the bus worker
+    stream_max_frames = max_frames;
+    i2c_transaction_init(&stream_count_transaction, mpu6886_device, I2C_TRANSACTION_READ, MPU6886_FIFO_COUNTH, stream_count, 2, 1);
+    if (i2c_submit(&stream_count_transaction, MPU6886_StreamCountDone, NULL) != ESP_OK || i2c_completion_wait(&stream_done) != ESP_OK) {
+        return -1;
+    }
+
+    uint32_t frame_count = stream_frames;
+    for (uint32_t i = 0; i < frame_count; i++) {
+        const uint8_t * entry = &stream_buffer[i * MPU6886_FIFO_FRAME_LENGTH];
+        mpu6886_frame_t * frame = &frames[i];
+        frame->timestamp = stream_read_time - (int64_t)(frame_count - 1 - i) * stream_period_us;
+        for (int axis = 0; axis < 3; axis++) {
+            frame->accel[axis] = (int16_t)(((uint16_t)entry[axis * 2] << 8) | entry[axis * 2 + 1]);
+            frame->gyro[axis] = (int16_t)(((uint16_t)entry[8 + axis * 2] << 8) | entry[8 + axis * 2 + 1]);
+        }
+        frame->temperature = (int16_t)(((uint16_t)entry[6] << 8) | entry[7]);
+    }
+
+    return frame_count;
+}
+
+uint32_t MPU6886_GetStreamPeriod(void) {
+    return stream_period_us;
+}
+
+uint32_t MPU6886_GetStreamOverflows(void) {
+    return stream_overflows;
+}
+
+void MPU6886_GetFrameData(const mpu6886_frame_t *frame, float accel[3], float gyro[3]) {
+    for (int axis = 0; axis < 3; axis++) {
+        accel[axis] = (float)frame->accel[axis] * acc_res;
+        gyro[axis] = (float)frame->gyro[axis] * gyro_res;
+    }
+}
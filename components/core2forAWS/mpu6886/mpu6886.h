@@ -6,6 +6,7 @@
 #pragma once
 
 #include "stdint.h"
+#include "freertos/FreeRTOS.h"
 
 #define MPU6886_ADDRESS           0x68 
 #define MPU6886_WHOAMI            0x75
@@ -38,6 +39,20 @@
 #define MPU6886_ACCEL_CONFIG      0x1C
 #define MPU6886_ACCEL_CONFIG2     0x1D
 #define MPU6886_FIFO_EN           0x23
+#define MPU6886_FIFO_WM_INT_STATUS 0x39
+#define MPU6886_INT_STATUS        0x3A
+#define MPU6886_FIFO_WM_TH1       0x60
+#define MPU6886_FIFO_WM_TH2       0x61
+#define MPU6886_FIFO_COUNTH       0x72
+#define MPU6886_FIFO_COUNTL       0x73
+#define MPU6886_FIFO_R_W          0x74
+
+/* A FIFO frame is always accel, temperature and gyro, big endian, as in the output registers */
+#define MPU6886_FIFO_SIZE         1024
+#define MPU6886_FIFO_FRAME_LENGTH 14
+#define MPU6886_FIFO_FRAMES_MAX   (MPU6886_FIFO_SIZE / MPU6886_FIFO_FRAME_LENGTH)
+/* Internal sample rate with the DLPF on, the output data rate is this divided by SMPLRT_DIV + 1 */
+#define MPU6886_SAMPLE_RATE_HZ    1000
 
 /**
  * @brief List of possible accelerometer scalars in Gs.
@@ -63,6 +78,18 @@ typedef enum {
 } gyro_scale_t;
 /* @[declare_mpu6886_gyro_scale_t] */
 
+/**
+ * @brief One sample of the FIFO stream in ADC counts.
+ */
+/* @[declare_mpu6886_frame_t] */
+typedef struct {
+    int64_t timestamp;          /* us, esp_timer time the sample was taken */
+    int16_t accel[3];
+    int16_t temperature;
+    int16_t gyro[3];
+} mpu6886_frame_t;
+/* @[declare_mpu6886_frame_t] */
+
 /**
  * @brief Initializes the MPU6886 over I2C.
  * 
@@ -210,3 +237,81 @@ void MPU6886_GetGyroData(float *roll, float *yaw, float *pitch);
 /* @[declare_mpu6886_gettempdata] */
 void MPU6886_GetTempData(float *t);
 /* @[declare_mpu6886_gettempdata] */
+
+/**
+ * @brief Streams accelerometer and gyroscope samples through the
+ * FIFO of the MPU6886.
+ *
+ * The output data rate is 1 kHz divided by a whole number, odr_hz
+ * is rounded to the nearest one. A batch of watermark frames is
+ * read in one bus transaction. With CONFIG_MPU6886_INT_GPIO the
+ * FIFO watermark interrupt wakes MPU6886_WaitStream(), otherwise
+ * it sleeps for the duration of one batch.
+ *
+ * @param[in] odr_hz Samples per second, 4 to 1000.
+ * @param[in] watermark Frames per batch, at most half the FIFO.
+ *
+ * @return 0 if successful, -1 otherwise.
+ */
+/* @[declare_mpu6886_startstream] */
+int MPU6886_StartStream(uint32_t odr_hz, uint32_t watermark);
+/* @[declare_mpu6886_startstream] */
+
+/**
+ * @brief Stops the FIFO stream, the single shot reads work again.
+ */
+/* @[declare_mpu6886_stopstream] */
+void MPU6886_StopStream(void);
+/* @[declare_mpu6886_stopstream] */
+
+/**
+ * @brief Blocks until the next batch is due.
+ *
+ * @param[in] timeout Ticks to wait for the watermark interrupt.
+ *
+ * @return 0 when a batch is due, -1 on timeout.
+ */
+/* @[declare_mpu6886_waitstream] */
+int MPU6886_WaitStream(TickType_t timeout);
+/* @[declare_mpu6886_waitstream] */
+
+/**
+ * @brief Reads the frames waiting in the FIFO, oldest first.
+ *
+ * The newest frame is dated when the FIFO count is read, the
+ * others one sample period apart before it. A full FIFO is
+ * reset and counted as an overflow, its frames are lost.
+ *
+ * @param[out] frames Frames read.
+ * @param[in] max_frames Size of frames.
+ *
+ * @return The number of frames read, -1 on a bus error.
+ */
+/* @[declare_mpu6886_readstream] */
+int MPU6886_ReadStream(mpu6886_frame_t *frames, uint32_t max_frames);
+/* @[declare_mpu6886_readstream] */
+
+/**
+ * @brief Sample period of the running stream in microseconds.
+ */
+/* @[declare_mpu6886_getstreamperiod] */
+uint32_t MPU6886_GetStreamPeriod(void);
+/* @[declare_mpu6886_getstreamperiod] */
+
+/**
+ * @brief FIFO overflows since the stream started.
+ */
+/* @[declare_mpu6886_getstreamoverflows] */
+uint32_t MPU6886_GetStreamOverflows(void);
+/* @[declare_mpu6886_getstreamoverflows] */
+
+/**
+ * @brief Converts a stream frame with the current full scale ranges.
+ *
+ * @param[in] frame Frame from MPU6886_ReadStream().
+ * @param[out] accel Acceleration in G.
+ * @param[out] gyro Rotation in degrees per second.
+ */
+/* @[declare_mpu6886_framedata] */
+void MPU6886_GetFrameData(const mpu6886_frame_t *frame, float accel[3], float gyro[3]);
+/* @[declare_mpu6886_framedata] */
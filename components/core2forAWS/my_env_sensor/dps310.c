@@ -24,6 +24,11 @@
 #define log_reg(buffer, buffer_len)
 #endif
 
+static void dps310_update_scale_reciprocals(dps310_device_t * device) {
+    device->coes_fixed.psf_reciprocal = llround(ldexp(1.0, 54) / device->sf.psf);
+    device->coes_fixed.tsf_reciprocal = llround(ldexp(1.0, 54) / device->sf.tsf);
+}
+
 dps310_device_t * dps310_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl, uint32_t freq, uint8_t device_addr) {
     dps310_device_t * device = (dps310_device_t *)malloc(sizeof(dps310_device_t));
     if (device == NULL) {
@@ -38,17 +43,18 @@ dps310_device_t * dps310_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_nu
 
         uint8_t meas_cfg = 0;
         esp_err_t return_value;
+        uint32_t polls = 0;
         while ((return_value = i2c_read_byte(device->i2c_interface, DPS310_REG_MEAS_CFG, &meas_cfg)) != ESP_OK ||
             MEAS_CFG_SENSOR_RDY != (meas_cfg & MEAS_CFG_SENSOR_RDY) ||
             MEAS_CFG_COEF_RDY != (meas_cfg & MEAS_CFG_COEF_RDY)) {
-            if (return_value != ESP_OK) {
+            if (return_value != ESP_OK || ++polls > DPS310_READY_TIMEOUT_MS / DPS310_READY_POLL_MS) {
                 log_i("Read chip status failed");
                 i2c_free_device(device->i2c_interface);
                 free(device);
                 return NULL;
             } else {
                 log_i("Waiting for chip status ready");
-                vTaskDelay(pdMS_TO_TICKS(10));
+                vTaskDelay(pdMS_TO_TICKS(DPS310_READY_POLL_MS));
             }
         };
 
@@ -69,6 +75,7 @@ dps310_device_t * dps310_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_nu
         }
 
         device->sf.psf = SCALE_FACTOR_PRC_64;
+        device->pressure_rate = 8;
         return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_PRS_CFG, PRS_CFG_PM_RATE_8 | PRS_CFG_PM_PRC_64);
         if (return_value != ESP_OK) {
             log_e("dps310_init_device->i2c_write_byte faild");
@@ -88,6 +95,11 @@ dps310_device_t * dps310_init_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_nu
         temperature_source &= TMP_CFG_TMP_EXT_MASK;
 
         device->sf.tsf = SCALE_FACTOR_PRC_32;
+        dps310_update_scale_reciprocals(device);
+        device->temperature_rate = 1;
+        device->fifo_burst = 1;
+        device->raw_temperature = 0;
+        i2c_completion_init(&device->fifo_done);
         return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_TMP_CFG, temperature_source | TMP_CFG_TMP_RATE_1 | TMP_CFG_TMP_PRC_32);
         if (return_value != ESP_OK) {
             log_e("dps310_init_device->i2c_write_byte DPS310_REG_TMP_CFG faild");
@@ -186,38 +198,47 @@ esp_err_t dps310_get_compensation_coefficients(dps310_device_t * device) {
     coef_c0 = (coef[0] << 4) + ((coef[1] >> 4) & 0x0f);
     if (coef_c0 & 0x000000800) coef_c0 -= 0x00001000;
     device->coes.c0 = (double)coef_c0;
+    device->coes_fixed.c0 = coef_c0;
 
     coef_c1 = ((coef[1] & 0x0f) << 8) + coef[2];
     if (coef_c1 > 0x000000800) coef_c1 -= 0x00001000;
     device->coes.c1 = (double)coef_c1;
+    device->coes_fixed.c1 = coef_c1;
 
     coef_c00 = (coef[3] << 12) + (coef[4] << 4) + ((coef[5] >> 4) & 0x0f);
     if (coef_c00 & 0x00080000) coef_c00 -= 0x00100000;
     device->coes.c00 = (double)coef_c00;
+    device->coes_fixed.c00 = coef_c00;
 
     coef_c10 = ((coef[5] & 0x0f) << 16) + (coef[6] << 8) + coef[7];
     if (coef_c10 & 0x00080000) coef_c10 -= 0x00100000;
     device->coes.c10 = (double)coef_c10;
+    device->coes_fixed.c10 = coef_c10;
 
     coef_c01 = (coef[8] << 8) + coef[9];
     if (coef_c01 & 0x00008000) coef_c01 -= 0x00010000;
     device->coes.c01 = (double)coef_c01;
+    device->coes_fixed.c01 = coef_c01;
 
     coef_c11 = (coef[10] << 8) + coef[11];
     if (coef_c11 & 0x00008000) coef_c11 -= 0x00010000;
     device->coes.c11 = (double)coef_c11;
+    device->coes_fixed.c11 = coef_c11;
 
     coef_c20 = (coef[12] << 8) + coef[13];
     if (coef_c20 & 0x00008000) coef_c20 -= 0x00010000;
     device->coes.c20 = (double)coef_c20;
+    device->coes_fixed.c20 = coef_c20;
 
     coef_c21 = (coef[14] << 8) + coef[15];
     if (coef_c21 & 0x00008000) coef_c21 -= 0x00010000;
     device->coes.c21 = (double)coef_c21;
+    device->coes_fixed.c21 = coef_c21;
 
     coef_c30 = (coef[16] << 8) + coef[17];
     if (coef_c30 & 0x00008000) coef_c30 -= 0x00010000;
     device->coes.c30 = (double)coef_c30;
+    device->coes_fixed.c30 = coef_c30;
 
     ESP_LOG_BUFFER_HEX("DPS310", coef, 18);
     ESP_LOGE("DPS310", "c0: 0x%8.8X, c1: 0x%8.8X, c00: 0x%8.8X, c10: 0x%8.8X, c01: 0x%8.8X, c11: 0x%8.8X, c20: 0x%8.8X, c21: 0x%8.8X, c30: 0x%8.8X", coef_c0, coef_c1, coef_c00, coef_c10, coef_c01, coef_c11, coef_c20, coef_c21, coef_c30);
@@ -226,35 +247,207 @@ esp_err_t dps310_get_compensation_coefficients(dps310_device_t * device) {
     return ESP_OK;
 }
 
+static int32_t dps310_raw_value(const uint8_t * reg) {
+    int32_t raw_value = (reg[0] << 16) + (reg[1] << 8) + reg[2];
+    if (raw_value > 0x007fffff) raw_value -= 0x01000000;
+
+    return raw_value;
+}
+
+void dps310_compensate(dps310_device_t * device, int32_t raw_temperature, int32_t raw_pressure, double * temperature, double * pressure) {
+    double scaled_temperature = (double)raw_temperature / device->sf.tsf;
+    double scaled_pressure = (double)raw_pressure / device->sf.psf;
+
+    log_i("scaled_temperature: %f, scaled_pressure: %f", scaled_temperature, scaled_pressure);
+
+    *temperature = 0.5 * device->coes.c0 + scaled_temperature * device->coes.c1;
+    *pressure = device->coes.c00 + scaled_pressure * (device->coes.c10 + scaled_pressure *(device->coes.c20 + scaled_pressure * device->coes.c30)) +
+        scaled_temperature * device->coes.c01 + scaled_temperature * scaled_pressure * (device->coes.c11 + scaled_pressure * device->coes.c21);
+}
+
+/*
+    Same polynomial as dps310_compensate on int64, the ESP32 has no double precision FPU.
+    p = c00 + psc * (c10 + psc * (c20 + psc * c30)) + tsc * (c01 + psc * (c11 + psc * c21))
+*/
+void dps310_compensate_fixed(dps310_device_t * device, int32_t raw_temperature, int32_t raw_pressure, int32_t * temperature, int32_t * pressure) {
+    const dps310_compensation_coefficients_fixed_t * coes = &(device->coes_fixed);
+
+    int64_t scaled_temperature = ((int64_t)raw_temperature * coes->tsf_reciprocal) >> 24;     /* Q30 */
+    int64_t scaled_pressure = ((int64_t)raw_pressure * coes->psf_reciprocal) >> 24;           /* Q30 */
+    int64_t scaled_temperature_q22 = scaled_temperature >> 8;
+    int64_t scaled_pressure_q22 = scaled_pressure >> 8;
+
+    int64_t a = ((int64_t)coes->c20 << 16) + ((coes->c30 * scaled_pressure) >> 14);           /* Q16 */
+    int64_t b = ((int64_t)coes->c10 << 8) + ((a * scaled_pressure_q22) >> 30);                /* Q8 */
+    int64_t d = ((int64_t)coes->c11 << 16) + ((coes->c21 * scaled_pressure) >> 14);           /* Q16 */
+    int64_t e = ((int64_t)coes->c01 << 16) + ((d * scaled_pressure_q22) >> 22);               /* Q16 */
+
+    *temperature = DPS310_FIXED_TEMPERATURE_SCALE / 2 * coes->c0 +
+        ((DPS310_FIXED_TEMPERATURE_SCALE * coes->c1 * scaled_temperature + ((int64_t)1 << 29)) >> 30);
+    *pressure = ((int64_t)coes->c00 << DPS310_FIXED_PRESSURE_SHIFT) + ((b * scaled_pressure) >> 30) + ((e * scaled_temperature_q22) >> 30);
+}
+
 esp_err_t dps310_fetch_result(dps310_device_t * device, double * temperature, double * pressure) {
     uint8_t result_reg[6];
     esp_err_t return_value = i2c_read_bytes(device->i2c_interface, DPS310_REG_PSR_B2, result_reg, 6);
 
-    ESP_LOG_BUFFER_HEX("DPS310", result_reg, 6);
+    log_reg(result_reg, 6);
 
     if (return_value == ESP_OK)
     {
-        int32_t raw_temperature = (result_reg[3] << 16) + (result_reg[4] << 8) + result_reg[5];
-        if (raw_temperature > 0x007fffff) raw_temperature -= 0x01000000;
-        int32_t raw_pressure = (result_reg[0] << 16) + (result_reg[1] << 8) + result_reg[2];
-        if (raw_pressure > 0x007fffff) raw_pressure -= 0x01000000;
+        int32_t raw_pressure = dps310_raw_value(&result_reg[0]);
+        int32_t raw_temperature = dps310_raw_value(&result_reg[3]);
+
+        log_i("raw_temperature: 0x%8.8X, raw_pressure: 0x%8.8X", raw_temperature, raw_pressure);
+
+        dps310_compensate(device, raw_temperature, raw_pressure, temperature, pressure);
+
+        log_i("temperature: %f, pressure: %f", *temperature, *pressure);
+    } else {
+        log_e("dps310_fetch_result->i2c_read_bytes faild");
+    }
+
+    return return_value;
+}
+
+esp_err_t dps310_start_fifo_measure(dps310_device_t * device, uint32_t read_period_ms) {
+    esp_err_t return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_MEAS_CFG, MEAS_CFG_MEAS_CTRL_STOP);
+    if (return_value != ESP_OK) {
+        log_e("dps310_start_fifo_measure->i2c_write_byte DPS310_REG_MEAS_CFG faild");
+        return return_value;
+    }
+
+    /* Pressure entries are compensated with the latest temperature entry, prime it by one command mode measurement */
+    return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_MEAS_CFG, MEAS_CFG_MEAS_CTRL_TMP);
+    if (return_value != ESP_OK) {
+        log_e("dps310_start_fifo_measure->i2c_write_byte DPS310_REG_MEAS_CFG faild");
+        return return_value;
+    }
+
+    uint8_t meas_cfg = 0;
+    for (int i = 0; i < 20; i++) {
+        vTaskDelay(pdMS_TO_TICKS(10));
+        return_value = i2c_read_byte(device->i2c_interface, DPS310_REG_MEAS_CFG, &meas_cfg);
+        if (return_value != ESP_OK || (meas_cfg & MEAS_CFG_TMP_RDY) == MEAS_CFG_TMP_RDY) {
+            break;
+        }
+    }
+
+    if (return_value == ESP_OK && (meas_cfg & MEAS_CFG_TMP_RDY) == MEAS_CFG_TMP_RDY) {
+        uint8_t temperature_reg[3];
+        return_value = i2c_read_bytes(device->i2c_interface, DPS310_REG_TMP_B2, temperature_reg, 3);
+        if (return_value == ESP_OK) {
+            device->raw_temperature = dps310_raw_value(temperature_reg);
+        }
+    } else {
+        log_e("dps310_start_fifo_measure, prime temperature measurement timeout");
+    }
+
+    return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_CFG_REG, CFG_REG_P_SHIFT | CFG_REG_T_SHIFT | CFG_REG_FIFO_EN);
+    if (return_value != ESP_OK) {
+        log_e("dps310_start_fifo_measure->i2c_write_byte DPS310_REG_CFG_REG faild");
+        return return_value;
+    }
+
+    return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_RESET, RESET_FIFO_FLUSH_CM);
+    if (return_value != ESP_OK) {
+        log_e("dps310_start_fifo_measure->i2c_write_byte DPS310_REG_RESET faild");
+        return return_value;
+    }
+
+    /* Expected entries per read period plus a margin, so the FIFO is normally drained by one transaction */
+    uint32_t burst = (device->pressure_rate + device->temperature_rate) * read_period_ms / 1000 + 2;
+    device->fifo_burst = (burst > DPS310_FIFO_DEPTH) ? DPS310_FIFO_DEPTH : burst;
+
+    return_value = i2c_write_byte(device->i2c_interface, DPS310_REG_MEAS_CFG, MEAS_CFG_MEAS_CTRL_PRS | MEAS_CFG_MEAS_CTRL_TMP | MEAS_CFG_MEAS_CTRL_BACKGROUND);
+    if (return_value != ESP_OK) {
+        log_e("dps310_start_fifo_measure->i2c_write_byte DPS310_REG_MEAS_CFG faild");
+    }
+
+    return return_value;
+}
 
-        ESP_LOGE("DPS310", "raw_temperature: 0x%8.8X, raw_pressure: 0x%8.8X", raw_temperature, raw_pressure);
+static void dps310_drain_next(dps310_device_t * device);
 
-        double scaled_temperature = (double)raw_temperature / device->sf.tsf;
-        double scaled_pressure = (double)raw_pressure / device->sf.psf;
+/* On the bus worker, the next burst is queued at once until the FIFO reads empty */
+static void dps310_drain_burst_done(i2c_transaction_t * transaction, esp_err_t err) {
+    dps310_device_t * device = (dps310_device_t *)transaction->arg;
+    if (err != ESP_OK) {
+        i2c_completion_signal(&device->fifo_done, err);
+        return;
+    }
+
+    for (uint32_t i = 0; i < transaction->count; i++) {
+        uint8_t * entry = &device->fifo[i * DPS310_FIFO_ENTRY_LENGTH];
+        uint32_t value = (entry[0] << 16) | (entry[1] << 8) | entry[2];
+
+        if (value == DPS310_FIFO_EMPTY) {
+            i2c_completion_signal(&device->fifo_done, ESP_OK);
+            return;
+        }
+
+        if (value & DPS310_FIFO_PRESSURE_FLAG) {
+            device->fifo_results[device->fifo_count].temperature = device->raw_temperature;
+            device->fifo_results[device->fifo_count].pressure = dps310_raw_value(entry);
+            device->fifo_count++;
+        } else {
+            device->raw_temperature = dps310_raw_value(entry);
+        }
+    }
 
-        ESP_LOGE("DPS310", "scaled_temperature: %f, scaled_pressure: %f", scaled_temperature, scaled_pressure);
-        
-        double compensated_temperature = 0.5 * device->coes.c0 + scaled_temperature * device->coes.c1;
-        double compensated_pressure = device->coes.c00 + scaled_pressure * (device->coes.c10 + scaled_pressure *(device->coes.c20 + scaled_pressure * device->coes.c30)) +
-            scaled_temperature * device->coes.c01 + scaled_temperature * scaled_pressure * (device->coes.c11 + scaled_pressure * device->coes.c21);
+    dps310_drain_next(device);
+}
 
-        *temperature = compensated_temperature;
-        *pressure = compensated_pressure;
+static void dps310_drain_next(dps310_device_t * device) {
+    /* Each popped entry may be a pressure result, never pop more than the caller can store */
+    uint32_t burst = device->fifo_burst;
+    if (burst > device->fifo_max - device->fifo_count) {
+        burst = device->fifo_max - device->fifo_count;
+    }
+    if (burst == 0) {
+        i2c_completion_signal(&device->fifo_done, ESP_OK);
+        return;
     }
 
-    ESP_LOGE("DPS310", "temperature: %f, pressure: %f", *temperature, *pressure);
+    i2c_transaction_init(&device->fifo_transaction, device->i2c_interface, I2C_TRANSACTION_READ_REPEATED, DPS310_REG_PSR_B2,
+                         device->fifo, DPS310_FIFO_ENTRY_LENGTH, burst);
+    esp_err_t return_value = i2c_submit(&device->fifo_transaction, dps310_drain_burst_done, device);
+    if (return_value != ESP_OK) {
+        i2c_completion_signal(&device->fifo_done, return_value);
+    }
+}
+
+/* The task waits once for the whole drain, results land in device->fifo_results */
+static esp_err_t dps310_drain_fifo(dps310_device_t * device, uint32_t max_count, uint32_t * count) {
+    device->fifo_max = max_count;
+    device->fifo_count = 0;
+    dps310_drain_next(device);
+
+    esp_err_t return_value = i2c_completion_wait(&device->fifo_done);
+    if (return_value != ESP_OK) {
+        log_e("dps310_drain_fifo->i2c_submit faild");
+    }
+
+    *count = device->fifo_count;
+    return return_value;
+}
+
+esp_err_t dps310_fetch_fifo(dps310_device_t * device, dps310_result_t * results, uint32_t max_count, uint32_t * count) {
+    esp_err_t return_value = dps310_drain_fifo(device, (max_count < DPS310_FIFO_DEPTH) ? max_count : DPS310_FIFO_DEPTH, count);
+
+    for (uint32_t i = 0; i < *count; i++) {
+        dps310_compensate(device, device->fifo_results[i].temperature, device->fifo_results[i].pressure, &(results[i].temperature), &(results[i].pressure));
+    }
+
+    return return_value;
+}
+
+esp_err_t dps310_fetch_fifo_fixed(dps310_device_t * device, dps310_fixed_result_t * results, uint32_t max_count, uint32_t * count) {
+    esp_err_t return_value = dps310_drain_fifo(device, (max_count < DPS310_FIFO_DEPTH) ? max_count : DPS310_FIFO_DEPTH, count);
+
+    for (uint32_t i = 0; i < *count; i++) {
+        dps310_compensate_fixed(device, device->fifo_results[i].temperature, device->fifo_results[i].pressure, &(results[i].temperature), &(results[i].pressure));
+    }
 
     return return_value;
 }
@@ -130,6 +130,16 @@
 #define RESET_FIFO_FLUSH_CM               0x80
 #define RESET_RESET_CMD                   0x05
 
+// FIFO entries, read from PSR_B2..PSR_B0, LSB set for pressure and clear for temperature
+#define DPS310_FIFO_DEPTH                 32
+#define DPS310_FIFO_ENTRY_LENGTH          3
+#define DPS310_FIFO_EMPTY                 0x800000
+#define DPS310_FIFO_PRESSURE_FLAG         0x000001
+
+// Sensor and coefficients are ready about 40ms after power on, the init gives up after the timeout
+#define DPS310_READY_POLL_MS              10
+#define DPS310_READY_TIMEOUT_MS           200
+
 // Temperature Coeicients Source
 #define TMP_COEF_SRCE_ASIA                0x00
 #define TMP_COEF_SRCE_MEMS                0x80
@@ -160,17 +170,67 @@ typedef struct {
     double c30;
 } dps310_compensation_coefficients_t;
 
+/*
+    Integer coefficients for the int64 evaluation, the scale factors are applied as Q54 reciprocals.
+    Scaled pressure and temperature stay below 2 in magnitude over the sensor range.
+*/
+typedef struct {
+    int32_t c0;
+    int32_t c1;
+    int32_t c00;
+    int32_t c10;
+    int32_t c01;
+    int32_t c11;
+    int32_t c20;
+    int32_t c21;
+    int32_t c30;
+    int64_t psf_reciprocal;
+    int64_t tsf_reciprocal;
+} dps310_compensation_coefficients_fixed_t;
+
 typedef struct {
     double psf;
     double tsf;
 } dps310_scale_factors_t;
 
+/* Raw FIFO result, the pressure entry paired with the latest temperature entry popped before it */
+typedef struct {
+    int32_t temperature;
+    int32_t pressure;
+} dps310_raw_result_t;
+
 typedef struct {
     I2CDevice_t i2c_interface;
     dps310_compensation_coefficients_t coes;
+    dps310_compensation_coefficients_fixed_t coes_fixed;
     dps310_scale_factors_t sf;
+    uint32_t pressure_rate;
+    uint32_t temperature_rate;
+    uint32_t fifo_burst;
+    int32_t raw_temperature;
+    /* FIFO drain in flight, its bursts chain on the bus worker */
+    i2c_transaction_t fifo_transaction;
+    i2c_completion_t fifo_done;
+    uint8_t fifo[DPS310_FIFO_DEPTH * DPS310_FIFO_ENTRY_LENGTH];
+    dps310_raw_result_t fifo_results[DPS310_FIFO_DEPTH];
+    uint32_t fifo_max;
+    uint32_t fifo_count;
 } dps310_device_t;
 
+typedef struct {
+    double temperature;
+    double pressure;
+} dps310_result_t;
+
+/* Fixed point results: temperature in 0.01 degree C, pressure in 1/256 Pa */
+#define DPS310_FIXED_TEMPERATURE_SCALE    100
+#define DPS310_FIXED_PRESSURE_SHIFT       8
+
+typedef struct {
+    int32_t temperature;
+    int32_t pressure;
+} dps310_fixed_result_t;
+
 /*****************************************************************************
  * Barometer Init.
  * Don't use FIFO, must work in background mode
@@ -188,6 +248,27 @@ esp_err_t dps310_get_status(dps310_device_t * device, uint8_t * status);
  *****************************************************************************/
 esp_err_t dps310_fetch_result(dps310_device_t * device, double * temperature, double * pressure);
 
+/**************************************************************************//**
+ * Switch background measurement to FIFO mode.
+ * The FIFO is drained every read_period_ms, the burst length of one bus
+ * transaction is sized from the configured pressure and temperature rates.
+ *****************************************************************************/
+esp_err_t dps310_start_fifo_measure(dps310_device_t * device, uint32_t read_period_ms);
+
+/**************************************************************************//**
+ * Drain all queued FIFO entries, return compensated pressure results in
+ * measurement order. max_count should be at least DPS310_FIFO_DEPTH,
+ * entries which do not fit stay queued for the next call.
+ *****************************************************************************/
+esp_err_t dps310_fetch_fifo(dps310_device_t * device, dps310_result_t * results, uint32_t max_count, uint32_t * count);
+esp_err_t dps310_fetch_fifo_fixed(dps310_device_t * device, dps310_fixed_result_t * results, uint32_t max_count, uint32_t * count);
+
+/**************************************************************************//**
+ * Compensate raw values, in double or in int64 with fixed point results.
+ *****************************************************************************/
+void dps310_compensate(dps310_device_t * device, int32_t raw_temperature, int32_t raw_pressure, double * temperature, double * pressure);
+void dps310_compensate_fixed(dps310_device_t * device, int32_t raw_temperature, int32_t raw_pressure, int32_t * temperature, int32_t * pressure);
+
 /**************************************************************************//**
  * Calculate altitude by pressure and temperature
  *****************************************************************************/
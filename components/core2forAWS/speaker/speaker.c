@@ -2,7 +2,7 @@
 #include "esp_idf_version.h"
 #include "speaker.h"
 
-speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_num, int data_out_num, int data_in_num, int sample_rate, i2s_bits_per_sample_t bit_per_sample) {
+speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_num, int data_out_num, int data_in_num, int sample_rate, i2s_bits_per_sample_t bit_per_sample, int dma_buf_count, int dma_buf_len) {
     speaker_device_t * speaker = malloc(sizeof(speaker_device_t));
     if (speaker == NULL) {
         return NULL;
@@ -12,8 +12,13 @@ speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_n
         speaker->ws_io_num = ws_io_num;
         speaker->data_out_num = data_out_num;
         speaker->data_in_num = data_in_num;
-        speaker->sample_rate = data_in_num;
+        speaker->sample_rate = sample_rate;
         speaker->bit_per_sample = bit_per_sample;
+        speaker->events = NULL;
+        speaker->buffer_bytes = dma_buf_len * (bit_per_sample / 8);
+        speaker->queued_bytes = 0;
+        speaker->streaming = false;
+        speaker->underruns = 0;
     }
 
     i2s_config_t i2s_config = {
@@ -27,14 +32,15 @@ speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_n
         .communication_format = I2S_COMM_FORMAT_I2S,
 #endif
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL1,
-        .dma_buf_count = 8,
-        .dma_buf_len = 1024,
+        .dma_buf_count = dma_buf_count,
+        .dma_buf_len = dma_buf_len,
     };
 
     i2s_config.mode = (i2s_mode_t)(I2S_MODE_MASTER | I2S_MODE_TX);
     i2s_config.use_apll = false;
     i2s_config.tx_desc_auto_clear = true;
-    esp_err_t err = i2s_driver_install(i2s_port, &i2s_config, 0, NULL);
+    // One TX_DONE event per DMA buffer sent, twice the buffers so a writer blocked on a full DMA misses none
+    esp_err_t err = i2s_driver_install(i2s_port, &i2s_config, dma_buf_count * 2, &speaker->events);
 
     if(err != ESP_OK){
         free(speaker);
@@ -69,9 +75,48 @@ speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_n
     return speaker;
 }
 
+static void Speaker_CountSent(speaker_device_t * speaker) {
+    i2s_event_t event;
+    while (speaker->events != NULL && xQueueReceive(speaker->events, &event, 0) == pdTRUE) {
+        if (event.type != I2S_EVENT_TX_DONE) {
+            continue;
+        }
+        speaker->queued_bytes -= speaker->buffer_bytes;
+        if (speaker->queued_bytes < 0) {
+            // The DMA sent a cleared buffer, the writer was late
+            speaker->underruns += speaker->streaming;
+            speaker->queued_bytes = 0;
+        }
+    }
+}
+
 esp_err_t Speaker_WriteBuff(speaker_device_t * speaker, uint8_t* buff, uint32_t len, uint32_t timeout) {
     size_t bytes_written = 0;
-    return i2s_write(speaker->i2s_port, buff, len, &bytes_written, portMAX_DELAY);
+    Speaker_CountSent(speaker);
+    if (!speaker->streaming) {
+        // A new stream starts behind the cleared buffer already on the wire
+        speaker->queued_bytes = speaker->buffer_bytes;
+        speaker->streaming = true;
+    }
+    esp_err_t err = i2s_write(speaker->i2s_port, buff, len, &bytes_written, portMAX_DELAY);
+    speaker->queued_bytes += bytes_written;
+    return err;
+}
+
+void Speaker_EndStream(speaker_device_t * speaker) {
+    if (speaker == NULL) {
+        return;
+    }
+    Speaker_CountSent(speaker);
+    speaker->streaming = false;
+}
+
+uint32_t Speaker_GetUnderruns(speaker_device_t * speaker) {
+    if (speaker == NULL) {
+        return 0;
+    }
+    Speaker_CountSent(speaker);
+    return speaker->underruns;
 }
 
 esp_err_t Speaker_Deinit(speaker_device_t * speaker) {
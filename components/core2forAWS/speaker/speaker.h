@@ -16,6 +16,12 @@ typedef struct {
     int data_in_num;
     int sample_rate;
     i2s_bits_per_sample_t bit_per_sample;
+    QueueHandle_t events;
+    int32_t buffer_bytes;
+    /* Bytes written and not yet sent by the DMA, counted down by the TX_DONE events */
+    int32_t queued_bytes;
+    bool streaming;
+    uint32_t underruns;
 } speaker_device_t;
 
 /**
@@ -30,11 +36,16 @@ typedef struct {
  * Attempting to enable or use both at the same time will 
  * cause the device to hard fault.
  * 
+ * @param[in] dma_buf_count Number of I2S DMA buffers, their total length is
+ * how long a streaming writer may be kept from writing before an underrun.
+ * @param[in] dma_buf_len Length of each DMA buffer in samples, bounds the
+ * playback latency of a streaming writer.
+ *
  * @return [esp_err_t](https://docs.espressif.com/projects/esp-idf/en/release-v4.2/esp32/api-reference/system/esp_err.html#macros). 0 or `ESP_OK` if successful.
  * 
  */
 /* @[declare_speaker_init] */
-speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_num, int data_out_num, int data_in_num, int sample_rate, i2s_bits_per_sample_t bit_per_sample);
+speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_num, int data_out_num, int data_in_num, int sample_rate, i2s_bits_per_sample_t bit_per_sample, int dma_buf_count, int dma_buf_len);
 /* @[declare_speaker_init] */
 
 /**
@@ -63,12 +74,32 @@ speaker_device_t * Speaker_Init(i2s_port_t i2s_port, int bck_io_num, int ws_io_n
  * @param[in] len Length of the buffer.
  * @param[in] timeout UNUSED.
  *
+ * @note Consecutive writes make a stream. A DMA buffer sent while nothing
+ * written is left in the queue counts as an underrun of the stream, see
+ * @ref Speaker_EndStream() and @ref Speaker_GetUnderruns().
+ *
  * @return [esp_err_t](https://docs.espressif.com/projects/esp-idf/en/release-v4.2/esp32/api-reference/system/esp_err.html#macros). 0 or `ESP_OK` if successful.
  */
 /* @[declare_speaker_writebuff] */
 esp_err_t Speaker_WriteBuff(speaker_device_t * speaker, uint8_t* buff, uint32_t len, uint32_t timeout);
 /* @[declare_speaker_writebuff] */
 
+/**
+ * @brief Ends the stream of writes on purpose, the DMA running dry until
+ * the next write is not counted as an underrun.
+ */
+/* @[declare_speaker_endstream] */
+void Speaker_EndStream(speaker_device_t * speaker);
+/* @[declare_speaker_endstream] */
+
+/**
+ * @brief Returns the number of DMA buffers sent without fresh samples
+ * while streaming, since the speaker was initialized.
+ */
+/* @[declare_speaker_getunderruns] */
+uint32_t Speaker_GetUnderruns(speaker_device_t * speaker);
+/* @[declare_speaker_getunderruns] */
+
 /**
  * @brief De-initializes the speaker.
  * 
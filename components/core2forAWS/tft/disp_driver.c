@@ -6,9 +6,14 @@
 #include <freertos/task.h>
 #include <freertos/semphr.h>
 
+#include <string.h>
+
 #include "disp_driver.h"
 #include "disp_spi.h"
 
+static disp_driver_stats_t frame_stats = {0};
+static portMUX_TYPE frame_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
 void disp_driver_init(void) {
     ili9341_init();
 }
@@ -17,3 +22,25 @@ void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t *
     ili9341_flush(drv, area, color_map);
 }
 
+
+void disp_driver_monitor(lv_disp_drv_t * drv, uint32_t time, uint32_t px) {
+    portENTER_CRITICAL(&frame_stats_lock);
+    frame_stats.frames++;
+    frame_stats.pixels += px;
+    frame_stats.frame_ms += time;
+    if (time > frame_stats.frame_ms_max) {
+        frame_stats.frame_ms_max = time;
+    }
+    portEXIT_CRITICAL(&frame_stats_lock);
+}
+
+void disp_driver_get_stats(disp_driver_stats_t * stats, bool reset) {
+    portENTER_CRITICAL(&frame_stats_lock);
+    *stats = frame_stats;
+    if (reset) {
+        memset(&frame_stats, 0, sizeof(disp_driver_stats_t));
+    }
+    portEXIT_CRITICAL(&frame_stats_lock);
+
+    disp_spi_get_stats(&stats->flush, reset);
+}
@@ -15,6 +15,7 @@ extern "C" {
 #include "lvgl/lvgl.h"
 
 #include "ili9341.h"
+#include "disp_spi.h"
 
 
 /*********************
@@ -26,6 +27,15 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/* Refreshes as reported by the LVGL monitor callback, time covers rendering and flushing */
+typedef struct {
+    uint32_t frames;
+    uint32_t pixels;
+    uint32_t frame_ms;
+    uint32_t frame_ms_max;
+    disp_spi_stats_t flush;
+} disp_driver_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -36,6 +46,12 @@ void disp_driver_init(void);
 /* Display flush callback */
 void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
 
+/* Display monitor callback */
+void disp_driver_monitor(lv_disp_drv_t * drv, uint32_t time, uint32_t px);
+
+/* Frame and flush statistics since the last reset */
+void disp_driver_get_stats(disp_driver_stats_t * stats, bool reset);
+
 /**********************
  *      MACROS
  **********************/
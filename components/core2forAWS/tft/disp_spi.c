@@ -4,6 +4,8 @@
  */
 
 #include "esp_system.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 
@@ -20,6 +22,7 @@
 
 SemaphoreHandle_t spi_mutex;
 
+static void IRAM_ATTR spi_pre (spi_transaction_t *trans);
 static void IRAM_ATTR spi_ready (spi_transaction_t *trans);
 
 static spi_host_device_t spi_host;
@@ -29,7 +32,20 @@ static transaction_cb_t chained_post_cb;
 
 static uint8_t tft_used_spi_dma = 0;
 
+/* Queued transactions must stay valid until their result is collected, they rotate through this ring */
+static spi_transaction_ext_t queued_trans[DISP_SPI_QUEUE_SIZE];
+static uint32_t queued_index = 0;
+
+/* Pixels from PSRAM are copied here once instead of the driver allocating a DMA copy per transaction */
+static uint8_t *bounce_buffer = NULL;
+
+static SemaphoreHandle_t flush_semaphore = NULL;
+static int64_t flush_start_time = 0;
+static disp_spi_stats_t flush_stats = {0};
+static portMUX_TYPE flush_stats_lock = portMUX_INITIALIZER_UNLOCKED;
+
 #define CONFIG_LV_DISP_SPI_CS   5
+#define DISP_SPI_BOUNCE_SIZE    (DISP_BUF_SIZE * sizeof(lv_color_t))
 
 void spi_poll() {
     if (!tft_used_spi_dma) {
@@ -50,6 +66,7 @@ void disp_spi_add_device_config(spi_host_device_t host, spi_device_interface_con
     spi_host=host;
     chained_post_cb=devcfg->post_cb;
     devcfg->post_cb=spi_ready;
+    flush_semaphore=xSemaphoreCreateBinary();
     esp_err_t ret=spi_bus_add_device(host, devcfg, &spi);
     assert(ret==ESP_OK);
 }
@@ -65,8 +82,8 @@ void disp_spi_add_device(spi_host_device_t host) {
         .mode = 0,
         .spics_io_num=CONFIG_LV_DISP_SPI_CS,              // CS pin
         .input_delay_ns=0,
-        .queue_size=1,
-        .pre_cb=NULL,
+        .queue_size=DISP_SPI_QUEUE_SIZE,
+        .pre_cb=spi_pre,
         .post_cb=NULL,
         .flags = SPI_DEVICE_NO_DUMMY,
     };
@@ -135,15 +152,89 @@ void disp_spi_transaction(const uint8_t *data, size_t length,
         spi_device_release_bus(spi);
         xSemaphoreGive(spi_mutex);
     } else {
-        static spi_transaction_ext_t queuedt;
-        memcpy(&queuedt, &t, sizeof t);
+        spi_transaction_ext_t *queuedt = &queued_trans[queued_index];
+        queued_index = (queued_index + 1) % DISP_SPI_QUEUE_SIZE;
+        memcpy(queuedt, &t, sizeof t);
+        if (flags & DISP_SPI_SIGNAL_FLUSH) {
+            flush_start_time = esp_timer_get_time();
+        }
         spi_pending_trans++;
-        if (spi_device_queue_trans(spi, (spi_transaction_t *) &queuedt, portMAX_DELAY) != ESP_OK) {
+        if (spi_device_queue_trans(spi, (spi_transaction_t *) queuedt, portMAX_DELAY) != ESP_OK) {
             spi_pending_trans--; /* Clear wait state */
         }
     }
 }
 
+static void disp_spi_queue(const uint8_t *data, size_t length, disp_spi_send_flag_t flags) {
+    if (0 == length) {
+        return;
+    }
+
+    spi_transaction_ext_t *t = &queued_trans[queued_index];
+    queued_index = (queued_index + 1) % DISP_SPI_QUEUE_SIZE;
+    memset(t, 0, sizeof(spi_transaction_ext_t));
+
+    t->base.length = length * 8;
+    if (length <= 4) {
+        t->base.flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->base.tx_data, data, length);
+    } else {
+        t->base.tx_buffer = data;
+    }
+    t->base.user = (void *) flags;
+
+    spi_pending_trans++;
+    if (spi_device_queue_trans(spi, (spi_transaction_t *) t, portMAX_DELAY) != ESP_OK) {
+        spi_pending_trans--; /* Clear wait state */
+    }
+}
+
+void disp_spi_send_frame(const disp_spi_command_t *commands, size_t count, const uint8_t *colors, size_t length) {
+    assert(count * 2 + 1 <= DISP_SPI_QUEUE_SIZE);
+
+    /* LVGL flushes again only once the previous pixels are out, this just collects their results */
+    disp_wait_for_pending_transactions();
+
+    if (!esp_ptr_dma_capable(colors) && length <= DISP_SPI_BOUNCE_SIZE) {
+        if (bounce_buffer == NULL) {
+            bounce_buffer = heap_caps_malloc(DISP_SPI_BOUNCE_SIZE, MALLOC_CAP_DMA);
+        }
+        if (bounce_buffer != NULL) {
+            memcpy(bounce_buffer, colors, length);
+            colors = bounce_buffer;
+            portENTER_CRITICAL(&flush_stats_lock);
+            flush_stats.bounced++;
+            portEXIT_CRITICAL(&flush_stats_lock);
+        }
+    }
+
+    xSemaphoreTake(spi_mutex, portMAX_DELAY);
+    spi_device_acquire_bus(spi, portMAX_DELAY);
+    gpio_set_level(CONFIG_LV_DISP_SPI_CS, 0);
+    flush_start_time = esp_timer_get_time();
+
+    /* Bus and mutex are released by the interrupt of the pixel transaction */
+    for (size_t i = 0; i < count; i++) {
+        disp_spi_queue(&commands[i].cmd, 1, DISP_SPI_DC_COMMAND);
+        disp_spi_queue(commands[i].data, commands[i].length, DISP_SPI_DC_DATA);
+    }
+    disp_spi_queue(colors, length, DISP_SPI_DC_DATA | DISP_SPI_SIGNAL_FLUSH);
+}
+
+void disp_spi_wait_flush(lv_disp_drv_t *drv) {
+    (void) drv;
+    xSemaphoreTake(flush_semaphore, 1);
+}
+
+void disp_spi_get_stats(disp_spi_stats_t *stats, bool reset) {
+    portENTER_CRITICAL(&flush_stats_lock);
+    *stats = flush_stats;
+    if (reset) {
+        memset(&flush_stats, 0, sizeof(disp_spi_stats_t));
+    }
+    portEXIT_CRITICAL(&flush_stats_lock);
+}
+
 void disp_wait_for_pending_transactions(void) {
     spi_transaction_t *presult;
 
@@ -154,6 +245,16 @@ void disp_wait_for_pending_transactions(void) {
     }
 }
 
+static void IRAM_ATTR spi_pre(spi_transaction_t *trans) {
+    disp_spi_send_flag_t flags = (disp_spi_send_flag_t) trans->user;
+
+    if (flags & DISP_SPI_DC_COMMAND) {
+        gpio_set_level(ILI9341_DC, 0);
+    } else if (flags & DISP_SPI_DC_DATA) {
+        gpio_set_level(ILI9341_DC, 1);
+    }
+}
+
 static void IRAM_ATTR spi_ready(spi_transaction_t *trans) {
     disp_spi_send_flag_t flags = (disp_spi_send_flag_t) trans->user;
     int higher_priority_task_awoken = pdFALSE;
@@ -174,6 +275,17 @@ static void IRAM_ATTR spi_ready(spi_transaction_t *trans) {
         gpio_set_level(CONFIG_LV_DISP_SPI_CS, 1);
         spi_device_release_bus(spi);
         xSemaphoreGiveFromISR(spi_mutex, &higher_priority_task_awoken);
+
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - flush_start_time);
+        portENTER_CRITICAL_ISR(&flush_stats_lock);
+        flush_stats.flushes++;
+        flush_stats.bytes += trans->length / 8;
+        flush_stats.flush_us += elapsed;
+        if (elapsed > flush_stats.flush_us_max) {
+            flush_stats.flush_us_max = elapsed;
+        }
+        portEXIT_CRITICAL_ISR(&flush_stats_lock);
+        xSemaphoreGiveFromISR(flush_semaphore, &higher_priority_task_awoken);
     }
 
     if (higher_priority_task_awoken) portYIELD_FROM_ISR();
@@ -14,6 +14,8 @@ extern "C" {
 #include <stdbool.h>
 #include <driver/spi_master.h>
 
+#include "lvgl/lvgl.h"
+
 typedef enum _disp_spi_send_flag_t {
     DISP_SPI_SEND_QUEUED        = 0x00000000,
     DISP_SPI_SEND_POLLING       = 0x00000001,
@@ -29,8 +31,29 @@ typedef enum _disp_spi_send_flag_t {
     DISP_SPI_MODE_DIO           = 0x00000400, /* Reserved */
     DISP_SPI_MODE_QIO           = 0x00000800, /* Reserved */
     DISP_SPI_MODE_DIOQIO_ADDR   = 0x00001000, /* Reserved */
+    DISP_SPI_DC_COMMAND         = 0x00002000, /* D/C line low from the pre transfer callback */
+    DISP_SPI_DC_DATA            = 0x00004000, /* D/C line high from the pre transfer callback */
 } disp_spi_send_flag_t;
 
+/* Transactions queued on the display device, a flush takes two per command and one for the pixels */
+#define DISP_SPI_QUEUE_SIZE     (8)
+
+/* One controller command with up to four parameter bytes, sent from the transaction itself */
+typedef struct {
+    uint8_t cmd;
+    uint8_t data[4];
+    uint8_t length;
+} disp_spi_command_t;
+
+/* Flush timing, from the queueing of the first command to the end of the pixel DMA */
+typedef struct {
+    uint32_t flushes;
+    uint32_t bounced;
+    uint64_t bytes;
+    uint64_t flush_us;
+    uint32_t flush_us_max;
+} disp_spi_stats_t;
+
 typedef struct _disp_spi_read_data {
     uint8_t _dummy_byte;
     union {
@@ -56,6 +79,22 @@ void disp_spi_transaction(const uint8_t *data, size_t length,
     disp_spi_send_flag_t flags, disp_spi_read_data *out, uint64_t addr);
 void disp_wait_for_pending_transactions(void);
 
+/**
+ * @brief Queues the commands and the pixels of one flush as linked transactions.
+ *
+ * The D/C line follows each transaction from the pre transfer callback, so the
+ * address setup goes out right behind the previous DMA without the CPU polling
+ * every phase. Pixels outside of DMA capable memory are copied once into an
+ * internal bounce buffer. lv_disp_flush_ready is signaled from the interrupt
+ * when the pixel transaction ends.
+ */
+void disp_spi_send_frame(const disp_spi_command_t * commands, size_t count, const uint8_t * colors, size_t length);
+
+/* Blocks up to a tick for the flush in progress, LVGL wait callback instead of spinning */
+void disp_spi_wait_flush(lv_disp_drv_t * drv);
+
+void disp_spi_get_stats(disp_spi_stats_t * stats, bool reset);
+
 static inline void disp_spi_send_data(uint8_t *data, size_t length) {
     disp_spi_transaction(data, length, DISP_SPI_SEND_POLLING, NULL, 0);
 }
@@ -38,7 +38,6 @@ static void ili9341_set_orientation(uint8_t orientation);
 
 static void ili9341_send_cmd(uint8_t cmd);
 static void ili9341_send_data(void * data, uint16_t length);
-static void ili9341_send_color(void * data, uint16_t length);
 
 /**********************
  *  STATIC VARIABLES
@@ -110,31 +109,16 @@ void ili9341_init(void)
 
 void ili9341_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
-	uint8_t data[4];
-
-	/*Column addresses*/
-	ili9341_send_cmd(0x2A);
-	data[0] = (area->x1 >> 8) & 0xFF;
-	data[1] = area->x1 & 0xFF;
-	data[2] = (area->x2 >> 8) & 0xFF;
-	data[3] = area->x2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Page addresses*/
-	ili9341_send_cmd(0x2B);
-	data[0] = (area->y1 >> 8) & 0xFF;
-	data[1] = area->y1 & 0xFF;
-	data[2] = (area->y2 >> 8) & 0xFF;
-	data[3] = area->y2 & 0xFF;
-	ili9341_send_data(data, 4);
-
-	/*Memory write*/
-	ili9341_send_cmd(0x2C);
-
+	/*Column addresses, page addresses and memory write, queued behind the previous pixels*/
+	disp_spi_command_t commands[] = {
+		{0x2A, {(area->x1 >> 8) & 0xFF, area->x1 & 0xFF, (area->x2 >> 8) & 0xFF, area->x2 & 0xFF}, 4},
+		{0x2B, {(area->y1 >> 8) & 0xFF, area->y1 & 0xFF, (area->y2 >> 8) & 0xFF, area->y2 & 0xFF}, 4},
+		{0x2C, {0}, 0},
+	};
 
 	uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
 
-	ili9341_send_color((void*)color_map, size * 2);
+	disp_spi_send_frame(commands, sizeof(commands) / sizeof(commands[0]), (const uint8_t *)color_map, size * 2);
 }
 
 void ili9341_sleep_in()
@@ -170,13 +154,6 @@ static void ili9341_send_data(void * data, uint16_t length)
     disp_spi_send_data(data, length);
 }
 
-static void ili9341_send_color(void * data, uint16_t length)
-{
-    disp_wait_for_pending_transactions();
-    gpio_set_level(ILI9341_DC, 1);   /*Data mode*/
-    disp_spi_send_colors(data, length);
-}
-
 static void ili9341_set_orientation(uint8_t orientation)
 {
     // ESP_ASSERT(orientation < 4);
@@ -0,0 +1,363 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ahrs.h"
+#include "replay.h"
+
+/*
+    Attitude over a scripted flight: a straight glide, two minutes of right hand thermal circles with the
+    coordinated bank of the turn, then a glide again, all of it with the pendulum swing of the pilot in the
+    harness. The IMU samples at the stream rate and the magnetometer at the rate vario_qmc5883l_loop reads it.
+    Both come through the sensor scales of the drivers, with noise and a gyro bias, in the body frame of
+    vario_mpu6886_loop. Compares tilt, heading and vertical acceleration against the truth of the script, next to
+    the former level compass atan2 and the former gravity estimator, then times one update of each.
+*/
+
+#define ATTITUDE_CHECK_SECONDS          (180)
+#define ATTITUDE_CHECK_SETTLE_US        (5 * 1000000LL)
+#define ATTITUDE_CHECK_SAMPLE_US        (1000000 / VARIO_MPU6886_ODR_HZ)
+#define ATTITUDE_CHECK_MAGNET_US        (100 * 1000)        /* VARIO_QMC5883L_PERIOD_MS */
+#define ATTITUDE_CHECK_THERMAL_START    (20.0)
+#define ATTITUDE_CHECK_THERMAL_STOP     (145.0)             /* five whole circles */
+#define ATTITUDE_CHECK_TURN_RAMP        (2.0)               /* s to roll into and out of the turn */
+#define ATTITUDE_CHECK_CIRCLE           (25.0)              /* s per circle */
+#define ATTITUDE_CHECK_AIRSPEED         (9.0)               /* m/s, slower than the AHRS_AIRSPEED trim */
+#define ATTITUDE_CHECK_MOUNT_PITCH      (10.0)              /* degree, the device leans back in its mount */
+#define ATTITUDE_CHECK_INCLINATION      (64.0)              /* degree, central Europe */
+#define ATTITUDE_CHECK_FIELD            (3000.0)            /* magnetometer counts */
+#define ATTITUDE_CHECK_ACCEL_NOISE      (0.01)              /* g */
+#define ATTITUDE_CHECK_GYRO_NOISE       (0.05)              /* degree/s */
+#define ATTITUDE_CHECK_MAGNET_NOISE     (0.01)              /* of the field */
+#define ATTITUDE_CHECK_ACCEL_LSB_PER_G  (4096.0)            /* MPU6886 at 8g full scale */
+#define ATTITUDE_CHECK_GYRO_LSB_PER_DPS (16.384)            /* MPU6886 at 2000dps full scale */
+/* Former gravity estimator, accelerometer weight per second */
+#define ATTITUDE_CHECK_LEGACY_RATE      (2.0f)
+
+/* Regression limits, degree and m/s^2 RMS over the settled flight */
+#define ATTITUDE_CHECK_TILT_RMS_MAX     (3.0)
+#define ATTITUDE_CHECK_HEADING_RMS_MAX  (6.0)
+
+static const double attitude_check_gyro_bias[3] = { 0.5, -0.3, 0.4 };  /* degree/s */
+
+typedef struct {
+    float accel[3];
+    float gyro[3];
+    float magnet[3];
+    bool magnet_ready;
+    double up[3];               /* true earth up in the body frame */
+    double heading;
+    double vertical_accel;
+} attitude_check_sample_t;
+
+static uint64_t attitude_check_random_state = 0x9e3779b97f4a7c15ULL;
+
+static double attitude_check_gaussian(void) {
+    double u[2];
+    for (int i = 0; i < 2; i++) {
+        attitude_check_random_state ^= attitude_check_random_state << 13;
+        attitude_check_random_state ^= attitude_check_random_state >> 7;
+        attitude_check_random_state ^= attitude_check_random_state << 17;
+        u[i] = (double)(attitude_check_random_state >> 11) / 9007199254740992.0;
+    }
+    return sqrt(-2.0 * log(fmax(u[0], 1e-12))) * cos(2.0 * M_PI * u[1]);
+}
+
+static double attitude_check_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Turn rate in rad/s, clockwise seen from above, ramped in and out of the thermal */
+static double attitude_check_turn_rate(double seconds) {
+    double rate = 2.0 * M_PI / ATTITUDE_CHECK_CIRCLE;
+    double in = (seconds - ATTITUDE_CHECK_THERMAL_START) / ATTITUDE_CHECK_TURN_RAMP;
+    double out = (ATTITUDE_CHECK_THERMAL_STOP - seconds) / ATTITUDE_CHECK_TURN_RAMP;
+    return rate * fmax(0.0, fmin(1.0, fmin(in, out)));
+}
+
+/* Heading in rad, the integral of the turn rate on top of the initial 60 degrees */
+static double attitude_check_heading(double seconds) {
+    double rate = 2.0 * M_PI / ATTITUDE_CHECK_CIRCLE;
+    double start = ATTITUDE_CHECK_THERMAL_START;
+    double stop = ATTITUDE_CHECK_THERMAL_STOP;
+    double ramp = ATTITUDE_CHECK_TURN_RAMP;
+    double turned = 0.0;
+    if (seconds > start) {
+        double t = fmin(seconds, start + ramp) - start;
+        turned += rate * t * t / (2.0 * ramp);
+    }
+    if (seconds > start + ramp) {
+        turned += rate * (fmin(seconds, stop - ramp) - start - ramp);
+    }
+    if (seconds > stop - ramp) {
+        double t = fmin(seconds, stop) - (stop - ramp);
+        turned += rate * (t - t * t / (2.0 * ramp));
+    }
+    return 60.0 * M_PI / 180.0 + turned;
+}
+
+/* Climb in m/s, sinking in the glides and surging with the circles in the thermal */
+static double attitude_check_climb(double seconds) {
+    if (seconds < ATTITUDE_CHECK_THERMAL_START || seconds > ATTITUDE_CHECK_THERMAL_STOP) {
+        return -1.1;
+    }
+    return -1.1 + 2.6 * (1.0 - cos((seconds - ATTITUDE_CHECK_THERMAL_START) * 2.0 * M_PI / ATTITUDE_CHECK_CIRCLE)) / 2.0;
+}
+
+/*
+    Body to earth rotation, earth north, west, up and body x forward, y left, z out of the screen. Heading
+    clockwise from north, pitch of x above the horizon, roll right side down: Rz(-heading) Ry(-pitch) Rx(roll).
+*/
+static void attitude_check_rotation(double seconds, double r[3][3]) {
+    double bank = atan(ATTITUDE_CHECK_AIRSPEED * attitude_check_turn_rate(seconds) / VARIO_GRAVITY_ACCELERATION);
+    double roll = bank + 12.0 * M_PI / 180.0 * sin(seconds * 2.0 * M_PI / 2.7);
+    double pitch = (ATTITUDE_CHECK_MOUNT_PITCH + 6.0 * sin(seconds * 2.0 * M_PI / 3.9)) * M_PI / 180.0;
+    double yaw = -attitude_check_heading(seconds) + 4.0 * M_PI / 180.0 * sin(seconds * 2.0 * M_PI / 5.3);
+
+    double cr = cos(roll), sr = sin(roll);
+    double cp = cos(pitch), sp = sin(pitch);
+    double cy = cos(yaw), sy = sin(yaw);
+    r[0][0] = cy * cp;  r[0][1] = -sy * cr - cy * sp * sr;  r[0][2] = sy * sr - cy * sp * cr;
+    r[1][0] = sy * cp;  r[1][1] = cy * cr - sy * sp * sr;   r[1][2] = -cy * sr - sy * sp * cr;
+    r[2][0] = sp;       r[2][1] = cp * sr;                  r[2][2] = cp * cr;
+}
+
+/* Body vector of an earth vector, the transposed rotation */
+static void attitude_check_to_body(double r[3][3], const double earth[3], double body[3]) {
+    for (int i = 0; i < 3; i++) {
+        body[i] = r[0][i] * earth[0] + r[1][i] * earth[1] + r[2][i] * earth[2];
+    }
+}
+
+static float attitude_check_quantize(double value, double lsb) {
+    return (float)(lround(value * lsb) / lsb);
+}
+
+static attitude_check_sample_t * attitude_check_script(uint32_t * count) {
+    *count = ATTITUDE_CHECK_SECONDS * 1000000LL / ATTITUDE_CHECK_SAMPLE_US;
+    attitude_check_sample_t * samples = calloc(*count, sizeof(attitude_check_sample_t));
+    if (samples == NULL) {
+        return NULL;
+    }
+
+    double inclination = ATTITUDE_CHECK_INCLINATION * M_PI / 180.0;
+    double field[3] = { cos(inclination), 0.0, -sin(inclination) };
+    double step = ATTITUDE_CHECK_SAMPLE_US / 1e6;
+
+    for (uint32_t i = 0; i < *count; i++) {
+        attitude_check_sample_t * sample = &samples[i];
+        double seconds = i * step;
+        double r[3][3];
+        double before[3][3];
+        double after[3][3];
+        attitude_check_rotation(seconds, r);
+        attitude_check_rotation(seconds - step / 2.0, before);
+        attitude_check_rotation(seconds + step / 2.0, after);
+
+        // Body rate from the rotation over one sample, the skew part of before^T after
+        double delta[3][3];
+        for (int row = 0; row < 3; row++) {
+            for (int column = 0; column < 3; column++) {
+                delta[row][column] = before[0][row] * after[0][column] + before[1][row] * after[1][column] + before[2][row] * after[2][column];
+            }
+        }
+        double rate[3] = {
+            (delta[2][1] - delta[1][2]) / (2.0 * step),
+            (delta[0][2] - delta[2][0]) / (2.0 * step),
+            (delta[1][0] - delta[0][1]) / (2.0 * step),
+        };
+
+        // Specific force of the turn and of the climb changes, the device turns about itself
+        double heading = attitude_check_heading(seconds);
+        double centripetal = ATTITUDE_CHECK_AIRSPEED * attitude_check_turn_rate(seconds);
+        double vertical = (attitude_check_climb(seconds + step / 2.0) - attitude_check_climb(seconds - step / 2.0)) / step;
+        double force[3] = {
+            -centripetal * sin(heading) / VARIO_GRAVITY_ACCELERATION,
+            -centripetal * cos(heading) / VARIO_GRAVITY_ACCELERATION,
+            1.0 + vertical / VARIO_GRAVITY_ACCELERATION,
+        };
+        double accel[3];
+        double magnet[3];
+        double up[3] = { 0.0, 0.0, 1.0 };
+        attitude_check_to_body(r, force, accel);
+        attitude_check_to_body(r, field, magnet);
+        attitude_check_to_body(r, up, sample->up);
+
+        for (int axis = 0; axis < 3; axis++) {
+            sample->accel[axis] = attitude_check_quantize(accel[axis] + ATTITUDE_CHECK_ACCEL_NOISE * attitude_check_gaussian(), ATTITUDE_CHECK_ACCEL_LSB_PER_G);
+            double gyro = rate[axis] * 180.0 / M_PI + attitude_check_gyro_bias[axis] + ATTITUDE_CHECK_GYRO_NOISE * attitude_check_gaussian();
+            sample->gyro[axis] = attitude_check_quantize(gyro, ATTITUDE_CHECK_GYRO_LSB_PER_DPS);
+            sample->magnet[axis] = (float)lround(ATTITUDE_CHECK_FIELD * (magnet[axis] + ATTITUDE_CHECK_MAGNET_NOISE * attitude_check_gaussian()));
+        }
+        sample->magnet_ready = ((int64_t)i * ATTITUDE_CHECK_SAMPLE_US) % ATTITUDE_CHECK_MAGNET_US == 0;
+        sample->heading = fmod(heading * 180.0 / M_PI + 360.0, 360.0);
+        sample->vertical_accel = vertical;
+    }
+
+    return samples;
+}
+
+/* The estimator replaced by the AHRS, gravity direction propagated by the gyro and pulled towards the accelerometer */
+static float attitude_check_legacy_vertical(float gravity[3], const float accel[3], const float gyro[3], float delta_time) {
+    float norm = sqrtf(accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2]);
+    if (norm < 0.5f) {
+        return 0.0f;
+    }
+
+    float wx = gyro[0] * (float)M_PI / 180.0f * delta_time;
+    float wy = gyro[1] * (float)M_PI / 180.0f * delta_time;
+    float wz = gyro[2] * (float)M_PI / 180.0f * delta_time;
+
+    float g0 = gravity[0] + (gravity[1] * wz - gravity[2] * wy);
+    float g1 = gravity[1] + (gravity[2] * wx - gravity[0] * wz);
+    float g2 = gravity[2] + (gravity[0] * wy - gravity[1] * wx);
+
+    float weight = ATTITUDE_CHECK_LEGACY_RATE * delta_time;
+    g0 += weight * (accel[0] / norm - g0);
+    g1 += weight * (accel[1] / norm - g1);
+    g2 += weight * (accel[2] / norm - g2);
+
+    float g_norm = sqrtf(g0 * g0 + g1 * g1 + g2 * g2);
+    gravity[0] = g0 / g_norm;
+    gravity[1] = g1 / g_norm;
+    gravity[2] = g2 / g_norm;
+
+    return (accel[0] * gravity[0] + accel[1] * gravity[1] + accel[2] * gravity[2] - 1.0f) * VARIO_GRAVITY_ACCELERATION;
+}
+
+/* The former compass, the field taken as level */
+static double attitude_check_legacy_heading(const float magnet[3]) {
+    return fmod(atan2(magnet[1], magnet[0]) * 180.0 / M_PI + 360.0, 360.0);
+}
+
+static double attitude_check_heading_error(double heading, double truth) {
+    return fabs(fmod(heading - truth + 540.0, 360.0) - 180.0);
+}
+
+typedef struct {
+    double square_sum;
+    double maximum;
+    uint32_t count;
+} attitude_check_error_t;
+
+static void attitude_check_add(attitude_check_error_t * error, double value) {
+    error->square_sum += value * value;
+    error->maximum = fmax(error->maximum, fabs(value));
+    error->count++;
+}
+
+static double attitude_check_rms(const attitude_check_error_t * error) {
+    return (error->count == 0) ? 0.0 : sqrt(error->square_sum / error->count);
+}
+
+bool replay_check_attitude(uint32_t iterations) {
+    uint32_t count;
+    attitude_check_sample_t * samples = attitude_check_script(&count);
+    if (samples == NULL) {
+        return false;
+    }
+
+    const float delta_time = ATTITUDE_CHECK_SAMPLE_US / 1e6f;
+    const float magnet_delta_time = ATTITUDE_CHECK_MAGNET_US / 1e6f;
+    attitude_check_error_t tilt = {0};
+    attitude_check_error_t heading = {0};
+    attitude_check_error_t vertical = {0};
+    attitude_check_error_t legacy_tilt = {0};
+    attitude_check_error_t legacy_heading = {0};
+    attitude_check_error_t legacy_vertical = {0};
+
+    ahrs_t ahrs;
+    ahrs_init(&ahrs);
+    float gravity[3] = { 0.0f, 0.0f, 1.0f };
+    double shown_legacy_heading = 0.0;
+    for (uint32_t i = 0; i < count; i++) {
+        const attitude_check_sample_t * sample = &samples[i];
+        ahrs_update(&ahrs, sample->accel, sample->gyro, delta_time);
+        float vertical_accel = ahrs_vertical_acceleration(&ahrs, sample->accel);
+        float legacy_vertical_accel = attitude_check_legacy_vertical(gravity, sample->accel, sample->gyro, delta_time);
+        if (sample->magnet_ready) {
+            ahrs_update_magnetometer(&ahrs, sample->magnet, magnet_delta_time);
+            shown_legacy_heading = attitude_check_legacy_heading(sample->magnet);
+        }
+
+        if ((int64_t)i * ATTITUDE_CHECK_SAMPLE_US < ATTITUDE_CHECK_SETTLE_US) {
+            continue;
+        }
+
+        // Tilt error is the angle between the true and the estimated vertical
+        const float * q = ahrs.q;
+        double up[3] = {
+            2.0 * (q[1] * q[3] - q[0] * q[2]),
+            2.0 * (q[0] * q[1] + q[2] * q[3]),
+            q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3],
+        };
+        double cosine = up[0] * sample->up[0] + up[1] * sample->up[1] + up[2] * sample->up[2];
+        double legacy_cosine = gravity[0] * sample->up[0] + gravity[1] * sample->up[1] + gravity[2] * sample->up[2];
+        attitude_check_add(&tilt, acos(fmin(1.0, cosine)) * 180.0 / M_PI);
+        attitude_check_add(&legacy_tilt, acos(fmin(1.0, legacy_cosine)) * 180.0 / M_PI);
+        attitude_check_add(&heading, attitude_check_heading_error(ahrs_get_heading(&ahrs), sample->heading));
+        attitude_check_add(&legacy_heading, attitude_check_heading_error(shown_legacy_heading, sample->heading));
+        attitude_check_add(&vertical, vertical_accel - sample->vertical_accel);
+        attitude_check_add(&legacy_vertical, legacy_vertical_accel - sample->vertical_accel);
+    }
+
+    printf("attitude over %d s, %u IMU samples at %d Hz, magnetometer every %d ms\n", ATTITUDE_CHECK_SECONDS, count,
+        VARIO_MPU6886_ODR_HZ, ATTITUDE_CHECK_MAGNET_US / 1000);
+    printf("%18s | %9s %9s | %9s %9s\n", "error", "ahrs_rms", "ahrs_max", "old_rms", "old_max");
+    printf("%18s | %9.2f %9.2f | %9.2f %9.2f\n", "tilt degree", attitude_check_rms(&tilt), tilt.maximum, attitude_check_rms(&legacy_tilt), legacy_tilt.maximum);
+    printf("%18s | %9.2f %9.2f | %9.2f %9.2f\n", "heading degree", attitude_check_rms(&heading), heading.maximum, attitude_check_rms(&legacy_heading), legacy_heading.maximum);
+    printf("%18s | %9.3f %9.3f | %9.3f %9.3f\n", "vertical m/s^2", attitude_check_rms(&vertical), vertical.maximum, attitude_check_rms(&legacy_vertical), legacy_vertical.maximum);
+    printf("gyro bias estimate %.2f %.2f %.2f degree/s, true %.2f %.2f %.2f\n", -ahrs.bias[0] * 180.0 / M_PI, -ahrs.bias[1] * 180.0 / M_PI,
+        -ahrs.bias[2] * 180.0 / M_PI, attitude_check_gyro_bias[0], attitude_check_gyro_bias[1], attitude_check_gyro_bias[2]);
+
+    // Cost of the work done per IMU sample, and per magnetometer sample
+    volatile float sink = 0.0f;
+    double start = attitude_check_now();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        ahrs_init(&ahrs);
+        for (uint32_t i = 0; i < count; i++) {
+            ahrs_update(&ahrs, samples[i].accel, samples[i].gyro, delta_time);
+            sink += ahrs_vertical_acceleration(&ahrs, samples[i].accel);
+        }
+    }
+    double ahrs_ns = (attitude_check_now() - start) * 1e9 / ((double)count * iterations);
+
+    uint32_t magnet_count = 0;
+    start = attitude_check_now();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        for (uint32_t i = 0; i < count; i++) {
+            if (samples[i].magnet_ready) {
+                ahrs_update_magnetometer(&ahrs, samples[i].magnet, magnet_delta_time);
+                magnet_count++;
+            }
+        }
+        sink += ahrs_get_heading(&ahrs);
+    }
+    double magnet_ns = (attitude_check_now() - start) * 1e9 / (magnet_count ? magnet_count : 1);
+
+    start = attitude_check_now();
+    for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+        gravity[0] = 0.0f;
+        gravity[1] = 0.0f;
+        gravity[2] = 1.0f;
+        for (uint32_t i = 0; i < count; i++) {
+            sink += attitude_check_legacy_vertical(gravity, samples[i].accel, samples[i].gyro, delta_time);
+        }
+    }
+    double legacy_ns = (attitude_check_now() - start) * 1e9 / ((double)count * iterations);
+    (void)sink;
+
+    printf("ahrs update %.1f ns per IMU sample (former gravity estimator %.1f ns), magnetometer %.1f ns per sample\n", ahrs_ns, legacy_ns, magnet_ns);
+    free(samples);
+
+    // Regression check, the fused attitude stays close to the truth and beats the former estimators
+    bool result = attitude_check_rms(&tilt) < ATTITUDE_CHECK_TILT_RMS_MAX && attitude_check_rms(&heading) < ATTITUDE_CHECK_HEADING_RMS_MAX &&
+        attitude_check_rms(&tilt) < attitude_check_rms(&legacy_tilt) && attitude_check_rms(&heading) < attitude_check_rms(&legacy_heading) &&
+        attitude_check_rms(&vertical) <= attitude_check_rms(&legacy_vertical);
+    printf("%s\n", result ? "PASS" : "FAIL");
+
+    return result;
+}
@@ -0,0 +1,70 @@
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "boot.h"
+#include "replay.h"
+
+/*
+    Boot stages ended by several producer tasks, run through the firmware boot.c on host threads. Both barometer
+    tasks failing their bring up must end the fix as failed and let the speaker end the audio stage well before
+    the report timeout. A producer failing next to one that succeeds must leave the stage to the successful one.
+    Stages are process wide, the second case runs on a stage the first leaves alone.
+*/
+
+/* Far below BOOT_REPORT_TIMEOUT_MS, the tasks only take a few scheduler rounds */
+#define BOOT_CHECK_AUDIO_MS             (500)
+#define BOOT_CHECK_SHARED_STAGE         (BOOT_STAGE_SHT3X)
+
+static double boot_check_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* vario_qmp6988_loop and vario_dps310_loop when their device does not answer */
+static void boot_check_failed_baro(void * arguments) {
+    (void)arguments;
+    boot_stage_drop(BOOT_STAGE_BARO);
+}
+
+/* vario_speaker_loop up to the end of the audio stage */
+static void boot_check_speaker(void * arguments) {
+    (void)arguments;
+    while (!boot_stage_ended(BOOT_STAGE_BARO)) {
+        vTaskDelay(1);
+    }
+    boot_stage_end(BOOT_STAGE_AUDIO, boot_stage_ok(BOOT_STAGE_BARO));
+}
+
+bool replay_check_boot(void) {
+    boot_init();
+
+    // Same order as vario_start, the speaker is already waiting when the barometers give up
+    double start = boot_check_now();
+    boot_stage_start(BOOT_STAGE_AUDIO);
+    boot_stage_start(BOOT_STAGE_BARO);
+    boot_stage_expect(BOOT_STAGE_BARO, 2);
+    bool created = xTaskCreate(boot_check_speaker, "SpeakerTask", 0, NULL, 0, NULL) == pdPASS &&
+        xTaskCreate(boot_check_failed_baro, "Qmp6998Task", 0, NULL, 0, NULL) == pdPASS &&
+        xTaskCreate(boot_check_failed_baro, "Dps310Task", 0, NULL, 0, NULL) == pdPASS;
+    bool audio_ended = created && boot_wait(BOOT_STAGE_BIT(BOOT_STAGE_AUDIO), pdMS_TO_TICKS(BOOT_REPORT_TIMEOUT_MS));
+    double audio_ms = (boot_check_now() - start) * 1000.0;
+    bool failed_ok = audio_ended && audio_ms < BOOT_CHECK_AUDIO_MS &&
+        boot_stage_ended(BOOT_STAGE_BARO) && !boot_stage_ok(BOOT_STAGE_BARO) && !boot_stage_ok(BOOT_STAGE_AUDIO);
+    printf("both barometers failed: audio stage %s after %.1f ms, fix %s\n", audio_ended ? "ended" : "still running",
+        audio_ms, boot_stage_ok(BOOT_STAGE_BARO) ? "ok" : "failed");
+
+    // One producer gives up, the other ends the stage, the last drop comes too late to fail it
+    boot_stage_start(BOOT_CHECK_SHARED_STAGE);
+    boot_stage_expect(BOOT_CHECK_SHARED_STAGE, 2);
+    boot_stage_drop(BOOT_CHECK_SHARED_STAGE);
+    bool held = !boot_stage_ended(BOOT_CHECK_SHARED_STAGE);
+    boot_stage_end(BOOT_CHECK_SHARED_STAGE, true);
+    boot_stage_drop(BOOT_CHECK_SHARED_STAGE);
+    bool shared_ok = held && boot_stage_ok(BOOT_CHECK_SHARED_STAGE);
+    printf("one producer failed: stage %s after the drop, %s in the end\n", held ? "running" : "ended",
+        boot_stage_ok(BOOT_CHECK_SHARED_STAGE) ? "ok" : "failed");
+
+    return failed_ok && shared_ok;
+}
@@ -0,0 +1,285 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core2forAWS.h"
+#include "i2c_replay.h"
+#include "replay.h"
+
+/*
+    Accuracy of the fixed point barometer path against the double reference, over random QMP6988 OTP
+    coefficient sets and perturbed DPS310 coefficient sets, for every temperature and pressure of the
+    sensors' operating range. Raw values are found by inverting the double compensation.
+*/
+
+#define CHECK_COEFFICIENT_SETS          (16)
+#define CHECK_TEMPERATURE_MIN           (-20.0)
+#define CHECK_TEMPERATURE_MAX           (50.0)
+#define CHECK_TEMPERATURE_STEP          (5.0)
+#define CHECK_PRESSURE_MIN              (30000.0)
+#define CHECK_PRESSURE_MAX              (110000.0)
+#define CHECK_PRESSURE_STEP             (997.0)
+#define CHECK_ALTITUDE_PRESSURE_STEP    (7)         /* 1/256 Pa, not a divisor of the table step */
+#define CHECK_BENCH_SAMPLES             (4096)
+
+/* Acceptance limits, 0.1 Pa is below one centimeter of altitude */
+#define CHECK_PRESSURE_LIMIT            (0.1)
+#define CHECK_TEMPERATURE_LIMIT         (0.01)
+#define CHECK_ALTITUDE_LIMIT            (0.05)
+
+static const int32_t check_dps310_coefficients[] = { 209, -262, 80469, -54769, -2059, 1234, -10229, 172, -1247 };
+
+static uint64_t check_random_state = 0x9e3779b97f4a7c15ULL;
+
+static uint32_t check_random(void) {
+    check_random_state ^= check_random_state << 13;
+    check_random_state ^= check_random_state >> 7;
+    check_random_state ^= check_random_state << 17;
+    return check_random_state >> 32;
+}
+
+typedef struct {
+    qmp6988_device_t * qmp6988;
+    dps310_device_t * dps310;
+    int32_t temperature_raw;
+    bool pressure;
+} check_context_t;
+
+typedef double (*check_forward_t)(check_context_t * context, int32_t raw);
+
+static double check_qmp6988_forward(check_context_t * context, int32_t raw) {
+    double temperature;
+    double pressure;
+    qmp6988_compensate(context->qmp6988, context->pressure ? context->temperature_raw : raw, context->pressure ? raw : 0, &temperature, &pressure);
+    return context->pressure ? pressure : temperature;
+}
+
+static double check_dps310_forward(check_context_t * context, int32_t raw) {
+    double temperature;
+    double pressure;
+    dps310_compensate(context->dps310, context->pressure ? context->temperature_raw : raw, context->pressure ? raw : 0, &temperature, &pressure);
+    return context->pressure ? pressure : temperature;
+}
+
+static int32_t check_invert(check_forward_t forward, check_context_t * context, int32_t low, int32_t high, double target) {
+    bool increasing = forward(context, high) > forward(context, low);
+
+    while (high - low > 1) {
+        int32_t middle = low + (high - low) / 2;
+        if ((forward(context, middle) < target) == increasing) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+typedef struct {
+    double pressure;
+    double temperature;
+    uint32_t samples;
+} check_error_t;
+
+static void check_accumulate(check_error_t * error, double temperature, double pressure, int32_t temperature_fixed, int32_t pressure_fixed) {
+    double temperature_error = fabs(temperature_fixed / 100.0 - temperature);
+    double pressure_error = fabs((double)pressure_fixed / (1 << VARIO_FIXED_PRESSURE_SHIFT) - pressure);
+    error->temperature = fmax(error->temperature, temperature_error);
+    error->pressure = fmax(error->pressure, pressure_error);
+    error->samples++;
+}
+
+/* Raw samples of the last coefficient set, reused by the benchmark */
+static int32_t check_qmp6988_raw[CHECK_BENCH_SAMPLES][2];
+static int32_t check_dps310_raw[CHECK_BENCH_SAMPLES][2];
+static uint32_t check_qmp6988_raw_count = 0;
+static uint32_t check_dps310_raw_count = 0;
+
+static void check_qmp6988(qmp6988_device_t * device, check_error_t * error) {
+    check_context_t context = { .qmp6988 = device };
+    check_qmp6988_raw_count = 0;
+
+    for (double temperature = CHECK_TEMPERATURE_MIN; temperature <= CHECK_TEMPERATURE_MAX; temperature += CHECK_TEMPERATURE_STEP) {
+        context.pressure = false;
+        context.temperature_raw = check_invert(check_qmp6988_forward, &context, -0x800000, 0x7fffff, temperature);
+        context.pressure = true;
+
+        for (double pressure = CHECK_PRESSURE_MIN; pressure <= CHECK_PRESSURE_MAX; pressure += CHECK_PRESSURE_STEP) {
+            int32_t pressure_raw = check_invert(check_qmp6988_forward, &context, -0x800000, 0x7fffff, pressure);
+
+            double temperature_double;
+            double pressure_double;
+            int32_t temperature_fixed;
+            int32_t pressure_fixed;
+            qmp6988_compensate(device, context.temperature_raw, pressure_raw, &temperature_double, &pressure_double);
+            qmp6988_compensate_fixed(device, context.temperature_raw, pressure_raw, &temperature_fixed, &pressure_fixed);
+            check_accumulate(error, temperature_double, pressure_double, temperature_fixed, pressure_fixed);
+
+            if (check_qmp6988_raw_count < CHECK_BENCH_SAMPLES) {
+                check_qmp6988_raw[check_qmp6988_raw_count][0] = context.temperature_raw;
+                check_qmp6988_raw[check_qmp6988_raw_count][1] = pressure_raw;
+                check_qmp6988_raw_count++;
+            }
+        }
+    }
+}
+
+static void check_dps310(dps310_device_t * device, check_error_t * error) {
+    check_context_t context = { .dps310 = device };
+    check_dps310_raw_count = 0;
+
+    for (double temperature = CHECK_TEMPERATURE_MIN; temperature <= CHECK_TEMPERATURE_MAX; temperature += CHECK_TEMPERATURE_STEP) {
+        context.pressure = false;
+        context.temperature_raw = check_invert(check_dps310_forward, &context, -0x800000, 0x7fffff, temperature);
+        context.pressure = true;
+
+        for (double pressure = CHECK_PRESSURE_MIN; pressure <= CHECK_PRESSURE_MAX; pressure += CHECK_PRESSURE_STEP) {
+            int32_t pressure_raw = check_invert(check_dps310_forward, &context, -0x800000, 0x7fffff, pressure);
+
+            double temperature_double;
+            double pressure_double;
+            int32_t temperature_fixed;
+            int32_t pressure_fixed;
+            dps310_compensate(device, context.temperature_raw, pressure_raw, &temperature_double, &pressure_double);
+            dps310_compensate_fixed(device, context.temperature_raw, pressure_raw, &temperature_fixed, &pressure_fixed);
+            check_accumulate(error, temperature_double, pressure_double, temperature_fixed, pressure_fixed);
+
+            if (check_dps310_raw_count < CHECK_BENCH_SAMPLES) {
+                check_dps310_raw[check_dps310_raw_count][0] = context.temperature_raw;
+                check_dps310_raw[check_dps310_raw_count][1] = pressure_raw;
+                check_dps310_raw_count++;
+            }
+        }
+    }
+}
+
+static double check_altitude(void) {
+    double max_error = 0.0;
+
+    for (int32_t temperature = -2000; temperature <= 5000; temperature += 500) {
+        for (int32_t pressure = (int32_t)CHECK_PRESSURE_MIN << VARIO_FIXED_PRESSURE_SHIFT; pressure <= (int32_t)CHECK_PRESSURE_MAX << VARIO_FIXED_PRESSURE_SHIFT; pressure += CHECK_ALTITUDE_PRESSURE_STEP) {
+            double reference = vario_pressure_to_altitude(temperature / 100.0, (double)pressure / (1 << VARIO_FIXED_PRESSURE_SHIFT));
+            double error = fabs(vario_pressure_to_altitude_fixed(temperature, pressure) / 1000.0 - reference);
+            max_error = fmax(max_error, error);
+        }
+    }
+
+    return max_error;
+}
+
+static double check_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Compensation plus altitude per sample, the firmware path of one barometer result */
+static void check_bench(qmp6988_device_t * qmp6988, dps310_device_t * dps310, uint32_t iterations) {
+    volatile double sink_double = 0.0;
+    volatile int32_t sink_fixed = 0;
+
+    double start = check_now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < check_qmp6988_raw_count; i++) {
+            double temperature;
+            double pressure;
+            qmp6988_compensate(qmp6988, check_qmp6988_raw[i][0], check_qmp6988_raw[i][1], &temperature, &pressure);
+            sink_double = vario_pressure_to_altitude(temperature, pressure);
+        }
+        for (uint32_t i = 0; i < check_dps310_raw_count; i++) {
+            double temperature;
+            double pressure;
+            dps310_compensate(dps310, check_dps310_raw[i][0], check_dps310_raw[i][1], &temperature, &pressure);
+            sink_double = vario_pressure_to_altitude(temperature, pressure);
+        }
+    }
+    double double_time = check_now() - start;
+
+    start = check_now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (uint32_t i = 0; i < check_qmp6988_raw_count; i++) {
+            int32_t temperature;
+            int32_t pressure;
+            qmp6988_compensate_fixed(qmp6988, check_qmp6988_raw[i][0], check_qmp6988_raw[i][1], &temperature, &pressure);
+            sink_fixed = vario_pressure_to_altitude_fixed(temperature, pressure);
+        }
+        for (uint32_t i = 0; i < check_dps310_raw_count; i++) {
+            int32_t temperature;
+            int32_t pressure;
+            dps310_compensate_fixed(dps310, check_dps310_raw[i][0], check_dps310_raw[i][1], &temperature, &pressure);
+            sink_fixed = vario_pressure_to_altitude_fixed(temperature, pressure);
+        }
+    }
+    double fixed_time = check_now() - start;
+
+    (void)sink_double;
+    (void)sink_fixed;
+
+    double samples = (double)(check_qmp6988_raw_count + check_dps310_raw_count) * iterations;
+    printf("double: %.1f ns/sample, fixed: %.1f ns/sample, ratio %.2f\n", double_time * 1e9 / samples, fixed_time * 1e9 / samples, double_time / fixed_time);
+}
+
+bool replay_check_compensation(uint32_t iterations) {
+    uint8_t data[QMP6988_COMPENSATION_COES_LENGTH];
+
+    i2c_replay_reset();
+
+    data[0] = QMP6988_CHIP_ID;
+    i2c_replay_set_registers(I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, QMP6988_REGISTER_CHIP_ID, data, 1);
+    memset(data, 0, sizeof(data));
+    i2c_replay_set_registers(I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, QMP6988_COMPENSATION_COES_START, data, QMP6988_COMPENSATION_COES_LENGTH);
+
+    data[0] = MEAS_CFG_COEF_RDY | MEAS_CFG_SENSOR_RDY | MEAS_CFG_TMP_RDY;
+    i2c_replay_set_registers(I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, DPS310_REG_MEAS_CFG, data, 1);
+    data[0] = CHIP_AND_REVISION_ID;
+    i2c_replay_set_registers(I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, DPS310_REG_PRO_ID, data, 1);
+    replay_encode_dps310_coefficients(check_dps310_coefficients, data);
+    i2c_replay_set_registers(I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, DPS310_REG_COEF_C0M, data, 18);
+
+    qmp6988_device_t * qmp6988 = qmp6988_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, QMP6988_I2C_ADDRESS_SDO_LOW);
+    dps310_device_t * dps310 = dps310_init_device(I2C_NUM_1, GPIO_NUM_21, GPIO_NUM_22, QMP6988_I2C_FAST_FREQUENCY, DPS310_I2C_SLAVE_ADDR);
+    if (qmp6988 == NULL || dps310 == NULL) {
+        fprintf(stderr, "firmware drivers rejected the check registers\n");
+        return false;
+    }
+
+    // First set is the nominal one, the others cover the whole OTP and a +-25% spread of the DPS310 coefficients
+    check_error_t qmp6988_error = { 0 };
+    check_error_t dps310_error = { 0 };
+    for (int set = 0; set < CHECK_COEFFICIENT_SETS; set++) {
+        if (set > 0) {
+            for (int i = 0; i < QMP6988_COMPENSATION_COES_LENGTH; i++) {
+                data[i] = check_random() & 0xff;
+            }
+            i2c_replay_set_registers(I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, QMP6988_COMPENSATION_COES_START, data, QMP6988_COMPENSATION_COES_LENGTH);
+            qmp6988_get_compensation_coefficients(qmp6988);
+
+            int32_t coefficients[9];
+            for (int i = 0; i < 9; i++) {
+                coefficients[i] = check_dps310_coefficients[i] * (75 + (int32_t)(check_random() % 51)) / 100;
+            }
+            replay_encode_dps310_coefficients(coefficients, data);
+            i2c_replay_set_registers(I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, DPS310_REG_COEF_C0M, data, 18);
+            dps310_get_compensation_coefficients(dps310);
+        }
+
+        check_qmp6988(qmp6988, &qmp6988_error);
+        check_dps310(dps310, &dps310_error);
+    }
+    double altitude_error = check_altitude();
+
+    printf("QMP6988: %u samples, max error %.4f Pa, %.4f C\n", qmp6988_error.samples, qmp6988_error.pressure, qmp6988_error.temperature);
+    printf("DPS310:  %u samples, max error %.4f Pa, %.4f C\n", dps310_error.samples, dps310_error.pressure, dps310_error.temperature);
+    printf("altitude table: max error %.4f m\n", altitude_error);
+
+    check_bench(qmp6988, dps310, iterations);
+
+    qmp6988_deinit_device(qmp6988);
+    dps310_deinit_device(dps310);
+
+    return qmp6988_error.pressure < CHECK_PRESSURE_LIMIT && dps310_error.pressure < CHECK_PRESSURE_LIMIT &&
+        qmp6988_error.temperature < CHECK_TEMPERATURE_LIMIT && dps310_error.temperature < CHECK_TEMPERATURE_LIMIT &&
+        altitude_error < CHECK_ALTITUDE_LIMIT;
+}
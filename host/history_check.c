@@ -0,0 +1,98 @@
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "history.h"
+#include "replay.h"
+
+/*
+    Flight history over a scripted twenty minute flight at the IMU rate, with one stalled estimator second.
+    Every sample must hold the rounded altitude of the input completing it and a speed within the inputs of its
+    period, the ring must return the last HISTORY_LENGTH - 1 samples and refuse older ones. Reports the cost of
+    one history_add, almost all of them only accumulate.
+*/
+
+#define HISTORY_CHECK_SECONDS           (1200)
+#define HISTORY_CHECK_PERIOD_US         (VARIO_MPU6886_PERIOD_MS * 1000)
+#define HISTORY_CHECK_STALL_US          (600 * 1000000LL)
+#define HISTORY_CHECK_STALL_LENGTH_US   (2500000)
+
+typedef struct {
+    int16_t altitude;
+    int16_t speed_min;
+    int16_t speed_max;
+} history_check_expected_t;
+
+static double history_check_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* Thermal circles, climb swinging with the turn on top of a slow climb, then a glide */
+static void history_check_flight(int64_t timestamp, float * altitude, int32_t * speed) {
+    double seconds = timestamp / 1e6;
+    double climb = (seconds < 900.0) ? 1.5 + 1.2 * sin(seconds * 2.0 * M_PI / 25.0) : -1.1;
+    *speed = (int32_t)lround(climb * 100.0);
+    *altitude = (float)(800.0 + ((seconds < 900.0) ? 1.5 * seconds - 1.2 * 25.0 / (2.0 * M_PI) * (cos(seconds * 2.0 * M_PI / 25.0) - 1.0)
+                                                   : 1350.0 - 1.1 * (seconds - 900.0)));
+}
+
+bool replay_check_history(void) {
+    uint32_t expected_count = 0;
+    history_check_expected_t * expected = calloc(HISTORY_CHECK_SECONDS + 1, sizeof(history_check_expected_t));
+    if (expected == NULL) {
+        return false;
+    }
+
+    int16_t speed_min = INT16_MAX;
+    int16_t speed_max = INT16_MIN;
+    uint32_t calls = 0;
+    double elapsed = 0.0;
+    for (int64_t timestamp = HISTORY_CHECK_PERIOD_US; timestamp <= HISTORY_CHECK_SECONDS * 1000000LL; timestamp += HISTORY_CHECK_PERIOD_US) {
+        if (timestamp > HISTORY_CHECK_STALL_US && timestamp < HISTORY_CHECK_STALL_US + HISTORY_CHECK_STALL_LENGTH_US) {
+            continue;
+        }
+
+        float altitude;
+        int32_t speed;
+        history_check_flight(timestamp, &altitude, &speed);
+        speed_min = (speed < speed_min) ? speed : speed_min;
+        speed_max = (speed > speed_max) ? speed : speed_max;
+
+        double start = history_check_now();
+        bool completed = history_add(timestamp, altitude, speed);
+        elapsed += history_check_now() - start;
+        calls += 1;
+
+        if (completed) {
+            expected[expected_count].altitude = (int16_t)lroundf(altitude);
+            expected[expected_count].speed_min = speed_min;
+            expected[expected_count].speed_max = speed_max;
+            expected_count += 1;
+            speed_min = INT16_MAX;
+            speed_max = INT16_MIN;
+        }
+    }
+
+    bool passed = (history_count() == expected_count);
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < expected_count; i++) {
+        history_sample_t sample;
+        bool readable = history_read(i, &sample);
+        if (readable != (expected_count - i < HISTORY_LENGTH)) {
+            mismatches += 1;
+        } else if (readable && (sample.altitude != expected[i].altitude || sample.speed < expected[i].speed_min || sample.speed > expected[i].speed_max)) {
+            mismatches += 1;
+        }
+    }
+    history_sample_t sample;
+    passed = passed && (mismatches == 0) && !history_read(expected_count, &sample);
+
+    printf("%u inputs, %u samples, %u expected, %u mismatches\n", calls, history_count(), expected_count, mismatches);
+    printf("%.1f ns per history_add, ring %u bytes\n", elapsed * 1e9 / calls, (unsigned)(HISTORY_LENGTH * sizeof(history_sample_t)));
+    printf("%s\n", passed ? "PASS" : "FAIL");
+
+    free(expected);
+    return passed;
+}
@@ -0,0 +1,274 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "i2c_replay.h"
+
+typedef struct {
+    uint8_t used;
+    i2c_port_t port;
+    uint8_t addr;
+    uint8_t registers[256];
+    uint8_t fifo_reg;
+    uint8_t fifo[I2C_REPLAY_FIFO_SIZE];
+    uint32_t fifo_head;
+    uint32_t fifo_count;
+} i2c_replay_device_t;
+
+typedef struct {
+    i2c_port_t port;
+    uint8_t addr;
+} i2c_replay_handle_t;
+
+static i2c_replay_device_t replay_devices[I2C_REPLAY_DEVICE_MAX];
+static i2c_replay_statistics_t replay_statistics;
+
+static i2c_replay_device_t * i2c_replay_find(i2c_port_t port, uint8_t addr) {
+    i2c_replay_device_t * free_slot = NULL;
+
+    for (int i = 0; i < I2C_REPLAY_DEVICE_MAX; i++) {
+        if (replay_devices[i].used) {
+            if (replay_devices[i].port == port && replay_devices[i].addr == addr) {
+                return &replay_devices[i];
+            }
+        } else if (free_slot == NULL) {
+            free_slot = &replay_devices[i];
+        }
+    }
+
+    if (free_slot != NULL) {
+        memset(free_slot, 0, sizeof(i2c_replay_device_t));
+        free_slot->used = 1;
+        free_slot->port = port;
+        free_slot->addr = addr;
+    }
+
+    return free_slot;
+}
+
+void i2c_replay_reset(void) {
+    memset(replay_devices, 0, sizeof(replay_devices));
+    memset(&replay_statistics, 0, sizeof(replay_statistics));
+}
+
+void i2c_replay_set_registers(i2c_port_t port, uint8_t addr, uint8_t reg, const uint8_t * data, uint32_t length) {
+    i2c_replay_device_t * device = i2c_replay_find(port, addr);
+    if (device == NULL) {
+        return;
+    }
+
+    for (uint32_t i = 0; i < length; i++) {
+        device->registers[(uint8_t)(reg + i)] = data[i];
+    }
+}
+
+void i2c_replay_push_fifo(i2c_port_t port, uint8_t addr, uint8_t reg, const uint8_t * data, uint32_t length) {
+    i2c_replay_device_t * device = i2c_replay_find(port, addr);
+    if (device == NULL) {
+        return;
+    }
+
+    device->fifo_reg = reg;
+    for (uint32_t i = 0; i < length && device->fifo_count < I2C_REPLAY_FIFO_SIZE; i++) {
+        device->fifo[(device->fifo_head + device->fifo_count) % I2C_REPLAY_FIFO_SIZE] = data[i];
+        device->fifo_count++;
+    }
+}
+
+void i2c_replay_get_statistics(i2c_replay_statistics_t * statistics) {
+    *statistics = replay_statistics;
+}
+
+static esp_err_t i2c_replay_read(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t * data, uint16_t length) {
+    if (i2c_device == NULL || (length > 0 && data == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    i2c_replay_handle_t * handle = (i2c_replay_handle_t *)i2c_device;
+    i2c_replay_device_t * device = i2c_replay_find(handle->port, handle->addr);
+    if (device == NULL) {
+        return ESP_FAIL;
+    }
+
+    uint8_t reg = reg_addr & 0xff;
+    uint16_t i = 0;
+    if (device->fifo_count > 0 && device->fifo_reg == reg) {
+        for ( ; i < length && device->fifo_count > 0; i++) {
+            data[i] = device->fifo[device->fifo_head];
+            device->fifo_head = (device->fifo_head + 1) % I2C_REPLAY_FIFO_SIZE;
+            device->fifo_count--;
+        }
+    }
+    for ( ; i < length; i++) {
+        data[i] = device->registers[(uint8_t)(reg + i)];
+    }
+
+    replay_statistics.reads++;
+    replay_statistics.read_bytes += length;
+
+    return ESP_OK;
+}
+
+I2CDevice_t i2c_malloc_device(i2c_port_t i2c_num, gpio_num_t sda, gpio_num_t scl, uint32_t freq, uint8_t device_addr) {
+    i2c_replay_handle_t * handle = malloc(sizeof(i2c_replay_handle_t));
+    if (handle != NULL) {
+        handle->port = i2c_num;
+        handle->addr = device_addr;
+    }
+
+    return handle;
+}
+
+void i2c_free_device(I2CDevice_t i2c_device) {
+    free(i2c_device);
+}
+
+esp_err_t i2c_apply_bus(I2CDevice_t i2c_device) {
+    return ESP_OK;
+}
+
+esp_err_t i2c_free_bus(I2CDevice_t i2c_device) {
+    return ESP_OK;
+}
+
+esp_err_t i2c_device_change_freq(I2CDevice_t i2c_device, uint32_t freq) {
+    return ESP_OK;
+}
+
+esp_err_t i2c_read_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
+    return i2c_replay_read(i2c_device, reg_addr, data, length);
+}
+
+esp_err_t i2c_read_bytes_no_stop(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
+    return i2c_replay_read(i2c_device, reg_addr, data, length);
+}
+
+esp_err_t i2c_read_bytes_repeated(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length, uint16_t count) {
+    if (length == 0 || count == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    for (uint16_t i = 0; i < count; i++) {
+        esp_err_t err = i2c_replay_read(i2c_device, reg_addr, data + i * length, length);
+        if (err != ESP_OK) {
+            return err;
+        }
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_read_byte(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t* data) {
+    return i2c_replay_read(i2c_device, reg_addr, data, 1);
+}
+
+esp_err_t i2c_read_bit(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint8_t bit_pos) {
+    uint8_t bit;
+    esp_err_t err = i2c_replay_read(i2c_device, reg_addr, &bit, 1);
+    if (err == ESP_OK) {
+        *data = (bit >> bit_pos) & 0x01;
+    }
+
+    return err;
+}
+
+esp_err_t i2c_read_bits(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint8_t bit_pos, uint8_t bit_length) {
+    if ((bit_pos + bit_length) > 8) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t bits;
+    esp_err_t err = i2c_replay_read(i2c_device, reg_addr, &bits, 1);
+    if (err == ESP_OK) {
+        bits >>= bit_pos;
+        bits &= ((1 << bit_length) - 1);
+        *data = bits;
+    }
+
+    return err;
+}
+
+esp_err_t i2c_write_bytes(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t *data, uint16_t length) {
+    if (i2c_device == NULL || (length > 0 && data == NULL)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    replay_statistics.writes++;
+
+    return ESP_OK;
+}
+
+esp_err_t i2c_write_byte(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data) {
+    return i2c_write_bytes(i2c_device, reg_addr, &data, 1);
+}
+
+esp_err_t i2c_write_bit(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data, uint8_t bit_pos) {
+    return i2c_write_bytes(i2c_device, reg_addr, &data, 1);
+}
+
+esp_err_t i2c_write_bits(I2CDevice_t i2c_device, uint32_t reg_addr, uint8_t data, uint8_t bit_pos, uint8_t bit_length) {
+    return i2c_write_bytes(i2c_device, reg_addr, &data, 1);
+}
+
+esp_err_t i2c_device_valid(I2CDevice_t i2c_device) {
+    return (i2c_device != NULL) ? ESP_OK : ESP_FAIL;
+}
+
+BaseType_t i2c_take_port(i2c_port_t i2c_num, uint32_t timeout) {
+    return pdTRUE;
+}
+
+BaseType_t i2c_free_port(i2c_port_t i2c_num) {
+    return pdTRUE;
+}
+
+void i2c_transaction_init(i2c_transaction_t * transaction, I2CDevice_t i2c_device, i2c_transaction_kind_t kind,
+                          uint32_t reg_addr, uint8_t * data, uint16_t length, uint16_t count) {
+    memset(transaction, 0, sizeof(*transaction));
+    transaction->device = i2c_device;
+    transaction->kind = kind;
+    transaction->reg_addr = reg_addr;
+    transaction->data = data;
+    transaction->length = length;
+    transaction->count = (kind == I2C_TRANSACTION_READ_REPEATED) ? count : 1;
+}
+
+/* No bus worker on the host, a submitted transaction runs and calls back before the submit returns */
+esp_err_t i2c_submit(i2c_transaction_t * transaction, i2c_transaction_cb_t callback, void * arg) {
+    if (transaction == NULL || transaction->device == NULL || callback == NULL) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    transaction->callback = callback;
+    transaction->arg = arg;
+    switch (transaction->kind) {
+    case I2C_TRANSACTION_READ:
+        transaction->result = i2c_replay_read(transaction->device, transaction->reg_addr, transaction->data, transaction->length);
+        break;
+    case I2C_TRANSACTION_READ_REPEATED:
+        transaction->result = i2c_read_bytes_repeated(transaction->device, transaction->reg_addr, transaction->data, transaction->length, transaction->count);
+        break;
+    case I2C_TRANSACTION_WRITE:
+        transaction->result = i2c_write_bytes(transaction->device, transaction->reg_addr, transaction->data, transaction->length);
+        break;
+    default:
+        transaction->result = ESP_OK;
+        break;
+    }
+
+    callback(transaction, transaction->result);
+    return ESP_OK;
+}
+
+/* The chain has ended by the time its first submit returns, the wait only hands back the result */
+void i2c_completion_init(i2c_completion_t * completion) {
+    completion->done = NULL;
+    completion->result = ESP_OK;
+}
+
+void i2c_completion_signal(i2c_completion_t * completion, esp_err_t result) {
+    completion->result = result;
+}
+
+esp_err_t i2c_completion_wait(i2c_completion_t * completion) {
+    return completion->result;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "i2c_device.h"
+
+/*
+    Host implementation of the i2c_device API. Every device on the bus is a register map fed from the
+    replayed capture, reads are served from it and writes are only counted, the capture already holds
+    whatever the real device answered after them. A register can additionally hold a FIFO, reads on it
+    pop the queued bytes first, the same way the DPS310 result registers behave with the FIFO enabled.
+*/
+
+#define I2C_REPLAY_DEVICE_MAX           (8)
+#define I2C_REPLAY_FIFO_SIZE            (4096)
+
+typedef struct {
+    uint32_t reads;
+    uint32_t writes;
+    uint32_t read_bytes;
+} i2c_replay_statistics_t;
+
+void i2c_replay_reset(void);
+void i2c_replay_set_registers(i2c_port_t port, uint8_t addr, uint8_t reg, const uint8_t * data, uint32_t length);
+void i2c_replay_push_fifo(i2c_port_t port, uint8_t addr, uint8_t reg, const uint8_t * data, uint32_t length);
+void i2c_replay_get_statistics(i2c_replay_statistics_t * statistics);
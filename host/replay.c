@@ -0,0 +1,435 @@
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "core2forAWS.h"
+#include "config.h"
+#include "i2c_replay.h"
+#include "replay.h"
+#include "vario_sample.h"
+
+#define REPLAY_LINE_MAX                 (1024)
+#define REPLAY_ALTITUDE_QUEUE_LENGTH    (DPS310_FIFO_DEPTH * 2)
+
+static bool replay_append(void ** array, uint32_t * count, uint32_t * capacity, size_t size, const void * item) {
+    if (*count >= *capacity) {
+        uint32_t new_capacity = (*capacity == 0) ? 1024 : *capacity * 2;
+        void * new_array = realloc(*array, new_capacity * size);
+        if (new_array == NULL) {
+            return false;
+        }
+        *array = new_array;
+        *capacity = new_capacity;
+    }
+
+    memcpy((uint8_t *)(*array) + (*count) * size, item, size);
+    *count += 1;
+
+    return true;
+}
+
+bool replay_load_dump(const char * path, replay_dump_t * dump) {
+    FILE * file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "can not open dump %s\n", path);
+        return false;
+    }
+
+    memset(dump, 0, sizeof(replay_dump_t));
+    uint32_t record_capacity = 0;
+    uint32_t step_capacity = 0;
+
+    char line[REPLAY_LINE_MAX];
+    uint32_t line_number = 0;
+    bool result = true;
+
+    while (result && fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+
+        if (line[0] == '#') {
+            replay_step_t step;
+            if (sscanf(line, "# step %" SCNd64 " %" SCNd32, &step.timestamp, &step.speed) == 2) {
+                result = replay_append((void **)&dump->steps, &dump->step_count, &step_capacity, sizeof(replay_step_t), &step);
+            }
+            continue;
+        }
+
+        replay_record_t record;
+        unsigned int port, addr, reg;
+        char operation;
+        int consumed = 0;
+        if (sscanf(line, "%" SCNd64 " %u %x %c %x%n", &record.timestamp, &port, &addr, &operation, &reg, &consumed) != 5) {
+            continue;
+        }
+
+        record.port = port;
+        record.addr = addr;
+        record.operation = operation;
+        record.reg = reg;
+        record.length = 0;
+
+        char * cursor = line + consumed;
+        unsigned int byte;
+        int byte_consumed;
+        while (record.length < REPLAY_RECORD_DATA_MAX && sscanf(cursor, "%x%n", &byte, &byte_consumed) == 1) {
+            record.data[record.length++] = byte;
+            cursor += byte_consumed;
+        }
+
+        if (operation != REPLAY_OPERATION_READ && operation != REPLAY_OPERATION_FIFO) {
+            fprintf(stderr, "%s:%u: unknown operation '%c'\n", path, line_number, operation);
+            continue;
+        }
+
+        result = replay_append((void **)&dump->records, &dump->record_count, &record_capacity, sizeof(replay_record_t), &record);
+    }
+
+    fclose(file);
+
+    if (!result) {
+        fprintf(stderr, "out of memory loading %s\n", path);
+        replay_free_dump(dump);
+    }
+
+    return result;
+}
+
+void replay_free_dump(replay_dump_t * dump) {
+    free(dump->records);
+    free(dump->steps);
+    memset(dump, 0, sizeof(replay_dump_t));
+}
+
+bool replay_write_record(FILE * file, const replay_record_t * record) {
+    fprintf(file, "%" PRId64 " %u %02x %c %02x", record->timestamp, record->port, record->addr, record->operation, record->reg);
+    for (uint16_t i = 0; i < record->length; i++) {
+        fprintf(file, " %02x", record->data[i]);
+    }
+    return fprintf(file, "\n") > 0;
+}
+
+/* The legacy estimator always works on doubles of the unadjusted results */
+#ifdef CONFIG_BARO_FIXED_POINT_COMPENSATION
+#define replay_temperature(temperature)         ((double)(temperature) / 100.0)
+#define replay_pressure(pressure)               ((double)(pressure) / (1 << VARIO_FIXED_PRESSURE_SHIFT))
+#else
+#define replay_temperature(temperature)         (temperature)
+#define replay_pressure(pressure)               (pressure)
+#endif
+
+/*
+    The estimator used before the Kalman filter: moving average of the altitude and a finite difference over
+    an integer averaged sample interval. Kept as the reference the latency evaluation compares against. Each
+    sensor has its own, the two barometers read different absolute altitudes and a shared average mixes them.
+*/
+typedef struct {
+    fir_filter_t * filter;
+    int32_t speed;
+    uint32_t last_timestamp;
+    int32_t last_average_delta_time;
+    double last_average_altitude;
+} replay_legacy_state_t;
+
+typedef struct {
+    qmp6988_device_t * qmp6988;
+    dps310_device_t * dps310;
+    bool mpu6886_ready;
+    vario_qmp6988_poll_t qmp6988_poll;
+    int32_t temperature_adjustment;
+
+    replay_timing_t timing;
+    vario_sample_clock_t qmp6988_clock;
+    vario_sample_clock_t dps310_clock;
+    vario_imu_clock_t imu_clock;
+
+    kalman_filter_t * kalman;
+    vario_baro_fusion_t baro_fusion;
+    ahrs_t ahrs;
+    vario_altitude_sample_t altitudes[REPLAY_ALTITUDE_QUEUE_LENGTH];
+    uint32_t altitude_count;
+
+    vario_tone_config_t tone_config;
+    vario_tone_t tone;
+
+    replay_legacy_state_t legacy_qmp6988;
+    replay_legacy_state_t legacy_dps310;
+
+    replay_statistics_t statistics;
+} replay_state_t;
+
+void replay_load_tone_config(vario_tone_config_t * tone_config) {
+    tone_config->lift_freq_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_MINIMUM);
+    tone_config->lift_freq_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_MAXIMUM);
+    tone_config->lift_freq_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_FACTOR);
+    tone_config->lift_cycle_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_MINIMUM);
+    tone_config->lift_cycle_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_MAXIMUM);
+    tone_config->lift_cycle_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_FACTOR);
+    tone_config->lift_duty_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_MINMUM);
+    tone_config->lift_duty_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_MAXMUM);
+    tone_config->lift_duty_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_FACTOR);
+    tone_config->sink_freq_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_MINIMUM);
+    tone_config->sink_freq_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_MAXIMUM);
+    tone_config->sink_freq_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_FACTOR);
+    tone_config->sink_diff_percent = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_DUAL_TONE_FACTOR);
+    tone_config->lift_start = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_LIFT_START_SPEED);
+    tone_config->lift_stop = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_LIFT_STOP_SPEED);
+    tone_config->sink_start = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_SINK_START_SPEED);
+    tone_config->sink_stop = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_SINK_STOP_SPEED);
+}
+
+static void replay_legacy_update(replay_legacy_state_t * legacy, uint32_t timestamp, double temperature, double pressure) {
+    int32_t time_window = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW);
+
+    uint32_t current_delta_time = timestamp - legacy->last_timestamp;
+    int32_t average_delta_time = legacy->last_average_delta_time * (time_window - 1) / time_window + current_delta_time / time_window;
+
+    double current_altitude = 100000.0 * vario_pressure_to_altitude(temperature, pressure);
+    double average_altitude = fir_filter_process(legacy->filter, current_altitude);
+
+    legacy->speed = (average_altitude - legacy->last_average_altitude) / (double)average_delta_time;
+
+    legacy->last_timestamp = timestamp;
+    legacy->last_average_delta_time = average_delta_time;
+    legacy->last_average_altitude = average_altitude;
+}
+
+/* Date of a sample read at read_time, the sample clock is only used with REPLAY_TIMING_DATA_READY */
+static int64_t replay_stamp(const replay_state_t * state, vario_sample_clock_t * sample_clock, int64_t read_time) {
+    switch (state->timing) {
+        case REPLAY_TIMING_TICKS: return read_time - read_time % (portTICK_PERIOD_MS * 1000);
+        case REPLAY_TIMING_READ: return read_time;
+        default: return vario_sample_clock_stamp(sample_clock, read_time);
+    }
+}
+
+/* Stands for vario_process_pressure, the altitude queue is a plain array here */
+static void replay_push_altitude(replay_state_t * state, vario_baro_sensor_t sensor, int64_t timestamp, vario_baro_value_t temperature, vario_baro_value_t pressure) {
+    if (state->altitude_count < REPLAY_ALTITUDE_QUEUE_LENGTH) {
+        vario_altitude_sample_init(&state->altitudes[state->altitude_count++], sensor, timestamp, temperature, pressure, state->temperature_adjustment);
+    }
+    state->statistics.baro_samples++;
+}
+
+static void replay_qmp6988(replay_state_t * state, const replay_record_t * record) {
+    if (state->qmp6988 == NULL) {
+        state->qmp6988 = qmp6988_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, QMP6988_I2C_ADDRESS_SDO_LOW);
+        if (state->qmp6988 == NULL) {
+            return;
+        }
+        vario_sample_clock_init(&state->qmp6988_clock, qmp6988_get_measurement_period(state->qmp6988));
+        vario_qmp6988_poll_init(&state->qmp6988_poll, qmp6988_get_measurement_period(state->qmp6988));
+    }
+
+    vario_baro_value_t temperature;
+    vario_baro_value_t pressure;
+    if (ESP_OK != vario_qmp6988_fetch_result(state->qmp6988, &temperature, &pressure)) {
+        return;
+    }
+
+    // The firmware reads again one tick later or at the next deadline, that read is the next record of the capture
+    if (vario_qmp6988_poll(&state->qmp6988_poll, record->timestamp, temperature, pressure) != VARIO_QMP6988_FRESH) {
+        return;
+    }
+
+    int64_t timestamp = replay_stamp(state, &state->qmp6988_clock, record->timestamp);
+    replay_push_altitude(state, VARIO_BARO_QMP6988, timestamp, temperature, pressure);
+    replay_legacy_update(&state->legacy_qmp6988, timestamp / 1000, replay_temperature(temperature), replay_pressure(pressure));
+}
+
+/* One FIFO drain may take several bursts, it is complete once a burst returns the empty marker */
+static bool replay_dps310_drained(const replay_record_t * record) {
+    for (uint32_t i = 0; i + DPS310_FIFO_ENTRY_LENGTH <= record->length; i += DPS310_FIFO_ENTRY_LENGTH) {
+        uint32_t value = (record->data[i] << 16) | (record->data[i + 1] << 8) | record->data[i + 2];
+        if (value == DPS310_FIFO_EMPTY) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static void replay_dps310(replay_state_t * state, const replay_record_t * record) {
+    if (state->dps310 == NULL) {
+        state->dps310 = dps310_init_device(I2C_NUM_1, GPIO_NUM_21, GPIO_NUM_22, QMP6988_I2C_FAST_FREQUENCY, DPS310_I2C_SLAVE_ADDR);
+        if (state->dps310 == NULL) {
+            return;
+        }
+        dps310_start_fifo_measure(state->dps310, VARIO_DPS310_FIFO_READ_PERIOD_MS);
+        vario_sample_clock_init(&state->dps310_clock, 1000000 / state->dps310->pressure_rate);
+    }
+
+    vario_dps310_result_t results[DPS310_FIFO_DEPTH];
+    uint32_t count = 0;
+    if (ESP_OK != vario_dps310_fetch_fifo(state->dps310, results, DPS310_FIFO_DEPTH, &count)) {
+        return;
+    }
+
+    // The firmware dates the entries with the sample clock, the other timings back date them on the nominal period
+    int64_t timestamps[DPS310_FIFO_DEPTH];
+    if (state->timing == REPLAY_TIMING_DATA_READY) {
+        vario_dps310_stamp_entries(&state->dps310_clock, record->timestamp, count, timestamps);
+    } else {
+        int64_t drain_time = replay_stamp(state, NULL, record->timestamp);
+        for (uint32_t i = 0; i < count; i++) {
+            timestamps[i] = drain_time - (count - 1 - i) * (1000000 / state->dps310->pressure_rate);
+        }
+    }
+
+    for (uint32_t i = 0; i < count; i++) {
+        replay_push_altitude(state, VARIO_BARO_DPS310, timestamps[i], results[i].temperature, results[i].pressure);
+        replay_legacy_update(&state->legacy_dps310, timestamps[i] / 1000, replay_temperature(results[i].temperature), replay_pressure(results[i].pressure));
+    }
+}
+
+static void replay_mpu6886_init(replay_state_t * state, const replay_record_t * record, bool streaming) {
+    if (!state->mpu6886_ready) {
+        MPU6886_Init();
+        if (streaming) {
+            MPU6886_StartStream(VARIO_MPU6886_ODR_HZ, VARIO_MPU6886_BATCH_FRAMES);
+        }
+        vario_imu_clock_init(&state->imu_clock, streaming ? MPU6886_GetStreamPeriod() : VARIO_MPU6886_PERIOD_MS * 1000, record->timestamp);
+        state->mpu6886_ready = true;
+    }
+}
+
+/* The firmware timing runs the frame through the loop's own update, the other timings space frames one period apart */
+static void replay_imu_frame(replay_state_t * state, const mpu6886_frame_t * frame, float period) {
+    if (state->timing == REPLAY_TIMING_DATA_READY) {
+        vario_imu_frame_update(&state->imu_clock, &state->ahrs, state->kalman, frame);
+    } else {
+        float accel[3];
+        float gyro[3];
+        MPU6886_GetFrameData(frame, accel, gyro);
+        vario_imu_update(&state->ahrs, state->kalman, accel, gyro, period);
+    }
+    state->statistics.imu_samples++;
+}
+
+/* Estimator time of a period, the date of its last frame with the firmware timing */
+static int64_t replay_imu_now(const replay_state_t * state, const replay_record_t * record) {
+    switch (state->timing) {
+        case REPLAY_TIMING_TICKS: return replay_stamp(state, NULL, record->timestamp);
+        case REPLAY_TIMING_READ: return record->timestamp;
+        default: return state->imu_clock.last_timestamp;
+    }
+}
+
+/* Barometer samples queued since the last period are applied and the period's output is published */
+static void replay_imu_publish(replay_state_t * state, const replay_record_t * record, int64_t now, replay_output_callback_t callback, void * context) {
+    for (uint32_t i = 0; i < state->altitude_count; i++) {
+        vario_altitude_sample_apply(&state->altitudes[i], &state->baro_fusion, state->kalman, now);
+    }
+    state->altitude_count = 0;
+
+    replay_output_t output;
+    output.timestamp = record->timestamp;
+    output.altitude = state->kalman->altitude;
+    output.speed = (int32_t)(state->kalman->velocity * 100.0f);
+    // A single sensor baseline, the DPS310 is the quieter barometer and the QMP6988 stands in for captures without it
+    output.legacy_speed = (state->dps310 != NULL) ? state->legacy_dps310.speed : state->legacy_qmp6988.speed;
+
+    vario_tone_update(&state->tone_config, output.speed, &state->tone);
+    output.tone = state->tone;
+
+    state->statistics.outputs++;
+    if (callback != NULL) {
+        callback(context, &output);
+    }
+}
+
+/* Mirrors one period of vario_mpu6886_loop in captures of single register reads */
+static void replay_mpu6886(replay_state_t * state, const replay_record_t * record, replay_output_callback_t callback, void * context) {
+    replay_mpu6886_init(state, record, false);
+
+    // Same frame as vario_mpu6886_read_single, dated at the read
+    mpu6886_frame_t frame;
+    frame.timestamp = record->timestamp;
+    MPU6886_GetAccelAdc(&frame.accel[0], &frame.accel[1], &frame.accel[2]);
+    MPU6886_GetGyroAdc(&frame.gyro[0], &frame.gyro[1], &frame.gyro[2]);
+    replay_imu_frame(state, &frame, VARIO_MPU6886_PERIOD_MS / 1000.0f);
+
+    replay_imu_publish(state, record, replay_imu_now(state, record), callback, context);
+}
+
+/* Mirrors one batch of vario_mpu6886_loop in captures of the FIFO stream */
+static void replay_mpu6886_stream(replay_state_t * state, const replay_record_t * record, replay_output_callback_t callback, void * context) {
+    replay_mpu6886_init(state, record, true);
+
+    mpu6886_frame_t frames[MPU6886_FIFO_FRAMES_MAX];
+    int count = MPU6886_ReadStream(frames, MPU6886_FIFO_FRAMES_MAX);
+    for (int i = 0; i < count; i++) {
+        replay_imu_frame(state, &frames[i], MPU6886_GetStreamPeriod() / 1000000.0f);
+    }
+
+    replay_imu_publish(state, record, replay_imu_now(state, record), callback, context);
+}
+
+bool replay_run(const replay_dump_t * dump, replay_timing_t timing, replay_output_callback_t callback, void * context, replay_statistics_t * statistics) {
+    replay_state_t state;
+    memset(&state, 0, sizeof(state));
+    state.timing = timing;
+
+    i2c_replay_reset();
+    config_load_all_namespace();
+
+    int32_t accel_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ACCEL_NOISE);
+    int32_t bias_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_BIAS_NOISE);
+    int32_t altitude_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_NOISE);
+    state.kalman = init_kalman_filter(accel_noise / 1000.0f, bias_noise / 1000.0f, altitude_noise / 100.0f);
+    vario_baro_fusion_init(&state.baro_fusion, altitude_noise / 100.0f);
+    state.temperature_adjustment = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_TEMPERATURE_ADJUSTMENT);
+    state.legacy_qmp6988.filter = init_fir_filter(config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW), 0);
+    state.legacy_dps310.filter = init_fir_filter(config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW), 0);
+    state.legacy_qmp6988.last_average_delta_time = 80;
+    state.legacy_dps310.last_average_delta_time = 125;
+    ahrs_init(&state.ahrs);
+    state.tone.status = VARIO_STATUS_GLIDING;
+    replay_load_tone_config(&state.tone_config);
+
+    if (state.kalman == NULL || state.legacy_qmp6988.filter == NULL || state.legacy_dps310.filter == NULL) {
+        deinit_kalman_filter(state.kalman);
+        deinit_fir_filter(state.legacy_qmp6988.filter);
+        deinit_fir_filter(state.legacy_dps310.filter);
+        return false;
+    }
+
+    for (uint32_t i = 0; i < dump->record_count; i++) {
+        const replay_record_t * record = &dump->records[i];
+        host_set_time_us(record->timestamp);
+
+        if (record->operation == REPLAY_OPERATION_FIFO) {
+            i2c_replay_push_fifo(record->port, record->addr, record->reg, record->data, record->length);
+        } else {
+            i2c_replay_set_registers(record->port, record->addr, record->reg, record->data, record->length);
+        }
+
+        // Each periodic read of the firmware tasks triggers the same processing here
+        if (record->port == I2C_NUM_0 && record->addr == QMP6988_I2C_ADDRESS_SDO_LOW && record->reg == QMP6988_REGISTER_RESULT_START) {
+            replay_qmp6988(&state, record);
+        } else if (record->port == I2C_NUM_1 && record->addr == DPS310_I2C_SLAVE_ADDR && record->operation == REPLAY_OPERATION_FIFO) {
+            if (replay_dps310_drained(record)) {
+                replay_dps310(&state, record);
+            }
+        } else if (record->port == I2C_NUM_1 && record->addr == MPU6886_ADDRESS && record->reg == MPU6886_GYRO_XOUT_H) {
+            replay_mpu6886(&state, record, callback, context);
+        } else if (record->port == I2C_NUM_1 && record->addr == MPU6886_ADDRESS && record->operation == REPLAY_OPERATION_FIFO) {
+            replay_mpu6886_stream(&state, record, callback, context);
+        }
+    }
+
+    if (statistics != NULL) {
+        *statistics = state.statistics;
+    }
+
+    if (state.qmp6988 != NULL) {
+        qmp6988_deinit_device(state.qmp6988);
+    }
+    if (state.dps310 != NULL) {
+        dps310_deinit_device(state.dps310);
+    }
+    deinit_kalman_filter(state.kalman);
+    deinit_fir_filter(state.legacy_qmp6988.filter);
+    deinit_fir_filter(state.legacy_dps310.filter);
+
+    return true;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "qmp6988.h"
+#include "dps310.h"
+#include "fir_filter.h"
+#include "kalman_filter.h"
+#include "vario_signal.h"
+#include "ahrs.h"
+
+/*
+    One captured register read, as printed by i2c_device.c with CONFIG_I2C_DEVICE_REPLAY_RECORD:
+    <timestamp us> <port> <address> <r|f> <register> <bytes...>
+    Lines starting with '#' are comments, "# step <timestamp us> <speed cm/s>" marks a reference step of the
+    true vertical speed, used by the latency evaluation.
+*/
+#define REPLAY_RECORD_DATA_MAX          (128)
+#define REPLAY_OPERATION_READ           ('r')
+#define REPLAY_OPERATION_FIFO           ('f')
+
+typedef struct {
+    int64_t timestamp;
+    uint8_t port;
+    uint8_t addr;
+    uint8_t operation;
+    uint8_t reg;
+    uint16_t length;
+    uint8_t data[REPLAY_RECORD_DATA_MAX];
+} replay_record_t;
+
+typedef struct {
+    int64_t timestamp;
+    int32_t speed;
+} replay_step_t;
+
+typedef struct {
+    replay_record_t * records;
+    uint32_t record_count;
+    replay_step_t * steps;
+    uint32_t step_count;
+} replay_dump_t;
+
+bool replay_load_dump(const char * path, replay_dump_t * dump);
+void replay_free_dump(replay_dump_t * dump);
+bool replay_write_record(FILE * file, const replay_record_t * record);
+
+/* One row per IMU period, what the firmware would publish at that moment */
+typedef struct {
+    int64_t timestamp;
+    float altitude;
+    int32_t speed;
+    int32_t legacy_speed;
+    vario_tone_t tone;
+} replay_output_t;
+
+typedef void (*replay_output_callback_t)(void * context, const replay_output_t * output);
+
+typedef struct {
+    uint32_t baro_samples;
+    uint32_t imu_samples;
+    uint32_t outputs;
+} replay_statistics_t;
+
+/* How the replay dates samples, the firmware works as REPLAY_TIMING_DATA_READY, the others are for comparison */
+typedef enum {
+    REPLAY_TIMING_TICKS,        /* constant IMU period, barometer samples dated by the tick of their read */
+    REPLAY_TIMING_READ,         /* constant IMU period, barometer samples dated in us at their read */
+    REPLAY_TIMING_DATA_READY,   /* measured IMU intervals, barometer samples dated at data ready by a sample clock */
+} replay_timing_t;
+
+bool replay_run(const replay_dump_t * dump, replay_timing_t timing, replay_output_callback_t callback, void * context, replay_statistics_t * statistics);
+void replay_load_tone_config(vario_tone_config_t * tone_config);
+
+bool replay_synthesize_step_climb(const char * path);
+void replay_encode_dps310_coefficients(const int32_t * coefficients, uint8_t * data);
+
+/* Fixed point barometer compensation and altitude table against the double reference, plus their cost */
+bool replay_check_compensation(uint32_t iterations);
+
+/* Telemetry seqlock against the former mutex per field, fails on a torn snapshot */
+bool replay_benchmark_telemetry(uint32_t iterations);
+
+/* Streaming tone synthesizer response, click and cost over a scripted flight, raw s16 mono pcm optional */
+bool replay_check_tone(const char * pcm_path);
+
+/* Flight history ring over a scripted flight, decimation, overwrite and append cost */
+bool replay_check_history(void);
+
+/* Attitude against the truth of a scripted flight through the sensor scales, plus its cost per sample */
+bool replay_check_attitude(uint32_t iterations);
+
+/* Boot stages of several producer tasks through the firmware boot.c, fails when a failed bring up leaves one waiting */
+bool replay_check_boot(void);
@@ -0,0 +1,134 @@
+#include "core2forAWS.h"
+#include "esp_heap_caps.h"
+#include "esp_spiffs.h"
+#include "esp_timer.h"
+#include "nvs_flash.h"
+#include "screen_host.h"
+
+/* Board side of the UI on the host, the benchmark scripts the buttons, the clock and the battery */
+
+#define SCREEN_HOST_LOGO_SIZE           (64)
+
+SemaphoreHandle_t xGuiSemaphore = NULL;
+
+static Button_t screen_host_buttons[SCREEN_HOST_BUTTON_COUNT];
+Button_t * button_left = &screen_host_buttons[SCREEN_HOST_BUTTON_LEFT];
+Button_t * button_middle = &screen_host_buttons[SCREEN_HOST_BUTTON_MIDDLE];
+Button_t * button_right = &screen_host_buttons[SCREEN_HOST_BUTTON_RIGHT];
+
+static uint8_t screen_host_brightness = 0;
+static bool screen_host_sleeping = false;
+
+/* The logo image is not part of the tree, a plain square of its format stands in */
+static lv_color_t screen_host_logo_map[SCREEN_HOST_LOGO_SIZE * SCREEN_HOST_LOGO_SIZE];
+const lv_img_dsc_t paragliding_logo = {
+    .header.always_zero = 0,
+    .header.w = SCREEN_HOST_LOGO_SIZE,
+    .header.h = SCREEN_HOST_LOGO_SIZE,
+    .header.cf = LV_IMG_CF_TRUE_COLOR,
+    .data_size = sizeof(screen_host_logo_map),
+    .data = (const uint8_t *)screen_host_logo_map,
+};
+
+/* The screen only logs differences, LVGL memory is measured by the benchmark through lv_mem_monitor */
+size_t heap_caps_get_free_size(uint32_t caps) {
+    (void)caps;
+    return 0;
+}
+
+esp_err_t nvs_flash_erase(void) {
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_spiffs_register(const esp_vfs_spiffs_conf_t * conf) {
+    (void)conf;
+    return ESP_OK;
+}
+
+void Core2ForAWS_Display_SetBrightness(uint8_t brightness) {
+    screen_host_brightness = brightness;
+}
+
+void Core2ForAWS_Display_Sleep(bool sleep) {
+    screen_host_sleeping = sleep;
+}
+
+void Core2ForAWS_Motor_SetStrength(uint8_t strength) {
+    (void)strength;
+}
+
+float Core2ForAWS_PMU_GetBatVolt(void) {
+    return 3.9f;
+}
+
+float Core2ForAWS_PMU_GetBatCurrent(void) {
+    return -120.0f;
+}
+
+void Axp192_PowerOff() {
+}
+
+/* Only the reset tab restarts, the benchmark never presses it */
+void esp_restart(void) {
+    fprintf(stderr, "esp_restart\n");
+    abort();
+}
+
+bool FT6336U_WasPressed(void) {
+    return false;
+}
+
+/* The clock follows replay time from midnight */
+void BM8563_GetTime(rtc_date_t * data) {
+    int64_t seconds = host_get_time_us() / 1000000;
+    data->year = 2021;
+    data->month = 6;
+    data->day = 1;
+    data->hour = (uint8_t)(seconds / 3600 % 24);
+    data->minute = (uint8_t)(seconds / 60 % 60);
+    data->second = (uint8_t)(seconds % 60);
+}
+
+void BM8563_SetTime(rtc_date_t * data) {
+    (void)data;
+}
+
+void Button_SetNotify(TaskHandle_t task, uint32_t notify_bits) {
+    (void)task;
+    (void)notify_bits;
+}
+
+/* A scripted press is a complete short press, released before the UI task looks at it */
+void screen_host_press(screen_host_button_t button) {
+    screen_host_buttons[button].state = SCREEN_HOST_PRESSED;
+}
+
+uint8_t Button_WasPressed(Button_t * button) {
+    uint8_t pressed = (button->state == SCREEN_HOST_PRESSED);
+    button->state = 0;
+    return pressed;
+}
+
+uint8_t Button_WasReleased(Button_t * button) {
+    (void)button;
+    return 0;
+}
+
+uint8_t Button_IsPress(Button_t * button) {
+    (void)button;
+    return 0;
+}
+
+uint8_t Button_IsRelease(Button_t * button) {
+    (void)button;
+    return 1;
+}
+
+uint8_t Button_WasLongPress(Button_t * button) {
+    (void)button;
+    return 0;
+}
+
+uint8_t screen_host_get_brightness(void) {
+    return screen_host_sleeping ? 0 : screen_host_brightness;
+}
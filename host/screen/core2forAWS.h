@@ -0,0 +1,24 @@
+#pragma once
+
+/* Host stand-in for the board support header of the screen benchmark, the signal chain one plus LVGL and the UI side of the board */
+
+#include "../stubs/core2forAWS.h"
+
+#include "lvgl/lvgl.h"
+#include "axp192.h"
+#include "bm8563.h"
+#include "button.h"
+
+extern SemaphoreHandle_t xGuiSemaphore;
+
+void Core2ForAWS_Display_SetBrightness(uint8_t brightness);
+void Core2ForAWS_Display_Sleep(bool sleep);
+void Core2ForAWS_Motor_SetStrength(uint8_t strength);
+float Core2ForAWS_PMU_GetBatVolt(void);
+float Core2ForAWS_PMU_GetBatCurrent(void);
+bool FT6336U_WasPressed(void);
+void esp_restart(void);
+
+extern Button_t * button_left;
+extern Button_t * button_middle;
+extern Button_t * button_right;
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MALLOC_CAP_DEFAULT              (1 << 12)
+
+/* Not measured on the host, see board.c */
+size_t heap_caps_get_free_size(uint32_t caps);
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Controls of the board stand-ins in board.c, for the screen benchmark */
+typedef enum {
+    SCREEN_HOST_BUTTON_LEFT,
+    SCREEN_HOST_BUTTON_MIDDLE,
+    SCREEN_HOST_BUTTON_RIGHT,
+    SCREEN_HOST_BUTTON_COUNT,
+} screen_host_button_t;
+
+#define SCREEN_HOST_PRESSED             (1)
+
+void screen_host_press(screen_host_button_t button);
+/* Backlight as the UI left it, 0 while the panel sleeps */
+uint8_t screen_host_get_brightness(void);
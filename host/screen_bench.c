@@ -0,0 +1,425 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core2forAWS.h"
+#include "config.h"
+#include "font_loader.h"
+#include "history.h"
+#include "screen.h"
+#include "screen_host.h"
+#include "telemetry.h"
+
+/*
+    Host benchmark of the real screens. LVGL renders into an in-memory frame buffer through a display driver with
+    the stripe buffers of the device, the splash and screen_init build both screens and start ui_loop as a thread. A synthetic
+    flight drives them the way the sensor tasks do, while a script swipes through the main tabs and opens the
+    settings. Time is simulated in estimator periods, LVGL runs once the UI task has handled a period's events.
+    Frame time is host CPU time, only comparable between runs on the same machine; refreshed area and LVGL heap
+    are exact.
+    screen_bench [csv]          one csv row per frame into csv
+*/
+
+/* Cadence of the firmware producers */
+#define SCREEN_BENCH_STEP_US            (10 * 1000)         /* estimator, VARIO_MPU6886_PERIOD_MS */
+#define SCREEN_BENCH_SPEED_STEP         (10)                /* VARIO_UI_SPEED_STEP */
+#define SCREEN_BENCH_ATTITUDE_STEP      (1)                 /* VARIO_UI_ATTITUDE_STEP */
+#define SCREEN_BENCH_HUMIDITY_US        (2 * 1000000)
+#define SCREEN_BENCH_CLOCK_US           (500 * 1000)        /* UI_CLOCK_PERIOD_MS */
+#define SCREEN_BENCH_BATTERY_PERIODS    (4)                 /* UI_BATTERY_PERIODS */
+
+#define SCREEN_BENCH_WIDTH              (LV_HOR_RES_MAX)
+#define SCREEN_BENCH_HEIGHT             (LV_VER_RES_MAX)
+/* DISP_BUF_SIZE of the device, two stripes of 32 lines */
+#define SCREEN_BENCH_BUFFER_SIZE        (LV_HOR_RES_MAX * 32)
+
+#define SCREEN_BENCH_SWIPE_US           (300 * 1000)
+#define SCREEN_BENCH_SWIPE_FROM         (280)
+#define SCREEN_BENCH_SWIPE_TO           (40)
+#define SCREEN_BENCH_SWIPE_Y            (120)
+
+typedef enum {
+    SCREEN_BENCH_STAY,
+    SCREEN_BENCH_SWIPE,
+    SCREEN_BENCH_BUTTON,
+} screen_bench_action_t;
+
+typedef struct {
+    const char * name;
+    screen_bench_action_t action;
+    uint32_t seconds;
+    const char * tab;       /* shown at the end of the phase */
+} screen_bench_phase_t;
+
+static const screen_bench_phase_t screen_bench_phases[] = {
+    {"dashboard",   SCREEN_BENCH_STAY,      30,     DASHBOARD_TAB_NAME},
+    {"history",     SCREEN_BENCH_SWIPE,     15,     HISTORY_TAB_NAME},
+    {"motion",      SCREEN_BENCH_SWIPE,     5,      MOTION_TAB_NAME},
+    {"compass",     SCREEN_BENCH_SWIPE,     15,     COMPASS_TAB_NAME},
+    {"settings",    SCREEN_BENCH_BUTTON,    10,     "clock"},
+    {"return",      SCREEN_BENCH_BUTTON,    5,      COMPASS_TAB_NAME},
+};
+
+#define SCREEN_BENCH_PHASE_COUNT        (sizeof(screen_bench_phases) / sizeof(screen_bench_phases[0]))
+
+typedef struct {
+    int64_t timestamp;
+    uint32_t phase;
+    uint32_t render_us;
+    uint32_t area;          /* pixels refreshed */
+    uint32_t flushes;
+    uint32_t heap_used;
+} screen_bench_frame_t;
+
+typedef struct {
+    screen_bench_frame_t * frames;
+    uint32_t count;
+    uint32_t capacity;
+} screen_bench_frames_t;
+
+static lv_color_t screen_bench_framebuffer[SCREEN_BENCH_WIDTH * SCREEN_BENCH_HEIGHT];
+static lv_color_t screen_bench_buffer_1[SCREEN_BENCH_BUFFER_SIZE];
+static lv_color_t screen_bench_buffer_2[SCREEN_BENCH_BUFFER_SIZE];
+
+/* Written by the display and input callbacks, all of them run inside lv_task_handler on the harness thread */
+static bool screen_bench_refreshed = false;
+static uint32_t screen_bench_area = 0;
+static uint32_t screen_bench_flushes = 0;
+static int64_t screen_bench_swipe_start = -1;
+
+static double screen_bench_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static void screen_bench_flush(lv_disp_drv_t * driver, const lv_area_t * area, lv_color_t * colors) {
+    lv_coord_t width = lv_area_get_width(area);
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        memcpy(&screen_bench_framebuffer[y * SCREEN_BENCH_WIDTH + area->x1], colors, width * sizeof(lv_color_t));
+        colors += width;
+    }
+    screen_bench_flushes += 1;
+    lv_disp_flush_ready(driver);
+}
+
+/* Once per refresh, px is the joined invalidated area */
+static void screen_bench_monitor(lv_disp_drv_t * driver, uint32_t time, uint32_t px) {
+    (void)driver;
+    (void)time;
+    screen_bench_refreshed = true;
+    screen_bench_area += px;
+}
+
+/* Scripted touch, one horizontal drag across the tab */
+static bool screen_bench_touch(lv_indev_drv_t * driver, lv_indev_data_t * data) {
+    (void)driver;
+    int64_t elapsed = host_get_time_us() - screen_bench_swipe_start;
+    data->point.y = SCREEN_BENCH_SWIPE_Y;
+    if (screen_bench_swipe_start >= 0 && elapsed <= SCREEN_BENCH_SWIPE_US) {
+        data->point.x = SCREEN_BENCH_SWIPE_FROM - (lv_coord_t)((SCREEN_BENCH_SWIPE_FROM - SCREEN_BENCH_SWIPE_TO) * elapsed / SCREEN_BENCH_SWIPE_US);
+        data->state = LV_INDEV_STATE_PR;
+    } else {
+        data->point.x = SCREEN_BENCH_SWIPE_TO;
+        data->state = LV_INDEV_STATE_REL;
+    }
+    return false;
+}
+
+static void screen_bench_init_display(void) {
+    static lv_disp_buf_t buffer;
+    lv_disp_buf_init(&buffer, screen_bench_buffer_1, screen_bench_buffer_2, SCREEN_BENCH_BUFFER_SIZE);
+
+    lv_disp_drv_t display;
+    lv_disp_drv_init(&display);
+    display.hor_res = SCREEN_BENCH_WIDTH;
+    display.ver_res = SCREEN_BENCH_HEIGHT;
+    display.flush_cb = screen_bench_flush;
+    display.monitor_cb = screen_bench_monitor;
+    display.buffer = &buffer;
+    lv_disp_drv_register(&display);
+
+    lv_indev_drv_t touch;
+    lv_indev_drv_init(&touch);
+    touch.type = LV_INDEV_TYPE_POINTER;
+    touch.read_cb = screen_bench_touch;
+    lv_indev_drv_register(&touch);
+}
+
+/* Thermal circles on top of a slow climb for a minute, then a glide, heading and bank follow the turns */
+static void screen_bench_flight(int64_t timestamp, telemetry_t * telemetry) {
+    double seconds = timestamp / 1e6;
+    double climb = (seconds < 60.0) ? 1.5 + 1.2 * sin(seconds * 2.0 * M_PI / 25.0) : -1.1;
+    double altitude = 800.0 + ((seconds < 60.0) ? 1.5 * seconds - 1.2 * 25.0 / (2.0 * M_PI) * (cos(seconds * 2.0 * M_PI / 25.0) - 1.0)
+                                                : 90.0 - 1.1 * (seconds - 60.0));
+
+    telemetry->altitude = (float)altitude;
+    telemetry->speed = (int32_t)lround(climb * 100.0);
+    telemetry->pressure = (float)(101325.0 * pow(1.0 - 2.25577e-5 * altitude, 5.25588));
+    telemetry->temperature = (float)(20.0 - 0.0065 * altitude);
+    bool circling = (seconds < 60.0);
+    telemetry->heading = (float)(circling ? fmod(seconds * 360.0 / 25.0, 360.0) : 225.0 + 5.0 * sin(seconds));
+    telemetry->roll = (float)((circling ? 30.0 : 0.0) + 3.0 * sin(seconds * 2.0 * M_PI / 3.0));
+    telemetry->pitch = (float)(5.0 * sin(seconds * 2.0 * M_PI / 4.0));
+}
+
+static int32_t screen_bench_heading_difference(int32_t heading, int32_t shown) {
+    return abs((heading - shown + 540) % 360 - 180);
+}
+
+/* What vario_mpu6886_loop and vario_sht3x_loop publish and notify in one estimator period */
+static uint32_t screen_bench_produce(int64_t timestamp) {
+    static int32_t shown_altitude = INT32_MIN;
+    static int32_t shown_speed = INT32_MIN;
+    static int32_t shown_pressure = INT32_MIN;
+    static int32_t shown_temperature = INT32_MIN;
+    static int32_t shown_humidity = INT32_MIN;
+    static int32_t shown_heading = 0;
+    static int32_t shown_roll = 0;
+    static int32_t shown_pitch = 0;
+
+    telemetry_t telemetry;
+    screen_bench_flight(timestamp, &telemetry);
+    telemetry_publish(&telemetry);
+
+    uint32_t events = 0;
+    int32_t altitude = (int32_t)lroundf(telemetry.altitude);
+    if (altitude != shown_altitude || abs(telemetry.speed - shown_speed) >= SCREEN_BENCH_SPEED_STEP) {
+        shown_altitude = altitude;
+        shown_speed = telemetry.speed;
+        events |= UI_EVENT_FLIGHT;
+    }
+    int32_t pressure = (int32_t)lroundf(telemetry.pressure / 10.0f);
+    int32_t temperature = (int32_t)lroundf(telemetry.temperature * 10.0f);
+    if (pressure != shown_pressure || temperature != shown_temperature) {
+        shown_pressure = pressure;
+        shown_temperature = temperature;
+        events |= UI_EVENT_ENVIRONMENT;
+    }
+    int32_t heading = (int32_t)lroundf(telemetry.heading);
+    int32_t roll = (int32_t)lroundf(telemetry.roll);
+    int32_t pitch = (int32_t)lroundf(telemetry.pitch);
+    if (screen_bench_heading_difference(heading, shown_heading) >= SCREEN_BENCH_ATTITUDE_STEP ||
+        abs(roll - shown_roll) >= SCREEN_BENCH_ATTITUDE_STEP || abs(pitch - shown_pitch) >= SCREEN_BENCH_ATTITUDE_STEP) {
+        shown_heading = heading;
+        shown_roll = roll;
+        shown_pitch = pitch;
+        events |= UI_EVENT_ATTITUDE;
+    }
+    if (history_add(timestamp, telemetry.altitude, telemetry.speed)) {
+        events |= UI_EVENT_HISTORY;
+    }
+
+    if (timestamp % SCREEN_BENCH_HUMIDITY_US == 0) {
+        float humidity = (float)(55.0 + 5.0 * sin(timestamp / 1e6 / 60.0));
+        telemetry_publish_humidity(humidity);
+        if ((int32_t)lroundf(humidity * 10.0f) != shown_humidity) {
+            shown_humidity = (int32_t)lroundf(humidity * 10.0f);
+            events |= UI_EVENT_ENVIRONMENT;
+        }
+    }
+    if (timestamp % SCREEN_BENCH_CLOCK_US == 0) {
+        events |= UI_EVENT_CLOCK;
+        if (timestamp % (SCREEN_BENCH_CLOCK_US * SCREEN_BENCH_BATTERY_PERIODS) == 0) {
+            events |= UI_EVENT_BATTERY;
+        }
+    }
+
+    return events;
+}
+
+/* Name of the tab shown by the tab view of the active screen */
+static const char * screen_bench_shown_tab(void) {
+    lv_obj_t * child = NULL;
+    while ((child = lv_obj_get_child(lv_scr_act(), child)) != NULL) {
+        lv_obj_type_t type;
+        lv_obj_get_type(child, &type);
+        if (strcmp(type.type[0], "lv_tabview") == 0) {
+            lv_tabview_ext_t * ext = lv_obj_get_ext_attr(child);
+            return ext->tab_name_ptr[lv_tabview_get_tab_act(child)];
+        }
+    }
+    return "";
+}
+
+static void screen_bench_record(screen_bench_frames_t * frames, const screen_bench_frame_t * frame) {
+    if (frames->count == frames->capacity) {
+        uint32_t capacity = (frames->capacity == 0) ? 4096 : frames->capacity * 2;
+        screen_bench_frame_t * grown = realloc(frames->frames, capacity * sizeof(screen_bench_frame_t));
+        if (grown == NULL) {
+            return;
+        }
+        frames->frames = grown;
+        frames->capacity = capacity;
+    }
+    frames->frames[frames->count++] = *frame;
+}
+
+static int screen_bench_compare(const void * a, const void * b) {
+    uint32_t first = *(const uint32_t *)a;
+    uint32_t second = *(const uint32_t *)b;
+    return (first > second) - (first < second);
+}
+
+/* Frame statistics of one phase, or of all with phase UINT32_MAX */
+static uint32_t screen_bench_report_phase(const screen_bench_frames_t * frames, uint32_t phase, const char * name) {
+    uint32_t * render_us = malloc((frames->count + 1) * sizeof(uint32_t));
+    uint32_t count = 0;
+    uint64_t render_sum = 0;
+    uint64_t area_sum = 0;
+    uint32_t area_max = 0;
+    for (uint32_t i = 0; i < frames->count && render_us != NULL; i++) {
+        const screen_bench_frame_t * frame = &frames->frames[i];
+        if (phase != UINT32_MAX && frame->phase != phase) {
+            continue;
+        }
+        render_us[count++] = frame->render_us;
+        render_sum += frame->render_us;
+        area_sum += frame->area;
+        area_max = (frame->area > area_max) ? frame->area : area_max;
+    }
+
+    if (count > 0) {
+        qsort(render_us, count, sizeof(uint32_t), screen_bench_compare);
+        printf("%-10s %6u %9.1f %8u %8u %8u %9.0f %8u %7.1f%%\n", name, count, (double)render_sum / count, render_us[count / 2],
+            render_us[(count * 95) / 100], render_us[count - 1], (double)area_sum / count, area_max,
+            100.0 * area_sum / count / (SCREEN_BENCH_WIDTH * SCREEN_BENCH_HEIGHT));
+    } else {
+        printf("%-10s %6u\n", name, 0);
+    }
+
+    free(render_us);
+    return count;
+}
+
+static bool screen_bench_report(const screen_bench_frames_t * frames, uint32_t heap_screens, uint32_t heap_peak, uint32_t heap_total,
+                                uint32_t biggest_free_min, bool tabs_shown) {
+    printf("%-10s %6s %9s %8s %8s %8s %9s %8s %8s\n", "phase", "frames", "mean us", "p50 us", "p95 us", "max us", "mean px", "max px", "screen");
+    bool passed = tabs_shown;
+    for (uint32_t phase = 0; phase < SCREEN_BENCH_PHASE_COUNT; phase++) {
+        passed = (screen_bench_report_phase(frames, phase, screen_bench_phases[phase].name) > 0) && passed;
+    }
+    screen_bench_report_phase(frames, UINT32_MAX, "all");
+
+    font_loader_stats_t fonts;
+    font_loader_get_stats(&fonts);
+    printf("LVGL heap %u bytes after building the screens, high water %u of %u bytes (%.0f%%), smallest largest free block %u\n",
+        heap_screens, heap_peak, heap_total, 100.0 * heap_peak / heap_total, biggest_free_min);
+    printf("%u fonts loaded, glyph cache %u hits %u misses\n", fonts.fonts, fonts.hits, fonts.misses);
+
+    passed = passed && (heap_peak < heap_total);
+    printf("%s\n", passed ? "PASS" : "FAIL");
+    return passed;
+}
+
+static void screen_bench_csv(const screen_bench_frames_t * frames, const char * path) {
+    FILE * file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "can not create %s\n", path);
+        return;
+    }
+
+    fprintf(file, "timestamp_ms,phase,render_us,area_px,flushes,heap_used\n");
+    for (uint32_t i = 0; i < frames->count; i++) {
+        const screen_bench_frame_t * frame = &frames->frames[i];
+        fprintf(file, "%lld,%s,%u,%u,%u,%u\n", (long long)(frame->timestamp / 1000), screen_bench_phases[frame->phase].name,
+            frame->render_us, frame->area, frame->flushes, frame->heap_used);
+    }
+    fclose(file);
+}
+
+int main(int argc, char * argv[]) {
+    if (argc > 2) {
+        fprintf(stderr, "usage: %s [csv]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    xGuiSemaphore = xSemaphoreCreateMutex();
+    lv_init();
+    screen_bench_init_display();
+    config_load_all_namespace();
+
+    lv_mem_monitor_t memory;
+    screen_show_splash();
+    screen_init();
+    lv_mem_monitor(&memory);
+    uint32_t heap_screens = memory.total_size - memory.free_size;
+    uint32_t heap_peak = memory.max_used;
+    uint32_t biggest_free_min = memory.free_biggest_size;
+
+    screen_bench_frames_t frames;
+    memset(&frames, 0, sizeof(frames));
+    bool tabs_shown = true;
+    int64_t timestamp = 0;
+
+    for (uint32_t phase = 0; phase < SCREEN_BENCH_PHASE_COUNT; phase++) {
+        const screen_bench_phase_t * script = &screen_bench_phases[phase];
+        int64_t end = timestamp + script->seconds * 1000000LL;
+
+        while (timestamp < end) {
+            timestamp += SCREEN_BENCH_STEP_US;
+            host_set_time_us(timestamp);
+            lv_tick_inc(SCREEN_BENCH_STEP_US / 1000);
+
+            uint32_t events = screen_bench_produce(timestamp);
+            // Touches and buttons notify the UI task like button.c does, on press and on release
+            if (timestamp == end - script->seconds * 1000000LL + SCREEN_BENCH_STEP_US) {
+                if (script->action == SCREEN_BENCH_SWIPE) {
+                    screen_bench_swipe_start = timestamp;
+                    events |= UI_EVENT_BUTTON;
+                } else if (script->action == SCREEN_BENCH_BUTTON) {
+                    screen_host_press(SCREEN_HOST_BUTTON_MIDDLE);
+                    events |= UI_EVENT_BUTTON;
+                }
+            }
+            if (screen_bench_swipe_start >= 0 && timestamp - screen_bench_swipe_start == SCREEN_BENCH_SWIPE_US + SCREEN_BENCH_STEP_US) {
+                events |= UI_EVENT_BUTTON;
+            }
+            if (events) {
+                ui_notify(events);
+            }
+            host_tasks_wait_idle();
+
+            xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+            screen_bench_refreshed = false;
+            screen_bench_area = 0;
+            screen_bench_flushes = 0;
+            double start = screen_bench_now();
+            lv_task_handler();
+            double elapsed = screen_bench_now() - start;
+            lv_mem_monitor(&memory);
+            xSemaphoreGive(xGuiSemaphore);
+
+            heap_peak = (memory.max_used > heap_peak) ? memory.max_used : heap_peak;
+            biggest_free_min = (memory.free_biggest_size < biggest_free_min) ? memory.free_biggest_size : biggest_free_min;
+            if (screen_bench_refreshed) {
+                screen_bench_frame_t frame = {
+                    .timestamp = timestamp,
+                    .phase = phase,
+                    .render_us = (uint32_t)(elapsed * 1e6),
+                    .area = screen_bench_area,
+                    .flushes = screen_bench_flushes,
+                    .heap_used = memory.total_size - memory.free_size,
+                };
+                screen_bench_record(&frames, &frame);
+            }
+        }
+
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        const char * shown = screen_bench_shown_tab();
+        xSemaphoreGive(xGuiSemaphore);
+        if (strcmp(shown, script->tab) != 0) {
+            fprintf(stderr, "%s ends on tab %s instead of %s\n", script->name, shown, script->tab);
+            tabs_shown = false;
+        }
+    }
+
+    if (argc > 1) {
+        screen_bench_csv(&frames, argv[1]);
+    }
+    bool passed = screen_bench_report(&frames, heap_screens, heap_peak, memory.total_size, biggest_free_min, tabs_shown);
+
+    free(frames.frames);
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+/* Host stand-in for the board support header, only what the signal chain sources need */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include "esp_err.h"
+#include "esp_log.h"
+
+#include "driver/gpio.h"
+#include "driver/i2c.h"
+
+#include "i2c_device.h"
+#include "mpu6886.h"
+
+#define I2S_BITS_PER_SAMPLE_16BIT       (16)
@@ -0,0 +1,8 @@
+#pragma once
+
+typedef int gpio_num_t;
+
+#define GPIO_NUM_21             (21)
+#define GPIO_NUM_22             (22)
+#define GPIO_NUM_32             (32)
+#define GPIO_NUM_33             (33)
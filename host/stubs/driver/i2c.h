@@ -0,0 +1,11 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+
+typedef enum {
+    I2C_NUM_0 = 0,
+    I2C_NUM_1,
+    I2C_NUM_MAX,
+} i2c_port_t;
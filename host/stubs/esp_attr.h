@@ -0,0 +1,5 @@
+#pragma once
+
+/* Placement attributes mean nothing on the host */
+#define IRAM_ATTR
+#define DRAM_ATTR
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdio.h>
+
+/*
+    Errors and warnings go to stderr so they never mix with the CSV output, the chattier levels are dropped. Their
+    arguments still count as used, formats are not checked since size_t is wider on the host than on the ESP32.
+*/
+static inline void host_log_drop(const char * tag, const char * format, ...) {
+    (void)tag;
+    (void)format;
+}
+
+#define ESP_LOGE(tag, format, ...)      fprintf(stderr, "E (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...)      fprintf(stderr, "W (%s) " format "\n", tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...)      host_log_drop(tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...)      host_log_drop(tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...)      host_log_drop(tag, format, ##__VA_ARGS__)
+#define ESP_LOG_BUFFER_HEX(tag, buffer, buffer_len)     do { (void)(buffer); (void)(buffer_len); } while (0)
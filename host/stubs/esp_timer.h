@@ -0,0 +1,6 @@
+#pragma once
+
+#include <stdint.h>
+
+/* Replay time, set by the harness */
+int64_t esp_timer_get_time(void);
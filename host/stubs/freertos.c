@@ -0,0 +1,271 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/timers.h"
+#include "esp_timer.h"
+
+typedef struct {
+    pthread_t thread;
+    TaskFunction_t function;
+    void * parameters;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    uint32_t notified;
+    bool waiting;
+} host_task_t;
+
+/* Written by the harness thread, read by tasks it has started */
+static _Atomic int64_t host_time_us = 0;
+static __thread host_task_t * host_current_task = NULL;
+static host_task_t * host_tasks[HOST_TASK_MAX];
+static _Atomic uint32_t host_task_count = 0;
+
+void host_set_time_us(int64_t time_us) {
+    host_time_us = time_us;
+}
+
+int64_t host_get_time_us(void) {
+    return host_time_us;
+}
+
+int64_t esp_timer_get_time(void) {
+    return host_time_us;
+}
+
+/* Replay time is driven by the capture, a delay only gives other host threads a chance to run */
+void vTaskDelay(TickType_t ticks) {
+    (void)ticks;
+    sched_yield();
+}
+
+void vTaskDelayUntil(TickType_t * previous_wake_time, TickType_t time_increment) {
+    *previous_wake_time += time_increment;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(host_time_us / 1000 / portTICK_PERIOD_MS);
+}
+
+static void * host_task_run(void * argument) {
+    host_current_task = (host_task_t *)argument;
+    host_current_task->function(host_current_task->parameters);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char * name, uint32_t stack_depth, void * parameters, UBaseType_t priority, TaskHandle_t * task) {
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    host_task_t * created = calloc(1, sizeof(host_task_t));
+    if (created == NULL) {
+        return pdFAIL;
+    }
+
+    created->function = function;
+    created->parameters = parameters;
+    pthread_mutex_init(&created->lock, NULL);
+    pthread_cond_init(&created->changed, NULL);
+    uint32_t index = atomic_load(&host_task_count);
+    if (index >= HOST_TASK_MAX || pthread_create(&created->thread, NULL, host_task_run, created) != 0) {
+        free(created);
+        return pdFAIL;
+    }
+    pthread_detach(created->thread);
+    host_tasks[index] = created;
+    atomic_store(&host_task_count, index + 1);
+
+    if (task != NULL) {
+        *task = created;
+    }
+    return pdPASS;
+}
+
+/* NULL on the harness thread and on threads not started by xTaskCreate */
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    return host_current_task;
+}
+
+/* The replay harness notifies no task at all, a NULL handle is ignored */
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    host_task_t * target = (host_task_t *)task;
+    if (target == NULL) {
+        return pdPASS;
+    }
+
+    pthread_mutex_lock(&target->lock);
+    target->notified = (action == eSetValueWithOverwrite) ? value : (target->notified | value);
+    pthread_cond_broadcast(&target->changed);
+    pthread_mutex_unlock(&target->lock);
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t * value, TickType_t ticks) {
+    host_task_t * task = host_current_task;
+    if (task == NULL) {
+        return pdFALSE;
+    }
+
+    pthread_mutex_lock(&task->lock);
+    if (task->notified == 0) {
+        task->notified &= ~clear_on_entry;
+    }
+    while (task->notified == 0 && ticks == portMAX_DELAY) {
+        task->waiting = true;
+        pthread_cond_broadcast(&task->changed);
+        pthread_cond_wait(&task->changed, &task->lock);
+    }
+    task->waiting = false;
+
+    BaseType_t received = (task->notified != 0) ? pdTRUE : pdFALSE;
+    if (value != NULL) {
+        *value = task->notified;
+    }
+    task->notified &= ~clear_on_exit;
+    pthread_mutex_unlock(&task->lock);
+    return received;
+}
+
+/* Only for tasks that block on notifications, one that never waits keeps the harness waiting */
+void host_tasks_wait_idle(void) {
+    uint32_t count = atomic_load(&host_task_count);
+    for (uint32_t i = 0; i < count; i++) {
+        host_task_t * task = host_tasks[i];
+        pthread_mutex_lock(&task->lock);
+        while (!task->waiting || task->notified != 0) {
+            pthread_cond_wait(&task->changed, &task->lock);
+        }
+        pthread_mutex_unlock(&task->lock);
+    }
+}
+
+TimerHandle_t xTimerCreate(const char * name, TickType_t period, UBaseType_t auto_reload, void * id, TimerCallbackFunction_t callback) {
+    (void)name;
+    (void)period;
+    (void)auto_reload;
+    (void)id;
+    (void)callback;
+    return calloc(1, sizeof(TickType_t));
+}
+
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks) {
+    (void)ticks;
+    return (timer != NULL) ? pdPASS : pdFAIL;
+}
+
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks) {
+    (void)ticks;
+    free(timer);
+    return pdPASS;
+}
+
+/* Real mutexes, the telemetry benchmark compares against them from several threads */
+static SemaphoreHandle_t host_create_mutex(int type) {
+    pthread_mutexattr_t attributes;
+    pthread_mutex_t * mutex = malloc(sizeof(pthread_mutex_t));
+    if (mutex != NULL) {
+        pthread_mutexattr_init(&attributes);
+        pthread_mutexattr_settype(&attributes, type);
+        pthread_mutex_init(mutex, &attributes);
+        pthread_mutexattr_destroy(&attributes);
+    }
+    return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    return host_create_mutex(PTHREAD_MUTEX_NORMAL);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void) {
+    return host_create_mutex(PTHREAD_MUTEX_RECURSIVE);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return (pthread_mutex_lock((pthread_mutex_t *)semaphore) == 0) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return (pthread_mutex_unlock((pthread_mutex_t *)semaphore) == 0) ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return xSemaphoreTake(semaphore, ticks);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t semaphore) {
+    return xSemaphoreGive(semaphore);
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+    EventBits_t bits;
+} host_event_group_t;
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    host_event_group_t * group = calloc(1, sizeof(host_event_group_t));
+    if (group != NULL) {
+        pthread_mutex_init(&group->lock, NULL);
+        pthread_cond_init(&group->changed, NULL);
+    }
+    return group;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    host_event_group_t * target = (host_event_group_t *)group;
+    pthread_mutex_lock(&target->lock);
+    target->bits |= bits;
+    EventBits_t result = target->bits;
+    pthread_cond_broadcast(&target->changed);
+    pthread_mutex_unlock(&target->lock);
+    return result;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t group) {
+    host_event_group_t * target = (host_event_group_t *)group;
+    pthread_mutex_lock(&target->lock);
+    EventBits_t result = target->bits;
+    pthread_mutex_unlock(&target->lock);
+    return result;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clear_on_exit, BaseType_t wait_for_all, TickType_t ticks) {
+    host_event_group_t * target = (host_event_group_t *)group;
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    uint64_t wait_ms = (uint64_t)ticks * portTICK_PERIOD_MS;
+    deadline.tv_sec += wait_ms / 1000;
+    deadline.tv_nsec += (wait_ms % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+        deadline.tv_sec += 1;
+        deadline.tv_nsec -= 1000000000;
+    }
+
+    pthread_mutex_lock(&target->lock);
+    bool met = false;
+    for ( ; ; ) {
+        EventBits_t set = target->bits & bits;
+        met = wait_for_all ? (set == bits) : (set != 0);
+        if (met || ticks == 0) {
+            break;
+        }
+        if (ticks == portMAX_DELAY) {
+            pthread_cond_wait(&target->changed, &target->lock);
+        } else if (pthread_cond_timedwait(&target->changed, &target->lock, &deadline) != 0) {
+            break;
+        }
+    }
+    EventBits_t result = target->bits;
+    // Like the kernel, the bits are only cleared when the wait was satisfied
+    if (met && clear_on_exit) {
+        target->bits &= ~bits;
+    }
+    pthread_mutex_unlock(&target->lock);
+    return result;
+}
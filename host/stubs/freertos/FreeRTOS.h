@@ -0,0 +1,23 @@
+#pragma once
+
+/* Host stand-in for the FreeRTOS kernel, the harness runs on replay time and tasks are threads */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdFALSE                 (0)
+#define pdTRUE                  (1)
+#define pdFAIL                  (pdFALSE)
+#define pdPASS                  (pdTRUE)
+
+#define configTICK_RATE_HZ      (100)
+#define portTICK_PERIOD_MS      ((TickType_t)1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY           ((TickType_t)0xffffffffUL)
+
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((TickType_t)(ms) * (TickType_t)configTICK_RATE_HZ) / (TickType_t)1000))
+#define pdTICKS_TO_MS(ticks)    ((uint32_t)(ticks) * 1000 / configTICK_RATE_HZ)
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+typedef void * TaskHandle_t;
+
+typedef enum {
+    eNoAction = 0,
+    eSetBits,
+    eIncrement,
+    eSetValueWithOverwrite,
+    eSetValueWithoutOverwrite,
+} eNotifyAction;
+
+typedef void (* TaskFunction_t)(void * parameters);
+
+#define HOST_TASK_MAX           (8)
+#define tskIDLE_PRIORITY        (0)
+
+/* Delays return immediately, the tick count follows the replay clock set by the harness */
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t * previous_wake_time, TickType_t time_increment);
+TickType_t xTaskGetTickCount(void);
+
+/* Tasks are threads, notifications only know eSetBits and a wait without a block time returns at once */
+BaseType_t xTaskCreate(TaskFunction_t function, const char * name, uint32_t stack_depth, void * parameters, UBaseType_t priority, TaskHandle_t * task);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t * value, TickType_t ticks);
+
+void host_set_time_us(int64_t time_us);
+int64_t host_get_time_us(void);
+/* Blocks until every task started by xTaskCreate waits for a notification with none pending */
+void host_tasks_wait_idle(void);
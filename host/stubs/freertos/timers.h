@@ -0,0 +1,12 @@
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+/* There is no timer service on the host, timers are created and started but never expire */
+typedef void * TimerHandle_t;
+typedef TimerHandle_t xTimerHandle;
+typedef void (* TimerCallbackFunction_t)(TimerHandle_t timer);
+
+TimerHandle_t xTimerCreate(const char * name, TickType_t period, UBaseType_t auto_reload, void * id, TimerCallbackFunction_t callback);
+BaseType_t xTimerStart(TimerHandle_t timer, TickType_t ticks);
+BaseType_t xTimerDelete(TimerHandle_t timer, TickType_t ticks);
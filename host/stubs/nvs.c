@@ -0,0 +1,28 @@
+#include "nvs.h"
+
+esp_err_t nvs_open(const char * name, nvs_open_mode_t open_mode, nvs_handle_t * out_handle) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+void nvs_close(nvs_handle_t handle) {
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char * key, int32_t * out_value) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char * key, int32_t value) {
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_str(nvs_handle_t handle, const char * key, char * out_value, size_t * length) {
+    return ESP_ERR_NVS_NOT_FOUND;
+}
+
+esp_err_t nvs_set_str(nvs_handle_t handle, const char * key, const char * value) {
+    return ESP_OK;
+}
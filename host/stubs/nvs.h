@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+
+/* No flash on the host, every namespace is missing so the configuration keeps its compiled defaults */
+
+typedef uint32_t nvs_handle_t;
+
+typedef enum {
+    NVS_READONLY,
+    NVS_READWRITE,
+} nvs_open_mode_t;
+
+typedef enum {
+    NVS_TYPE_U8 = 0x01,
+    NVS_TYPE_I8 = 0x11,
+    NVS_TYPE_U16 = 0x02,
+    NVS_TYPE_I16 = 0x12,
+    NVS_TYPE_U32 = 0x04,
+    NVS_TYPE_I32 = 0x14,
+    NVS_TYPE_U64 = 0x08,
+    NVS_TYPE_I64 = 0x18,
+    NVS_TYPE_STR = 0x21,
+    NVS_TYPE_BLOB = 0x42,
+    NVS_TYPE_ANY = 0xff,
+} nvs_type_t;
+
+esp_err_t nvs_open(const char * name, nvs_open_mode_t open_mode, nvs_handle_t * out_handle);
+void nvs_close(nvs_handle_t handle);
+esp_err_t nvs_commit(nvs_handle_t handle);
+esp_err_t nvs_get_i32(nvs_handle_t handle, const char * key, int32_t * out_value);
+esp_err_t nvs_set_i32(nvs_handle_t handle, const char * key, int32_t value);
+esp_err_t nvs_get_str(nvs_handle_t handle, const char * key, char * out_value, size_t * length);
+esp_err_t nvs_set_str(nvs_handle_t handle, const char * key, const char * value);
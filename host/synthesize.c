@@ -0,0 +1,396 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core2forAWS.h"
+#include "i2c_replay.h"
+#include "replay.h"
+
+/*
+    Synthetic capture of a step climb. The true vertical speed follows the step table, barometric raw values
+    are found by inverting the firmware compensation code on nominal coefficients, so the replay decodes them
+    back to the simulated pressure. Reads are dated like the firmware tasks would see them, late and jittered.
+    Noise is seeded, every run writes the same dump.
+*/
+
+#define SYNTH_DURATION_US               (120 * 1000000LL)
+#define SYNTH_TICK_US                   (1000)
+#define SYNTH_RAMP_US                   (200000)
+#define SYNTH_BASE_ALTITUDE             (500.0)
+#define SYNTH_TEMPERATURE               (20.0)
+/* The two barometers differ in noise and disagree on the absolute altitude, as real parts do */
+#define SYNTH_QMP6988_NOISE             (0.10)      /* m */
+#define SYNTH_DPS310_NOISE              (0.05)      /* m */
+#define SYNTH_DPS310_OFFSET             (1.5)       /* m */
+/* Reads happen after the data is ready, late by the task wake up and, for polled results, the tick grid */
+#define SYNTH_OS_TICK_US                (portTICK_PERIOD_MS * 1000)
+#define SYNTH_WAKE_LATENCY_US           (300)
+#define SYNTH_DPS310_DRAIN_US           (2500)
+#define SYNTH_ACCEL_NOISE               (0.01)      /* g */
+#define SYNTH_ACCEL_BIAS                (0.02)      /* g */
+#define SYNTH_GYRO_NOISE                (0.05)      /* degree/s */
+#define SYNTH_TILT                      (15.0 * M_PI / 180.0)
+#define SYNTH_ACCEL_LSB_PER_G           (4096.0)    /* MPU6886 at 8g full scale */
+#define SYNTH_GYRO_LSB_PER_DPS          (16.384)    /* MPU6886 at 2000dps full scale */
+
+/* The IMU streams through its FIFO, a batch is read when the watermark is reached */
+#define SYNTH_IMU_SAMPLE_US             (1000000 / VARIO_MPU6886_ODR_HZ)
+#define SYNTH_IMU_BATCH_US              (VARIO_MPU6886_PERIOD_MS * 1000)
+#define SYNTH_IMU_TEMPERATURE_RAW       (0)         /* 25 C */
+#define SYNTH_DPS310_READ_PERIOD_US     (VARIO_DPS310_FIFO_READ_PERIOD_MS * 1000)
+#define SYNTH_DPS310_PENDING_MAX        (DPS310_FIFO_DEPTH)
+
+static const replay_step_t synth_steps[] = {
+    { 20 * 1000000LL, 100 },
+    { 50 * 1000000LL, 300 },
+    { 80 * 1000000LL, -200 },
+    { 100 * 1000000LL, 0 },
+};
+
+/* Typical DPS310 calibration coefficients */
+static const int32_t synth_dps310_coefficients[] = { 209, -262, 80469, -54769, -2059, 1234, -10229, 172, -1247 };
+
+static uint64_t synth_random_state = 0x2545f4914f6cdd1dULL;
+
+static double synth_uniform(void) {
+    synth_random_state ^= synth_random_state << 13;
+    synth_random_state ^= synth_random_state >> 7;
+    synth_random_state ^= synth_random_state << 17;
+    return (double)(synth_random_state >> 11) / 9007199254740992.0;
+}
+
+static double synth_gaussian(void) {
+    double u1 = synth_uniform();
+    double u2 = synth_uniform();
+    if (u1 < 1e-12) {
+        u1 = 1e-12;
+    }
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Records are collected and sorted by time before writing, jittered reads land out of the generation order */
+typedef struct {
+    replay_record_t record;
+    uint32_t sequence;
+} synth_entry_t;
+
+typedef struct {
+    synth_entry_t * entries;
+    uint32_t count;
+    uint32_t capacity;
+    bool failed;
+} synth_capture_t;
+
+static void synth_emit(synth_capture_t * capture, int64_t timestamp, uint8_t port, uint8_t addr, uint8_t operation, uint8_t reg, const uint8_t * data, uint16_t length) {
+    if (capture->count == capture->capacity) {
+        uint32_t capacity = (capture->capacity == 0) ? 4096 : capture->capacity * 2;
+        synth_entry_t * entries = realloc(capture->entries, capacity * sizeof(synth_entry_t));
+        if (entries == NULL) {
+            capture->failed = true;
+            return;
+        }
+        capture->entries = entries;
+        capture->capacity = capacity;
+    }
+
+    synth_entry_t * entry = &capture->entries[capture->count];
+    entry->sequence = capture->count++;
+    entry->record.timestamp = timestamp;
+    entry->record.port = port;
+    entry->record.addr = addr;
+    entry->record.operation = operation;
+    entry->record.reg = reg;
+    entry->record.length = length;
+    memcpy(entry->record.data, data, length);
+
+    if (operation == REPLAY_OPERATION_READ) {
+        i2c_replay_set_registers(port, addr, reg, data, length);
+    }
+}
+
+static int synth_compare_entries(const void * a, const void * b) {
+    const synth_entry_t * left = (const synth_entry_t *)a;
+    const synth_entry_t * right = (const synth_entry_t *)b;
+    if (left->record.timestamp != right->record.timestamp) {
+        return (left->record.timestamp < right->record.timestamp) ? -1 : 1;
+    }
+    return (left->sequence < right->sequence) ? -1 : 1;
+}
+
+static int64_t synth_wake_latency(void) {
+    return (int64_t)(synth_uniform() * SYNTH_WAKE_LATENCY_US);
+}
+
+static void synth_put_u24(uint8_t * data, uint32_t value) {
+    data[0] = (value >> 16) & 0xff;
+    data[1] = (value >> 8) & 0xff;
+    data[2] = value & 0xff;
+}
+
+static void synth_put_i16(uint8_t * data, double value) {
+    long rounded = lround(value);
+    int16_t clamped = (rounded > INT16_MAX) ? INT16_MAX : (rounded < INT16_MIN) ? INT16_MIN : rounded;
+    data[0] = ((uint16_t)clamped >> 8) & 0xff;
+    data[1] = (uint16_t)clamped & 0xff;
+}
+
+/* Binary search of a monotonic firmware conversion, returns the raw value closest to the target */
+typedef double (*synth_forward_t)(void * context, int32_t raw);
+
+static int32_t synth_invert(synth_forward_t forward, void * context, int32_t low, int32_t high, double target) {
+    bool increasing = forward(context, high) > forward(context, low);
+
+    while (high - low > 1) {
+        int32_t middle = low + (high - low) / 2;
+        if ((forward(context, middle) < target) == increasing) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    return (fabs(forward(context, low) - target) < fabs(forward(context, high) - target)) ? low : high;
+}
+
+typedef struct {
+    qmp6988_device_t * qmp6988;
+    dps310_device_t * dps310;
+    int32_t temperature_raw;
+    bool pressure;
+} synth_context_t;
+
+static double synth_qmp6988_forward(void * context, int32_t raw) {
+    synth_context_t * synth = (synth_context_t *)context;
+    uint8_t result[QMP6988_REGISTER_RESULT_LENGTH];
+    synth_put_u24(&result[0], synth->pressure ? raw : QMP6988_RESULT_ADJUSTMENT);
+    synth_put_u24(&result[3], synth->pressure ? synth->temperature_raw : raw);
+    i2c_replay_set_registers(I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, QMP6988_REGISTER_RESULT_START, result, sizeof(result));
+
+    double temperature;
+    double pressure;
+    qmp6988_fetch_result(synth->qmp6988, &temperature, &pressure);
+
+    return synth->pressure ? pressure : temperature;
+}
+
+static double synth_dps310_forward(void * context, int32_t raw) {
+    synth_context_t * synth = (synth_context_t *)context;
+    uint8_t result[6];
+    synth_put_u24(&result[0], (uint32_t)(synth->pressure ? raw : 0) & 0xffffff);
+    synth_put_u24(&result[3], (uint32_t)(synth->pressure ? synth->temperature_raw : raw) & 0xffffff);
+    i2c_replay_set_registers(I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, DPS310_REG_PSR_B2, result, sizeof(result));
+
+    double temperature;
+    double pressure;
+    dps310_fetch_result(synth->dps310, &temperature, &pressure);
+
+    return synth->pressure ? pressure : temperature;
+}
+
+/* Register layout of the DPS310 coefficients c0, c1, c00, c10, c01, c11, c20, c21, c30 at DPS310_REG_COEF_C0M */
+void replay_encode_dps310_coefficients(const int32_t * c, uint8_t * data) {
+    data[0] = (c[0] >> 4) & 0xff;
+    data[1] = ((c[0] & 0x0f) << 4) | ((c[1] >> 8) & 0x0f);
+    data[2] = c[1] & 0xff;
+    data[3] = (c[2] >> 12) & 0xff;
+    data[4] = (c[2] >> 4) & 0xff;
+    data[5] = ((c[2] & 0x0f) << 4) | ((c[3] >> 16) & 0x0f);
+    data[6] = (c[3] >> 8) & 0xff;
+    data[7] = c[3] & 0xff;
+    for (int i = 4; i < 9; i++) {
+        data[8 + (i - 4) * 2] = (c[i] >> 8) & 0xff;
+        data[9 + (i - 4) * 2] = c[i] & 0xff;
+    }
+}
+
+static void synth_init_registers(synth_capture_t * capture) {
+    uint8_t data[32];
+
+    data[0] = QMP6988_CHIP_ID;
+    synth_emit(capture, 0, I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, REPLAY_OPERATION_READ, QMP6988_REGISTER_CHIP_ID, data, 1);
+    memset(data, 0, QMP6988_COMPENSATION_COES_LENGTH);
+    synth_emit(capture, 0, I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, REPLAY_OPERATION_READ, QMP6988_COMPENSATION_COES_START, data, QMP6988_COMPENSATION_COES_LENGTH);
+    measurement_control_register_t control_reg = { .data = 0 };
+    control_reg.power_mode = QMP6988_POWER_MODE_NORMAL;
+    control_reg.pressure_oversamping = QMP6988_OVERSAMPLING_COUNT_32;
+    control_reg.temperature_oversampling = QMP6988_OVERSAMPLING_COUNT_04;
+    synth_emit(capture, 0, I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, REPLAY_OPERATION_READ, QMP6988_REGISTER_MEASUREMENT_CONTROL, &control_reg.data, 1);
+    io_setup_register_t io_setup_reg = { .data = 0 };
+    io_setup_reg.standby_time = QMP6998_MEASUREMENT_STANDBY_5MS;
+    synth_emit(capture, 0, I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, REPLAY_OPERATION_READ, QMP6988_REGISTER_IO_SETUP, &io_setup_reg.data, 1);
+
+    data[0] = MEAS_CFG_COEF_RDY | MEAS_CFG_SENSOR_RDY | MEAS_CFG_TMP_RDY | MEAS_CFG_PRS_RDY;
+    synth_emit(capture, 0, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_READ, DPS310_REG_MEAS_CFG, data, 1);
+    data[0] = CHIP_AND_REVISION_ID;
+    synth_emit(capture, 0, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_READ, DPS310_REG_PRO_ID, data, 1);
+    replay_encode_dps310_coefficients(synth_dps310_coefficients, data);
+    synth_emit(capture, 0, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_READ, DPS310_REG_COEF_C0M, data, 18);
+    data[0] = TMP_COEF_SRCE_MEMS;
+    synth_emit(capture, 0, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_READ, DPS310_REG_COEF_SRCE, data, 1);
+
+    data[0] = 0x19;
+    synth_emit(capture, 0, I2C_NUM_1, MPU6886_ADDRESS, REPLAY_OPERATION_READ, MPU6886_WHOAMI, data, 1);
+}
+
+static double synth_true_speed(int64_t timestamp) {
+    double speed = 0.0;
+    for (uint32_t i = 0; i < sizeof(synth_steps) / sizeof(synth_steps[0]); i++) {
+        if (timestamp < synth_steps[i].timestamp) {
+            break;
+        }
+        double target = synth_steps[i].speed / 100.0;
+        double elapsed = (double)(timestamp - synth_steps[i].timestamp) / SYNTH_RAMP_US;
+        speed = (elapsed >= 1.0) ? target : speed + (target - speed) * elapsed;
+    }
+
+    return speed;
+}
+
+static double synth_pressure(double altitude) {
+    return 101325.0 / pow(1.0 + altitude * 0.0065 / (SYNTH_TEMPERATURE + 273.15), 5.257);
+}
+
+bool replay_synthesize_step_climb(const char * path) {
+    FILE * file = fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "can not create dump %s\n", path);
+        return false;
+    }
+
+    fprintf(file, "# synthetic step climb, base altitude %.0f m, temperature %.0f C\n", SYNTH_BASE_ALTITUDE, SYNTH_TEMPERATURE);
+    for (uint32_t i = 0; i < sizeof(synth_steps) / sizeof(synth_steps[0]); i++) {
+        fprintf(file, "# step %lld %d\n", (long long)synth_steps[i].timestamp, synth_steps[i].speed);
+    }
+
+    i2c_replay_reset();
+    synth_capture_t capture;
+    memset(&capture, 0, sizeof(capture));
+    synth_init_registers(&capture);
+
+    synth_context_t synth;
+    memset(&synth, 0, sizeof(synth));
+    synth.qmp6988 = qmp6988_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, QMP6988_I2C_ADDRESS_SDO_LOW);
+    synth.dps310 = dps310_init_device(I2C_NUM_1, GPIO_NUM_21, GPIO_NUM_22, QMP6988_I2C_FAST_FREQUENCY, DPS310_I2C_SLAVE_ADDR);
+    if (synth.qmp6988 == NULL || synth.dps310 == NULL) {
+        fprintf(stderr, "firmware drivers rejected the synthetic registers\n");
+        free(capture.entries);
+        fclose(file);
+        return false;
+    }
+
+    // Constant temperature, raw values solved once. DPS310 FIFO entries carry the type in bit 0.
+    synth.pressure = false;
+    int32_t qmp6988_temperature_raw = synth_invert(synth_qmp6988_forward, &synth, 0, 0xffffff, SYNTH_TEMPERATURE);
+    int32_t dps310_temperature_raw = synth_invert(synth_dps310_forward, &synth, -0x800000, 0x7fffff, SYNTH_TEMPERATURE) & ~DPS310_FIFO_PRESSURE_FLAG;
+
+    uint8_t data[DPS310_FIFO_DEPTH * DPS310_FIFO_ENTRY_LENGTH];
+    synth_put_u24(&data[0], DPS310_FIFO_EMPTY);
+    synth_put_u24(&data[3], (uint32_t)dps310_temperature_raw & 0xffffff);
+    synth_emit(&capture, 0, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_READ, DPS310_REG_PSR_B2, data, 6);
+    dps310_start_fifo_measure(synth.dps310, VARIO_DPS310_FIFO_READ_PERIOD_MS);
+
+    uint32_t qmp6988_period = qmp6988_get_measurement_period(synth.qmp6988);
+    uint32_t dps310_pressure_period = 1000000 / synth.dps310->pressure_rate;
+    uint32_t dps310_temperature_period = 1000000 / synth.dps310->temperature_rate;
+
+    uint8_t pending[SYNTH_DPS310_PENDING_MAX * DPS310_FIFO_ENTRY_LENGTH];
+    uint32_t pending_count = 0;
+    uint8_t imu_pending[VARIO_MPU6886_BATCH_FRAMES * MPU6886_FIFO_FRAME_LENGTH];
+    uint32_t imu_pending_count = 0;
+
+    double altitude = SYNTH_BASE_ALTITUDE;
+    double last_speed = 0.0;
+    double sin_tilt = sin(SYNTH_TILT);
+    double cos_tilt = cos(SYNTH_TILT);
+
+    for (int64_t timestamp = 0; timestamp < SYNTH_DURATION_US; timestamp += SYNTH_TICK_US) {
+        double speed = synth_true_speed(timestamp);
+        double accel = (speed - last_speed) / (SYNTH_TICK_US / 1000000.0);
+        altitude += (speed + last_speed) / 2.0 * (SYNTH_TICK_US / 1000000.0);
+        last_speed = speed;
+
+        if (timestamp % SYNTH_IMU_SAMPLE_US == 0) {
+            double up = 1.0 + accel / VARIO_GRAVITY_ACCELERATION;
+            double force[3] = {
+                SYNTH_ACCEL_NOISE * synth_gaussian(),
+                up * sin_tilt + SYNTH_ACCEL_NOISE * synth_gaussian(),
+                up * cos_tilt + SYNTH_ACCEL_BIAS + SYNTH_ACCEL_NOISE * synth_gaussian(),
+            };
+            uint8_t * frame = &imu_pending[imu_pending_count++ * MPU6886_FIFO_FRAME_LENGTH];
+            for (int i = 0; i < 3; i++) {
+                synth_put_i16(&frame[i * 2], force[i] * SYNTH_ACCEL_LSB_PER_G);
+                synth_put_i16(&frame[8 + i * 2], SYNTH_GYRO_NOISE * synth_gaussian() * SYNTH_GYRO_LSB_PER_DPS);
+            }
+            synth_put_i16(&frame[6], SYNTH_IMU_TEMPERATURE_RAW);
+        }
+
+        // Same reads as MPU6886_ReadStream, the FIFO count then the frames in one burst
+        if (imu_pending_count == VARIO_MPU6886_BATCH_FRAMES) {
+            // The first batch after a DPS310 FIFO drain often waits for the bus
+            int64_t read_time = timestamp + synth_wake_latency();
+            int64_t since_drain = timestamp % SYNTH_DPS310_READ_PERIOD_US - SYNTH_DPS310_READ_PERIOD_US / 2;
+            if (since_drain >= 0 && since_drain < SYNTH_IMU_BATCH_US && synth_uniform() < 0.5) {
+                read_time += SYNTH_DPS310_DRAIN_US;
+            }
+            uint32_t length = imu_pending_count * MPU6886_FIFO_FRAME_LENGTH;
+            uint8_t count[2] = { length >> 8, length & 0xff };
+            synth_emit(&capture, read_time, I2C_NUM_1, MPU6886_ADDRESS, REPLAY_OPERATION_READ, MPU6886_FIFO_COUNTH, count, 2);
+            synth_emit(&capture, read_time, I2C_NUM_1, MPU6886_ADDRESS, REPLAY_OPERATION_FIFO, MPU6886_FIFO_R_W, imu_pending, length);
+            imu_pending_count = 0;
+        }
+
+        if (timestamp % qmp6988_period == 0) {
+            synth.pressure = true;
+            synth.temperature_raw = qmp6988_temperature_raw;
+            double pressure = synth_pressure(altitude + SYNTH_QMP6988_NOISE * synth_gaussian());
+            int32_t pressure_raw = synth_invert(synth_qmp6988_forward, &synth, 0, 0xffffff, pressure);
+            synth_put_u24(&data[0], pressure_raw);
+            synth_put_u24(&data[3], qmp6988_temperature_raw);
+            // Polled on the tick grid, the result is seen up to a tick after it is ready
+            int64_t read_time = timestamp + (int64_t)(synth_uniform() * SYNTH_OS_TICK_US) + synth_wake_latency();
+            synth_emit(&capture, read_time, I2C_NUM_0, QMP6988_I2C_ADDRESS_SDO_LOW, REPLAY_OPERATION_READ, QMP6988_REGISTER_RESULT_START, data, QMP6988_REGISTER_RESULT_LENGTH);
+        }
+
+        if (timestamp % dps310_temperature_period == 0 && pending_count < SYNTH_DPS310_PENDING_MAX) {
+            synth_put_u24(&pending[pending_count++ * DPS310_FIFO_ENTRY_LENGTH], (uint32_t)dps310_temperature_raw & 0xffffff);
+        }
+
+        if (timestamp % dps310_pressure_period == 0 && pending_count < SYNTH_DPS310_PENDING_MAX) {
+            synth.pressure = true;
+            synth.temperature_raw = dps310_temperature_raw;
+            double pressure = synth_pressure(altitude + SYNTH_DPS310_OFFSET + SYNTH_DPS310_NOISE * synth_gaussian());
+            int32_t pressure_raw = synth_invert(synth_dps310_forward, &synth, -0x800000, 0x7fffff, pressure) | DPS310_FIFO_PRESSURE_FLAG;
+            synth_put_u24(&pending[pending_count++ * DPS310_FIFO_ENTRY_LENGTH], (uint32_t)pressure_raw & 0xffffff);
+        }
+
+        // Same burst pattern as dps310_fetch_fifo, another burst follows while no empty marker was returned
+        if (timestamp % SYNTH_DPS310_READ_PERIOD_US == SYNTH_DPS310_READ_PERIOD_US / 2) {
+            int64_t read_time = timestamp + synth_wake_latency();
+            uint32_t burst = synth.dps310->fifo_burst;
+            uint32_t count;
+            do {
+                count = (pending_count < burst) ? pending_count : burst;
+                memcpy(data, pending, count * DPS310_FIFO_ENTRY_LENGTH);
+                for (uint32_t i = count; i < burst; i++) {
+                    synth_put_u24(&data[i * DPS310_FIFO_ENTRY_LENGTH], DPS310_FIFO_EMPTY);
+                }
+                synth_emit(&capture, read_time, I2C_NUM_1, DPS310_I2C_SLAVE_ADDR, REPLAY_OPERATION_FIFO, DPS310_REG_PSR_B2, data, burst * DPS310_FIFO_ENTRY_LENGTH);
+                memmove(pending, &pending[count * DPS310_FIFO_ENTRY_LENGTH], (pending_count - count) * DPS310_FIFO_ENTRY_LENGTH);
+                pending_count -= count;
+            } while (count == burst);
+        }
+    }
+
+    qmp6988_deinit_device(synth.qmp6988);
+    dps310_deinit_device(synth.dps310);
+
+    qsort(capture.entries, capture.count, sizeof(synth_entry_t), synth_compare_entries);
+    bool result = !capture.failed;
+    for (uint32_t i = 0; result && i < capture.count; i++) {
+        result = replay_write_record(file, &capture.entries[i].record);
+    }
+    free(capture.entries);
+    fclose(file);
+
+    return result;
+}
@@ -0,0 +1,171 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core2forAWS.h"
+#include "freertos/semphr.h"
+#include "telemetry.h"
+#include "replay.h"
+
+/*
+    Cost of one estimator period publishing its values and of one consumer reading them, through the
+    telemetry seqlock and through the former path: a mutex taken once per field by every setter and getter.
+    The contended run adds a reader thread spinning on the values, the latency of the producer is what the
+    sensor tasks would see.
+*/
+
+#define BENCH_MUTEX_FIELDS              (5)
+
+typedef struct {
+    SemaphoreHandle_t mutex;
+    double fields[BENCH_MUTEX_FIELDS];
+} bench_mutex_data_t;
+
+static bench_mutex_data_t bench_mutex_data;
+static atomic_bool bench_running;
+static atomic_ulong bench_reads;
+static atomic_ulong bench_torn;
+
+static double bench_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* vario_set_speed, ui_set_altitude, ui_set_speed, ui_set_pressure, ui_set_temperature */
+static void bench_mutex_publish(double value) {
+    for (int i = 0; i < BENCH_MUTEX_FIELDS; i++) {
+        xSemaphoreTake(bench_mutex_data.mutex, portMAX_DELAY);
+        bench_mutex_data.fields[i] = value;
+        xSemaphoreGive(bench_mutex_data.mutex);
+    }
+}
+
+static void bench_mutex_read(double * fields) {
+    for (int i = 0; i < BENCH_MUTEX_FIELDS; i++) {
+        xSemaphoreTake(bench_mutex_data.mutex, portMAX_DELAY);
+        fields[i] = bench_mutex_data.fields[i];
+        xSemaphoreGive(bench_mutex_data.mutex);
+    }
+}
+
+static void bench_telemetry_publish(uint32_t value) {
+    telemetry_t telemetry;
+    telemetry.altitude = value;
+    telemetry.speed = value;
+    telemetry.pressure = value;
+    telemetry.temperature = value;
+    telemetry_publish(&telemetry);
+}
+
+static void * bench_mutex_reader(void * argument) {
+    while (atomic_load(&bench_running)) {
+        double fields[BENCH_MUTEX_FIELDS];
+        bench_mutex_read(fields);
+        atomic_fetch_add(&bench_reads, 1);
+    }
+    return NULL;
+}
+
+/* Values below 2^24 are exact in float, a consistent snapshot has all of them equal */
+static void * bench_telemetry_reader(void * argument) {
+    while (atomic_load(&bench_running)) {
+        telemetry_t telemetry;
+        telemetry_read(&telemetry);
+        if (telemetry.altitude != (float)telemetry.speed || telemetry.pressure != (float)telemetry.speed || telemetry.temperature != (float)telemetry.speed) {
+            atomic_fetch_add(&bench_torn, 1);
+        }
+        atomic_fetch_add(&bench_reads, 1);
+    }
+    return NULL;
+}
+
+typedef struct {
+    double average_ns;
+    double worst_ns;
+    unsigned long reads;
+} bench_result_t;
+
+static void bench_contended(bool seqlock, uint32_t iterations, bench_result_t * result) {
+    pthread_t reader;
+    atomic_store(&bench_running, true);
+    atomic_store(&bench_reads, 0);
+    pthread_create(&reader, NULL, seqlock ? bench_telemetry_reader : bench_mutex_reader, NULL);
+
+    double worst = 0.0;
+    double start = bench_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        double begin = bench_now();
+        if (seqlock) {
+            bench_telemetry_publish(i & 0xffffff);
+        } else {
+            bench_mutex_publish(i);
+        }
+        double elapsed = bench_now() - begin;
+        worst = (elapsed > worst) ? elapsed : worst;
+    }
+    double total = bench_now() - start;
+
+    atomic_store(&bench_running, false);
+    pthread_join(reader, NULL);
+
+    result->average_ns = total * 1e9 / iterations;
+    result->worst_ns = worst * 1e9;
+    result->reads = atomic_load(&bench_reads);
+}
+
+bool replay_benchmark_telemetry(uint32_t iterations) {
+    bench_mutex_data.mutex = xSemaphoreCreateMutex();
+    if (bench_mutex_data.mutex == NULL || iterations == 0) {
+        return false;
+    }
+
+    double fields[BENCH_MUTEX_FIELDS];
+    telemetry_t telemetry;
+    volatile double sink = 0.0;
+
+    double start = bench_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_mutex_publish(i);
+    }
+    double mutex_publish = bench_now() - start;
+
+    start = bench_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_mutex_read(fields);
+        sink = fields[0];
+    }
+    double mutex_read = bench_now() - start;
+
+    start = bench_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        bench_telemetry_publish(i & 0xffffff);
+    }
+    double telemetry_publish_time = bench_now() - start;
+
+    start = bench_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        telemetry_read(&telemetry);
+        sink = telemetry.altitude;
+    }
+    double telemetry_read_time = bench_now() - start;
+    (void)sink;
+
+    printf("uncontended, ns per operation\n");
+    printf("  mutex per field: publish %.1f, read %.1f\n", mutex_publish * 1e9 / iterations, mutex_read * 1e9 / iterations);
+    printf("  telemetry:       publish %.1f, read %.1f\n", telemetry_publish_time * 1e9 / iterations, telemetry_read_time * 1e9 / iterations);
+
+    bench_result_t mutex_result;
+    bench_result_t telemetry_result;
+    atomic_store(&bench_torn, 0);
+    bench_contended(false, iterations, &mutex_result);
+    bench_contended(true, iterations, &telemetry_result);
+
+    printf("publish with a reader thread spinning, ns\n");
+    printf("  mutex per field: average %.1f, worst %.0f, %lu reads\n", mutex_result.average_ns, mutex_result.worst_ns, mutex_result.reads);
+    printf("  telemetry:       average %.1f, worst %.0f, %lu reads, %lu torn\n", telemetry_result.average_ns, telemetry_result.worst_ns, telemetry_result.reads, atomic_load(&bench_torn));
+
+    return atomic_load(&bench_torn) == 0;
+}
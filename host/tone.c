@@ -0,0 +1,198 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core2forAWS.h"
+#include "config.h"
+#include "sin_table.h"
+#include "vario_synth.h"
+#include "replay.h"
+
+/*
+    Streaming synthesizer over a scripted flight: glide, climb, stronger climb, sink and glide again.
+    Reports how long a speed step takes to reach the oscillator, the largest sample to sample jump against
+    what a full scale sine at the highest pitch produces, the DDS sine error, and flash, RAM and CPU per
+    second of audio against the former 44.1 kHz path with its 30030 entry full wave table.
+*/
+
+#define TONE_SAMPLE_RATE                (VARIO_SYNTH_LOW_SAMPLE_RATE)
+#define TONE_LEGACY_SAMPLE_RATE         (44100)
+#define TONE_LEGACY_TABLE_COUNT         (30030)
+#define TONE_LEGACY_PHASE_SHIFT         (16)
+#define TONE_LEGACY_CYCLE_MAXIMUM_MS    (1000)
+#define TONE_LEGACY_DMA_BUFFERS         (8 * 1024)
+#define TONE_VOLUME                     (100)
+#define TONE_DURATION_MS                (14000)
+#define TONE_STEP_MS                    (5003)
+#define TONE_STEP_FROM_SPEED            (150)
+#define TONE_STEP_TO_SPEED              (350)
+#define TONE_BENCH_SECONDS              (600)
+#define TONE_BENCH_FREQUENCY            (1000)
+
+static int32_t tone_speed_at(uint32_t time_ms) {
+    if (time_ms < 2000) {
+        return 0;
+    } else if (time_ms < TONE_STEP_MS) {
+        return TONE_STEP_FROM_SPEED;
+    } else if (time_ms < 8000) {
+        return TONE_STEP_TO_SPEED;
+    } else if (time_ms < 11000) {
+        /* Slow sweep down through the sink threshold */
+        return TONE_STEP_TO_SPEED - (int32_t)(time_ms - 8000) * 700 / 3000;
+    } else if (time_ms < 13000) {
+        return -300;
+    }
+    return 0;
+}
+
+static double tone_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+bool replay_check_tone(const char * pcm_path) {
+    vario_tone_config_t tone_config;
+    config_load_all_namespace();
+    replay_load_tone_config(&tone_config);
+
+    FILE * pcm = NULL;
+    if (pcm_path != NULL) {
+        pcm = fopen(pcm_path, "wb");
+        if (pcm == NULL) {
+            fprintf(stderr, "cannot open %s\n", pcm_path);
+            return false;
+        }
+    }
+
+    vario_synth_t synth;
+    vario_synth_init(&synth, TONE_SAMPLE_RATE);
+    vario_tone_t tone = {.status = VARIO_STATUS_GLIDING};
+    int16_t block[VARIO_SYNTH_BLOCK_SAMPLES_MAX];
+
+    uint32_t blocks = TONE_DURATION_MS / VARIO_SYNTH_BLOCK_MS;
+    int32_t previous = 0;
+    int32_t max_jump = 0;
+    int32_t max_frequency = 0;
+    int32_t step_cycle = 0;
+    int32_t response_ms = -1;
+    uint32_t silent_blocks = 0;
+
+    for (uint32_t i = 0; i < blocks; i++) {
+        uint32_t time_ms = i * VARIO_SYNTH_BLOCK_MS;
+        vario_tone_update(&tone_config, tone_speed_at(time_ms), &tone);
+        max_frequency = (tone.frequency > max_frequency) ? tone.frequency : max_frequency;
+        max_frequency = (tone.harmonic > max_frequency) ? tone.harmonic : max_frequency;
+
+        if (time_ms < TONE_STEP_MS) {
+            step_cycle = tone.cycle;
+        }
+
+        if (!vario_synth_render(&synth, &tone, TONE_VOLUME, block, synth.block_samples)) {
+            memset(block, 0, sizeof(int16_t) * synth.block_samples);
+            silent_blocks++;
+        }
+
+        /* Pitch of the new speed reached at the end of this block */
+        if (response_ms < 0 && time_ms + VARIO_SYNTH_BLOCK_MS > TONE_STEP_MS && synth.step == vario_synth_frequency_to_step(&synth, tone.frequency)) {
+            response_ms = time_ms + VARIO_SYNTH_BLOCK_MS - TONE_STEP_MS;
+        }
+
+        for (uint32_t j = 0; j < synth.block_samples; j++) {
+            int32_t jump = abs(block[j] - previous);
+            max_jump = (jump > max_jump) ? jump : max_jump;
+            previous = block[j];
+        }
+
+        if (pcm != NULL) {
+            fwrite(block, sizeof(int16_t), synth.block_samples, pcm);
+        }
+    }
+
+    if (pcm != NULL) {
+        fclose(pcm);
+    }
+
+    /* Steepest slope of a full scale sine at the highest pitch, plus one gain ramp step */
+    double amplitude = 32767.0 * TONE_VOLUME / 100;
+    double bound = amplitude * 2.0 * M_PI * max_frequency / TONE_SAMPLE_RATE + amplitude * synth.gain_step / (1 << VARIO_SYNTH_GAIN_SHIFT) + 2.0;
+
+    printf("block %u samples (%d ms) at %d Hz, %u silent blocks skipped\n", synth.block_samples, VARIO_SYNTH_BLOCK_MS, TONE_SAMPLE_RATE, silent_blocks);
+    printf("speed step %.1f -> %.1f m/s heard after %d ms, a whole beep buffer was %d ms\n", TONE_STEP_FROM_SPEED / 100.0, TONE_STEP_TO_SPEED / 100.0, response_ms, step_cycle);
+    printf("max sample jump %d, full scale sine at %d Hz allows %.0f\n", max_jump, max_frequency, bound);
+
+    double sine_error = 0.0;
+    for (uint64_t phase = 0; phase < (1ULL << 32); phase += 4099) {
+        double error = fabs(vario_synth_sine((uint32_t)phase) - 32767.0 * sin(2.0 * M_PI * phase / 4294967296.0));
+        sine_error = (error > sine_error) ? error : sine_error;
+    }
+    printf("dds sine max error %.2f LSB, table %u entries\n", sine_error, SIN_TABLE_DATA_COUNT);
+
+    /* Former oscillator, a Q16 index wrapping over a full wave table */
+    int16_t * legacy_table = malloc(sizeof(int16_t) * TONE_LEGACY_TABLE_COUNT);
+    for (uint32_t i = 0; i < TONE_LEGACY_TABLE_COUNT; i++) {
+        legacy_table[i] = (int16_t)(sin(2.0 * M_PI * i / TONE_LEGACY_TABLE_COUNT) * 32767.0);
+    }
+    uint32_t legacy_wrap = (uint32_t)TONE_LEGACY_TABLE_COUNT << TONE_LEGACY_PHASE_SHIFT;
+    uint32_t legacy_step = (uint32_t)(((uint64_t)TONE_BENCH_FREQUENCY * TONE_LEGACY_TABLE_COUNT << TONE_LEGACY_PHASE_SHIFT) / TONE_LEGACY_SAMPLE_RATE);
+    uint32_t legacy_phase = 0;
+    uint32_t legacy_block = TONE_LEGACY_SAMPLE_RATE * VARIO_SYNTH_BLOCK_MS / 1000;
+    volatile int32_t sink = 0;
+
+    uint32_t bench_blocks = TONE_BENCH_SECONDS * 1000 / VARIO_SYNTH_BLOCK_MS;
+    double start = tone_now();
+    for (uint32_t i = 0; i < bench_blocks; i++) {
+        for (uint32_t j = 0; j < legacy_block; j++) {
+            legacy_phase += legacy_step;
+            legacy_phase = (legacy_phase >= legacy_wrap) ? legacy_phase - legacy_wrap : legacy_phase;
+            block[j] = (int16_t)((legacy_table[legacy_phase >> TONE_LEGACY_PHASE_SHIFT] * TONE_VOLUME) / 100);
+        }
+        sink += block[i % legacy_block];
+    }
+    double legacy_elapsed = tone_now() - start;
+    free(legacy_table);
+
+    /* Same oscillator loop through the DDS, then the complete render with glide and envelope */
+    double elapsed[2];
+    double render_elapsed[2];
+    uint32_t rates[2] = {TONE_LEGACY_SAMPLE_RATE, VARIO_SYNTH_LOW_SAMPLE_RATE};
+    uint32_t dma_bytes[2];
+    tone.status = VARIO_STATUS_LIFTING;
+    vario_tone_update(&tone_config, TONE_STEP_TO_SPEED, &tone);
+    tone.frequency = TONE_BENCH_FREQUENCY;
+    for (int k = 0; k < 2; k++) {
+        vario_synth_init(&synth, rates[k]);
+        dma_bytes[k] = VARIO_SYNTH_DMA_BUFFER_COUNT * synth.block_samples * sizeof(int16_t);
+        uint32_t step = vario_synth_frequency_to_step(&synth, TONE_BENCH_FREQUENCY);
+        uint32_t phase = 0;
+
+        start = tone_now();
+        for (uint32_t i = 0; i < bench_blocks; i++) {
+            for (uint32_t j = 0; j < synth.block_samples; j++) {
+                phase += step;
+                block[j] = (int16_t)((vario_synth_sine(phase) * TONE_VOLUME) / 100);
+            }
+            sink += block[i % synth.block_samples];
+        }
+        elapsed[k] = tone_now() - start;
+
+        start = tone_now();
+        for (uint32_t i = 0; i < bench_blocks; i++) {
+            vario_synth_render(&synth, &tone, TONE_VOLUME, block, synth.block_samples);
+            sink += block[i % synth.block_samples];
+        }
+        render_elapsed[k] = tone_now() - start;
+    }
+    (void)sink;
+
+    printf("per second of audio        flash    ram      oscillator  render\n");
+    printf("  legacy 44.1 kHz table    %-8zu %-8u %-8.1f us\n", sizeof(int16_t) * TONE_LEGACY_TABLE_COUNT,
+        (uint32_t)(sizeof(int16_t) * TONE_LEGACY_SAMPLE_RATE * TONE_LEGACY_CYCLE_MAXIMUM_MS / 1000 + sizeof(int16_t) * TONE_LEGACY_DMA_BUFFERS), legacy_elapsed * 1e6 / TONE_BENCH_SECONDS);
+    for (int k = 0; k < 2; k++) {
+        printf("  dds %5.1f kHz            %-8zu %-8zu %-8.1f us %.1f us\n", rates[k] / 1000.0, sizeof(int16_t) * SIN_TABLE_DATA_COUNT,
+            sizeof(int16_t) * VARIO_SYNTH_BLOCK_SAMPLES_MAX + dma_bytes[k], elapsed[k] * 1e6 / TONE_BENCH_SECONDS, render_elapsed[k] * 1e6 / TONE_BENCH_SECONDS);
+    }
+
+    return response_ms >= 0 && response_ms <= VARIO_SYNTH_BLOCK_MS && max_jump <= bound && sine_error < 2.0;
+}
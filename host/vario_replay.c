@@ -0,0 +1,348 @@
+#include <inttypes.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "core2forAWS.h"
+#include "replay.h"
+
+/*
+    Host runner of the vario signal chain.
+    vario_replay synthesize <dump>              write a synthetic step climb capture
+    vario_replay replay <dump> [csv]            replay a capture, one csv row per IMU period
+    vario_replay latency <dump>                 T50/T90 rise time of Kalman and legacy speed after each step
+    vario_replay bench <dump> [iterations]      signal chain throughput
+    vario_replay compensation [iterations]      fixed point barometer path against the double reference
+    vario_replay telemetry [iterations]         telemetry snapshot publish/read cost against per field mutexes
+    vario_replay tone [pcm]                     streaming tone synthesizer response, clicks and cost
+    vario_replay jitter <dump>                  speed noise and T90 with tick, read and data ready sample dating
+    vario_replay attitude [iterations]          AHRS accuracy over a scripted flight and its cost per sample
+    vario_replay boot                           boot stages ended by several sensor tasks, none left waiting
+*/
+
+#define REPLAY_BENCH_ITERATIONS         (20)
+#define REPLAY_COMPENSATION_ITERATIONS  (200)
+#define REPLAY_TELEMETRY_ITERATIONS     (1000000)
+#define REPLAY_ATTITUDE_ITERATIONS      (20)
+#define REPLAY_NOISE_WINDOW_US          (5 * 1000000LL)
+/* A settled estimate may dip this many noise standard deviations short of the rise fraction */
+#define REPLAY_NOISE_BAND               (3.0)
+
+static void replay_usage(const char * name) {
+    fprintf(stderr, "usage: %s synthesize <dump>\n", name);
+    fprintf(stderr, "       %s replay <dump> [csv]\n", name);
+    fprintf(stderr, "       %s latency <dump>\n", name);
+    fprintf(stderr, "       %s bench <dump> [iterations]\n", name);
+    fprintf(stderr, "       %s compensation [iterations]\n", name);
+    fprintf(stderr, "       %s telemetry [iterations]\n", name);
+    fprintf(stderr, "       %s tone [pcm]\n", name);
+    fprintf(stderr, "       %s history\n", name);
+    fprintf(stderr, "       %s jitter <dump>\n", name);
+    fprintf(stderr, "       %s attitude [iterations]\n", name);
+    fprintf(stderr, "       %s boot\n", name);
+}
+
+static const char * replay_status_name(vario_status_t status) {
+    switch (status) {
+        case VARIO_STATUS_LIFTING: return "lifting";
+        case VARIO_STATUS_SINKING: return "sinking";
+        default: return "gliding";
+    }
+}
+
+static void replay_csv_row(void * context, const replay_output_t * output) {
+    FILE * file = (FILE *)context;
+    fprintf(file, "%" PRId64 ",%.3f,%d,%d,%s,%d,%d,%d,%d\n", output->timestamp, output->altitude, output->speed, output->legacy_speed,
+        replay_status_name(output->tone.status), output->tone.frequency, output->tone.harmonic, output->tone.cycle, output->tone.duty);
+}
+
+static int replay_csv(const replay_dump_t * dump, const char * path) {
+    FILE * file = (path == NULL) ? stdout : fopen(path, "w");
+    if (file == NULL) {
+        fprintf(stderr, "can not create %s\n", path);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file, "timestamp_us,altitude_m,vspeed_cms,legacy_vspeed_cms,status,frequency_hz,harmonic_hz,cycle_ms,duty_ms\n");
+    replay_statistics_t statistics;
+    bool result = replay_run(dump, REPLAY_TIMING_DATA_READY, replay_csv_row, file, &statistics);
+
+    if (file != stdout) {
+        fclose(file);
+    }
+    fprintf(stderr, "%u baro samples, %u imu samples, %u outputs\n", statistics.baro_samples, statistics.imu_samples, statistics.outputs);
+
+    return result ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+typedef struct {
+    replay_output_t * outputs;
+    uint32_t count;
+    uint32_t capacity;
+} replay_collector_t;
+
+static void replay_collect(void * context, const replay_output_t * output) {
+    replay_collector_t * collector = (replay_collector_t *)context;
+    if (collector->count == collector->capacity) {
+        uint32_t capacity = (collector->capacity == 0) ? 4096 : collector->capacity * 2;
+        replay_output_t * outputs = realloc(collector->outputs, capacity * sizeof(replay_output_t));
+        if (outputs == NULL) {
+            return;
+        }
+        collector->outputs = outputs;
+        collector->capacity = capacity;
+    }
+    collector->outputs[collector->count++] = *output;
+}
+
+/*
+    Time from the step until the speed covers the given fraction of the change for good, -1 when it never settles.
+    Dips within band cm/s short of the fraction are the settled noise of the estimate and do not restart the count.
+*/
+static double replay_rise_time(const replay_collector_t * collector, int64_t start, int64_t stop, int32_t from, int32_t to, double fraction, double band, bool legacy) {
+    double rise_time = -1.0;
+    for (uint32_t i = 0; i < collector->count; i++) {
+        const replay_output_t * output = &collector->outputs[i];
+        if (output->timestamp < start) {
+            continue;
+        }
+        if (output->timestamp >= stop) {
+            break;
+        }
+        double speed = legacy ? output->legacy_speed : output->speed;
+        if ((speed - from) / (double)(to - from) < fraction - band / abs(to - from)) {
+            rise_time = -1.0;
+        } else if (rise_time < 0.0) {
+            rise_time = (output->timestamp - start) / 1000.0;
+        }
+    }
+
+    return rise_time;
+}
+
+/* Standard deviation of the speed over the settled tail of a segment */
+static double replay_noise(const replay_collector_t * collector, int64_t stop, bool legacy) {
+    double sum = 0.0;
+    double square_sum = 0.0;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < collector->count; i++) {
+        const replay_output_t * output = &collector->outputs[i];
+        if (output->timestamp >= stop - REPLAY_NOISE_WINDOW_US && output->timestamp < stop) {
+            double speed = legacy ? output->legacy_speed : output->speed;
+            sum += speed;
+            square_sum += speed * speed;
+            count++;
+        }
+    }
+
+    return (count < 2) ? 0.0 : sqrt(fmax(0.0, square_sum / count - (sum / count) * (sum / count)));
+}
+
+static int replay_latency(const replay_dump_t * dump) {
+    if (dump->step_count == 0) {
+        fprintf(stderr, "dump has no step markers\n");
+        return EXIT_FAILURE;
+    }
+
+    replay_collector_t collector;
+    memset(&collector, 0, sizeof(collector));
+    if (!replay_run(dump, REPLAY_TIMING_DATA_READY, replay_collect, &collector, NULL) || collector.count == 0) {
+        free(collector.outputs);
+        return EXIT_FAILURE;
+    }
+
+    printf("%12s %8s | %9s %9s %9s | %9s %9s %9s\n", "step_us", "cm/s", "kf_t50ms", "kf_t90ms", "kf_noise", "old_t50ms", "old_t90ms", "old_noise");
+
+    double kalman_total = 0.0;
+    double legacy_total = 0.0;
+    bool settled = true;
+    for (uint32_t i = 0; i < dump->step_count; i++) {
+        const replay_step_t * step = &dump->steps[i];
+        int32_t from = (i == 0) ? 0 : dump->steps[i - 1].speed;
+        int64_t stop = (i + 1 < dump->step_count) ? dump->steps[i + 1].timestamp : collector.outputs[collector.count - 1].timestamp + 1;
+        if (step->speed == from) {
+            continue;
+        }
+
+        double kalman_noise = replay_noise(&collector, stop, false);
+        double legacy_noise = replay_noise(&collector, stop, true);
+        double kalman_t50 = replay_rise_time(&collector, step->timestamp, stop, from, step->speed, 0.5, REPLAY_NOISE_BAND * kalman_noise, false);
+        double kalman_t90 = replay_rise_time(&collector, step->timestamp, stop, from, step->speed, 0.9, REPLAY_NOISE_BAND * kalman_noise, false);
+        double legacy_t50 = replay_rise_time(&collector, step->timestamp, stop, from, step->speed, 0.5, REPLAY_NOISE_BAND * legacy_noise, true);
+        double legacy_t90 = replay_rise_time(&collector, step->timestamp, stop, from, step->speed, 0.9, REPLAY_NOISE_BAND * legacy_noise, true);
+        printf("%12" PRId64 " %8d | %9.0f %9.0f %9.1f | %9.0f %9.0f %9.1f\n", step->timestamp, step->speed,
+            kalman_t50, kalman_t90, kalman_noise, legacy_t50, legacy_t90, legacy_noise);
+
+        settled = settled && (kalman_t90 >= 0.0) && (legacy_t90 >= 0.0);
+        kalman_total += kalman_t90;
+        legacy_total += legacy_t90;
+    }
+
+    if (!settled) {
+        printf("an estimate never settled within its step, no mean T90\n");
+    } else {
+        printf("mean T90: kalman %.0f ms, legacy %.0f ms\n", kalman_total / dump->step_count, legacy_total / dump->step_count);
+    }
+    free(collector.outputs);
+
+    // Regression check, both estimates must settle on every step and the fused one respond faster than the baro only path
+    return (settled && kalman_total < legacy_total) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/* Spread of the IMU read intervals of the capture, what a constant delta time ignores */
+static void replay_imu_intervals(const replay_dump_t * dump) {
+    double sum = 0.0;
+    double square_sum = 0.0;
+    int64_t minimum = INT64_MAX;
+    int64_t maximum = 0;
+    int64_t last = -1;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < dump->record_count; i++) {
+        const replay_record_t * record = &dump->records[i];
+        // One register read per period in older captures, one FIFO batch per period since the stream
+        if (record->addr != MPU6886_ADDRESS || (record->reg != MPU6886_GYRO_XOUT_H && record->operation != REPLAY_OPERATION_FIFO)) {
+            continue;
+        }
+        if (last >= 0) {
+            int64_t interval = record->timestamp - last;
+            minimum = (interval < minimum) ? interval : minimum;
+            maximum = (interval > maximum) ? interval : maximum;
+            sum += interval;
+            square_sum += (double)interval * interval;
+            count++;
+        }
+        last = record->timestamp;
+    }
+
+    if (count > 1) {
+        double mean = sum / count;
+        printf("imu interval: mean %.0f us, sd %.0f us, min %" PRId64 " us, max %" PRId64 " us\n", mean,
+            sqrt(fmax(0.0, square_sum / count - mean * mean)), minimum, maximum);
+    }
+}
+
+static int replay_jitter(const replay_dump_t * dump) {
+    static const char * const timing_names[] = { "ticks", "read", "data_ready" };
+    if (dump->step_count == 0) {
+        fprintf(stderr, "dump has no step markers\n");
+        return EXIT_FAILURE;
+    }
+
+    replay_imu_intervals(dump);
+    printf("%12s | %9s %9s %9s\n", "timing", "kf_noise", "kf_max", "kf_t90ms");
+
+    double noise[REPLAY_TIMING_DATA_READY + 1];
+    for (int timing = REPLAY_TIMING_TICKS; timing <= REPLAY_TIMING_DATA_READY; timing++) {
+        replay_collector_t collector;
+        memset(&collector, 0, sizeof(collector));
+        if (!replay_run(dump, (replay_timing_t)timing, replay_collect, &collector, NULL) || collector.count == 0) {
+            free(collector.outputs);
+            return EXIT_FAILURE;
+        }
+
+        // Noise averaged over the settled segments, T90 over the steps
+        double noise_sum = 0.0;
+        double noise_max = 0.0;
+        double t90_sum = 0.0;
+        for (uint32_t i = 0; i < dump->step_count; i++) {
+            const replay_step_t * step = &dump->steps[i];
+            int32_t from = (i == 0) ? 0 : dump->steps[i - 1].speed;
+            int64_t stop = (i + 1 < dump->step_count) ? dump->steps[i + 1].timestamp : collector.outputs[collector.count - 1].timestamp + 1;
+            double step_noise = replay_noise(&collector, stop, false);
+            noise_sum += step_noise;
+            noise_max = fmax(noise_max, step_noise);
+            t90_sum += (step->speed == from) ? 0.0 : replay_rise_time(&collector, step->timestamp, stop, from, step->speed, 0.9, REPLAY_NOISE_BAND * step_noise, false);
+        }
+        noise[timing] = noise_sum / dump->step_count;
+        printf("%12s | %9.2f %9.2f %9.0f\n", timing_names[timing], noise[timing], noise_max, t90_sum / dump->step_count);
+        free(collector.outputs);
+    }
+
+    // Regression check, dating samples at data ready must not be noisier than dating them by ticks. Only the mean is
+    // checked, the noise of one 5 s window moves by a few tenths with the sensor noise drawn whatever the timing.
+    return (noise[REPLAY_TIMING_DATA_READY] <= noise[REPLAY_TIMING_TICKS]) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static double replay_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+static int replay_bench(const replay_dump_t * dump, uint32_t iterations) {
+    replay_statistics_t statistics;
+    memset(&statistics, 0, sizeof(statistics));
+
+    double start = replay_now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        if (!replay_run(dump, REPLAY_TIMING_DATA_READY, NULL, NULL, &statistics)) {
+            return EXIT_FAILURE;
+        }
+    }
+    double elapsed = replay_now() - start;
+
+    double samples = (double)(statistics.baro_samples + statistics.imu_samples) * iterations;
+    double periods = (double)statistics.outputs * iterations;
+    printf("%u iterations, %u records, %.3f s\n", iterations, dump->record_count, elapsed);
+    printf("%.0f samples/s, %.2f us per %d ms IMU period\n", samples / elapsed, elapsed * 1e6 / periods, VARIO_MPU6886_PERIOD_MS);
+
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char * argv[]) {
+    if (argc >= 2 && strcmp(argv[1], "compensation") == 0) {
+        return replay_check_compensation((argc > 2) ? (uint32_t)atoi(argv[2]) : REPLAY_COMPENSATION_ITERATIONS) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "telemetry") == 0) {
+        return replay_benchmark_telemetry((argc > 2) ? (uint32_t)atoi(argv[2]) : REPLAY_TELEMETRY_ITERATIONS) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "tone") == 0) {
+        return replay_check_tone((argc > 2) ? argv[2] : NULL) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "history") == 0) {
+        return replay_check_history() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "attitude") == 0) {
+        return replay_check_attitude((argc > 2) ? (uint32_t)atoi(argv[2]) : REPLAY_ATTITUDE_ITERATIONS) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc >= 2 && strcmp(argv[1], "boot") == 0) {
+        return replay_check_boot() ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (argc < 3) {
+        replay_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (strcmp(argv[1], "synthesize") == 0) {
+        return replay_synthesize_step_climb(argv[2]) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    replay_dump_t dump;
+    if (!replay_load_dump(argv[2], &dump)) {
+        return EXIT_FAILURE;
+    }
+
+    int result;
+    if (strcmp(argv[1], "replay") == 0) {
+        result = replay_csv(&dump, (argc > 3) ? argv[3] : NULL);
+    } else if (strcmp(argv[1], "latency") == 0) {
+        result = replay_latency(&dump);
+    } else if (strcmp(argv[1], "jitter") == 0) {
+        result = replay_jitter(&dump);
+    } else if (strcmp(argv[1], "bench") == 0) {
+        result = replay_bench(&dump, (argc > 3) ? (uint32_t)atoi(argv[3]) : REPLAY_BENCH_ITERATIONS);
+    } else {
+        replay_usage(argv[0]);
+        result = EXIT_FAILURE;
+    }
+
+    replay_free_dump(&dump);
+    return result;
+}
@@ -0,0 +1,199 @@
+#include <math.h>
+
+#include "ahrs.h"
+#include "vario_signal.h"
+
+#define AHRS_DEGREE_TO_RADIAN           ((float)M_PI / 180.0f)
+#define AHRS_RADIAN_TO_DEGREE           (180.0f / (float)M_PI)
+
+void ahrs_init(ahrs_t * ahrs) {
+    ahrs->q[0] = 1.0f;
+    ahrs->q[1] = 0.0f;
+    ahrs->q[2] = 0.0f;
+    ahrs->q[3] = 0.0f;
+    ahrs->bias[0] = 0.0f;
+    ahrs->bias[1] = 0.0f;
+    ahrs->bias[2] = 0.0f;
+    ahrs->turn = 0.0f;
+    ahrs->tilt_aligned = false;
+    ahrs->heading_aligned = false;
+}
+
+static void ahrs_normalize(float q[4]) {
+    float norm = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    q[0] /= norm;
+    q[1] /= norm;
+    q[2] /= norm;
+    q[3] /= norm;
+}
+
+/* Turn the attitude by the body rate w in rad/s over delta_time, first order is exact enough at IMU rate */
+static void ahrs_rotate(ahrs_t * ahrs, float wx, float wy, float wz, float delta_time) {
+    float * q = ahrs->q;
+    float half = 0.5f * delta_time;
+    float q0 = q[0];
+    float q1 = q[1];
+    float q2 = q[2];
+    float q3 = q[3];
+
+    q[0] += (-q1 * wx - q2 * wy - q3 * wz) * half;
+    q[1] += (q0 * wx + q2 * wz - q3 * wy) * half;
+    q[2] += (q0 * wy - q1 * wz + q3 * wx) * half;
+    q[3] += (q0 * wz + q1 * wy - q2 * wx) * half;
+    ahrs_normalize(q);
+}
+
+/* Earth up in the body frame, the last row of the body to earth rotation */
+static void ahrs_up(const ahrs_t * ahrs, float up[3]) {
+    const float * q = ahrs->q;
+    up[0] = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+    up[1] = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+    up[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+}
+
+static float ahrs_clamp(float value, float limit) {
+    return (value > limit) ? limit : ((value < -limit) ? -limit : value);
+}
+
+/* Error rates are added to the gyro, the integral of them is the bias estimate */
+static void ahrs_integrate_bias(ahrs_t * ahrs, const float error[3], float delta_time) {
+    for (int i = 0; i < 3; i++) {
+        ahrs->bias[i] = ahrs_clamp(ahrs->bias[i] + AHRS_INTEGRAL_GAIN * error[i] * delta_time, AHRS_BIAS_MAX);
+    }
+}
+
+void ahrs_update(ahrs_t * ahrs, const float accel[3], const float gyro[3], float delta_time) {
+    float norm = sqrtf(accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2]);
+
+    // Roll and pitch start at the first usable gravity instead of converging from level
+    if (!ahrs->tilt_aligned) {
+        if (norm < AHRS_ACCEL_MIN) {
+            return;
+        }
+        float ax = accel[0] / norm;
+        float ay = accel[1] / norm;
+        float az = accel[2] / norm;
+        if (az > -0.999f) {
+            ahrs->q[0] = 1.0f + az;
+            ahrs->q[1] = ay;
+            ahrs->q[2] = -ax;
+        } else {
+            ahrs->q[0] = 0.0f;
+            ahrs->q[1] = 1.0f;
+            ahrs->q[2] = 0.0f;
+        }
+        ahrs->q[3] = 0.0f;
+        ahrs_normalize(ahrs->q);
+        ahrs->tilt_aligned = true;
+        return;
+    }
+
+    float wx = gyro[0] * AHRS_DEGREE_TO_RADIAN + ahrs->bias[0];
+    float wy = gyro[1] * AHRS_DEGREE_TO_RADIAN + ahrs->bias[1];
+    float wz = gyro[2] * AHRS_DEGREE_TO_RADIAN + ahrs->bias[2];
+
+    float up[3];
+    ahrs_up(ahrs, up);
+
+    // Gravity is the specific force less the centripetal acceleration, left of the track, the body x axis made level
+    float weight = (delta_time < AHRS_TURN_TIME) ? delta_time / AHRS_TURN_TIME : 1.0f;
+    ahrs->turn += (wx * up[0] + wy * up[1] + wz * up[2] - ahrs->turn) * weight;
+    float vx = 1.0f - up[0] * up[0];
+    float vy = -up[0] * up[1];
+    float vz = -up[0] * up[2];
+    float level = sqrtf(vx * vx + vy * vy + vz * vz);
+    float centripetal = (level > 0.1f) ? ahrs->turn * AHRS_AIRSPEED / (level * VARIO_GRAVITY_ACCELERATION) : 0.0f;
+    float gx = accel[0] - (up[1] * vz - up[2] * vy) * centripetal;
+    float gy = accel[1] - (up[2] * vx - up[0] * vz) * centripetal;
+    float gz = accel[2] - (up[0] * vy - up[1] * vx) * centripetal;
+
+    float accel_weight = (norm < AHRS_ACCEL_MIN) ? 0.0f : 1.0f - fabsf(norm - 1.0f) / AHRS_ACCEL_GATE;
+    if (accel_weight > 0.0f) {
+        // Measured gravity cross the estimated one is the axis and sine of the tilt error
+        float scale = accel_weight / sqrtf(gx * gx + gy * gy + gz * gz);
+        float error[3] = {
+            (gy * up[2] - gz * up[1]) * scale,
+            (gz * up[0] - gx * up[2]) * scale,
+            (gx * up[1] - gy * up[0]) * scale,
+        };
+        ahrs_integrate_bias(ahrs, error, delta_time);
+
+        wx += AHRS_ACCEL_GAIN * error[0];
+        wy += AHRS_ACCEL_GAIN * error[1];
+        wz += AHRS_ACCEL_GAIN * error[2];
+    }
+
+    ahrs_rotate(ahrs, wx, wy, wz, delta_time);
+}
+
+void ahrs_update_magnetometer(ahrs_t * ahrs, const float mag[3], float delta_time) {
+    // Without the vertical the horizontal part of the field is unknown
+    if (!ahrs->tilt_aligned) {
+        return;
+    }
+
+    // Field in the earth frame, only its north and west parts are used
+    const float * q = ahrs->q;
+    float north = (1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3])) * mag[0] + 2.0f * (q[1] * q[2] - q[0] * q[3]) * mag[1] + 2.0f * (q[1] * q[3] + q[0] * q[2]) * mag[2];
+    float west = 2.0f * (q[1] * q[2] + q[0] * q[3]) * mag[0] + (1.0f - 2.0f * (q[1] * q[1] + q[3] * q[3])) * mag[1] + 2.0f * (q[2] * q[3] - q[0] * q[1]) * mag[2];
+    float horizontal = sqrtf(north * north + west * west);
+    float total = sqrtf(mag[0] * mag[0] + mag[1] * mag[1] + mag[2] * mag[2]);
+    if (horizontal < AHRS_MAG_HORIZONTAL_MIN * total) {
+        return;
+    }
+
+    // The first heading is taken as measured, turning the attitude about the vertical
+    if (!ahrs->heading_aligned) {
+        float half = -0.5f * atan2f(west, north);
+        float c = cosf(half);
+        float s = sinf(half);
+        float q0 = ahrs->q[0];
+        float q1 = ahrs->q[1];
+        float q2 = ahrs->q[2];
+        float q3 = ahrs->q[3];
+        ahrs->q[0] = c * q0 - s * q3;
+        ahrs->q[1] = c * q1 - s * q2;
+        ahrs->q[2] = c * q2 + s * q1;
+        ahrs->q[3] = c * q3 + s * q0;
+        ahrs_normalize(ahrs->q);
+        ahrs->heading_aligned = true;
+        return;
+    }
+
+    // Sine of the heading error about the earth vertical, brought into the body frame
+    float up[3];
+    ahrs_up(ahrs, up);
+    float sine = -west / horizontal;
+    float error[3] = { sine * up[0], sine * up[1], sine * up[2] };
+    ahrs_integrate_bias(ahrs, error, delta_time);
+
+    ahrs_rotate(ahrs, AHRS_MAG_GAIN * error[0], AHRS_MAG_GAIN * error[1], AHRS_MAG_GAIN * error[2], delta_time);
+}
+
+float ahrs_vertical_acceleration(const ahrs_t * ahrs, const float accel[3]) {
+    // No usable accelerometer data, let the estimator run on the barometer alone
+    float norm = sqrtf(accel[0] * accel[0] + accel[1] * accel[1] + accel[2] * accel[2]);
+    if (!ahrs->tilt_aligned || norm < AHRS_ACCEL_MIN) {
+        return 0.0f;
+    }
+
+    float up[3];
+    ahrs_up(ahrs, up);
+    return (accel[0] * up[0] + accel[1] * up[1] + accel[2] * up[2] - 1.0f) * VARIO_GRAVITY_ACCELERATION;
+}
+
+float ahrs_get_heading(const ahrs_t * ahrs) {
+    // Body x axis in the earth frame, west is counter clockwise
+    const float * q = ahrs->q;
+    float north = 1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3]);
+    float west = 2.0f * (q[1] * q[2] + q[0] * q[3]);
+    float heading = atan2f(-west, north) * AHRS_RADIAN_TO_DEGREE;
+    return (heading < 0.0f) ? heading + 360.0f : heading;
+}
+
+void ahrs_get_tilt(const ahrs_t * ahrs, float * roll, float * pitch) {
+    const float * q = ahrs->q;
+    *roll = atan2f(2.0f * (q[0] * q[1] + q[2] * q[3]), 1.0f - 2.0f * (q[1] * q[1] + q[2] * q[2])) * AHRS_RADIAN_TO_DEGREE;
+    float sine = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+    *pitch = asinf((sine > 1.0f) ? 1.0f : ((sine < -1.0f) ? -1.0f : sine)) * AHRS_RADIAN_TO_DEGREE;
+}
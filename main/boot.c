@@ -0,0 +1,102 @@
+#include <inttypes.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "boot.h"
+
+#define TAG "BOOT"
+
+typedef enum {
+    BOOT_STATE_PENDING,
+    BOOT_STATE_RUNNING,
+    BOOT_STATE_DONE,
+    BOOT_STATE_FAILED,
+} boot_state_t;
+
+typedef struct {
+    const char * name;
+    boot_state_t state;
+    int64_t start;
+    int64_t end;
+} boot_stage_info_t;
+
+static boot_stage_info_t boot_stages[BOOT_STAGE_COUNT] = {
+    #ifdef DECLARE_BOOT_STAGE
+    #undef DECLARE_BOOT_STAGE
+    #endif
+    #define DECLARE_BOOT_STAGE(_index, _name) [_index] = {.name = _name, .state = BOOT_STATE_PENDING}
+    #include "boot_stage.inc"
+};
+
+static const char * boot_state_names[] = {"pending", "running", "ok", "failed"};
+
+/* One bit per ended stage, an event group holds 24 of them */
+static EventGroupHandle_t boot_events = NULL;
+/* Producers of each stage still trying, dropped from their own tasks */
+static _Atomic uint32_t boot_producers[BOOT_STAGE_COUNT];
+
+void boot_init(void) {
+    if (boot_events == NULL) {
+        boot_events = xEventGroupCreate();
+    }
+}
+
+void boot_stage_start(boot_stage_t stage) {
+    boot_stages[stage].start = esp_timer_get_time();
+    boot_stages[stage].state = BOOT_STATE_RUNNING;
+}
+
+void boot_stage_end(boot_stage_t stage, bool ok) {
+    boot_stages[stage].end = esp_timer_get_time();
+    boot_stages[stage].state = ok ? BOOT_STATE_DONE : BOOT_STATE_FAILED;
+    xEventGroupSetBits(boot_events, BOOT_STAGE_BIT(stage));
+}
+
+bool boot_stage_ended(boot_stage_t stage) {
+    return (xEventGroupGetBits(boot_events) & BOOT_STAGE_BIT(stage)) != 0;
+}
+
+bool boot_stage_ok(boot_stage_t stage) {
+    return boot_stage_ended(stage) && boot_stages[stage].state == BOOT_STATE_DONE;
+}
+
+void boot_stage_expect(boot_stage_t stage, uint32_t producers) {
+    atomic_store(&boot_producers[stage], producers);
+}
+
+void boot_stage_drop(boot_stage_t stage) {
+    if (atomic_fetch_sub(&boot_producers[stage], 1) == 1 && !boot_stage_ended(stage)) {
+        boot_stage_end(stage, false);
+    }
+}
+
+bool boot_wait(uint32_t stages, TickType_t ticks) {
+    EventBits_t bits = xEventGroupWaitBits(boot_events, stages, pdFALSE, pdTRUE, ticks);
+    return (bits & stages) == stages;
+}
+
+void boot_report(void) {
+    ESP_LOGI(TAG, "%-12s %8s %8s %8s %s", "stage", "start ms", "end ms", "ms", "result");
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        const boot_stage_info_t * stage = &boot_stages[i];
+        if (stage->state == BOOT_STATE_DONE || stage->state == BOOT_STATE_FAILED) {
+            ESP_LOGI(TAG, "%-12s %8" PRId64 " %8" PRId64 " %8" PRId64 " %s", stage->name, stage->start / 1000, stage->end / 1000,
+                (stage->end - stage->start) / 1000, boot_state_names[stage->state]);
+        } else {
+            ESP_LOGI(TAG, "%-12s %8s %8s %8s %s", stage->name, "", "", "", boot_state_names[stage->state]);
+        }
+    }
+
+    const boot_stage_info_t * audio = &boot_stages[BOOT_STAGE_AUDIO];
+    if (audio->state != BOOT_STATE_DONE) {
+        ESP_LOGW(TAG, "vario not audible after %d ms", BOOT_REPORT_TIMEOUT_MS);
+    } else if (audio->end / 1000 > BOOT_AUDIO_TARGET_MS) {
+        ESP_LOGW(TAG, "audio ready at %" PRId64 " ms, target %d ms", audio->end / 1000, BOOT_AUDIO_TARGET_MS);
+    } else {
+        ESP_LOGI(TAG, "audio ready at %" PRId64 " ms", audio->end / 1000);
+    }
+}
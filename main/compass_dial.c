@@ -0,0 +1,203 @@
+#include <math.h>
+
+#include "esp_timer.h"
+#include "compass_dial.h"
+
+#define COMPASS_DIAL_SINE_SHIFT         (14)
+#define COMPASS_DIAL_TICK_STEP          (10)
+#define COMPASS_DIAL_MAJOR_STEP         (30)
+#define COMPASS_DIAL_MAJOR_LENGTH       (14)
+#define COMPASS_DIAL_MINOR_LENGTH       (7)
+#define COMPASS_DIAL_BORDER_WIDTH       (2)
+/* Letters sit inside the ticks, the ring ends one letter below them */
+#define COMPASS_DIAL_LETTER_INSET       (30)
+/* 1/sqrt(2) in 1/256, half side of the square inscribed in the still center */
+#define COMPASS_DIAL_INSCRIBED          (181)
+
+#define COMPASS_DIAL_COLOR_BORDER       LV_COLOR_GRAY
+#define COMPASS_DIAL_COLOR_TICK         LV_COLOR_WHITE
+#define COMPASS_DIAL_COLOR_NORTH        LV_COLOR_RED
+#define COMPASS_DIAL_COLOR_LETTER       LV_COLOR_WHITE
+#define COMPASS_DIAL_COLOR_MARK         LV_COLOR_ORANGE
+
+typedef struct {
+    const lv_font_t * font;
+    int32_t heading;
+    float input;
+} compass_dial_ext_t;
+
+static const char * const compass_dial_letters[] = {"N", "E", "S", "W"};
+
+static int16_t compass_dial_sine[360];
+static bool compass_dial_sine_ready = false;
+static compass_dial_stats_t compass_dial_stats;
+
+static int32_t compass_dial_wrap(int32_t angle) {
+    angle %= 360;
+    return (angle < 0) ? angle + 360 : angle;
+}
+
+/* Card point of a bearing at a radius, for the heading at the top */
+static lv_point_t compass_dial_point(const lv_obj_t * dial, int32_t heading, int32_t bearing, int32_t radius) {
+    int32_t angle = compass_dial_wrap(bearing - heading);
+    int32_t half = (1 << (COMPASS_DIAL_SINE_SHIFT - 1));
+    lv_point_t point;
+    point.x = dial->coords.x1 + lv_obj_get_width(dial) / 2 + ((radius * compass_dial_sine[angle] + half) >> COMPASS_DIAL_SINE_SHIFT);
+    point.y = dial->coords.y1 + lv_obj_get_height(dial) / 2 - ((radius * compass_dial_sine[compass_dial_wrap(angle + 90)] + half) >> COMPASS_DIAL_SINE_SHIFT);
+    return point;
+}
+
+static lv_coord_t compass_dial_radius(const lv_obj_t * dial) {
+    return LV_MATH_MIN(lv_obj_get_width(dial), lv_obj_get_height(dial)) / 2 - 1;
+}
+
+static lv_coord_t compass_dial_ring_inner(const lv_obj_t * dial, const compass_dial_ext_t * ext) {
+    return compass_dial_radius(dial) - COMPASS_DIAL_LETTER_INSET - lv_font_get_line_height(ext->font) / 2 - 1;
+}
+
+static void compass_dial_draw(lv_obj_t * dial, const lv_area_t * clip_area) {
+    const compass_dial_ext_t * ext = lv_obj_get_ext_attr(dial);
+    lv_coord_t radius = compass_dial_radius(dial);
+    lv_coord_t center_x = dial->coords.x1 + lv_obj_get_width(dial) / 2;
+    lv_coord_t center_y = dial->coords.y1 + lv_obj_get_height(dial) / 2;
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_opa = LV_OPA_TRANSP;
+    rect_dsc.radius = LV_RADIUS_CIRCLE;
+    rect_dsc.border_width = COMPASS_DIAL_BORDER_WIDTH;
+    rect_dsc.border_color = COMPASS_DIAL_COLOR_BORDER;
+    lv_area_t ring = {center_x - radius, center_y - radius, center_x + radius, center_y + radius};
+    lv_draw_rect(&ring, clip_area, &rect_dsc);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = COMPASS_DIAL_COLOR_TICK;
+    lv_coord_t tick_outer = radius - COMPASS_DIAL_BORDER_WIDTH - 1;
+    for (int32_t bearing = 0; bearing < 360; bearing += COMPASS_DIAL_TICK_STEP) {
+        bool major = (bearing % COMPASS_DIAL_MAJOR_STEP) == 0;
+        line_dsc.width = major ? 2 : 1;
+        lv_point_t outer = compass_dial_point(dial, ext->heading, bearing, tick_outer);
+        lv_point_t inner = compass_dial_point(dial, ext->heading, bearing, tick_outer - (major ? COMPASS_DIAL_MAJOR_LENGTH : COMPASS_DIAL_MINOR_LENGTH));
+        lv_draw_line(&outer, &inner, clip_area, &line_dsc);
+    }
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = ext->font;
+    label_dsc.flag = LV_TXT_FLAG_CENTER;
+    lv_coord_t line_height = lv_font_get_line_height(ext->font);
+    for (int32_t i = 0; i < 4; i++) {
+        lv_point_t point = compass_dial_point(dial, ext->heading, i * 90, radius - COMPASS_DIAL_LETTER_INSET);
+        lv_area_t area = {point.x - line_height / 2, point.y - line_height / 2, point.x + line_height / 2, point.y + line_height / 2};
+        label_dsc.color = (i == 0) ? COMPASS_DIAL_COLOR_NORTH : COMPASS_DIAL_COLOR_LETTER;
+        lv_draw_label(&area, clip_area, &label_dsc, compass_dial_letters[i], NULL);
+    }
+
+    // Still heading mark in the center, it never moves with the card
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = COMPASS_DIAL_COLOR_MARK;
+    lv_coord_t mark = radius / 5;
+    lv_point_t triangle[3] = {
+        {center_x, center_y - mark},
+        {center_x + mark / 2, center_y + mark / 2},
+        {center_x - mark / 2, center_y + mark / 2},
+    };
+    lv_draw_triangle(triangle, clip_area, &rect_dsc);
+}
+
+static lv_design_res_t compass_dial_design(lv_obj_t * dial, const lv_area_t * clip_area, lv_design_mode_t mode) {
+    if (mode == LV_DESIGN_COVER_CHK) {
+        return LV_DESIGN_RES_NOT_COVER;
+    }
+
+    if (mode == LV_DESIGN_DRAW_MAIN) {
+        int64_t start = esp_timer_get_time();
+        compass_dial_draw(dial, clip_area);
+        uint32_t elapsed = (uint32_t)(esp_timer_get_time() - start);
+
+        compass_dial_stats.draws += 1;
+        compass_dial_stats.draw_us += elapsed;
+        compass_dial_stats.draw_us_max = LV_MATH_MAX(compass_dial_stats.draw_us_max, elapsed);
+    }
+
+    return LV_DESIGN_RES_OK;
+}
+
+lv_obj_t * compass_dial_create(lv_obj_t * parent, lv_coord_t size, const lv_font_t * font) {
+    if (!compass_dial_sine_ready) {
+        for (int i = 0; i < 360; i++) {
+            compass_dial_sine[i] = (int16_t)lroundf(sinf(i * (float)M_PI / 180.0f) * (1 << COMPASS_DIAL_SINE_SHIFT));
+        }
+        compass_dial_sine_ready = true;
+    }
+
+    lv_obj_t * dial = lv_obj_create(parent, NULL);
+    if (dial == NULL) {
+        return NULL;
+    }
+
+    compass_dial_ext_t * ext = lv_obj_allocate_ext_attr(dial, sizeof(compass_dial_ext_t));
+    if (ext == NULL) {
+        lv_obj_del(dial);
+        return NULL;
+    }
+    ext->font = font;
+    ext->heading = 0;
+    ext->input = 0.0f;
+
+    lv_obj_reset_style_list(dial, LV_OBJ_PART_MAIN);
+    lv_obj_set_design_cb(dial, compass_dial_design);
+    lv_obj_set_click(dial, false);
+    lv_obj_set_size(dial, size, size);
+
+    return dial;
+}
+
+bool compass_dial_set_heading(lv_obj_t * dial, float heading) {
+    compass_dial_ext_t * ext = lv_obj_get_ext_attr(dial);
+
+    // Jitter below the hysteresis around the last accepted input never moves the card
+    float delta = fmodf(heading - ext->input, 360.0f);
+    delta = (delta > 180.0f) ? delta - 360.0f : ((delta < -180.0f) ? delta + 360.0f : delta);
+    if (fabsf(delta) < COMPASS_DIAL_HYSTERESIS) {
+        return false;
+    }
+    ext->input = heading;
+
+    int32_t shown = compass_dial_wrap((int32_t)lroundf(heading));
+    if (shown == ext->heading) {
+        return false;
+    }
+    ext->heading = shown;
+
+    // Four bands around the square inscribed in the still center
+    lv_coord_t half = compass_dial_ring_inner(dial, ext) * COMPASS_DIAL_INSCRIBED / 256;
+    lv_coord_t center_x = dial->coords.x1 + lv_obj_get_width(dial) / 2;
+    lv_coord_t center_y = dial->coords.y1 + lv_obj_get_height(dial) / 2;
+    lv_area_t bands[4] = {
+        {dial->coords.x1, dial->coords.y1, dial->coords.x2, center_y - half - 1},
+        {dial->coords.x1, center_y + half + 1, dial->coords.x2, dial->coords.y2},
+        {dial->coords.x1, center_y - half, center_x - half - 1, center_y + half},
+        {center_x + half + 1, center_y - half, dial->coords.x2, center_y + half},
+    };
+    for (int i = 0; i < 4; i++) {
+        lv_obj_invalidate_area(dial, &bands[i]);
+    }
+
+    return true;
+}
+
+int32_t compass_dial_get_heading(const lv_obj_t * dial) {
+    const compass_dial_ext_t * ext = lv_obj_get_ext_attr(dial);
+    return ext->heading;
+}
+
+void compass_dial_get_stats(compass_dial_stats_t * stats, bool reset) {
+    *stats = compass_dial_stats;
+    if (reset) {
+        compass_dial_stats.draws = 0;
+        compass_dial_stats.draw_us = 0;
+        compass_dial_stats.draw_us_max = 0;
+    }
+}
@@ -1,3 +1,5 @@
+#include <stdatomic.h>
+
 #include "config.h"
 #include "freertos/semphr.h"
 #include "esp_log.h"
@@ -62,6 +64,157 @@ config_namespace_t config_namespace[] = {
 
 static SemaphoreHandle_t config_mutex = NULL;
 
+/* Generation 0 holds the compiled defaults, so readers started before config_load_all_namespace see sane values */
+static config_snapshot_t config_snapshots[CONFIG_SNAPSHOT_SLOTS] = {
+    {
+        .generation = 0,
+        .sound = {
+            #ifdef DECLARE_CONFIG_SOUND_STRING
+            #undef DECLARE_CONFIG_SOUND_STRING
+            #endif
+            #define DECLARE_CONFIG_SOUND_STRING(_index, _name, _type, ...) [_index] = 0
+            #ifdef DECLARE_CONFIG_SOUND_INTEGER
+            #undef DECLARE_CONFIG_SOUND_INTEGER
+            #endif
+            #define DECLARE_CONFIG_SOUND_INTEGER(_index, _name, _type, _value) [_index] = _value
+            #include "config_sound.inc"
+        },
+        .speed = {
+            #ifdef DECLARE_CONFIG_SPEED_STRING
+            #undef DECLARE_CONFIG_SPEED_STRING
+            #endif
+            #define DECLARE_CONFIG_SPEED_STRING(_index, _name, _type, ...) [_index] = 0
+            #ifdef DECLARE_CONFIG_SPEED_INTEGER
+            #undef DECLARE_CONFIG_SPEED_INTEGER
+            #endif
+            #define DECLARE_CONFIG_SPEED_INTEGER(_index, _name, _type, _value) [_index] = _value
+            #include "config_speed.inc"
+        },
+        .system = {
+            #ifdef DECLARE_CONFIG_SYSTEM_STRING
+            #undef DECLARE_CONFIG_SYSTEM_STRING
+            #endif
+            #define DECLARE_CONFIG_SYSTEM_STRING(_index, _name, _type, ...) [_index] = 0
+            #ifdef DECLARE_CONFIG_SYSTEM_INTEGER
+            #undef DECLARE_CONFIG_SYSTEM_INTEGER
+            #endif
+            #define DECLARE_CONFIG_SYSTEM_INTEGER(_index, _name, _type, _value) [_index] = _value
+            #include "config_system.inc"
+        },
+        .bluetooth = {
+            #ifdef DECLARE_CONFIG_BLUETOOTH_STRING
+            #undef DECLARE_CONFIG_BLUETOOTH_STRING
+            #endif
+            #define DECLARE_CONFIG_BLUETOOTH_STRING(_index, _name, _type, ...) [_index] = 0
+            #ifdef DECLARE_CONFIG_BLUETOOTH_INTEGER
+            #undef DECLARE_CONFIG_BLUETOOTH_INTEGER
+            #endif
+            #define DECLARE_CONFIG_BLUETOOTH_INTEGER(_index, _name, _type, _value) [_index] = _value
+            #include "config_bluetooth.inc"
+        },
+    },
+};
+
+static config_snapshot_t * _Atomic config_current_snapshot = &config_snapshots[0];
+
+typedef struct {
+    TaskHandle_t task;
+    uint32_t notify_bits;
+} config_subscriber_t;
+
+static config_subscriber_t config_subscribers[CONFIG_SUBSCRIBER_MAX];
+
+static int32_t * config_snapshot_integers(config_snapshot_t * snapshot, int namespace_index) {
+    switch (namespace_index) {
+    case CONFIG_NAMESPACE_SOUND:
+        return snapshot->sound;
+    case CONFIG_NAMESPACE_SPEED:
+        return snapshot->speed;
+    case CONFIG_NAMESPACE_SYSTEM:
+        return snapshot->system;
+    case CONFIG_NAMESPACE_BLUETOOTH:
+        return snapshot->bluetooth;
+    default:
+        return NULL;
+    }
+}
+
+/* Called with config_mutex held, the mutex serializes writers and readers never take it */
+static void config_publish_snapshot(void) {
+    config_snapshot_t * current = atomic_load_explicit(&config_current_snapshot, memory_order_relaxed);
+    unsigned int generation = atomic_load_explicit(&current->generation, memory_order_relaxed) + 2;
+    config_snapshot_t * snapshot = &config_snapshots[generation / 2 % CONFIG_SNAPSHOT_SLOTS];
+
+    // A reader still copying the recycled slot sees the odd generation and retries
+    atomic_store_explicit(&snapshot->generation, generation - 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    for (int i=0; config_namespace[i].name != NULL; i++) {
+        int32_t * integers = config_snapshot_integers(snapshot, i);
+        for (int j=0; config_namespace[i].config_items[j].name != NULL; j++) {
+            config_item_t * item = &(config_namespace[i].config_items[j]);
+            integers[j] = (item->type == NVS_TYPE_I32) ? item->integer : 0;
+        }
+    }
+
+    atomic_store_explicit(&snapshot->generation, generation, memory_order_release);
+    atomic_store_explicit(&config_current_snapshot, snapshot, memory_order_release);
+
+    for (int i=0; i<CONFIG_SUBSCRIBER_MAX; i++) {
+        if (config_subscribers[i].task != NULL) {
+            xTaskNotify(config_subscribers[i].task, config_subscribers[i].notify_bits, eSetBits);
+        }
+    }
+}
+
+void config_read_snapshot(config_snapshot_t * snapshot) {
+    for (int retries = 0; ; retries++) {
+        if (retries >= CONFIG_READ_RETRIES) {
+            vTaskDelay(1);
+            retries = 0;
+        }
+
+        const config_snapshot_t * current = atomic_load_explicit(&config_current_snapshot, memory_order_acquire);
+        unsigned int generation = atomic_load_explicit(&current->generation, memory_order_acquire);
+        if (generation & 1) {
+            continue;
+        }
+
+        *snapshot = *current;
+        atomic_thread_fence(memory_order_acquire);
+
+        if (generation == atomic_load_explicit(&current->generation, memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+
+bool config_snapshot_changed(uint32_t generation) {
+    const config_snapshot_t * current = atomic_load_explicit(&config_current_snapshot, memory_order_acquire);
+    return atomic_load_explicit(&current->generation, memory_order_relaxed) != generation;
+}
+
+esp_err_t config_subscribe(TaskHandle_t task, uint32_t notify_bits) {
+    esp_err_t ret = ESP_FAIL;
+
+    xSemaphoreTake(config_mutex, portMAX_DELAY);
+    for (int i=0; i<CONFIG_SUBSCRIBER_MAX; i++) {
+        if (config_subscribers[i].task == NULL) {
+            config_subscribers[i].task = task;
+            config_subscribers[i].notify_bits = notify_bits;
+            ret = ESP_OK;
+            break;
+        }
+    }
+    xSemaphoreGive(config_mutex);
+
+    if (ret != ESP_OK) {
+        ESP_LOGI("CONFIG", "config_subscribe no free subscriber slot");
+    }
+
+    return ret;
+}
+
 void config_load_all_namespace(void) {
     if (config_mutex == NULL) {
         config_mutex = xSemaphoreCreateMutex();
@@ -86,7 +239,7 @@ esp_err_t config_load_item(int namespace_index, int index) {
     esp_err_t ret;
 
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_load_item invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else {
@@ -143,6 +296,10 @@ esp_err_t config_load_item(int namespace_index, int index) {
 
     ESP_LOGI("CONFIG", "load item %s %s %d", config_namespace[namespace_index].name, config_namespace[namespace_index].config_items[index].name, config_namespace[namespace_index].config_items[index].integer);
 
+    if (ret == ESP_OK) {
+        config_publish_snapshot();
+    }
+
     xSemaphoreGive(config_mutex);
 
     return ret;
@@ -153,7 +310,7 @@ esp_err_t config_save_item(int namespace_index, int index) {
     esp_err_t ret;
 
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_save_item invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else {
@@ -206,7 +363,7 @@ esp_err_t config_save_item(int namespace_index, int index) {
 esp_err_t _config_get_integer(int namespace_index, int index, int32_t * integer) {
     esp_err_t ret;
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_get_integer invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else if (config_namespace[namespace_index].config_items[index].type != NVS_TYPE_I32) {
@@ -224,7 +381,7 @@ esp_err_t _config_get_integer(int namespace_index, int index, int32_t * integer)
 esp_err_t _config_get_string(int namespace_index, int index, char * string, size_t size) {
     esp_err_t ret;
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_get_string invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else if (config_namespace[namespace_index].config_items[index].type != NVS_TYPE_STR) {
@@ -243,9 +400,10 @@ esp_err_t _config_get_string(int namespace_index, int index, char * string, size
 }
 
 int32_t config_get_integer(int namespace_index, int index) {
-    int32_t integer;
+    int32_t integer = 0;
     esp_err_t ret = _config_get_integer(namespace_index, index, &integer);
     assert(ret == ESP_OK);
+    (void)ret;
     return integer;
 }
 
@@ -253,13 +411,14 @@ char * config_get_malloc_string(int namespace_index, int index) {
     char * string = malloc(sizeof(char) * CONFIG_STRING_MAX_LENGTH);
     esp_err_t ret = _config_get_string(namespace_index, index, string, CONFIG_STRING_MAX_LENGTH);
     assert(ret == ESP_OK);
+    (void)ret;
     return string;
 }
 
 esp_err_t _config_set_integer(int namespace_index, int index, int32_t integer, bool save_to_nvs) {
     esp_err_t ret;
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_set_integer invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else if (config_namespace[namespace_index].config_items[index].type != NVS_TYPE_I32) {
@@ -267,6 +426,7 @@ esp_err_t _config_set_integer(int namespace_index, int index, int32_t integer, b
         ret = ESP_FAIL;
     } else {
         config_namespace[namespace_index].config_items[index].integer = integer;
+        config_publish_snapshot();
         if (save_to_nvs) {
             xSemaphoreGive(config_mutex);
             ret = config_save_item(namespace_index, index);
@@ -283,7 +443,7 @@ esp_err_t _config_set_integer(int namespace_index, int index, int32_t integer, b
 esp_err_t _config_set_string(int namespace_index, int index, const char * string, bool save_to_nvs) {
     esp_err_t ret;
     xSemaphoreTake(config_mutex, portMAX_DELAY);
-    if (namespace_index >= CONFIG_NAMESPACE_ANY || index >= config_namespace[namespace_index].item_count) {
+    if (namespace_index >= CONFIG_NAMESPACE_ANY || (uint32_t)index >= config_namespace[namespace_index].item_count) {
         ESP_LOGI("CONFIG", "config_set_integer invalid parameter namespace_index:%d, index:%d", namespace_index, index);
         ret = ESP_FAIL;
     } else if (config_namespace[namespace_index].config_items[index].type != NVS_TYPE_STR) {
@@ -294,6 +454,7 @@ esp_err_t _config_set_string(int namespace_index, int index, const char * string
         ret = ESP_FAIL;
     } else {
         strcpy(config_namespace[namespace_index].config_items[index].string, string);
+        config_publish_snapshot();
         if (save_to_nvs) {
             xSemaphoreGive(config_mutex);
             ret = config_save_item(namespace_index, index);
@@ -0,0 +1,133 @@
+#include "esp_log.h"
+#include "display_power.h"
+
+typedef struct {
+    const char * name;
+    uint32_t timeout_s;
+    int32_t percent;
+} display_power_stage_config_t;
+
+/* A timeout of 0 skips the stage, percent is of the set brightness */
+static const display_power_stage_config_t display_power_stages[DISPLAY_POWER_STAGE_COUNT] = {
+    {"active",  0,                                      100},
+    {"dim",     CONFIG_DISPLAY_POWER_DIM_TIMEOUT,       50},
+    {"low",     CONFIG_DISPLAY_POWER_LOW_TIMEOUT,       0},
+    {"sleep",   CONFIG_DISPLAY_POWER_SLEEP_TIMEOUT,     0},
+};
+
+static display_power_stage_t display_power_stage = DISPLAY_POWER_ACTIVE;
+static int32_t display_power_brightness = 0;
+static TickType_t display_power_last_activity = 0;
+static TickType_t display_power_stage_start = 0;
+static int32_t display_power_vario_speed = 0;
+static bool display_power_input_blocked = false;
+
+static void display_power_apply_brightness(void) {
+    Core2ForAWS_Display_SetBrightness(display_power_brightness * display_power_stages[display_power_stage].percent / 100);
+}
+
+/* Called with the GUI mutex held */
+static void display_power_enable_input(bool enable) {
+    lv_indev_t * indev = NULL;
+    while ((indev = lv_indev_get_next(indev)) != NULL) {
+        lv_indev_enable(indev, enable);
+    }
+}
+
+static void display_power_enter(display_power_stage_t stage) {
+    // Measured before leaving, by now the stage draws its steady current
+    TickType_t now = xTaskGetTickCount();
+    ESP_LOGI("DISPLAY", "%s -> %s after %u s in %s, battery %.1f mA",
+             display_power_stages[display_power_stage].name, display_power_stages[stage].name,
+             (unsigned)((now - display_power_stage_start) / configTICK_RATE_HZ), display_power_stages[display_power_stage].name,
+             Core2ForAWS_PMU_GetBatCurrent());
+
+    if (stage == DISPLAY_POWER_SLEEP) {
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        display_power_enable_input(false);
+        Core2ForAWS_Display_Sleep(true);
+        xSemaphoreGive(xGuiSemaphore);
+        display_power_stage = stage;
+    } else if (display_power_stage == DISPLAY_POWER_SLEEP) {
+        display_power_stage = stage;
+        display_power_apply_brightness();
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        Core2ForAWS_Display_Sleep(false);
+        display_power_enable_input(!display_power_input_blocked);
+        xSemaphoreGive(xGuiSemaphore);
+    } else {
+        display_power_stage = stage;
+        display_power_apply_brightness();
+    }
+    display_power_stage_start = now;
+}
+
+void display_power_init(int32_t brightness) {
+    display_power_brightness = brightness;
+    display_power_last_activity = xTaskGetTickCount();
+    display_power_stage_start = display_power_last_activity;
+}
+
+void display_power_set_brightness(int32_t brightness) {
+    brightness = ((brightness > 100) ? 100 : ((brightness < 0) ? 0 : brightness));
+    if (brightness != display_power_brightness) {
+        display_power_brightness = brightness;
+        if (display_power_stage != DISPLAY_POWER_SLEEP) {
+            display_power_apply_brightness();
+        }
+    }
+}
+
+bool display_power_activity(void) {
+    bool asleep = (display_power_stage == DISPLAY_POWER_SLEEP);
+    display_power_last_activity = xTaskGetTickCount();
+    if (display_power_stage != DISPLAY_POWER_ACTIVE) {
+        display_power_enter(DISPLAY_POWER_ACTIVE);
+    }
+    return asleep;
+}
+
+bool display_power_touch(bool pressed) {
+    if (pressed) {
+        // Set first, the wake up leaves the LVGL input off until the release
+        if (display_power_stage == DISPLAY_POWER_SLEEP) {
+            display_power_input_blocked = true;
+        }
+        display_power_activity();
+        return display_power_input_blocked;
+    }
+
+    if (display_power_input_blocked) {
+        display_power_input_blocked = false;
+        xSemaphoreTake(xGuiSemaphore, portMAX_DELAY);
+        display_power_enable_input(true);
+        xSemaphoreGive(xGuiSemaphore);
+        return true;
+    }
+    return false;
+}
+
+void display_power_vario(int32_t speed) {
+    if (speed - display_power_vario_speed >= DISPLAY_POWER_VARIO_STEP || display_power_vario_speed - speed >= DISPLAY_POWER_VARIO_STEP) {
+        display_power_vario_speed = speed;
+        display_power_activity();
+    }
+}
+
+void display_power_update(void) {
+    uint32_t idle_s = (xTaskGetTickCount() - display_power_last_activity) / configTICK_RATE_HZ;
+
+    display_power_stage_t stage = display_power_stage;
+    for (int i = display_power_stage + 1; i < DISPLAY_POWER_STAGE_COUNT; i++) {
+        if (display_power_stages[i].timeout_s > 0 && idle_s >= display_power_stages[i].timeout_s) {
+            stage = i;
+        }
+    }
+    if (stage != display_power_stage) {
+        display_power_enter(stage);
+    }
+}
+
+display_power_stage_t display_power_get_stage(void) {
+    return display_power_stage;
+}
@@ -0,0 +1,255 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "esp_log.h"
+#include "esp_spiffs.h"
+#include "font_loader.h"
+
+/* Layout written by tools/font_subset.py, little endian */
+#define FONT_LOADER_MAGIC               "BTF1"
+#define FONT_LOADER_HEADER_SIZE         (28)
+#define FONT_LOADER_GLYPH_SIZE          (12)
+#define FONT_LOADER_BPP                 (4)
+/* LV_FONT_FMT_TXT_COMPRESSED_NO_PREFILTER is 1 in this LVGL by mistake, the decoder only prefilters format 1 */
+#define FONT_LOADER_NO_PREFILTER        (2)
+#define FONT_LOADER_NAME_LENGTH         (16)
+
+typedef struct {
+    lv_font_t font;             /* first, the bitmap callback gets back here from the font */
+    char name[FONT_LOADER_NAME_LENGTH];
+    lv_font_fmt_txt_dsc_t dsc;
+    lv_font_fmt_txt_cmap_t cmap;
+    lv_font_fmt_txt_kern_pair_t kern;
+    uint8_t * data;             /* the file, kerning and bitmaps point into it */
+    uint32_t size;
+    lv_font_fmt_txt_glyph_dsc_t * glyphs;
+    uint16_t * unicode_list;
+} font_loader_font_t;
+
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    uint32_t used;
+    uint32_t capacity;
+    uint8_t * bitmap;
+} font_loader_glyph_t;
+
+static bool font_loader_mounted = false;
+static font_loader_font_t * font_loader_fonts[FONT_LOADER_MAX_FONTS];
+static font_loader_glyph_t font_loader_cache[FONT_LOADER_CACHE_GLYPHS];
+static uint32_t font_loader_clock = 0;
+static font_loader_stats_t font_loader_stats;
+
+static uint16_t font_loader_u16(const uint8_t * data) {
+    return (uint16_t)(data[0] | (data[1] << 8));
+}
+
+static uint32_t font_loader_u32(const uint8_t * data) {
+    return (uint32_t)data[0] | ((uint32_t)data[1] << 8) | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/* Decoded glyphs are copied out of the one LVGL buffer, the least recently used slot is reused */
+static const uint8_t * font_loader_get_bitmap(const lv_font_t * font, uint32_t letter) {
+    font_loader_glyph_t * victim = &font_loader_cache[0];
+    for (int i = 0; i < FONT_LOADER_CACHE_GLYPHS; i++) {
+        font_loader_glyph_t * glyph = &font_loader_cache[i];
+        if (glyph->font == font && glyph->letter == letter) {
+            glyph->used = ++font_loader_clock;
+            font_loader_stats.hits += 1;
+            return glyph->bitmap;
+        }
+        if (glyph->used < victim->used) {
+            victim = glyph;
+        }
+    }
+
+    lv_font_glyph_dsc_t dsc;
+    const uint8_t * bitmap = lv_font_get_bitmap_fmt_txt(font, letter);
+    if (bitmap == NULL || !lv_font_get_glyph_dsc_fmt_txt(font, &dsc, letter, 0)) {
+        return bitmap;
+    }
+    font_loader_stats.misses += 1;
+
+    uint32_t size = ((uint32_t)dsc.box_w * dsc.box_h * FONT_LOADER_BPP + 7) / 8;
+    if (victim->capacity < size) {
+        uint8_t * grown = realloc(victim->bitmap, size);
+        if (grown == NULL) {
+            // Still drawn, only not cached
+            return bitmap;
+        }
+        font_loader_stats.cache_bytes += size - victim->capacity;
+        victim->bitmap = grown;
+        victim->capacity = size;
+    }
+    memcpy(victim->bitmap, bitmap, size);
+    victim->font = font;
+    victim->letter = letter;
+    victim->used = ++font_loader_clock;
+
+    return victim->bitmap;
+}
+
+static bool font_loader_parse(font_loader_font_t * font) {
+    const uint8_t * data = font->data;
+    if (font->size < FONT_LOADER_HEADER_SIZE || memcmp(data, FONT_LOADER_MAGIC, 4) != 0) {
+        return false;
+    }
+
+    uint8_t bpp = data[4];
+    uint8_t bitmap_format = data[5];
+    uint8_t glyph_count = data[6];
+    uint16_t kern_count = font_loader_u16(&data[18]);
+    uint32_t bitmap_size = font_loader_u32(&data[24]);
+    uint32_t kern_offset = FONT_LOADER_HEADER_SIZE + glyph_count * FONT_LOADER_GLYPH_SIZE;
+    uint32_t bitmap_offset = kern_offset + kern_count * 3;
+    if (bpp != FONT_LOADER_BPP || (bitmap_format != LV_FONT_FMT_TXT_COMPRESSED && bitmap_format != FONT_LOADER_NO_PREFILTER) ||
+        glyph_count == 0 || bitmap_offset + bitmap_size != font->size) {
+        return false;
+    }
+
+    // Glyph id 0 is reserved
+    font->glyphs = calloc(glyph_count + 1, sizeof(lv_font_fmt_txt_glyph_dsc_t));
+    font->unicode_list = calloc(glyph_count, sizeof(uint16_t));
+    if (font->glyphs == NULL || font->unicode_list == NULL) {
+        return false;
+    }
+    for (int i = 0; i < glyph_count; i++) {
+        const uint8_t * record = &data[FONT_LOADER_HEADER_SIZE + i * FONT_LOADER_GLYPH_SIZE];
+        lv_font_fmt_txt_glyph_dsc_t * glyph = &font->glyphs[i + 1];
+        font->unicode_list[i] = font_loader_u16(&record[0]);
+        glyph->adv_w = font_loader_u16(&record[2]);
+        glyph->bitmap_index = font_loader_u32(&record[4]);
+        glyph->box_w = record[8];
+        glyph->box_h = record[9];
+        glyph->ofs_x = (int8_t)record[10];
+        glyph->ofs_y = (int8_t)record[11];
+        if (glyph->bitmap_index >= bitmap_size || (i > 0 && font->unicode_list[i] <= font->unicode_list[i - 1])) {
+            return false;
+        }
+    }
+
+    font->cmap.range_start = font_loader_u32(&data[20]);
+    font->cmap.range_length = font->unicode_list[glyph_count - 1] + 1;
+    font->cmap.glyph_id_start = 1;
+    font->cmap.unicode_list = font->unicode_list;
+    font->cmap.list_length = glyph_count;
+    font->cmap.type = LV_FONT_FMT_TXT_CMAP_SPARSE_TINY;
+
+    font->kern.glyph_ids = &data[kern_offset];
+    font->kern.values = (const int8_t *)&data[kern_offset + kern_count * 2];
+    font->kern.pair_cnt = kern_count;
+    font->kern.glyph_ids_size = 0;
+
+    font->dsc.glyph_bitmap = &data[bitmap_offset];
+    font->dsc.glyph_dsc = font->glyphs;
+    font->dsc.cmaps = &font->cmap;
+    font->dsc.kern_dsc = (kern_count > 0) ? &font->kern : NULL;
+    font->dsc.kern_scale = font_loader_u16(&data[16]);
+    font->dsc.cmap_num = 1;
+    font->dsc.bpp = bpp;
+    font->dsc.kern_classes = 0;
+    font->dsc.bitmap_format = bitmap_format;
+
+    font->font.get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->font.get_glyph_bitmap = font_loader_get_bitmap;
+    font->font.line_height = (int16_t)font_loader_u16(&data[8]);
+    font->font.base_line = (int16_t)font_loader_u16(&data[10]);
+    font->font.subpx = LV_FONT_SUBPX_NONE;
+    font->font.underline_position = (int8_t)font_loader_u16(&data[12]);
+    font->font.underline_thickness = (int8_t)font_loader_u16(&data[14]);
+    font->font.dsc = &font->dsc;
+
+    return true;
+}
+
+static void font_loader_free(font_loader_font_t * font) {
+    free(font->unicode_list);
+    free(font->glyphs);
+    free(font->data);
+    free(font);
+}
+
+static font_loader_font_t * font_loader_load(const char * name) {
+    char path[FONT_LOADER_NAME_LENGTH + sizeof(FONT_LOADER_BASE_PATH) + 8];
+    snprintf(path, sizeof(path), "%s/%s.fnt", FONT_LOADER_BASE_PATH, name);
+
+    struct stat info;
+    if (stat(path, &info) != 0 || info.st_size <= 0) {
+        ESP_LOGE("FONT", "%s not found", path);
+        return NULL;
+    }
+
+    font_loader_font_t * font = calloc(1, sizeof(font_loader_font_t));
+    if (font == NULL) {
+        return NULL;
+    }
+    snprintf(font->name, sizeof(font->name), "%s", name);
+    font->size = info.st_size;
+    font->data = malloc(font->size);
+
+    FILE * file = fopen(path, "rb");
+    bool loaded = (font->data != NULL) && (file != NULL) && (fread(font->data, 1, font->size, file) == font->size);
+    if (file != NULL) {
+        fclose(file);
+    }
+    if (!loaded || !font_loader_parse(font)) {
+        ESP_LOGE("FONT", "%s could not be loaded", path);
+        font_loader_free(font);
+        return NULL;
+    }
+
+    ESP_LOGI("FONT", "%s loaded, %u glyphs in %u bytes", path, font->cmap.list_length, font->size);
+    return font;
+}
+
+esp_err_t font_loader_init(void) {
+    if (font_loader_mounted) {
+        return ESP_OK;
+    }
+
+    esp_vfs_spiffs_conf_t conf = {
+        .base_path = FONT_LOADER_BASE_PATH,
+        .partition_label = FONT_LOADER_PARTITION,
+        .max_files = 2,
+        .format_if_mount_failed = false,
+    };
+    esp_err_t ret = esp_vfs_spiffs_register(&conf);
+    if (ret != ESP_OK) {
+        ESP_LOGE("FONT", "esp_vfs_spiffs_register return %x", ret);
+        return ret;
+    }
+
+    font_loader_mounted = true;
+    return ESP_OK;
+}
+
+const lv_font_t * font_loader_get(const char * name) {
+    int free_slot = -1;
+    for (int i = 0; i < FONT_LOADER_MAX_FONTS; i++) {
+        if (font_loader_fonts[i] == NULL) {
+            free_slot = (free_slot < 0) ? i : free_slot;
+        } else if (strcmp(font_loader_fonts[i]->name, name) == 0) {
+            return &font_loader_fonts[i]->font;
+        }
+    }
+
+    if (free_slot < 0 || strlen(name) >= FONT_LOADER_NAME_LENGTH || font_loader_init() != ESP_OK) {
+        return NULL;
+    }
+    font_loader_font_t * font = font_loader_load(name);
+    if (font == NULL) {
+        return NULL;
+    }
+
+    font_loader_fonts[free_slot] = font;
+    font_loader_stats.fonts += 1;
+    font_loader_stats.font_bytes += font->size + (font->cmap.list_length + 1) * sizeof(lv_font_fmt_txt_glyph_dsc_t) +
+                                    font->cmap.list_length * sizeof(uint16_t) + sizeof(font_loader_font_t);
+    return &font->font;
+}
+
+void font_loader_get_stats(font_loader_stats_t * stats) {
+    *stats = font_loader_stats;
+}
@@ -0,0 +1,62 @@
+#include <math.h>
+#include <stdatomic.h>
+
+#include "history.h"
+
+static history_sample_t history_samples[HISTORY_LENGTH];
+static atomic_uint history_appended = 0;
+
+/* Producer side, only the estimator task touches them */
+static int64_t history_period_end = 0;
+static int32_t history_speed_sum = 0;
+static int32_t history_speed_count = 0;
+
+static int16_t history_clamp(int32_t value) {
+    return (int16_t)((value > INT16_MAX) ? INT16_MAX : ((value < INT16_MIN) ? INT16_MIN : value));
+}
+
+bool history_add(int64_t timestamp, float altitude, int32_t speed) {
+    if (history_period_end == 0) {
+        history_period_end = timestamp + HISTORY_PERIOD_US;
+    }
+
+    history_speed_sum += speed;
+    history_speed_count += 1;
+    if (timestamp < history_period_end) {
+        return false;
+    }
+
+    unsigned int index = atomic_load_explicit(&history_appended, memory_order_relaxed);
+    history_sample_t * sample = &history_samples[index % HISTORY_LENGTH];
+    sample->altitude = history_clamp((int32_t)lroundf(altitude));
+    sample->speed = history_clamp(history_speed_sum / history_speed_count);
+    atomic_store_explicit(&history_appended, index + 1, memory_order_release);
+
+    // Periods stay on the second, a stalled task starts over instead of appending a burst
+    history_period_end += HISTORY_PERIOD_US;
+    if (timestamp >= history_period_end) {
+        history_period_end = timestamp + HISTORY_PERIOD_US;
+    }
+    history_speed_sum = 0;
+    history_speed_count = 0;
+
+    return true;
+}
+
+uint32_t history_count(void) {
+    return atomic_load_explicit(&history_appended, memory_order_acquire);
+}
+
+bool history_read(uint32_t index, history_sample_t * sample) {
+    uint32_t count = atomic_load_explicit(&history_appended, memory_order_acquire);
+    if (index >= count || count - index >= HISTORY_LENGTH) {
+        return false;
+    }
+
+    *sample = history_samples[index % HISTORY_LENGTH];
+    atomic_thread_fence(memory_order_acquire);
+
+    // The slot of index is written again while appending index + HISTORY_LENGTH
+    count = atomic_load_explicit(&history_appended, memory_order_relaxed);
+    return (count - index) < HISTORY_LENGTH;
+}
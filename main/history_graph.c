@@ -0,0 +1,164 @@
+#include <string.h>
+
+#include "history.h"
+#include "history_graph.h"
+
+#define HISTORY_GRAPH_STRIDE            (HISTORY_GRAPH_WIDTH / 2)
+#define HISTORY_GRAPH_PALETTE_SIZE      (16 * sizeof(lv_color32_t))
+#define HISTORY_GRAPH_CENTER            (HISTORY_GRAPH_HEIGHT / 2)
+
+/* Palette indices */
+#define HISTORY_GRAPH_BACKGROUND        (0)
+#define HISTORY_GRAPH_ZERO              (1)
+#define HISTORY_GRAPH_LIFT              (2)
+#define HISTORY_GRAPH_SINK              (3)
+#define HISTORY_GRAPH_ALTITUDE          (4)
+
+static uint32_t history_graph_buffer[(LV_CANVAS_BUF_SIZE_INDEXED_4BIT(HISTORY_GRAPH_WIDTH, HISTORY_GRAPH_HEIGHT) + 3) / 4];
+static uint32_t history_graph_next = 0;
+static bool history_graph_scaled = false;
+static int32_t history_graph_floor = 0;
+static int32_t history_graph_ceiling = 0;
+
+static uint8_t * history_graph_row(lv_coord_t y) {
+    return (uint8_t *)history_graph_buffer + HISTORY_GRAPH_PALETTE_SIZE + y * HISTORY_GRAPH_STRIDE;
+}
+
+/* Even columns sit in the high nibble, as LVGL reads indexed images */
+static void history_graph_set(uint8_t * row, lv_coord_t x, uint8_t color) {
+    uint8_t shift = (x & 1) ? 0 : 4;
+    row[x / 2] = (row[x / 2] & ~(0xF << shift)) | (color << shift);
+}
+
+static void history_graph_clear(void) {
+    memset(history_graph_row(0), (HISTORY_GRAPH_BACKGROUND << 4) | HISTORY_GRAPH_BACKGROUND, HISTORY_GRAPH_STRIDE * HISTORY_GRAPH_HEIGHT);
+    memset(history_graph_row(HISTORY_GRAPH_CENTER), (HISTORY_GRAPH_ZERO << 4) | HISTORY_GRAPH_ZERO, HISTORY_GRAPH_STRIDE);
+}
+
+/* Drops the oldest column, the newest one is free again */
+static void history_graph_shift(void) {
+    for (lv_coord_t y = 0; y < HISTORY_GRAPH_HEIGHT; y++) {
+        uint8_t * row = history_graph_row(y);
+        for (int i = 0; i < HISTORY_GRAPH_STRIDE - 1; i++) {
+            row[i] = (uint8_t)((row[i] << 4) | (row[i + 1] >> 4));
+        }
+        row[HISTORY_GRAPH_STRIDE - 1] = (uint8_t)(row[HISTORY_GRAPH_STRIDE - 1] << 4);
+    }
+}
+
+static void history_graph_draw_column(lv_coord_t x, const history_sample_t * sample) {
+    int32_t bar = (int32_t)sample->speed * HISTORY_GRAPH_CENTER / HISTORY_GRAPH_SPEED_MAX;
+    bar = (bar > HISTORY_GRAPH_CENTER) ? HISTORY_GRAPH_CENTER : ((bar < -HISTORY_GRAPH_CENTER + 1) ? -HISTORY_GRAPH_CENTER + 1 : bar);
+    // Two pixels high, the ceiling is on the first row and the floor on the last
+    int32_t altitude = (history_graph_ceiling - sample->altitude) * (HISTORY_GRAPH_HEIGHT - 2) / (history_graph_ceiling - history_graph_floor);
+
+    for (lv_coord_t y = 0; y < HISTORY_GRAPH_HEIGHT; y++) {
+        uint8_t color = (y == HISTORY_GRAPH_CENTER) ? HISTORY_GRAPH_ZERO : HISTORY_GRAPH_BACKGROUND;
+        if (bar > 0 && y < HISTORY_GRAPH_CENTER && y >= HISTORY_GRAPH_CENTER - bar) {
+            color = HISTORY_GRAPH_LIFT;
+        } else if (bar < 0 && y > HISTORY_GRAPH_CENTER && y <= HISTORY_GRAPH_CENTER - bar) {
+            color = HISTORY_GRAPH_SINK;
+        }
+        if (y == altitude || y == altitude + 1) {
+            color = HISTORY_GRAPH_ALTITUDE;
+        }
+        history_graph_set(history_graph_row(y), x, color);
+    }
+}
+
+static int32_t history_graph_snap(int32_t altitude) {
+    return (altitude >= 0) ? altitude / HISTORY_GRAPH_ALTITUDE_STEP * HISTORY_GRAPH_ALTITUDE_STEP
+                           : -((-altitude + HISTORY_GRAPH_ALTITUDE_STEP - 1) / HISTORY_GRAPH_ALTITUDE_STEP * HISTORY_GRAPH_ALTITUDE_STEP);
+}
+
+static void history_graph_redraw(uint32_t count) {
+    history_sample_t samples[HISTORY_GRAPH_WIDTH];
+    bool valid[HISTORY_GRAPH_WIDTH];
+    uint32_t first = (count > HISTORY_GRAPH_WIDTH) ? count - HISTORY_GRAPH_WIDTH : 0;
+    uint32_t shown = count - first;
+
+    int32_t low = INT16_MAX;
+    int32_t high = INT16_MIN;
+    for (uint32_t i = 0; i < shown; i++) {
+        valid[i] = history_read(first + i, &samples[i]);
+        if (valid[i]) {
+            low = LV_MATH_MIN(low, samples[i].altitude);
+            high = LV_MATH_MAX(high, samples[i].altitude);
+        }
+    }
+    if (low > high) {
+        return;
+    }
+
+    // The newest samples stay clear of the edges, a narrow range grows on the side they are closer to
+    history_graph_floor = history_graph_snap(low);
+    history_graph_ceiling = history_graph_snap(high) + HISTORY_GRAPH_ALTITUDE_STEP;
+    if (history_graph_ceiling - history_graph_floor < 2 * HISTORY_GRAPH_ALTITUDE_STEP) {
+        if ((low + high) / 2 - history_graph_floor >= HISTORY_GRAPH_ALTITUDE_STEP / 2) {
+            history_graph_ceiling += HISTORY_GRAPH_ALTITUDE_STEP;
+        } else {
+            history_graph_floor -= HISTORY_GRAPH_ALTITUDE_STEP;
+        }
+    }
+    history_graph_scaled = true;
+
+    history_graph_clear();
+    for (uint32_t i = 0; i < shown; i++) {
+        if (valid[i]) {
+            history_graph_draw_column(HISTORY_GRAPH_WIDTH - shown + i, &samples[i]);
+        }
+    }
+}
+
+lv_obj_t * history_graph_create(lv_obj_t * parent) {
+    lv_obj_t * graph = lv_canvas_create(parent, NULL);
+    if (graph == NULL) {
+        return NULL;
+    }
+
+    lv_canvas_set_buffer(graph, history_graph_buffer, HISTORY_GRAPH_WIDTH, HISTORY_GRAPH_HEIGHT, LV_IMG_CF_INDEXED_4BIT);
+    lv_canvas_set_palette(graph, HISTORY_GRAPH_BACKGROUND, LV_COLOR_BLACK);
+    lv_canvas_set_palette(graph, HISTORY_GRAPH_ZERO, LV_COLOR_GRAY);
+    lv_canvas_set_palette(graph, HISTORY_GRAPH_LIFT, LV_COLOR_GREEN);
+    lv_canvas_set_palette(graph, HISTORY_GRAPH_SINK, LV_COLOR_RED);
+    lv_canvas_set_palette(graph, HISTORY_GRAPH_ALTITUDE, LV_COLOR_WHITE);
+    lv_obj_set_click(graph, false);
+    history_graph_clear();
+
+    // The first update draws whatever the history already holds
+    history_graph_next = 0;
+    history_graph_scaled = false;
+
+    return graph;
+}
+
+bool history_graph_update(lv_obj_t * graph) {
+    uint32_t count = history_count();
+    if (count == history_graph_next) {
+        return false;
+    }
+
+    if (!history_graph_scaled || count - history_graph_next >= HISTORY_GRAPH_WIDTH) {
+        history_graph_redraw(count);
+    } else {
+        for ( ; history_graph_next < count; history_graph_next++) {
+            history_sample_t sample;
+            if (!history_read(history_graph_next, &sample) || sample.altitude < history_graph_floor || sample.altitude > history_graph_ceiling) {
+                history_graph_redraw(count);
+                break;
+            }
+            history_graph_shift();
+            history_graph_draw_column(HISTORY_GRAPH_WIDTH - 1, &sample);
+        }
+    }
+    history_graph_next = count;
+
+    lv_obj_invalidate(graph);
+    return true;
+}
+
+void history_graph_get_range(const lv_obj_t * graph, int32_t * floor, int32_t * ceiling) {
+    (void)graph;
+    *floor = history_graph_floor;
+    *ceiling = history_graph_ceiling;
+}
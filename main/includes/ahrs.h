@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Attitude of the device from the IMU and the magnetometer, a Mahony complementary filter on a quaternion.
+    The gyro propagates the attitude at IMU rate. The accelerometer pulls roll and pitch towards the measured
+    gravity, and the magnetometer pulls the heading towards the horizontal part of the measured field. Each
+    correction also feeds a small integral term that takes out the gyro bias.
+    The magnetometer only turns the attitude about the vertical, so a disturbed field never tilts it, and the
+    heading is tilt compensated by construction. Same pure computation rules as vario_signal.h.
+
+    Body frame is the MPU6886 frame, z out of the screen. Earth frame is north, west, up. accel in g, gyro in
+    degree/s, the magnetometer in any unit already turned into the body frame.
+*/
+
+/* Proportional gains in rad/s per rad of error, the accelerometer one matches the former gravity estimator */
+#define AHRS_ACCEL_GAIN                 (2.0f)
+#define AHRS_MAG_GAIN                   (1.0f)
+/* Integral gain in rad/s^2 per rad, the bias estimate stays within AHRS_BIAS_MAX rad/s */
+#define AHRS_INTEGRAL_GAIN              (0.05f)
+#define AHRS_BIAS_MAX                   (0.05f)
+/*
+    Away from 1 g the accelerometer also measures turns and pendulum swings, its correction fades to nothing
+    at AHRS_ACCEL_GATE g off, below AHRS_ACCEL_MIN g there is no usable gravity at all.
+*/
+#define AHRS_ACCEL_GATE                 (0.15f)
+#define AHRS_ACCEL_MIN                  (0.5f)
+/*
+    In a turn the accelerometer reads the apparent vertical at the bank angle while staying close to 1 g. The
+    centripetal part is taken out with the turn rate and the trim airspeed of a paraglider, the accelerometer
+    does not see wind so airspeed and not ground speed is the right one. The turn rate is low passed over
+    AHRS_TURN_TIME s, swings of the pilot under the wing do not move the track.
+*/
+#define AHRS_AIRSPEED                   (10.0f)
+#define AHRS_TURN_TIME                  (2.0f)
+/* A field closer to the vertical than this, in sine of its inclination, gives no heading */
+#define AHRS_MAG_HORIZONTAL_MIN         (0.1f)
+
+typedef struct {
+    float q[4];                 /* w, x, y, z, body to earth */
+    float bias[3];              /* integral term, rad/s added to the gyro */
+    float turn;                 /* low passed rate about the vertical, rad/s */
+    bool tilt_aligned;          /* roll and pitch set from the first usable accelerometer sample */
+    bool heading_aligned;       /* heading set from the first usable magnetometer sample */
+} ahrs_t;
+
+void ahrs_init(ahrs_t * ahrs);
+/* One IMU sample, delta_time in s */
+void ahrs_update(ahrs_t * ahrs, const float accel[3], const float gyro[3], float delta_time);
+/* One magnetometer sample, delta_time is the time since the previous one in s */
+void ahrs_update_magnetometer(ahrs_t * ahrs, const float mag[3], float delta_time);
+/* Vertical acceleration in m/s^2 of the specific force accel in g, gravity removed */
+float ahrs_vertical_acceleration(const ahrs_t * ahrs, const float accel[3]);
+/* Degrees clockwise from magnetic north of the body x axis, 0..360 */
+float ahrs_get_heading(const ahrs_t * ahrs);
+/* Degrees, roll about the body x axis and pitch of the body x axis above the horizon */
+void ahrs_get_tilt(const ahrs_t * ahrs, float * roll, float * pitch);
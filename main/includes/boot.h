@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "freertos/FreeRTOS.h"
+#include "core2forAWS.h"
+
+/*
+    Boot stages and when they ran. Stages that do not need each other run in parallel tasks, one waits for
+    another through its bit instead of a fixed delay. A stage that fails still ends, so nothing waits for it
+    forever. Times are esp_timer microseconds, which start counting just before app_main. The report is logged
+    once, after the vario is audible and the screens are up.
+*/
+/* Time from power on to the first tone the estimator can produce */
+#define BOOT_AUDIO_TARGET_MS            (1000)
+/* The report is logged without the stages still running after this */
+#define BOOT_REPORT_TIMEOUT_MS          (5000)
+
+typedef enum {
+    #ifdef DECLARE_BOOT_STAGE
+    #undef DECLARE_BOOT_STAGE
+    #endif
+    #define DECLARE_BOOT_STAGE(_index, _name) _index
+    #include "boot_stage.inc"
+    BOOT_STAGE_COUNT,
+} boot_stage_t;
+
+#define BOOT_STAGE_BIT(_stage)          (1UL << (_stage))
+
+/* Before any other boot function, from app_main */
+void boot_init(void);
+void boot_stage_start(boot_stage_t stage);
+void boot_stage_end(boot_stage_t stage, bool ok);
+/* Cheap enough for a loop, true when the stage ended, failed or not */
+bool boot_stage_ended(boot_stage_t stage);
+/* True when the stage ended and did not fail */
+bool boot_stage_ok(boot_stage_t stage);
+/*
+    A stage any of several producer tasks can end. A producer that gives up drops out, the last one to drop
+    ends the stage as failed unless another ended it already. Expect before the producers start.
+*/
+void boot_stage_expect(boot_stage_t stage, uint32_t producers);
+void boot_stage_drop(boot_stage_t stage);
+/* Blocks until every stage of the bits ended, false on timeout */
+bool boot_wait(uint32_t stages, TickType_t ticks);
+/* Logs the start, end and result of every stage */
+void boot_report(void);
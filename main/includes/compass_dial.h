@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "core2forAWS.h"
+
+/*
+    Heading-up compass card drawn with lines and labels instead of rotating a true color bitmap. Tick and letter
+    positions come from a one degree sine table, the shown heading only moves once the input is a whole
+    degree away from it, and a new heading invalidates the ring of the card but not its still center.
+*/
+#define COMPASS_DIAL_HYSTERESIS         (1.0f)
+
+typedef struct {
+    uint32_t draws;
+    uint64_t draw_us;
+    uint32_t draw_us_max;
+} compass_dial_stats_t;
+
+lv_obj_t * compass_dial_create(lv_obj_t * parent, lv_coord_t size, const lv_font_t * font);
+/* Heading in degrees, any range, returns false when the card did not move */
+bool compass_dial_set_heading(lv_obj_t * dial, float heading);
+int32_t compass_dial_get_heading(const lv_obj_t * dial);
+/* Design callback time of all dials, with the GUI mutex held */
+void compass_dial_get_stats(compass_dial_stats_t * stats, bool reset);
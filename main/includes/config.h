@@ -1,12 +1,12 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdatomic.h>
 #include <nvs.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
 #include "core2forAWS.h"
 
-#define OVERALL_TONE_LIFT_CYCLE_MAXIMUM             (1000)
-#define OVERALL_TONE_SAMPLE_RATE                    (44100)
-
 #define DEFAULT_TONE_LIFT_FREQUENCY_MINIMUM         (600)
 #define DEFAULT_TONE_LIFT_FREQUENCY_MAXIMUM         (1800)
 #define DEFAULT_TONE_LIFT_FREQUENCY_FACTOR          (400)
@@ -110,6 +110,26 @@ typedef enum {
     #include "config_namespace.inc"
 } config_namespace_index_t;
 
+/*
+    Copy of every integer item, published with a new generation each time an item is loaded or set. Arrays are
+    indexed by the item enums, the trailing slot mirrors the terminator of the item tables.
+    Slots are recycled after CONFIG_SNAPSHOT_SLOTS publications, so readers never hold one. config_read_snapshot
+    copies the current one and retries while it is rewritten, a reader keeps the generation of its copy and asks
+    config_snapshot_changed with it. Generations are even, a slot being rewritten carries an odd one.
+*/
+#define CONFIG_SNAPSHOT_SLOTS                       (4)
+#define CONFIG_SUBSCRIBER_MAX                       (4)
+/* Tries before a reader sleeps one tick, it can only keep failing while a writer is preempted mid-write */
+#define CONFIG_READ_RETRIES                         (8)
+
+typedef struct {
+    atomic_uint generation;
+    int32_t sound[CONFIG_SOUND_ANY + 1];
+    int32_t speed[CONFIG_SPEED_ANY + 1];
+    int32_t system[CONFIG_SYSTEM_ANY + 1];
+    int32_t bluetooth[CONFIG_BLUETOOTH_ANY + 1];
+} config_snapshot_t;
+
 extern config_namespace_t config_namespace[];
 extern config_item_t config_sound_items[];
 extern config_item_t config_speed_items[];
@@ -125,6 +145,11 @@ esp_err_t _config_get_string(int namespace_index, int index, char * string, size
 int32_t config_get_integer(int namespace_index, int index);
 char * config_get_malloc_string(int namespace_index, int index);
 
+void config_read_snapshot(config_snapshot_t * snapshot);
+bool config_snapshot_changed(uint32_t generation);
+/* Notify bits are set on the task with xTaskNotify after each publication */
+esp_err_t config_subscribe(TaskHandle_t task, uint32_t notify_bits);
+
 esp_err_t _config_set_integer(int namespace_index, int index, int32_t integer, bool save_to_nvs);
 esp_err_t _config_set_string(int namespace_index, int index, const char * string, bool save_to_nvs);
 #define config_set_integer(_namespace_index, _index, _integer) _config_set_integer(_namespace_index, _index, _integer, true)
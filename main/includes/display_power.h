@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "core2forAWS.h"
+
+/*
+    Display power stages driven by activity. Without a touch, a button or a vario change the backlight dims in
+    stages, then the LVGL refresh stops and the panel sleeps with the backlight off. Any activity goes straight
+    back to the set brightness and the first refresh draws whatever changed meanwhile. The battery current of a
+    stage is logged when it is left, so idle draw can be read from the log. All functions belong to the UI task.
+*/
+/* cm/s away from the speed at the last vario activity */
+#define DISPLAY_POWER_VARIO_STEP        (100)
+
+typedef enum {
+    DISPLAY_POWER_ACTIVE,
+    DISPLAY_POWER_DIM,
+    DISPLAY_POWER_LOW,
+    DISPLAY_POWER_SLEEP,
+    DISPLAY_POWER_STAGE_COUNT,
+} display_power_stage_t;
+
+/* Brightness the boot fade ended at, idle time starts now */
+void display_power_init(int32_t brightness);
+/* Set brightness in percent, shown at once unless dimmed or asleep */
+void display_power_set_brightness(int32_t brightness);
+/* Restarts the idle time, returns true when the display was asleep */
+bool display_power_activity(void);
+/* Touch panel state, returns true while the touch that woke the display lasts and must be ignored */
+bool display_power_touch(bool pressed);
+/* Vertical speed in cm/s */
+void display_power_vario(int32_t speed);
+/* Steps to the stage of the idle time, call it periodically */
+void display_power_update(void);
+display_power_stage_t display_power_get_stage(void);
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "core2forAWS.h"
+
+/*
+    Fonts kept out of the app image. tools/font_subset.py cuts the glyphs a label really shows out of the LVGL
+    font sources and RLE compresses them into the spiffs partition at build time. A font is read into heap on its
+    first use and stays there. Compressed glyphs are decoded into a small LRU cache of bitmaps, so redrawing the
+    same digits does not decode them again. The cache is shared by all loaded fonts and belongs to the task
+    holding the GUI mutex, like everything else LVGL draws.
+*/
+#ifndef FONT_LOADER_BASE_PATH
+#define FONT_LOADER_BASE_PATH           "/spiffs"
+#endif
+#define FONT_LOADER_PARTITION           "spiffs"
+#define FONT_LOADER_MAX_FONTS           (4)
+#define FONT_LOADER_CACHE_GLYPHS        (24)
+
+/* Digit subsets of lv_font_arial_rounded_mt_*, only 0-9 . and - */
+#define FONT_LOADER_DIGITS_32           "digits_32"
+#define FONT_LOADER_DIGITS_48           "digits_48"
+#define FONT_LOADER_DIGITS_72           "digits_72"
+
+typedef struct {
+    uint32_t fonts;             /* loaded */
+    uint32_t font_bytes;        /* heap held by loaded fonts */
+    uint32_t cache_bytes;       /* heap held by the glyph cache */
+    uint32_t hits;
+    uint32_t misses;            /* glyphs decoded */
+} font_loader_stats_t;
+
+/* Mounts the partition, once, ESP_OK when already mounted */
+esp_err_t font_loader_init(void);
+/* Font <name>.fnt, loaded on the first call, NULL when it is missing or broken */
+const lv_font_t * font_loader_get(const char * name);
+void font_loader_get_stats(font_loader_stats_t * stats);
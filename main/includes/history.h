@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Flight history at one sample per second, the last ten minutes in a static ring of int16 pairs. The estimator
+    task appends, the mean speed of the period and the altitude at its end make a sample. Samples are addressed by
+    their number since boot, a reader checks the count again after copying so a slot overwritten meanwhile is
+    reported instead of returned torn.
+*/
+#define HISTORY_LENGTH                  (600)
+#define HISTORY_PERIOD_US               (1000000)
+
+typedef struct {
+    int16_t altitude;       /* m */
+    int16_t speed;          /* cm/s */
+} history_sample_t;
+
+/* Only from the estimator task, returns true when a sample was completed */
+bool history_add(int64_t timestamp, float altitude, int32_t speed);
+/* Samples appended since boot, the slot of the oldest is the next one written, so count - HISTORY_LENGTH + 1 is the oldest readable */
+uint32_t history_count(void);
+/* From any task, false when the sample is not appended yet or already overwritten */
+bool history_read(uint32_t index, history_sample_t * sample);
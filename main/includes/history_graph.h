@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "core2forAWS.h"
+
+/*
+    Climb and altitude of the last minutes on a 4 bit indexed canvas, one column per history sample with the
+    newest on the right. A new sample shifts the canvas left by one column and draws only that column, the whole
+    graph is drawn again from the history when the altitude leaves the scale or samples were missed. There is a
+    single graph, its buffer is static.
+*/
+#define HISTORY_GRAPH_WIDTH             (240)
+#define HISTORY_GRAPH_HEIGHT            (160)
+/* Climb shown from the center line to the edges, cm/s */
+#define HISTORY_GRAPH_SPEED_MAX         (500)
+/* The altitude scale snaps to this step and spans at least two of them, m */
+#define HISTORY_GRAPH_ALTITUDE_STEP     (50)
+
+lv_obj_t * history_graph_create(lv_obj_t * parent);
+/* Draws the samples appended since the last call, returns false when there were none */
+bool history_graph_update(lv_obj_t * graph);
+/* Altitude at the bottom and the top edge, m */
+void history_graph_get_range(const lv_obj_t * graph, int32_t * floor, int32_t * ceiling);
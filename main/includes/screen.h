@@ -1,20 +1,29 @@
 #include "core2forAWS.h"
 
 #define DASHBOARD_TAB_NAME      "dashboard"
+#define HISTORY_TAB_NAME        "history"
 #define MOTION_TAB_NAME         "motion"
 #define COMPASS_TAB_NAME        "compass"
 
 #define BRIGHTNESS_TAB_NAME     "brightness"
 #define VOLUME_TAB_NAME         "volume"
 
+/* Dirty bits of the UI task, producers set them and the task redraws only what they name */
+#define UI_EVENT_FLIGHT         (1 << 0)
+#define UI_EVENT_ENVIRONMENT    (1 << 1)
+#define UI_EVENT_CLOCK          (1 << 2)
+#define UI_EVENT_BATTERY        (1 << 3)
+#define UI_EVENT_BUTTON         (1 << 4)
+#define UI_EVENT_CONFIG         (1 << 5)
+#define UI_EVENT_HISTORY        (1 << 6)
+#define UI_EVENT_ATTITUDE       (1 << 7)
+
+/* Logo on the boot screen at the configured brightness, screen_init replaces it */
+void screen_show_splash();
 void screen_init();
 void ui_loop(void * arguemnt);
-void ui_set_altitude(double altitude);
-void ui_set_speed(double speed);
-void ui_set_pressure(double pressure);
-void ui_set_temperature(double temperature);
-void ui_set_humidity(double humidity);
-void rotate_compass(double angle);
+/* From any task, does nothing before the UI task is running */
+void ui_notify(uint32_t events);
 void ui_set_volume(int32_t volume);
 void ui_set_brightness(int32_t brightness);
 void ui_start_motor(void);
@@ -6,7 +6,9 @@
 extern "C" {
 #endif
 
-#define SIN_TABLE_DATA_COUNT            (30030)
+/* Quarter wave, 2^SIN_TABLE_QUARTER_BITS steps over 0~pi/2 plus a guard entry for the interpolation */
+#define SIN_TABLE_QUARTER_BITS          (8)
+#define SIN_TABLE_DATA_COUNT            ((1 << SIN_TABLE_QUARTER_BITS) + 1)
 
 typedef int16_t sin_value_t;
 
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+/*
+    Latest flight values, published as one snapshot by the vertical speed estimator and read without locks by
+    the UI and the speaker. The snapshot sits behind a sequence counter (seqlock): the single producer makes it
+    odd while writing, readers copy and retry when the counter was odd or has moved.
+*/
+
+typedef struct {
+    uint32_t sequence;      /* Number of publications so far, increases by one per telemetry_publish */
+    float altitude;         /* m */
+    int32_t speed;          /* cm/s */
+    float pressure;         /* Pa */
+    float temperature;      /* degree C, adjustment applied */
+    float heading;          /* degree clockwise from magnetic north, 0..360 */
+    float roll;             /* degree */
+    float pitch;            /* degree */
+    float humidity;         /* %, published by its own task */
+} telemetry_t;
+
+/* Only from the estimator task, humidity is not touched */
+void telemetry_publish(const telemetry_t * telemetry);
+/* Humidity comes from another task, it is a single word stored atomically */
+void telemetry_publish_humidity(float humidity);
+/* From any task, never blocks the producer */
+void telemetry_read(telemetry_t * telemetry);
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "core2forAWS.h"
+
+/*
+    Vertical speed scales on both screen edges as one LVGL object. The design callback draws the outlines and
+    the filled part of every unit straight from the speed, so there is no object per unit and a speed change
+    only invalidates the rows of the units whose fill moved. Each unit is one m/s and fills pixel by pixel.
+*/
+#define VARIO_BAR_WIDTH                 (32)
+#define VARIO_BAR_UNITS                 (8)
+/* cm/s shown by one unit */
+#define VARIO_BAR_UNIT_SPEED            (100)
+
+/* Spans the parent width, the scales sit on its left and right edges, it never takes clicks */
+lv_obj_t * vario_bar_create(lv_obj_t * parent);
+/* Speed in cm/s, clamped to the scale */
+void vario_bar_set_speed(lv_obj_t * bar, int32_t speed);
+int32_t vario_bar_get_speed(const lv_obj_t * bar);
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "qmp6988.h"
+#include "dps310.h"
+#include "mpu6886.h"
+#include "kalman_filter.h"
+#include "ahrs.h"
+#include "vario_signal.h"
+
+/*
+    What the sensor tasks do with one sample, shared by the firmware loops of vario.c and the host replay
+    harness, so the replay always runs the code the device runs. The tasks keep their scheduling, queues and
+    publication, the replay drives the same functions from the reads of a capture.
+*/
+
+/* QMP6988 results are read slightly faster than the nominal output rate, so the internal oscillator tolerance never skips a sample */
+#define VARIO_QMP6988_PERIOD_MARGIN             (32)
+
+/* Barometer results are compensated in int64 fixed point or in double, selected at build time */
+#ifdef CONFIG_BARO_FIXED_POINT_COMPENSATION
+typedef int32_t vario_baro_value_t;
+typedef dps310_fixed_result_t vario_dps310_result_t;
+#define vario_qmp6988_fetch_result              qmp6988_fetch_result_fixed
+#define vario_dps310_fetch_fifo                 dps310_fetch_fifo_fixed
+#else
+typedef double vario_baro_value_t;
+typedef dps310_result_t vario_dps310_result_t;
+#define vario_qmp6988_fetch_result              qmp6988_fetch_result
+#define vario_dps310_fetch_fifo                 dps310_fetch_fifo
+#endif
+
+/* Altitude in m, pressure in Pa and temperature in degree C with the configured adjustment */
+typedef struct {
+    int64_t timestamp;
+    vario_baro_sensor_t sensor;
+    float altitude;
+    float pressure;
+    float temperature;
+} vario_altitude_sample_t;
+
+/* One tick retries before a period's read is given up and the task waits for the next deadline */
+#define VARIO_QMP6988_RETRIES_MAX               (3)
+
+typedef enum {
+    VARIO_QMP6988_FRESH,        /* a new result, to be processed */
+    VARIO_QMP6988_RETRY,        /* registers not refreshed yet, read again one tick later */
+    VARIO_QMP6988_STALE,        /* still not refreshed after the retries, wait for the next deadline */
+} vario_qmp6988_read_t;
+
+/*
+    The QMP6988 has no data ready flag, a result equal to the last one is taken as not refreshed yet. Once
+    more than one device period has passed since the last result, the device has refreshed whatever the
+    registers say, so an equal result then is a real repeat and is kept.
+*/
+typedef struct {
+    bool started;
+    uint32_t period_us;
+    uint32_t retries;
+    int64_t read_time;
+    vario_baro_value_t temperature;
+    vario_baro_value_t pressure;
+} vario_qmp6988_poll_t;
+
+/* IMU frames dated at data ready, the last date is the estimator time */
+typedef struct {
+    vario_sample_clock_t sample_clock;
+    int64_t last_timestamp;
+} vario_imu_clock_t;
+
+void vario_altitude_sample_init(vario_altitude_sample_t * sample, vario_baro_sensor_t sensor, int64_t timestamp,
+                                vario_baro_value_t temperature, vario_baro_value_t pressure, int32_t temperature_adjustment);
+/* The sample is moved to the estimator time now, both in us */
+void vario_altitude_sample_apply(const vario_altitude_sample_t * sample, vario_baro_fusion_t * fusion, kalman_filter_t * kalman, int64_t now);
+
+/* period_us is the nominal measurement period, read_time the esp_timer time of the read in us */
+void vario_qmp6988_poll_init(vario_qmp6988_poll_t * poll, uint32_t period_us);
+vario_qmp6988_read_t vario_qmp6988_poll(vario_qmp6988_poll_t * poll, int64_t read_time, vario_baro_value_t temperature, vario_baro_value_t pressure);
+
+/* Data ready times of count FIFO entries drained at drain_time, one device period apart back from the drain */
+void vario_dps310_stamp_entries(vario_sample_clock_t * sample_clock, int64_t drain_time, uint32_t count, int64_t * timestamps);
+
+void vario_imu_clock_init(vario_imu_clock_t * imu_clock, int64_t period_us, int64_t now);
+/* One IMU sample in g and degree/s through the attitude into the vertical speed estimator */
+void vario_imu_update(ahrs_t * ahrs, kalman_filter_t * kalman, const float accel[3], const float gyro[3], float delta_time);
+/* Dates the frame at data ready and runs vario_imu_update with the interval from the previous one */
+void vario_imu_frame_update(vario_imu_clock_t * imu_clock, ahrs_t * ahrs, kalman_filter_t * kalman, const mpu6886_frame_t * frame);
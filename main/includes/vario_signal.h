@@ -0,0 +1,125 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "kalman_filter.h"
+
+/*
+    Pure computation of the vario signal chain, shared by the firmware tasks and the host replay harness.
+    Nothing in here may depend on FreeRTOS or on the hardware drivers.
+*/
+
+/* DPS310 FIFO is drained at this period, instead of polling the status register for every sample */
+#define VARIO_DPS310_FIFO_READ_PERIOD_MS        (100)
+/* IMU samples stream through the FIFO at this rate, each one drives the vertical speed estimator */
+#define VARIO_MPU6886_ODR_HZ                    (200)
+/* The FIFO is read in one batch per period, barometric altitudes are applied and the telemetry published then */
+#define VARIO_MPU6886_PERIOD_MS                 (10)
+#define VARIO_MPU6886_BATCH_FRAMES              (VARIO_MPU6886_ODR_HZ * VARIO_MPU6886_PERIOD_MS / 1000)
+
+#define VARIO_GRAVITY_ACCELERATION              (9.80665f)
+#define VARIO_TONE_SINK_CYCLE                   (500)
+
+/*
+    Fixed point altitude takes the fixed point barometer results, temperature in 0.01 degree C and pressure in
+    1/256 Pa. (p0 / p)^(1 / 5.257) - 1 comes from a table every 128 Pa over 300..1100 hPa, linearly interpolated.
+*/
+#define VARIO_FIXED_PRESSURE_SHIFT              (8)
+#define VARIO_ALTITUDE_TABLE_PRESSURE_MIN       (30000)
+#define VARIO_ALTITUDE_TABLE_STEP_SHIFT         (7)
+#define VARIO_ALTITUDE_TABLE_SIZE               (626)
+
+/*
+    Both barometers feed one estimator. Each sample is moved to the estimator time with the current velocity,
+    corrected by the offset of its sensor to the reference sensor, the first one heard, and weighted by the
+    noise variance measured from its own innovations. Weights below are per sample.
+*/
+#define VARIO_BARO_VARIANCE_WEIGHT              (1.0f / 64.0f)
+#define VARIO_BARO_OFFSET_WEIGHT                (1.0f / 1024.0f)
+#define VARIO_BARO_VARIANCE_MIN                 (0.0001f)
+
+/*
+    Samples carry esp_timer microseconds. A polled or FIFO result is only seen some time after the device made
+    it ready, the sample clock follows the lower envelope of the read times on the device period, in 1/256 us,
+    learnt from the read intervals. A read more than a period late means a lost sample and restarts it.
+*/
+#define VARIO_SAMPLE_CLOCK_SHIFT                (8)
+#define VARIO_SAMPLE_CLOCK_PERIOD_WEIGHT        (64)
+#define VARIO_SAMPLE_CLOCK_LATE_WEIGHT          (16)
+/* Measured IMU intervals are clamped, a stalled task must not throw the estimator */
+#define VARIO_DELTA_TIME_MIN                    (0.001f)
+#define VARIO_DELTA_TIME_MAX                    (0.1f)
+
+typedef enum {
+    VARIO_BARO_QMP6988,
+    VARIO_BARO_DPS310,
+    VARIO_BARO_COUNT,
+} vario_baro_sensor_t;
+
+typedef struct {
+    float offset;
+    float variance;
+    uint32_t samples;
+} vario_baro_channel_t;
+
+typedef struct {
+    vario_baro_channel_t channels[VARIO_BARO_COUNT];
+    int32_t reference;
+} vario_baro_fusion_t;
+
+typedef struct {
+    bool started;
+    int64_t ready;
+    int64_t last_read;
+    int64_t period;
+} vario_sample_clock_t;
+
+typedef enum {
+    VARIO_STATUS_LIFTING,
+    VARIO_STATUS_GLIDING,
+    VARIO_STATUS_SINKING,
+} vario_status_t;
+
+typedef struct {
+    int32_t lift_freq_min;
+    int32_t lift_freq_max;
+    int32_t lift_freq_factor;
+    int32_t lift_cycle_min;
+    int32_t lift_cycle_max;
+    int32_t lift_cycle_factor;
+    int32_t lift_duty_min;
+    int32_t lift_duty_max;
+    int32_t lift_duty_factor;
+    int32_t sink_freq_min;
+    int32_t sink_freq_max;
+    int32_t sink_freq_factor;
+    int32_t sink_diff_percent;
+    int32_t lift_start;
+    int32_t lift_stop;
+    int32_t sink_start;
+    int32_t sink_stop;
+} vario_tone_config_t;
+
+/* Frequencies in Hz, cycle and duty in ms, harmonic is only used by the sink tone */
+typedef struct {
+    vario_status_t status;
+    int32_t frequency;
+    int32_t harmonic;
+    int32_t cycle;
+    int32_t duty;
+} vario_tone_t;
+
+double vario_pressure_to_altitude(double temperature, double pressure);
+int32_t vario_pressure_to_altitude_fixed(int32_t temperature, int32_t pressure);
+/* Seconds between two IMU reads stamped in us, clamped to VARIO_DELTA_TIME_MIN..VARIO_DELTA_TIME_MAX */
+float vario_delta_time(int64_t last_timestamp, int64_t timestamp);
+void vario_sample_clock_init(vario_sample_clock_t * sample_clock, int64_t period_us);
+/* Data ready time of the sample read at read_time, both in us */
+int64_t vario_sample_clock_stamp(vario_sample_clock_t * sample_clock, int64_t read_time);
+/* Current estimate of the device period in us */
+int64_t vario_sample_clock_period(const vario_sample_clock_t * sample_clock);
+void vario_baro_fusion_init(vario_baro_fusion_t * fusion, float altitude_noise);
+/* age is how long before the current estimator time the altitude was measured, in seconds */
+void vario_baro_fusion_update(vario_baro_fusion_t * fusion, kalman_filter_t * kalman, vario_baro_sensor_t sensor, float altitude, float age);
+void vario_tone_update(const vario_tone_config_t * config, int32_t speed, vario_tone_t * tone);
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "vario_signal.h"
+
+/*
+    Streaming tone synthesizer, the speaker task renders one short block at a time and hands it to a ring of
+    block sized I2S DMA buffers. Pitch moves linearly to the new tone over each block while the oscillator
+    phases and the beep cadence carry over from block to block, so a new vertical speed is heard one block
+    later instead of one beep later, and beep edges are ramped instead of switched.
+    Oscillators are 32 bit phase accumulators wrapping at a full turn, the top two phase bits select the
+    quarter of the sin_table quarter wave, the next bits index it and the rest interpolate linearly.
+*/
+#define VARIO_SYNTH_BLOCK_MS                    (5)
+#define VARIO_SYNTH_SAMPLE_RATE_MAX             (48000)
+#define VARIO_SYNTH_BLOCK_SAMPLES_MAX           (VARIO_SYNTH_SAMPLE_RATE_MAX * VARIO_SYNTH_BLOCK_MS / 1000)
+/* 30 ms of queued audio, the speaker task runs below the sensor tasks and the I2C workers and may wait behind them */
+#define VARIO_SYNTH_DMA_BUFFER_COUNT            (6)
+/* Time of a gain ramp from silence to full scale, at beep edges and on volume changes */
+#define VARIO_SYNTH_RAMP_MS                     (2)
+/* Tones stay below 2 kHz, 16 kHz keeps them well under Nyquist with a third of the 44.1 kHz work */
+#define VARIO_SYNTH_LOW_SAMPLE_RATE             (16000)
+#define VARIO_SYNTH_GAIN_SHIFT                  (15)
+
+typedef struct {
+    uint32_t sample_rate;
+    uint32_t block_samples;
+    vario_status_t status;
+    uint32_t phase;
+    uint32_t harmonic_phase;
+    uint32_t step;
+    uint32_t harmonic_step;
+    /* Cadence in samples, position counts from the start of the current beep */
+    uint32_t position;
+    uint32_t cycle;
+    uint32_t duty;
+    int32_t gain;
+    int32_t gain_step;
+} vario_synth_t;
+
+void vario_synth_init(vario_synth_t * synth, uint32_t sample_rate);
+uint32_t vario_synth_frequency_to_step(const vario_synth_t * synth, int32_t frequency);
+/* Full scale int16 sin of a phase where 2^32 is one turn */
+int32_t vario_synth_sine(uint32_t phase);
+/* Fills count samples, returns false when the whole block is silence after the tone went back to gliding */
+bool vario_synth_render(vario_synth_t * synth, const vario_tone_t * tone, int32_t volume, int16_t * block, uint32_t count);
@@ -62,35 +62,67 @@
 #include "cta.h"
 #include "screen.h"
 #include "config.h"
+#include "boot.h"
+
+/* NVS reads do not touch the board, the configuration loads while the display and the PMU come up */
+static void boot_config_task(void * arguments) {
+    boot_stage_start(BOOT_STAGE_CONFIG);
+    config_load_all_namespace();
+    boot_stage_end(BOOT_STAGE_CONFIG, true);
+    vTaskDelete(NULL);
+}
 
 void app_main(void)
 {
     ESP_LOGI("APP_MAIN", "Bluethroat Vario Meter, Designed by Snailtrail.ORG, All rights Reserved.");
 
+    boot_init();
+
+    boot_stage_start(BOOT_STAGE_NVS);
     esp_err_t ret = nvs_flash_init();
     if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND) {
         ESP_ERROR_CHECK(nvs_flash_erase());
         ret = nvs_flash_init();
     }
     ESP_ERROR_CHECK( ret );
+    boot_stage_end(BOOT_STAGE_NVS, true);
 
     esp_log_level_set("gpio", ESP_LOG_NONE);
     esp_log_level_set("ILI9341", ESP_LOG_NONE);
 
+    xTaskCreate(boot_config_task, "BootConfigTask", 4096, NULL, tskIDLE_PRIORITY+4, NULL);
+
+    // Creates the I2C bus locks before any sensor task runs
+    boot_stage_start(BOOT_STAGE_BOARD);
     Core2ForAWS_Init();
-    
-    config_load_all_namespace();
+    boot_stage_end(BOOT_STAGE_BOARD, true);
 
-    screen_init();
+    boot_wait(BOOT_STAGE_BIT(BOOT_STAGE_CONFIG), portMAX_DELAY);
 
+    // Sensor tasks bring their devices up themselves, the splash is shown meanwhile
     vario_start();
 
+    boot_stage_start(BOOT_STAGE_SPLASH);
+    screen_show_splash();
+    boot_stage_end(BOOT_STAGE_SPLASH, true);
+
+    boot_stage_start(BOOT_STAGE_SCREEN);
+    screen_init();
+    boot_stage_end(BOOT_STAGE_SCREEN, true);
+
     esp_phy_erase_cal_data_in_nvs();
 
+    // The radio would compete with the sensor bring up, it starts once the vario is audible
+    boot_wait(BOOT_STAGE_BIT(BOOT_STAGE_AUDIO), pdMS_TO_TICKS(BOOT_REPORT_TIMEOUT_MS));
+
+    boot_stage_start(BOOT_STAGE_BLUETOOTH);
     if (config_get_integer(CONFIG_NAMESPACE_BLUETOOTH, CONFIG_BLUETOOTH_ENABLE)) {
         ui_set_bluetooth(BLUETOOTH_STATE_ADVERTISING);
         bluetooth_init();
     } else {
         ui_set_bluetooth(BLUETOOTH_STATE_OFF);
     }
+    boot_stage_end(BOOT_STAGE_BLUETOOTH, true);
+
+    boot_report();
 }
\ No newline at end of file
@@ -1,50 +1,88 @@
+#include <math.h>
+#include <string.h>
+
 #include "nvs_flash.h"
 #include "esp_log.h"
+#include "esp_heap_caps.h"
 #include "screen.h"
 #include "config.h"
+#include "telemetry.h"
+#include "vario_bar.h"
+#include "compass_dial.h"
+#include "display_power.h"
+#include "history_graph.h"
+#include "font_loader.h"
 #include "freertos/timers.h"
 
 #define UI_COLOR_BACKGROUND             LV_COLOR_BLACK
 #define UI_COLOR_BORDER                 LV_COLOR_GRAY
-#define UI_COLOR_SCALE_GLIDING          LV_COLOR_ORANGE
-#define UI_COLOR_SCALE_LIFT             LV_COLOR_GREEN
-#define UI_COLOR_SCALE_SINK             LV_COLOR_RED
 #define UI_COLOR_LABEL                  LV_COLOR_GRAY
 #define UI_COLOR_TEXT                   LV_COLOR_WHITE
 
+/* The RTC is read twice a second so the clock never lags a whole second, the PMU once every two seconds */
+#define UI_CLOCK_PERIOD_MS              (500)
+#define UI_BATTERY_PERIODS              (4)
+
+/* Distinct label, line and rectangle styles and line points of both screens */
+#define UI_STYLE_POOL_SIZE              (16)
+#define UI_POINT_POOL_SIZE              (32)
+
+/* The boot sweep of the speed bar moves one unit per step */
+#define UI_SWEEP_STEP_MS                (50)
+
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+/* While the benchmark or the compass tab is shown the loop redraws at every panel refresh, sweeping the speed bar or spinning the compass */
+#define UI_BENCHMARK_REPORT_MS          (1000)
+#define UI_BENCHMARK_SWEEP_STEP         (0.25)
+#define UI_BENCHMARK_SPIN_STEP          (3.0)
+#endif
+
 #define LV_SYMBOL_LOCK                  "\xef\x80\xA3" //61475 f023
 #define LV_SYMBOL_UNLOCK                "\xef\x82\x9c" //61596 f09c
 LV_FONT_DECLARE(awesome_14);
 
 LV_IMG_DECLARE(paragliding_logo);
+#ifdef CONFIG_LV_COMPASS_BITMAP
 LV_IMG_DECLARE(compass);
+#endif
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_12);
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_14);
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_16);
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_18);
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_20);
 LV_FONT_DECLARE(lv_font_arial_rounded_mt_24);
-LV_FONT_DECLARE(lv_font_arial_rounded_mt_32);
-LV_FONT_DECLARE(lv_font_arial_rounded_mt_48);
-LV_FONT_DECLARE(lv_font_arial_rounded_mt_72);
 
-static SemaphoreHandle_t ui_data_mutex = NULL;
-static double ui_altitude = 0;
-static double ui_speed = 0;
-static double ui_pressure = 101325.0;
-static double ui_temperature = 25.88;
-static double ui_humidity = 99.99;
+typedef enum {
+    UI_STYLE_LABEL,
+    UI_STYLE_LINE,
+    UI_STYLE_RECT,
+} ui_style_kind_t;
+
+typedef struct {
+    ui_style_kind_t kind;
+    const lv_font_t * font;
+    lv_color_t color;
+    lv_style_int_t line_width;
+    lv_style_t style;
+} ui_style_entry_t;
+
+static ui_style_entry_t ui_style_pool[UI_STYLE_POOL_SIZE];
+static uint32_t ui_style_count = 0;
+static uint32_t ui_style_requests = 0;
+static uint32_t ui_style_saved_bytes = 0;
+static lv_point_t ui_point_pool[UI_POINT_POOL_SIZE];
+static uint32_t ui_point_count = 0;
 
 static SemaphoreHandle_t ui_mutex = NULL;
+static TaskHandle_t ui_task = NULL;
 
 static lv_obj_t * current_screen = NULL;
 static lv_obj_t * main_screen = NULL;
 static lv_obj_t * setting_screen = NULL;
 
-static lv_obj_t * scale_left_lift[8];
-static lv_obj_t * scale_left_sink[8];
-static lv_obj_t * scale_right_lift[8];
-static lv_obj_t * scale_right_sink[8];
+static lv_obj_t * vario_bar = NULL;
+/* While the boot sweep runs the bar does not follow the speed, both sides hold the GUI mutex */
+static bool ui_sweeping = false;
 
 static lv_obj_t * clock_text = NULL;
 static lv_obj_t * lock_icon = NULL;
@@ -57,6 +95,7 @@ static lv_obj_t * battery_icon = NULL;
 
 static lv_obj_t * main_screen_tab_view = NULL;
 static lv_obj_t * dashboard_tab = NULL;
+static lv_obj_t * history_tab = NULL;
 static lv_obj_t * motion_tab = NULL;
 static lv_obj_t * compass_tab = NULL;
 
@@ -66,8 +105,20 @@ static lv_obj_t * pressure_text = NULL;
 static lv_obj_t * humidity_text = NULL;
 static lv_obj_t * speed_text = NULL;
 
+static lv_obj_t * history_graph = NULL;
+static lv_obj_t * history_range_text = NULL;
+
 static lv_obj_t * motion_gauge = NULL;
+#ifdef CONFIG_LV_COMPASS_BITMAP
 static lv_obj_t * compass_image = NULL;
+#else
+static lv_obj_t * compass_card = NULL;
+#endif
+
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+static lv_obj_t * benchmark_tab = NULL;
+static lv_obj_t * benchmark_text = NULL;
+#endif
 
 static lv_obj_t * setting_screen_tab_view = NULL;
 static lv_obj_t * time_tab = NULL;
@@ -93,12 +144,82 @@ void lv_obj_debug(const char * name, lv_obj_t * object) {
     ESP_LOGI("SCREEN", "Object %s coordinate, left:%d, top:%d, right:%d, bottom:%d", name, x, y, x+w, y+h);
 }
 
-lv_obj_t * draw_label(lv_obj_t * parent, lv_obj_t * reference, lv_align_t reference_align, lv_coord_t x, lv_coord_t y, lv_label_align_t text_align, const char * text, const lv_font_t * font, lv_color_t color) {
-    lv_style_t * style = malloc(sizeof(lv_style_t));
+/* Primitives share one style per font, color and line width, the pool is never freed like the screens */
+static lv_style_t * ui_style_get(ui_style_kind_t kind, const lv_font_t * font, lv_color_t color, lv_style_int_t line_width) {
+    ui_style_requests += 1;
+    for (uint32_t i=0; i<ui_style_count; i++) {
+        ui_style_entry_t * entry = &ui_style_pool[i];
+        if (entry->kind == kind && entry->font == font && entry->color.full == color.full && entry->line_width == line_width) {
+            ui_style_saved_bytes += sizeof(lv_style_t) + _lv_style_get_mem_size(&entry->style);
+            return &entry->style;
+        }
+    }
+
+    lv_style_t * style = NULL;
+    if (ui_style_count < UI_STYLE_POOL_SIZE) {
+        ui_style_entry_t * entry = &ui_style_pool[ui_style_count++];
+        entry->kind = kind;
+        entry->font = font;
+        entry->color = color;
+        entry->line_width = line_width;
+        style = &entry->style;
+    } else {
+        ESP_LOGW("SCREEN", "ui_style_get pool full, style allocated");
+        style = malloc(sizeof(lv_style_t));
+    }
+
     lv_style_init(style);
-    lv_style_set_text_font(style, LV_STATE_DEFAULT, font);
-    lv_style_set_text_color(style, LV_STATE_DEFAULT, color);
-    
+    switch (kind) {
+    case UI_STYLE_LABEL:
+        lv_style_set_text_font(style, LV_STATE_DEFAULT, font);
+        lv_style_set_text_color(style, LV_STATE_DEFAULT, color);
+        break;
+    case UI_STYLE_LINE:
+        lv_style_set_line_width(style, LV_STATE_DEFAULT, line_width);
+        lv_style_set_line_color(style, LV_STATE_DEFAULT, color);
+        break;
+    case UI_STYLE_RECT:
+        lv_style_set_radius(style, LV_STATE_DEFAULT, 0);
+        lv_style_set_border_width(style, LV_STATE_DEFAULT, 0);
+        break;
+    default:
+        ; // do nothing
+    }
+
+    return style;
+}
+
+/* Line geometry comes from a static arena, LVGL keeps the pointer for the life of the line */
+static lv_point_t * ui_points_get(uint32_t count) {
+    if (ui_point_count + count <= UI_POINT_POOL_SIZE) {
+        lv_point_t * points = &ui_point_pool[ui_point_count];
+        ui_point_count += count;
+        return points;
+    }
+
+    ESP_LOGW("SCREEN", "ui_points_get pool full, points allocated");
+    return malloc(sizeof(lv_point_t) * count);
+}
+
+/* Digit subsets from the spiffs partition, labels still show with the theme font when the image is not flashed */
+static const lv_font_t * ui_font_digits(const char * name) {
+    const lv_font_t * font = font_loader_get(name);
+    if (font == NULL) {
+        ESP_LOGE("SCREEN", "font %s missing, flash the spiffs image", name);
+        font = LV_THEME_DEFAULT_FONT_TITLE;
+    }
+    return font;
+}
+
+static void ui_style_report(size_t heap_used) {
+    ESP_LOGI("SCREEN", "Screen heap %u bytes, %u styles for %u primitives, %u line points pooled, %u bytes saved",
+        heap_used, ui_style_count, ui_style_requests, ui_point_count,
+        ui_style_saved_bytes + ui_point_count * sizeof(lv_point_t));
+}
+
+lv_obj_t * draw_label(lv_obj_t * parent, lv_obj_t * reference, lv_align_t reference_align, lv_coord_t x, lv_coord_t y, lv_label_align_t text_align, const char * text, const lv_font_t * font, lv_color_t color) {
+    lv_style_t * style = ui_style_get(UI_STYLE_LABEL, font, color, 0);
+
     lv_obj_t * label = lv_label_create(parent, NULL);
     lv_obj_add_style(label, LV_OBJ_PART_MAIN, style);
     lv_label_set_text(label, text);
@@ -113,17 +234,14 @@ lv_obj_t * draw_line(lv_obj_t * parent, lv_coord_t x1, lv_coord_t y1, lv_coord_t
     //ESP_LOGI("SCREEN", "x1:%d, y1:%d, x2:%d, y2:%d", x1, y1, x2, y2);
     lv_obj_t * line = lv_line_create(parent, NULL);
 
-    lv_point_t * line_points = malloc(sizeof(lv_point_t) * 2);
+    lv_point_t * line_points = ui_points_get(2);
     line_points[0].x = x1;
     line_points[0].y = y1;
     line_points[1].x = x2;
     line_points[1].y = y2;
     lv_line_set_points(line, line_points, 2);
 
-    lv_style_t * style = malloc(sizeof(lv_style_t));
-    lv_style_init(style);
-    lv_style_set_line_width(style, LV_STATE_DEFAULT, 1);
-    lv_style_set_line_color(style, LV_STATE_DEFAULT, color);
+    lv_style_t * style = ui_style_get(UI_STYLE_LINE, NULL, color, 1);
     lv_obj_add_style(line, LV_LINE_PART_MAIN, style);
 
     return line;
@@ -135,11 +253,8 @@ lv_obj_t * draw_rect(lv_obj_t * parent, lv_coord_t x, lv_coord_t y, lv_coord_t w
     lv_obj_align(rect, parent, LV_ALIGN_IN_TOP_LEFT, x, y);
     lv_obj_set_size(rect, width, height);
 
-    lv_style_t * style = malloc(sizeof(lv_style_t));
-    lv_style_init(style);
-    //lv_style_set_bg_color(style, LV_STATE_DEFAULT, color);
-    lv_style_set_radius(style, LV_STATE_DEFAULT, 0);
-    lv_style_set_border_width(style, LV_STATE_DEFAULT, 0);
+    // The color is local to each rectangle, so every one of them shares the same style
+    lv_style_t * style = ui_style_get(UI_STYLE_RECT, NULL, LV_COLOR_BLACK, 0);
     lv_obj_add_style(rect, LV_OBJ_PART_MAIN, style);
 
     lv_obj_set_style_local_bg_color(rect, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, color);
@@ -161,13 +276,23 @@ lv_obj_t * draw_icon(lv_obj_t * parent, lv_obj_t * reference, lv_align_t referen
     return icon;
 }
 
-void screen_init() {
+/* Steps 1 to VARIO_BAR_UNITS fill the lift scale, the next ones the sink scale */
+static void ui_sweep_step(void * bar, lv_anim_value_t step) {
+    int32_t units = (step <= VARIO_BAR_UNITS) ? step : VARIO_BAR_UNITS - step;
+    vario_bar_set_speed(bar, units * VARIO_BAR_UNIT_SPEED);
+}
+
+static void ui_sweep_ready(lv_anim_t * sweep) {
+    vario_bar_set_speed(sweep->var, 0);
+    ui_sweeping = false;
+    ui_notify(UI_EVENT_FLIGHT);
+}
+
+void screen_show_splash() {
     int32_t brightness = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS);
 
-    ui_data_mutex = xSemaphoreCreateMutex();
     ui_mutex = xGuiSemaphore;
 
-    // Display logo picture in dark
     xSemaphoreTake(ui_mutex, portMAX_DELAY);
     lv_obj_t * opener_scr = lv_scr_act();
     lv_obj_set_style_local_bg_color(opener_scr, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
@@ -179,19 +304,22 @@ void screen_init() {
     // Release CPU, let ui task render screen
     vTaskDelay(pdMS_TO_TICKS(10));
 
-    // Show logo picture smoothly
-    for (int8_t i = 0; i<=brightness; i++) {
-        Core2ForAWS_Display_SetBrightness(i);
-        vTaskDelay(pdMS_TO_TICKS(1000/brightness));
-    }
+    // The logo stays only while the screens are built, the backlight comes straight up
+    Core2ForAWS_Display_SetBrightness(brightness);
+    display_power_init(brightness);
+}
 
-    vTaskDelay(pdMS_TO_TICKS(1000));
+void screen_init() {
+    ui_mutex = xGuiSemaphore;
 
     xSemaphoreTake(ui_mutex, portMAX_DELAY);
 
     // Clean logo image
+    lv_obj_t * opener_scr = lv_scr_act();
     lv_obj_clean(opener_scr);
 
+    size_t heap_free = heap_caps_get_free_size(MALLOC_CAP_DEFAULT);
+
     // Draw main screen
     main_screen = lv_obj_create(NULL, NULL);
     lv_obj_set_style_local_bg_color(main_screen, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
@@ -205,10 +333,16 @@ void screen_init() {
 
     dashboard_tab = lv_tabview_add_tab(main_screen_tab_view, "dashboard");
     lv_obj_set_event_cb(dashboard_tab, tabview_and_tab_envent_handler);
+    history_tab = lv_tabview_add_tab(main_screen_tab_view, "history");
+    lv_obj_set_event_cb(history_tab, tabview_and_tab_envent_handler);
     motion_tab = lv_tabview_add_tab(main_screen_tab_view, "motion");
     lv_obj_set_event_cb(motion_tab, tabview_and_tab_envent_handler);
     compass_tab = lv_tabview_add_tab(main_screen_tab_view, "compass");
     lv_obj_set_event_cb(compass_tab, tabview_and_tab_envent_handler);
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+    benchmark_tab = lv_tabview_add_tab(main_screen_tab_view, "benchmark");
+    lv_obj_set_event_cb(benchmark_tab, tabview_and_tab_envent_handler);
+#endif
 
     setting_screen = lv_obj_create(NULL, NULL);
     lv_obj_set_style_local_bg_color(setting_screen, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLACK);
@@ -232,23 +366,8 @@ void screen_init() {
     reset_tab = lv_tabview_add_tab(setting_screen_tab_view, "reset");
     lv_obj_set_event_cb(reset_tab, tabview_and_tab_envent_handler);
 
-    // Draw speed bar outline
-    draw_line(main_screen, 0, 0, 0, 239, UI_COLOR_BORDER);
-    draw_line(main_screen, 31, 0, 31, 239, UI_COLOR_BORDER);
-    draw_line(main_screen, 288, 0, 288, 239, UI_COLOR_BORDER);
-    draw_line(main_screen, 319, 0, 319, 239, UI_COLOR_BORDER);
-    for (lv_coord_t i=0; i<9; i++) draw_line(main_screen, 0, i * 14, 31, i * 14, UI_COLOR_BORDER);
-    for (lv_coord_t i=9; i<18; i++) draw_line(main_screen, 0, i * 14 + 1, 31, i * 14 + 1, UI_COLOR_BORDER);
-    for (lv_coord_t i=0; i<9; i++) draw_line(main_screen, 288, i * 14, 319, i * 14, UI_COLOR_BORDER);
-    for (lv_coord_t i=9; i<18; i++) draw_line(main_screen, 288, i * 14 + 1, 319, i * 14 + 1, UI_COLOR_BORDER);
-    // Draw speed bar lift and sink unit
-    for (lv_coord_t i=0; i<8; i++) scale_left_lift[7-i] = draw_rect(main_screen, 1, i * 14 + 1, 30, 13, UI_COLOR_BACKGROUND);
-    for (lv_coord_t i=9; i<17; i++) scale_left_sink[i-9] = draw_rect(main_screen, 1, i * 14 + 2, 30, 13, UI_COLOR_BACKGROUND);
-    for (lv_coord_t i=0; i<8; i++) scale_right_lift[7-i] = draw_rect(main_screen, 289, i * 14 + 1, 30, 13, UI_COLOR_BACKGROUND);
-    for (lv_coord_t i=9; i<17; i++) scale_right_sink[i-9] = draw_rect(main_screen, 289, i * 14 + 2, 30, 13, UI_COLOR_BACKGROUND);
-    // Draw speed bar gliding unit
-    draw_rect(main_screen, 289, 113, 30, 14, LV_COLOR_ORANGE);
-    draw_rect(main_screen, 1, 113, 30, 14, LV_COLOR_ORANGE);
+    // Draw speed bars, both scales are a single object
+    vario_bar = vario_bar_create(main_screen);
 
     // Draw clock text and system icons
     clock_text = draw_label(main_screen, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 6, LV_LABEL_ALIGN_LEFT, "88:88:88", &lv_font_arial_rounded_mt_16, UI_COLOR_TEXT);
@@ -261,19 +380,24 @@ void screen_init() {
     lock_icon = draw_label(main_screen, gps_icon, LV_ALIGN_OUT_LEFT_TOP, -9, 1, LV_LABEL_ALIGN_RIGHT, LV_SYMBOL_LOCK, &awesome_14, UI_COLOR_TEXT );
 
     draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 30, LV_LABEL_ALIGN_LEFT, "altitude(m)", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
-    altitude_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_MID, 0, 45, LV_LABEL_ALIGN_CENTER, "8888", &lv_font_arial_rounded_mt_72, UI_COLOR_TEXT);
+    altitude_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_MID, 0, 45, LV_LABEL_ALIGN_CENTER, "8888", ui_font_digits(FONT_LOADER_DIGITS_72), UI_COLOR_TEXT);
 
     draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 116, LV_LABEL_ALIGN_LEFT, "v-speed(m/s)", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
-    speed_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -168, 135, LV_LABEL_ALIGN_RIGHT, "18.88", &lv_font_arial_rounded_mt_32, UI_COLOR_TEXT);
+    speed_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -168, 135, LV_LABEL_ALIGN_RIGHT, "18.88", ui_font_digits(FONT_LOADER_DIGITS_32), UI_COLOR_TEXT);
 
     draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 173, LV_LABEL_ALIGN_LEFT, "temperature", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
-    temperature_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -168, 192, LV_LABEL_ALIGN_RIGHT, "25.88", &lv_font_arial_rounded_mt_32, UI_COLOR_TEXT);
+    temperature_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -168, 192, LV_LABEL_ALIGN_RIGHT, "25.88", ui_font_digits(FONT_LOADER_DIGITS_32), UI_COLOR_TEXT);
 
     draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 168, 116, LV_LABEL_ALIGN_LEFT, "pressure(hp)", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
-    pressure_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -48, 135, LV_LABEL_ALIGN_RIGHT, "1013.2", &lv_font_arial_rounded_mt_32, UI_COLOR_TEXT);
+    pressure_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -48, 135, LV_LABEL_ALIGN_RIGHT, "1013.2", ui_font_digits(FONT_LOADER_DIGITS_32), UI_COLOR_TEXT);
 
     draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 168, 173, LV_LABEL_ALIGN_LEFT, "humidity(%)", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
-    humidity_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -48, 192, LV_LABEL_ALIGN_RIGHT, "99.9", &lv_font_arial_rounded_mt_32, UI_COLOR_TEXT);
+    humidity_text = draw_label(dashboard_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -48, 192, LV_LABEL_ALIGN_RIGHT, "99.9", ui_font_digits(FONT_LOADER_DIGITS_32), UI_COLOR_TEXT);
+
+    draw_label(history_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 30, LV_LABEL_ALIGN_LEFT, "climb(4 min)", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
+    history_range_text = draw_label(history_tab, main_screen, LV_ALIGN_IN_TOP_RIGHT, -48, 30, LV_LABEL_ALIGN_RIGHT, "", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
+    history_graph = history_graph_create(history_tab);
+    lv_obj_align(history_graph, history_tab, LV_ALIGN_CENTER, 0, 12);
 
     static lv_color_t needle_colors[3] = {LV_COLOR_BLUE, LV_COLOR_ORANGE, LV_COLOR_PURPLE};
     motion_gauge = lv_gauge_create(motion_tab, NULL);
@@ -282,15 +406,25 @@ void screen_init() {
     lv_gauge_set_scale(motion_gauge, 270, 31, 7);
     lv_gauge_set_needle_count(motion_gauge, 3, needle_colors);
     lv_obj_align(motion_gauge, motion_tab, LV_ALIGN_CENTER, 0, 12);
-    lv_gauge_set_value(motion_gauge, 0, -30);
+    lv_gauge_set_value(motion_gauge, 0, 0);
     lv_gauge_set_value(motion_gauge, 1, 0);
-    lv_gauge_set_value(motion_gauge, 2, 60);
+    lv_gauge_set_value(motion_gauge, 2, 0);
 
+#ifdef CONFIG_LV_COMPASS_BITMAP
     compass_image = lv_img_create(compass_tab, NULL);
     lv_img_set_src(compass_image, &compass);
     lv_obj_set_size(compass_image, 192, 192);
     lv_obj_align(compass_image, compass_tab, LV_ALIGN_CENTER, 0, 12);
     lv_img_set_pivot(compass_image, 96, 96);
+#else
+    compass_card = compass_dial_create(compass_tab, 192, &lv_font_arial_rounded_mt_20);
+    lv_obj_align(compass_card, compass_tab, LV_ALIGN_CENTER, 0, 12);
+#endif
+
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+    draw_label(benchmark_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 30, LV_LABEL_ALIGN_LEFT, "display benchmark", LV_THEME_DEFAULT_FONT_SMALL, UI_COLOR_LABEL);
+    benchmark_text = draw_label(benchmark_tab, main_screen, LV_ALIGN_IN_TOP_LEFT, 48, 56, LV_LABEL_ALIGN_LEFT, "", &lv_font_arial_rounded_mt_18, UI_COLOR_TEXT);
+#endif
 
     // Draw clock tab elements
     draw_label(time_tab, time_tab, LV_ALIGN_IN_TOP_MID, 0, 16, LV_LABEL_ALIGN_CENTER, "System Time Setting", LV_THEME_DEFAULT_FONT_TITLE, UI_COLOR_LABEL);
@@ -376,27 +510,20 @@ void screen_init() {
 
     xSemaphoreGive(ui_mutex);
 
-    // Draw speed bar animation show
-    for (int i=0; i<8; i++) {
-        xSemaphoreTake(ui_mutex, portMAX_DELAY);
-        fill_rect(scale_left_lift[i], UI_COLOR_SCALE_LIFT);
-        fill_rect(scale_left_sink[i], UI_COLOR_SCALE_SINK);
-        fill_rect(scale_right_lift[i], UI_COLOR_SCALE_LIFT);
-        fill_rect(scale_right_sink[i], UI_COLOR_SCALE_SINK);
-        xSemaphoreGive(ui_mutex);
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
+    ui_style_report(heap_free - heap_caps_get_free_size(MALLOC_CAP_DEFAULT));
 
-    // Draw speed bar animation hide
-    for (int i=0; i<8; i++) {
-        xSemaphoreTake(ui_mutex, portMAX_DELAY);
-        fill_rect(scale_left_lift[i], UI_COLOR_BACKGROUND);
-        fill_rect(scale_left_sink[i], UI_COLOR_BACKGROUND);
-        fill_rect(scale_right_lift[i], UI_COLOR_BACKGROUND);
-        fill_rect(scale_right_sink[i], UI_COLOR_BACKGROUND);
-        xSemaphoreGive(ui_mutex);
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
+    // Speed bar animation, lift scale up then sink scale down, runs in LVGL while the boot goes on
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+    lv_anim_t sweep;
+    lv_anim_init(&sweep);
+    lv_anim_set_var(&sweep, vario_bar);
+    lv_anim_set_exec_cb(&sweep, ui_sweep_step);
+    lv_anim_set_values(&sweep, 1, 2 * VARIO_BAR_UNITS);
+    lv_anim_set_time(&sweep, 2 * VARIO_BAR_UNITS * UI_SWEEP_STEP_MS);
+    lv_anim_set_ready_cb(&sweep, ui_sweep_ready);
+    ui_sweeping = true;
+    lv_anim_start(&sweep);
+    xSemaphoreGive(ui_mutex);
 
     int32_t volume = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME);
     ui_set_volume(volume);
@@ -406,366 +533,573 @@ void screen_init() {
 
     current_screen = main_screen;
 
-    xTaskCreate(ui_loop, "SCREENTASK", 16384, NULL, tskIDLE_PRIORITY+2, NULL);
+    xTaskCreate(ui_loop, "SCREENTASK", 16384, NULL, tskIDLE_PRIORITY+2, &ui_task);
+}
+
+/* Heading in degrees clockwise from north, the card turns the other way so north stays north */
+static void ui_set_compass(double heading) {
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+#ifdef CONFIG_LV_COMPASS_BITMAP
+    lv_img_set_angle(compass_image, 3600 - (int32_t)lround(heading * 10.0) % 3600);
+#else
+    compass_dial_set_heading(compass_card, heading);
+#endif
+    xSemaphoreGive(ui_mutex);
+}
+
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+typedef enum {
+    UI_BENCHMARK_NONE,
+    UI_BENCHMARK_SPEED,
+    UI_BENCHMARK_COMPASS,
+} ui_benchmark_t;
+
+static ui_benchmark_t ui_benchmark_running(void) {
+    ui_benchmark_t benchmark = UI_BENCHMARK_NONE;
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+    if (current_screen == main_screen) {
+        lv_obj_t * active = lv_tabview_get_tab(main_screen_tab_view, lv_tabview_get_tab_act(main_screen_tab_view));
+        benchmark = (active == benchmark_tab) ? UI_BENCHMARK_SPEED : ((active == compass_tab) ? UI_BENCHMARK_COMPASS : UI_BENCHMARK_NONE);
+    }
+    xSemaphoreGive(ui_mutex);
+
+    return benchmark;
 }
 
+/* Triangle sweep over the whole speed bar, every step redraws bar units */
+static double ui_benchmark_speed(void) {
+    static double speed = 0.0;
+    static double step = UI_BENCHMARK_SWEEP_STEP;
+    speed += step;
+    if (speed >= 9.0 || speed <= -9.0) {
+        step = -step;
+    }
+    return speed;
+}
+
+static double ui_benchmark_heading(void) {
+    static double heading = 0.0;
+    heading += UI_BENCHMARK_SPIN_STEP;
+    return heading;
+}
+
+static void ui_benchmark_report(void) {
+    static TickType_t last_report_ticks = 0;
+    TickType_t now_ticks = xTaskGetTickCount();
+    if (now_ticks - last_report_ticks < pdMS_TO_TICKS(UI_BENCHMARK_REPORT_MS)) {
+        return;
+    }
+
+    disp_driver_stats_t stats;
+    disp_driver_get_stats(&stats, true);
+    double seconds = (now_ticks - last_report_ticks) * portTICK_PERIOD_MS / 1000.0;
+    last_report_ticks = now_ticks;
+
+    char text[192];
+    int length = snprintf(text, sizeof(text), "%.1f fps, %u kpx/s\nframe %u ms, max %u ms\nflush %u us, max %u us\n%.2f MB/s, %u bounced",
+        stats.frames / seconds, (uint32_t)(stats.pixels / seconds / 1000),
+        stats.frames ? stats.frame_ms / stats.frames : 0, stats.frame_ms_max,
+        stats.flush.flushes ? (uint32_t)(stats.flush.flush_us / stats.flush.flushes) : 0, stats.flush.flush_us_max,
+        stats.flush.bytes / seconds / 1000000.0, stats.flush.bounced);
+
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+#ifndef CONFIG_LV_COMPASS_BITMAP
+    compass_dial_stats_t compass_stats;
+    compass_dial_get_stats(&compass_stats, true);
+    snprintf(text + length, sizeof(text) - length, "\ncompass %u us, max %u us",
+        compass_stats.draws ? (uint32_t)(compass_stats.draw_us / compass_stats.draws) : 0, compass_stats.draw_us_max);
+#endif
+    lv_label_set_text(benchmark_text, text);
+    xSemaphoreGive(ui_mutex);
+
+    // The compass tab hides the report
+    ESP_LOGI("SCREEN", "Benchmark %s", text);
+}
+#endif
+
 static void stop_motor_and_delete_timer(xTimerHandle handle) {
     ui_stop_motor();
     xTimerDelete(handle, 10);
 }
 
-void ui_loop(void * arguemnt) {
-    static double altitude = 0;
-    static double speed = 0;
-    static double pressure = 101325.0;
-    static double temperature = 25.88;
-    static double humidity = 99.99;
-
-    for ( ; ; ) {
-        vTaskDelay(pdMS_TO_TICKS(250));
+void ui_notify(uint32_t events) {
+    if (ui_task != NULL) {
+        xTaskNotify(ui_task, events, eSetBits);
+    }
+}
 
-        xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-        altitude = ui_altitude;
-        xSemaphoreGive(ui_data_mutex);
+/* Runs in the timer service task, the RTC and the PMU are read by the UI task itself */
+static void ui_clock_timer_callback(xTimerHandle handle) {
+    static uint32_t periods = 0;
+    uint32_t events = UI_EVENT_CLOCK;
+    if (periods++ % UI_BATTERY_PERIODS == 0) {
+        events |= UI_EVENT_BATTERY;
+    }
+    ui_notify(events);
+}
 
-        static char last_altitude_string[16] = {'\0'};
-        char altitude_string[16];
-        snprintf(altitude_string, 16, "%.0f", altitude);
+/* Fixed point integer to text, decimals digits go behind the point */
+static char * ui_format_fixed(char * text, int32_t value, int decimals) {
+    char digits[12];
+    int count = 0;
+    uint32_t magnitude = (value < 0) ? -(uint32_t)value : (uint32_t)value;
 
-        if (0 != strcmp(altitude_string, last_altitude_string)) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(altitude_text, altitude_string);
-            xSemaphoreGive(ui_mutex);
+    do {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0 || count <= decimals);
 
-            strcpy(last_altitude_string, altitude_string);
+    char * cursor = text;
+    if (value < 0) {
+        *cursor++ = '-';
+    }
+    while (count > 0) {
+        if (count == decimals) {
+            *cursor++ = '.';
         }
+        *cursor++ = digits[--count];
+    }
+    *cursor = '\0';
 
-        xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-        speed = ui_speed;
-        xSemaphoreGive(ui_data_mutex);
+    return text;
+}
+
+static char * ui_format_two_digits(char * text, uint32_t value) {
+    text[0] = '0' + (value / 10) % 10;
+    text[1] = '0' + value % 10;
+    return text + 2;
+}
+
+/* Rounds half away from zero like the printf formats it replaces */
+static int32_t ui_divide_round(int32_t value, int32_t divisor) {
+    return (value >= 0) ? (value + divisor / 2) / divisor : (value - divisor / 2) / divisor;
+}
 
-        static char last_speed_string[16] = {'\0'};
-        char speed_string[16];
+static void ui_update_flight(int32_t altitude, int32_t speed) {
+    static int32_t last_altitude = INT32_MIN;
+    static int32_t last_speed = INT32_MIN;
+    char text[16];
 
-        if (speed >= 100.0 || speed <= -10.0) {
-            snprintf(speed_string, 16, "%.1f", speed);
+    if (altitude != last_altitude) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(altitude_text, ui_format_fixed(text, altitude, 0));
+        xSemaphoreGive(ui_mutex);
+        last_altitude = altitude;
+    }
+
+    // Speed is in cm/s, one decimal less once the integer part takes more digits
+    if (speed != last_speed) {
+        if (speed >= 10000 || speed <= -1000) {
+            ui_format_fixed(text, ui_divide_round(speed, 10), 1);
         } else {
-            snprintf(speed_string, 16, "%.2f", speed);
+            ui_format_fixed(text, speed, 2);
         }
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(speed_text, text);
+        xSemaphoreGive(ui_mutex);
+        last_speed = speed;
+    }
 
-        if (0 != strcmp (speed_string, last_speed_string)) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(speed_text, speed_string);
-            xSemaphoreGive(ui_mutex);
-            strcpy(last_speed_string, speed_string);
-        }
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+    if (!ui_sweeping) {
+        vario_bar_set_speed(vario_bar, speed);
+    }
+    xSemaphoreGive(ui_mutex);
+}
 
-        static int32_t last_meter_speed = 0;
-        int32_t meter_speed = (int32_t)speed;
-        meter_speed = ((meter_speed > 8) ? 8 : ((meter_speed < -8) ? -8 : meter_speed));
+/* Gauge needles are roll, pitch and the heading from -180 to 180 */
+static void ui_update_attitude(const telemetry_t * telemetry, bool compass) {
+    int32_t heading = (int32_t)lroundf(telemetry->heading);
 
-        if (meter_speed != last_meter_speed) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            if (last_meter_speed > 0) {
-                for (int i=0; i<last_meter_speed; i++) {
-                    fill_rect(scale_left_lift[i], UI_COLOR_BACKGROUND);
-                    fill_rect(scale_right_lift[i], UI_COLOR_BACKGROUND);
-                }
-            }
-            if (last_meter_speed < 0) {
-                for (int i=0; i<-last_meter_speed; i++) {
-                    fill_rect(scale_left_sink[i], UI_COLOR_BACKGROUND);
-                    fill_rect(scale_right_sink[i], UI_COLOR_BACKGROUND);
-                }
-            }
-            if (meter_speed > 0) {
-                for (int i=0; i<meter_speed; i++) {
-                    fill_rect(scale_left_lift[i], UI_COLOR_SCALE_LIFT);
-                    fill_rect(scale_right_lift[i], UI_COLOR_SCALE_LIFT);
-                }
-            }
-            if (meter_speed < 0) {
-                for (int i=0; i<-meter_speed; i++) {
-                    fill_rect(scale_left_sink[i], UI_COLOR_SCALE_SINK);
-                    fill_rect(scale_right_sink[i], UI_COLOR_SCALE_SINK);
-                }
-            }
-            xSemaphoreGive(ui_mutex);    
-            last_meter_speed = meter_speed;
-        }
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+    lv_gauge_set_value(motion_gauge, 0, (int32_t)lroundf(telemetry->roll));
+    lv_gauge_set_value(motion_gauge, 1, (int32_t)lroundf(telemetry->pitch));
+    lv_gauge_set_value(motion_gauge, 2, (heading > 180) ? heading - 360 : heading);
+    xSemaphoreGive(ui_mutex);
+
+    if (compass) {
+        ui_set_compass(telemetry->heading);
+    }
+}
 
-        xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-        pressure = ui_pressure;
-        xSemaphoreGive(ui_data_mutex);
+static void ui_update_history(void) {
+    static int32_t last_floor = INT32_MIN;
+    static int32_t last_ceiling = INT32_MIN;
+    int32_t floor;
+    int32_t ceiling;
+    char text[32];
 
-        static char last_pressure_string[16] = {'\0'};
-        char pressure_string[16];
-        snprintf(pressure_string, 16, "%.1f", pressure / 100);
-        if (0 != strcmp(pressure_string, last_pressure_string)) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(pressure_text, pressure_string);
-            xSemaphoreGive(ui_mutex);
-            strcpy(last_pressure_string, pressure_string);
-        }
+    xSemaphoreTake(ui_mutex, portMAX_DELAY);
+    history_graph_update(history_graph);
+    history_graph_get_range(history_graph, &floor, &ceiling);
+    if (floor != last_floor || ceiling != last_ceiling) {
+        char * cursor = ui_format_fixed(text, floor, 0);
+        cursor += strlen(cursor);
+        *cursor++ = '-';
+        ui_format_fixed(cursor, ceiling, 0);
+        strcat(cursor, "m");
+        lv_label_set_text(history_range_text, text);
+        last_floor = floor;
+        last_ceiling = ceiling;
+    }
+    xSemaphoreGive(ui_mutex);
+}
 
-        xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-        temperature = ui_temperature;
-        xSemaphoreGive(ui_data_mutex);
+static void ui_update_environment(const telemetry_t * telemetry) {
+    static int32_t last_pressure = INT32_MIN;
+    static int32_t last_temperature = INT32_MIN;
+    static int32_t last_humidity = INT32_MIN;
+    char text[16];
 
-        static char last_temperature_string[16] = {'\0'};
-        char temperature_string[16];
-        snprintf(temperature_string, 16, "%.1f", temperature);
-        if (0 != strcmp(last_temperature_string, temperature_string)) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(temperature_text, temperature_string);
-            xSemaphoreGive(ui_mutex);
-            strcpy(last_temperature_string, temperature_string);
-        }
-        
-        xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-        humidity = ui_humidity;
-        xSemaphoreGive(ui_data_mutex);
+    // All three are shown with one decimal, pressure in hPa from Pa
+    int32_t pressure = (int32_t)lroundf(telemetry->pressure / 10.0f);
+    if (pressure != last_pressure) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(pressure_text, ui_format_fixed(text, pressure, 1));
+        xSemaphoreGive(ui_mutex);
+        last_pressure = pressure;
+    }
 
-        static char last_humidity_string[16] = {'\0'};
-        char humidity_string[16];
-        snprintf(humidity_string, 16, "%.1f", humidity);
-        if (0 != strcmp(humidity_string, last_humidity_string)) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(humidity_text, humidity_string);
-            xSemaphoreGive(ui_mutex);
-            strcpy(last_humidity_string, humidity_string);
-        }
+    int32_t temperature = (int32_t)lroundf(telemetry->temperature * 10.0f);
+    if (temperature != last_temperature) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(temperature_text, ui_format_fixed(text, temperature, 1));
+        xSemaphoreGive(ui_mutex);
+        last_temperature = temperature;
+    }
 
-        static rtc_date_t last_datetime = {2023, 3, 30, 15, 29, 0};
-        rtc_date_t current_datetime;
-        BM8563_GetTime(&current_datetime);
+    int32_t humidity = (int32_t)lroundf(telemetry->humidity * 10.0f);
+    if (humidity != last_humidity) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(humidity_text, ui_format_fixed(text, humidity, 1));
+        xSemaphoreGive(ui_mutex);
+        last_humidity = humidity;
+    }
+}
 
-        if (current_datetime.second != last_datetime.second) {
-            char string[16];
-            snprintf(string, 16, "%02d:%02d:%02d", current_datetime.hour%64u, current_datetime.minute%64u, current_datetime.second%64u);
+static void ui_update_clock(void) {
+    static uint8_t last_second = UINT8_MAX;
+    rtc_date_t datetime;
+    BM8563_GetTime(&datetime);
 
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            lv_label_set_text(clock_text, string);
-            xSemaphoreGive(ui_mutex);
+    if (datetime.second != last_second) {
+        char text[16];
+        char * cursor = ui_format_two_digits(text, datetime.hour % 64u);
+        *cursor++ = ':';
+        cursor = ui_format_two_digits(cursor, datetime.minute % 64u);
+        *cursor++ = ':';
+        cursor = ui_format_two_digits(cursor, datetime.second % 64u);
+        *cursor = '\0';
 
-            last_datetime = current_datetime;
-        }
-
-        typedef enum {
-            BATTERY_VOLTAGE_LEVEL_EMPTY,
-            BATTERY_VOLTAGE_LEVEL_1,
-            BATTERY_VOLTAGE_LEVEL_2,
-            BATTERY_VOLTAGE_LEVEL_3,
-            BATTERY_VOLTAGE_LEVEL_FULL,
-            BATTERY_VOLTAGE_LEVEL_INVALID,
-        } battery_voltage_level_t;
-
-        static battery_voltage_level_t last_battery_voltage_level = BATTERY_VOLTAGE_LEVEL_INVALID;
-        int32_t battery_voltage = (int32_t)(Core2ForAWS_PMU_GetBatVolt() * 1000.0);
-        battery_voltage_level_t battery_voltage_level;
-
-        if (battery_voltage < 3000) {
-            ESP_LOGI("SCREEN", "Run out of power, power off.");
-            Axp192_PowerOff();
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_EMPTY;
-        } else if (battery_voltage < 3250) {
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_EMPTY;
-        } else if (battery_voltage < 3800) {
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_1;
-        } else if (battery_voltage < 3950) {
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_2;
-        } else if (battery_voltage < 4100) {
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_3;
-        } else {
-            battery_voltage_level = BATTERY_VOLTAGE_LEVEL_FULL;
-        }
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        lv_label_set_text(clock_text, text);
+        xSemaphoreGive(ui_mutex);
 
-        if (battery_voltage_level != last_battery_voltage_level) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            switch (battery_voltage_level) {
-            case BATTERY_VOLTAGE_LEVEL_EMPTY:
-                lv_label_set_text(battery_icon, "#ff0000 " LV_SYMBOL_BATTERY_EMPTY "#");
-                break;
-            case BATTERY_VOLTAGE_LEVEL_1:
-                lv_label_set_text(battery_icon, "#ff0000 " LV_SYMBOL_BATTERY_1 "#");
-                break;
-            case BATTERY_VOLTAGE_LEVEL_2:
-                lv_label_set_text(battery_icon, "#ff9900 " LV_SYMBOL_BATTERY_2 "#");
-                break;
-            case BATTERY_VOLTAGE_LEVEL_3:
-                lv_label_set_text(battery_icon, "#0ab300 " LV_SYMBOL_BATTERY_3 "#");
-                break;
-            case BATTERY_VOLTAGE_LEVEL_FULL:
-                lv_label_set_text(battery_icon, "#0ab300 " LV_SYMBOL_BATTERY_FULL "#");
-                break;
-            default:
-                ;// do nothing
-            }
-            xSemaphoreGive(ui_mutex);
+        last_second = datetime.second;
+    }
+}
+
+static void ui_update_battery(void) {
+    typedef enum {
+        BATTERY_VOLTAGE_LEVEL_EMPTY,
+        BATTERY_VOLTAGE_LEVEL_1,
+        BATTERY_VOLTAGE_LEVEL_2,
+        BATTERY_VOLTAGE_LEVEL_3,
+        BATTERY_VOLTAGE_LEVEL_FULL,
+        BATTERY_VOLTAGE_LEVEL_INVALID,
+    } battery_voltage_level_t;
+
+    static battery_voltage_level_t last_battery_voltage_level = BATTERY_VOLTAGE_LEVEL_INVALID;
+    int32_t battery_voltage = (int32_t)(Core2ForAWS_PMU_GetBatVolt() * 1000.0);
+    battery_voltage_level_t battery_voltage_level;
+
+    if (battery_voltage < 3000) {
+        ESP_LOGI("SCREEN", "Run out of power, power off.");
+        Axp192_PowerOff();
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_EMPTY;
+    } else if (battery_voltage < 3250) {
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_EMPTY;
+    } else if (battery_voltage < 3800) {
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_1;
+    } else if (battery_voltage < 3950) {
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_2;
+    } else if (battery_voltage < 4100) {
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_3;
+    } else {
+        battery_voltage_level = BATTERY_VOLTAGE_LEVEL_FULL;
+    }
 
-            last_battery_voltage_level = battery_voltage_level;
+    if (battery_voltage_level != last_battery_voltage_level) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        switch (battery_voltage_level) {
+        case BATTERY_VOLTAGE_LEVEL_EMPTY:
+            lv_label_set_text(battery_icon, "#ff0000 " LV_SYMBOL_BATTERY_EMPTY "#");
+            break;
+        case BATTERY_VOLTAGE_LEVEL_1:
+            lv_label_set_text(battery_icon, "#ff0000 " LV_SYMBOL_BATTERY_1 "#");
+            break;
+        case BATTERY_VOLTAGE_LEVEL_2:
+            lv_label_set_text(battery_icon, "#ff9900 " LV_SYMBOL_BATTERY_2 "#");
+            break;
+        case BATTERY_VOLTAGE_LEVEL_3:
+            lv_label_set_text(battery_icon, "#0ab300 " LV_SYMBOL_BATTERY_3 "#");
+            break;
+        case BATTERY_VOLTAGE_LEVEL_FULL:
+            lv_label_set_text(battery_icon, "#0ab300 " LV_SYMBOL_BATTERY_FULL "#");
+            break;
+        default:
+            ;// do nothing
         }
+        xSemaphoreGive(ui_mutex);
 
-        typedef enum {
-            BATTERY_CHAEGE_STATE_CHARGING,
-            BATTERY_CHAEGE_STATE_CONSUMING,
-            BATTERY_CHARGE_STATE_INVALID,
-        } battery_charge_state_t;
+        last_battery_voltage_level = battery_voltage_level;
+    }
 
-        static battery_charge_state_t last_battery_charge_state = BATTERY_CHARGE_STATE_INVALID;
-        float battery_current = Core2ForAWS_PMU_GetBatCurrent();
-        //ESP_LOGI("SCREEN", "Battery current:%f",battery_current);
-        battery_charge_state_t battery_charge_state;
+    typedef enum {
+        BATTERY_CHAEGE_STATE_CHARGING,
+        BATTERY_CHAEGE_STATE_CONSUMING,
+        BATTERY_CHARGE_STATE_INVALID,
+    } battery_charge_state_t;
+
+    static battery_charge_state_t last_battery_charge_state = BATTERY_CHARGE_STATE_INVALID;
+    float battery_current = Core2ForAWS_PMU_GetBatCurrent();
+    //ESP_LOGI("SCREEN", "Battery current:%f",battery_current);
+    battery_charge_state_t battery_charge_state;
+
+    if (battery_current >= 0.0f) {
+        battery_charge_state = BATTERY_CHAEGE_STATE_CHARGING;
+    } else {
+        battery_charge_state = BATTERY_CHAEGE_STATE_CONSUMING;
+    }
 
-        if (battery_current >= 0.0f) {
-            battery_charge_state = BATTERY_CHAEGE_STATE_CHARGING;
-        } else {
-            battery_charge_state = BATTERY_CHAEGE_STATE_CONSUMING;
+    if (battery_charge_state != last_battery_charge_state) {
+        xSemaphoreTake(ui_mutex, portMAX_DELAY);
+        switch (battery_charge_state) {
+        case BATTERY_CHAEGE_STATE_CHARGING:
+            lv_label_set_text(charge_icon, "#ffffff " LV_SYMBOL_CHARGE "#");
+            break;
+        case BATTERY_CHAEGE_STATE_CONSUMING:
+            lv_label_set_text(charge_icon, "");
+            break;
+        default:
+            ;// do nothing
         }
+        xSemaphoreGive(ui_mutex);
 
-        if (battery_charge_state != last_battery_charge_state) {
-            xSemaphoreTake(ui_mutex, portMAX_DELAY);
-            switch (battery_charge_state) {
-            case BATTERY_CHAEGE_STATE_CHARGING:
-                lv_label_set_text(charge_icon, "#ffffff " LV_SYMBOL_CHARGE "#");
-                break;
-            case BATTERY_CHAEGE_STATE_CONSUMING:
-                lv_label_set_text(charge_icon, "");
-                break;
-            default:
-                ;// do nothing
+        last_battery_charge_state = battery_charge_state;
+    }
+}
+
+static void ui_handle_buttons(void) {
+    if (Button_WasLongPress(button_left)) {
+        if (KEY_STATE_LOCKED == ui_get_key_state()) {
+            ui_set_key_state(KEY_STATE_UNLOCKED);
+            config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_KEYS_LOCK, KEY_STATE_UNLOCKED);
+        } else {
+            ui_set_key_state(KEY_STATE_LOCKED);
+            config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_KEYS_LOCK, KEY_STATE_LOCKED);
+            if (current_screen == setting_screen) {
+                xSemaphoreTake(ui_mutex, portMAX_DELAY);
+                lv_event_send(main_screen_tab_view, LV_EVENT_REFRESH, NULL);
+                lv_scr_load_anim(main_screen, LV_SCR_LOAD_ANIM_MOVE_TOP, 400, 0, false);
+                xSemaphoreGive(ui_mutex);
+                current_screen = main_screen;
             }
-            xSemaphoreGive(ui_mutex);
+        }
 
-            last_battery_charge_state = battery_charge_state;
+        Button_WasPressed(button_left);
+        Button_WasPressed(button_right);
+        Button_WasPressed(button_middle);
+
+        xTimerHandle handle = xTimerCreate("reset", pdMS_TO_TICKS(200), pdFALSE, NULL, stop_motor_and_delete_timer);
+        if (handle != NULL) {
+            if(xTimerStart(handle, 0) == pdPASS) {
+                ui_start_motor();
+            }
         }
+    }
 
-        if (Button_WasLongPress(button_left)) {
-            if (KEY_STATE_LOCKED == ui_get_key_state()) {
-                ui_set_key_state(KEY_STATE_UNLOCKED);
-                config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_KEYS_LOCK, KEY_STATE_UNLOCKED);
+    if (ui_get_key_state() != KEY_STATE_LOCKED) {
+        if (Button_IsRelease(button_left) && Button_WasPressed(button_left)) {
+            int32_t volume = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME);
+
+            if (volume >= 100) {
+                volume = 0;
             } else {
-                ui_set_key_state(KEY_STATE_LOCKED);
-                config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_KEYS_LOCK, KEY_STATE_LOCKED);
-                if (current_screen == setting_screen) {
-                    xSemaphoreTake(ui_mutex, portMAX_DELAY);
-                    lv_event_send(main_screen_tab_view, LV_EVENT_REFRESH, NULL);
-                    lv_scr_load_anim(main_screen, LV_SCR_LOAD_ANIM_MOVE_TOP, 400, 0, false);
-                    xSemaphoreGive(ui_mutex);
-                    current_screen = main_screen;
+                volume += 20;
+                if (volume > 100) {
+                    volume = 100;
                 }
             }
+            config_set_integer_temporary(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME, volume);
+            //config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME, volume);
 
-            Button_WasPressed(button_left);
-            Button_WasPressed(button_right);
-            Button_WasPressed(button_middle);
+            xSemaphoreTake(ui_mutex, portMAX_DELAY);
+            lv_slider_set_value(volume_slider, config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME), LV_ANIM_OFF);
+            xSemaphoreGive(ui_mutex);
 
-            xTimerHandle handle = xTimerCreate("reset", pdMS_TO_TICKS(200), pdFALSE, NULL, stop_motor_and_delete_timer);
-            if (handle != NULL) {
-                if(xTimerStart(handle, 0) == pdPASS) {
-                    ui_start_motor();
-                }
-            }
+            ui_set_volume(volume);
         }
 
-        if (ui_get_key_state() != KEY_STATE_LOCKED) {
-            if (Button_IsRelease(button_left) && Button_WasPressed(button_left)) {
-                int32_t volume = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME);
+        if (Button_IsRelease(button_right) && Button_WasPressed(button_right)) {
+            int32_t brightness = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS);
 
-                if (volume >= 100) {
-                    volume = 0;
-                } else {
-                    volume += 20;
-                    if (volume > 100) {
-                        volume = 100;
-                    }
+            if (brightness >= 100) {
+                brightness = 30;
+            } else {
+                brightness += 10;
+                if (brightness > 100) {
+                    brightness = 100;
                 }
-                config_set_integer_temporary(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME, volume);
-                //config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME, volume);
+            }
+            config_set_integer_temporary(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS, brightness);
+            //config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS, brightness);
+
+            xSemaphoreTake(ui_mutex, portMAX_DELAY);
+            lv_slider_set_value(brightness_slider, config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS), LV_ANIM_OFF);
+            xSemaphoreGive(ui_mutex);
+        }
 
+        if (Button_IsRelease(button_middle) && Button_WasPressed(button_middle)) {
+            if (current_screen == main_screen) {
                 xSemaphoreTake(ui_mutex, portMAX_DELAY);
-                lv_slider_set_value(volume_slider, config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME), LV_ANIM_OFF);
+                lv_event_send(setting_screen_tab_view, LV_EVENT_REFRESH, NULL);
+                lv_scr_load_anim(setting_screen, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 400, 0, false);
                 xSemaphoreGive(ui_mutex);
-
-                ui_set_volume(volume);
+                current_screen = setting_screen;
+            } else if (current_screen == setting_screen) {
+                xSemaphoreTake(ui_mutex, portMAX_DELAY);
+                lv_event_send(main_screen_tab_view, LV_EVENT_REFRESH, NULL);
+                lv_scr_load_anim(main_screen, LV_SCR_LOAD_ANIM_MOVE_TOP, 400, 0, false);
+                xSemaphoreGive(ui_mutex);
+                current_screen = main_screen;
+            } else {
+                ;// do nothing
             }
+        }
+    }
+}
+
+/* Press events of a touch that only woke the display */
+static void ui_discard_buttons(void) {
+    Button_t * buttons[] = {button_left, button_middle, button_right};
+    for (int i = 0; i < 3; i++) {
+        Button_WasPressed(buttons[i]);
+        Button_WasReleased(buttons[i]);
+        Button_WasLongPress(buttons[i]);
+    }
+}
 
-            if (Button_IsRelease(button_right) && Button_WasPressed(button_right)) {
-                int32_t brightness = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS);
+void ui_loop(void * arguemnt) {
+    config_subscribe(xTaskGetCurrentTaskHandle(), UI_EVENT_CONFIG);
+    Button_SetNotify(xTaskGetCurrentTaskHandle(), UI_EVENT_BUTTON);
 
-                if (brightness >= 100) {
-                    brightness = 30;
-                } else {
-                    brightness += 10;
-                    if (brightness > 100) {
-                        brightness = 100;
-                    }
-                }
-                config_set_integer_temporary(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS, brightness);
-                //config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS, brightness);
+    xTimerHandle clock_timer = xTimerCreate("ui_clock", pdMS_TO_TICKS(UI_CLOCK_PERIOD_MS), pdTRUE, NULL, ui_clock_timer_callback);
+    if (clock_timer == NULL || xTimerStart(clock_timer, portMAX_DELAY) != pdPASS) {
+        ESP_LOGE("SCREEN", "ui_loop clock timer failed");
+    }
 
-                xSemaphoreTake(ui_mutex, portMAX_DELAY);
-                lv_slider_set_value(brightness_slider, config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS), LV_ANIM_OFF);
-                xSemaphoreGive(ui_mutex);
+    // Everything is drawn once, then only what the producers mark dirty
+    uint32_t events = UI_EVENT_FLIGHT | UI_EVENT_ENVIRONMENT | UI_EVENT_CLOCK | UI_EVENT_BATTERY | UI_EVENT_BUTTON | UI_EVENT_CONFIG | UI_EVENT_HISTORY | UI_EVENT_ATTITUDE;
+    uint32_t sleeping_events = 0;
 
-                ui_set_brightness(brightness);
+    for ( ; ; ) {
+        telemetry_t telemetry;
+        telemetry_read(&telemetry);
+
+        if (events & UI_EVENT_BUTTON) {
+            if (display_power_touch(FT6336U_WasPressed())) {
+                ui_discard_buttons();
+                events &= ~UI_EVENT_BUTTON;
             }
+        }
+        if (events & UI_EVENT_FLIGHT) {
+            display_power_vario(telemetry.speed);
+        }
 
-            if (Button_IsRelease(button_middle) && Button_WasPressed(button_middle)) {
-                if (current_screen == main_screen) {
-                    xSemaphoreTake(ui_mutex, portMAX_DELAY);
-                    lv_event_send(setting_screen_tab_view, LV_EVENT_REFRESH, NULL);
-                    lv_scr_load_anim(setting_screen, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 400, 0, false);
-                    xSemaphoreGive(ui_mutex);
-                    current_screen = setting_screen;
-                } else if (current_screen == setting_screen) {
-                    xSemaphoreTake(ui_mutex, portMAX_DELAY);
-                    lv_event_send(main_screen_tab_view, LV_EVENT_REFRESH, NULL);
-                    lv_scr_load_anim(main_screen, LV_SCR_LOAD_ANIM_MOVE_TOP, 400, 0, false);
-                    xSemaphoreGive(ui_mutex);
-                    current_screen = main_screen;
-                } else {
-                    ;// do nothing
-                }
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+        ui_benchmark_t benchmark = ui_benchmark_running();
+        if (benchmark == UI_BENCHMARK_SPEED) {
+            events |= UI_EVENT_FLIGHT;
+        } else if (benchmark == UI_BENCHMARK_COMPASS) {
+            ui_set_compass(ui_benchmark_heading());
+            ui_benchmark_report();
+        }
+        if (benchmark != UI_BENCHMARK_NONE) {
+            display_power_activity();
+        }
+#endif
+
+        if (events & UI_EVENT_CLOCK) {
+            display_power_update();
+        }
+
+        // Nothing is drawn while the display sleeps, the latest values are drawn once it wakes
+        if (display_power_get_stage() == DISPLAY_POWER_SLEEP) {
+            sleeping_events |= events & (UI_EVENT_FLIGHT | UI_EVENT_ENVIRONMENT | UI_EVENT_CLOCK | UI_EVENT_BATTERY | UI_EVENT_HISTORY | UI_EVENT_ATTITUDE);
+            events &= ~sleeping_events;
+        } else {
+            events |= sleeping_events;
+            sleeping_events = 0;
+        }
+
+        if (events & UI_EVENT_FLIGHT) {
+            int32_t speed = telemetry.speed;
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+            if (benchmark == UI_BENCHMARK_SPEED) {
+                speed = (int32_t)(ui_benchmark_speed() * 100.0);
+                ui_benchmark_report();
             }
+#endif
+            ui_update_flight((int32_t)lroundf(telemetry.altitude), speed);
         }
-    }
-}
 
-void ui_set_altitude(double altitude) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    ui_altitude = altitude;
-    xSemaphoreGive(ui_data_mutex);
-}
+        if (events & UI_EVENT_ENVIRONMENT) {
+            ui_update_environment(&telemetry);
+        }
 
-void ui_set_speed(double speed) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    ui_speed = speed;
-    xSemaphoreGive(ui_data_mutex);
-}
+        if (events & UI_EVENT_HISTORY) {
+            ui_update_history();
+        }
 
-void ui_set_pressure(double pressure) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    ui_pressure = pressure;
-    xSemaphoreGive(ui_data_mutex);
-}
+        if (events & UI_EVENT_ATTITUDE) {
+            // The spinning compass benchmark owns the card
+            bool compass = true;
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+            compass = (benchmark != UI_BENCHMARK_COMPASS);
+#endif
+            ui_update_attitude(&telemetry, compass);
+        }
 
-void ui_set_temperature(double temperature) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    ui_temperature = temperature;
-    xSemaphoreGive(ui_data_mutex);
-}
+        if (events & UI_EVENT_CLOCK) {
+            ui_update_clock();
+        }
 
-void ui_set_humidity(double humidity) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    ui_humidity = humidity;
-    xSemaphoreGive(ui_data_mutex);
-}
+        if (events & UI_EVENT_BATTERY) {
+            ui_update_battery();
+        }
 
-void rotate_compass(double angle) {
-    xSemaphoreTake(ui_data_mutex, portMAX_DELAY);
-    lv_img_set_angle(compass_image, 1800 - angle * 10);
-    xSemaphoreGive(ui_data_mutex);
+        if (events & UI_EVENT_CONFIG) {
+            ui_set_volume(config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME));
+            ui_set_brightness(config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS));
+        }
+
+        if (events & UI_EVENT_BUTTON) {
+            ui_handle_buttons();
+        }
+
+        // Whatever is marked while the panel refreshes is drawn together on the next pass
+        vTaskDelay(pdMS_TO_TICKS(CONFIG_LV_DISP_DEF_REFR_PERIOD));
+
+        TickType_t timeout = portMAX_DELAY;
+#ifdef CONFIG_LV_DISPLAY_BENCHMARK
+        if (benchmark != UI_BENCHMARK_NONE) {
+            timeout = 0;
+        }
+#endif
+        events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, timeout);
+    }
 }
 
 void ui_set_volume(int32_t volume) {
@@ -809,12 +1143,7 @@ void ui_set_volume(int32_t volume) {
 }
 
 void ui_set_brightness(int32_t brightness) {
-    static int32_t last_brightness = -1;
-    brightness = ((brightness > 100) ? 100 : ((brightness < 0) ? 0 : brightness));
-    if (brightness != last_brightness) {
-        Core2ForAWS_Display_SetBrightness(brightness);
-        last_brightness = brightness;
-    }
+    display_power_set_brightness(brightness);
 }
 
 static uint32_t motor_counter = 0;
@@ -896,8 +1225,8 @@ void brightness_slider_event_handler(lv_obj_t * obj, lv_event_t event) {
     if (event == LV_EVENT_VALUE_CHANGED) {
         int32_t brightness = (int32_t)lv_slider_get_value(obj);
         brightness = ((brightness > 100) ? 100 : ((brightness < 0) ? 0 : brightness));
+        // Applied by the UI task on the config notification
         config_set_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_BRIGHTNESS, brightness);
-        ui_set_brightness(brightness);
     }
 }
 
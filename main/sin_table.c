@@ -1,1888 +1,28 @@
 /* 
     The lookup table of the trigonometric function sin, 
-    extends the independent variable from 0~2*pi to 30030(0~30029) discrete data, 
-    and extends the value from -1~+1 to a 16 bits signed integer.
+    extends the independent variable from 0~pi/2 to 257(0~256) discrete data, the last one is a guard for the interpolation, 
+    and extends the value from 0~+1 to a 16 bits signed integer.
 */
 
 #include <stdint.h>
 #include "sin_table.h"
 
 const sin_value_t sin_table[] = {
-    /* 0x00000000: */ 0x0000, 0x0006, 0x000d, 0x0014, 0x001b, 0x0022, 0x0029, 0x002f, 0x0036, 0x003d, 0x0044, 0x004b, 0x0052, 0x0059, 0x005f, 0x0066, 
-    /* 0x00000020: */ 0x006d, 0x0074, 0x007b, 0x0082, 0x0089, 0x008f, 0x0096, 0x009d, 0x00a4, 0x00ab, 0x00b2, 0x00b9, 0x00bf, 0x00c6, 0x00cd, 0x00d4, 
-    /* 0x00000040: */ 0x00db, 0x00e2, 0x00e9, 0x00ef, 0x00f6, 0x00fd, 0x0104, 0x010b, 0x0112, 0x0119, 0x011f, 0x0126, 0x012d, 0x0134, 0x013b, 0x0142, 
-    /* 0x00000060: */ 0x0149, 0x014f, 0x0156, 0x015d, 0x0164, 0x016b, 0x0172, 0x0179, 0x017f, 0x0186, 0x018d, 0x0194, 0x019b, 0x01a2, 0x01a9, 0x01af, 
-    /* 0x00000080: */ 0x01b6, 0x01bd, 0x01c4, 0x01cb, 0x01d2, 0x01d9, 0x01df, 0x01e6, 0x01ed, 0x01f4, 0x01fb, 0x0202, 0x0209, 0x020f, 0x0216, 0x021d, 
-    /* 0x000000a0: */ 0x0224, 0x022b, 0x0232, 0x0239, 0x023f, 0x0246, 0x024d, 0x0254, 0x025b, 0x0262, 0x0268, 0x026f, 0x0276, 0x027d, 0x0284, 0x028b, 
-    /* 0x000000c0: */ 0x0292, 0x0298, 0x029f, 0x02a6, 0x02ad, 0x02b4, 0x02bb, 0x02c2, 0x02c8, 0x02cf, 0x02d6, 0x02dd, 0x02e4, 0x02eb, 0x02f2, 0x02f8, 
-    /* 0x000000e0: */ 0x02ff, 0x0306, 0x030d, 0x0314, 0x031b, 0x0322, 0x0328, 0x032f, 0x0336, 0x033d, 0x0344, 0x034b, 0x0352, 0x0358, 0x035f, 0x0366, 
-    /* 0x00000100: */ 0x036d, 0x0374, 0x037b, 0x0382, 0x0388, 0x038f, 0x0396, 0x039d, 0x03a4, 0x03ab, 0x03b1, 0x03b8, 0x03bf, 0x03c6, 0x03cd, 0x03d4, 
-    /* 0x00000120: */ 0x03db, 0x03e1, 0x03e8, 0x03ef, 0x03f6, 0x03fd, 0x0404, 0x040b, 0x0411, 0x0418, 0x041f, 0x0426, 0x042d, 0x0434, 0x043b, 0x0441, 
-    /* 0x00000140: */ 0x0448, 0x044f, 0x0456, 0x045d, 0x0464, 0x046a, 0x0471, 0x0478, 0x047f, 0x0486, 0x048d, 0x0494, 0x049a, 0x04a1, 0x04a8, 0x04af, 
-    /* 0x00000160: */ 0x04b6, 0x04bd, 0x04c4, 0x04ca, 0x04d1, 0x04d8, 0x04df, 0x04e6, 0x04ed, 0x04f4, 0x04fa, 0x0501, 0x0508, 0x050f, 0x0516, 0x051d, 
-    /* 0x00000180: */ 0x0523, 0x052a, 0x0531, 0x0538, 0x053f, 0x0546, 0x054d, 0x0553, 0x055a, 0x0561, 0x0568, 0x056f, 0x0576, 0x057d, 0x0583, 0x058a, 
-    /* 0x000001a0: */ 0x0591, 0x0598, 0x059f, 0x05a6, 0x05ac, 0x05b3, 0x05ba, 0x05c1, 0x05c8, 0x05cf, 0x05d6, 0x05dc, 0x05e3, 0x05ea, 0x05f1, 0x05f8, 
-    /* 0x000001c0: */ 0x05ff, 0x0605, 0x060c, 0x0613, 0x061a, 0x0621, 0x0628, 0x062f, 0x0635, 0x063c, 0x0643, 0x064a, 0x0651, 0x0658, 0x065f, 0x0665, 
-    /* 0x000001e0: */ 0x066c, 0x0673, 0x067a, 0x0681, 0x0688, 0x068e, 0x0695, 0x069c, 0x06a3, 0x06aa, 0x06b1, 0x06b8, 0x06be, 0x06c5, 0x06cc, 0x06d3, 
-    /* 0x00000200: */ 0x06da, 0x06e1, 0x06e7, 0x06ee, 0x06f5, 0x06fc, 0x0703, 0x070a, 0x0711, 0x0717, 0x071e, 0x0725, 0x072c, 0x0733, 0x073a, 0x0740, 
-    /* 0x00000220: */ 0x0747, 0x074e, 0x0755, 0x075c, 0x0763, 0x076a, 0x0770, 0x0777, 0x077e, 0x0785, 0x078c, 0x0793, 0x0799, 0x07a0, 0x07a7, 0x07ae, 
-    /* 0x00000240: */ 0x07b5, 0x07bc, 0x07c2, 0x07c9, 0x07d0, 0x07d7, 0x07de, 0x07e5, 0x07ec, 0x07f2, 0x07f9, 0x0800, 0x0807, 0x080e, 0x0815, 0x081b, 
-    /* 0x00000260: */ 0x0822, 0x0829, 0x0830, 0x0837, 0x083e, 0x0844, 0x084b, 0x0852, 0x0859, 0x0860, 0x0867, 0x086e, 0x0874, 0x087b, 0x0882, 0x0889, 
-    /* 0x00000280: */ 0x0890, 0x0897, 0x089d, 0x08a4, 0x08ab, 0x08b2, 0x08b9, 0x08c0, 0x08c6, 0x08cd, 0x08d4, 0x08db, 0x08e2, 0x08e9, 0x08ef, 0x08f6, 
-    /* 0x000002a0: */ 0x08fd, 0x0904, 0x090b, 0x0912, 0x0919, 0x091f, 0x0926, 0x092d, 0x0934, 0x093b, 0x0942, 0x0948, 0x094f, 0x0956, 0x095d, 0x0964, 
-    /* 0x000002c0: */ 0x096b, 0x0971, 0x0978, 0x097f, 0x0986, 0x098d, 0x0994, 0x099a, 0x09a1, 0x09a8, 0x09af, 0x09b6, 0x09bd, 0x09c3, 0x09ca, 0x09d1, 
-    /* 0x000002e0: */ 0x09d8, 0x09df, 0x09e6, 0x09ec, 0x09f3, 0x09fa, 0x0a01, 0x0a08, 0x0a0f, 0x0a15, 0x0a1c, 0x0a23, 0x0a2a, 0x0a31, 0x0a38, 0x0a3e, 
-    /* 0x00000300: */ 0x0a45, 0x0a4c, 0x0a53, 0x0a5a, 0x0a61, 0x0a67, 0x0a6e, 0x0a75, 0x0a7c, 0x0a83, 0x0a8a, 0x0a90, 0x0a97, 0x0a9e, 0x0aa5, 0x0aac, 
-    /* 0x00000320: */ 0x0ab3, 0x0ab9, 0x0ac0, 0x0ac7, 0x0ace, 0x0ad5, 0x0adc, 0x0ae2, 0x0ae9, 0x0af0, 0x0af7, 0x0afe, 0x0b05, 0x0b0b, 0x0b12, 0x0b19, 
-    /* 0x00000340: */ 0x0b20, 0x0b27, 0x0b2e, 0x0b34, 0x0b3b, 0x0b42, 0x0b49, 0x0b50, 0x0b57, 0x0b5d, 0x0b64, 0x0b6b, 0x0b72, 0x0b79, 0x0b80, 0x0b86, 
-    /* 0x00000360: */ 0x0b8d, 0x0b94, 0x0b9b, 0x0ba2, 0x0ba9, 0x0baf, 0x0bb6, 0x0bbd, 0x0bc4, 0x0bcb, 0x0bd1, 0x0bd8, 0x0bdf, 0x0be6, 0x0bed, 0x0bf4, 
-    /* 0x00000380: */ 0x0bfa, 0x0c01, 0x0c08, 0x0c0f, 0x0c16, 0x0c1d, 0x0c23, 0x0c2a, 0x0c31, 0x0c38, 0x0c3f, 0x0c45, 0x0c4c, 0x0c53, 0x0c5a, 0x0c61, 
-    /* 0x000003a0: */ 0x0c68, 0x0c6e, 0x0c75, 0x0c7c, 0x0c83, 0x0c8a, 0x0c91, 0x0c97, 0x0c9e, 0x0ca5, 0x0cac, 0x0cb3, 0x0cb9, 0x0cc0, 0x0cc7, 0x0cce, 
-    /* 0x000003c0: */ 0x0cd5, 0x0cdc, 0x0ce2, 0x0ce9, 0x0cf0, 0x0cf7, 0x0cfe, 0x0d05, 0x0d0b, 0x0d12, 0x0d19, 0x0d20, 0x0d27, 0x0d2d, 0x0d34, 0x0d3b, 
-    /* 0x000003e0: */ 0x0d42, 0x0d49, 0x0d50, 0x0d56, 0x0d5d, 0x0d64, 0x0d6b, 0x0d72, 0x0d78, 0x0d7f, 0x0d86, 0x0d8d, 0x0d94, 0x0d9b, 0x0da1, 0x0da8, 
-    /* 0x00000400: */ 0x0daf, 0x0db6, 0x0dbd, 0x0dc3, 0x0dca, 0x0dd1, 0x0dd8, 0x0ddf, 0x0de6, 0x0dec, 0x0df3, 0x0dfa, 0x0e01, 0x0e08, 0x0e0e, 0x0e15, 
-    /* 0x00000420: */ 0x0e1c, 0x0e23, 0x0e2a, 0x0e30, 0x0e37, 0x0e3e, 0x0e45, 0x0e4c, 0x0e53, 0x0e59, 0x0e60, 0x0e67, 0x0e6e, 0x0e75, 0x0e7b, 0x0e82, 
-    /* 0x00000440: */ 0x0e89, 0x0e90, 0x0e97, 0x0e9d, 0x0ea4, 0x0eab, 0x0eb2, 0x0eb9, 0x0ec0, 0x0ec6, 0x0ecd, 0x0ed4, 0x0edb, 0x0ee2, 0x0ee8, 0x0eef, 
-    /* 0x00000460: */ 0x0ef6, 0x0efd, 0x0f04, 0x0f0a, 0x0f11, 0x0f18, 0x0f1f, 0x0f26, 0x0f2c, 0x0f33, 0x0f3a, 0x0f41, 0x0f48, 0x0f4e, 0x0f55, 0x0f5c, 
-    /* 0x00000480: */ 0x0f63, 0x0f6a, 0x0f71, 0x0f77, 0x0f7e, 0x0f85, 0x0f8c, 0x0f93, 0x0f99, 0x0fa0, 0x0fa7, 0x0fae, 0x0fb5, 0x0fbb, 0x0fc2, 0x0fc9, 
-    /* 0x000004a0: */ 0x0fd0, 0x0fd7, 0x0fdd, 0x0fe4, 0x0feb, 0x0ff2, 0x0ff9, 0x0fff, 0x1006, 0x100d, 0x1014, 0x101b, 0x1021, 0x1028, 0x102f, 0x1036, 
-    /* 0x000004c0: */ 0x103d, 0x1043, 0x104a, 0x1051, 0x1058, 0x105f, 0x1065, 0x106c, 0x1073, 0x107a, 0x1081, 0x1087, 0x108e, 0x1095, 0x109c, 0x10a3, 
-    /* 0x000004e0: */ 0x10a9, 0x10b0, 0x10b7, 0x10be, 0x10c5, 0x10cb, 0x10d2, 0x10d9, 0x10e0, 0x10e7, 0x10ed, 0x10f4, 0x10fb, 0x1102, 0x1109, 0x110f, 
-    /* 0x00000500: */ 0x1116, 0x111d, 0x1124, 0x112b, 0x1131, 0x1138, 0x113f, 0x1146, 0x114c, 0x1153, 0x115a, 0x1161, 0x1168, 0x116e, 0x1175, 0x117c, 
-    /* 0x00000520: */ 0x1183, 0x118a, 0x1190, 0x1197, 0x119e, 0x11a5, 0x11ac, 0x11b2, 0x11b9, 0x11c0, 0x11c7, 0x11ce, 0x11d4, 0x11db, 0x11e2, 0x11e9, 
-    /* 0x00000540: */ 0x11ef, 0x11f6, 0x11fd, 0x1204, 0x120b, 0x1211, 0x1218, 0x121f, 0x1226, 0x122d, 0x1233, 0x123a, 0x1241, 0x1248, 0x124e, 0x1255, 
-    /* 0x00000560: */ 0x125c, 0x1263, 0x126a, 0x1270, 0x1277, 0x127e, 0x1285, 0x128c, 0x1292, 0x1299, 0x12a0, 0x12a7, 0x12ad, 0x12b4, 0x12bb, 0x12c2, 
-    /* 0x00000580: */ 0x12c9, 0x12cf, 0x12d6, 0x12dd, 0x12e4, 0x12ea, 0x12f1, 0x12f8, 0x12ff, 0x1306, 0x130c, 0x1313, 0x131a, 0x1321, 0x1328, 0x132e, 
-    /* 0x000005a0: */ 0x1335, 0x133c, 0x1343, 0x1349, 0x1350, 0x1357, 0x135e, 0x1365, 0x136b, 0x1372, 0x1379, 0x1380, 0x1386, 0x138d, 0x1394, 0x139b, 
-    /* 0x000005c0: */ 0x13a1, 0x13a8, 0x13af, 0x13b6, 0x13bd, 0x13c3, 0x13ca, 0x13d1, 0x13d8, 0x13de, 0x13e5, 0x13ec, 0x13f3, 0x13fa, 0x1400, 0x1407, 
-    /* 0x000005e0: */ 0x140e, 0x1415, 0x141b, 0x1422, 0x1429, 0x1430, 0x1436, 0x143d, 0x1444, 0x144b, 0x1452, 0x1458, 0x145f, 0x1466, 0x146d, 0x1473, 
-    /* 0x00000600: */ 0x147a, 0x1481, 0x1488, 0x148e, 0x1495, 0x149c, 0x14a3, 0x14aa, 0x14b0, 0x14b7, 0x14be, 0x14c5, 0x14cb, 0x14d2, 0x14d9, 0x14e0, 
-    /* 0x00000620: */ 0x14e6, 0x14ed, 0x14f4, 0x14fb, 0x1501, 0x1508, 0x150f, 0x1516, 0x151d, 0x1523, 0x152a, 0x1531, 0x1538, 0x153e, 0x1545, 0x154c, 
-    /* 0x00000640: */ 0x1553, 0x1559, 0x1560, 0x1567, 0x156e, 0x1574, 0x157b, 0x1582, 0x1589, 0x158f, 0x1596, 0x159d, 0x15a4, 0x15aa, 0x15b1, 0x15b8, 
-    /* 0x00000660: */ 0x15bf, 0x15c5, 0x15cc, 0x15d3, 0x15da, 0x15e1, 0x15e7, 0x15ee, 0x15f5, 0x15fc, 0x1602, 0x1609, 0x1610, 0x1617, 0x161d, 0x1624, 
-    /* 0x00000680: */ 0x162b, 0x1632, 0x1638, 0x163f, 0x1646, 0x164d, 0x1653, 0x165a, 0x1661, 0x1668, 0x166e, 0x1675, 0x167c, 0x1683, 0x1689, 0x1690, 
-    /* 0x000006a0: */ 0x1697, 0x169e, 0x16a4, 0x16ab, 0x16b2, 0x16b9, 0x16bf, 0x16c6, 0x16cd, 0x16d4, 0x16da, 0x16e1, 0x16e8, 0x16ef, 0x16f5, 0x16fc, 
-    /* 0x000006c0: */ 0x1703, 0x1709, 0x1710, 0x1717, 0x171e, 0x1724, 0x172b, 0x1732, 0x1739, 0x173f, 0x1746, 0x174d, 0x1754, 0x175a, 0x1761, 0x1768, 
-    /* 0x000006e0: */ 0x176f, 0x1775, 0x177c, 0x1783, 0x178a, 0x1790, 0x1797, 0x179e, 0x17a5, 0x17ab, 0x17b2, 0x17b9, 0x17bf, 0x17c6, 0x17cd, 0x17d4, 
-    /* 0x00000700: */ 0x17da, 0x17e1, 0x17e8, 0x17ef, 0x17f5, 0x17fc, 0x1803, 0x180a, 0x1810, 0x1817, 0x181e, 0x1824, 0x182b, 0x1832, 0x1839, 0x183f, 
-    /* 0x00000720: */ 0x1846, 0x184d, 0x1854, 0x185a, 0x1861, 0x1868, 0x186f, 0x1875, 0x187c, 0x1883, 0x1889, 0x1890, 0x1897, 0x189e, 0x18a4, 0x18ab, 
-    /* 0x00000740: */ 0x18b2, 0x18b9, 0x18bf, 0x18c6, 0x18cd, 0x18d3, 0x18da, 0x18e1, 0x18e8, 0x18ee, 0x18f5, 0x18fc, 0x1903, 0x1909, 0x1910, 0x1917, 
-    /* 0x00000760: */ 0x191d, 0x1924, 0x192b, 0x1932, 0x1938, 0x193f, 0x1946, 0x194c, 0x1953, 0x195a, 0x1961, 0x1967, 0x196e, 0x1975, 0x197c, 0x1982, 
-    /* 0x00000780: */ 0x1989, 0x1990, 0x1996, 0x199d, 0x19a4, 0x19ab, 0x19b1, 0x19b8, 0x19bf, 0x19c5, 0x19cc, 0x19d3, 0x19da, 0x19e0, 0x19e7, 0x19ee, 
-    /* 0x000007a0: */ 0x19f4, 0x19fb, 0x1a02, 0x1a09, 0x1a0f, 0x1a16, 0x1a1d, 0x1a23, 0x1a2a, 0x1a31, 0x1a38, 0x1a3e, 0x1a45, 0x1a4c, 0x1a52, 0x1a59, 
-    /* 0x000007c0: */ 0x1a60, 0x1a66, 0x1a6d, 0x1a74, 0x1a7b, 0x1a81, 0x1a88, 0x1a8f, 0x1a95, 0x1a9c, 0x1aa3, 0x1aaa, 0x1ab0, 0x1ab7, 0x1abe, 0x1ac4, 
-    /* 0x000007e0: */ 0x1acb, 0x1ad2, 0x1ad8, 0x1adf, 0x1ae6, 0x1aed, 0x1af3, 0x1afa, 0x1b01, 0x1b07, 0x1b0e, 0x1b15, 0x1b1c, 0x1b22, 0x1b29, 0x1b30, 
-    /* 0x00000800: */ 0x1b36, 0x1b3d, 0x1b44, 0x1b4a, 0x1b51, 0x1b58, 0x1b5e, 0x1b65, 0x1b6c, 0x1b73, 0x1b79, 0x1b80, 0x1b87, 0x1b8d, 0x1b94, 0x1b9b, 
-    /* 0x00000820: */ 0x1ba1, 0x1ba8, 0x1baf, 0x1bb6, 0x1bbc, 0x1bc3, 0x1bca, 0x1bd0, 0x1bd7, 0x1bde, 0x1be4, 0x1beb, 0x1bf2, 0x1bf8, 0x1bff, 0x1c06, 
-    /* 0x00000840: */ 0x1c0d, 0x1c13, 0x1c1a, 0x1c21, 0x1c27, 0x1c2e, 0x1c35, 0x1c3b, 0x1c42, 0x1c49, 0x1c4f, 0x1c56, 0x1c5d, 0x1c63, 0x1c6a, 0x1c71, 
-    /* 0x00000860: */ 0x1c78, 0x1c7e, 0x1c85, 0x1c8c, 0x1c92, 0x1c99, 0x1ca0, 0x1ca6, 0x1cad, 0x1cb4, 0x1cba, 0x1cc1, 0x1cc8, 0x1cce, 0x1cd5, 0x1cdc, 
-    /* 0x00000880: */ 0x1ce2, 0x1ce9, 0x1cf0, 0x1cf6, 0x1cfd, 0x1d04, 0x1d0a, 0x1d11, 0x1d18, 0x1d1f, 0x1d25, 0x1d2c, 0x1d33, 0x1d39, 0x1d40, 0x1d47, 
-    /* 0x000008a0: */ 0x1d4d, 0x1d54, 0x1d5b, 0x1d61, 0x1d68, 0x1d6f, 0x1d75, 0x1d7c, 0x1d83, 0x1d89, 0x1d90, 0x1d97, 0x1d9d, 0x1da4, 0x1dab, 0x1db1, 
-    /* 0x000008c0: */ 0x1db8, 0x1dbf, 0x1dc5, 0x1dcc, 0x1dd3, 0x1dd9, 0x1de0, 0x1de7, 0x1ded, 0x1df4, 0x1dfb, 0x1e01, 0x1e08, 0x1e0f, 0x1e15, 0x1e1c, 
-    /* 0x000008e0: */ 0x1e23, 0x1e29, 0x1e30, 0x1e37, 0x1e3d, 0x1e44, 0x1e4b, 0x1e51, 0x1e58, 0x1e5f, 0x1e65, 0x1e6c, 0x1e73, 0x1e79, 0x1e80, 0x1e87, 
-    /* 0x00000900: */ 0x1e8d, 0x1e94, 0x1e9a, 0x1ea1, 0x1ea8, 0x1eae, 0x1eb5, 0x1ebc, 0x1ec2, 0x1ec9, 0x1ed0, 0x1ed6, 0x1edd, 0x1ee4, 0x1eea, 0x1ef1, 
-    /* 0x00000920: */ 0x1ef8, 0x1efe, 0x1f05, 0x1f0c, 0x1f12, 0x1f19, 0x1f20, 0x1f26, 0x1f2d, 0x1f34, 0x1f3a, 0x1f41, 0x1f47, 0x1f4e, 0x1f55, 0x1f5b, 
-    /* 0x00000940: */ 0x1f62, 0x1f69, 0x1f6f, 0x1f76, 0x1f7d, 0x1f83, 0x1f8a, 0x1f91, 0x1f97, 0x1f9e, 0x1fa5, 0x1fab, 0x1fb2, 0x1fb8, 0x1fbf, 0x1fc6, 
-    /* 0x00000960: */ 0x1fcc, 0x1fd3, 0x1fda, 0x1fe0, 0x1fe7, 0x1fee, 0x1ff4, 0x1ffb, 0x2001, 0x2008, 0x200f, 0x2015, 0x201c, 0x2023, 0x2029, 0x2030, 
-    /* 0x00000980: */ 0x2037, 0x203d, 0x2044, 0x204a, 0x2051, 0x2058, 0x205e, 0x2065, 0x206c, 0x2072, 0x2079, 0x2080, 0x2086, 0x208d, 0x2093, 0x209a, 
-    /* 0x000009a0: */ 0x20a1, 0x20a7, 0x20ae, 0x20b5, 0x20bb, 0x20c2, 0x20c8, 0x20cf, 0x20d6, 0x20dc, 0x20e3, 0x20ea, 0x20f0, 0x20f7, 0x20fd, 0x2104, 
-    /* 0x000009c0: */ 0x210b, 0x2111, 0x2118, 0x211f, 0x2125, 0x212c, 0x2132, 0x2139, 0x2140, 0x2146, 0x214d, 0x2154, 0x215a, 0x2161, 0x2167, 0x216e, 
-    /* 0x000009e0: */ 0x2175, 0x217b, 0x2182, 0x2188, 0x218f, 0x2196, 0x219c, 0x21a3, 0x21aa, 0x21b0, 0x21b7, 0x21bd, 0x21c4, 0x21cb, 0x21d1, 0x21d8, 
-    /* 0x00000a00: */ 0x21de, 0x21e5, 0x21ec, 0x21f2, 0x21f9, 0x2200, 0x2206, 0x220d, 0x2213, 0x221a, 0x2221, 0x2227, 0x222e, 0x2234, 0x223b, 0x2242, 
-    /* 0x00000a20: */ 0x2248, 0x224f, 0x2255, 0x225c, 0x2263, 0x2269, 0x2270, 0x2276, 0x227d, 0x2284, 0x228a, 0x2291, 0x2297, 0x229e, 0x22a5, 0x22ab, 
-    /* 0x00000a40: */ 0x22b2, 0x22b8, 0x22bf, 0x22c6, 0x22cc, 0x22d3, 0x22d9, 0x22e0, 0x22e7, 0x22ed, 0x22f4, 0x22fa, 0x2301, 0x2308, 0x230e, 0x2315, 
-    /* 0x00000a60: */ 0x231b, 0x2322, 0x2329, 0x232f, 0x2336, 0x233c, 0x2343, 0x234a, 0x2350, 0x2357, 0x235d, 0x2364, 0x236a, 0x2371, 0x2378, 0x237e, 
-    /* 0x00000a80: */ 0x2385, 0x238b, 0x2392, 0x2399, 0x239f, 0x23a6, 0x23ac, 0x23b3, 0x23b9, 0x23c0, 0x23c7, 0x23cd, 0x23d4, 0x23da, 0x23e1, 0x23e8, 
-    /* 0x00000aa0: */ 0x23ee, 0x23f5, 0x23fb, 0x2402, 0x2408, 0x240f, 0x2416, 0x241c, 0x2423, 0x2429, 0x2430, 0x2436, 0x243d, 0x2444, 0x244a, 0x2451, 
-    /* 0x00000ac0: */ 0x2457, 0x245e, 0x2465, 0x246b, 0x2472, 0x2478, 0x247f, 0x2485, 0x248c, 0x2493, 0x2499, 0x24a0, 0x24a6, 0x24ad, 0x24b3, 0x24ba, 
-    /* 0x00000ae0: */ 0x24c0, 0x24c7, 0x24ce, 0x24d4, 0x24db, 0x24e1, 0x24e8, 0x24ee, 0x24f5, 0x24fc, 0x2502, 0x2509, 0x250f, 0x2516, 0x251c, 0x2523, 
-    /* 0x00000b00: */ 0x252a, 0x2530, 0x2537, 0x253d, 0x2544, 0x254a, 0x2551, 0x2557, 0x255e, 0x2565, 0x256b, 0x2572, 0x2578, 0x257f, 0x2585, 0x258c, 
-    /* 0x00000b20: */ 0x2592, 0x2599, 0x25a0, 0x25a6, 0x25ad, 0x25b3, 0x25ba, 0x25c0, 0x25c7, 0x25cd, 0x25d4, 0x25da, 0x25e1, 0x25e8, 0x25ee, 0x25f5, 
-    /* 0x00000b40: */ 0x25fb, 0x2602, 0x2608, 0x260f, 0x2615, 0x261c, 0x2623, 0x2629, 0x2630, 0x2636, 0x263d, 0x2643, 0x264a, 0x2650, 0x2657, 0x265d, 
-    /* 0x00000b60: */ 0x2664, 0x266a, 0x2671, 0x2678, 0x267e, 0x2685, 0x268b, 0x2692, 0x2698, 0x269f, 0x26a5, 0x26ac, 0x26b2, 0x26b9, 0x26bf, 0x26c6, 
-    /* 0x00000b80: */ 0x26cd, 0x26d3, 0x26da, 0x26e0, 0x26e7, 0x26ed, 0x26f4, 0x26fa, 0x2701, 0x2707, 0x270e, 0x2714, 0x271b, 0x2721, 0x2728, 0x272e, 
-    /* 0x00000ba0: */ 0x2735, 0x273c, 0x2742, 0x2749, 0x274f, 0x2756, 0x275c, 0x2763, 0x2769, 0x2770, 0x2776, 0x277d, 0x2783, 0x278a, 0x2790, 0x2797, 
-    /* 0x00000bc0: */ 0x279d, 0x27a4, 0x27aa, 0x27b1, 0x27b7, 0x27be, 0x27c4, 0x27cb, 0x27d1, 0x27d8, 0x27df, 0x27e5, 0x27ec, 0x27f2, 0x27f9, 0x27ff, 
-    /* 0x00000be0: */ 0x2806, 0x280c, 0x2813, 0x2819, 0x2820, 0x2826, 0x282d, 0x2833, 0x283a, 0x2840, 0x2847, 0x284d, 0x2854, 0x285a, 0x2861, 0x2867, 
-    /* 0x00000c00: */ 0x286e, 0x2874, 0x287b, 0x2881, 0x2888, 0x288e, 0x2895, 0x289b, 0x28a2, 0x28a8, 0x28af, 0x28b5, 0x28bc, 0x28c2, 0x28c9, 0x28cf, 
-    /* 0x00000c20: */ 0x28d6, 0x28dc, 0x28e3, 0x28e9, 0x28f0, 0x28f6, 0x28fd, 0x2903, 0x290a, 0x2910, 0x2917, 0x291d, 0x2924, 0x292a, 0x2931, 0x2937, 
-    /* 0x00000c40: */ 0x293e, 0x2944, 0x294b, 0x2951, 0x2958, 0x295e, 0x2965, 0x296b, 0x2972, 0x2978, 0x297f, 0x2985, 0x298c, 0x2992, 0x2998, 0x299f, 
-    /* 0x00000c60: */ 0x29a5, 0x29ac, 0x29b2, 0x29b9, 0x29bf, 0x29c6, 0x29cc, 0x29d3, 0x29d9, 0x29e0, 0x29e6, 0x29ed, 0x29f3, 0x29fa, 0x2a00, 0x2a07, 
-    /* 0x00000c80: */ 0x2a0d, 0x2a14, 0x2a1a, 0x2a21, 0x2a27, 0x2a2d, 0x2a34, 0x2a3a, 0x2a41, 0x2a47, 0x2a4e, 0x2a54, 0x2a5b, 0x2a61, 0x2a68, 0x2a6e, 
-    /* 0x00000ca0: */ 0x2a75, 0x2a7b, 0x2a82, 0x2a88, 0x2a8f, 0x2a95, 0x2a9b, 0x2aa2, 0x2aa8, 0x2aaf, 0x2ab5, 0x2abc, 0x2ac2, 0x2ac9, 0x2acf, 0x2ad6, 
-    /* 0x00000cc0: */ 0x2adc, 0x2ae3, 0x2ae9, 0x2aef, 0x2af6, 0x2afc, 0x2b03, 0x2b09, 0x2b10, 0x2b16, 0x2b1d, 0x2b23, 0x2b2a, 0x2b30, 0x2b36, 0x2b3d, 
-    /* 0x00000ce0: */ 0x2b43, 0x2b4a, 0x2b50, 0x2b57, 0x2b5d, 0x2b64, 0x2b6a, 0x2b71, 0x2b77, 0x2b7d, 0x2b84, 0x2b8a, 0x2b91, 0x2b97, 0x2b9e, 0x2ba4, 
-    /* 0x00000d00: */ 0x2bab, 0x2bb1, 0x2bb7, 0x2bbe, 0x2bc4, 0x2bcb, 0x2bd1, 0x2bd8, 0x2bde, 0x2be5, 0x2beb, 0x2bf1, 0x2bf8, 0x2bfe, 0x2c05, 0x2c0b, 
-    /* 0x00000d20: */ 0x2c12, 0x2c18, 0x2c1e, 0x2c25, 0x2c2b, 0x2c32, 0x2c38, 0x2c3f, 0x2c45, 0x2c4c, 0x2c52, 0x2c58, 0x2c5f, 0x2c65, 0x2c6c, 0x2c72, 
-    /* 0x00000d40: */ 0x2c79, 0x2c7f, 0x2c85, 0x2c8c, 0x2c92, 0x2c99, 0x2c9f, 0x2ca6, 0x2cac, 0x2cb2, 0x2cb9, 0x2cbf, 0x2cc6, 0x2ccc, 0x2cd2, 0x2cd9, 
-    /* 0x00000d60: */ 0x2cdf, 0x2ce6, 0x2cec, 0x2cf3, 0x2cf9, 0x2cff, 0x2d06, 0x2d0c, 0x2d13, 0x2d19, 0x2d20, 0x2d26, 0x2d2c, 0x2d33, 0x2d39, 0x2d40, 
-    /* 0x00000d80: */ 0x2d46, 0x2d4c, 0x2d53, 0x2d59, 0x2d60, 0x2d66, 0x2d6c, 0x2d73, 0x2d79, 0x2d80, 0x2d86, 0x2d8c, 0x2d93, 0x2d99, 0x2da0, 0x2da6, 
-    /* 0x00000da0: */ 0x2dad, 0x2db3, 0x2db9, 0x2dc0, 0x2dc6, 0x2dcd, 0x2dd3, 0x2dd9, 0x2de0, 0x2de6, 0x2ded, 0x2df3, 0x2df9, 0x2e00, 0x2e06, 0x2e0d, 
-    /* 0x00000dc0: */ 0x2e13, 0x2e19, 0x2e20, 0x2e26, 0x2e2d, 0x2e33, 0x2e39, 0x2e40, 0x2e46, 0x2e4c, 0x2e53, 0x2e59, 0x2e60, 0x2e66, 0x2e6c, 0x2e73, 
-    /* 0x00000de0: */ 0x2e79, 0x2e80, 0x2e86, 0x2e8c, 0x2e93, 0x2e99, 0x2ea0, 0x2ea6, 0x2eac, 0x2eb3, 0x2eb9, 0x2ebf, 0x2ec6, 0x2ecc, 0x2ed3, 0x2ed9, 
-    /* 0x00000e00: */ 0x2edf, 0x2ee6, 0x2eec, 0x2ef2, 0x2ef9, 0x2eff, 0x2f06, 0x2f0c, 0x2f12, 0x2f19, 0x2f1f, 0x2f25, 0x2f2c, 0x2f32, 0x2f39, 0x2f3f, 
-    /* 0x00000e20: */ 0x2f45, 0x2f4c, 0x2f52, 0x2f58, 0x2f5f, 0x2f65, 0x2f6c, 0x2f72, 0x2f78, 0x2f7f, 0x2f85, 0x2f8b, 0x2f92, 0x2f98, 0x2f9e, 0x2fa5, 
-    /* 0x00000e40: */ 0x2fab, 0x2fb2, 0x2fb8, 0x2fbe, 0x2fc5, 0x2fcb, 0x2fd1, 0x2fd8, 0x2fde, 0x2fe4, 0x2feb, 0x2ff1, 0x2ff8, 0x2ffe, 0x3004, 0x300b, 
-    /* 0x00000e60: */ 0x3011, 0x3017, 0x301e, 0x3024, 0x302a, 0x3031, 0x3037, 0x303d, 0x3044, 0x304a, 0x3050, 0x3057, 0x305d, 0x3064, 0x306a, 0x3070, 
-    /* 0x00000e80: */ 0x3077, 0x307d, 0x3083, 0x308a, 0x3090, 0x3096, 0x309d, 0x30a3, 0x30a9, 0x30b0, 0x30b6, 0x30bc, 0x30c3, 0x30c9, 0x30cf, 0x30d6, 
-    /* 0x00000ea0: */ 0x30dc, 0x30e2, 0x30e9, 0x30ef, 0x30f5, 0x30fc, 0x3102, 0x3108, 0x310f, 0x3115, 0x311b, 0x3122, 0x3128, 0x312e, 0x3135, 0x313b, 
-    /* 0x00000ec0: */ 0x3141, 0x3148, 0x314e, 0x3154, 0x315b, 0x3161, 0x3167, 0x316e, 0x3174, 0x317a, 0x3181, 0x3187, 0x318d, 0x3194, 0x319a, 0x31a0, 
-    /* 0x00000ee0: */ 0x31a6, 0x31ad, 0x31b3, 0x31b9, 0x31c0, 0x31c6, 0x31cc, 0x31d3, 0x31d9, 0x31df, 0x31e6, 0x31ec, 0x31f2, 0x31f9, 0x31ff, 0x3205, 
-    /* 0x00000f00: */ 0x320c, 0x3212, 0x3218, 0x321e, 0x3225, 0x322b, 0x3231, 0x3238, 0x323e, 0x3244, 0x324b, 0x3251, 0x3257, 0x325e, 0x3264, 0x326a, 
-    /* 0x00000f20: */ 0x3270, 0x3277, 0x327d, 0x3283, 0x328a, 0x3290, 0x3296, 0x329d, 0x32a3, 0x32a9, 0x32af, 0x32b6, 0x32bc, 0x32c2, 0x32c9, 0x32cf, 
-    /* 0x00000f40: */ 0x32d5, 0x32db, 0x32e2, 0x32e8, 0x32ee, 0x32f5, 0x32fb, 0x3301, 0x3307, 0x330e, 0x3314, 0x331a, 0x3321, 0x3327, 0x332d, 0x3333, 
-    /* 0x00000f60: */ 0x333a, 0x3340, 0x3346, 0x334d, 0x3353, 0x3359, 0x335f, 0x3366, 0x336c, 0x3372, 0x3379, 0x337f, 0x3385, 0x338b, 0x3392, 0x3398, 
-    /* 0x00000f80: */ 0x339e, 0x33a4, 0x33ab, 0x33b1, 0x33b7, 0x33be, 0x33c4, 0x33ca, 0x33d0, 0x33d7, 0x33dd, 0x33e3, 0x33e9, 0x33f0, 0x33f6, 0x33fc, 
-    /* 0x00000fa0: */ 0x3403, 0x3409, 0x340f, 0x3415, 0x341c, 0x3422, 0x3428, 0x342e, 0x3435, 0x343b, 0x3441, 0x3447, 0x344e, 0x3454, 0x345a, 0x3460, 
-    /* 0x00000fc0: */ 0x3467, 0x346d, 0x3473, 0x3479, 0x3480, 0x3486, 0x348c, 0x3492, 0x3499, 0x349f, 0x34a5, 0x34ab, 0x34b2, 0x34b8, 0x34be, 0x34c4, 
-    /* 0x00000fe0: */ 0x34cb, 0x34d1, 0x34d7, 0x34dd, 0x34e4, 0x34ea, 0x34f0, 0x34f6, 0x34fd, 0x3503, 0x3509, 0x350f, 0x3516, 0x351c, 0x3522, 0x3528, 
-    /* 0x00001000: */ 0x352f, 0x3535, 0x353b, 0x3541, 0x3547, 0x354e, 0x3554, 0x355a, 0x3560, 0x3567, 0x356d, 0x3573, 0x3579, 0x3580, 0x3586, 0x358c, 
-    /* 0x00001020: */ 0x3592, 0x3598, 0x359f, 0x35a5, 0x35ab, 0x35b1, 0x35b8, 0x35be, 0x35c4, 0x35ca, 0x35d0, 0x35d7, 0x35dd, 0x35e3, 0x35e9, 0x35f0, 
-    /* 0x00001040: */ 0x35f6, 0x35fc, 0x3602, 0x3608, 0x360f, 0x3615, 0x361b, 0x3621, 0x3627, 0x362e, 0x3634, 0x363a, 0x3640, 0x3647, 0x364d, 0x3653, 
-    /* 0x00001060: */ 0x3659, 0x365f, 0x3666, 0x366c, 0x3672, 0x3678, 0x367e, 0x3685, 0x368b, 0x3691, 0x3697, 0x369d, 0x36a4, 0x36aa, 0x36b0, 0x36b6, 
-    /* 0x00001080: */ 0x36bc, 0x36c3, 0x36c9, 0x36cf, 0x36d5, 0x36db, 0x36e2, 0x36e8, 0x36ee, 0x36f4, 0x36fa, 0x3701, 0x3707, 0x370d, 0x3713, 0x3719, 
-    /* 0x000010a0: */ 0x371f, 0x3726, 0x372c, 0x3732, 0x3738, 0x373e, 0x3745, 0x374b, 0x3751, 0x3757, 0x375d, 0x3763, 0x376a, 0x3770, 0x3776, 0x377c, 
-    /* 0x000010c0: */ 0x3782, 0x3789, 0x378f, 0x3795, 0x379b, 0x37a1, 0x37a7, 0x37ae, 0x37b4, 0x37ba, 0x37c0, 0x37c6, 0x37cc, 0x37d3, 0x37d9, 0x37df, 
-    /* 0x000010e0: */ 0x37e5, 0x37eb, 0x37f1, 0x37f8, 0x37fe, 0x3804, 0x380a, 0x3810, 0x3816, 0x381d, 0x3823, 0x3829, 0x382f, 0x3835, 0x383b, 0x3842, 
-    /* 0x00001100: */ 0x3848, 0x384e, 0x3854, 0x385a, 0x3860, 0x3867, 0x386d, 0x3873, 0x3879, 0x387f, 0x3885, 0x388b, 0x3892, 0x3898, 0x389e, 0x38a4, 
-    /* 0x00001120: */ 0x38aa, 0x38b0, 0x38b6, 0x38bd, 0x38c3, 0x38c9, 0x38cf, 0x38d5, 0x38db, 0x38e1, 0x38e8, 0x38ee, 0x38f4, 0x38fa, 0x3900, 0x3906, 
-    /* 0x00001140: */ 0x390c, 0x3913, 0x3919, 0x391f, 0x3925, 0x392b, 0x3931, 0x3937, 0x393e, 0x3944, 0x394a, 0x3950, 0x3956, 0x395c, 0x3962, 0x3968, 
-    /* 0x00001160: */ 0x396f, 0x3975, 0x397b, 0x3981, 0x3987, 0x398d, 0x3993, 0x3999, 0x39a0, 0x39a6, 0x39ac, 0x39b2, 0x39b8, 0x39be, 0x39c4, 0x39ca, 
-    /* 0x00001180: */ 0x39d1, 0x39d7, 0x39dd, 0x39e3, 0x39e9, 0x39ef, 0x39f5, 0x39fb, 0x3a01, 0x3a08, 0x3a0e, 0x3a14, 0x3a1a, 0x3a20, 0x3a26, 0x3a2c, 
-    /* 0x000011a0: */ 0x3a32, 0x3a38, 0x3a3f, 0x3a45, 0x3a4b, 0x3a51, 0x3a57, 0x3a5d, 0x3a63, 0x3a69, 0x3a6f, 0x3a75, 0x3a7c, 0x3a82, 0x3a88, 0x3a8e, 
-    /* 0x000011c0: */ 0x3a94, 0x3a9a, 0x3aa0, 0x3aa6, 0x3aac, 0x3ab2, 0x3ab8, 0x3abf, 0x3ac5, 0x3acb, 0x3ad1, 0x3ad7, 0x3add, 0x3ae3, 0x3ae9, 0x3aef, 
-    /* 0x000011e0: */ 0x3af5, 0x3afb, 0x3b02, 0x3b08, 0x3b0e, 0x3b14, 0x3b1a, 0x3b20, 0x3b26, 0x3b2c, 0x3b32, 0x3b38, 0x3b3e, 0x3b44, 0x3b4a, 0x3b51, 
-    /* 0x00001200: */ 0x3b57, 0x3b5d, 0x3b63, 0x3b69, 0x3b6f, 0x3b75, 0x3b7b, 0x3b81, 0x3b87, 0x3b8d, 0x3b93, 0x3b99, 0x3b9f, 0x3ba6, 0x3bac, 0x3bb2, 
-    /* 0x00001220: */ 0x3bb8, 0x3bbe, 0x3bc4, 0x3bca, 0x3bd0, 0x3bd6, 0x3bdc, 0x3be2, 0x3be8, 0x3bee, 0x3bf4, 0x3bfa, 0x3c00, 0x3c07, 0x3c0d, 0x3c13, 
-    /* 0x00001240: */ 0x3c19, 0x3c1f, 0x3c25, 0x3c2b, 0x3c31, 0x3c37, 0x3c3d, 0x3c43, 0x3c49, 0x3c4f, 0x3c55, 0x3c5b, 0x3c61, 0x3c67, 0x3c6d, 0x3c73, 
-    /* 0x00001260: */ 0x3c79, 0x3c7f, 0x3c86, 0x3c8c, 0x3c92, 0x3c98, 0x3c9e, 0x3ca4, 0x3caa, 0x3cb0, 0x3cb6, 0x3cbc, 0x3cc2, 0x3cc8, 0x3cce, 0x3cd4, 
-    /* 0x00001280: */ 0x3cda, 0x3ce0, 0x3ce6, 0x3cec, 0x3cf2, 0x3cf8, 0x3cfe, 0x3d04, 0x3d0a, 0x3d10, 0x3d16, 0x3d1c, 0x3d22, 0x3d28, 0x3d2e, 0x3d34, 
-    /* 0x000012a0: */ 0x3d3a, 0x3d40, 0x3d47, 0x3d4d, 0x3d53, 0x3d59, 0x3d5f, 0x3d65, 0x3d6b, 0x3d71, 0x3d77, 0x3d7d, 0x3d83, 0x3d89, 0x3d8f, 0x3d95, 
-    /* 0x000012c0: */ 0x3d9b, 0x3da1, 0x3da7, 0x3dad, 0x3db3, 0x3db9, 0x3dbf, 0x3dc5, 0x3dcb, 0x3dd1, 0x3dd7, 0x3ddd, 0x3de3, 0x3de9, 0x3def, 0x3df5, 
-    /* 0x000012e0: */ 0x3dfb, 0x3e01, 0x3e07, 0x3e0d, 0x3e13, 0x3e19, 0x3e1f, 0x3e25, 0x3e2b, 0x3e31, 0x3e37, 0x3e3d, 0x3e43, 0x3e49, 0x3e4f, 0x3e55, 
-    /* 0x00001300: */ 0x3e5b, 0x3e61, 0x3e67, 0x3e6d, 0x3e73, 0x3e79, 0x3e7f, 0x3e85, 0x3e8b, 0x3e91, 0x3e96, 0x3e9c, 0x3ea2, 0x3ea8, 0x3eae, 0x3eb4, 
-    /* 0x00001320: */ 0x3eba, 0x3ec0, 0x3ec6, 0x3ecc, 0x3ed2, 0x3ed8, 0x3ede, 0x3ee4, 0x3eea, 0x3ef0, 0x3ef6, 0x3efc, 0x3f02, 0x3f08, 0x3f0e, 0x3f14, 
-    /* 0x00001340: */ 0x3f1a, 0x3f20, 0x3f26, 0x3f2c, 0x3f32, 0x3f38, 0x3f3e, 0x3f44, 0x3f4a, 0x3f50, 0x3f55, 0x3f5b, 0x3f61, 0x3f67, 0x3f6d, 0x3f73, 
-    /* 0x00001360: */ 0x3f79, 0x3f7f, 0x3f85, 0x3f8b, 0x3f91, 0x3f97, 0x3f9d, 0x3fa3, 0x3fa9, 0x3faf, 0x3fb5, 0x3fbb, 0x3fc1, 0x3fc7, 0x3fcd, 0x3fd2, 
-    /* 0x00001380: */ 0x3fd8, 0x3fde, 0x3fe4, 0x3fea, 0x3ff0, 0x3ff6, 0x3ffc, 0x4002, 0x4008, 0x400e, 0x4014, 0x401a, 0x4020, 0x4026, 0x402c, 0x4031, 
-    /* 0x000013a0: */ 0x4037, 0x403d, 0x4043, 0x4049, 0x404f, 0x4055, 0x405b, 0x4061, 0x4067, 0x406d, 0x4073, 0x4079, 0x407e, 0x4084, 0x408a, 0x4090, 
-    /* 0x000013c0: */ 0x4096, 0x409c, 0x40a2, 0x40a8, 0x40ae, 0x40b4, 0x40ba, 0x40c0, 0x40c5, 0x40cb, 0x40d1, 0x40d7, 0x40dd, 0x40e3, 0x40e9, 0x40ef, 
-    /* 0x000013e0: */ 0x40f5, 0x40fb, 0x4101, 0x4106, 0x410c, 0x4112, 0x4118, 0x411e, 0x4124, 0x412a, 0x4130, 0x4136, 0x413c, 0x4142, 0x4147, 0x414d, 
-    /* 0x00001400: */ 0x4153, 0x4159, 0x415f, 0x4165, 0x416b, 0x4171, 0x4177, 0x417c, 0x4182, 0x4188, 0x418e, 0x4194, 0x419a, 0x41a0, 0x41a6, 0x41ac, 
-    /* 0x00001420: */ 0x41b1, 0x41b7, 0x41bd, 0x41c3, 0x41c9, 0x41cf, 0x41d5, 0x41db, 0x41e0, 0x41e6, 0x41ec, 0x41f2, 0x41f8, 0x41fe, 0x4204, 0x420a, 
-    /* 0x00001440: */ 0x420f, 0x4215, 0x421b, 0x4221, 0x4227, 0x422d, 0x4233, 0x4239, 0x423e, 0x4244, 0x424a, 0x4250, 0x4256, 0x425c, 0x4262, 0x4267, 
-    /* 0x00001460: */ 0x426d, 0x4273, 0x4279, 0x427f, 0x4285, 0x428b, 0x4290, 0x4296, 0x429c, 0x42a2, 0x42a8, 0x42ae, 0x42b4, 0x42b9, 0x42bf, 0x42c5, 
-    /* 0x00001480: */ 0x42cb, 0x42d1, 0x42d7, 0x42dd, 0x42e2, 0x42e8, 0x42ee, 0x42f4, 0x42fa, 0x4300, 0x4305, 0x430b, 0x4311, 0x4317, 0x431d, 0x4323, 
-    /* 0x000014a0: */ 0x4328, 0x432e, 0x4334, 0x433a, 0x4340, 0x4346, 0x434b, 0x4351, 0x4357, 0x435d, 0x4363, 0x4369, 0x436e, 0x4374, 0x437a, 0x4380, 
-    /* 0x000014c0: */ 0x4386, 0x438c, 0x4391, 0x4397, 0x439d, 0x43a3, 0x43a9, 0x43af, 0x43b4, 0x43ba, 0x43c0, 0x43c6, 0x43cc, 0x43d1, 0x43d7, 0x43dd, 
-    /* 0x000014e0: */ 0x43e3, 0x43e9, 0x43ee, 0x43f4, 0x43fa, 0x4400, 0x4406, 0x440c, 0x4411, 0x4417, 0x441d, 0x4423, 0x4429, 0x442e, 0x4434, 0x443a, 
-    /* 0x00001500: */ 0x4440, 0x4446, 0x444b, 0x4451, 0x4457, 0x445d, 0x4463, 0x4468, 0x446e, 0x4474, 0x447a, 0x4480, 0x4485, 0x448b, 0x4491, 0x4497, 
-    /* 0x00001520: */ 0x449c, 0x44a2, 0x44a8, 0x44ae, 0x44b4, 0x44b9, 0x44bf, 0x44c5, 0x44cb, 0x44d1, 0x44d6, 0x44dc, 0x44e2, 0x44e8, 0x44ed, 0x44f3, 
-    /* 0x00001540: */ 0x44f9, 0x44ff, 0x4505, 0x450a, 0x4510, 0x4516, 0x451c, 0x4521, 0x4527, 0x452d, 0x4533, 0x4538, 0x453e, 0x4544, 0x454a, 0x4550, 
-    /* 0x00001560: */ 0x4555, 0x455b, 0x4561, 0x4567, 0x456c, 0x4572, 0x4578, 0x457e, 0x4583, 0x4589, 0x458f, 0x4595, 0x459a, 0x45a0, 0x45a6, 0x45ac, 
-    /* 0x00001580: */ 0x45b1, 0x45b7, 0x45bd, 0x45c3, 0x45c8, 0x45ce, 0x45d4, 0x45da, 0x45df, 0x45e5, 0x45eb, 0x45f1, 0x45f6, 0x45fc, 0x4602, 0x4608, 
-    /* 0x000015a0: */ 0x460d, 0x4613, 0x4619, 0x461e, 0x4624, 0x462a, 0x4630, 0x4635, 0x463b, 0x4641, 0x4647, 0x464c, 0x4652, 0x4658, 0x465e, 0x4663, 
-    /* 0x000015c0: */ 0x4669, 0x466f, 0x4674, 0x467a, 0x4680, 0x4686, 0x468b, 0x4691, 0x4697, 0x469c, 0x46a2, 0x46a8, 0x46ae, 0x46b3, 0x46b9, 0x46bf, 
-    /* 0x000015e0: */ 0x46c4, 0x46ca, 0x46d0, 0x46d6, 0x46db, 0x46e1, 0x46e7, 0x46ec, 0x46f2, 0x46f8, 0x46fe, 0x4703, 0x4709, 0x470f, 0x4714, 0x471a, 
-    /* 0x00001600: */ 0x4720, 0x4725, 0x472b, 0x4731, 0x4737, 0x473c, 0x4742, 0x4748, 0x474d, 0x4753, 0x4759, 0x475e, 0x4764, 0x476a, 0x4770, 0x4775, 
-    /* 0x00001620: */ 0x477b, 0x4781, 0x4786, 0x478c, 0x4792, 0x4797, 0x479d, 0x47a3, 0x47a8, 0x47ae, 0x47b4, 0x47b9, 0x47bf, 0x47c5, 0x47ca, 0x47d0, 
-    /* 0x00001640: */ 0x47d6, 0x47db, 0x47e1, 0x47e7, 0x47ec, 0x47f2, 0x47f8, 0x47fd, 0x4803, 0x4809, 0x480e, 0x4814, 0x481a, 0x481f, 0x4825, 0x482b, 
-    /* 0x00001660: */ 0x4830, 0x4836, 0x483c, 0x4841, 0x4847, 0x484d, 0x4852, 0x4858, 0x485e, 0x4863, 0x4869, 0x486f, 0x4874, 0x487a, 0x4880, 0x4885, 
-    /* 0x00001680: */ 0x488b, 0x4891, 0x4896, 0x489c, 0x48a2, 0x48a7, 0x48ad, 0x48b2, 0x48b8, 0x48be, 0x48c3, 0x48c9, 0x48cf, 0x48d4, 0x48da, 0x48e0, 
-    /* 0x000016a0: */ 0x48e5, 0x48eb, 0x48f0, 0x48f6, 0x48fc, 0x4901, 0x4907, 0x490d, 0x4912, 0x4918, 0x491e, 0x4923, 0x4929, 0x492e, 0x4934, 0x493a, 
-    /* 0x000016c0: */ 0x493f, 0x4945, 0x494b, 0x4950, 0x4956, 0x495b, 0x4961, 0x4967, 0x496c, 0x4972, 0x4977, 0x497d, 0x4983, 0x4988, 0x498e, 0x4994, 
-    /* 0x000016e0: */ 0x4999, 0x499f, 0x49a4, 0x49aa, 0x49b0, 0x49b5, 0x49bb, 0x49c0, 0x49c6, 0x49cc, 0x49d1, 0x49d7, 0x49dc, 0x49e2, 0x49e8, 0x49ed, 
-    /* 0x00001700: */ 0x49f3, 0x49f8, 0x49fe, 0x4a04, 0x4a09, 0x4a0f, 0x4a14, 0x4a1a, 0x4a1f, 0x4a25, 0x4a2b, 0x4a30, 0x4a36, 0x4a3b, 0x4a41, 0x4a47, 
-    /* 0x00001720: */ 0x4a4c, 0x4a52, 0x4a57, 0x4a5d, 0x4a63, 0x4a68, 0x4a6e, 0x4a73, 0x4a79, 0x4a7e, 0x4a84, 0x4a8a, 0x4a8f, 0x4a95, 0x4a9a, 0x4aa0, 
-    /* 0x00001740: */ 0x4aa5, 0x4aab, 0x4ab1, 0x4ab6, 0x4abc, 0x4ac1, 0x4ac7, 0x4acc, 0x4ad2, 0x4ad7, 0x4add, 0x4ae3, 0x4ae8, 0x4aee, 0x4af3, 0x4af9, 
-    /* 0x00001760: */ 0x4afe, 0x4b04, 0x4b0a, 0x4b0f, 0x4b15, 0x4b1a, 0x4b20, 0x4b25, 0x4b2b, 0x4b30, 0x4b36, 0x4b3b, 0x4b41, 0x4b47, 0x4b4c, 0x4b52, 
-    /* 0x00001780: */ 0x4b57, 0x4b5d, 0x4b62, 0x4b68, 0x4b6d, 0x4b73, 0x4b78, 0x4b7e, 0x4b83, 0x4b89, 0x4b8f, 0x4b94, 0x4b9a, 0x4b9f, 0x4ba5, 0x4baa, 
-    /* 0x000017a0: */ 0x4bb0, 0x4bb5, 0x4bbb, 0x4bc0, 0x4bc6, 0x4bcb, 0x4bd1, 0x4bd6, 0x4bdc, 0x4be1, 0x4be7, 0x4bed, 0x4bf2, 0x4bf8, 0x4bfd, 0x4c03, 
-    /* 0x000017c0: */ 0x4c08, 0x4c0e, 0x4c13, 0x4c19, 0x4c1e, 0x4c24, 0x4c29, 0x4c2f, 0x4c34, 0x4c3a, 0x4c3f, 0x4c45, 0x4c4a, 0x4c50, 0x4c55, 0x4c5b, 
-    /* 0x000017e0: */ 0x4c60, 0x4c66, 0x4c6b, 0x4c71, 0x4c76, 0x4c7c, 0x4c81, 0x4c87, 0x4c8c, 0x4c92, 0x4c97, 0x4c9d, 0x4ca2, 0x4ca8, 0x4cad, 0x4cb3, 
-    /* 0x00001800: */ 0x4cb8, 0x4cbe, 0x4cc3, 0x4cc9, 0x4cce, 0x4cd4, 0x4cd9, 0x4cdf, 0x4ce4, 0x4cea, 0x4cef, 0x4cf4, 0x4cfa, 0x4cff, 0x4d05, 0x4d0a, 
-    /* 0x00001820: */ 0x4d10, 0x4d15, 0x4d1b, 0x4d20, 0x4d26, 0x4d2b, 0x4d31, 0x4d36, 0x4d3c, 0x4d41, 0x4d47, 0x4d4c, 0x4d51, 0x4d57, 0x4d5c, 0x4d62, 
-    /* 0x00001840: */ 0x4d67, 0x4d6d, 0x4d72, 0x4d78, 0x4d7d, 0x4d83, 0x4d88, 0x4d8e, 0x4d93, 0x4d98, 0x4d9e, 0x4da3, 0x4da9, 0x4dae, 0x4db4, 0x4db9, 
-    /* 0x00001860: */ 0x4dbf, 0x4dc4, 0x4dc9, 0x4dcf, 0x4dd4, 0x4dda, 0x4ddf, 0x4de5, 0x4dea, 0x4df0, 0x4df5, 0x4dfa, 0x4e00, 0x4e05, 0x4e0b, 0x4e10, 
-    /* 0x00001880: */ 0x4e16, 0x4e1b, 0x4e20, 0x4e26, 0x4e2b, 0x4e31, 0x4e36, 0x4e3c, 0x4e41, 0x4e46, 0x4e4c, 0x4e51, 0x4e57, 0x4e5c, 0x4e62, 0x4e67, 
-    /* 0x000018a0: */ 0x4e6c, 0x4e72, 0x4e77, 0x4e7d, 0x4e82, 0x4e87, 0x4e8d, 0x4e92, 0x4e98, 0x4e9d, 0x4ea3, 0x4ea8, 0x4ead, 0x4eb3, 0x4eb8, 0x4ebe, 
-    /* 0x000018c0: */ 0x4ec3, 0x4ec8, 0x4ece, 0x4ed3, 0x4ed9, 0x4ede, 0x4ee3, 0x4ee9, 0x4eee, 0x4ef4, 0x4ef9, 0x4efe, 0x4f04, 0x4f09, 0x4f0f, 0x4f14, 
-    /* 0x000018e0: */ 0x4f19, 0x4f1f, 0x4f24, 0x4f29, 0x4f2f, 0x4f34, 0x4f3a, 0x4f3f, 0x4f44, 0x4f4a, 0x4f4f, 0x4f55, 0x4f5a, 0x4f5f, 0x4f65, 0x4f6a, 
-    /* 0x00001900: */ 0x4f6f, 0x4f75, 0x4f7a, 0x4f80, 0x4f85, 0x4f8a, 0x4f90, 0x4f95, 0x4f9a, 0x4fa0, 0x4fa5, 0x4fab, 0x4fb0, 0x4fb5, 0x4fbb, 0x4fc0, 
-    /* 0x00001920: */ 0x4fc5, 0x4fcb, 0x4fd0, 0x4fd5, 0x4fdb, 0x4fe0, 0x4fe6, 0x4feb, 0x4ff0, 0x4ff6, 0x4ffb, 0x5000, 0x5006, 0x500b, 0x5010, 0x5016, 
-    /* 0x00001940: */ 0x501b, 0x5020, 0x5026, 0x502b, 0x5030, 0x5036, 0x503b, 0x5040, 0x5046, 0x504b, 0x5050, 0x5056, 0x505b, 0x5060, 0x5066, 0x506b, 
-    /* 0x00001960: */ 0x5070, 0x5076, 0x507b, 0x5080, 0x5086, 0x508b, 0x5090, 0x5096, 0x509b, 0x50a0, 0x50a6, 0x50ab, 0x50b0, 0x50b6, 0x50bb, 0x50c0, 
-    /* 0x00001980: */ 0x50c6, 0x50cb, 0x50d0, 0x50d6, 0x50db, 0x50e0, 0x50e6, 0x50eb, 0x50f0, 0x50f5, 0x50fb, 0x5100, 0x5105, 0x510b, 0x5110, 0x5115, 
-    /* 0x000019a0: */ 0x511b, 0x5120, 0x5125, 0x512b, 0x5130, 0x5135, 0x513a, 0x5140, 0x5145, 0x514a, 0x5150, 0x5155, 0x515a, 0x5160, 0x5165, 0x516a, 
-    /* 0x000019c0: */ 0x516f, 0x5175, 0x517a, 0x517f, 0x5185, 0x518a, 0x518f, 0x5194, 0x519a, 0x519f, 0x51a4, 0x51aa, 0x51af, 0x51b4, 0x51b9, 0x51bf, 
-    /* 0x000019e0: */ 0x51c4, 0x51c9, 0x51ce, 0x51d4, 0x51d9, 0x51de, 0x51e4, 0x51e9, 0x51ee, 0x51f3, 0x51f9, 0x51fe, 0x5203, 0x5208, 0x520e, 0x5213, 
-    /* 0x00001a00: */ 0x5218, 0x521d, 0x5223, 0x5228, 0x522d, 0x5232, 0x5238, 0x523d, 0x5242, 0x5247, 0x524d, 0x5252, 0x5257, 0x525c, 0x5262, 0x5267, 
-    /* 0x00001a20: */ 0x526c, 0x5271, 0x5277, 0x527c, 0x5281, 0x5286, 0x528c, 0x5291, 0x5296, 0x529b, 0x52a1, 0x52a6, 0x52ab, 0x52b0, 0x52b6, 0x52bb, 
-    /* 0x00001a40: */ 0x52c0, 0x52c5, 0x52ca, 0x52d0, 0x52d5, 0x52da, 0x52df, 0x52e5, 0x52ea, 0x52ef, 0x52f4, 0x52f9, 0x52ff, 0x5304, 0x5309, 0x530e, 
-    /* 0x00001a60: */ 0x5314, 0x5319, 0x531e, 0x5323, 0x5328, 0x532e, 0x5333, 0x5338, 0x533d, 0x5342, 0x5348, 0x534d, 0x5352, 0x5357, 0x535d, 0x5362, 
-    /* 0x00001a80: */ 0x5367, 0x536c, 0x5371, 0x5377, 0x537c, 0x5381, 0x5386, 0x538b, 0x5390, 0x5396, 0x539b, 0x53a0, 0x53a5, 0x53aa, 0x53b0, 0x53b5, 
-    /* 0x00001aa0: */ 0x53ba, 0x53bf, 0x53c4, 0x53ca, 0x53cf, 0x53d4, 0x53d9, 0x53de, 0x53e3, 0x53e9, 0x53ee, 0x53f3, 0x53f8, 0x53fd, 0x5403, 0x5408, 
-    /* 0x00001ac0: */ 0x540d, 0x5412, 0x5417, 0x541c, 0x5422, 0x5427, 0x542c, 0x5431, 0x5436, 0x543b, 0x5441, 0x5446, 0x544b, 0x5450, 0x5455, 0x545a, 
-    /* 0x00001ae0: */ 0x545f, 0x5465, 0x546a, 0x546f, 0x5474, 0x5479, 0x547e, 0x5484, 0x5489, 0x548e, 0x5493, 0x5498, 0x549d, 0x54a2, 0x54a8, 0x54ad, 
-    /* 0x00001b00: */ 0x54b2, 0x54b7, 0x54bc, 0x54c1, 0x54c6, 0x54cc, 0x54d1, 0x54d6, 0x54db, 0x54e0, 0x54e5, 0x54ea, 0x54ef, 0x54f5, 0x54fa, 0x54ff, 
-    /* 0x00001b20: */ 0x5504, 0x5509, 0x550e, 0x5513, 0x5518, 0x551e, 0x5523, 0x5528, 0x552d, 0x5532, 0x5537, 0x553c, 0x5541, 0x5546, 0x554c, 0x5551, 
-    /* 0x00001b40: */ 0x5556, 0x555b, 0x5560, 0x5565, 0x556a, 0x556f, 0x5574, 0x557a, 0x557f, 0x5584, 0x5589, 0x558e, 0x5593, 0x5598, 0x559d, 0x55a2, 
-    /* 0x00001b60: */ 0x55a7, 0x55ad, 0x55b2, 0x55b7, 0x55bc, 0x55c1, 0x55c6, 0x55cb, 0x55d0, 0x55d5, 0x55da, 0x55df, 0x55e5, 0x55ea, 0x55ef, 0x55f4, 
-    /* 0x00001b80: */ 0x55f9, 0x55fe, 0x5603, 0x5608, 0x560d, 0x5612, 0x5617, 0x561c, 0x5621, 0x5627, 0x562c, 0x5631, 0x5636, 0x563b, 0x5640, 0x5645, 
-    /* 0x00001ba0: */ 0x564a, 0x564f, 0x5654, 0x5659, 0x565e, 0x5663, 0x5668, 0x566d, 0x5672, 0x5678, 0x567d, 0x5682, 0x5687, 0x568c, 0x5691, 0x5696, 
-    /* 0x00001bc0: */ 0x569b, 0x56a0, 0x56a5, 0x56aa, 0x56af, 0x56b4, 0x56b9, 0x56be, 0x56c3, 0x56c8, 0x56cd, 0x56d2, 0x56d7, 0x56dc, 0x56e1, 0x56e6, 
-    /* 0x00001be0: */ 0x56ec, 0x56f1, 0x56f6, 0x56fb, 0x5700, 0x5705, 0x570a, 0x570f, 0x5714, 0x5719, 0x571e, 0x5723, 0x5728, 0x572d, 0x5732, 0x5737, 
-    /* 0x00001c00: */ 0x573c, 0x5741, 0x5746, 0x574b, 0x5750, 0x5755, 0x575a, 0x575f, 0x5764, 0x5769, 0x576e, 0x5773, 0x5778, 0x577d, 0x5782, 0x5787, 
-    /* 0x00001c20: */ 0x578c, 0x5791, 0x5796, 0x579b, 0x57a0, 0x57a5, 0x57aa, 0x57af, 0x57b4, 0x57b9, 0x57be, 0x57c3, 0x57c8, 0x57cd, 0x57d2, 0x57d7, 
-    /* 0x00001c40: */ 0x57dc, 0x57e1, 0x57e6, 0x57eb, 0x57f0, 0x57f5, 0x57fa, 0x57ff, 0x5804, 0x5809, 0x580e, 0x5813, 0x5818, 0x581d, 0x5822, 0x5827, 
-    /* 0x00001c60: */ 0x582c, 0x5831, 0x5836, 0x583a, 0x583f, 0x5844, 0x5849, 0x584e, 0x5853, 0x5858, 0x585d, 0x5862, 0x5867, 0x586c, 0x5871, 0x5876, 
-    /* 0x00001c80: */ 0x587b, 0x5880, 0x5885, 0x588a, 0x588f, 0x5894, 0x5899, 0x589e, 0x58a3, 0x58a8, 0x58ac, 0x58b1, 0x58b6, 0x58bb, 0x58c0, 0x58c5, 
-    /* 0x00001ca0: */ 0x58ca, 0x58cf, 0x58d4, 0x58d9, 0x58de, 0x58e3, 0x58e8, 0x58ed, 0x58f2, 0x58f7, 0x58fb, 0x5900, 0x5905, 0x590a, 0x590f, 0x5914, 
-    /* 0x00001cc0: */ 0x5919, 0x591e, 0x5923, 0x5928, 0x592d, 0x5932, 0x5937, 0x593b, 0x5940, 0x5945, 0x594a, 0x594f, 0x5954, 0x5959, 0x595e, 0x5963, 
-    /* 0x00001ce0: */ 0x5968, 0x596d, 0x5971, 0x5976, 0x597b, 0x5980, 0x5985, 0x598a, 0x598f, 0x5994, 0x5999, 0x599e, 0x59a2, 0x59a7, 0x59ac, 0x59b1, 
-    /* 0x00001d00: */ 0x59b6, 0x59bb, 0x59c0, 0x59c5, 0x59ca, 0x59ce, 0x59d3, 0x59d8, 0x59dd, 0x59e2, 0x59e7, 0x59ec, 0x59f1, 0x59f5, 0x59fa, 0x59ff, 
-    /* 0x00001d20: */ 0x5a04, 0x5a09, 0x5a0e, 0x5a13, 0x5a18, 0x5a1c, 0x5a21, 0x5a26, 0x5a2b, 0x5a30, 0x5a35, 0x5a3a, 0x5a3f, 0x5a43, 0x5a48, 0x5a4d, 
-    /* 0x00001d40: */ 0x5a52, 0x5a57, 0x5a5c, 0x5a61, 0x5a65, 0x5a6a, 0x5a6f, 0x5a74, 0x5a79, 0x5a7e, 0x5a82, 0x5a87, 0x5a8c, 0x5a91, 0x5a96, 0x5a9b, 
-    /* 0x00001d60: */ 0x5aa0, 0x5aa4, 0x5aa9, 0x5aae, 0x5ab3, 0x5ab8, 0x5abd, 0x5ac1, 0x5ac6, 0x5acb, 0x5ad0, 0x5ad5, 0x5ada, 0x5ade, 0x5ae3, 0x5ae8, 
-    /* 0x00001d80: */ 0x5aed, 0x5af2, 0x5af7, 0x5afb, 0x5b00, 0x5b05, 0x5b0a, 0x5b0f, 0x5b13, 0x5b18, 0x5b1d, 0x5b22, 0x5b27, 0x5b2c, 0x5b30, 0x5b35, 
-    /* 0x00001da0: */ 0x5b3a, 0x5b3f, 0x5b44, 0x5b48, 0x5b4d, 0x5b52, 0x5b57, 0x5b5c, 0x5b60, 0x5b65, 0x5b6a, 0x5b6f, 0x5b74, 0x5b78, 0x5b7d, 0x5b82, 
-    /* 0x00001dc0: */ 0x5b87, 0x5b8c, 0x5b90, 0x5b95, 0x5b9a, 0x5b9f, 0x5ba4, 0x5ba8, 0x5bad, 0x5bb2, 0x5bb7, 0x5bbb, 0x5bc0, 0x5bc5, 0x5bca, 0x5bcf, 
-    /* 0x00001de0: */ 0x5bd3, 0x5bd8, 0x5bdd, 0x5be2, 0x5be6, 0x5beb, 0x5bf0, 0x5bf5, 0x5bf9, 0x5bfe, 0x5c03, 0x5c08, 0x5c0d, 0x5c11, 0x5c16, 0x5c1b, 
-    /* 0x00001e00: */ 0x5c20, 0x5c24, 0x5c29, 0x5c2e, 0x5c33, 0x5c37, 0x5c3c, 0x5c41, 0x5c46, 0x5c4a, 0x5c4f, 0x5c54, 0x5c59, 0x5c5d, 0x5c62, 0x5c67, 
-    /* 0x00001e20: */ 0x5c6c, 0x5c70, 0x5c75, 0x5c7a, 0x5c7f, 0x5c83, 0x5c88, 0x5c8d, 0x5c92, 0x5c96, 0x5c9b, 0x5ca0, 0x5ca4, 0x5ca9, 0x5cae, 0x5cb3, 
-    /* 0x00001e40: */ 0x5cb7, 0x5cbc, 0x5cc1, 0x5cc6, 0x5cca, 0x5ccf, 0x5cd4, 0x5cd8, 0x5cdd, 0x5ce2, 0x5ce7, 0x5ceb, 0x5cf0, 0x5cf5, 0x5cf9, 0x5cfe, 
-    /* 0x00001e60: */ 0x5d03, 0x5d08, 0x5d0c, 0x5d11, 0x5d16, 0x5d1a, 0x5d1f, 0x5d24, 0x5d29, 0x5d2d, 0x5d32, 0x5d37, 0x5d3b, 0x5d40, 0x5d45, 0x5d49, 
-    /* 0x00001e80: */ 0x5d4e, 0x5d53, 0x5d57, 0x5d5c, 0x5d61, 0x5d66, 0x5d6a, 0x5d6f, 0x5d74, 0x5d78, 0x5d7d, 0x5d82, 0x5d86, 0x5d8b, 0x5d90, 0x5d94, 
-    /* 0x00001ea0: */ 0x5d99, 0x5d9e, 0x5da2, 0x5da7, 0x5dac, 0x5db0, 0x5db5, 0x5dba, 0x5dbe, 0x5dc3, 0x5dc8, 0x5dcc, 0x5dd1, 0x5dd6, 0x5dda, 0x5ddf, 
-    /* 0x00001ec0: */ 0x5de4, 0x5de8, 0x5ded, 0x5df2, 0x5df6, 0x5dfb, 0x5e00, 0x5e04, 0x5e09, 0x5e0e, 0x5e12, 0x5e17, 0x5e1c, 0x5e20, 0x5e25, 0x5e29, 
-    /* 0x00001ee0: */ 0x5e2e, 0x5e33, 0x5e37, 0x5e3c, 0x5e41, 0x5e45, 0x5e4a, 0x5e4f, 0x5e53, 0x5e58, 0x5e5d, 0x5e61, 0x5e66, 0x5e6a, 0x5e6f, 0x5e74, 
-    /* 0x00001f00: */ 0x5e78, 0x5e7d, 0x5e82, 0x5e86, 0x5e8b, 0x5e8f, 0x5e94, 0x5e99, 0x5e9d, 0x5ea2, 0x5ea6, 0x5eab, 0x5eb0, 0x5eb4, 0x5eb9, 0x5ebe, 
-    /* 0x00001f20: */ 0x5ec2, 0x5ec7, 0x5ecb, 0x5ed0, 0x5ed5, 0x5ed9, 0x5ede, 0x5ee2, 0x5ee7, 0x5eec, 0x5ef0, 0x5ef5, 0x5ef9, 0x5efe, 0x5f03, 0x5f07, 
-    /* 0x00001f40: */ 0x5f0c, 0x5f10, 0x5f15, 0x5f1a, 0x5f1e, 0x5f23, 0x5f27, 0x5f2c, 0x5f30, 0x5f35, 0x5f3a, 0x5f3e, 0x5f43, 0x5f47, 0x5f4c, 0x5f51, 
-    /* 0x00001f60: */ 0x5f55, 0x5f5a, 0x5f5e, 0x5f63, 0x5f67, 0x5f6c, 0x5f71, 0x5f75, 0x5f7a, 0x5f7e, 0x5f83, 0x5f87, 0x5f8c, 0x5f90, 0x5f95, 0x5f9a, 
-    /* 0x00001f80: */ 0x5f9e, 0x5fa3, 0x5fa7, 0x5fac, 0x5fb0, 0x5fb5, 0x5fb9, 0x5fbe, 0x5fc3, 0x5fc7, 0x5fcc, 0x5fd0, 0x5fd5, 0x5fd9, 0x5fde, 0x5fe2, 
-    /* 0x00001fa0: */ 0x5fe7, 0x5feb, 0x5ff0, 0x5ff5, 0x5ff9, 0x5ffe, 0x6002, 0x6007, 0x600b, 0x6010, 0x6014, 0x6019, 0x601d, 0x6022, 0x6026, 0x602b, 
-    /* 0x00001fc0: */ 0x602f, 0x6034, 0x6038, 0x603d, 0x6042, 0x6046, 0x604b, 0x604f, 0x6054, 0x6058, 0x605d, 0x6061, 0x6066, 0x606a, 0x606f, 0x6073, 
-    /* 0x00001fe0: */ 0x6078, 0x607c, 0x6081, 0x6085, 0x608a, 0x608e, 0x6093, 0x6097, 0x609c, 0x60a0, 0x60a5, 0x60a9, 0x60ae, 0x60b2, 0x60b7, 0x60bb, 
-    /* 0x00002000: */ 0x60c0, 0x60c4, 0x60c9, 0x60cd, 0x60d2, 0x60d6, 0x60db, 0x60df, 0x60e4, 0x60e8, 0x60ec, 0x60f1, 0x60f5, 0x60fa, 0x60fe, 0x6103, 
-    /* 0x00002020: */ 0x6107, 0x610c, 0x6110, 0x6115, 0x6119, 0x611e, 0x6122, 0x6127, 0x612b, 0x6130, 0x6134, 0x6138, 0x613d, 0x6141, 0x6146, 0x614a, 
-    /* 0x00002040: */ 0x614f, 0x6153, 0x6158, 0x615c, 0x6161, 0x6165, 0x6169, 0x616e, 0x6172, 0x6177, 0x617b, 0x6180, 0x6184, 0x6189, 0x618d, 0x6191, 
-    /* 0x00002060: */ 0x6196, 0x619a, 0x619f, 0x61a3, 0x61a8, 0x61ac, 0x61b0, 0x61b5, 0x61b9, 0x61be, 0x61c2, 0x61c7, 0x61cb, 0x61cf, 0x61d4, 0x61d8, 
-    /* 0x00002080: */ 0x61dd, 0x61e1, 0x61e6, 0x61ea, 0x61ee, 0x61f3, 0x61f7, 0x61fc, 0x6200, 0x6204, 0x6209, 0x620d, 0x6212, 0x6216, 0x621a, 0x621f, 
-    /* 0x000020a0: */ 0x6223, 0x6228, 0x622c, 0x6230, 0x6235, 0x6239, 0x623e, 0x6242, 0x6246, 0x624b, 0x624f, 0x6254, 0x6258, 0x625c, 0x6261, 0x6265, 
-    /* 0x000020c0: */ 0x626a, 0x626e, 0x6272, 0x6277, 0x627b, 0x627f, 0x6284, 0x6288, 0x628d, 0x6291, 0x6295, 0x629a, 0x629e, 0x62a2, 0x62a7, 0x62ab, 
-    /* 0x000020e0: */ 0x62b0, 0x62b4, 0x62b8, 0x62bd, 0x62c1, 0x62c5, 0x62ca, 0x62ce, 0x62d2, 0x62d7, 0x62db, 0x62df, 0x62e4, 0x62e8, 0x62ed, 0x62f1, 
-    /* 0x00002100: */ 0x62f5, 0x62fa, 0x62fe, 0x6302, 0x6307, 0x630b, 0x630f, 0x6314, 0x6318, 0x631c, 0x6321, 0x6325, 0x6329, 0x632e, 0x6332, 0x6336, 
-    /* 0x00002120: */ 0x633b, 0x633f, 0x6343, 0x6348, 0x634c, 0x6350, 0x6355, 0x6359, 0x635d, 0x6362, 0x6366, 0x636a, 0x636f, 0x6373, 0x6377, 0x637b, 
-    /* 0x00002140: */ 0x6380, 0x6384, 0x6388, 0x638d, 0x6391, 0x6395, 0x639a, 0x639e, 0x63a2, 0x63a7, 0x63ab, 0x63af, 0x63b3, 0x63b8, 0x63bc, 0x63c0, 
-    /* 0x00002160: */ 0x63c5, 0x63c9, 0x63cd, 0x63d2, 0x63d6, 0x63da, 0x63de, 0x63e3, 0x63e7, 0x63eb, 0x63f0, 0x63f4, 0x63f8, 0x63fc, 0x6401, 0x6405, 
-    /* 0x00002180: */ 0x6409, 0x640d, 0x6412, 0x6416, 0x641a, 0x641f, 0x6423, 0x6427, 0x642b, 0x6430, 0x6434, 0x6438, 0x643c, 0x6441, 0x6445, 0x6449, 
-    /* 0x000021a0: */ 0x644e, 0x6452, 0x6456, 0x645a, 0x645f, 0x6463, 0x6467, 0x646b, 0x6470, 0x6474, 0x6478, 0x647c, 0x6481, 0x6485, 0x6489, 0x648d, 
-    /* 0x000021c0: */ 0x6492, 0x6496, 0x649a, 0x649e, 0x64a2, 0x64a7, 0x64ab, 0x64af, 0x64b3, 0x64b8, 0x64bc, 0x64c0, 0x64c4, 0x64c9, 0x64cd, 0x64d1, 
-    /* 0x000021e0: */ 0x64d5, 0x64d9, 0x64de, 0x64e2, 0x64e6, 0x64ea, 0x64ef, 0x64f3, 0x64f7, 0x64fb, 0x64ff, 0x6504, 0x6508, 0x650c, 0x6510, 0x6514, 
-    /* 0x00002200: */ 0x6519, 0x651d, 0x6521, 0x6525, 0x6529, 0x652e, 0x6532, 0x6536, 0x653a, 0x653e, 0x6543, 0x6547, 0x654b, 0x654f, 0x6553, 0x6558, 
-    /* 0x00002220: */ 0x655c, 0x6560, 0x6564, 0x6568, 0x656c, 0x6571, 0x6575, 0x6579, 0x657d, 0x6581, 0x6586, 0x658a, 0x658e, 0x6592, 0x6596, 0x659a, 
-    /* 0x00002240: */ 0x659f, 0x65a3, 0x65a7, 0x65ab, 0x65af, 0x65b3, 0x65b8, 0x65bc, 0x65c0, 0x65c4, 0x65c8, 0x65cc, 0x65d1, 0x65d5, 0x65d9, 0x65dd, 
-    /* 0x00002260: */ 0x65e1, 0x65e5, 0x65e9, 0x65ee, 0x65f2, 0x65f6, 0x65fa, 0x65fe, 0x6602, 0x6606, 0x660b, 0x660f, 0x6613, 0x6617, 0x661b, 0x661f, 
-    /* 0x00002280: */ 0x6623, 0x6628, 0x662c, 0x6630, 0x6634, 0x6638, 0x663c, 0x6640, 0x6644, 0x6649, 0x664d, 0x6651, 0x6655, 0x6659, 0x665d, 0x6661, 
-    /* 0x000022a0: */ 0x6665, 0x6669, 0x666e, 0x6672, 0x6676, 0x667a, 0x667e, 0x6682, 0x6686, 0x668a, 0x668e, 0x6693, 0x6697, 0x669b, 0x669f, 0x66a3, 
-    /* 0x000022c0: */ 0x66a7, 0x66ab, 0x66af, 0x66b3, 0x66b7, 0x66bb, 0x66c0, 0x66c4, 0x66c8, 0x66cc, 0x66d0, 0x66d4, 0x66d8, 0x66dc, 0x66e0, 0x66e4, 
-    /* 0x000022e0: */ 0x66e8, 0x66ec, 0x66f1, 0x66f5, 0x66f9, 0x66fd, 0x6701, 0x6705, 0x6709, 0x670d, 0x6711, 0x6715, 0x6719, 0x671d, 0x6721, 0x6725, 
-    /* 0x00002300: */ 0x6729, 0x672e, 0x6732, 0x6736, 0x673a, 0x673e, 0x6742, 0x6746, 0x674a, 0x674e, 0x6752, 0x6756, 0x675a, 0x675e, 0x6762, 0x6766, 
-    /* 0x00002320: */ 0x676a, 0x676e, 0x6772, 0x6776, 0x677a, 0x677e, 0x6782, 0x6787, 0x678b, 0x678f, 0x6793, 0x6797, 0x679b, 0x679f, 0x67a3, 0x67a7, 
-    /* 0x00002340: */ 0x67ab, 0x67af, 0x67b3, 0x67b7, 0x67bb, 0x67bf, 0x67c3, 0x67c7, 0x67cb, 0x67cf, 0x67d3, 0x67d7, 0x67db, 0x67df, 0x67e3, 0x67e7, 
-    /* 0x00002360: */ 0x67eb, 0x67ef, 0x67f3, 0x67f7, 0x67fb, 0x67ff, 0x6803, 0x6807, 0x680b, 0x680f, 0x6813, 0x6817, 0x681b, 0x681f, 0x6823, 0x6827, 
-    /* 0x00002380: */ 0x682b, 0x682f, 0x6833, 0x6837, 0x683b, 0x683f, 0x6843, 0x6847, 0x684b, 0x684f, 0x6853, 0x6857, 0x685b, 0x685f, 0x6862, 0x6866, 
-    /* 0x000023a0: */ 0x686a, 0x686e, 0x6872, 0x6876, 0x687a, 0x687e, 0x6882, 0x6886, 0x688a, 0x688e, 0x6892, 0x6896, 0x689a, 0x689e, 0x68a2, 0x68a6, 
-    /* 0x000023c0: */ 0x68aa, 0x68ae, 0x68b2, 0x68b6, 0x68b9, 0x68bd, 0x68c1, 0x68c5, 0x68c9, 0x68cd, 0x68d1, 0x68d5, 0x68d9, 0x68dd, 0x68e1, 0x68e5, 
-    /* 0x000023e0: */ 0x68e9, 0x68ed, 0x68f1, 0x68f4, 0x68f8, 0x68fc, 0x6900, 0x6904, 0x6908, 0x690c, 0x6910, 0x6914, 0x6918, 0x691c, 0x6920, 0x6923, 
-    /* 0x00002400: */ 0x6927, 0x692b, 0x692f, 0x6933, 0x6937, 0x693b, 0x693f, 0x6943, 0x6947, 0x694b, 0x694e, 0x6952, 0x6956, 0x695a, 0x695e, 0x6962, 
-    /* 0x00002420: */ 0x6966, 0x696a, 0x696e, 0x6971, 0x6975, 0x6979, 0x697d, 0x6981, 0x6985, 0x6989, 0x698d, 0x6990, 0x6994, 0x6998, 0x699c, 0x69a0, 
-    /* 0x00002440: */ 0x69a4, 0x69a8, 0x69ac, 0x69af, 0x69b3, 0x69b7, 0x69bb, 0x69bf, 0x69c3, 0x69c7, 0x69cb, 0x69ce, 0x69d2, 0x69d6, 0x69da, 0x69de, 
-    /* 0x00002460: */ 0x69e2, 0x69e6, 0x69e9, 0x69ed, 0x69f1, 0x69f5, 0x69f9, 0x69fd, 0x6a00, 0x6a04, 0x6a08, 0x6a0c, 0x6a10, 0x6a14, 0x6a17, 0x6a1b, 
-    /* 0x00002480: */ 0x6a1f, 0x6a23, 0x6a27, 0x6a2b, 0x6a2e, 0x6a32, 0x6a36, 0x6a3a, 0x6a3e, 0x6a42, 0x6a45, 0x6a49, 0x6a4d, 0x6a51, 0x6a55, 0x6a58, 
-    /* 0x000024a0: */ 0x6a5c, 0x6a60, 0x6a64, 0x6a68, 0x6a6c, 0x6a6f, 0x6a73, 0x6a77, 0x6a7b, 0x6a7f, 0x6a82, 0x6a86, 0x6a8a, 0x6a8e, 0x6a92, 0x6a95, 
-    /* 0x000024c0: */ 0x6a99, 0x6a9d, 0x6aa1, 0x6aa5, 0x6aa8, 0x6aac, 0x6ab0, 0x6ab4, 0x6ab7, 0x6abb, 0x6abf, 0x6ac3, 0x6ac7, 0x6aca, 0x6ace, 0x6ad2, 
-    /* 0x000024e0: */ 0x6ad6, 0x6ada, 0x6add, 0x6ae1, 0x6ae5, 0x6ae9, 0x6aec, 0x6af0, 0x6af4, 0x6af8, 0x6afb, 0x6aff, 0x6b03, 0x6b07, 0x6b0a, 0x6b0e, 
-    /* 0x00002500: */ 0x6b12, 0x6b16, 0x6b1a, 0x6b1d, 0x6b21, 0x6b25, 0x6b29, 0x6b2c, 0x6b30, 0x6b34, 0x6b38, 0x6b3b, 0x6b3f, 0x6b43, 0x6b46, 0x6b4a, 
-    /* 0x00002520: */ 0x6b4e, 0x6b52, 0x6b55, 0x6b59, 0x6b5d, 0x6b61, 0x6b64, 0x6b68, 0x6b6c, 0x6b70, 0x6b73, 0x6b77, 0x6b7b, 0x6b7e, 0x6b82, 0x6b86, 
-    /* 0x00002540: */ 0x6b8a, 0x6b8d, 0x6b91, 0x6b95, 0x6b98, 0x6b9c, 0x6ba0, 0x6ba4, 0x6ba7, 0x6bab, 0x6baf, 0x6bb2, 0x6bb6, 0x6bba, 0x6bbe, 0x6bc1, 
-    /* 0x00002560: */ 0x6bc5, 0x6bc9, 0x6bcc, 0x6bd0, 0x6bd4, 0x6bd7, 0x6bdb, 0x6bdf, 0x6be2, 0x6be6, 0x6bea, 0x6bee, 0x6bf1, 0x6bf5, 0x6bf9, 0x6bfc, 
-    /* 0x00002580: */ 0x6c00, 0x6c04, 0x6c07, 0x6c0b, 0x6c0f, 0x6c12, 0x6c16, 0x6c1a, 0x6c1d, 0x6c21, 0x6c25, 0x6c28, 0x6c2c, 0x6c30, 0x6c33, 0x6c37, 
-    /* 0x000025a0: */ 0x6c3b, 0x6c3e, 0x6c42, 0x6c46, 0x6c49, 0x6c4d, 0x6c51, 0x6c54, 0x6c58, 0x6c5c, 0x6c5f, 0x6c63, 0x6c66, 0x6c6a, 0x6c6e, 0x6c71, 
-    /* 0x000025c0: */ 0x6c75, 0x6c79, 0x6c7c, 0x6c80, 0x6c84, 0x6c87, 0x6c8b, 0x6c8f, 0x6c92, 0x6c96, 0x6c99, 0x6c9d, 0x6ca1, 0x6ca4, 0x6ca8, 0x6cac, 
-    /* 0x000025e0: */ 0x6caf, 0x6cb3, 0x6cb6, 0x6cba, 0x6cbe, 0x6cc1, 0x6cc5, 0x6cc8, 0x6ccc, 0x6cd0, 0x6cd3, 0x6cd7, 0x6cdb, 0x6cde, 0x6ce2, 0x6ce5, 
-    /* 0x00002600: */ 0x6ce9, 0x6ced, 0x6cf0, 0x6cf4, 0x6cf7, 0x6cfb, 0x6cff, 0x6d02, 0x6d06, 0x6d09, 0x6d0d, 0x6d10, 0x6d14, 0x6d18, 0x6d1b, 0x6d1f, 
-    /* 0x00002620: */ 0x6d22, 0x6d26, 0x6d2a, 0x6d2d, 0x6d31, 0x6d34, 0x6d38, 0x6d3b, 0x6d3f, 0x6d43, 0x6d46, 0x6d4a, 0x6d4d, 0x6d51, 0x6d54, 0x6d58, 
-    /* 0x00002640: */ 0x6d5c, 0x6d5f, 0x6d63, 0x6d66, 0x6d6a, 0x6d6d, 0x6d71, 0x6d74, 0x6d78, 0x6d7c, 0x6d7f, 0x6d83, 0x6d86, 0x6d8a, 0x6d8d, 0x6d91, 
-    /* 0x00002660: */ 0x6d94, 0x6d98, 0x6d9b, 0x6d9f, 0x6da3, 0x6da6, 0x6daa, 0x6dad, 0x6db1, 0x6db4, 0x6db8, 0x6dbb, 0x6dbf, 0x6dc2, 0x6dc6, 0x6dc9, 
-    /* 0x00002680: */ 0x6dcd, 0x6dd0, 0x6dd4, 0x6dd7, 0x6ddb, 0x6ddf, 0x6de2, 0x6de6, 0x6de9, 0x6ded, 0x6df0, 0x6df4, 0x6df7, 0x6dfb, 0x6dfe, 0x6e02, 
-    /* 0x000026a0: */ 0x6e05, 0x6e09, 0x6e0c, 0x6e10, 0x6e13, 0x6e17, 0x6e1a, 0x6e1e, 0x6e21, 0x6e25, 0x6e28, 0x6e2c, 0x6e2f, 0x6e33, 0x6e36, 0x6e3a, 
-    /* 0x000026c0: */ 0x6e3d, 0x6e41, 0x6e44, 0x6e47, 0x6e4b, 0x6e4e, 0x6e52, 0x6e55, 0x6e59, 0x6e5c, 0x6e60, 0x6e63, 0x6e67, 0x6e6a, 0x6e6e, 0x6e71, 
-    /* 0x000026e0: */ 0x6e75, 0x6e78, 0x6e7c, 0x6e7f, 0x6e82, 0x6e86, 0x6e89, 0x6e8d, 0x6e90, 0x6e94, 0x6e97, 0x6e9b, 0x6e9e, 0x6ea2, 0x6ea5, 0x6ea8, 
-    /* 0x00002700: */ 0x6eac, 0x6eaf, 0x6eb3, 0x6eb6, 0x6eba, 0x6ebd, 0x6ec1, 0x6ec4, 0x6ec7, 0x6ecb, 0x6ece, 0x6ed2, 0x6ed5, 0x6ed9, 0x6edc, 0x6edf, 
-    /* 0x00002720: */ 0x6ee3, 0x6ee6, 0x6eea, 0x6eed, 0x6ef1, 0x6ef4, 0x6ef7, 0x6efb, 0x6efe, 0x6f02, 0x6f05, 0x6f08, 0x6f0c, 0x6f0f, 0x6f13, 0x6f16, 
-    /* 0x00002740: */ 0x6f19, 0x6f1d, 0x6f20, 0x6f24, 0x6f27, 0x6f2a, 0x6f2e, 0x6f31, 0x6f35, 0x6f38, 0x6f3b, 0x6f3f, 0x6f42, 0x6f46, 0x6f49, 0x6f4c, 
-    /* 0x00002760: */ 0x6f50, 0x6f53, 0x6f57, 0x6f5a, 0x6f5d, 0x6f61, 0x6f64, 0x6f67, 0x6f6b, 0x6f6e, 0x6f72, 0x6f75, 0x6f78, 0x6f7c, 0x6f7f, 0x6f82, 
-    /* 0x00002780: */ 0x6f86, 0x6f89, 0x6f8c, 0x6f90, 0x6f93, 0x6f97, 0x6f9a, 0x6f9d, 0x6fa1, 0x6fa4, 0x6fa7, 0x6fab, 0x6fae, 0x6fb1, 0x6fb5, 0x6fb8, 
-    /* 0x000027a0: */ 0x6fbb, 0x6fbf, 0x6fc2, 0x6fc5, 0x6fc9, 0x6fcc, 0x6fcf, 0x6fd3, 0x6fd6, 0x6fd9, 0x6fdd, 0x6fe0, 0x6fe3, 0x6fe7, 0x6fea, 0x6fed, 
-    /* 0x000027c0: */ 0x6ff1, 0x6ff4, 0x6ff7, 0x6ffb, 0x6ffe, 0x7001, 0x7005, 0x7008, 0x700b, 0x700f, 0x7012, 0x7015, 0x7019, 0x701c, 0x701f, 0x7023, 
-    /* 0x000027e0: */ 0x7026, 0x7029, 0x702c, 0x7030, 0x7033, 0x7036, 0x703a, 0x703d, 0x7040, 0x7043, 0x7047, 0x704a, 0x704d, 0x7051, 0x7054, 0x7057, 
-    /* 0x00002800: */ 0x705b, 0x705e, 0x7061, 0x7064, 0x7068, 0x706b, 0x706e, 0x7071, 0x7075, 0x7078, 0x707b, 0x707f, 0x7082, 0x7085, 0x7088, 0x708c, 
-    /* 0x00002820: */ 0x708f, 0x7092, 0x7095, 0x7099, 0x709c, 0x709f, 0x70a2, 0x70a6, 0x70a9, 0x70ac, 0x70af, 0x70b3, 0x70b6, 0x70b9, 0x70bc, 0x70c0, 
-    /* 0x00002840: */ 0x70c3, 0x70c6, 0x70c9, 0x70cd, 0x70d0, 0x70d3, 0x70d6, 0x70da, 0x70dd, 0x70e0, 0x70e3, 0x70e7, 0x70ea, 0x70ed, 0x70f0, 0x70f3, 
-    /* 0x00002860: */ 0x70f7, 0x70fa, 0x70fd, 0x7100, 0x7104, 0x7107, 0x710a, 0x710d, 0x7110, 0x7114, 0x7117, 0x711a, 0x711d, 0x7120, 0x7124, 0x7127, 
-    /* 0x00002880: */ 0x712a, 0x712d, 0x7131, 0x7134, 0x7137, 0x713a, 0x713d, 0x7141, 0x7144, 0x7147, 0x714a, 0x714d, 0x7150, 0x7154, 0x7157, 0x715a, 
-    /* 0x000028a0: */ 0x715d, 0x7160, 0x7164, 0x7167, 0x716a, 0x716d, 0x7170, 0x7173, 0x7177, 0x717a, 0x717d, 0x7180, 0x7183, 0x7186, 0x718a, 0x718d, 
-    /* 0x000028c0: */ 0x7190, 0x7193, 0x7196, 0x7199, 0x719d, 0x71a0, 0x71a3, 0x71a6, 0x71a9, 0x71ac, 0x71b0, 0x71b3, 0x71b6, 0x71b9, 0x71bc, 0x71bf, 
-    /* 0x000028e0: */ 0x71c2, 0x71c6, 0x71c9, 0x71cc, 0x71cf, 0x71d2, 0x71d5, 0x71d8, 0x71db, 0x71df, 0x71e2, 0x71e5, 0x71e8, 0x71eb, 0x71ee, 0x71f1, 
-    /* 0x00002900: */ 0x71f5, 0x71f8, 0x71fb, 0x71fe, 0x7201, 0x7204, 0x7207, 0x720a, 0x720d, 0x7211, 0x7214, 0x7217, 0x721a, 0x721d, 0x7220, 0x7223, 
-    /* 0x00002920: */ 0x7226, 0x7229, 0x722c, 0x7230, 0x7233, 0x7236, 0x7239, 0x723c, 0x723f, 0x7242, 0x7245, 0x7248, 0x724b, 0x724f, 0x7252, 0x7255, 
-    /* 0x00002940: */ 0x7258, 0x725b, 0x725e, 0x7261, 0x7264, 0x7267, 0x726a, 0x726d, 0x7270, 0x7273, 0x7276, 0x727a, 0x727d, 0x7280, 0x7283, 0x7286, 
-    /* 0x00002960: */ 0x7289, 0x728c, 0x728f, 0x7292, 0x7295, 0x7298, 0x729b, 0x729e, 0x72a1, 0x72a4, 0x72a7, 0x72aa, 0x72ae, 0x72b1, 0x72b4, 0x72b7, 
-    /* 0x00002980: */ 0x72ba, 0x72bd, 0x72c0, 0x72c3, 0x72c6, 0x72c9, 0x72cc, 0x72cf, 0x72d2, 0x72d5, 0x72d8, 0x72db, 0x72de, 0x72e1, 0x72e4, 0x72e7, 
-    /* 0x000029a0: */ 0x72ea, 0x72ed, 0x72f0, 0x72f3, 0x72f6, 0x72f9, 0x72fc, 0x72ff, 0x7302, 0x7305, 0x7308, 0x730b, 0x730e, 0x7311, 0x7314, 0x7317, 
-    /* 0x000029c0: */ 0x731a, 0x731d, 0x7320, 0x7323, 0x7326, 0x7329, 0x732c, 0x732f, 0x7332, 0x7335, 0x7338, 0x733b, 0x733e, 0x7341, 0x7344, 0x7347, 
-    /* 0x000029e0: */ 0x734a, 0x734d, 0x7350, 0x7353, 0x7356, 0x7359, 0x735c, 0x735f, 0x7362, 0x7365, 0x7368, 0x736b, 0x736e, 0x7371, 0x7374, 0x7377, 
-    /* 0x00002a00: */ 0x737a, 0x737d, 0x737f, 0x7382, 0x7385, 0x7388, 0x738b, 0x738e, 0x7391, 0x7394, 0x7397, 0x739a, 0x739d, 0x73a0, 0x73a3, 0x73a6, 
-    /* 0x00002a20: */ 0x73a9, 0x73ac, 0x73af, 0x73b2, 0x73b4, 0x73b7, 0x73ba, 0x73bd, 0x73c0, 0x73c3, 0x73c6, 0x73c9, 0x73cc, 0x73cf, 0x73d2, 0x73d5, 
-    /* 0x00002a40: */ 0x73d8, 0x73da, 0x73dd, 0x73e0, 0x73e3, 0x73e6, 0x73e9, 0x73ec, 0x73ef, 0x73f2, 0x73f5, 0x73f8, 0x73fa, 0x73fd, 0x7400, 0x7403, 
-    /* 0x00002a60: */ 0x7406, 0x7409, 0x740c, 0x740f, 0x7412, 0x7414, 0x7417, 0x741a, 0x741d, 0x7420, 0x7423, 0x7426, 0x7429, 0x742c, 0x742e, 0x7431, 
-    /* 0x00002a80: */ 0x7434, 0x7437, 0x743a, 0x743d, 0x7440, 0x7443, 0x7445, 0x7448, 0x744b, 0x744e, 0x7451, 0x7454, 0x7457, 0x7459, 0x745c, 0x745f, 
-    /* 0x00002aa0: */ 0x7462, 0x7465, 0x7468, 0x746b, 0x746d, 0x7470, 0x7473, 0x7476, 0x7479, 0x747c, 0x747e, 0x7481, 0x7484, 0x7487, 0x748a, 0x748d, 
-    /* 0x00002ac0: */ 0x748f, 0x7492, 0x7495, 0x7498, 0x749b, 0x749e, 0x74a0, 0x74a3, 0x74a6, 0x74a9, 0x74ac, 0x74af, 0x74b1, 0x74b4, 0x74b7, 0x74ba, 
-    /* 0x00002ae0: */ 0x74bd, 0x74bf, 0x74c2, 0x74c5, 0x74c8, 0x74cb, 0x74cd, 0x74d0, 0x74d3, 0x74d6, 0x74d9, 0x74db, 0x74de, 0x74e1, 0x74e4, 0x74e7, 
-    /* 0x00002b00: */ 0x74e9, 0x74ec, 0x74ef, 0x74f2, 0x74f5, 0x74f7, 0x74fa, 0x74fd, 0x7500, 0x7503, 0x7505, 0x7508, 0x750b, 0x750e, 0x7510, 0x7513, 
-    /* 0x00002b20: */ 0x7516, 0x7519, 0x751b, 0x751e, 0x7521, 0x7524, 0x7527, 0x7529, 0x752c, 0x752f, 0x7532, 0x7534, 0x7537, 0x753a, 0x753d, 0x753f, 
-    /* 0x00002b40: */ 0x7542, 0x7545, 0x7548, 0x754a, 0x754d, 0x7550, 0x7553, 0x7555, 0x7558, 0x755b, 0x755e, 0x7560, 0x7563, 0x7566, 0x7568, 0x756b, 
-    /* 0x00002b60: */ 0x756e, 0x7571, 0x7573, 0x7576, 0x7579, 0x757c, 0x757e, 0x7581, 0x7584, 0x7586, 0x7589, 0x758c, 0x758f, 0x7591, 0x7594, 0x7597, 
-    /* 0x00002b80: */ 0x7599, 0x759c, 0x759f, 0x75a1, 0x75a4, 0x75a7, 0x75aa, 0x75ac, 0x75af, 0x75b2, 0x75b4, 0x75b7, 0x75ba, 0x75bc, 0x75bf, 0x75c2, 
-    /* 0x00002ba0: */ 0x75c4, 0x75c7, 0x75ca, 0x75cd, 0x75cf, 0x75d2, 0x75d5, 0x75d7, 0x75da, 0x75dd, 0x75df, 0x75e2, 0x75e5, 0x75e7, 0x75ea, 0x75ed, 
-    /* 0x00002bc0: */ 0x75ef, 0x75f2, 0x75f5, 0x75f7, 0x75fa, 0x75fd, 0x75ff, 0x7602, 0x7605, 0x7607, 0x760a, 0x760d, 0x760f, 0x7612, 0x7614, 0x7617, 
-    /* 0x00002be0: */ 0x761a, 0x761c, 0x761f, 0x7622, 0x7624, 0x7627, 0x762a, 0x762c, 0x762f, 0x7631, 0x7634, 0x7637, 0x7639, 0x763c, 0x763f, 0x7641, 
-    /* 0x00002c00: */ 0x7644, 0x7646, 0x7649, 0x764c, 0x764e, 0x7651, 0x7654, 0x7656, 0x7659, 0x765b, 0x765e, 0x7661, 0x7663, 0x7666, 0x7668, 0x766b, 
-    /* 0x00002c20: */ 0x766e, 0x7670, 0x7673, 0x7675, 0x7678, 0x767b, 0x767d, 0x7680, 0x7682, 0x7685, 0x7688, 0x768a, 0x768d, 0x768f, 0x7692, 0x7695, 
-    /* 0x00002c40: */ 0x7697, 0x769a, 0x769c, 0x769f, 0x76a1, 0x76a4, 0x76a7, 0x76a9, 0x76ac, 0x76ae, 0x76b1, 0x76b3, 0x76b6, 0x76b9, 0x76bb, 0x76be, 
-    /* 0x00002c60: */ 0x76c0, 0x76c3, 0x76c5, 0x76c8, 0x76ca, 0x76cd, 0x76d0, 0x76d2, 0x76d5, 0x76d7, 0x76da, 0x76dc, 0x76df, 0x76e1, 0x76e4, 0x76e6, 
-    /* 0x00002c80: */ 0x76e9, 0x76eb, 0x76ee, 0x76f1, 0x76f3, 0x76f6, 0x76f8, 0x76fb, 0x76fd, 0x7700, 0x7702, 0x7705, 0x7707, 0x770a, 0x770c, 0x770f, 
-    /* 0x00002ca0: */ 0x7711, 0x7714, 0x7716, 0x7719, 0x771b, 0x771e, 0x7720, 0x7723, 0x7725, 0x7728, 0x772a, 0x772d, 0x772f, 0x7732, 0x7734, 0x7737, 
-    /* 0x00002cc0: */ 0x7739, 0x773c, 0x773e, 0x7741, 0x7743, 0x7746, 0x7748, 0x774b, 0x774d, 0x7750, 0x7752, 0x7755, 0x7757, 0x775a, 0x775c, 0x775f, 
-    /* 0x00002ce0: */ 0x7761, 0x7764, 0x7766, 0x7769, 0x776b, 0x776e, 0x7770, 0x7772, 0x7775, 0x7777, 0x777a, 0x777c, 0x777f, 0x7781, 0x7784, 0x7786, 
-    /* 0x00002d00: */ 0x7789, 0x778b, 0x778d, 0x7790, 0x7792, 0x7795, 0x7797, 0x779a, 0x779c, 0x779f, 0x77a1, 0x77a3, 0x77a6, 0x77a8, 0x77ab, 0x77ad, 
-    /* 0x00002d20: */ 0x77b0, 0x77b2, 0x77b4, 0x77b7, 0x77b9, 0x77bc, 0x77be, 0x77c1, 0x77c3, 0x77c5, 0x77c8, 0x77ca, 0x77cd, 0x77cf, 0x77d1, 0x77d4, 
-    /* 0x00002d40: */ 0x77d6, 0x77d9, 0x77db, 0x77de, 0x77e0, 0x77e2, 0x77e5, 0x77e7, 0x77ea, 0x77ec, 0x77ee, 0x77f1, 0x77f3, 0x77f6, 0x77f8, 0x77fa, 
-    /* 0x00002d60: */ 0x77fd, 0x77ff, 0x7801, 0x7804, 0x7806, 0x7809, 0x780b, 0x780d, 0x7810, 0x7812, 0x7814, 0x7817, 0x7819, 0x781c, 0x781e, 0x7820, 
-    /* 0x00002d80: */ 0x7823, 0x7825, 0x7827, 0x782a, 0x782c, 0x782e, 0x7831, 0x7833, 0x7836, 0x7838, 0x783a, 0x783d, 0x783f, 0x7841, 0x7844, 0x7846, 
-    /* 0x00002da0: */ 0x7848, 0x784b, 0x784d, 0x784f, 0x7852, 0x7854, 0x7856, 0x7859, 0x785b, 0x785d, 0x7860, 0x7862, 0x7864, 0x7867, 0x7869, 0x786b, 
-    /* 0x00002dc0: */ 0x786e, 0x7870, 0x7872, 0x7875, 0x7877, 0x7879, 0x787c, 0x787e, 0x7880, 0x7883, 0x7885, 0x7887, 0x7889, 0x788c, 0x788e, 0x7890, 
-    /* 0x00002de0: */ 0x7893, 0x7895, 0x7897, 0x789a, 0x789c, 0x789e, 0x78a0, 0x78a3, 0x78a5, 0x78a7, 0x78aa, 0x78ac, 0x78ae, 0x78b0, 0x78b3, 0x78b5, 
-    /* 0x00002e00: */ 0x78b7, 0x78ba, 0x78bc, 0x78be, 0x78c0, 0x78c3, 0x78c5, 0x78c7, 0x78c9, 0x78cc, 0x78ce, 0x78d0, 0x78d3, 0x78d5, 0x78d7, 0x78d9, 
-    /* 0x00002e20: */ 0x78dc, 0x78de, 0x78e0, 0x78e2, 0x78e5, 0x78e7, 0x78e9, 0x78eb, 0x78ee, 0x78f0, 0x78f2, 0x78f4, 0x78f7, 0x78f9, 0x78fb, 0x78fd, 
-    /* 0x00002e40: */ 0x7900, 0x7902, 0x7904, 0x7906, 0x7908, 0x790b, 0x790d, 0x790f, 0x7911, 0x7914, 0x7916, 0x7918, 0x791a, 0x791c, 0x791f, 0x7921, 
-    /* 0x00002e60: */ 0x7923, 0x7925, 0x7928, 0x792a, 0x792c, 0x792e, 0x7930, 0x7933, 0x7935, 0x7937, 0x7939, 0x793b, 0x793e, 0x7940, 0x7942, 0x7944, 
-    /* 0x00002e80: */ 0x7946, 0x7949, 0x794b, 0x794d, 0x794f, 0x7951, 0x7954, 0x7956, 0x7958, 0x795a, 0x795c, 0x795e, 0x7961, 0x7963, 0x7965, 0x7967, 
-    /* 0x00002ea0: */ 0x7969, 0x796b, 0x796e, 0x7970, 0x7972, 0x7974, 0x7976, 0x7978, 0x797b, 0x797d, 0x797f, 0x7981, 0x7983, 0x7985, 0x7988, 0x798a, 
-    /* 0x00002ec0: */ 0x798c, 0x798e, 0x7990, 0x7992, 0x7994, 0x7997, 0x7999, 0x799b, 0x799d, 0x799f, 0x79a1, 0x79a3, 0x79a6, 0x79a8, 0x79aa, 0x79ac, 
-    /* 0x00002ee0: */ 0x79ae, 0x79b0, 0x79b2, 0x79b4, 0x79b7, 0x79b9, 0x79bb, 0x79bd, 0x79bf, 0x79c1, 0x79c3, 0x79c5, 0x79c7, 0x79ca, 0x79cc, 0x79ce, 
-    /* 0x00002f00: */ 0x79d0, 0x79d2, 0x79d4, 0x79d6, 0x79d8, 0x79da, 0x79dc, 0x79df, 0x79e1, 0x79e3, 0x79e5, 0x79e7, 0x79e9, 0x79eb, 0x79ed, 0x79ef, 
-    /* 0x00002f20: */ 0x79f1, 0x79f3, 0x79f6, 0x79f8, 0x79fa, 0x79fc, 0x79fe, 0x7a00, 0x7a02, 0x7a04, 0x7a06, 0x7a08, 0x7a0a, 0x7a0c, 0x7a0e, 0x7a10, 
-    /* 0x00002f40: */ 0x7a13, 0x7a15, 0x7a17, 0x7a19, 0x7a1b, 0x7a1d, 0x7a1f, 0x7a21, 0x7a23, 0x7a25, 0x7a27, 0x7a29, 0x7a2b, 0x7a2d, 0x7a2f, 0x7a31, 
-    /* 0x00002f60: */ 0x7a33, 0x7a35, 0x7a37, 0x7a39, 0x7a3b, 0x7a3e, 0x7a40, 0x7a42, 0x7a44, 0x7a46, 0x7a48, 0x7a4a, 0x7a4c, 0x7a4e, 0x7a50, 0x7a52, 
-    /* 0x00002f80: */ 0x7a54, 0x7a56, 0x7a58, 0x7a5a, 0x7a5c, 0x7a5e, 0x7a60, 0x7a62, 0x7a64, 0x7a66, 0x7a68, 0x7a6a, 0x7a6c, 0x7a6e, 0x7a70, 0x7a72, 
-    /* 0x00002fa0: */ 0x7a74, 0x7a76, 0x7a78, 0x7a7a, 0x7a7c, 0x7a7e, 0x7a80, 0x7a82, 0x7a84, 0x7a86, 0x7a88, 0x7a8a, 0x7a8c, 0x7a8e, 0x7a90, 0x7a92, 
-    /* 0x00002fc0: */ 0x7a94, 0x7a96, 0x7a98, 0x7a9a, 0x7a9c, 0x7a9e, 0x7a9f, 0x7aa1, 0x7aa3, 0x7aa5, 0x7aa7, 0x7aa9, 0x7aab, 0x7aad, 0x7aaf, 0x7ab1, 
-    /* 0x00002fe0: */ 0x7ab3, 0x7ab5, 0x7ab7, 0x7ab9, 0x7abb, 0x7abd, 0x7abf, 0x7ac1, 0x7ac3, 0x7ac5, 0x7ac7, 0x7ac8, 0x7aca, 0x7acc, 0x7ace, 0x7ad0, 
-    /* 0x00003000: */ 0x7ad2, 0x7ad4, 0x7ad6, 0x7ad8, 0x7ada, 0x7adc, 0x7ade, 0x7ae0, 0x7ae1, 0x7ae3, 0x7ae5, 0x7ae7, 0x7ae9, 0x7aeb, 0x7aed, 0x7aef, 
-    /* 0x00003020: */ 0x7af1, 0x7af3, 0x7af5, 0x7af7, 0x7af8, 0x7afa, 0x7afc, 0x7afe, 0x7b00, 0x7b02, 0x7b04, 0x7b06, 0x7b08, 0x7b09, 0x7b0b, 0x7b0d, 
-    /* 0x00003040: */ 0x7b0f, 0x7b11, 0x7b13, 0x7b15, 0x7b17, 0x7b19, 0x7b1a, 0x7b1c, 0x7b1e, 0x7b20, 0x7b22, 0x7b24, 0x7b26, 0x7b28, 0x7b29, 0x7b2b, 
-    /* 0x00003060: */ 0x7b2d, 0x7b2f, 0x7b31, 0x7b33, 0x7b35, 0x7b36, 0x7b38, 0x7b3a, 0x7b3c, 0x7b3e, 0x7b40, 0x7b42, 0x7b43, 0x7b45, 0x7b47, 0x7b49, 
-    /* 0x00003080: */ 0x7b4b, 0x7b4d, 0x7b4e, 0x7b50, 0x7b52, 0x7b54, 0x7b56, 0x7b58, 0x7b59, 0x7b5b, 0x7b5d, 0x7b5f, 0x7b61, 0x7b63, 0x7b64, 0x7b66, 
-    /* 0x000030a0: */ 0x7b68, 0x7b6a, 0x7b6c, 0x7b6d, 0x7b6f, 0x7b71, 0x7b73, 0x7b75, 0x7b77, 0x7b78, 0x7b7a, 0x7b7c, 0x7b7e, 0x7b80, 0x7b81, 0x7b83, 
-    /* 0x000030c0: */ 0x7b85, 0x7b87, 0x7b89, 0x7b8a, 0x7b8c, 0x7b8e, 0x7b90, 0x7b92, 0x7b93, 0x7b95, 0x7b97, 0x7b99, 0x7b9a, 0x7b9c, 0x7b9e, 0x7ba0, 
-    /* 0x000030e0: */ 0x7ba2, 0x7ba3, 0x7ba5, 0x7ba7, 0x7ba9, 0x7baa, 0x7bac, 0x7bae, 0x7bb0, 0x7bb1, 0x7bb3, 0x7bb5, 0x7bb7, 0x7bb9, 0x7bba, 0x7bbc, 
-    /* 0x00003100: */ 0x7bbe, 0x7bc0, 0x7bc1, 0x7bc3, 0x7bc5, 0x7bc7, 0x7bc8, 0x7bca, 0x7bcc, 0x7bcd, 0x7bcf, 0x7bd1, 0x7bd3, 0x7bd4, 0x7bd6, 0x7bd8, 
-    /* 0x00003120: */ 0x7bda, 0x7bdb, 0x7bdd, 0x7bdf, 0x7be1, 0x7be2, 0x7be4, 0x7be6, 0x7be7, 0x7be9, 0x7beb, 0x7bed, 0x7bee, 0x7bf0, 0x7bf2, 0x7bf3, 
-    /* 0x00003140: */ 0x7bf5, 0x7bf7, 0x7bf9, 0x7bfa, 0x7bfc, 0x7bfe, 0x7bff, 0x7c01, 0x7c03, 0x7c04, 0x7c06, 0x7c08, 0x7c0a, 0x7c0b, 0x7c0d, 0x7c0f, 
-    /* 0x00003160: */ 0x7c10, 0x7c12, 0x7c14, 0x7c15, 0x7c17, 0x7c19, 0x7c1a, 0x7c1c, 0x7c1e, 0x7c1f, 0x7c21, 0x7c23, 0x7c24, 0x7c26, 0x7c28, 0x7c29, 
-    /* 0x00003180: */ 0x7c2b, 0x7c2d, 0x7c2e, 0x7c30, 0x7c32, 0x7c33, 0x7c35, 0x7c37, 0x7c38, 0x7c3a, 0x7c3c, 0x7c3d, 0x7c3f, 0x7c41, 0x7c42, 0x7c44, 
-    /* 0x000031a0: */ 0x7c46, 0x7c47, 0x7c49, 0x7c4a, 0x7c4c, 0x7c4e, 0x7c4f, 0x7c51, 0x7c53, 0x7c54, 0x7c56, 0x7c58, 0x7c59, 0x7c5b, 0x7c5c, 0x7c5e, 
-    /* 0x000031c0: */ 0x7c60, 0x7c61, 0x7c63, 0x7c64, 0x7c66, 0x7c68, 0x7c69, 0x7c6b, 0x7c6d, 0x7c6e, 0x7c70, 0x7c71, 0x7c73, 0x7c75, 0x7c76, 0x7c78, 
-    /* 0x000031e0: */ 0x7c79, 0x7c7b, 0x7c7d, 0x7c7e, 0x7c80, 0x7c81, 0x7c83, 0x7c84, 0x7c86, 0x7c88, 0x7c89, 0x7c8b, 0x7c8c, 0x7c8e, 0x7c90, 0x7c91, 
-    /* 0x00003200: */ 0x7c93, 0x7c94, 0x7c96, 0x7c97, 0x7c99, 0x7c9b, 0x7c9c, 0x7c9e, 0x7c9f, 0x7ca1, 0x7ca2, 0x7ca4, 0x7ca6, 0x7ca7, 0x7ca9, 0x7caa, 
-    /* 0x00003220: */ 0x7cac, 0x7cad, 0x7caf, 0x7cb0, 0x7cb2, 0x7cb3, 0x7cb5, 0x7cb7, 0x7cb8, 0x7cba, 0x7cbb, 0x7cbd, 0x7cbe, 0x7cc0, 0x7cc1, 0x7cc3, 
-    /* 0x00003240: */ 0x7cc4, 0x7cc6, 0x7cc7, 0x7cc9, 0x7cca, 0x7ccc, 0x7cce, 0x7ccf, 0x7cd1, 0x7cd2, 0x7cd4, 0x7cd5, 0x7cd7, 0x7cd8, 0x7cda, 0x7cdb, 
-    /* 0x00003260: */ 0x7cdd, 0x7cde, 0x7ce0, 0x7ce1, 0x7ce3, 0x7ce4, 0x7ce6, 0x7ce7, 0x7ce9, 0x7cea, 0x7cec, 0x7ced, 0x7cef, 0x7cf0, 0x7cf2, 0x7cf3, 
-    /* 0x00003280: */ 0x7cf5, 0x7cf6, 0x7cf8, 0x7cf9, 0x7cfb, 0x7cfc, 0x7cfe, 0x7cff, 0x7d00, 0x7d02, 0x7d03, 0x7d05, 0x7d06, 0x7d08, 0x7d09, 0x7d0b, 
-    /* 0x000032a0: */ 0x7d0c, 0x7d0e, 0x7d0f, 0x7d11, 0x7d12, 0x7d13, 0x7d15, 0x7d16, 0x7d18, 0x7d19, 0x7d1b, 0x7d1c, 0x7d1e, 0x7d1f, 0x7d21, 0x7d22, 
-    /* 0x000032c0: */ 0x7d23, 0x7d25, 0x7d26, 0x7d28, 0x7d29, 0x7d2b, 0x7d2c, 0x7d2d, 0x7d2f, 0x7d30, 0x7d32, 0x7d33, 0x7d35, 0x7d36, 0x7d37, 0x7d39, 
-    /* 0x000032e0: */ 0x7d3a, 0x7d3c, 0x7d3d, 0x7d3f, 0x7d40, 0x7d41, 0x7d43, 0x7d44, 0x7d46, 0x7d47, 0x7d48, 0x7d4a, 0x7d4b, 0x7d4d, 0x7d4e, 0x7d4f, 
-    /* 0x00003300: */ 0x7d51, 0x7d52, 0x7d54, 0x7d55, 0x7d56, 0x7d58, 0x7d59, 0x7d5b, 0x7d5c, 0x7d5d, 0x7d5f, 0x7d60, 0x7d61, 0x7d63, 0x7d64, 0x7d66, 
-    /* 0x00003320: */ 0x7d67, 0x7d68, 0x7d6a, 0x7d6b, 0x7d6c, 0x7d6e, 0x7d6f, 0x7d71, 0x7d72, 0x7d73, 0x7d75, 0x7d76, 0x7d77, 0x7d79, 0x7d7a, 0x7d7b, 
-    /* 0x00003340: */ 0x7d7d, 0x7d7e, 0x7d7f, 0x7d81, 0x7d82, 0x7d83, 0x7d85, 0x7d86, 0x7d87, 0x7d89, 0x7d8a, 0x7d8b, 0x7d8d, 0x7d8e, 0x7d8f, 0x7d91, 
-    /* 0x00003360: */ 0x7d92, 0x7d93, 0x7d95, 0x7d96, 0x7d97, 0x7d99, 0x7d9a, 0x7d9b, 0x7d9d, 0x7d9e, 0x7d9f, 0x7da1, 0x7da2, 0x7da3, 0x7da5, 0x7da6, 
-    /* 0x00003380: */ 0x7da7, 0x7da9, 0x7daa, 0x7dab, 0x7dac, 0x7dae, 0x7daf, 0x7db0, 0x7db2, 0x7db3, 0x7db4, 0x7db5, 0x7db7, 0x7db8, 0x7db9, 0x7dbb, 
-    /* 0x000033a0: */ 0x7dbc, 0x7dbd, 0x7dbe, 0x7dc0, 0x7dc1, 0x7dc2, 0x7dc4, 0x7dc5, 0x7dc6, 0x7dc7, 0x7dc9, 0x7dca, 0x7dcb, 0x7dcc, 0x7dce, 0x7dcf, 
-    /* 0x000033c0: */ 0x7dd0, 0x7dd2, 0x7dd3, 0x7dd4, 0x7dd5, 0x7dd7, 0x7dd8, 0x7dd9, 0x7dda, 0x7ddc, 0x7ddd, 0x7dde, 0x7ddf, 0x7de1, 0x7de2, 0x7de3, 
-    /* 0x000033e0: */ 0x7de4, 0x7de5, 0x7de7, 0x7de8, 0x7de9, 0x7dea, 0x7dec, 0x7ded, 0x7dee, 0x7def, 0x7df1, 0x7df2, 0x7df3, 0x7df4, 0x7df5, 0x7df7, 
-    /* 0x00003400: */ 0x7df8, 0x7df9, 0x7dfa, 0x7dfb, 0x7dfd, 0x7dfe, 0x7dff, 0x7e00, 0x7e02, 0x7e03, 0x7e04, 0x7e05, 0x7e06, 0x7e08, 0x7e09, 0x7e0a, 
-    /* 0x00003420: */ 0x7e0b, 0x7e0c, 0x7e0d, 0x7e0f, 0x7e10, 0x7e11, 0x7e12, 0x7e13, 0x7e15, 0x7e16, 0x7e17, 0x7e18, 0x7e19, 0x7e1a, 0x7e1c, 0x7e1d, 
-    /* 0x00003440: */ 0x7e1e, 0x7e1f, 0x7e20, 0x7e22, 0x7e23, 0x7e24, 0x7e25, 0x7e26, 0x7e27, 0x7e28, 0x7e2a, 0x7e2b, 0x7e2c, 0x7e2d, 0x7e2e, 0x7e2f, 
-    /* 0x00003460: */ 0x7e31, 0x7e32, 0x7e33, 0x7e34, 0x7e35, 0x7e36, 0x7e37, 0x7e39, 0x7e3a, 0x7e3b, 0x7e3c, 0x7e3d, 0x7e3e, 0x7e3f, 0x7e40, 0x7e42, 
-    /* 0x00003480: */ 0x7e43, 0x7e44, 0x7e45, 0x7e46, 0x7e47, 0x7e48, 0x7e49, 0x7e4b, 0x7e4c, 0x7e4d, 0x7e4e, 0x7e4f, 0x7e50, 0x7e51, 0x7e52, 0x7e53, 
-    /* 0x000034a0: */ 0x7e55, 0x7e56, 0x7e57, 0x7e58, 0x7e59, 0x7e5a, 0x7e5b, 0x7e5c, 0x7e5d, 0x7e5e, 0x7e5f, 0x7e61, 0x7e62, 0x7e63, 0x7e64, 0x7e65, 
-    /* 0x000034c0: */ 0x7e66, 0x7e67, 0x7e68, 0x7e69, 0x7e6a, 0x7e6b, 0x7e6c, 0x7e6d, 0x7e6f, 0x7e70, 0x7e71, 0x7e72, 0x7e73, 0x7e74, 0x7e75, 0x7e76, 
-    /* 0x000034e0: */ 0x7e77, 0x7e78, 0x7e79, 0x7e7a, 0x7e7b, 0x7e7c, 0x7e7d, 0x7e7e, 0x7e7f, 0x7e81, 0x7e82, 0x7e83, 0x7e84, 0x7e85, 0x7e86, 0x7e87, 
-    /* 0x00003500: */ 0x7e88, 0x7e89, 0x7e8a, 0x7e8b, 0x7e8c, 0x7e8d, 0x7e8e, 0x7e8f, 0x7e90, 0x7e91, 0x7e92, 0x7e93, 0x7e94, 0x7e95, 0x7e96, 0x7e97, 
-    /* 0x00003520: */ 0x7e98, 0x7e99, 0x7e9a, 0x7e9b, 0x7e9c, 0x7e9d, 0x7e9e, 0x7e9f, 0x7ea0, 0x7ea1, 0x7ea2, 0x7ea3, 0x7ea4, 0x7ea5, 0x7ea6, 0x7ea7, 
-    /* 0x00003540: */ 0x7ea8, 0x7ea9, 0x7eaa, 0x7eab, 0x7eac, 0x7ead, 0x7eae, 0x7eaf, 0x7eb0, 0x7eb1, 0x7eb2, 0x7eb3, 0x7eb4, 0x7eb5, 0x7eb6, 0x7eb7, 
-    /* 0x00003560: */ 0x7eb8, 0x7eb9, 0x7eba, 0x7ebb, 0x7ebc, 0x7ebd, 0x7ebe, 0x7ebe, 0x7ebf, 0x7ec0, 0x7ec1, 0x7ec2, 0x7ec3, 0x7ec4, 0x7ec5, 0x7ec6, 
-    /* 0x00003580: */ 0x7ec7, 0x7ec8, 0x7ec9, 0x7eca, 0x7ecb, 0x7ecc, 0x7ecd, 0x7ece, 0x7ecf, 0x7ecf, 0x7ed0, 0x7ed1, 0x7ed2, 0x7ed3, 0x7ed4, 0x7ed5, 
-    /* 0x000035a0: */ 0x7ed6, 0x7ed7, 0x7ed8, 0x7ed9, 0x7eda, 0x7edb, 0x7edb, 0x7edc, 0x7edd, 0x7ede, 0x7edf, 0x7ee0, 0x7ee1, 0x7ee2, 0x7ee3, 0x7ee4, 
-    /* 0x000035c0: */ 0x7ee4, 0x7ee5, 0x7ee6, 0x7ee7, 0x7ee8, 0x7ee9, 0x7eea, 0x7eeb, 0x7eec, 0x7eed, 0x7eed, 0x7eee, 0x7eef, 0x7ef0, 0x7ef1, 0x7ef2, 
-    /* 0x000035e0: */ 0x7ef3, 0x7ef4, 0x7ef4, 0x7ef5, 0x7ef6, 0x7ef7, 0x7ef8, 0x7ef9, 0x7efa, 0x7efa, 0x7efb, 0x7efc, 0x7efd, 0x7efe, 0x7eff, 0x7f00, 
-    /* 0x00003600: */ 0x7f00, 0x7f01, 0x7f02, 0x7f03, 0x7f04, 0x7f05, 0x7f06, 0x7f06, 0x7f07, 0x7f08, 0x7f09, 0x7f0a, 0x7f0b, 0x7f0b, 0x7f0c, 0x7f0d, 
-    /* 0x00003620: */ 0x7f0e, 0x7f0f, 0x7f10, 0x7f10, 0x7f11, 0x7f12, 0x7f13, 0x7f14, 0x7f15, 0x7f15, 0x7f16, 0x7f17, 0x7f18, 0x7f19, 0x7f19, 0x7f1a, 
-    /* 0x00003640: */ 0x7f1b, 0x7f1c, 0x7f1d, 0x7f1d, 0x7f1e, 0x7f1f, 0x7f20, 0x7f21, 0x7f21, 0x7f22, 0x7f23, 0x7f24, 0x7f25, 0x7f25, 0x7f26, 0x7f27, 
-    /* 0x00003660: */ 0x7f28, 0x7f29, 0x7f29, 0x7f2a, 0x7f2b, 0x7f2c, 0x7f2c, 0x7f2d, 0x7f2e, 0x7f2f, 0x7f30, 0x7f30, 0x7f31, 0x7f32, 0x7f33, 0x7f33, 
-    /* 0x00003680: */ 0x7f34, 0x7f35, 0x7f36, 0x7f36, 0x7f37, 0x7f38, 0x7f39, 0x7f39, 0x7f3a, 0x7f3b, 0x7f3c, 0x7f3c, 0x7f3d, 0x7f3e, 0x7f3f, 0x7f3f, 
-    /* 0x000036a0: */ 0x7f40, 0x7f41, 0x7f42, 0x7f42, 0x7f43, 0x7f44, 0x7f44, 0x7f45, 0x7f46, 0x7f47, 0x7f47, 0x7f48, 0x7f49, 0x7f4a, 0x7f4a, 0x7f4b, 
-    /* 0x000036c0: */ 0x7f4c, 0x7f4c, 0x7f4d, 0x7f4e, 0x7f4f, 0x7f4f, 0x7f50, 0x7f51, 0x7f51, 0x7f52, 0x7f53, 0x7f53, 0x7f54, 0x7f55, 0x7f56, 0x7f56, 
-    /* 0x000036e0: */ 0x7f57, 0x7f58, 0x7f58, 0x7f59, 0x7f5a, 0x7f5a, 0x7f5b, 0x7f5c, 0x7f5c, 0x7f5d, 0x7f5e, 0x7f5f, 0x7f5f, 0x7f60, 0x7f61, 0x7f61, 
-    /* 0x00003700: */ 0x7f62, 0x7f63, 0x7f63, 0x7f64, 0x7f65, 0x7f65, 0x7f66, 0x7f67, 0x7f67, 0x7f68, 0x7f68, 0x7f69, 0x7f6a, 0x7f6a, 0x7f6b, 0x7f6c, 
-    /* 0x00003720: */ 0x7f6c, 0x7f6d, 0x7f6e, 0x7f6e, 0x7f6f, 0x7f70, 0x7f70, 0x7f71, 0x7f72, 0x7f72, 0x7f73, 0x7f73, 0x7f74, 0x7f75, 0x7f75, 0x7f76, 
-    /* 0x00003740: */ 0x7f77, 0x7f77, 0x7f78, 0x7f78, 0x7f79, 0x7f7a, 0x7f7a, 0x7f7b, 0x7f7c, 0x7f7c, 0x7f7d, 0x7f7d, 0x7f7e, 0x7f7f, 0x7f7f, 0x7f80, 
-    /* 0x00003760: */ 0x7f80, 0x7f81, 0x7f82, 0x7f82, 0x7f83, 0x7f83, 0x7f84, 0x7f85, 0x7f85, 0x7f86, 0x7f86, 0x7f87, 0x7f87, 0x7f88, 0x7f89, 0x7f89, 
-    /* 0x00003780: */ 0x7f8a, 0x7f8a, 0x7f8b, 0x7f8c, 0x7f8c, 0x7f8d, 0x7f8d, 0x7f8e, 0x7f8e, 0x7f8f, 0x7f90, 0x7f90, 0x7f91, 0x7f91, 0x7f92, 0x7f92, 
-    /* 0x000037a0: */ 0x7f93, 0x7f93, 0x7f94, 0x7f95, 0x7f95, 0x7f96, 0x7f96, 0x7f97, 0x7f97, 0x7f98, 0x7f98, 0x7f99, 0x7f99, 0x7f9a, 0x7f9a, 0x7f9b, 
-    /* 0x000037c0: */ 0x7f9c, 0x7f9c, 0x7f9d, 0x7f9d, 0x7f9e, 0x7f9e, 0x7f9f, 0x7f9f, 0x7fa0, 0x7fa0, 0x7fa1, 0x7fa1, 0x7fa2, 0x7fa2, 0x7fa3, 0x7fa3, 
-    /* 0x000037e0: */ 0x7fa4, 0x7fa4, 0x7fa5, 0x7fa5, 0x7fa6, 0x7fa6, 0x7fa7, 0x7fa7, 0x7fa8, 0x7fa8, 0x7fa9, 0x7fa9, 0x7faa, 0x7faa, 0x7fab, 0x7fab, 
-    /* 0x00003800: */ 0x7fac, 0x7fac, 0x7fad, 0x7fad, 0x7fae, 0x7fae, 0x7faf, 0x7faf, 0x7fb0, 0x7fb0, 0x7fb1, 0x7fb1, 0x7fb2, 0x7fb2, 0x7fb3, 0x7fb3, 
-    /* 0x00003820: */ 0x7fb3, 0x7fb4, 0x7fb4, 0x7fb5, 0x7fb5, 0x7fb6, 0x7fb6, 0x7fb7, 0x7fb7, 0x7fb8, 0x7fb8, 0x7fb8, 0x7fb9, 0x7fb9, 0x7fba, 0x7fba, 
-    /* 0x00003840: */ 0x7fbb, 0x7fbb, 0x7fbc, 0x7fbc, 0x7fbc, 0x7fbd, 0x7fbd, 0x7fbe, 0x7fbe, 0x7fbf, 0x7fbf, 0x7fbf, 0x7fc0, 0x7fc0, 0x7fc1, 0x7fc1, 
-    /* 0x00003860: */ 0x7fc2, 0x7fc2, 0x7fc2, 0x7fc3, 0x7fc3, 0x7fc4, 0x7fc4, 0x7fc4, 0x7fc5, 0x7fc5, 0x7fc6, 0x7fc6, 0x7fc6, 0x7fc7, 0x7fc7, 0x7fc8, 
-    /* 0x00003880: */ 0x7fc8, 0x7fc8, 0x7fc9, 0x7fc9, 0x7fca, 0x7fca, 0x7fca, 0x7fcb, 0x7fcb, 0x7fcc, 0x7fcc, 0x7fcc, 0x7fcd, 0x7fcd, 0x7fcd, 0x7fce, 
-    /* 0x000038a0: */ 0x7fce, 0x7fcf, 0x7fcf, 0x7fcf, 0x7fd0, 0x7fd0, 0x7fd0, 0x7fd1, 0x7fd1, 0x7fd2, 0x7fd2, 0x7fd2, 0x7fd3, 0x7fd3, 0x7fd3, 0x7fd4, 
-    /* 0x000038c0: */ 0x7fd4, 0x7fd4, 0x7fd5, 0x7fd5, 0x7fd5, 0x7fd6, 0x7fd6, 0x7fd6, 0x7fd7, 0x7fd7, 0x7fd7, 0x7fd8, 0x7fd8, 0x7fd8, 0x7fd9, 0x7fd9, 
-    /* 0x000038e0: */ 0x7fd9, 0x7fda, 0x7fda, 0x7fda, 0x7fdb, 0x7fdb, 0x7fdb, 0x7fdc, 0x7fdc, 0x7fdc, 0x7fdd, 0x7fdd, 0x7fdd, 0x7fde, 0x7fde, 0x7fde, 
-    /* 0x00003900: */ 0x7fde, 0x7fdf, 0x7fdf, 0x7fdf, 0x7fe0, 0x7fe0, 0x7fe0, 0x7fe1, 0x7fe1, 0x7fe1, 0x7fe1, 0x7fe2, 0x7fe2, 0x7fe2, 0x7fe3, 0x7fe3, 
-    /* 0x00003920: */ 0x7fe3, 0x7fe3, 0x7fe4, 0x7fe4, 0x7fe4, 0x7fe4, 0x7fe5, 0x7fe5, 0x7fe5, 0x7fe6, 0x7fe6, 0x7fe6, 0x7fe6, 0x7fe7, 0x7fe7, 0x7fe7, 
-    /* 0x00003940: */ 0x7fe7, 0x7fe8, 0x7fe8, 0x7fe8, 0x7fe8, 0x7fe9, 0x7fe9, 0x7fe9, 0x7fe9, 0x7fea, 0x7fea, 0x7fea, 0x7fea, 0x7feb, 0x7feb, 0x7feb, 
-    /* 0x00003960: */ 0x7feb, 0x7fec, 0x7fec, 0x7fec, 0x7fec, 0x7fec, 0x7fed, 0x7fed, 0x7fed, 0x7fed, 0x7fee, 0x7fee, 0x7fee, 0x7fee, 0x7fee, 0x7fef, 
-    /* 0x00003980: */ 0x7fef, 0x7fef, 0x7fef, 0x7ff0, 0x7ff0, 0x7ff0, 0x7ff0, 0x7ff0, 0x7ff1, 0x7ff1, 0x7ff1, 0x7ff1, 0x7ff1, 0x7ff2, 0x7ff2, 0x7ff2, 
-    /* 0x000039a0: */ 0x7ff2, 0x7ff2, 0x7ff2, 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff5, 0x7ff5, 
-    /* 0x000039c0: */ 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 
-    /* 0x000039e0: */ 0x7ff7, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 
-    /* 0x00003a00: */ 0x7ff9, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 
-    /* 0x00003a20: */ 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffd, 
-    /* 0x00003a40: */ 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffe, 
-    /* 0x00003a60: */ 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 
-    /* 0x00003a80: */ 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 
-    /* 0x00003aa0: */ 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 
-    /* 0x00003ac0: */ 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 
-    /* 0x00003ae0: */ 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffe, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 
-    /* 0x00003b00: */ 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffd, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 
-    /* 0x00003b20: */ 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffc, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffb, 0x7ffa, 
-    /* 0x00003b40: */ 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ffa, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff9, 0x7ff8, 
-    /* 0x00003b60: */ 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff8, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff7, 0x7ff6, 0x7ff6, 
-    /* 0x00003b80: */ 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff6, 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff5, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 0x7ff4, 
-    /* 0x00003ba0: */ 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff3, 0x7ff2, 0x7ff2, 0x7ff2, 0x7ff2, 0x7ff2, 0x7ff2, 0x7ff1, 0x7ff1, 0x7ff1, 0x7ff1, 0x7ff1, 
-    /* 0x00003bc0: */ 0x7ff0, 0x7ff0, 0x7ff0, 0x7ff0, 0x7ff0, 0x7fef, 0x7fef, 0x7fef, 0x7fef, 0x7fee, 0x7fee, 0x7fee, 0x7fee, 0x7fee, 0x7fed, 0x7fed, 
-    /* 0x00003be0: */ 0x7fed, 0x7fed, 0x7fec, 0x7fec, 0x7fec, 0x7fec, 0x7fec, 0x7feb, 0x7feb, 0x7feb, 0x7feb, 0x7fea, 0x7fea, 0x7fea, 0x7fea, 0x7fe9, 
-    /* 0x00003c00: */ 0x7fe9, 0x7fe9, 0x7fe9, 0x7fe8, 0x7fe8, 0x7fe8, 0x7fe8, 0x7fe7, 0x7fe7, 0x7fe7, 0x7fe7, 0x7fe6, 0x7fe6, 0x7fe6, 0x7fe6, 0x7fe5, 
-    /* 0x00003c20: */ 0x7fe5, 0x7fe5, 0x7fe4, 0x7fe4, 0x7fe4, 0x7fe4, 0x7fe3, 0x7fe3, 0x7fe3, 0x7fe3, 0x7fe2, 0x7fe2, 0x7fe2, 0x7fe1, 0x7fe1, 0x7fe1, 
-    /* 0x00003c40: */ 0x7fe1, 0x7fe0, 0x7fe0, 0x7fe0, 0x7fdf, 0x7fdf, 0x7fdf, 0x7fde, 0x7fde, 0x7fde, 0x7fde, 0x7fdd, 0x7fdd, 0x7fdd, 0x7fdc, 0x7fdc, 
-    /* 0x00003c60: */ 0x7fdc, 0x7fdb, 0x7fdb, 0x7fdb, 0x7fda, 0x7fda, 0x7fda, 0x7fd9, 0x7fd9, 0x7fd9, 0x7fd8, 0x7fd8, 0x7fd8, 0x7fd7, 0x7fd7, 0x7fd7, 
-    /* 0x00003c80: */ 0x7fd6, 0x7fd6, 0x7fd6, 0x7fd5, 0x7fd5, 0x7fd5, 0x7fd4, 0x7fd4, 0x7fd4, 0x7fd3, 0x7fd3, 0x7fd3, 0x7fd2, 0x7fd2, 0x7fd2, 0x7fd1, 
-    /* 0x00003ca0: */ 0x7fd1, 0x7fd0, 0x7fd0, 0x7fd0, 0x7fcf, 0x7fcf, 0x7fcf, 0x7fce, 0x7fce, 0x7fcd, 0x7fcd, 0x7fcd, 0x7fcc, 0x7fcc, 0x7fcc, 0x7fcb, 
-    /* 0x00003cc0: */ 0x7fcb, 0x7fca, 0x7fca, 0x7fca, 0x7fc9, 0x7fc9, 0x7fc8, 0x7fc8, 0x7fc8, 0x7fc7, 0x7fc7, 0x7fc6, 0x7fc6, 0x7fc6, 0x7fc5, 0x7fc5, 
-    /* 0x00003ce0: */ 0x7fc4, 0x7fc4, 0x7fc4, 0x7fc3, 0x7fc3, 0x7fc2, 0x7fc2, 0x7fc2, 0x7fc1, 0x7fc1, 0x7fc0, 0x7fc0, 0x7fbf, 0x7fbf, 0x7fbf, 0x7fbe, 
-    /* 0x00003d00: */ 0x7fbe, 0x7fbd, 0x7fbd, 0x7fbc, 0x7fbc, 0x7fbc, 0x7fbb, 0x7fbb, 0x7fba, 0x7fba, 0x7fb9, 0x7fb9, 0x7fb8, 0x7fb8, 0x7fb8, 0x7fb7, 
-    /* 0x00003d20: */ 0x7fb7, 0x7fb6, 0x7fb6, 0x7fb5, 0x7fb5, 0x7fb4, 0x7fb4, 0x7fb3, 0x7fb3, 0x7fb3, 0x7fb2, 0x7fb2, 0x7fb1, 0x7fb1, 0x7fb0, 0x7fb0, 
-    /* 0x00003d40: */ 0x7faf, 0x7faf, 0x7fae, 0x7fae, 0x7fad, 0x7fad, 0x7fac, 0x7fac, 0x7fab, 0x7fab, 0x7faa, 0x7faa, 0x7fa9, 0x7fa9, 0x7fa8, 0x7fa8, 
-    /* 0x00003d60: */ 0x7fa7, 0x7fa7, 0x7fa6, 0x7fa6, 0x7fa5, 0x7fa5, 0x7fa4, 0x7fa4, 0x7fa3, 0x7fa3, 0x7fa2, 0x7fa2, 0x7fa1, 0x7fa1, 0x7fa0, 0x7fa0, 
-    /* 0x00003d80: */ 0x7f9f, 0x7f9f, 0x7f9e, 0x7f9e, 0x7f9d, 0x7f9d, 0x7f9c, 0x7f9c, 0x7f9b, 0x7f9a, 0x7f9a, 0x7f99, 0x7f99, 0x7f98, 0x7f98, 0x7f97, 
-    /* 0x00003da0: */ 0x7f97, 0x7f96, 0x7f96, 0x7f95, 0x7f95, 0x7f94, 0x7f93, 0x7f93, 0x7f92, 0x7f92, 0x7f91, 0x7f91, 0x7f90, 0x7f90, 0x7f8f, 0x7f8e, 
-    /* 0x00003dc0: */ 0x7f8e, 0x7f8d, 0x7f8d, 0x7f8c, 0x7f8c, 0x7f8b, 0x7f8a, 0x7f8a, 0x7f89, 0x7f89, 0x7f88, 0x7f87, 0x7f87, 0x7f86, 0x7f86, 0x7f85, 
-    /* 0x00003de0: */ 0x7f85, 0x7f84, 0x7f83, 0x7f83, 0x7f82, 0x7f82, 0x7f81, 0x7f80, 0x7f80, 0x7f7f, 0x7f7f, 0x7f7e, 0x7f7d, 0x7f7d, 0x7f7c, 0x7f7c, 
-    /* 0x00003e00: */ 0x7f7b, 0x7f7a, 0x7f7a, 0x7f79, 0x7f78, 0x7f78, 0x7f77, 0x7f77, 0x7f76, 0x7f75, 0x7f75, 0x7f74, 0x7f73, 0x7f73, 0x7f72, 0x7f72, 
-    /* 0x00003e20: */ 0x7f71, 0x7f70, 0x7f70, 0x7f6f, 0x7f6e, 0x7f6e, 0x7f6d, 0x7f6c, 0x7f6c, 0x7f6b, 0x7f6a, 0x7f6a, 0x7f69, 0x7f68, 0x7f68, 0x7f67, 
-    /* 0x00003e40: */ 0x7f67, 0x7f66, 0x7f65, 0x7f65, 0x7f64, 0x7f63, 0x7f63, 0x7f62, 0x7f61, 0x7f61, 0x7f60, 0x7f5f, 0x7f5f, 0x7f5e, 0x7f5d, 0x7f5c, 
-    /* 0x00003e60: */ 0x7f5c, 0x7f5b, 0x7f5a, 0x7f5a, 0x7f59, 0x7f58, 0x7f58, 0x7f57, 0x7f56, 0x7f56, 0x7f55, 0x7f54, 0x7f53, 0x7f53, 0x7f52, 0x7f51, 
-    /* 0x00003e80: */ 0x7f51, 0x7f50, 0x7f4f, 0x7f4f, 0x7f4e, 0x7f4d, 0x7f4c, 0x7f4c, 0x7f4b, 0x7f4a, 0x7f4a, 0x7f49, 0x7f48, 0x7f47, 0x7f47, 0x7f46, 
-    /* 0x00003ea0: */ 0x7f45, 0x7f44, 0x7f44, 0x7f43, 0x7f42, 0x7f42, 0x7f41, 0x7f40, 0x7f3f, 0x7f3f, 0x7f3e, 0x7f3d, 0x7f3c, 0x7f3c, 0x7f3b, 0x7f3a, 
-    /* 0x00003ec0: */ 0x7f39, 0x7f39, 0x7f38, 0x7f37, 0x7f36, 0x7f36, 0x7f35, 0x7f34, 0x7f33, 0x7f33, 0x7f32, 0x7f31, 0x7f30, 0x7f30, 0x7f2f, 0x7f2e, 
-    /* 0x00003ee0: */ 0x7f2d, 0x7f2c, 0x7f2c, 0x7f2b, 0x7f2a, 0x7f29, 0x7f29, 0x7f28, 0x7f27, 0x7f26, 0x7f25, 0x7f25, 0x7f24, 0x7f23, 0x7f22, 0x7f21, 
-    /* 0x00003f00: */ 0x7f21, 0x7f20, 0x7f1f, 0x7f1e, 0x7f1d, 0x7f1d, 0x7f1c, 0x7f1b, 0x7f1a, 0x7f19, 0x7f19, 0x7f18, 0x7f17, 0x7f16, 0x7f15, 0x7f15, 
-    /* 0x00003f20: */ 0x7f14, 0x7f13, 0x7f12, 0x7f11, 0x7f10, 0x7f10, 0x7f0f, 0x7f0e, 0x7f0d, 0x7f0c, 0x7f0b, 0x7f0b, 0x7f0a, 0x7f09, 0x7f08, 0x7f07, 
-    /* 0x00003f40: */ 0x7f06, 0x7f06, 0x7f05, 0x7f04, 0x7f03, 0x7f02, 0x7f01, 0x7f00, 0x7f00, 0x7eff, 0x7efe, 0x7efd, 0x7efc, 0x7efb, 0x7efa, 0x7efa, 
-    /* 0x00003f60: */ 0x7ef9, 0x7ef8, 0x7ef7, 0x7ef6, 0x7ef5, 0x7ef4, 0x7ef4, 0x7ef3, 0x7ef2, 0x7ef1, 0x7ef0, 0x7eef, 0x7eee, 0x7eed, 0x7eed, 0x7eec, 
-    /* 0x00003f80: */ 0x7eeb, 0x7eea, 0x7ee9, 0x7ee8, 0x7ee7, 0x7ee6, 0x7ee5, 0x7ee4, 0x7ee4, 0x7ee3, 0x7ee2, 0x7ee1, 0x7ee0, 0x7edf, 0x7ede, 0x7edd, 
-    /* 0x00003fa0: */ 0x7edc, 0x7edb, 0x7edb, 0x7eda, 0x7ed9, 0x7ed8, 0x7ed7, 0x7ed6, 0x7ed5, 0x7ed4, 0x7ed3, 0x7ed2, 0x7ed1, 0x7ed0, 0x7ecf, 0x7ecf, 
-    /* 0x00003fc0: */ 0x7ece, 0x7ecd, 0x7ecc, 0x7ecb, 0x7eca, 0x7ec9, 0x7ec8, 0x7ec7, 0x7ec6, 0x7ec5, 0x7ec4, 0x7ec3, 0x7ec2, 0x7ec1, 0x7ec0, 0x7ebf, 
-    /* 0x00003fe0: */ 0x7ebe, 0x7ebe, 0x7ebd, 0x7ebc, 0x7ebb, 0x7eba, 0x7eb9, 0x7eb8, 0x7eb7, 0x7eb6, 0x7eb5, 0x7eb4, 0x7eb3, 0x7eb2, 0x7eb1, 0x7eb0, 
-    /* 0x00004000: */ 0x7eaf, 0x7eae, 0x7ead, 0x7eac, 0x7eab, 0x7eaa, 0x7ea9, 0x7ea8, 0x7ea7, 0x7ea6, 0x7ea5, 0x7ea4, 0x7ea3, 0x7ea2, 0x7ea1, 0x7ea0, 
-    /* 0x00004020: */ 0x7e9f, 0x7e9e, 0x7e9d, 0x7e9c, 0x7e9b, 0x7e9a, 0x7e99, 0x7e98, 0x7e97, 0x7e96, 0x7e95, 0x7e94, 0x7e93, 0x7e92, 0x7e91, 0x7e90, 
-    /* 0x00004040: */ 0x7e8f, 0x7e8e, 0x7e8d, 0x7e8c, 0x7e8b, 0x7e8a, 0x7e89, 0x7e88, 0x7e87, 0x7e86, 0x7e85, 0x7e84, 0x7e83, 0x7e82, 0x7e81, 0x7e7f, 
-    /* 0x00004060: */ 0x7e7e, 0x7e7d, 0x7e7c, 0x7e7b, 0x7e7a, 0x7e79, 0x7e78, 0x7e77, 0x7e76, 0x7e75, 0x7e74, 0x7e73, 0x7e72, 0x7e71, 0x7e70, 0x7e6f, 
-    /* 0x00004080: */ 0x7e6d, 0x7e6c, 0x7e6b, 0x7e6a, 0x7e69, 0x7e68, 0x7e67, 0x7e66, 0x7e65, 0x7e64, 0x7e63, 0x7e62, 0x7e61, 0x7e5f, 0x7e5e, 0x7e5d, 
-    /* 0x000040a0: */ 0x7e5c, 0x7e5b, 0x7e5a, 0x7e59, 0x7e58, 0x7e57, 0x7e56, 0x7e55, 0x7e53, 0x7e52, 0x7e51, 0x7e50, 0x7e4f, 0x7e4e, 0x7e4d, 0x7e4c, 
-    /* 0x000040c0: */ 0x7e4b, 0x7e49, 0x7e48, 0x7e47, 0x7e46, 0x7e45, 0x7e44, 0x7e43, 0x7e42, 0x7e40, 0x7e3f, 0x7e3e, 0x7e3d, 0x7e3c, 0x7e3b, 0x7e3a, 
-    /* 0x000040e0: */ 0x7e39, 0x7e37, 0x7e36, 0x7e35, 0x7e34, 0x7e33, 0x7e32, 0x7e31, 0x7e2f, 0x7e2e, 0x7e2d, 0x7e2c, 0x7e2b, 0x7e2a, 0x7e28, 0x7e27, 
-    /* 0x00004100: */ 0x7e26, 0x7e25, 0x7e24, 0x7e23, 0x7e22, 0x7e20, 0x7e1f, 0x7e1e, 0x7e1d, 0x7e1c, 0x7e1a, 0x7e19, 0x7e18, 0x7e17, 0x7e16, 0x7e15, 
-    /* 0x00004120: */ 0x7e13, 0x7e12, 0x7e11, 0x7e10, 0x7e0f, 0x7e0d, 0x7e0c, 0x7e0b, 0x7e0a, 0x7e09, 0x7e08, 0x7e06, 0x7e05, 0x7e04, 0x7e03, 0x7e02, 
-    /* 0x00004140: */ 0x7e00, 0x7dff, 0x7dfe, 0x7dfd, 0x7dfb, 0x7dfa, 0x7df9, 0x7df8, 0x7df7, 0x7df5, 0x7df4, 0x7df3, 0x7df2, 0x7df1, 0x7def, 0x7dee, 
-    /* 0x00004160: */ 0x7ded, 0x7dec, 0x7dea, 0x7de9, 0x7de8, 0x7de7, 0x7de5, 0x7de4, 0x7de3, 0x7de2, 0x7de1, 0x7ddf, 0x7dde, 0x7ddd, 0x7ddc, 0x7dda, 
-    /* 0x00004180: */ 0x7dd9, 0x7dd8, 0x7dd7, 0x7dd5, 0x7dd4, 0x7dd3, 0x7dd2, 0x7dd0, 0x7dcf, 0x7dce, 0x7dcc, 0x7dcb, 0x7dca, 0x7dc9, 0x7dc7, 0x7dc6, 
-    /* 0x000041a0: */ 0x7dc5, 0x7dc4, 0x7dc2, 0x7dc1, 0x7dc0, 0x7dbe, 0x7dbd, 0x7dbc, 0x7dbb, 0x7db9, 0x7db8, 0x7db7, 0x7db5, 0x7db4, 0x7db3, 0x7db2, 
-    /* 0x000041c0: */ 0x7db0, 0x7daf, 0x7dae, 0x7dac, 0x7dab, 0x7daa, 0x7da9, 0x7da7, 0x7da6, 0x7da5, 0x7da3, 0x7da2, 0x7da1, 0x7d9f, 0x7d9e, 0x7d9d, 
-    /* 0x000041e0: */ 0x7d9b, 0x7d9a, 0x7d99, 0x7d97, 0x7d96, 0x7d95, 0x7d93, 0x7d92, 0x7d91, 0x7d8f, 0x7d8e, 0x7d8d, 0x7d8b, 0x7d8a, 0x7d89, 0x7d87, 
-    /* 0x00004200: */ 0x7d86, 0x7d85, 0x7d83, 0x7d82, 0x7d81, 0x7d7f, 0x7d7e, 0x7d7d, 0x7d7b, 0x7d7a, 0x7d79, 0x7d77, 0x7d76, 0x7d75, 0x7d73, 0x7d72, 
-    /* 0x00004220: */ 0x7d71, 0x7d6f, 0x7d6e, 0x7d6c, 0x7d6b, 0x7d6a, 0x7d68, 0x7d67, 0x7d66, 0x7d64, 0x7d63, 0x7d61, 0x7d60, 0x7d5f, 0x7d5d, 0x7d5c, 
-    /* 0x00004240: */ 0x7d5b, 0x7d59, 0x7d58, 0x7d56, 0x7d55, 0x7d54, 0x7d52, 0x7d51, 0x7d4f, 0x7d4e, 0x7d4d, 0x7d4b, 0x7d4a, 0x7d48, 0x7d47, 0x7d46, 
-    /* 0x00004260: */ 0x7d44, 0x7d43, 0x7d41, 0x7d40, 0x7d3f, 0x7d3d, 0x7d3c, 0x7d3a, 0x7d39, 0x7d37, 0x7d36, 0x7d35, 0x7d33, 0x7d32, 0x7d30, 0x7d2f, 
-    /* 0x00004280: */ 0x7d2d, 0x7d2c, 0x7d2b, 0x7d29, 0x7d28, 0x7d26, 0x7d25, 0x7d23, 0x7d22, 0x7d21, 0x7d1f, 0x7d1e, 0x7d1c, 0x7d1b, 0x7d19, 0x7d18, 
-    /* 0x000042a0: */ 0x7d16, 0x7d15, 0x7d13, 0x7d12, 0x7d11, 0x7d0f, 0x7d0e, 0x7d0c, 0x7d0b, 0x7d09, 0x7d08, 0x7d06, 0x7d05, 0x7d03, 0x7d02, 0x7d00, 
-    /* 0x000042c0: */ 0x7cff, 0x7cfe, 0x7cfc, 0x7cfb, 0x7cf9, 0x7cf8, 0x7cf6, 0x7cf5, 0x7cf3, 0x7cf2, 0x7cf0, 0x7cef, 0x7ced, 0x7cec, 0x7cea, 0x7ce9, 
-    /* 0x000042e0: */ 0x7ce7, 0x7ce6, 0x7ce4, 0x7ce3, 0x7ce1, 0x7ce0, 0x7cde, 0x7cdd, 0x7cdb, 0x7cda, 0x7cd8, 0x7cd7, 0x7cd5, 0x7cd4, 0x7cd2, 0x7cd1, 
-    /* 0x00004300: */ 0x7ccf, 0x7cce, 0x7ccc, 0x7cca, 0x7cc9, 0x7cc7, 0x7cc6, 0x7cc4, 0x7cc3, 0x7cc1, 0x7cc0, 0x7cbe, 0x7cbd, 0x7cbb, 0x7cba, 0x7cb8, 
-    /* 0x00004320: */ 0x7cb7, 0x7cb5, 0x7cb3, 0x7cb2, 0x7cb0, 0x7caf, 0x7cad, 0x7cac, 0x7caa, 0x7ca9, 0x7ca7, 0x7ca6, 0x7ca4, 0x7ca2, 0x7ca1, 0x7c9f, 
-    /* 0x00004340: */ 0x7c9e, 0x7c9c, 0x7c9b, 0x7c99, 0x7c97, 0x7c96, 0x7c94, 0x7c93, 0x7c91, 0x7c90, 0x7c8e, 0x7c8c, 0x7c8b, 0x7c89, 0x7c88, 0x7c86, 
-    /* 0x00004360: */ 0x7c84, 0x7c83, 0x7c81, 0x7c80, 0x7c7e, 0x7c7d, 0x7c7b, 0x7c79, 0x7c78, 0x7c76, 0x7c75, 0x7c73, 0x7c71, 0x7c70, 0x7c6e, 0x7c6d, 
-    /* 0x00004380: */ 0x7c6b, 0x7c69, 0x7c68, 0x7c66, 0x7c64, 0x7c63, 0x7c61, 0x7c60, 0x7c5e, 0x7c5c, 0x7c5b, 0x7c59, 0x7c58, 0x7c56, 0x7c54, 0x7c53, 
-    /* 0x000043a0: */ 0x7c51, 0x7c4f, 0x7c4e, 0x7c4c, 0x7c4a, 0x7c49, 0x7c47, 0x7c46, 0x7c44, 0x7c42, 0x7c41, 0x7c3f, 0x7c3d, 0x7c3c, 0x7c3a, 0x7c38, 
-    /* 0x000043c0: */ 0x7c37, 0x7c35, 0x7c33, 0x7c32, 0x7c30, 0x7c2e, 0x7c2d, 0x7c2b, 0x7c29, 0x7c28, 0x7c26, 0x7c24, 0x7c23, 0x7c21, 0x7c1f, 0x7c1e, 
-    /* 0x000043e0: */ 0x7c1c, 0x7c1a, 0x7c19, 0x7c17, 0x7c15, 0x7c14, 0x7c12, 0x7c10, 0x7c0f, 0x7c0d, 0x7c0b, 0x7c0a, 0x7c08, 0x7c06, 0x7c04, 0x7c03, 
-    /* 0x00004400: */ 0x7c01, 0x7bff, 0x7bfe, 0x7bfc, 0x7bfa, 0x7bf9, 0x7bf7, 0x7bf5, 0x7bf3, 0x7bf2, 0x7bf0, 0x7bee, 0x7bed, 0x7beb, 0x7be9, 0x7be7, 
-    /* 0x00004420: */ 0x7be6, 0x7be4, 0x7be2, 0x7be1, 0x7bdf, 0x7bdd, 0x7bdb, 0x7bda, 0x7bd8, 0x7bd6, 0x7bd4, 0x7bd3, 0x7bd1, 0x7bcf, 0x7bcd, 0x7bcc, 
-    /* 0x00004440: */ 0x7bca, 0x7bc8, 0x7bc7, 0x7bc5, 0x7bc3, 0x7bc1, 0x7bc0, 0x7bbe, 0x7bbc, 0x7bba, 0x7bb9, 0x7bb7, 0x7bb5, 0x7bb3, 0x7bb1, 0x7bb0, 
-    /* 0x00004460: */ 0x7bae, 0x7bac, 0x7baa, 0x7ba9, 0x7ba7, 0x7ba5, 0x7ba3, 0x7ba2, 0x7ba0, 0x7b9e, 0x7b9c, 0x7b9a, 0x7b99, 0x7b97, 0x7b95, 0x7b93, 
-    /* 0x00004480: */ 0x7b92, 0x7b90, 0x7b8e, 0x7b8c, 0x7b8a, 0x7b89, 0x7b87, 0x7b85, 0x7b83, 0x7b81, 0x7b80, 0x7b7e, 0x7b7c, 0x7b7a, 0x7b78, 0x7b77, 
-    /* 0x000044a0: */ 0x7b75, 0x7b73, 0x7b71, 0x7b6f, 0x7b6d, 0x7b6c, 0x7b6a, 0x7b68, 0x7b66, 0x7b64, 0x7b63, 0x7b61, 0x7b5f, 0x7b5d, 0x7b5b, 0x7b59, 
-    /* 0x000044c0: */ 0x7b58, 0x7b56, 0x7b54, 0x7b52, 0x7b50, 0x7b4e, 0x7b4d, 0x7b4b, 0x7b49, 0x7b47, 0x7b45, 0x7b43, 0x7b42, 0x7b40, 0x7b3e, 0x7b3c, 
-    /* 0x000044e0: */ 0x7b3a, 0x7b38, 0x7b36, 0x7b35, 0x7b33, 0x7b31, 0x7b2f, 0x7b2d, 0x7b2b, 0x7b29, 0x7b28, 0x7b26, 0x7b24, 0x7b22, 0x7b20, 0x7b1e, 
-    /* 0x00004500: */ 0x7b1c, 0x7b1a, 0x7b19, 0x7b17, 0x7b15, 0x7b13, 0x7b11, 0x7b0f, 0x7b0d, 0x7b0b, 0x7b09, 0x7b08, 0x7b06, 0x7b04, 0x7b02, 0x7b00, 
-    /* 0x00004520: */ 0x7afe, 0x7afc, 0x7afa, 0x7af8, 0x7af7, 0x7af5, 0x7af3, 0x7af1, 0x7aef, 0x7aed, 0x7aeb, 0x7ae9, 0x7ae7, 0x7ae5, 0x7ae3, 0x7ae1, 
-    /* 0x00004540: */ 0x7ae0, 0x7ade, 0x7adc, 0x7ada, 0x7ad8, 0x7ad6, 0x7ad4, 0x7ad2, 0x7ad0, 0x7ace, 0x7acc, 0x7aca, 0x7ac8, 0x7ac7, 0x7ac5, 0x7ac3, 
-    /* 0x00004560: */ 0x7ac1, 0x7abf, 0x7abd, 0x7abb, 0x7ab9, 0x7ab7, 0x7ab5, 0x7ab3, 0x7ab1, 0x7aaf, 0x7aad, 0x7aab, 0x7aa9, 0x7aa7, 0x7aa5, 0x7aa3, 
-    /* 0x00004580: */ 0x7aa1, 0x7a9f, 0x7a9e, 0x7a9c, 0x7a9a, 0x7a98, 0x7a96, 0x7a94, 0x7a92, 0x7a90, 0x7a8e, 0x7a8c, 0x7a8a, 0x7a88, 0x7a86, 0x7a84, 
-    /* 0x000045a0: */ 0x7a82, 0x7a80, 0x7a7e, 0x7a7c, 0x7a7a, 0x7a78, 0x7a76, 0x7a74, 0x7a72, 0x7a70, 0x7a6e, 0x7a6c, 0x7a6a, 0x7a68, 0x7a66, 0x7a64, 
-    /* 0x000045c0: */ 0x7a62, 0x7a60, 0x7a5e, 0x7a5c, 0x7a5a, 0x7a58, 0x7a56, 0x7a54, 0x7a52, 0x7a50, 0x7a4e, 0x7a4c, 0x7a4a, 0x7a48, 0x7a46, 0x7a44, 
-    /* 0x000045e0: */ 0x7a42, 0x7a40, 0x7a3e, 0x7a3b, 0x7a39, 0x7a37, 0x7a35, 0x7a33, 0x7a31, 0x7a2f, 0x7a2d, 0x7a2b, 0x7a29, 0x7a27, 0x7a25, 0x7a23, 
-    /* 0x00004600: */ 0x7a21, 0x7a1f, 0x7a1d, 0x7a1b, 0x7a19, 0x7a17, 0x7a15, 0x7a13, 0x7a10, 0x7a0e, 0x7a0c, 0x7a0a, 0x7a08, 0x7a06, 0x7a04, 0x7a02, 
-    /* 0x00004620: */ 0x7a00, 0x79fe, 0x79fc, 0x79fa, 0x79f8, 0x79f6, 0x79f3, 0x79f1, 0x79ef, 0x79ed, 0x79eb, 0x79e9, 0x79e7, 0x79e5, 0x79e3, 0x79e1, 
-    /* 0x00004640: */ 0x79df, 0x79dc, 0x79da, 0x79d8, 0x79d6, 0x79d4, 0x79d2, 0x79d0, 0x79ce, 0x79cc, 0x79ca, 0x79c7, 0x79c5, 0x79c3, 0x79c1, 0x79bf, 
-    /* 0x00004660: */ 0x79bd, 0x79bb, 0x79b9, 0x79b7, 0x79b4, 0x79b2, 0x79b0, 0x79ae, 0x79ac, 0x79aa, 0x79a8, 0x79a6, 0x79a3, 0x79a1, 0x799f, 0x799d, 
-    /* 0x00004680: */ 0x799b, 0x7999, 0x7997, 0x7994, 0x7992, 0x7990, 0x798e, 0x798c, 0x798a, 0x7988, 0x7985, 0x7983, 0x7981, 0x797f, 0x797d, 0x797b, 
-    /* 0x000046a0: */ 0x7978, 0x7976, 0x7974, 0x7972, 0x7970, 0x796e, 0x796b, 0x7969, 0x7967, 0x7965, 0x7963, 0x7961, 0x795e, 0x795c, 0x795a, 0x7958, 
-    /* 0x000046c0: */ 0x7956, 0x7954, 0x7951, 0x794f, 0x794d, 0x794b, 0x7949, 0x7946, 0x7944, 0x7942, 0x7940, 0x793e, 0x793b, 0x7939, 0x7937, 0x7935, 
-    /* 0x000046e0: */ 0x7933, 0x7930, 0x792e, 0x792c, 0x792a, 0x7928, 0x7925, 0x7923, 0x7921, 0x791f, 0x791c, 0x791a, 0x7918, 0x7916, 0x7914, 0x7911, 
-    /* 0x00004700: */ 0x790f, 0x790d, 0x790b, 0x7908, 0x7906, 0x7904, 0x7902, 0x7900, 0x78fd, 0x78fb, 0x78f9, 0x78f7, 0x78f4, 0x78f2, 0x78f0, 0x78ee, 
-    /* 0x00004720: */ 0x78eb, 0x78e9, 0x78e7, 0x78e5, 0x78e2, 0x78e0, 0x78de, 0x78dc, 0x78d9, 0x78d7, 0x78d5, 0x78d3, 0x78d0, 0x78ce, 0x78cc, 0x78c9, 
-    /* 0x00004740: */ 0x78c7, 0x78c5, 0x78c3, 0x78c0, 0x78be, 0x78bc, 0x78ba, 0x78b7, 0x78b5, 0x78b3, 0x78b0, 0x78ae, 0x78ac, 0x78aa, 0x78a7, 0x78a5, 
-    /* 0x00004760: */ 0x78a3, 0x78a0, 0x789e, 0x789c, 0x789a, 0x7897, 0x7895, 0x7893, 0x7890, 0x788e, 0x788c, 0x7889, 0x7887, 0x7885, 0x7883, 0x7880, 
-    /* 0x00004780: */ 0x787e, 0x787c, 0x7879, 0x7877, 0x7875, 0x7872, 0x7870, 0x786e, 0x786b, 0x7869, 0x7867, 0x7864, 0x7862, 0x7860, 0x785d, 0x785b, 
-    /* 0x000047a0: */ 0x7859, 0x7856, 0x7854, 0x7852, 0x784f, 0x784d, 0x784b, 0x7848, 0x7846, 0x7844, 0x7841, 0x783f, 0x783d, 0x783a, 0x7838, 0x7836, 
-    /* 0x000047c0: */ 0x7833, 0x7831, 0x782e, 0x782c, 0x782a, 0x7827, 0x7825, 0x7823, 0x7820, 0x781e, 0x781c, 0x7819, 0x7817, 0x7814, 0x7812, 0x7810, 
-    /* 0x000047e0: */ 0x780d, 0x780b, 0x7809, 0x7806, 0x7804, 0x7801, 0x77ff, 0x77fd, 0x77fa, 0x77f8, 0x77f6, 0x77f3, 0x77f1, 0x77ee, 0x77ec, 0x77ea, 
-    /* 0x00004800: */ 0x77e7, 0x77e5, 0x77e2, 0x77e0, 0x77de, 0x77db, 0x77d9, 0x77d6, 0x77d4, 0x77d1, 0x77cf, 0x77cd, 0x77ca, 0x77c8, 0x77c5, 0x77c3, 
-    /* 0x00004820: */ 0x77c1, 0x77be, 0x77bc, 0x77b9, 0x77b7, 0x77b4, 0x77b2, 0x77b0, 0x77ad, 0x77ab, 0x77a8, 0x77a6, 0x77a3, 0x77a1, 0x779f, 0x779c, 
-    /* 0x00004840: */ 0x779a, 0x7797, 0x7795, 0x7792, 0x7790, 0x778d, 0x778b, 0x7789, 0x7786, 0x7784, 0x7781, 0x777f, 0x777c, 0x777a, 0x7777, 0x7775, 
-    /* 0x00004860: */ 0x7772, 0x7770, 0x776e, 0x776b, 0x7769, 0x7766, 0x7764, 0x7761, 0x775f, 0x775c, 0x775a, 0x7757, 0x7755, 0x7752, 0x7750, 0x774d, 
-    /* 0x00004880: */ 0x774b, 0x7748, 0x7746, 0x7743, 0x7741, 0x773e, 0x773c, 0x7739, 0x7737, 0x7734, 0x7732, 0x772f, 0x772d, 0x772a, 0x7728, 0x7725, 
-    /* 0x000048a0: */ 0x7723, 0x7720, 0x771e, 0x771b, 0x7719, 0x7716, 0x7714, 0x7711, 0x770f, 0x770c, 0x770a, 0x7707, 0x7705, 0x7702, 0x7700, 0x76fd, 
-    /* 0x000048c0: */ 0x76fb, 0x76f8, 0x76f6, 0x76f3, 0x76f1, 0x76ee, 0x76eb, 0x76e9, 0x76e6, 0x76e4, 0x76e1, 0x76df, 0x76dc, 0x76da, 0x76d7, 0x76d5, 
-    /* 0x000048e0: */ 0x76d2, 0x76d0, 0x76cd, 0x76ca, 0x76c8, 0x76c5, 0x76c3, 0x76c0, 0x76be, 0x76bb, 0x76b9, 0x76b6, 0x76b3, 0x76b1, 0x76ae, 0x76ac, 
-    /* 0x00004900: */ 0x76a9, 0x76a7, 0x76a4, 0x76a1, 0x769f, 0x769c, 0x769a, 0x7697, 0x7695, 0x7692, 0x768f, 0x768d, 0x768a, 0x7688, 0x7685, 0x7682, 
-    /* 0x00004920: */ 0x7680, 0x767d, 0x767b, 0x7678, 0x7675, 0x7673, 0x7670, 0x766e, 0x766b, 0x7668, 0x7666, 0x7663, 0x7661, 0x765e, 0x765b, 0x7659, 
-    /* 0x00004940: */ 0x7656, 0x7654, 0x7651, 0x764e, 0x764c, 0x7649, 0x7646, 0x7644, 0x7641, 0x763f, 0x763c, 0x7639, 0x7637, 0x7634, 0x7631, 0x762f, 
-    /* 0x00004960: */ 0x762c, 0x762a, 0x7627, 0x7624, 0x7622, 0x761f, 0x761c, 0x761a, 0x7617, 0x7614, 0x7612, 0x760f, 0x760d, 0x760a, 0x7607, 0x7605, 
-    /* 0x00004980: */ 0x7602, 0x75ff, 0x75fd, 0x75fa, 0x75f7, 0x75f5, 0x75f2, 0x75ef, 0x75ed, 0x75ea, 0x75e7, 0x75e5, 0x75e2, 0x75df, 0x75dd, 0x75da, 
-    /* 0x000049a0: */ 0x75d7, 0x75d5, 0x75d2, 0x75cf, 0x75cd, 0x75ca, 0x75c7, 0x75c4, 0x75c2, 0x75bf, 0x75bc, 0x75ba, 0x75b7, 0x75b4, 0x75b2, 0x75af, 
-    /* 0x000049c0: */ 0x75ac, 0x75aa, 0x75a7, 0x75a4, 0x75a1, 0x759f, 0x759c, 0x7599, 0x7597, 0x7594, 0x7591, 0x758f, 0x758c, 0x7589, 0x7586, 0x7584, 
-    /* 0x000049e0: */ 0x7581, 0x757e, 0x757c, 0x7579, 0x7576, 0x7573, 0x7571, 0x756e, 0x756b, 0x7568, 0x7566, 0x7563, 0x7560, 0x755e, 0x755b, 0x7558, 
-    /* 0x00004a00: */ 0x7555, 0x7553, 0x7550, 0x754d, 0x754a, 0x7548, 0x7545, 0x7542, 0x753f, 0x753d, 0x753a, 0x7537, 0x7534, 0x7532, 0x752f, 0x752c, 
-    /* 0x00004a20: */ 0x7529, 0x7527, 0x7524, 0x7521, 0x751e, 0x751b, 0x7519, 0x7516, 0x7513, 0x7510, 0x750e, 0x750b, 0x7508, 0x7505, 0x7503, 0x7500, 
-    /* 0x00004a40: */ 0x74fd, 0x74fa, 0x74f7, 0x74f5, 0x74f2, 0x74ef, 0x74ec, 0x74e9, 0x74e7, 0x74e4, 0x74e1, 0x74de, 0x74db, 0x74d9, 0x74d6, 0x74d3, 
-    /* 0x00004a60: */ 0x74d0, 0x74cd, 0x74cb, 0x74c8, 0x74c5, 0x74c2, 0x74bf, 0x74bd, 0x74ba, 0x74b7, 0x74b4, 0x74b1, 0x74af, 0x74ac, 0x74a9, 0x74a6, 
-    /* 0x00004a80: */ 0x74a3, 0x74a0, 0x749e, 0x749b, 0x7498, 0x7495, 0x7492, 0x748f, 0x748d, 0x748a, 0x7487, 0x7484, 0x7481, 0x747e, 0x747c, 0x7479, 
-    /* 0x00004aa0: */ 0x7476, 0x7473, 0x7470, 0x746d, 0x746b, 0x7468, 0x7465, 0x7462, 0x745f, 0x745c, 0x7459, 0x7457, 0x7454, 0x7451, 0x744e, 0x744b, 
-    /* 0x00004ac0: */ 0x7448, 0x7445, 0x7443, 0x7440, 0x743d, 0x743a, 0x7437, 0x7434, 0x7431, 0x742e, 0x742c, 0x7429, 0x7426, 0x7423, 0x7420, 0x741d, 
-    /* 0x00004ae0: */ 0x741a, 0x7417, 0x7414, 0x7412, 0x740f, 0x740c, 0x7409, 0x7406, 0x7403, 0x7400, 0x73fd, 0x73fa, 0x73f8, 0x73f5, 0x73f2, 0x73ef, 
-    /* 0x00004b00: */ 0x73ec, 0x73e9, 0x73e6, 0x73e3, 0x73e0, 0x73dd, 0x73da, 0x73d8, 0x73d5, 0x73d2, 0x73cf, 0x73cc, 0x73c9, 0x73c6, 0x73c3, 0x73c0, 
-    /* 0x00004b20: */ 0x73bd, 0x73ba, 0x73b7, 0x73b4, 0x73b2, 0x73af, 0x73ac, 0x73a9, 0x73a6, 0x73a3, 0x73a0, 0x739d, 0x739a, 0x7397, 0x7394, 0x7391, 
-    /* 0x00004b40: */ 0x738e, 0x738b, 0x7388, 0x7385, 0x7382, 0x737f, 0x737d, 0x737a, 0x7377, 0x7374, 0x7371, 0x736e, 0x736b, 0x7368, 0x7365, 0x7362, 
-    /* 0x00004b60: */ 0x735f, 0x735c, 0x7359, 0x7356, 0x7353, 0x7350, 0x734d, 0x734a, 0x7347, 0x7344, 0x7341, 0x733e, 0x733b, 0x7338, 0x7335, 0x7332, 
-    /* 0x00004b80: */ 0x732f, 0x732c, 0x7329, 0x7326, 0x7323, 0x7320, 0x731d, 0x731a, 0x7317, 0x7314, 0x7311, 0x730e, 0x730b, 0x7308, 0x7305, 0x7302, 
-    /* 0x00004ba0: */ 0x72ff, 0x72fc, 0x72f9, 0x72f6, 0x72f3, 0x72f0, 0x72ed, 0x72ea, 0x72e7, 0x72e4, 0x72e1, 0x72de, 0x72db, 0x72d8, 0x72d5, 0x72d2, 
-    /* 0x00004bc0: */ 0x72cf, 0x72cc, 0x72c9, 0x72c6, 0x72c3, 0x72c0, 0x72bd, 0x72ba, 0x72b7, 0x72b4, 0x72b1, 0x72ae, 0x72aa, 0x72a7, 0x72a4, 0x72a1, 
-    /* 0x00004be0: */ 0x729e, 0x729b, 0x7298, 0x7295, 0x7292, 0x728f, 0x728c, 0x7289, 0x7286, 0x7283, 0x7280, 0x727d, 0x727a, 0x7276, 0x7273, 0x7270, 
-    /* 0x00004c00: */ 0x726d, 0x726a, 0x7267, 0x7264, 0x7261, 0x725e, 0x725b, 0x7258, 0x7255, 0x7252, 0x724f, 0x724b, 0x7248, 0x7245, 0x7242, 0x723f, 
-    /* 0x00004c20: */ 0x723c, 0x7239, 0x7236, 0x7233, 0x7230, 0x722c, 0x7229, 0x7226, 0x7223, 0x7220, 0x721d, 0x721a, 0x7217, 0x7214, 0x7211, 0x720d, 
-    /* 0x00004c40: */ 0x720a, 0x7207, 0x7204, 0x7201, 0x71fe, 0x71fb, 0x71f8, 0x71f5, 0x71f1, 0x71ee, 0x71eb, 0x71e8, 0x71e5, 0x71e2, 0x71df, 0x71db, 
-    /* 0x00004c60: */ 0x71d8, 0x71d5, 0x71d2, 0x71cf, 0x71cc, 0x71c9, 0x71c6, 0x71c2, 0x71bf, 0x71bc, 0x71b9, 0x71b6, 0x71b3, 0x71b0, 0x71ac, 0x71a9, 
-    /* 0x00004c80: */ 0x71a6, 0x71a3, 0x71a0, 0x719d, 0x7199, 0x7196, 0x7193, 0x7190, 0x718d, 0x718a, 0x7186, 0x7183, 0x7180, 0x717d, 0x717a, 0x7177, 
-    /* 0x00004ca0: */ 0x7173, 0x7170, 0x716d, 0x716a, 0x7167, 0x7164, 0x7160, 0x715d, 0x715a, 0x7157, 0x7154, 0x7150, 0x714d, 0x714a, 0x7147, 0x7144, 
-    /* 0x00004cc0: */ 0x7141, 0x713d, 0x713a, 0x7137, 0x7134, 0x7131, 0x712d, 0x712a, 0x7127, 0x7124, 0x7120, 0x711d, 0x711a, 0x7117, 0x7114, 0x7110, 
-    /* 0x00004ce0: */ 0x710d, 0x710a, 0x7107, 0x7104, 0x7100, 0x70fd, 0x70fa, 0x70f7, 0x70f3, 0x70f0, 0x70ed, 0x70ea, 0x70e7, 0x70e3, 0x70e0, 0x70dd, 
-    /* 0x00004d00: */ 0x70da, 0x70d6, 0x70d3, 0x70d0, 0x70cd, 0x70c9, 0x70c6, 0x70c3, 0x70c0, 0x70bc, 0x70b9, 0x70b6, 0x70b3, 0x70af, 0x70ac, 0x70a9, 
-    /* 0x00004d20: */ 0x70a6, 0x70a2, 0x709f, 0x709c, 0x7099, 0x7095, 0x7092, 0x708f, 0x708c, 0x7088, 0x7085, 0x7082, 0x707f, 0x707b, 0x7078, 0x7075, 
-    /* 0x00004d40: */ 0x7071, 0x706e, 0x706b, 0x7068, 0x7064, 0x7061, 0x705e, 0x705b, 0x7057, 0x7054, 0x7051, 0x704d, 0x704a, 0x7047, 0x7043, 0x7040, 
-    /* 0x00004d60: */ 0x703d, 0x703a, 0x7036, 0x7033, 0x7030, 0x702c, 0x7029, 0x7026, 0x7023, 0x701f, 0x701c, 0x7019, 0x7015, 0x7012, 0x700f, 0x700b, 
-    /* 0x00004d80: */ 0x7008, 0x7005, 0x7001, 0x6ffe, 0x6ffb, 0x6ff7, 0x6ff4, 0x6ff1, 0x6fed, 0x6fea, 0x6fe7, 0x6fe3, 0x6fe0, 0x6fdd, 0x6fd9, 0x6fd6, 
-    /* 0x00004da0: */ 0x6fd3, 0x6fcf, 0x6fcc, 0x6fc9, 0x6fc5, 0x6fc2, 0x6fbf, 0x6fbb, 0x6fb8, 0x6fb5, 0x6fb1, 0x6fae, 0x6fab, 0x6fa7, 0x6fa4, 0x6fa1, 
-    /* 0x00004dc0: */ 0x6f9d, 0x6f9a, 0x6f97, 0x6f93, 0x6f90, 0x6f8c, 0x6f89, 0x6f86, 0x6f82, 0x6f7f, 0x6f7c, 0x6f78, 0x6f75, 0x6f72, 0x6f6e, 0x6f6b, 
-    /* 0x00004de0: */ 0x6f67, 0x6f64, 0x6f61, 0x6f5d, 0x6f5a, 0x6f57, 0x6f53, 0x6f50, 0x6f4c, 0x6f49, 0x6f46, 0x6f42, 0x6f3f, 0x6f3b, 0x6f38, 0x6f35, 
-    /* 0x00004e00: */ 0x6f31, 0x6f2e, 0x6f2a, 0x6f27, 0x6f24, 0x6f20, 0x6f1d, 0x6f19, 0x6f16, 0x6f13, 0x6f0f, 0x6f0c, 0x6f08, 0x6f05, 0x6f02, 0x6efe, 
-    /* 0x00004e20: */ 0x6efb, 0x6ef7, 0x6ef4, 0x6ef1, 0x6eed, 0x6eea, 0x6ee6, 0x6ee3, 0x6edf, 0x6edc, 0x6ed9, 0x6ed5, 0x6ed2, 0x6ece, 0x6ecb, 0x6ec7, 
-    /* 0x00004e40: */ 0x6ec4, 0x6ec1, 0x6ebd, 0x6eba, 0x6eb6, 0x6eb3, 0x6eaf, 0x6eac, 0x6ea8, 0x6ea5, 0x6ea2, 0x6e9e, 0x6e9b, 0x6e97, 0x6e94, 0x6e90, 
-    /* 0x00004e60: */ 0x6e8d, 0x6e89, 0x6e86, 0x6e82, 0x6e7f, 0x6e7c, 0x6e78, 0x6e75, 0x6e71, 0x6e6e, 0x6e6a, 0x6e67, 0x6e63, 0x6e60, 0x6e5c, 0x6e59, 
-    /* 0x00004e80: */ 0x6e55, 0x6e52, 0x6e4e, 0x6e4b, 0x6e47, 0x6e44, 0x6e41, 0x6e3d, 0x6e3a, 0x6e36, 0x6e33, 0x6e2f, 0x6e2c, 0x6e28, 0x6e25, 0x6e21, 
-    /* 0x00004ea0: */ 0x6e1e, 0x6e1a, 0x6e17, 0x6e13, 0x6e10, 0x6e0c, 0x6e09, 0x6e05, 0x6e02, 0x6dfe, 0x6dfb, 0x6df7, 0x6df4, 0x6df0, 0x6ded, 0x6de9, 
-    /* 0x00004ec0: */ 0x6de6, 0x6de2, 0x6ddf, 0x6ddb, 0x6dd7, 0x6dd4, 0x6dd0, 0x6dcd, 0x6dc9, 0x6dc6, 0x6dc2, 0x6dbf, 0x6dbb, 0x6db8, 0x6db4, 0x6db1, 
-    /* 0x00004ee0: */ 0x6dad, 0x6daa, 0x6da6, 0x6da3, 0x6d9f, 0x6d9b, 0x6d98, 0x6d94, 0x6d91, 0x6d8d, 0x6d8a, 0x6d86, 0x6d83, 0x6d7f, 0x6d7c, 0x6d78, 
-    /* 0x00004f00: */ 0x6d74, 0x6d71, 0x6d6d, 0x6d6a, 0x6d66, 0x6d63, 0x6d5f, 0x6d5c, 0x6d58, 0x6d54, 0x6d51, 0x6d4d, 0x6d4a, 0x6d46, 0x6d43, 0x6d3f, 
-    /* 0x00004f20: */ 0x6d3b, 0x6d38, 0x6d34, 0x6d31, 0x6d2d, 0x6d2a, 0x6d26, 0x6d22, 0x6d1f, 0x6d1b, 0x6d18, 0x6d14, 0x6d10, 0x6d0d, 0x6d09, 0x6d06, 
-    /* 0x00004f40: */ 0x6d02, 0x6cff, 0x6cfb, 0x6cf7, 0x6cf4, 0x6cf0, 0x6ced, 0x6ce9, 0x6ce5, 0x6ce2, 0x6cde, 0x6cdb, 0x6cd7, 0x6cd3, 0x6cd0, 0x6ccc, 
-    /* 0x00004f60: */ 0x6cc8, 0x6cc5, 0x6cc1, 0x6cbe, 0x6cba, 0x6cb6, 0x6cb3, 0x6caf, 0x6cac, 0x6ca8, 0x6ca4, 0x6ca1, 0x6c9d, 0x6c99, 0x6c96, 0x6c92, 
-    /* 0x00004f80: */ 0x6c8f, 0x6c8b, 0x6c87, 0x6c84, 0x6c80, 0x6c7c, 0x6c79, 0x6c75, 0x6c71, 0x6c6e, 0x6c6a, 0x6c66, 0x6c63, 0x6c5f, 0x6c5c, 0x6c58, 
-    /* 0x00004fa0: */ 0x6c54, 0x6c51, 0x6c4d, 0x6c49, 0x6c46, 0x6c42, 0x6c3e, 0x6c3b, 0x6c37, 0x6c33, 0x6c30, 0x6c2c, 0x6c28, 0x6c25, 0x6c21, 0x6c1d, 
-    /* 0x00004fc0: */ 0x6c1a, 0x6c16, 0x6c12, 0x6c0f, 0x6c0b, 0x6c07, 0x6c04, 0x6c00, 0x6bfc, 0x6bf9, 0x6bf5, 0x6bf1, 0x6bee, 0x6bea, 0x6be6, 0x6be2, 
-    /* 0x00004fe0: */ 0x6bdf, 0x6bdb, 0x6bd7, 0x6bd4, 0x6bd0, 0x6bcc, 0x6bc9, 0x6bc5, 0x6bc1, 0x6bbe, 0x6bba, 0x6bb6, 0x6bb2, 0x6baf, 0x6bab, 0x6ba7, 
-    /* 0x00005000: */ 0x6ba4, 0x6ba0, 0x6b9c, 0x6b98, 0x6b95, 0x6b91, 0x6b8d, 0x6b8a, 0x6b86, 0x6b82, 0x6b7e, 0x6b7b, 0x6b77, 0x6b73, 0x6b70, 0x6b6c, 
-    /* 0x00005020: */ 0x6b68, 0x6b64, 0x6b61, 0x6b5d, 0x6b59, 0x6b55, 0x6b52, 0x6b4e, 0x6b4a, 0x6b46, 0x6b43, 0x6b3f, 0x6b3b, 0x6b38, 0x6b34, 0x6b30, 
-    /* 0x00005040: */ 0x6b2c, 0x6b29, 0x6b25, 0x6b21, 0x6b1d, 0x6b1a, 0x6b16, 0x6b12, 0x6b0e, 0x6b0a, 0x6b07, 0x6b03, 0x6aff, 0x6afb, 0x6af8, 0x6af4, 
-    /* 0x00005060: */ 0x6af0, 0x6aec, 0x6ae9, 0x6ae5, 0x6ae1, 0x6add, 0x6ada, 0x6ad6, 0x6ad2, 0x6ace, 0x6aca, 0x6ac7, 0x6ac3, 0x6abf, 0x6abb, 0x6ab7, 
-    /* 0x00005080: */ 0x6ab4, 0x6ab0, 0x6aac, 0x6aa8, 0x6aa5, 0x6aa1, 0x6a9d, 0x6a99, 0x6a95, 0x6a92, 0x6a8e, 0x6a8a, 0x6a86, 0x6a82, 0x6a7f, 0x6a7b, 
-    /* 0x000050a0: */ 0x6a77, 0x6a73, 0x6a6f, 0x6a6c, 0x6a68, 0x6a64, 0x6a60, 0x6a5c, 0x6a58, 0x6a55, 0x6a51, 0x6a4d, 0x6a49, 0x6a45, 0x6a42, 0x6a3e, 
-    /* 0x000050c0: */ 0x6a3a, 0x6a36, 0x6a32, 0x6a2e, 0x6a2b, 0x6a27, 0x6a23, 0x6a1f, 0x6a1b, 0x6a17, 0x6a14, 0x6a10, 0x6a0c, 0x6a08, 0x6a04, 0x6a00, 
-    /* 0x000050e0: */ 0x69fd, 0x69f9, 0x69f5, 0x69f1, 0x69ed, 0x69e9, 0x69e6, 0x69e2, 0x69de, 0x69da, 0x69d6, 0x69d2, 0x69ce, 0x69cb, 0x69c7, 0x69c3, 
-    /* 0x00005100: */ 0x69bf, 0x69bb, 0x69b7, 0x69b3, 0x69af, 0x69ac, 0x69a8, 0x69a4, 0x69a0, 0x699c, 0x6998, 0x6994, 0x6990, 0x698d, 0x6989, 0x6985, 
-    /* 0x00005120: */ 0x6981, 0x697d, 0x6979, 0x6975, 0x6971, 0x696e, 0x696a, 0x6966, 0x6962, 0x695e, 0x695a, 0x6956, 0x6952, 0x694e, 0x694b, 0x6947, 
-    /* 0x00005140: */ 0x6943, 0x693f, 0x693b, 0x6937, 0x6933, 0x692f, 0x692b, 0x6927, 0x6923, 0x6920, 0x691c, 0x6918, 0x6914, 0x6910, 0x690c, 0x6908, 
-    /* 0x00005160: */ 0x6904, 0x6900, 0x68fc, 0x68f8, 0x68f4, 0x68f1, 0x68ed, 0x68e9, 0x68e5, 0x68e1, 0x68dd, 0x68d9, 0x68d5, 0x68d1, 0x68cd, 0x68c9, 
-    /* 0x00005180: */ 0x68c5, 0x68c1, 0x68bd, 0x68b9, 0x68b6, 0x68b2, 0x68ae, 0x68aa, 0x68a6, 0x68a2, 0x689e, 0x689a, 0x6896, 0x6892, 0x688e, 0x688a, 
-    /* 0x000051a0: */ 0x6886, 0x6882, 0x687e, 0x687a, 0x6876, 0x6872, 0x686e, 0x686a, 0x6866, 0x6862, 0x685f, 0x685b, 0x6857, 0x6853, 0x684f, 0x684b, 
-    /* 0x000051c0: */ 0x6847, 0x6843, 0x683f, 0x683b, 0x6837, 0x6833, 0x682f, 0x682b, 0x6827, 0x6823, 0x681f, 0x681b, 0x6817, 0x6813, 0x680f, 0x680b, 
-    /* 0x000051e0: */ 0x6807, 0x6803, 0x67ff, 0x67fb, 0x67f7, 0x67f3, 0x67ef, 0x67eb, 0x67e7, 0x67e3, 0x67df, 0x67db, 0x67d7, 0x67d3, 0x67cf, 0x67cb, 
-    /* 0x00005200: */ 0x67c7, 0x67c3, 0x67bf, 0x67bb, 0x67b7, 0x67b3, 0x67af, 0x67ab, 0x67a7, 0x67a3, 0x679f, 0x679b, 0x6797, 0x6793, 0x678f, 0x678b, 
-    /* 0x00005220: */ 0x6787, 0x6782, 0x677e, 0x677a, 0x6776, 0x6772, 0x676e, 0x676a, 0x6766, 0x6762, 0x675e, 0x675a, 0x6756, 0x6752, 0x674e, 0x674a, 
-    /* 0x00005240: */ 0x6746, 0x6742, 0x673e, 0x673a, 0x6736, 0x6732, 0x672e, 0x6729, 0x6725, 0x6721, 0x671d, 0x6719, 0x6715, 0x6711, 0x670d, 0x6709, 
-    /* 0x00005260: */ 0x6705, 0x6701, 0x66fd, 0x66f9, 0x66f5, 0x66f1, 0x66ec, 0x66e8, 0x66e4, 0x66e0, 0x66dc, 0x66d8, 0x66d4, 0x66d0, 0x66cc, 0x66c8, 
-    /* 0x00005280: */ 0x66c4, 0x66c0, 0x66bb, 0x66b7, 0x66b3, 0x66af, 0x66ab, 0x66a7, 0x66a3, 0x669f, 0x669b, 0x6697, 0x6693, 0x668e, 0x668a, 0x6686, 
-    /* 0x000052a0: */ 0x6682, 0x667e, 0x667a, 0x6676, 0x6672, 0x666e, 0x6669, 0x6665, 0x6661, 0x665d, 0x6659, 0x6655, 0x6651, 0x664d, 0x6649, 0x6644, 
-    /* 0x000052c0: */ 0x6640, 0x663c, 0x6638, 0x6634, 0x6630, 0x662c, 0x6628, 0x6623, 0x661f, 0x661b, 0x6617, 0x6613, 0x660f, 0x660b, 0x6606, 0x6602, 
-    /* 0x000052e0: */ 0x65fe, 0x65fa, 0x65f6, 0x65f2, 0x65ee, 0x65e9, 0x65e5, 0x65e1, 0x65dd, 0x65d9, 0x65d5, 0x65d1, 0x65cc, 0x65c8, 0x65c4, 0x65c0, 
-    /* 0x00005300: */ 0x65bc, 0x65b8, 0x65b3, 0x65af, 0x65ab, 0x65a7, 0x65a3, 0x659f, 0x659a, 0x6596, 0x6592, 0x658e, 0x658a, 0x6586, 0x6581, 0x657d, 
-    /* 0x00005320: */ 0x6579, 0x6575, 0x6571, 0x656c, 0x6568, 0x6564, 0x6560, 0x655c, 0x6558, 0x6553, 0x654f, 0x654b, 0x6547, 0x6543, 0x653e, 0x653a, 
-    /* 0x00005340: */ 0x6536, 0x6532, 0x652e, 0x6529, 0x6525, 0x6521, 0x651d, 0x6519, 0x6514, 0x6510, 0x650c, 0x6508, 0x6504, 0x64ff, 0x64fb, 0x64f7, 
-    /* 0x00005360: */ 0x64f3, 0x64ef, 0x64ea, 0x64e6, 0x64e2, 0x64de, 0x64d9, 0x64d5, 0x64d1, 0x64cd, 0x64c9, 0x64c4, 0x64c0, 0x64bc, 0x64b8, 0x64b3, 
-    /* 0x00005380: */ 0x64af, 0x64ab, 0x64a7, 0x64a2, 0x649e, 0x649a, 0x6496, 0x6492, 0x648d, 0x6489, 0x6485, 0x6481, 0x647c, 0x6478, 0x6474, 0x6470, 
-    /* 0x000053a0: */ 0x646b, 0x6467, 0x6463, 0x645f, 0x645a, 0x6456, 0x6452, 0x644e, 0x6449, 0x6445, 0x6441, 0x643c, 0x6438, 0x6434, 0x6430, 0x642b, 
-    /* 0x000053c0: */ 0x6427, 0x6423, 0x641f, 0x641a, 0x6416, 0x6412, 0x640d, 0x6409, 0x6405, 0x6401, 0x63fc, 0x63f8, 0x63f4, 0x63f0, 0x63eb, 0x63e7, 
-    /* 0x000053e0: */ 0x63e3, 0x63de, 0x63da, 0x63d6, 0x63d2, 0x63cd, 0x63c9, 0x63c5, 0x63c0, 0x63bc, 0x63b8, 0x63b3, 0x63af, 0x63ab, 0x63a7, 0x63a2, 
-    /* 0x00005400: */ 0x639e, 0x639a, 0x6395, 0x6391, 0x638d, 0x6388, 0x6384, 0x6380, 0x637b, 0x6377, 0x6373, 0x636f, 0x636a, 0x6366, 0x6362, 0x635d, 
-    /* 0x00005420: */ 0x6359, 0x6355, 0x6350, 0x634c, 0x6348, 0x6343, 0x633f, 0x633b, 0x6336, 0x6332, 0x632e, 0x6329, 0x6325, 0x6321, 0x631c, 0x6318, 
-    /* 0x00005440: */ 0x6314, 0x630f, 0x630b, 0x6307, 0x6302, 0x62fe, 0x62fa, 0x62f5, 0x62f1, 0x62ed, 0x62e8, 0x62e4, 0x62df, 0x62db, 0x62d7, 0x62d2, 
-    /* 0x00005460: */ 0x62ce, 0x62ca, 0x62c5, 0x62c1, 0x62bd, 0x62b8, 0x62b4, 0x62b0, 0x62ab, 0x62a7, 0x62a2, 0x629e, 0x629a, 0x6295, 0x6291, 0x628d, 
-    /* 0x00005480: */ 0x6288, 0x6284, 0x627f, 0x627b, 0x6277, 0x6272, 0x626e, 0x626a, 0x6265, 0x6261, 0x625c, 0x6258, 0x6254, 0x624f, 0x624b, 0x6246, 
-    /* 0x000054a0: */ 0x6242, 0x623e, 0x6239, 0x6235, 0x6230, 0x622c, 0x6228, 0x6223, 0x621f, 0x621a, 0x6216, 0x6212, 0x620d, 0x6209, 0x6204, 0x6200, 
-    /* 0x000054c0: */ 0x61fc, 0x61f7, 0x61f3, 0x61ee, 0x61ea, 0x61e6, 0x61e1, 0x61dd, 0x61d8, 0x61d4, 0x61cf, 0x61cb, 0x61c7, 0x61c2, 0x61be, 0x61b9, 
-    /* 0x000054e0: */ 0x61b5, 0x61b0, 0x61ac, 0x61a8, 0x61a3, 0x619f, 0x619a, 0x6196, 0x6191, 0x618d, 0x6189, 0x6184, 0x6180, 0x617b, 0x6177, 0x6172, 
-    /* 0x00005500: */ 0x616e, 0x6169, 0x6165, 0x6161, 0x615c, 0x6158, 0x6153, 0x614f, 0x614a, 0x6146, 0x6141, 0x613d, 0x6138, 0x6134, 0x6130, 0x612b, 
-    /* 0x00005520: */ 0x6127, 0x6122, 0x611e, 0x6119, 0x6115, 0x6110, 0x610c, 0x6107, 0x6103, 0x60fe, 0x60fa, 0x60f5, 0x60f1, 0x60ec, 0x60e8, 0x60e4, 
-    /* 0x00005540: */ 0x60df, 0x60db, 0x60d6, 0x60d2, 0x60cd, 0x60c9, 0x60c4, 0x60c0, 0x60bb, 0x60b7, 0x60b2, 0x60ae, 0x60a9, 0x60a5, 0x60a0, 0x609c, 
-    /* 0x00005560: */ 0x6097, 0x6093, 0x608e, 0x608a, 0x6085, 0x6081, 0x607c, 0x6078, 0x6073, 0x606f, 0x606a, 0x6066, 0x6061, 0x605d, 0x6058, 0x6054, 
-    /* 0x00005580: */ 0x604f, 0x604b, 0x6046, 0x6042, 0x603d, 0x6038, 0x6034, 0x602f, 0x602b, 0x6026, 0x6022, 0x601d, 0x6019, 0x6014, 0x6010, 0x600b, 
-    /* 0x000055a0: */ 0x6007, 0x6002, 0x5ffe, 0x5ff9, 0x5ff5, 0x5ff0, 0x5feb, 0x5fe7, 0x5fe2, 0x5fde, 0x5fd9, 0x5fd5, 0x5fd0, 0x5fcc, 0x5fc7, 0x5fc3, 
-    /* 0x000055c0: */ 0x5fbe, 0x5fb9, 0x5fb5, 0x5fb0, 0x5fac, 0x5fa7, 0x5fa3, 0x5f9e, 0x5f9a, 0x5f95, 0x5f90, 0x5f8c, 0x5f87, 0x5f83, 0x5f7e, 0x5f7a, 
-    /* 0x000055e0: */ 0x5f75, 0x5f71, 0x5f6c, 0x5f67, 0x5f63, 0x5f5e, 0x5f5a, 0x5f55, 0x5f51, 0x5f4c, 0x5f47, 0x5f43, 0x5f3e, 0x5f3a, 0x5f35, 0x5f30, 
-    /* 0x00005600: */ 0x5f2c, 0x5f27, 0x5f23, 0x5f1e, 0x5f1a, 0x5f15, 0x5f10, 0x5f0c, 0x5f07, 0x5f03, 0x5efe, 0x5ef9, 0x5ef5, 0x5ef0, 0x5eec, 0x5ee7, 
-    /* 0x00005620: */ 0x5ee2, 0x5ede, 0x5ed9, 0x5ed5, 0x5ed0, 0x5ecb, 0x5ec7, 0x5ec2, 0x5ebe, 0x5eb9, 0x5eb4, 0x5eb0, 0x5eab, 0x5ea6, 0x5ea2, 0x5e9d, 
-    /* 0x00005640: */ 0x5e99, 0x5e94, 0x5e8f, 0x5e8b, 0x5e86, 0x5e82, 0x5e7d, 0x5e78, 0x5e74, 0x5e6f, 0x5e6a, 0x5e66, 0x5e61, 0x5e5d, 0x5e58, 0x5e53, 
-    /* 0x00005660: */ 0x5e4f, 0x5e4a, 0x5e45, 0x5e41, 0x5e3c, 0x5e37, 0x5e33, 0x5e2e, 0x5e29, 0x5e25, 0x5e20, 0x5e1c, 0x5e17, 0x5e12, 0x5e0e, 0x5e09, 
-    /* 0x00005680: */ 0x5e04, 0x5e00, 0x5dfb, 0x5df6, 0x5df2, 0x5ded, 0x5de8, 0x5de4, 0x5ddf, 0x5dda, 0x5dd6, 0x5dd1, 0x5dcc, 0x5dc8, 0x5dc3, 0x5dbe, 
-    /* 0x000056a0: */ 0x5dba, 0x5db5, 0x5db0, 0x5dac, 0x5da7, 0x5da2, 0x5d9e, 0x5d99, 0x5d94, 0x5d90, 0x5d8b, 0x5d86, 0x5d82, 0x5d7d, 0x5d78, 0x5d74, 
-    /* 0x000056c0: */ 0x5d6f, 0x5d6a, 0x5d66, 0x5d61, 0x5d5c, 0x5d57, 0x5d53, 0x5d4e, 0x5d49, 0x5d45, 0x5d40, 0x5d3b, 0x5d37, 0x5d32, 0x5d2d, 0x5d29, 
-    /* 0x000056e0: */ 0x5d24, 0x5d1f, 0x5d1a, 0x5d16, 0x5d11, 0x5d0c, 0x5d08, 0x5d03, 0x5cfe, 0x5cf9, 0x5cf5, 0x5cf0, 0x5ceb, 0x5ce7, 0x5ce2, 0x5cdd, 
-    /* 0x00005700: */ 0x5cd8, 0x5cd4, 0x5ccf, 0x5cca, 0x5cc6, 0x5cc1, 0x5cbc, 0x5cb7, 0x5cb3, 0x5cae, 0x5ca9, 0x5ca4, 0x5ca0, 0x5c9b, 0x5c96, 0x5c92, 
-    /* 0x00005720: */ 0x5c8d, 0x5c88, 0x5c83, 0x5c7f, 0x5c7a, 0x5c75, 0x5c70, 0x5c6c, 0x5c67, 0x5c62, 0x5c5d, 0x5c59, 0x5c54, 0x5c4f, 0x5c4a, 0x5c46, 
-    /* 0x00005740: */ 0x5c41, 0x5c3c, 0x5c37, 0x5c33, 0x5c2e, 0x5c29, 0x5c24, 0x5c20, 0x5c1b, 0x5c16, 0x5c11, 0x5c0d, 0x5c08, 0x5c03, 0x5bfe, 0x5bf9, 
-    /* 0x00005760: */ 0x5bf5, 0x5bf0, 0x5beb, 0x5be6, 0x5be2, 0x5bdd, 0x5bd8, 0x5bd3, 0x5bcf, 0x5bca, 0x5bc5, 0x5bc0, 0x5bbb, 0x5bb7, 0x5bb2, 0x5bad, 
-    /* 0x00005780: */ 0x5ba8, 0x5ba4, 0x5b9f, 0x5b9a, 0x5b95, 0x5b90, 0x5b8c, 0x5b87, 0x5b82, 0x5b7d, 0x5b78, 0x5b74, 0x5b6f, 0x5b6a, 0x5b65, 0x5b60, 
-    /* 0x000057a0: */ 0x5b5c, 0x5b57, 0x5b52, 0x5b4d, 0x5b48, 0x5b44, 0x5b3f, 0x5b3a, 0x5b35, 0x5b30, 0x5b2c, 0x5b27, 0x5b22, 0x5b1d, 0x5b18, 0x5b13, 
-    /* 0x000057c0: */ 0x5b0f, 0x5b0a, 0x5b05, 0x5b00, 0x5afb, 0x5af7, 0x5af2, 0x5aed, 0x5ae8, 0x5ae3, 0x5ade, 0x5ada, 0x5ad5, 0x5ad0, 0x5acb, 0x5ac6, 
-    /* 0x000057e0: */ 0x5ac1, 0x5abd, 0x5ab8, 0x5ab3, 0x5aae, 0x5aa9, 0x5aa4, 0x5aa0, 0x5a9b, 0x5a96, 0x5a91, 0x5a8c, 0x5a87, 0x5a82, 0x5a7e, 0x5a79, 
-    /* 0x00005800: */ 0x5a74, 0x5a6f, 0x5a6a, 0x5a65, 0x5a61, 0x5a5c, 0x5a57, 0x5a52, 0x5a4d, 0x5a48, 0x5a43, 0x5a3f, 0x5a3a, 0x5a35, 0x5a30, 0x5a2b, 
-    /* 0x00005820: */ 0x5a26, 0x5a21, 0x5a1c, 0x5a18, 0x5a13, 0x5a0e, 0x5a09, 0x5a04, 0x59ff, 0x59fa, 0x59f5, 0x59f1, 0x59ec, 0x59e7, 0x59e2, 0x59dd, 
-    /* 0x00005840: */ 0x59d8, 0x59d3, 0x59ce, 0x59ca, 0x59c5, 0x59c0, 0x59bb, 0x59b6, 0x59b1, 0x59ac, 0x59a7, 0x59a2, 0x599e, 0x5999, 0x5994, 0x598f, 
-    /* 0x00005860: */ 0x598a, 0x5985, 0x5980, 0x597b, 0x5976, 0x5971, 0x596d, 0x5968, 0x5963, 0x595e, 0x5959, 0x5954, 0x594f, 0x594a, 0x5945, 0x5940, 
-    /* 0x00005880: */ 0x593b, 0x5937, 0x5932, 0x592d, 0x5928, 0x5923, 0x591e, 0x5919, 0x5914, 0x590f, 0x590a, 0x5905, 0x5900, 0x58fb, 0x58f7, 0x58f2, 
-    /* 0x000058a0: */ 0x58ed, 0x58e8, 0x58e3, 0x58de, 0x58d9, 0x58d4, 0x58cf, 0x58ca, 0x58c5, 0x58c0, 0x58bb, 0x58b6, 0x58b1, 0x58ac, 0x58a8, 0x58a3, 
-    /* 0x000058c0: */ 0x589e, 0x5899, 0x5894, 0x588f, 0x588a, 0x5885, 0x5880, 0x587b, 0x5876, 0x5871, 0x586c, 0x5867, 0x5862, 0x585d, 0x5858, 0x5853, 
-    /* 0x000058e0: */ 0x584e, 0x5849, 0x5844, 0x583f, 0x583a, 0x5836, 0x5831, 0x582c, 0x5827, 0x5822, 0x581d, 0x5818, 0x5813, 0x580e, 0x5809, 0x5804, 
-    /* 0x00005900: */ 0x57ff, 0x57fa, 0x57f5, 0x57f0, 0x57eb, 0x57e6, 0x57e1, 0x57dc, 0x57d7, 0x57d2, 0x57cd, 0x57c8, 0x57c3, 0x57be, 0x57b9, 0x57b4, 
-    /* 0x00005920: */ 0x57af, 0x57aa, 0x57a5, 0x57a0, 0x579b, 0x5796, 0x5791, 0x578c, 0x5787, 0x5782, 0x577d, 0x5778, 0x5773, 0x576e, 0x5769, 0x5764, 
-    /* 0x00005940: */ 0x575f, 0x575a, 0x5755, 0x5750, 0x574b, 0x5746, 0x5741, 0x573c, 0x5737, 0x5732, 0x572d, 0x5728, 0x5723, 0x571e, 0x5719, 0x5714, 
-    /* 0x00005960: */ 0x570f, 0x570a, 0x5705, 0x5700, 0x56fb, 0x56f6, 0x56f1, 0x56ec, 0x56e6, 0x56e1, 0x56dc, 0x56d7, 0x56d2, 0x56cd, 0x56c8, 0x56c3, 
-    /* 0x00005980: */ 0x56be, 0x56b9, 0x56b4, 0x56af, 0x56aa, 0x56a5, 0x56a0, 0x569b, 0x5696, 0x5691, 0x568c, 0x5687, 0x5682, 0x567d, 0x5678, 0x5672, 
-    /* 0x000059a0: */ 0x566d, 0x5668, 0x5663, 0x565e, 0x5659, 0x5654, 0x564f, 0x564a, 0x5645, 0x5640, 0x563b, 0x5636, 0x5631, 0x562c, 0x5627, 0x5621, 
-    /* 0x000059c0: */ 0x561c, 0x5617, 0x5612, 0x560d, 0x5608, 0x5603, 0x55fe, 0x55f9, 0x55f4, 0x55ef, 0x55ea, 0x55e5, 0x55df, 0x55da, 0x55d5, 0x55d0, 
-    /* 0x000059e0: */ 0x55cb, 0x55c6, 0x55c1, 0x55bc, 0x55b7, 0x55b2, 0x55ad, 0x55a7, 0x55a2, 0x559d, 0x5598, 0x5593, 0x558e, 0x5589, 0x5584, 0x557f, 
-    /* 0x00005a00: */ 0x557a, 0x5574, 0x556f, 0x556a, 0x5565, 0x5560, 0x555b, 0x5556, 0x5551, 0x554c, 0x5546, 0x5541, 0x553c, 0x5537, 0x5532, 0x552d, 
-    /* 0x00005a20: */ 0x5528, 0x5523, 0x551e, 0x5518, 0x5513, 0x550e, 0x5509, 0x5504, 0x54ff, 0x54fa, 0x54f5, 0x54ef, 0x54ea, 0x54e5, 0x54e0, 0x54db, 
-    /* 0x00005a40: */ 0x54d6, 0x54d1, 0x54cc, 0x54c6, 0x54c1, 0x54bc, 0x54b7, 0x54b2, 0x54ad, 0x54a8, 0x54a2, 0x549d, 0x5498, 0x5493, 0x548e, 0x5489, 
-    /* 0x00005a60: */ 0x5484, 0x547e, 0x5479, 0x5474, 0x546f, 0x546a, 0x5465, 0x545f, 0x545a, 0x5455, 0x5450, 0x544b, 0x5446, 0x5441, 0x543b, 0x5436, 
-    /* 0x00005a80: */ 0x5431, 0x542c, 0x5427, 0x5422, 0x541c, 0x5417, 0x5412, 0x540d, 0x5408, 0x5403, 0x53fd, 0x53f8, 0x53f3, 0x53ee, 0x53e9, 0x53e3, 
-    /* 0x00005aa0: */ 0x53de, 0x53d9, 0x53d4, 0x53cf, 0x53ca, 0x53c4, 0x53bf, 0x53ba, 0x53b5, 0x53b0, 0x53aa, 0x53a5, 0x53a0, 0x539b, 0x5396, 0x5390, 
-    /* 0x00005ac0: */ 0x538b, 0x5386, 0x5381, 0x537c, 0x5377, 0x5371, 0x536c, 0x5367, 0x5362, 0x535d, 0x5357, 0x5352, 0x534d, 0x5348, 0x5342, 0x533d, 
-    /* 0x00005ae0: */ 0x5338, 0x5333, 0x532e, 0x5328, 0x5323, 0x531e, 0x5319, 0x5314, 0x530e, 0x5309, 0x5304, 0x52ff, 0x52f9, 0x52f4, 0x52ef, 0x52ea, 
-    /* 0x00005b00: */ 0x52e5, 0x52df, 0x52da, 0x52d5, 0x52d0, 0x52ca, 0x52c5, 0x52c0, 0x52bb, 0x52b6, 0x52b0, 0x52ab, 0x52a6, 0x52a1, 0x529b, 0x5296, 
-    /* 0x00005b20: */ 0x5291, 0x528c, 0x5286, 0x5281, 0x527c, 0x5277, 0x5271, 0x526c, 0x5267, 0x5262, 0x525c, 0x5257, 0x5252, 0x524d, 0x5247, 0x5242, 
-    /* 0x00005b40: */ 0x523d, 0x5238, 0x5232, 0x522d, 0x5228, 0x5223, 0x521d, 0x5218, 0x5213, 0x520e, 0x5208, 0x5203, 0x51fe, 0x51f9, 0x51f3, 0x51ee, 
-    /* 0x00005b60: */ 0x51e9, 0x51e4, 0x51de, 0x51d9, 0x51d4, 0x51ce, 0x51c9, 0x51c4, 0x51bf, 0x51b9, 0x51b4, 0x51af, 0x51aa, 0x51a4, 0x519f, 0x519a, 
-    /* 0x00005b80: */ 0x5194, 0x518f, 0x518a, 0x5185, 0x517f, 0x517a, 0x5175, 0x516f, 0x516a, 0x5165, 0x5160, 0x515a, 0x5155, 0x5150, 0x514a, 0x5145, 
-    /* 0x00005ba0: */ 0x5140, 0x513a, 0x5135, 0x5130, 0x512b, 0x5125, 0x5120, 0x511b, 0x5115, 0x5110, 0x510b, 0x5105, 0x5100, 0x50fb, 0x50f5, 0x50f0, 
-    /* 0x00005bc0: */ 0x50eb, 0x50e6, 0x50e0, 0x50db, 0x50d6, 0x50d0, 0x50cb, 0x50c6, 0x50c0, 0x50bb, 0x50b6, 0x50b0, 0x50ab, 0x50a6, 0x50a0, 0x509b, 
-    /* 0x00005be0: */ 0x5096, 0x5090, 0x508b, 0x5086, 0x5080, 0x507b, 0x5076, 0x5070, 0x506b, 0x5066, 0x5060, 0x505b, 0x5056, 0x5050, 0x504b, 0x5046, 
-    /* 0x00005c00: */ 0x5040, 0x503b, 0x5036, 0x5030, 0x502b, 0x5026, 0x5020, 0x501b, 0x5016, 0x5010, 0x500b, 0x5006, 0x5000, 0x4ffb, 0x4ff6, 0x4ff0, 
-    /* 0x00005c20: */ 0x4feb, 0x4fe6, 0x4fe0, 0x4fdb, 0x4fd5, 0x4fd0, 0x4fcb, 0x4fc5, 0x4fc0, 0x4fbb, 0x4fb5, 0x4fb0, 0x4fab, 0x4fa5, 0x4fa0, 0x4f9a, 
-    /* 0x00005c40: */ 0x4f95, 0x4f90, 0x4f8a, 0x4f85, 0x4f80, 0x4f7a, 0x4f75, 0x4f6f, 0x4f6a, 0x4f65, 0x4f5f, 0x4f5a, 0x4f55, 0x4f4f, 0x4f4a, 0x4f44, 
-    /* 0x00005c60: */ 0x4f3f, 0x4f3a, 0x4f34, 0x4f2f, 0x4f29, 0x4f24, 0x4f1f, 0x4f19, 0x4f14, 0x4f0f, 0x4f09, 0x4f04, 0x4efe, 0x4ef9, 0x4ef4, 0x4eee, 
-    /* 0x00005c80: */ 0x4ee9, 0x4ee3, 0x4ede, 0x4ed9, 0x4ed3, 0x4ece, 0x4ec8, 0x4ec3, 0x4ebe, 0x4eb8, 0x4eb3, 0x4ead, 0x4ea8, 0x4ea3, 0x4e9d, 0x4e98, 
-    /* 0x00005ca0: */ 0x4e92, 0x4e8d, 0x4e87, 0x4e82, 0x4e7d, 0x4e77, 0x4e72, 0x4e6c, 0x4e67, 0x4e62, 0x4e5c, 0x4e57, 0x4e51, 0x4e4c, 0x4e46, 0x4e41, 
-    /* 0x00005cc0: */ 0x4e3c, 0x4e36, 0x4e31, 0x4e2b, 0x4e26, 0x4e20, 0x4e1b, 0x4e16, 0x4e10, 0x4e0b, 0x4e05, 0x4e00, 0x4dfa, 0x4df5, 0x4df0, 0x4dea, 
-    /* 0x00005ce0: */ 0x4de5, 0x4ddf, 0x4dda, 0x4dd4, 0x4dcf, 0x4dc9, 0x4dc4, 0x4dbf, 0x4db9, 0x4db4, 0x4dae, 0x4da9, 0x4da3, 0x4d9e, 0x4d98, 0x4d93, 
-    /* 0x00005d00: */ 0x4d8e, 0x4d88, 0x4d83, 0x4d7d, 0x4d78, 0x4d72, 0x4d6d, 0x4d67, 0x4d62, 0x4d5c, 0x4d57, 0x4d51, 0x4d4c, 0x4d47, 0x4d41, 0x4d3c, 
-    /* 0x00005d20: */ 0x4d36, 0x4d31, 0x4d2b, 0x4d26, 0x4d20, 0x4d1b, 0x4d15, 0x4d10, 0x4d0a, 0x4d05, 0x4cff, 0x4cfa, 0x4cf4, 0x4cef, 0x4cea, 0x4ce4, 
-    /* 0x00005d40: */ 0x4cdf, 0x4cd9, 0x4cd4, 0x4cce, 0x4cc9, 0x4cc3, 0x4cbe, 0x4cb8, 0x4cb3, 0x4cad, 0x4ca8, 0x4ca2, 0x4c9d, 0x4c97, 0x4c92, 0x4c8c, 
-    /* 0x00005d60: */ 0x4c87, 0x4c81, 0x4c7c, 0x4c76, 0x4c71, 0x4c6b, 0x4c66, 0x4c60, 0x4c5b, 0x4c55, 0x4c50, 0x4c4a, 0x4c45, 0x4c3f, 0x4c3a, 0x4c34, 
-    /* 0x00005d80: */ 0x4c2f, 0x4c29, 0x4c24, 0x4c1e, 0x4c19, 0x4c13, 0x4c0e, 0x4c08, 0x4c03, 0x4bfd, 0x4bf8, 0x4bf2, 0x4bed, 0x4be7, 0x4be1, 0x4bdc, 
-    /* 0x00005da0: */ 0x4bd6, 0x4bd1, 0x4bcb, 0x4bc6, 0x4bc0, 0x4bbb, 0x4bb5, 0x4bb0, 0x4baa, 0x4ba5, 0x4b9f, 0x4b9a, 0x4b94, 0x4b8f, 0x4b89, 0x4b83, 
-    /* 0x00005dc0: */ 0x4b7e, 0x4b78, 0x4b73, 0x4b6d, 0x4b68, 0x4b62, 0x4b5d, 0x4b57, 0x4b52, 0x4b4c, 0x4b47, 0x4b41, 0x4b3b, 0x4b36, 0x4b30, 0x4b2b, 
-    /* 0x00005de0: */ 0x4b25, 0x4b20, 0x4b1a, 0x4b15, 0x4b0f, 0x4b0a, 0x4b04, 0x4afe, 0x4af9, 0x4af3, 0x4aee, 0x4ae8, 0x4ae3, 0x4add, 0x4ad7, 0x4ad2, 
-    /* 0x00005e00: */ 0x4acc, 0x4ac7, 0x4ac1, 0x4abc, 0x4ab6, 0x4ab1, 0x4aab, 0x4aa5, 0x4aa0, 0x4a9a, 0x4a95, 0x4a8f, 0x4a8a, 0x4a84, 0x4a7e, 0x4a79, 
-    /* 0x00005e20: */ 0x4a73, 0x4a6e, 0x4a68, 0x4a63, 0x4a5d, 0x4a57, 0x4a52, 0x4a4c, 0x4a47, 0x4a41, 0x4a3b, 0x4a36, 0x4a30, 0x4a2b, 0x4a25, 0x4a1f, 
-    /* 0x00005e40: */ 0x4a1a, 0x4a14, 0x4a0f, 0x4a09, 0x4a04, 0x49fe, 0x49f8, 0x49f3, 0x49ed, 0x49e8, 0x49e2, 0x49dc, 0x49d7, 0x49d1, 0x49cc, 0x49c6, 
-    /* 0x00005e60: */ 0x49c0, 0x49bb, 0x49b5, 0x49b0, 0x49aa, 0x49a4, 0x499f, 0x4999, 0x4994, 0x498e, 0x4988, 0x4983, 0x497d, 0x4977, 0x4972, 0x496c, 
-    /* 0x00005e80: */ 0x4967, 0x4961, 0x495b, 0x4956, 0x4950, 0x494b, 0x4945, 0x493f, 0x493a, 0x4934, 0x492e, 0x4929, 0x4923, 0x491e, 0x4918, 0x4912, 
-    /* 0x00005ea0: */ 0x490d, 0x4907, 0x4901, 0x48fc, 0x48f6, 0x48f0, 0x48eb, 0x48e5, 0x48e0, 0x48da, 0x48d4, 0x48cf, 0x48c9, 0x48c3, 0x48be, 0x48b8, 
-    /* 0x00005ec0: */ 0x48b2, 0x48ad, 0x48a7, 0x48a2, 0x489c, 0x4896, 0x4891, 0x488b, 0x4885, 0x4880, 0x487a, 0x4874, 0x486f, 0x4869, 0x4863, 0x485e, 
-    /* 0x00005ee0: */ 0x4858, 0x4852, 0x484d, 0x4847, 0x4841, 0x483c, 0x4836, 0x4830, 0x482b, 0x4825, 0x481f, 0x481a, 0x4814, 0x480e, 0x4809, 0x4803, 
-    /* 0x00005f00: */ 0x47fd, 0x47f8, 0x47f2, 0x47ec, 0x47e7, 0x47e1, 0x47db, 0x47d6, 0x47d0, 0x47ca, 0x47c5, 0x47bf, 0x47b9, 0x47b4, 0x47ae, 0x47a8, 
-    /* 0x00005f20: */ 0x47a3, 0x479d, 0x4797, 0x4792, 0x478c, 0x4786, 0x4781, 0x477b, 0x4775, 0x4770, 0x476a, 0x4764, 0x475e, 0x4759, 0x4753, 0x474d, 
-    /* 0x00005f40: */ 0x4748, 0x4742, 0x473c, 0x4737, 0x4731, 0x472b, 0x4725, 0x4720, 0x471a, 0x4714, 0x470f, 0x4709, 0x4703, 0x46fe, 0x46f8, 0x46f2, 
-    /* 0x00005f60: */ 0x46ec, 0x46e7, 0x46e1, 0x46db, 0x46d6, 0x46d0, 0x46ca, 0x46c4, 0x46bf, 0x46b9, 0x46b3, 0x46ae, 0x46a8, 0x46a2, 0x469c, 0x4697, 
-    /* 0x00005f80: */ 0x4691, 0x468b, 0x4686, 0x4680, 0x467a, 0x4674, 0x466f, 0x4669, 0x4663, 0x465e, 0x4658, 0x4652, 0x464c, 0x4647, 0x4641, 0x463b, 
-    /* 0x00005fa0: */ 0x4635, 0x4630, 0x462a, 0x4624, 0x461e, 0x4619, 0x4613, 0x460d, 0x4608, 0x4602, 0x45fc, 0x45f6, 0x45f1, 0x45eb, 0x45e5, 0x45df, 
-    /* 0x00005fc0: */ 0x45da, 0x45d4, 0x45ce, 0x45c8, 0x45c3, 0x45bd, 0x45b7, 0x45b1, 0x45ac, 0x45a6, 0x45a0, 0x459a, 0x4595, 0x458f, 0x4589, 0x4583, 
-    /* 0x00005fe0: */ 0x457e, 0x4578, 0x4572, 0x456c, 0x4567, 0x4561, 0x455b, 0x4555, 0x4550, 0x454a, 0x4544, 0x453e, 0x4538, 0x4533, 0x452d, 0x4527, 
-    /* 0x00006000: */ 0x4521, 0x451c, 0x4516, 0x4510, 0x450a, 0x4505, 0x44ff, 0x44f9, 0x44f3, 0x44ed, 0x44e8, 0x44e2, 0x44dc, 0x44d6, 0x44d1, 0x44cb, 
-    /* 0x00006020: */ 0x44c5, 0x44bf, 0x44b9, 0x44b4, 0x44ae, 0x44a8, 0x44a2, 0x449c, 0x4497, 0x4491, 0x448b, 0x4485, 0x4480, 0x447a, 0x4474, 0x446e, 
-    /* 0x00006040: */ 0x4468, 0x4463, 0x445d, 0x4457, 0x4451, 0x444b, 0x4446, 0x4440, 0x443a, 0x4434, 0x442e, 0x4429, 0x4423, 0x441d, 0x4417, 0x4411, 
-    /* 0x00006060: */ 0x440c, 0x4406, 0x4400, 0x43fa, 0x43f4, 0x43ee, 0x43e9, 0x43e3, 0x43dd, 0x43d7, 0x43d1, 0x43cc, 0x43c6, 0x43c0, 0x43ba, 0x43b4, 
-    /* 0x00006080: */ 0x43af, 0x43a9, 0x43a3, 0x439d, 0x4397, 0x4391, 0x438c, 0x4386, 0x4380, 0x437a, 0x4374, 0x436e, 0x4369, 0x4363, 0x435d, 0x4357, 
-    /* 0x000060a0: */ 0x4351, 0x434b, 0x4346, 0x4340, 0x433a, 0x4334, 0x432e, 0x4328, 0x4323, 0x431d, 0x4317, 0x4311, 0x430b, 0x4305, 0x4300, 0x42fa, 
-    /* 0x000060c0: */ 0x42f4, 0x42ee, 0x42e8, 0x42e2, 0x42dd, 0x42d7, 0x42d1, 0x42cb, 0x42c5, 0x42bf, 0x42b9, 0x42b4, 0x42ae, 0x42a8, 0x42a2, 0x429c, 
-    /* 0x000060e0: */ 0x4296, 0x4290, 0x428b, 0x4285, 0x427f, 0x4279, 0x4273, 0x426d, 0x4267, 0x4262, 0x425c, 0x4256, 0x4250, 0x424a, 0x4244, 0x423e, 
-    /* 0x00006100: */ 0x4239, 0x4233, 0x422d, 0x4227, 0x4221, 0x421b, 0x4215, 0x420f, 0x420a, 0x4204, 0x41fe, 0x41f8, 0x41f2, 0x41ec, 0x41e6, 0x41e0, 
-    /* 0x00006120: */ 0x41db, 0x41d5, 0x41cf, 0x41c9, 0x41c3, 0x41bd, 0x41b7, 0x41b1, 0x41ac, 0x41a6, 0x41a0, 0x419a, 0x4194, 0x418e, 0x4188, 0x4182, 
-    /* 0x00006140: */ 0x417c, 0x4177, 0x4171, 0x416b, 0x4165, 0x415f, 0x4159, 0x4153, 0x414d, 0x4147, 0x4142, 0x413c, 0x4136, 0x4130, 0x412a, 0x4124, 
-    /* 0x00006160: */ 0x411e, 0x4118, 0x4112, 0x410c, 0x4106, 0x4101, 0x40fb, 0x40f5, 0x40ef, 0x40e9, 0x40e3, 0x40dd, 0x40d7, 0x40d1, 0x40cb, 0x40c5, 
-    /* 0x00006180: */ 0x40c0, 0x40ba, 0x40b4, 0x40ae, 0x40a8, 0x40a2, 0x409c, 0x4096, 0x4090, 0x408a, 0x4084, 0x407e, 0x4079, 0x4073, 0x406d, 0x4067, 
-    /* 0x000061a0: */ 0x4061, 0x405b, 0x4055, 0x404f, 0x4049, 0x4043, 0x403d, 0x4037, 0x4031, 0x402c, 0x4026, 0x4020, 0x401a, 0x4014, 0x400e, 0x4008, 
-    /* 0x000061c0: */ 0x4002, 0x3ffc, 0x3ff6, 0x3ff0, 0x3fea, 0x3fe4, 0x3fde, 0x3fd8, 0x3fd2, 0x3fcd, 0x3fc7, 0x3fc1, 0x3fbb, 0x3fb5, 0x3faf, 0x3fa9, 
-    /* 0x000061e0: */ 0x3fa3, 0x3f9d, 0x3f97, 0x3f91, 0x3f8b, 0x3f85, 0x3f7f, 0x3f79, 0x3f73, 0x3f6d, 0x3f67, 0x3f61, 0x3f5b, 0x3f55, 0x3f50, 0x3f4a, 
-    /* 0x00006200: */ 0x3f44, 0x3f3e, 0x3f38, 0x3f32, 0x3f2c, 0x3f26, 0x3f20, 0x3f1a, 0x3f14, 0x3f0e, 0x3f08, 0x3f02, 0x3efc, 0x3ef6, 0x3ef0, 0x3eea, 
-    /* 0x00006220: */ 0x3ee4, 0x3ede, 0x3ed8, 0x3ed2, 0x3ecc, 0x3ec6, 0x3ec0, 0x3eba, 0x3eb4, 0x3eae, 0x3ea8, 0x3ea2, 0x3e9c, 0x3e96, 0x3e91, 0x3e8b, 
-    /* 0x00006240: */ 0x3e85, 0x3e7f, 0x3e79, 0x3e73, 0x3e6d, 0x3e67, 0x3e61, 0x3e5b, 0x3e55, 0x3e4f, 0x3e49, 0x3e43, 0x3e3d, 0x3e37, 0x3e31, 0x3e2b, 
-    /* 0x00006260: */ 0x3e25, 0x3e1f, 0x3e19, 0x3e13, 0x3e0d, 0x3e07, 0x3e01, 0x3dfb, 0x3df5, 0x3def, 0x3de9, 0x3de3, 0x3ddd, 0x3dd7, 0x3dd1, 0x3dcb, 
-    /* 0x00006280: */ 0x3dc5, 0x3dbf, 0x3db9, 0x3db3, 0x3dad, 0x3da7, 0x3da1, 0x3d9b, 0x3d95, 0x3d8f, 0x3d89, 0x3d83, 0x3d7d, 0x3d77, 0x3d71, 0x3d6b, 
-    /* 0x000062a0: */ 0x3d65, 0x3d5f, 0x3d59, 0x3d53, 0x3d4d, 0x3d47, 0x3d40, 0x3d3a, 0x3d34, 0x3d2e, 0x3d28, 0x3d22, 0x3d1c, 0x3d16, 0x3d10, 0x3d0a, 
-    /* 0x000062c0: */ 0x3d04, 0x3cfe, 0x3cf8, 0x3cf2, 0x3cec, 0x3ce6, 0x3ce0, 0x3cda, 0x3cd4, 0x3cce, 0x3cc8, 0x3cc2, 0x3cbc, 0x3cb6, 0x3cb0, 0x3caa, 
-    /* 0x000062e0: */ 0x3ca4, 0x3c9e, 0x3c98, 0x3c92, 0x3c8c, 0x3c86, 0x3c7f, 0x3c79, 0x3c73, 0x3c6d, 0x3c67, 0x3c61, 0x3c5b, 0x3c55, 0x3c4f, 0x3c49, 
-    /* 0x00006300: */ 0x3c43, 0x3c3d, 0x3c37, 0x3c31, 0x3c2b, 0x3c25, 0x3c1f, 0x3c19, 0x3c13, 0x3c0d, 0x3c07, 0x3c00, 0x3bfa, 0x3bf4, 0x3bee, 0x3be8, 
-    /* 0x00006320: */ 0x3be2, 0x3bdc, 0x3bd6, 0x3bd0, 0x3bca, 0x3bc4, 0x3bbe, 0x3bb8, 0x3bb2, 0x3bac, 0x3ba6, 0x3b9f, 0x3b99, 0x3b93, 0x3b8d, 0x3b87, 
-    /* 0x00006340: */ 0x3b81, 0x3b7b, 0x3b75, 0x3b6f, 0x3b69, 0x3b63, 0x3b5d, 0x3b57, 0x3b51, 0x3b4a, 0x3b44, 0x3b3e, 0x3b38, 0x3b32, 0x3b2c, 0x3b26, 
-    /* 0x00006360: */ 0x3b20, 0x3b1a, 0x3b14, 0x3b0e, 0x3b08, 0x3b02, 0x3afb, 0x3af5, 0x3aef, 0x3ae9, 0x3ae3, 0x3add, 0x3ad7, 0x3ad1, 0x3acb, 0x3ac5, 
-    /* 0x00006380: */ 0x3abf, 0x3ab8, 0x3ab2, 0x3aac, 0x3aa6, 0x3aa0, 0x3a9a, 0x3a94, 0x3a8e, 0x3a88, 0x3a82, 0x3a7c, 0x3a75, 0x3a6f, 0x3a69, 0x3a63, 
-    /* 0x000063a0: */ 0x3a5d, 0x3a57, 0x3a51, 0x3a4b, 0x3a45, 0x3a3f, 0x3a38, 0x3a32, 0x3a2c, 0x3a26, 0x3a20, 0x3a1a, 0x3a14, 0x3a0e, 0x3a08, 0x3a01, 
-    /* 0x000063c0: */ 0x39fb, 0x39f5, 0x39ef, 0x39e9, 0x39e3, 0x39dd, 0x39d7, 0x39d1, 0x39ca, 0x39c4, 0x39be, 0x39b8, 0x39b2, 0x39ac, 0x39a6, 0x39a0, 
-    /* 0x000063e0: */ 0x3999, 0x3993, 0x398d, 0x3987, 0x3981, 0x397b, 0x3975, 0x396f, 0x3968, 0x3962, 0x395c, 0x3956, 0x3950, 0x394a, 0x3944, 0x393e, 
-    /* 0x00006400: */ 0x3937, 0x3931, 0x392b, 0x3925, 0x391f, 0x3919, 0x3913, 0x390c, 0x3906, 0x3900, 0x38fa, 0x38f4, 0x38ee, 0x38e8, 0x38e1, 0x38db, 
-    /* 0x00006420: */ 0x38d5, 0x38cf, 0x38c9, 0x38c3, 0x38bd, 0x38b6, 0x38b0, 0x38aa, 0x38a4, 0x389e, 0x3898, 0x3892, 0x388b, 0x3885, 0x387f, 0x3879, 
-    /* 0x00006440: */ 0x3873, 0x386d, 0x3867, 0x3860, 0x385a, 0x3854, 0x384e, 0x3848, 0x3842, 0x383b, 0x3835, 0x382f, 0x3829, 0x3823, 0x381d, 0x3816, 
-    /* 0x00006460: */ 0x3810, 0x380a, 0x3804, 0x37fe, 0x37f8, 0x37f1, 0x37eb, 0x37e5, 0x37df, 0x37d9, 0x37d3, 0x37cc, 0x37c6, 0x37c0, 0x37ba, 0x37b4, 
-    /* 0x00006480: */ 0x37ae, 0x37a7, 0x37a1, 0x379b, 0x3795, 0x378f, 0x3789, 0x3782, 0x377c, 0x3776, 0x3770, 0x376a, 0x3763, 0x375d, 0x3757, 0x3751, 
-    /* 0x000064a0: */ 0x374b, 0x3745, 0x373e, 0x3738, 0x3732, 0x372c, 0x3726, 0x371f, 0x3719, 0x3713, 0x370d, 0x3707, 0x3701, 0x36fa, 0x36f4, 0x36ee, 
-    /* 0x000064c0: */ 0x36e8, 0x36e2, 0x36db, 0x36d5, 0x36cf, 0x36c9, 0x36c3, 0x36bc, 0x36b6, 0x36b0, 0x36aa, 0x36a4, 0x369d, 0x3697, 0x3691, 0x368b, 
-    /* 0x000064e0: */ 0x3685, 0x367e, 0x3678, 0x3672, 0x366c, 0x3666, 0x365f, 0x3659, 0x3653, 0x364d, 0x3647, 0x3640, 0x363a, 0x3634, 0x362e, 0x3627, 
-    /* 0x00006500: */ 0x3621, 0x361b, 0x3615, 0x360f, 0x3608, 0x3602, 0x35fc, 0x35f6, 0x35f0, 0x35e9, 0x35e3, 0x35dd, 0x35d7, 0x35d0, 0x35ca, 0x35c4, 
-    /* 0x00006520: */ 0x35be, 0x35b8, 0x35b1, 0x35ab, 0x35a5, 0x359f, 0x3598, 0x3592, 0x358c, 0x3586, 0x3580, 0x3579, 0x3573, 0x356d, 0x3567, 0x3560, 
-    /* 0x00006540: */ 0x355a, 0x3554, 0x354e, 0x3547, 0x3541, 0x353b, 0x3535, 0x352f, 0x3528, 0x3522, 0x351c, 0x3516, 0x350f, 0x3509, 0x3503, 0x34fd, 
-    /* 0x00006560: */ 0x34f6, 0x34f0, 0x34ea, 0x34e4, 0x34dd, 0x34d7, 0x34d1, 0x34cb, 0x34c4, 0x34be, 0x34b8, 0x34b2, 0x34ab, 0x34a5, 0x349f, 0x3499, 
-    /* 0x00006580: */ 0x3492, 0x348c, 0x3486, 0x3480, 0x3479, 0x3473, 0x346d, 0x3467, 0x3460, 0x345a, 0x3454, 0x344e, 0x3447, 0x3441, 0x343b, 0x3435, 
-    /* 0x000065a0: */ 0x342e, 0x3428, 0x3422, 0x341c, 0x3415, 0x340f, 0x3409, 0x3403, 0x33fc, 0x33f6, 0x33f0, 0x33e9, 0x33e3, 0x33dd, 0x33d7, 0x33d0, 
-    /* 0x000065c0: */ 0x33ca, 0x33c4, 0x33be, 0x33b7, 0x33b1, 0x33ab, 0x33a4, 0x339e, 0x3398, 0x3392, 0x338b, 0x3385, 0x337f, 0x3379, 0x3372, 0x336c, 
-    /* 0x000065e0: */ 0x3366, 0x335f, 0x3359, 0x3353, 0x334d, 0x3346, 0x3340, 0x333a, 0x3333, 0x332d, 0x3327, 0x3321, 0x331a, 0x3314, 0x330e, 0x3307, 
-    /* 0x00006600: */ 0x3301, 0x32fb, 0x32f5, 0x32ee, 0x32e8, 0x32e2, 0x32db, 0x32d5, 0x32cf, 0x32c9, 0x32c2, 0x32bc, 0x32b6, 0x32af, 0x32a9, 0x32a3, 
-    /* 0x00006620: */ 0x329d, 0x3296, 0x3290, 0x328a, 0x3283, 0x327d, 0x3277, 0x3270, 0x326a, 0x3264, 0x325e, 0x3257, 0x3251, 0x324b, 0x3244, 0x323e, 
-    /* 0x00006640: */ 0x3238, 0x3231, 0x322b, 0x3225, 0x321e, 0x3218, 0x3212, 0x320c, 0x3205, 0x31ff, 0x31f9, 0x31f2, 0x31ec, 0x31e6, 0x31df, 0x31d9, 
-    /* 0x00006660: */ 0x31d3, 0x31cc, 0x31c6, 0x31c0, 0x31b9, 0x31b3, 0x31ad, 0x31a6, 0x31a0, 0x319a, 0x3194, 0x318d, 0x3187, 0x3181, 0x317a, 0x3174, 
-    /* 0x00006680: */ 0x316e, 0x3167, 0x3161, 0x315b, 0x3154, 0x314e, 0x3148, 0x3141, 0x313b, 0x3135, 0x312e, 0x3128, 0x3122, 0x311b, 0x3115, 0x310f, 
-    /* 0x000066a0: */ 0x3108, 0x3102, 0x30fc, 0x30f5, 0x30ef, 0x30e9, 0x30e2, 0x30dc, 0x30d6, 0x30cf, 0x30c9, 0x30c3, 0x30bc, 0x30b6, 0x30b0, 0x30a9, 
-    /* 0x000066c0: */ 0x30a3, 0x309d, 0x3096, 0x3090, 0x308a, 0x3083, 0x307d, 0x3077, 0x3070, 0x306a, 0x3064, 0x305d, 0x3057, 0x3050, 0x304a, 0x3044, 
-    /* 0x000066e0: */ 0x303d, 0x3037, 0x3031, 0x302a, 0x3024, 0x301e, 0x3017, 0x3011, 0x300b, 0x3004, 0x2ffe, 0x2ff8, 0x2ff1, 0x2feb, 0x2fe4, 0x2fde, 
-    /* 0x00006700: */ 0x2fd8, 0x2fd1, 0x2fcb, 0x2fc5, 0x2fbe, 0x2fb8, 0x2fb2, 0x2fab, 0x2fa5, 0x2f9e, 0x2f98, 0x2f92, 0x2f8b, 0x2f85, 0x2f7f, 0x2f78, 
-    /* 0x00006720: */ 0x2f72, 0x2f6c, 0x2f65, 0x2f5f, 0x2f58, 0x2f52, 0x2f4c, 0x2f45, 0x2f3f, 0x2f39, 0x2f32, 0x2f2c, 0x2f25, 0x2f1f, 0x2f19, 0x2f12, 
-    /* 0x00006740: */ 0x2f0c, 0x2f06, 0x2eff, 0x2ef9, 0x2ef2, 0x2eec, 0x2ee6, 0x2edf, 0x2ed9, 0x2ed3, 0x2ecc, 0x2ec6, 0x2ebf, 0x2eb9, 0x2eb3, 0x2eac, 
-    /* 0x00006760: */ 0x2ea6, 0x2ea0, 0x2e99, 0x2e93, 0x2e8c, 0x2e86, 0x2e80, 0x2e79, 0x2e73, 0x2e6c, 0x2e66, 0x2e60, 0x2e59, 0x2e53, 0x2e4c, 0x2e46, 
-    /* 0x00006780: */ 0x2e40, 0x2e39, 0x2e33, 0x2e2d, 0x2e26, 0x2e20, 0x2e19, 0x2e13, 0x2e0d, 0x2e06, 0x2e00, 0x2df9, 0x2df3, 0x2ded, 0x2de6, 0x2de0, 
-    /* 0x000067a0: */ 0x2dd9, 0x2dd3, 0x2dcd, 0x2dc6, 0x2dc0, 0x2db9, 0x2db3, 0x2dad, 0x2da6, 0x2da0, 0x2d99, 0x2d93, 0x2d8c, 0x2d86, 0x2d80, 0x2d79, 
-    /* 0x000067c0: */ 0x2d73, 0x2d6c, 0x2d66, 0x2d60, 0x2d59, 0x2d53, 0x2d4c, 0x2d46, 0x2d40, 0x2d39, 0x2d33, 0x2d2c, 0x2d26, 0x2d20, 0x2d19, 0x2d13, 
-    /* 0x000067e0: */ 0x2d0c, 0x2d06, 0x2cff, 0x2cf9, 0x2cf3, 0x2cec, 0x2ce6, 0x2cdf, 0x2cd9, 0x2cd2, 0x2ccc, 0x2cc6, 0x2cbf, 0x2cb9, 0x2cb2, 0x2cac, 
-    /* 0x00006800: */ 0x2ca6, 0x2c9f, 0x2c99, 0x2c92, 0x2c8c, 0x2c85, 0x2c7f, 0x2c79, 0x2c72, 0x2c6c, 0x2c65, 0x2c5f, 0x2c58, 0x2c52, 0x2c4c, 0x2c45, 
-    /* 0x00006820: */ 0x2c3f, 0x2c38, 0x2c32, 0x2c2b, 0x2c25, 0x2c1e, 0x2c18, 0x2c12, 0x2c0b, 0x2c05, 0x2bfe, 0x2bf8, 0x2bf1, 0x2beb, 0x2be5, 0x2bde, 
-    /* 0x00006840: */ 0x2bd8, 0x2bd1, 0x2bcb, 0x2bc4, 0x2bbe, 0x2bb7, 0x2bb1, 0x2bab, 0x2ba4, 0x2b9e, 0x2b97, 0x2b91, 0x2b8a, 0x2b84, 0x2b7d, 0x2b77, 
-    /* 0x00006860: */ 0x2b71, 0x2b6a, 0x2b64, 0x2b5d, 0x2b57, 0x2b50, 0x2b4a, 0x2b43, 0x2b3d, 0x2b36, 0x2b30, 0x2b2a, 0x2b23, 0x2b1d, 0x2b16, 0x2b10, 
-    /* 0x00006880: */ 0x2b09, 0x2b03, 0x2afc, 0x2af6, 0x2aef, 0x2ae9, 0x2ae3, 0x2adc, 0x2ad6, 0x2acf, 0x2ac9, 0x2ac2, 0x2abc, 0x2ab5, 0x2aaf, 0x2aa8, 
-    /* 0x000068a0: */ 0x2aa2, 0x2a9b, 0x2a95, 0x2a8f, 0x2a88, 0x2a82, 0x2a7b, 0x2a75, 0x2a6e, 0x2a68, 0x2a61, 0x2a5b, 0x2a54, 0x2a4e, 0x2a47, 0x2a41, 
-    /* 0x000068c0: */ 0x2a3a, 0x2a34, 0x2a2d, 0x2a27, 0x2a21, 0x2a1a, 0x2a14, 0x2a0d, 0x2a07, 0x2a00, 0x29fa, 0x29f3, 0x29ed, 0x29e6, 0x29e0, 0x29d9, 
-    /* 0x000068e0: */ 0x29d3, 0x29cc, 0x29c6, 0x29bf, 0x29b9, 0x29b2, 0x29ac, 0x29a5, 0x299f, 0x2998, 0x2992, 0x298c, 0x2985, 0x297f, 0x2978, 0x2972, 
-    /* 0x00006900: */ 0x296b, 0x2965, 0x295e, 0x2958, 0x2951, 0x294b, 0x2944, 0x293e, 0x2937, 0x2931, 0x292a, 0x2924, 0x291d, 0x2917, 0x2910, 0x290a, 
-    /* 0x00006920: */ 0x2903, 0x28fd, 0x28f6, 0x28f0, 0x28e9, 0x28e3, 0x28dc, 0x28d6, 0x28cf, 0x28c9, 0x28c2, 0x28bc, 0x28b5, 0x28af, 0x28a8, 0x28a2, 
-    /* 0x00006940: */ 0x289b, 0x2895, 0x288e, 0x2888, 0x2881, 0x287b, 0x2874, 0x286e, 0x2867, 0x2861, 0x285a, 0x2854, 0x284d, 0x2847, 0x2840, 0x283a, 
-    /* 0x00006960: */ 0x2833, 0x282d, 0x2826, 0x2820, 0x2819, 0x2813, 0x280c, 0x2806, 0x27ff, 0x27f9, 0x27f2, 0x27ec, 0x27e5, 0x27df, 0x27d8, 0x27d1, 
-    /* 0x00006980: */ 0x27cb, 0x27c4, 0x27be, 0x27b7, 0x27b1, 0x27aa, 0x27a4, 0x279d, 0x2797, 0x2790, 0x278a, 0x2783, 0x277d, 0x2776, 0x2770, 0x2769, 
-    /* 0x000069a0: */ 0x2763, 0x275c, 0x2756, 0x274f, 0x2749, 0x2742, 0x273c, 0x2735, 0x272e, 0x2728, 0x2721, 0x271b, 0x2714, 0x270e, 0x2707, 0x2701, 
-    /* 0x000069c0: */ 0x26fa, 0x26f4, 0x26ed, 0x26e7, 0x26e0, 0x26da, 0x26d3, 0x26cd, 0x26c6, 0x26bf, 0x26b9, 0x26b2, 0x26ac, 0x26a5, 0x269f, 0x2698, 
-    /* 0x000069e0: */ 0x2692, 0x268b, 0x2685, 0x267e, 0x2678, 0x2671, 0x266a, 0x2664, 0x265d, 0x2657, 0x2650, 0x264a, 0x2643, 0x263d, 0x2636, 0x2630, 
-    /* 0x00006a00: */ 0x2629, 0x2623, 0x261c, 0x2615, 0x260f, 0x2608, 0x2602, 0x25fb, 0x25f5, 0x25ee, 0x25e8, 0x25e1, 0x25da, 0x25d4, 0x25cd, 0x25c7, 
-    /* 0x00006a20: */ 0x25c0, 0x25ba, 0x25b3, 0x25ad, 0x25a6, 0x25a0, 0x2599, 0x2592, 0x258c, 0x2585, 0x257f, 0x2578, 0x2572, 0x256b, 0x2565, 0x255e, 
-    /* 0x00006a40: */ 0x2557, 0x2551, 0x254a, 0x2544, 0x253d, 0x2537, 0x2530, 0x252a, 0x2523, 0x251c, 0x2516, 0x250f, 0x2509, 0x2502, 0x24fc, 0x24f5, 
-    /* 0x00006a60: */ 0x24ee, 0x24e8, 0x24e1, 0x24db, 0x24d4, 0x24ce, 0x24c7, 0x24c0, 0x24ba, 0x24b3, 0x24ad, 0x24a6, 0x24a0, 0x2499, 0x2493, 0x248c, 
-    /* 0x00006a80: */ 0x2485, 0x247f, 0x2478, 0x2472, 0x246b, 0x2465, 0x245e, 0x2457, 0x2451, 0x244a, 0x2444, 0x243d, 0x2436, 0x2430, 0x2429, 0x2423, 
-    /* 0x00006aa0: */ 0x241c, 0x2416, 0x240f, 0x2408, 0x2402, 0x23fb, 0x23f5, 0x23ee, 0x23e8, 0x23e1, 0x23da, 0x23d4, 0x23cd, 0x23c7, 0x23c0, 0x23b9, 
-    /* 0x00006ac0: */ 0x23b3, 0x23ac, 0x23a6, 0x239f, 0x2399, 0x2392, 0x238b, 0x2385, 0x237e, 0x2378, 0x2371, 0x236a, 0x2364, 0x235d, 0x2357, 0x2350, 
-    /* 0x00006ae0: */ 0x234a, 0x2343, 0x233c, 0x2336, 0x232f, 0x2329, 0x2322, 0x231b, 0x2315, 0x230e, 0x2308, 0x2301, 0x22fa, 0x22f4, 0x22ed, 0x22e7, 
-    /* 0x00006b00: */ 0x22e0, 0x22d9, 0x22d3, 0x22cc, 0x22c6, 0x22bf, 0x22b8, 0x22b2, 0x22ab, 0x22a5, 0x229e, 0x2297, 0x2291, 0x228a, 0x2284, 0x227d, 
-    /* 0x00006b20: */ 0x2276, 0x2270, 0x2269, 0x2263, 0x225c, 0x2255, 0x224f, 0x2248, 0x2242, 0x223b, 0x2234, 0x222e, 0x2227, 0x2221, 0x221a, 0x2213, 
-    /* 0x00006b40: */ 0x220d, 0x2206, 0x2200, 0x21f9, 0x21f2, 0x21ec, 0x21e5, 0x21de, 0x21d8, 0x21d1, 0x21cb, 0x21c4, 0x21bd, 0x21b7, 0x21b0, 0x21aa, 
-    /* 0x00006b60: */ 0x21a3, 0x219c, 0x2196, 0x218f, 0x2188, 0x2182, 0x217b, 0x2175, 0x216e, 0x2167, 0x2161, 0x215a, 0x2154, 0x214d, 0x2146, 0x2140, 
-    /* 0x00006b80: */ 0x2139, 0x2132, 0x212c, 0x2125, 0x211f, 0x2118, 0x2111, 0x210b, 0x2104, 0x20fd, 0x20f7, 0x20f0, 0x20ea, 0x20e3, 0x20dc, 0x20d6, 
-    /* 0x00006ba0: */ 0x20cf, 0x20c8, 0x20c2, 0x20bb, 0x20b5, 0x20ae, 0x20a7, 0x20a1, 0x209a, 0x2093, 0x208d, 0x2086, 0x2080, 0x2079, 0x2072, 0x206c, 
-    /* 0x00006bc0: */ 0x2065, 0x205e, 0x2058, 0x2051, 0x204a, 0x2044, 0x203d, 0x2037, 0x2030, 0x2029, 0x2023, 0x201c, 0x2015, 0x200f, 0x2008, 0x2001, 
-    /* 0x00006be0: */ 0x1ffb, 0x1ff4, 0x1fee, 0x1fe7, 0x1fe0, 0x1fda, 0x1fd3, 0x1fcc, 0x1fc6, 0x1fbf, 0x1fb8, 0x1fb2, 0x1fab, 0x1fa5, 0x1f9e, 0x1f97, 
-    /* 0x00006c00: */ 0x1f91, 0x1f8a, 0x1f83, 0x1f7d, 0x1f76, 0x1f6f, 0x1f69, 0x1f62, 0x1f5b, 0x1f55, 0x1f4e, 0x1f47, 0x1f41, 0x1f3a, 0x1f34, 0x1f2d, 
-    /* 0x00006c20: */ 0x1f26, 0x1f20, 0x1f19, 0x1f12, 0x1f0c, 0x1f05, 0x1efe, 0x1ef8, 0x1ef1, 0x1eea, 0x1ee4, 0x1edd, 0x1ed6, 0x1ed0, 0x1ec9, 0x1ec2, 
-    /* 0x00006c40: */ 0x1ebc, 0x1eb5, 0x1eae, 0x1ea8, 0x1ea1, 0x1e9a, 0x1e94, 0x1e8d, 0x1e87, 0x1e80, 0x1e79, 0x1e73, 0x1e6c, 0x1e65, 0x1e5f, 0x1e58, 
-    /* 0x00006c60: */ 0x1e51, 0x1e4b, 0x1e44, 0x1e3d, 0x1e37, 0x1e30, 0x1e29, 0x1e23, 0x1e1c, 0x1e15, 0x1e0f, 0x1e08, 0x1e01, 0x1dfb, 0x1df4, 0x1ded, 
-    /* 0x00006c80: */ 0x1de7, 0x1de0, 0x1dd9, 0x1dd3, 0x1dcc, 0x1dc5, 0x1dbf, 0x1db8, 0x1db1, 0x1dab, 0x1da4, 0x1d9d, 0x1d97, 0x1d90, 0x1d89, 0x1d83, 
-    /* 0x00006ca0: */ 0x1d7c, 0x1d75, 0x1d6f, 0x1d68, 0x1d61, 0x1d5b, 0x1d54, 0x1d4d, 0x1d47, 0x1d40, 0x1d39, 0x1d33, 0x1d2c, 0x1d25, 0x1d1f, 0x1d18, 
-    /* 0x00006cc0: */ 0x1d11, 0x1d0a, 0x1d04, 0x1cfd, 0x1cf6, 0x1cf0, 0x1ce9, 0x1ce2, 0x1cdc, 0x1cd5, 0x1cce, 0x1cc8, 0x1cc1, 0x1cba, 0x1cb4, 0x1cad, 
-    /* 0x00006ce0: */ 0x1ca6, 0x1ca0, 0x1c99, 0x1c92, 0x1c8c, 0x1c85, 0x1c7e, 0x1c78, 0x1c71, 0x1c6a, 0x1c63, 0x1c5d, 0x1c56, 0x1c4f, 0x1c49, 0x1c42, 
-    /* 0x00006d00: */ 0x1c3b, 0x1c35, 0x1c2e, 0x1c27, 0x1c21, 0x1c1a, 0x1c13, 0x1c0d, 0x1c06, 0x1bff, 0x1bf8, 0x1bf2, 0x1beb, 0x1be4, 0x1bde, 0x1bd7, 
-    /* 0x00006d20: */ 0x1bd0, 0x1bca, 0x1bc3, 0x1bbc, 0x1bb6, 0x1baf, 0x1ba8, 0x1ba1, 0x1b9b, 0x1b94, 0x1b8d, 0x1b87, 0x1b80, 0x1b79, 0x1b73, 0x1b6c, 
-    /* 0x00006d40: */ 0x1b65, 0x1b5e, 0x1b58, 0x1b51, 0x1b4a, 0x1b44, 0x1b3d, 0x1b36, 0x1b30, 0x1b29, 0x1b22, 0x1b1c, 0x1b15, 0x1b0e, 0x1b07, 0x1b01, 
-    /* 0x00006d60: */ 0x1afa, 0x1af3, 0x1aed, 0x1ae6, 0x1adf, 0x1ad8, 0x1ad2, 0x1acb, 0x1ac4, 0x1abe, 0x1ab7, 0x1ab0, 0x1aaa, 0x1aa3, 0x1a9c, 0x1a95, 
-    /* 0x00006d80: */ 0x1a8f, 0x1a88, 0x1a81, 0x1a7b, 0x1a74, 0x1a6d, 0x1a66, 0x1a60, 0x1a59, 0x1a52, 0x1a4c, 0x1a45, 0x1a3e, 0x1a38, 0x1a31, 0x1a2a, 
-    /* 0x00006da0: */ 0x1a23, 0x1a1d, 0x1a16, 0x1a0f, 0x1a09, 0x1a02, 0x19fb, 0x19f4, 0x19ee, 0x19e7, 0x19e0, 0x19da, 0x19d3, 0x19cc, 0x19c5, 0x19bf, 
-    /* 0x00006dc0: */ 0x19b8, 0x19b1, 0x19ab, 0x19a4, 0x199d, 0x1996, 0x1990, 0x1989, 0x1982, 0x197c, 0x1975, 0x196e, 0x1967, 0x1961, 0x195a, 0x1953, 
-    /* 0x00006de0: */ 0x194c, 0x1946, 0x193f, 0x1938, 0x1932, 0x192b, 0x1924, 0x191d, 0x1917, 0x1910, 0x1909, 0x1903, 0x18fc, 0x18f5, 0x18ee, 0x18e8, 
-    /* 0x00006e00: */ 0x18e1, 0x18da, 0x18d3, 0x18cd, 0x18c6, 0x18bf, 0x18b9, 0x18b2, 0x18ab, 0x18a4, 0x189e, 0x1897, 0x1890, 0x1889, 0x1883, 0x187c, 
-    /* 0x00006e20: */ 0x1875, 0x186f, 0x1868, 0x1861, 0x185a, 0x1854, 0x184d, 0x1846, 0x183f, 0x1839, 0x1832, 0x182b, 0x1824, 0x181e, 0x1817, 0x1810, 
-    /* 0x00006e40: */ 0x180a, 0x1803, 0x17fc, 0x17f5, 0x17ef, 0x17e8, 0x17e1, 0x17da, 0x17d4, 0x17cd, 0x17c6, 0x17bf, 0x17b9, 0x17b2, 0x17ab, 0x17a5, 
-    /* 0x00006e60: */ 0x179e, 0x1797, 0x1790, 0x178a, 0x1783, 0x177c, 0x1775, 0x176f, 0x1768, 0x1761, 0x175a, 0x1754, 0x174d, 0x1746, 0x173f, 0x1739, 
-    /* 0x00006e80: */ 0x1732, 0x172b, 0x1724, 0x171e, 0x1717, 0x1710, 0x1709, 0x1703, 0x16fc, 0x16f5, 0x16ef, 0x16e8, 0x16e1, 0x16da, 0x16d4, 0x16cd, 
-    /* 0x00006ea0: */ 0x16c6, 0x16bf, 0x16b9, 0x16b2, 0x16ab, 0x16a4, 0x169e, 0x1697, 0x1690, 0x1689, 0x1683, 0x167c, 0x1675, 0x166e, 0x1668, 0x1661, 
-    /* 0x00006ec0: */ 0x165a, 0x1653, 0x164d, 0x1646, 0x163f, 0x1638, 0x1632, 0x162b, 0x1624, 0x161d, 0x1617, 0x1610, 0x1609, 0x1602, 0x15fc, 0x15f5, 
-    /* 0x00006ee0: */ 0x15ee, 0x15e7, 0x15e1, 0x15da, 0x15d3, 0x15cc, 0x15c5, 0x15bf, 0x15b8, 0x15b1, 0x15aa, 0x15a4, 0x159d, 0x1596, 0x158f, 0x1589, 
-    /* 0x00006f00: */ 0x1582, 0x157b, 0x1574, 0x156e, 0x1567, 0x1560, 0x1559, 0x1553, 0x154c, 0x1545, 0x153e, 0x1538, 0x1531, 0x152a, 0x1523, 0x151d, 
-    /* 0x00006f20: */ 0x1516, 0x150f, 0x1508, 0x1501, 0x14fb, 0x14f4, 0x14ed, 0x14e6, 0x14e0, 0x14d9, 0x14d2, 0x14cb, 0x14c5, 0x14be, 0x14b7, 0x14b0, 
-    /* 0x00006f40: */ 0x14aa, 0x14a3, 0x149c, 0x1495, 0x148e, 0x1488, 0x1481, 0x147a, 0x1473, 0x146d, 0x1466, 0x145f, 0x1458, 0x1452, 0x144b, 0x1444, 
-    /* 0x00006f60: */ 0x143d, 0x1436, 0x1430, 0x1429, 0x1422, 0x141b, 0x1415, 0x140e, 0x1407, 0x1400, 0x13fa, 0x13f3, 0x13ec, 0x13e5, 0x13de, 0x13d8, 
-    /* 0x00006f80: */ 0x13d1, 0x13ca, 0x13c3, 0x13bd, 0x13b6, 0x13af, 0x13a8, 0x13a1, 0x139b, 0x1394, 0x138d, 0x1386, 0x1380, 0x1379, 0x1372, 0x136b, 
-    /* 0x00006fa0: */ 0x1365, 0x135e, 0x1357, 0x1350, 0x1349, 0x1343, 0x133c, 0x1335, 0x132e, 0x1328, 0x1321, 0x131a, 0x1313, 0x130c, 0x1306, 0x12ff, 
-    /* 0x00006fc0: */ 0x12f8, 0x12f1, 0x12ea, 0x12e4, 0x12dd, 0x12d6, 0x12cf, 0x12c9, 0x12c2, 0x12bb, 0x12b4, 0x12ad, 0x12a7, 0x12a0, 0x1299, 0x1292, 
-    /* 0x00006fe0: */ 0x128c, 0x1285, 0x127e, 0x1277, 0x1270, 0x126a, 0x1263, 0x125c, 0x1255, 0x124e, 0x1248, 0x1241, 0x123a, 0x1233, 0x122d, 0x1226, 
-    /* 0x00007000: */ 0x121f, 0x1218, 0x1211, 0x120b, 0x1204, 0x11fd, 0x11f6, 0x11ef, 0x11e9, 0x11e2, 0x11db, 0x11d4, 0x11ce, 0x11c7, 0x11c0, 0x11b9, 
-    /* 0x00007020: */ 0x11b2, 0x11ac, 0x11a5, 0x119e, 0x1197, 0x1190, 0x118a, 0x1183, 0x117c, 0x1175, 0x116e, 0x1168, 0x1161, 0x115a, 0x1153, 0x114c, 
-    /* 0x00007040: */ 0x1146, 0x113f, 0x1138, 0x1131, 0x112b, 0x1124, 0x111d, 0x1116, 0x110f, 0x1109, 0x1102, 0x10fb, 0x10f4, 0x10ed, 0x10e7, 0x10e0, 
-    /* 0x00007060: */ 0x10d9, 0x10d2, 0x10cb, 0x10c5, 0x10be, 0x10b7, 0x10b0, 0x10a9, 0x10a3, 0x109c, 0x1095, 0x108e, 0x1087, 0x1081, 0x107a, 0x1073, 
-    /* 0x00007080: */ 0x106c, 0x1065, 0x105f, 0x1058, 0x1051, 0x104a, 0x1043, 0x103d, 0x1036, 0x102f, 0x1028, 0x1021, 0x101b, 0x1014, 0x100d, 0x1006, 
-    /* 0x000070a0: */ 0x0fff, 0x0ff9, 0x0ff2, 0x0feb, 0x0fe4, 0x0fdd, 0x0fd7, 0x0fd0, 0x0fc9, 0x0fc2, 0x0fbb, 0x0fb5, 0x0fae, 0x0fa7, 0x0fa0, 0x0f99, 
-    /* 0x000070c0: */ 0x0f93, 0x0f8c, 0x0f85, 0x0f7e, 0x0f77, 0x0f71, 0x0f6a, 0x0f63, 0x0f5c, 0x0f55, 0x0f4e, 0x0f48, 0x0f41, 0x0f3a, 0x0f33, 0x0f2c, 
-    /* 0x000070e0: */ 0x0f26, 0x0f1f, 0x0f18, 0x0f11, 0x0f0a, 0x0f04, 0x0efd, 0x0ef6, 0x0eef, 0x0ee8, 0x0ee2, 0x0edb, 0x0ed4, 0x0ecd, 0x0ec6, 0x0ec0, 
-    /* 0x00007100: */ 0x0eb9, 0x0eb2, 0x0eab, 0x0ea4, 0x0e9d, 0x0e97, 0x0e90, 0x0e89, 0x0e82, 0x0e7b, 0x0e75, 0x0e6e, 0x0e67, 0x0e60, 0x0e59, 0x0e53, 
-    /* 0x00007120: */ 0x0e4c, 0x0e45, 0x0e3e, 0x0e37, 0x0e30, 0x0e2a, 0x0e23, 0x0e1c, 0x0e15, 0x0e0e, 0x0e08, 0x0e01, 0x0dfa, 0x0df3, 0x0dec, 0x0de6, 
-    /* 0x00007140: */ 0x0ddf, 0x0dd8, 0x0dd1, 0x0dca, 0x0dc3, 0x0dbd, 0x0db6, 0x0daf, 0x0da8, 0x0da1, 0x0d9b, 0x0d94, 0x0d8d, 0x0d86, 0x0d7f, 0x0d78, 
-    /* 0x00007160: */ 0x0d72, 0x0d6b, 0x0d64, 0x0d5d, 0x0d56, 0x0d50, 0x0d49, 0x0d42, 0x0d3b, 0x0d34, 0x0d2d, 0x0d27, 0x0d20, 0x0d19, 0x0d12, 0x0d0b, 
-    /* 0x00007180: */ 0x0d05, 0x0cfe, 0x0cf7, 0x0cf0, 0x0ce9, 0x0ce2, 0x0cdc, 0x0cd5, 0x0cce, 0x0cc7, 0x0cc0, 0x0cb9, 0x0cb3, 0x0cac, 0x0ca5, 0x0c9e, 
-    /* 0x000071a0: */ 0x0c97, 0x0c91, 0x0c8a, 0x0c83, 0x0c7c, 0x0c75, 0x0c6e, 0x0c68, 0x0c61, 0x0c5a, 0x0c53, 0x0c4c, 0x0c45, 0x0c3f, 0x0c38, 0x0c31, 
-    /* 0x000071c0: */ 0x0c2a, 0x0c23, 0x0c1d, 0x0c16, 0x0c0f, 0x0c08, 0x0c01, 0x0bfa, 0x0bf4, 0x0bed, 0x0be6, 0x0bdf, 0x0bd8, 0x0bd1, 0x0bcb, 0x0bc4, 
-    /* 0x000071e0: */ 0x0bbd, 0x0bb6, 0x0baf, 0x0ba9, 0x0ba2, 0x0b9b, 0x0b94, 0x0b8d, 0x0b86, 0x0b80, 0x0b79, 0x0b72, 0x0b6b, 0x0b64, 0x0b5d, 0x0b57, 
-    /* 0x00007200: */ 0x0b50, 0x0b49, 0x0b42, 0x0b3b, 0x0b34, 0x0b2e, 0x0b27, 0x0b20, 0x0b19, 0x0b12, 0x0b0b, 0x0b05, 0x0afe, 0x0af7, 0x0af0, 0x0ae9, 
-    /* 0x00007220: */ 0x0ae2, 0x0adc, 0x0ad5, 0x0ace, 0x0ac7, 0x0ac0, 0x0ab9, 0x0ab3, 0x0aac, 0x0aa5, 0x0a9e, 0x0a97, 0x0a90, 0x0a8a, 0x0a83, 0x0a7c, 
-    /* 0x00007240: */ 0x0a75, 0x0a6e, 0x0a67, 0x0a61, 0x0a5a, 0x0a53, 0x0a4c, 0x0a45, 0x0a3e, 0x0a38, 0x0a31, 0x0a2a, 0x0a23, 0x0a1c, 0x0a15, 0x0a0f, 
-    /* 0x00007260: */ 0x0a08, 0x0a01, 0x09fa, 0x09f3, 0x09ec, 0x09e6, 0x09df, 0x09d8, 0x09d1, 0x09ca, 0x09c3, 0x09bd, 0x09b6, 0x09af, 0x09a8, 0x09a1, 
-    /* 0x00007280: */ 0x099a, 0x0994, 0x098d, 0x0986, 0x097f, 0x0978, 0x0971, 0x096b, 0x0964, 0x095d, 0x0956, 0x094f, 0x0948, 0x0942, 0x093b, 0x0934, 
-    /* 0x000072a0: */ 0x092d, 0x0926, 0x091f, 0x0919, 0x0912, 0x090b, 0x0904, 0x08fd, 0x08f6, 0x08ef, 0x08e9, 0x08e2, 0x08db, 0x08d4, 0x08cd, 0x08c6, 
-    /* 0x000072c0: */ 0x08c0, 0x08b9, 0x08b2, 0x08ab, 0x08a4, 0x089d, 0x0897, 0x0890, 0x0889, 0x0882, 0x087b, 0x0874, 0x086e, 0x0867, 0x0860, 0x0859, 
-    /* 0x000072e0: */ 0x0852, 0x084b, 0x0844, 0x083e, 0x0837, 0x0830, 0x0829, 0x0822, 0x081b, 0x0815, 0x080e, 0x0807, 0x0800, 0x07f9, 0x07f2, 0x07ec, 
-    /* 0x00007300: */ 0x07e5, 0x07de, 0x07d7, 0x07d0, 0x07c9, 0x07c2, 0x07bc, 0x07b5, 0x07ae, 0x07a7, 0x07a0, 0x0799, 0x0793, 0x078c, 0x0785, 0x077e, 
-    /* 0x00007320: */ 0x0777, 0x0770, 0x076a, 0x0763, 0x075c, 0x0755, 0x074e, 0x0747, 0x0740, 0x073a, 0x0733, 0x072c, 0x0725, 0x071e, 0x0717, 0x0711, 
-    /* 0x00007340: */ 0x070a, 0x0703, 0x06fc, 0x06f5, 0x06ee, 0x06e7, 0x06e1, 0x06da, 0x06d3, 0x06cc, 0x06c5, 0x06be, 0x06b8, 0x06b1, 0x06aa, 0x06a3, 
-    /* 0x00007360: */ 0x069c, 0x0695, 0x068e, 0x0688, 0x0681, 0x067a, 0x0673, 0x066c, 0x0665, 0x065f, 0x0658, 0x0651, 0x064a, 0x0643, 0x063c, 0x0635, 
-    /* 0x00007380: */ 0x062f, 0x0628, 0x0621, 0x061a, 0x0613, 0x060c, 0x0605, 0x05ff, 0x05f8, 0x05f1, 0x05ea, 0x05e3, 0x05dc, 0x05d6, 0x05cf, 0x05c8, 
-    /* 0x000073a0: */ 0x05c1, 0x05ba, 0x05b3, 0x05ac, 0x05a6, 0x059f, 0x0598, 0x0591, 0x058a, 0x0583, 0x057d, 0x0576, 0x056f, 0x0568, 0x0561, 0x055a, 
-    /* 0x000073c0: */ 0x0553, 0x054d, 0x0546, 0x053f, 0x0538, 0x0531, 0x052a, 0x0523, 0x051d, 0x0516, 0x050f, 0x0508, 0x0501, 0x04fa, 0x04f4, 0x04ed, 
-    /* 0x000073e0: */ 0x04e6, 0x04df, 0x04d8, 0x04d1, 0x04ca, 0x04c4, 0x04bd, 0x04b6, 0x04af, 0x04a8, 0x04a1, 0x049a, 0x0494, 0x048d, 0x0486, 0x047f, 
-    /* 0x00007400: */ 0x0478, 0x0471, 0x046a, 0x0464, 0x045d, 0x0456, 0x044f, 0x0448, 0x0441, 0x043b, 0x0434, 0x042d, 0x0426, 0x041f, 0x0418, 0x0411, 
-    /* 0x00007420: */ 0x040b, 0x0404, 0x03fd, 0x03f6, 0x03ef, 0x03e8, 0x03e1, 0x03db, 0x03d4, 0x03cd, 0x03c6, 0x03bf, 0x03b8, 0x03b1, 0x03ab, 0x03a4, 
-    /* 0x00007440: */ 0x039d, 0x0396, 0x038f, 0x0388, 0x0382, 0x037b, 0x0374, 0x036d, 0x0366, 0x035f, 0x0358, 0x0352, 0x034b, 0x0344, 0x033d, 0x0336, 
-    /* 0x00007460: */ 0x032f, 0x0328, 0x0322, 0x031b, 0x0314, 0x030d, 0x0306, 0x02ff, 0x02f8, 0x02f2, 0x02eb, 0x02e4, 0x02dd, 0x02d6, 0x02cf, 0x02c8, 
-    /* 0x00007480: */ 0x02c2, 0x02bb, 0x02b4, 0x02ad, 0x02a6, 0x029f, 0x0298, 0x0292, 0x028b, 0x0284, 0x027d, 0x0276, 0x026f, 0x0268, 0x0262, 0x025b, 
-    /* 0x000074a0: */ 0x0254, 0x024d, 0x0246, 0x023f, 0x0239, 0x0232, 0x022b, 0x0224, 0x021d, 0x0216, 0x020f, 0x0209, 0x0202, 0x01fb, 0x01f4, 0x01ed, 
-    /* 0x000074c0: */ 0x01e6, 0x01df, 0x01d9, 0x01d2, 0x01cb, 0x01c4, 0x01bd, 0x01b6, 0x01af, 0x01a9, 0x01a2, 0x019b, 0x0194, 0x018d, 0x0186, 0x017f, 
-    /* 0x000074e0: */ 0x0179, 0x0172, 0x016b, 0x0164, 0x015d, 0x0156, 0x014f, 0x0149, 0x0142, 0x013b, 0x0134, 0x012d, 0x0126, 0x011f, 0x0119, 0x0112, 
-    /* 0x00007500: */ 0x010b, 0x0104, 0x00fd, 0x00f6, 0x00ef, 0x00e9, 0x00e2, 0x00db, 0x00d4, 0x00cd, 0x00c6, 0x00bf, 0x00b9, 0x00b2, 0x00ab, 0x00a4, 
-    /* 0x00007520: */ 0x009d, 0x0096, 0x008f, 0x0089, 0x0082, 0x007b, 0x0074, 0x006d, 0x0066, 0x005f, 0x0059, 0x0052, 0x004b, 0x0044, 0x003d, 0x0036, 
-    /* 0x00007540: */ 0x002f, 0x0029, 0x0022, 0x001b, 0x0014, 0x000d, 0x0006, 0x0000, 0xfffa, 0xfff3, 0xffec, 0xffe5, 0xffde, 0xffd7, 0xffd1, 0xffca, 
-    /* 0x00007560: */ 0xffc3, 0xffbc, 0xffb5, 0xffae, 0xffa7, 0xffa1, 0xff9a, 0xff93, 0xff8c, 0xff85, 0xff7e, 0xff77, 0xff71, 0xff6a, 0xff63, 0xff5c, 
-    /* 0x00007580: */ 0xff55, 0xff4e, 0xff47, 0xff41, 0xff3a, 0xff33, 0xff2c, 0xff25, 0xff1e, 0xff17, 0xff11, 0xff0a, 0xff03, 0xfefc, 0xfef5, 0xfeee, 
-    /* 0x000075a0: */ 0xfee7, 0xfee1, 0xfeda, 0xfed3, 0xfecc, 0xfec5, 0xfebe, 0xfeb7, 0xfeb1, 0xfeaa, 0xfea3, 0xfe9c, 0xfe95, 0xfe8e, 0xfe87, 0xfe81, 
-    /* 0x000075c0: */ 0xfe7a, 0xfe73, 0xfe6c, 0xfe65, 0xfe5e, 0xfe57, 0xfe51, 0xfe4a, 0xfe43, 0xfe3c, 0xfe35, 0xfe2e, 0xfe27, 0xfe21, 0xfe1a, 0xfe13, 
-    /* 0x000075e0: */ 0xfe0c, 0xfe05, 0xfdfe, 0xfdf7, 0xfdf1, 0xfdea, 0xfde3, 0xfddc, 0xfdd5, 0xfdce, 0xfdc7, 0xfdc1, 0xfdba, 0xfdb3, 0xfdac, 0xfda5, 
-    /* 0x00007600: */ 0xfd9e, 0xfd98, 0xfd91, 0xfd8a, 0xfd83, 0xfd7c, 0xfd75, 0xfd6e, 0xfd68, 0xfd61, 0xfd5a, 0xfd53, 0xfd4c, 0xfd45, 0xfd3e, 0xfd38, 
-    /* 0x00007620: */ 0xfd31, 0xfd2a, 0xfd23, 0xfd1c, 0xfd15, 0xfd0e, 0xfd08, 0xfd01, 0xfcfa, 0xfcf3, 0xfcec, 0xfce5, 0xfcde, 0xfcd8, 0xfcd1, 0xfcca, 
-    /* 0x00007640: */ 0xfcc3, 0xfcbc, 0xfcb5, 0xfcae, 0xfca8, 0xfca1, 0xfc9a, 0xfc93, 0xfc8c, 0xfc85, 0xfc7e, 0xfc78, 0xfc71, 0xfc6a, 0xfc63, 0xfc5c, 
-    /* 0x00007660: */ 0xfc55, 0xfc4f, 0xfc48, 0xfc41, 0xfc3a, 0xfc33, 0xfc2c, 0xfc25, 0xfc1f, 0xfc18, 0xfc11, 0xfc0a, 0xfc03, 0xfbfc, 0xfbf5, 0xfbef, 
-    /* 0x00007680: */ 0xfbe8, 0xfbe1, 0xfbda, 0xfbd3, 0xfbcc, 0xfbc5, 0xfbbf, 0xfbb8, 0xfbb1, 0xfbaa, 0xfba3, 0xfb9c, 0xfb96, 0xfb8f, 0xfb88, 0xfb81, 
-    /* 0x000076a0: */ 0xfb7a, 0xfb73, 0xfb6c, 0xfb66, 0xfb5f, 0xfb58, 0xfb51, 0xfb4a, 0xfb43, 0xfb3c, 0xfb36, 0xfb2f, 0xfb28, 0xfb21, 0xfb1a, 0xfb13, 
-    /* 0x000076c0: */ 0xfb0c, 0xfb06, 0xfaff, 0xfaf8, 0xfaf1, 0xfaea, 0xfae3, 0xfadd, 0xfad6, 0xfacf, 0xfac8, 0xfac1, 0xfaba, 0xfab3, 0xfaad, 0xfaa6, 
-    /* 0x000076e0: */ 0xfa9f, 0xfa98, 0xfa91, 0xfa8a, 0xfa83, 0xfa7d, 0xfa76, 0xfa6f, 0xfa68, 0xfa61, 0xfa5a, 0xfa54, 0xfa4d, 0xfa46, 0xfa3f, 0xfa38, 
-    /* 0x00007700: */ 0xfa31, 0xfa2a, 0xfa24, 0xfa1d, 0xfa16, 0xfa0f, 0xfa08, 0xfa01, 0xf9fb, 0xf9f4, 0xf9ed, 0xf9e6, 0xf9df, 0xf9d8, 0xf9d1, 0xf9cb, 
-    /* 0x00007720: */ 0xf9c4, 0xf9bd, 0xf9b6, 0xf9af, 0xf9a8, 0xf9a1, 0xf99b, 0xf994, 0xf98d, 0xf986, 0xf97f, 0xf978, 0xf972, 0xf96b, 0xf964, 0xf95d, 
-    /* 0x00007740: */ 0xf956, 0xf94f, 0xf948, 0xf942, 0xf93b, 0xf934, 0xf92d, 0xf926, 0xf91f, 0xf919, 0xf912, 0xf90b, 0xf904, 0xf8fd, 0xf8f6, 0xf8ef, 
-    /* 0x00007760: */ 0xf8e9, 0xf8e2, 0xf8db, 0xf8d4, 0xf8cd, 0xf8c6, 0xf8c0, 0xf8b9, 0xf8b2, 0xf8ab, 0xf8a4, 0xf89d, 0xf896, 0xf890, 0xf889, 0xf882, 
-    /* 0x00007780: */ 0xf87b, 0xf874, 0xf86d, 0xf867, 0xf860, 0xf859, 0xf852, 0xf84b, 0xf844, 0xf83e, 0xf837, 0xf830, 0xf829, 0xf822, 0xf81b, 0xf814, 
-    /* 0x000077a0: */ 0xf80e, 0xf807, 0xf800, 0xf7f9, 0xf7f2, 0xf7eb, 0xf7e5, 0xf7de, 0xf7d7, 0xf7d0, 0xf7c9, 0xf7c2, 0xf7bc, 0xf7b5, 0xf7ae, 0xf7a7, 
-    /* 0x000077c0: */ 0xf7a0, 0xf799, 0xf792, 0xf78c, 0xf785, 0xf77e, 0xf777, 0xf770, 0xf769, 0xf763, 0xf75c, 0xf755, 0xf74e, 0xf747, 0xf740, 0xf73a, 
-    /* 0x000077e0: */ 0xf733, 0xf72c, 0xf725, 0xf71e, 0xf717, 0xf711, 0xf70a, 0xf703, 0xf6fc, 0xf6f5, 0xf6ee, 0xf6e7, 0xf6e1, 0xf6da, 0xf6d3, 0xf6cc, 
-    /* 0x00007800: */ 0xf6c5, 0xf6be, 0xf6b8, 0xf6b1, 0xf6aa, 0xf6a3, 0xf69c, 0xf695, 0xf68f, 0xf688, 0xf681, 0xf67a, 0xf673, 0xf66c, 0xf666, 0xf65f, 
-    /* 0x00007820: */ 0xf658, 0xf651, 0xf64a, 0xf643, 0xf63d, 0xf636, 0xf62f, 0xf628, 0xf621, 0xf61a, 0xf614, 0xf60d, 0xf606, 0xf5ff, 0xf5f8, 0xf5f1, 
-    /* 0x00007840: */ 0xf5eb, 0xf5e4, 0xf5dd, 0xf5d6, 0xf5cf, 0xf5c8, 0xf5c2, 0xf5bb, 0xf5b4, 0xf5ad, 0xf5a6, 0xf59f, 0xf599, 0xf592, 0xf58b, 0xf584, 
-    /* 0x00007860: */ 0xf57d, 0xf576, 0xf570, 0xf569, 0xf562, 0xf55b, 0xf554, 0xf54d, 0xf547, 0xf540, 0xf539, 0xf532, 0xf52b, 0xf524, 0xf51e, 0xf517, 
-    /* 0x00007880: */ 0xf510, 0xf509, 0xf502, 0xf4fb, 0xf4f5, 0xf4ee, 0xf4e7, 0xf4e0, 0xf4d9, 0xf4d2, 0xf4cc, 0xf4c5, 0xf4be, 0xf4b7, 0xf4b0, 0xf4a9, 
-    /* 0x000078a0: */ 0xf4a3, 0xf49c, 0xf495, 0xf48e, 0xf487, 0xf480, 0xf47a, 0xf473, 0xf46c, 0xf465, 0xf45e, 0xf457, 0xf451, 0xf44a, 0xf443, 0xf43c, 
-    /* 0x000078c0: */ 0xf435, 0xf42f, 0xf428, 0xf421, 0xf41a, 0xf413, 0xf40c, 0xf406, 0xf3ff, 0xf3f8, 0xf3f1, 0xf3ea, 0xf3e3, 0xf3dd, 0xf3d6, 0xf3cf, 
-    /* 0x000078e0: */ 0xf3c8, 0xf3c1, 0xf3bb, 0xf3b4, 0xf3ad, 0xf3a6, 0xf39f, 0xf398, 0xf392, 0xf38b, 0xf384, 0xf37d, 0xf376, 0xf36f, 0xf369, 0xf362, 
-    /* 0x00007900: */ 0xf35b, 0xf354, 0xf34d, 0xf347, 0xf340, 0xf339, 0xf332, 0xf32b, 0xf324, 0xf31e, 0xf317, 0xf310, 0xf309, 0xf302, 0xf2fb, 0xf2f5, 
-    /* 0x00007920: */ 0xf2ee, 0xf2e7, 0xf2e0, 0xf2d9, 0xf2d3, 0xf2cc, 0xf2c5, 0xf2be, 0xf2b7, 0xf2b0, 0xf2aa, 0xf2a3, 0xf29c, 0xf295, 0xf28e, 0xf288, 
-    /* 0x00007940: */ 0xf281, 0xf27a, 0xf273, 0xf26c, 0xf265, 0xf25f, 0xf258, 0xf251, 0xf24a, 0xf243, 0xf23d, 0xf236, 0xf22f, 0xf228, 0xf221, 0xf21a, 
-    /* 0x00007960: */ 0xf214, 0xf20d, 0xf206, 0xf1ff, 0xf1f8, 0xf1f2, 0xf1eb, 0xf1e4, 0xf1dd, 0xf1d6, 0xf1d0, 0xf1c9, 0xf1c2, 0xf1bb, 0xf1b4, 0xf1ad, 
-    /* 0x00007980: */ 0xf1a7, 0xf1a0, 0xf199, 0xf192, 0xf18b, 0xf185, 0xf17e, 0xf177, 0xf170, 0xf169, 0xf163, 0xf15c, 0xf155, 0xf14e, 0xf147, 0xf140, 
-    /* 0x000079a0: */ 0xf13a, 0xf133, 0xf12c, 0xf125, 0xf11e, 0xf118, 0xf111, 0xf10a, 0xf103, 0xf0fc, 0xf0f6, 0xf0ef, 0xf0e8, 0xf0e1, 0xf0da, 0xf0d4, 
-    /* 0x000079c0: */ 0xf0cd, 0xf0c6, 0xf0bf, 0xf0b8, 0xf0b2, 0xf0ab, 0xf0a4, 0xf09d, 0xf096, 0xf08f, 0xf089, 0xf082, 0xf07b, 0xf074, 0xf06d, 0xf067, 
-    /* 0x000079e0: */ 0xf060, 0xf059, 0xf052, 0xf04b, 0xf045, 0xf03e, 0xf037, 0xf030, 0xf029, 0xf023, 0xf01c, 0xf015, 0xf00e, 0xf007, 0xf001, 0xeffa, 
-    /* 0x00007a00: */ 0xeff3, 0xefec, 0xefe5, 0xefdf, 0xefd8, 0xefd1, 0xefca, 0xefc3, 0xefbd, 0xefb6, 0xefaf, 0xefa8, 0xefa1, 0xef9b, 0xef94, 0xef8d, 
-    /* 0x00007a20: */ 0xef86, 0xef7f, 0xef79, 0xef72, 0xef6b, 0xef64, 0xef5d, 0xef57, 0xef50, 0xef49, 0xef42, 0xef3b, 0xef35, 0xef2e, 0xef27, 0xef20, 
-    /* 0x00007a40: */ 0xef19, 0xef13, 0xef0c, 0xef05, 0xeefe, 0xeef7, 0xeef1, 0xeeea, 0xeee3, 0xeedc, 0xeed5, 0xeecf, 0xeec8, 0xeec1, 0xeeba, 0xeeb4, 
-    /* 0x00007a60: */ 0xeead, 0xeea6, 0xee9f, 0xee98, 0xee92, 0xee8b, 0xee84, 0xee7d, 0xee76, 0xee70, 0xee69, 0xee62, 0xee5b, 0xee54, 0xee4e, 0xee47, 
-    /* 0x00007a80: */ 0xee40, 0xee39, 0xee32, 0xee2c, 0xee25, 0xee1e, 0xee17, 0xee11, 0xee0a, 0xee03, 0xedfc, 0xedf5, 0xedef, 0xede8, 0xede1, 0xedda, 
-    /* 0x00007aa0: */ 0xedd3, 0xedcd, 0xedc6, 0xedbf, 0xedb8, 0xedb2, 0xedab, 0xeda4, 0xed9d, 0xed96, 0xed90, 0xed89, 0xed82, 0xed7b, 0xed74, 0xed6e, 
-    /* 0x00007ac0: */ 0xed67, 0xed60, 0xed59, 0xed53, 0xed4c, 0xed45, 0xed3e, 0xed37, 0xed31, 0xed2a, 0xed23, 0xed1c, 0xed16, 0xed0f, 0xed08, 0xed01, 
-    /* 0x00007ae0: */ 0xecfa, 0xecf4, 0xeced, 0xece6, 0xecdf, 0xecd8, 0xecd2, 0xeccb, 0xecc4, 0xecbd, 0xecb7, 0xecb0, 0xeca9, 0xeca2, 0xec9b, 0xec95, 
-    /* 0x00007b00: */ 0xec8e, 0xec87, 0xec80, 0xec7a, 0xec73, 0xec6c, 0xec65, 0xec5f, 0xec58, 0xec51, 0xec4a, 0xec43, 0xec3d, 0xec36, 0xec2f, 0xec28, 
-    /* 0x00007b20: */ 0xec22, 0xec1b, 0xec14, 0xec0d, 0xec06, 0xec00, 0xebf9, 0xebf2, 0xebeb, 0xebe5, 0xebde, 0xebd7, 0xebd0, 0xebca, 0xebc3, 0xebbc, 
-    /* 0x00007b40: */ 0xebb5, 0xebae, 0xeba8, 0xeba1, 0xeb9a, 0xeb93, 0xeb8d, 0xeb86, 0xeb7f, 0xeb78, 0xeb72, 0xeb6b, 0xeb64, 0xeb5d, 0xeb56, 0xeb50, 
-    /* 0x00007b60: */ 0xeb49, 0xeb42, 0xeb3b, 0xeb35, 0xeb2e, 0xeb27, 0xeb20, 0xeb1a, 0xeb13, 0xeb0c, 0xeb05, 0xeaff, 0xeaf8, 0xeaf1, 0xeaea, 0xeae3, 
-    /* 0x00007b80: */ 0xeadd, 0xead6, 0xeacf, 0xeac8, 0xeac2, 0xeabb, 0xeab4, 0xeaad, 0xeaa7, 0xeaa0, 0xea99, 0xea92, 0xea8c, 0xea85, 0xea7e, 0xea77, 
-    /* 0x00007ba0: */ 0xea71, 0xea6a, 0xea63, 0xea5c, 0xea56, 0xea4f, 0xea48, 0xea41, 0xea3b, 0xea34, 0xea2d, 0xea26, 0xea1f, 0xea19, 0xea12, 0xea0b, 
-    /* 0x00007bc0: */ 0xea04, 0xe9fe, 0xe9f7, 0xe9f0, 0xe9e9, 0xe9e3, 0xe9dc, 0xe9d5, 0xe9ce, 0xe9c8, 0xe9c1, 0xe9ba, 0xe9b3, 0xe9ad, 0xe9a6, 0xe99f, 
-    /* 0x00007be0: */ 0xe998, 0xe992, 0xe98b, 0xe984, 0xe97d, 0xe977, 0xe970, 0xe969, 0xe962, 0xe95c, 0xe955, 0xe94e, 0xe947, 0xe941, 0xe93a, 0xe933, 
-    /* 0x00007c00: */ 0xe92c, 0xe926, 0xe91f, 0xe918, 0xe911, 0xe90b, 0xe904, 0xe8fd, 0xe8f7, 0xe8f0, 0xe8e9, 0xe8e2, 0xe8dc, 0xe8d5, 0xe8ce, 0xe8c7, 
-    /* 0x00007c20: */ 0xe8c1, 0xe8ba, 0xe8b3, 0xe8ac, 0xe8a6, 0xe89f, 0xe898, 0xe891, 0xe88b, 0xe884, 0xe87d, 0xe876, 0xe870, 0xe869, 0xe862, 0xe85b, 
-    /* 0x00007c40: */ 0xe855, 0xe84e, 0xe847, 0xe841, 0xe83a, 0xe833, 0xe82c, 0xe826, 0xe81f, 0xe818, 0xe811, 0xe80b, 0xe804, 0xe7fd, 0xe7f6, 0xe7f0, 
-    /* 0x00007c60: */ 0xe7e9, 0xe7e2, 0xe7dc, 0xe7d5, 0xe7ce, 0xe7c7, 0xe7c1, 0xe7ba, 0xe7b3, 0xe7ac, 0xe7a6, 0xe79f, 0xe798, 0xe791, 0xe78b, 0xe784, 
-    /* 0x00007c80: */ 0xe77d, 0xe777, 0xe770, 0xe769, 0xe762, 0xe75c, 0xe755, 0xe74e, 0xe747, 0xe741, 0xe73a, 0xe733, 0xe72d, 0xe726, 0xe71f, 0xe718, 
-    /* 0x00007ca0: */ 0xe712, 0xe70b, 0xe704, 0xe6fd, 0xe6f7, 0xe6f0, 0xe6e9, 0xe6e3, 0xe6dc, 0xe6d5, 0xe6ce, 0xe6c8, 0xe6c1, 0xe6ba, 0xe6b4, 0xe6ad, 
-    /* 0x00007cc0: */ 0xe6a6, 0xe69f, 0xe699, 0xe692, 0xe68b, 0xe684, 0xe67e, 0xe677, 0xe670, 0xe66a, 0xe663, 0xe65c, 0xe655, 0xe64f, 0xe648, 0xe641, 
-    /* 0x00007ce0: */ 0xe63b, 0xe634, 0xe62d, 0xe626, 0xe620, 0xe619, 0xe612, 0xe60c, 0xe605, 0xe5fe, 0xe5f7, 0xe5f1, 0xe5ea, 0xe5e3, 0xe5dd, 0xe5d6, 
-    /* 0x00007d00: */ 0xe5cf, 0xe5c8, 0xe5c2, 0xe5bb, 0xe5b4, 0xe5ae, 0xe5a7, 0xe5a0, 0xe59a, 0xe593, 0xe58c, 0xe585, 0xe57f, 0xe578, 0xe571, 0xe56b, 
-    /* 0x00007d20: */ 0xe564, 0xe55d, 0xe556, 0xe550, 0xe549, 0xe542, 0xe53c, 0xe535, 0xe52e, 0xe528, 0xe521, 0xe51a, 0xe513, 0xe50d, 0xe506, 0xe4ff, 
-    /* 0x00007d40: */ 0xe4f9, 0xe4f2, 0xe4eb, 0xe4e4, 0xe4de, 0xe4d7, 0xe4d0, 0xe4ca, 0xe4c3, 0xe4bc, 0xe4b6, 0xe4af, 0xe4a8, 0xe4a2, 0xe49b, 0xe494, 
-    /* 0x00007d60: */ 0xe48d, 0xe487, 0xe480, 0xe479, 0xe473, 0xe46c, 0xe465, 0xe45f, 0xe458, 0xe451, 0xe44a, 0xe444, 0xe43d, 0xe436, 0xe430, 0xe429, 
-    /* 0x00007d80: */ 0xe422, 0xe41c, 0xe415, 0xe40e, 0xe408, 0xe401, 0xe3fa, 0xe3f3, 0xe3ed, 0xe3e6, 0xe3df, 0xe3d9, 0xe3d2, 0xe3cb, 0xe3c5, 0xe3be, 
-    /* 0x00007da0: */ 0xe3b7, 0xe3b1, 0xe3aa, 0xe3a3, 0xe39d, 0xe396, 0xe38f, 0xe388, 0xe382, 0xe37b, 0xe374, 0xe36e, 0xe367, 0xe360, 0xe35a, 0xe353, 
-    /* 0x00007dc0: */ 0xe34c, 0xe346, 0xe33f, 0xe338, 0xe332, 0xe32b, 0xe324, 0xe31e, 0xe317, 0xe310, 0xe30a, 0xe303, 0xe2fc, 0xe2f6, 0xe2ef, 0xe2e8, 
-    /* 0x00007de0: */ 0xe2e1, 0xe2db, 0xe2d4, 0xe2cd, 0xe2c7, 0xe2c0, 0xe2b9, 0xe2b3, 0xe2ac, 0xe2a5, 0xe29f, 0xe298, 0xe291, 0xe28b, 0xe284, 0xe27d, 
-    /* 0x00007e00: */ 0xe277, 0xe270, 0xe269, 0xe263, 0xe25c, 0xe255, 0xe24f, 0xe248, 0xe241, 0xe23b, 0xe234, 0xe22d, 0xe227, 0xe220, 0xe219, 0xe213, 
-    /* 0x00007e20: */ 0xe20c, 0xe205, 0xe1ff, 0xe1f8, 0xe1f1, 0xe1eb, 0xe1e4, 0xe1dd, 0xe1d7, 0xe1d0, 0xe1c9, 0xe1c3, 0xe1bc, 0xe1b5, 0xe1af, 0xe1a8, 
-    /* 0x00007e40: */ 0xe1a1, 0xe19b, 0xe194, 0xe18d, 0xe187, 0xe180, 0xe179, 0xe173, 0xe16c, 0xe166, 0xe15f, 0xe158, 0xe152, 0xe14b, 0xe144, 0xe13e, 
-    /* 0x00007e60: */ 0xe137, 0xe130, 0xe12a, 0xe123, 0xe11c, 0xe116, 0xe10f, 0xe108, 0xe102, 0xe0fb, 0xe0f4, 0xe0ee, 0xe0e7, 0xe0e0, 0xe0da, 0xe0d3, 
-    /* 0x00007e80: */ 0xe0cc, 0xe0c6, 0xe0bf, 0xe0b9, 0xe0b2, 0xe0ab, 0xe0a5, 0xe09e, 0xe097, 0xe091, 0xe08a, 0xe083, 0xe07d, 0xe076, 0xe06f, 0xe069, 
-    /* 0x00007ea0: */ 0xe062, 0xe05b, 0xe055, 0xe04e, 0xe048, 0xe041, 0xe03a, 0xe034, 0xe02d, 0xe026, 0xe020, 0xe019, 0xe012, 0xe00c, 0xe005, 0xdfff, 
-    /* 0x00007ec0: */ 0xdff8, 0xdff1, 0xdfeb, 0xdfe4, 0xdfdd, 0xdfd7, 0xdfd0, 0xdfc9, 0xdfc3, 0xdfbc, 0xdfb6, 0xdfaf, 0xdfa8, 0xdfa2, 0xdf9b, 0xdf94, 
-    /* 0x00007ee0: */ 0xdf8e, 0xdf87, 0xdf80, 0xdf7a, 0xdf73, 0xdf6d, 0xdf66, 0xdf5f, 0xdf59, 0xdf52, 0xdf4b, 0xdf45, 0xdf3e, 0xdf38, 0xdf31, 0xdf2a, 
-    /* 0x00007f00: */ 0xdf24, 0xdf1d, 0xdf16, 0xdf10, 0xdf09, 0xdf03, 0xdefc, 0xdef5, 0xdeef, 0xdee8, 0xdee1, 0xdedb, 0xded4, 0xdece, 0xdec7, 0xdec0, 
-    /* 0x00007f20: */ 0xdeba, 0xdeb3, 0xdeac, 0xdea6, 0xde9f, 0xde99, 0xde92, 0xde8b, 0xde85, 0xde7e, 0xde78, 0xde71, 0xde6a, 0xde64, 0xde5d, 0xde56, 
-    /* 0x00007f40: */ 0xde50, 0xde49, 0xde43, 0xde3c, 0xde35, 0xde2f, 0xde28, 0xde22, 0xde1b, 0xde14, 0xde0e, 0xde07, 0xde00, 0xddfa, 0xddf3, 0xdded, 
-    /* 0x00007f60: */ 0xdde6, 0xdddf, 0xddd9, 0xddd2, 0xddcc, 0xddc5, 0xddbe, 0xddb8, 0xddb1, 0xddab, 0xdda4, 0xdd9d, 0xdd97, 0xdd90, 0xdd8a, 0xdd83, 
-    /* 0x00007f80: */ 0xdd7c, 0xdd76, 0xdd6f, 0xdd69, 0xdd62, 0xdd5b, 0xdd55, 0xdd4e, 0xdd48, 0xdd41, 0xdd3a, 0xdd34, 0xdd2d, 0xdd27, 0xdd20, 0xdd19, 
-    /* 0x00007fa0: */ 0xdd13, 0xdd0c, 0xdd06, 0xdcff, 0xdcf8, 0xdcf2, 0xdceb, 0xdce5, 0xdcde, 0xdcd7, 0xdcd1, 0xdcca, 0xdcc4, 0xdcbd, 0xdcb6, 0xdcb0, 
-    /* 0x00007fc0: */ 0xdca9, 0xdca3, 0xdc9c, 0xdc96, 0xdc8f, 0xdc88, 0xdc82, 0xdc7b, 0xdc75, 0xdc6e, 0xdc67, 0xdc61, 0xdc5a, 0xdc54, 0xdc4d, 0xdc47, 
-    /* 0x00007fe0: */ 0xdc40, 0xdc39, 0xdc33, 0xdc2c, 0xdc26, 0xdc1f, 0xdc18, 0xdc12, 0xdc0b, 0xdc05, 0xdbfe, 0xdbf8, 0xdbf1, 0xdbea, 0xdbe4, 0xdbdd, 
-    /* 0x00008000: */ 0xdbd7, 0xdbd0, 0xdbca, 0xdbc3, 0xdbbc, 0xdbb6, 0xdbaf, 0xdba9, 0xdba2, 0xdb9b, 0xdb95, 0xdb8e, 0xdb88, 0xdb81, 0xdb7b, 0xdb74, 
-    /* 0x00008020: */ 0xdb6d, 0xdb67, 0xdb60, 0xdb5a, 0xdb53, 0xdb4d, 0xdb46, 0xdb40, 0xdb39, 0xdb32, 0xdb2c, 0xdb25, 0xdb1f, 0xdb18, 0xdb12, 0xdb0b, 
-    /* 0x00008040: */ 0xdb04, 0xdafe, 0xdaf7, 0xdaf1, 0xdaea, 0xdae4, 0xdadd, 0xdad6, 0xdad0, 0xdac9, 0xdac3, 0xdabc, 0xdab6, 0xdaaf, 0xdaa9, 0xdaa2, 
-    /* 0x00008060: */ 0xda9b, 0xda95, 0xda8e, 0xda88, 0xda81, 0xda7b, 0xda74, 0xda6e, 0xda67, 0xda60, 0xda5a, 0xda53, 0xda4d, 0xda46, 0xda40, 0xda39, 
-    /* 0x00008080: */ 0xda33, 0xda2c, 0xda26, 0xda1f, 0xda18, 0xda12, 0xda0b, 0xda05, 0xd9fe, 0xd9f8, 0xd9f1, 0xd9eb, 0xd9e4, 0xd9dd, 0xd9d7, 0xd9d0, 
-    /* 0x000080a0: */ 0xd9ca, 0xd9c3, 0xd9bd, 0xd9b6, 0xd9b0, 0xd9a9, 0xd9a3, 0xd99c, 0xd996, 0xd98f, 0xd988, 0xd982, 0xd97b, 0xd975, 0xd96e, 0xd968, 
-    /* 0x000080c0: */ 0xd961, 0xd95b, 0xd954, 0xd94e, 0xd947, 0xd941, 0xd93a, 0xd933, 0xd92d, 0xd926, 0xd920, 0xd919, 0xd913, 0xd90c, 0xd906, 0xd8ff, 
-    /* 0x000080e0: */ 0xd8f9, 0xd8f2, 0xd8ec, 0xd8e5, 0xd8df, 0xd8d8, 0xd8d2, 0xd8cb, 0xd8c4, 0xd8be, 0xd8b7, 0xd8b1, 0xd8aa, 0xd8a4, 0xd89d, 0xd897, 
-    /* 0x00008100: */ 0xd890, 0xd88a, 0xd883, 0xd87d, 0xd876, 0xd870, 0xd869, 0xd863, 0xd85c, 0xd856, 0xd84f, 0xd849, 0xd842, 0xd83c, 0xd835, 0xd82f, 
-    /* 0x00008120: */ 0xd828, 0xd821, 0xd81b, 0xd814, 0xd80e, 0xd807, 0xd801, 0xd7fa, 0xd7f4, 0xd7ed, 0xd7e7, 0xd7e0, 0xd7da, 0xd7d3, 0xd7cd, 0xd7c6, 
-    /* 0x00008140: */ 0xd7c0, 0xd7b9, 0xd7b3, 0xd7ac, 0xd7a6, 0xd79f, 0xd799, 0xd792, 0xd78c, 0xd785, 0xd77f, 0xd778, 0xd772, 0xd76b, 0xd765, 0xd75e, 
-    /* 0x00008160: */ 0xd758, 0xd751, 0xd74b, 0xd744, 0xd73e, 0xd737, 0xd731, 0xd72a, 0xd724, 0xd71d, 0xd717, 0xd710, 0xd70a, 0xd703, 0xd6fd, 0xd6f6, 
-    /* 0x00008180: */ 0xd6f0, 0xd6e9, 0xd6e3, 0xd6dc, 0xd6d6, 0xd6cf, 0xd6c9, 0xd6c2, 0xd6bc, 0xd6b5, 0xd6af, 0xd6a8, 0xd6a2, 0xd69b, 0xd695, 0xd68e, 
-    /* 0x000081a0: */ 0xd688, 0xd681, 0xd67b, 0xd674, 0xd66e, 0xd668, 0xd661, 0xd65b, 0xd654, 0xd64e, 0xd647, 0xd641, 0xd63a, 0xd634, 0xd62d, 0xd627, 
-    /* 0x000081c0: */ 0xd620, 0xd61a, 0xd613, 0xd60d, 0xd606, 0xd600, 0xd5f9, 0xd5f3, 0xd5ec, 0xd5e6, 0xd5df, 0xd5d9, 0xd5d3, 0xd5cc, 0xd5c6, 0xd5bf, 
-    /* 0x000081e0: */ 0xd5b9, 0xd5b2, 0xd5ac, 0xd5a5, 0xd59f, 0xd598, 0xd592, 0xd58b, 0xd585, 0xd57e, 0xd578, 0xd571, 0xd56b, 0xd565, 0xd55e, 0xd558, 
-    /* 0x00008200: */ 0xd551, 0xd54b, 0xd544, 0xd53e, 0xd537, 0xd531, 0xd52a, 0xd524, 0xd51d, 0xd517, 0xd511, 0xd50a, 0xd504, 0xd4fd, 0xd4f7, 0xd4f0, 
-    /* 0x00008220: */ 0xd4ea, 0xd4e3, 0xd4dd, 0xd4d6, 0xd4d0, 0xd4ca, 0xd4c3, 0xd4bd, 0xd4b6, 0xd4b0, 0xd4a9, 0xd4a3, 0xd49c, 0xd496, 0xd48f, 0xd489, 
-    /* 0x00008240: */ 0xd483, 0xd47c, 0xd476, 0xd46f, 0xd469, 0xd462, 0xd45c, 0xd455, 0xd44f, 0xd449, 0xd442, 0xd43c, 0xd435, 0xd42f, 0xd428, 0xd422, 
-    /* 0x00008260: */ 0xd41b, 0xd415, 0xd40f, 0xd408, 0xd402, 0xd3fb, 0xd3f5, 0xd3ee, 0xd3e8, 0xd3e2, 0xd3db, 0xd3d5, 0xd3ce, 0xd3c8, 0xd3c1, 0xd3bb, 
-    /* 0x00008280: */ 0xd3b4, 0xd3ae, 0xd3a8, 0xd3a1, 0xd39b, 0xd394, 0xd38e, 0xd387, 0xd381, 0xd37b, 0xd374, 0xd36e, 0xd367, 0xd361, 0xd35a, 0xd354, 
-    /* 0x000082a0: */ 0xd34e, 0xd347, 0xd341, 0xd33a, 0xd334, 0xd32e, 0xd327, 0xd321, 0xd31a, 0xd314, 0xd30d, 0xd307, 0xd301, 0xd2fa, 0xd2f4, 0xd2ed, 
-    /* 0x000082c0: */ 0xd2e7, 0xd2e0, 0xd2da, 0xd2d4, 0xd2cd, 0xd2c7, 0xd2c0, 0xd2ba, 0xd2b4, 0xd2ad, 0xd2a7, 0xd2a0, 0xd29a, 0xd294, 0xd28d, 0xd287, 
-    /* 0x000082e0: */ 0xd280, 0xd27a, 0xd274, 0xd26d, 0xd267, 0xd260, 0xd25a, 0xd253, 0xd24d, 0xd247, 0xd240, 0xd23a, 0xd233, 0xd22d, 0xd227, 0xd220, 
-    /* 0x00008300: */ 0xd21a, 0xd213, 0xd20d, 0xd207, 0xd200, 0xd1fa, 0xd1f3, 0xd1ed, 0xd1e7, 0xd1e0, 0xd1da, 0xd1d3, 0xd1cd, 0xd1c7, 0xd1c0, 0xd1ba, 
-    /* 0x00008320: */ 0xd1b4, 0xd1ad, 0xd1a7, 0xd1a0, 0xd19a, 0xd194, 0xd18d, 0xd187, 0xd180, 0xd17a, 0xd174, 0xd16d, 0xd167, 0xd160, 0xd15a, 0xd154, 
-    /* 0x00008340: */ 0xd14d, 0xd147, 0xd141, 0xd13a, 0xd134, 0xd12d, 0xd127, 0xd121, 0xd11a, 0xd114, 0xd10e, 0xd107, 0xd101, 0xd0fa, 0xd0f4, 0xd0ee, 
-    /* 0x00008360: */ 0xd0e7, 0xd0e1, 0xd0db, 0xd0d4, 0xd0ce, 0xd0c7, 0xd0c1, 0xd0bb, 0xd0b4, 0xd0ae, 0xd0a8, 0xd0a1, 0xd09b, 0xd094, 0xd08e, 0xd088, 
-    /* 0x00008380: */ 0xd081, 0xd07b, 0xd075, 0xd06e, 0xd068, 0xd062, 0xd05b, 0xd055, 0xd04e, 0xd048, 0xd042, 0xd03b, 0xd035, 0xd02f, 0xd028, 0xd022, 
-    /* 0x000083a0: */ 0xd01c, 0xd015, 0xd00f, 0xd008, 0xd002, 0xcffc, 0xcff5, 0xcfef, 0xcfe9, 0xcfe2, 0xcfdc, 0xcfd6, 0xcfcf, 0xcfc9, 0xcfc3, 0xcfbc, 
-    /* 0x000083c0: */ 0xcfb6, 0xcfb0, 0xcfa9, 0xcfa3, 0xcf9c, 0xcf96, 0xcf90, 0xcf89, 0xcf83, 0xcf7d, 0xcf76, 0xcf70, 0xcf6a, 0xcf63, 0xcf5d, 0xcf57, 
-    /* 0x000083e0: */ 0xcf50, 0xcf4a, 0xcf44, 0xcf3d, 0xcf37, 0xcf31, 0xcf2a, 0xcf24, 0xcf1e, 0xcf17, 0xcf11, 0xcf0b, 0xcf04, 0xcefe, 0xcef8, 0xcef1, 
-    /* 0x00008400: */ 0xceeb, 0xcee5, 0xcede, 0xced8, 0xced2, 0xcecb, 0xcec5, 0xcebf, 0xceb8, 0xceb2, 0xceac, 0xcea5, 0xce9f, 0xce99, 0xce92, 0xce8c, 
-    /* 0x00008420: */ 0xce86, 0xce7f, 0xce79, 0xce73, 0xce6c, 0xce66, 0xce60, 0xce5a, 0xce53, 0xce4d, 0xce47, 0xce40, 0xce3a, 0xce34, 0xce2d, 0xce27, 
-    /* 0x00008440: */ 0xce21, 0xce1a, 0xce14, 0xce0e, 0xce07, 0xce01, 0xcdfb, 0xcdf4, 0xcdee, 0xcde8, 0xcde2, 0xcddb, 0xcdd5, 0xcdcf, 0xcdc8, 0xcdc2, 
-    /* 0x00008460: */ 0xcdbc, 0xcdb5, 0xcdaf, 0xcda9, 0xcda2, 0xcd9c, 0xcd96, 0xcd90, 0xcd89, 0xcd83, 0xcd7d, 0xcd76, 0xcd70, 0xcd6a, 0xcd63, 0xcd5d, 
-    /* 0x00008480: */ 0xcd57, 0xcd51, 0xcd4a, 0xcd44, 0xcd3e, 0xcd37, 0xcd31, 0xcd2b, 0xcd25, 0xcd1e, 0xcd18, 0xcd12, 0xcd0b, 0xcd05, 0xccff, 0xccf9, 
-    /* 0x000084a0: */ 0xccf2, 0xccec, 0xcce6, 0xccdf, 0xccd9, 0xccd3, 0xcccd, 0xccc6, 0xccc0, 0xccba, 0xccb3, 0xccad, 0xcca7, 0xcca1, 0xcc9a, 0xcc94, 
-    /* 0x000084c0: */ 0xcc8e, 0xcc87, 0xcc81, 0xcc7b, 0xcc75, 0xcc6e, 0xcc68, 0xcc62, 0xcc5c, 0xcc55, 0xcc4f, 0xcc49, 0xcc42, 0xcc3c, 0xcc36, 0xcc30, 
-    /* 0x000084e0: */ 0xcc29, 0xcc23, 0xcc1d, 0xcc17, 0xcc10, 0xcc0a, 0xcc04, 0xcbfd, 0xcbf7, 0xcbf1, 0xcbeb, 0xcbe4, 0xcbde, 0xcbd8, 0xcbd2, 0xcbcb, 
-    /* 0x00008500: */ 0xcbc5, 0xcbbf, 0xcbb9, 0xcbb2, 0xcbac, 0xcba6, 0xcba0, 0xcb99, 0xcb93, 0xcb8d, 0xcb87, 0xcb80, 0xcb7a, 0xcb74, 0xcb6e, 0xcb67, 
-    /* 0x00008520: */ 0xcb61, 0xcb5b, 0xcb55, 0xcb4e, 0xcb48, 0xcb42, 0xcb3c, 0xcb35, 0xcb2f, 0xcb29, 0xcb23, 0xcb1c, 0xcb16, 0xcb10, 0xcb0a, 0xcb03, 
-    /* 0x00008540: */ 0xcafd, 0xcaf7, 0xcaf1, 0xcaea, 0xcae4, 0xcade, 0xcad8, 0xcad1, 0xcacb, 0xcac5, 0xcabf, 0xcab9, 0xcab2, 0xcaac, 0xcaa6, 0xcaa0, 
-    /* 0x00008560: */ 0xca99, 0xca93, 0xca8d, 0xca87, 0xca80, 0xca7a, 0xca74, 0xca6e, 0xca68, 0xca61, 0xca5b, 0xca55, 0xca4f, 0xca48, 0xca42, 0xca3c, 
-    /* 0x00008580: */ 0xca36, 0xca30, 0xca29, 0xca23, 0xca1d, 0xca17, 0xca10, 0xca0a, 0xca04, 0xc9fe, 0xc9f8, 0xc9f1, 0xc9eb, 0xc9e5, 0xc9df, 0xc9d9, 
-    /* 0x000085a0: */ 0xc9d2, 0xc9cc, 0xc9c6, 0xc9c0, 0xc9b9, 0xc9b3, 0xc9ad, 0xc9a7, 0xc9a1, 0xc99a, 0xc994, 0xc98e, 0xc988, 0xc982, 0xc97b, 0xc975, 
-    /* 0x000085c0: */ 0xc96f, 0xc969, 0xc963, 0xc95c, 0xc956, 0xc950, 0xc94a, 0xc944, 0xc93d, 0xc937, 0xc931, 0xc92b, 0xc925, 0xc91e, 0xc918, 0xc912, 
-    /* 0x000085e0: */ 0xc90c, 0xc906, 0xc8ff, 0xc8f9, 0xc8f3, 0xc8ed, 0xc8e7, 0xc8e1, 0xc8da, 0xc8d4, 0xc8ce, 0xc8c8, 0xc8c2, 0xc8bb, 0xc8b5, 0xc8af, 
-    /* 0x00008600: */ 0xc8a9, 0xc8a3, 0xc89d, 0xc896, 0xc890, 0xc88a, 0xc884, 0xc87e, 0xc877, 0xc871, 0xc86b, 0xc865, 0xc85f, 0xc859, 0xc852, 0xc84c, 
-    /* 0x00008620: */ 0xc846, 0xc840, 0xc83a, 0xc834, 0xc82d, 0xc827, 0xc821, 0xc81b, 0xc815, 0xc80f, 0xc808, 0xc802, 0xc7fc, 0xc7f6, 0xc7f0, 0xc7ea, 
-    /* 0x00008640: */ 0xc7e3, 0xc7dd, 0xc7d7, 0xc7d1, 0xc7cb, 0xc7c5, 0xc7be, 0xc7b8, 0xc7b2, 0xc7ac, 0xc7a6, 0xc7a0, 0xc799, 0xc793, 0xc78d, 0xc787, 
-    /* 0x00008660: */ 0xc781, 0xc77b, 0xc775, 0xc76e, 0xc768, 0xc762, 0xc75c, 0xc756, 0xc750, 0xc74a, 0xc743, 0xc73d, 0xc737, 0xc731, 0xc72b, 0xc725, 
-    /* 0x00008680: */ 0xc71f, 0xc718, 0xc712, 0xc70c, 0xc706, 0xc700, 0xc6fa, 0xc6f4, 0xc6ed, 0xc6e7, 0xc6e1, 0xc6db, 0xc6d5, 0xc6cf, 0xc6c9, 0xc6c2, 
-    /* 0x000086a0: */ 0xc6bc, 0xc6b6, 0xc6b0, 0xc6aa, 0xc6a4, 0xc69e, 0xc698, 0xc691, 0xc68b, 0xc685, 0xc67f, 0xc679, 0xc673, 0xc66d, 0xc667, 0xc660, 
-    /* 0x000086c0: */ 0xc65a, 0xc654, 0xc64e, 0xc648, 0xc642, 0xc63c, 0xc636, 0xc62f, 0xc629, 0xc623, 0xc61d, 0xc617, 0xc611, 0xc60b, 0xc605, 0xc5ff, 
-    /* 0x000086e0: */ 0xc5f8, 0xc5f2, 0xc5ec, 0xc5e6, 0xc5e0, 0xc5da, 0xc5d4, 0xc5ce, 0xc5c8, 0xc5c1, 0xc5bb, 0xc5b5, 0xc5af, 0xc5a9, 0xc5a3, 0xc59d, 
-    /* 0x00008700: */ 0xc597, 0xc591, 0xc58b, 0xc584, 0xc57e, 0xc578, 0xc572, 0xc56c, 0xc566, 0xc560, 0xc55a, 0xc554, 0xc54e, 0xc548, 0xc541, 0xc53b, 
-    /* 0x00008720: */ 0xc535, 0xc52f, 0xc529, 0xc523, 0xc51d, 0xc517, 0xc511, 0xc50b, 0xc505, 0xc4fe, 0xc4f8, 0xc4f2, 0xc4ec, 0xc4e6, 0xc4e0, 0xc4da, 
-    /* 0x00008740: */ 0xc4d4, 0xc4ce, 0xc4c8, 0xc4c2, 0xc4bc, 0xc4b6, 0xc4af, 0xc4a9, 0xc4a3, 0xc49d, 0xc497, 0xc491, 0xc48b, 0xc485, 0xc47f, 0xc479, 
-    /* 0x00008760: */ 0xc473, 0xc46d, 0xc467, 0xc461, 0xc45a, 0xc454, 0xc44e, 0xc448, 0xc442, 0xc43c, 0xc436, 0xc430, 0xc42a, 0xc424, 0xc41e, 0xc418, 
-    /* 0x00008780: */ 0xc412, 0xc40c, 0xc406, 0xc400, 0xc3f9, 0xc3f3, 0xc3ed, 0xc3e7, 0xc3e1, 0xc3db, 0xc3d5, 0xc3cf, 0xc3c9, 0xc3c3, 0xc3bd, 0xc3b7, 
-    /* 0x000087a0: */ 0xc3b1, 0xc3ab, 0xc3a5, 0xc39f, 0xc399, 0xc393, 0xc38d, 0xc387, 0xc381, 0xc37a, 0xc374, 0xc36e, 0xc368, 0xc362, 0xc35c, 0xc356, 
-    /* 0x000087c0: */ 0xc350, 0xc34a, 0xc344, 0xc33e, 0xc338, 0xc332, 0xc32c, 0xc326, 0xc320, 0xc31a, 0xc314, 0xc30e, 0xc308, 0xc302, 0xc2fc, 0xc2f6, 
-    /* 0x000087e0: */ 0xc2f0, 0xc2ea, 0xc2e4, 0xc2de, 0xc2d8, 0xc2d2, 0xc2cc, 0xc2c6, 0xc2c0, 0xc2b9, 0xc2b3, 0xc2ad, 0xc2a7, 0xc2a1, 0xc29b, 0xc295, 
-    /* 0x00008800: */ 0xc28f, 0xc289, 0xc283, 0xc27d, 0xc277, 0xc271, 0xc26b, 0xc265, 0xc25f, 0xc259, 0xc253, 0xc24d, 0xc247, 0xc241, 0xc23b, 0xc235, 
-    /* 0x00008820: */ 0xc22f, 0xc229, 0xc223, 0xc21d, 0xc217, 0xc211, 0xc20b, 0xc205, 0xc1ff, 0xc1f9, 0xc1f3, 0xc1ed, 0xc1e7, 0xc1e1, 0xc1db, 0xc1d5, 
-    /* 0x00008840: */ 0xc1cf, 0xc1c9, 0xc1c3, 0xc1bd, 0xc1b7, 0xc1b1, 0xc1ab, 0xc1a5, 0xc19f, 0xc199, 0xc193, 0xc18d, 0xc187, 0xc181, 0xc17b, 0xc175, 
-    /* 0x00008860: */ 0xc16f, 0xc16a, 0xc164, 0xc15e, 0xc158, 0xc152, 0xc14c, 0xc146, 0xc140, 0xc13a, 0xc134, 0xc12e, 0xc128, 0xc122, 0xc11c, 0xc116, 
-    /* 0x00008880: */ 0xc110, 0xc10a, 0xc104, 0xc0fe, 0xc0f8, 0xc0f2, 0xc0ec, 0xc0e6, 0xc0e0, 0xc0da, 0xc0d4, 0xc0ce, 0xc0c8, 0xc0c2, 0xc0bc, 0xc0b6, 
-    /* 0x000088a0: */ 0xc0b0, 0xc0ab, 0xc0a5, 0xc09f, 0xc099, 0xc093, 0xc08d, 0xc087, 0xc081, 0xc07b, 0xc075, 0xc06f, 0xc069, 0xc063, 0xc05d, 0xc057, 
-    /* 0x000088c0: */ 0xc051, 0xc04b, 0xc045, 0xc03f, 0xc039, 0xc033, 0xc02e, 0xc028, 0xc022, 0xc01c, 0xc016, 0xc010, 0xc00a, 0xc004, 0xbffe, 0xbff8, 
-    /* 0x000088e0: */ 0xbff2, 0xbfec, 0xbfe6, 0xbfe0, 0xbfda, 0xbfd4, 0xbfcf, 0xbfc9, 0xbfc3, 0xbfbd, 0xbfb7, 0xbfb1, 0xbfab, 0xbfa5, 0xbf9f, 0xbf99, 
-    /* 0x00008900: */ 0xbf93, 0xbf8d, 0xbf87, 0xbf82, 0xbf7c, 0xbf76, 0xbf70, 0xbf6a, 0xbf64, 0xbf5e, 0xbf58, 0xbf52, 0xbf4c, 0xbf46, 0xbf40, 0xbf3b, 
-    /* 0x00008920: */ 0xbf35, 0xbf2f, 0xbf29, 0xbf23, 0xbf1d, 0xbf17, 0xbf11, 0xbf0b, 0xbf05, 0xbeff, 0xbefa, 0xbef4, 0xbeee, 0xbee8, 0xbee2, 0xbedc, 
-    /* 0x00008940: */ 0xbed6, 0xbed0, 0xbeca, 0xbec4, 0xbebe, 0xbeb9, 0xbeb3, 0xbead, 0xbea7, 0xbea1, 0xbe9b, 0xbe95, 0xbe8f, 0xbe89, 0xbe84, 0xbe7e, 
-    /* 0x00008960: */ 0xbe78, 0xbe72, 0xbe6c, 0xbe66, 0xbe60, 0xbe5a, 0xbe54, 0xbe4f, 0xbe49, 0xbe43, 0xbe3d, 0xbe37, 0xbe31, 0xbe2b, 0xbe25, 0xbe20, 
-    /* 0x00008980: */ 0xbe1a, 0xbe14, 0xbe0e, 0xbe08, 0xbe02, 0xbdfc, 0xbdf6, 0xbdf1, 0xbdeb, 0xbde5, 0xbddf, 0xbdd9, 0xbdd3, 0xbdcd, 0xbdc7, 0xbdc2, 
-    /* 0x000089a0: */ 0xbdbc, 0xbdb6, 0xbdb0, 0xbdaa, 0xbda4, 0xbd9e, 0xbd99, 0xbd93, 0xbd8d, 0xbd87, 0xbd81, 0xbd7b, 0xbd75, 0xbd70, 0xbd6a, 0xbd64, 
-    /* 0x000089c0: */ 0xbd5e, 0xbd58, 0xbd52, 0xbd4c, 0xbd47, 0xbd41, 0xbd3b, 0xbd35, 0xbd2f, 0xbd29, 0xbd23, 0xbd1e, 0xbd18, 0xbd12, 0xbd0c, 0xbd06, 
-    /* 0x000089e0: */ 0xbd00, 0xbcfb, 0xbcf5, 0xbcef, 0xbce9, 0xbce3, 0xbcdd, 0xbcd8, 0xbcd2, 0xbccc, 0xbcc6, 0xbcc0, 0xbcba, 0xbcb5, 0xbcaf, 0xbca9, 
-    /* 0x00008a00: */ 0xbca3, 0xbc9d, 0xbc97, 0xbc92, 0xbc8c, 0xbc86, 0xbc80, 0xbc7a, 0xbc74, 0xbc6f, 0xbc69, 0xbc63, 0xbc5d, 0xbc57, 0xbc51, 0xbc4c, 
-    /* 0x00008a20: */ 0xbc46, 0xbc40, 0xbc3a, 0xbc34, 0xbc2f, 0xbc29, 0xbc23, 0xbc1d, 0xbc17, 0xbc12, 0xbc0c, 0xbc06, 0xbc00, 0xbbfa, 0xbbf4, 0xbbef, 
-    /* 0x00008a40: */ 0xbbe9, 0xbbe3, 0xbbdd, 0xbbd7, 0xbbd2, 0xbbcc, 0xbbc6, 0xbbc0, 0xbbba, 0xbbb5, 0xbbaf, 0xbba9, 0xbba3, 0xbb9d, 0xbb98, 0xbb92, 
-    /* 0x00008a60: */ 0xbb8c, 0xbb86, 0xbb80, 0xbb7b, 0xbb75, 0xbb6f, 0xbb69, 0xbb64, 0xbb5e, 0xbb58, 0xbb52, 0xbb4c, 0xbb47, 0xbb41, 0xbb3b, 0xbb35, 
-    /* 0x00008a80: */ 0xbb2f, 0xbb2a, 0xbb24, 0xbb1e, 0xbb18, 0xbb13, 0xbb0d, 0xbb07, 0xbb01, 0xbafb, 0xbaf6, 0xbaf0, 0xbaea, 0xbae4, 0xbadf, 0xbad9, 
-    /* 0x00008aa0: */ 0xbad3, 0xbacd, 0xbac8, 0xbac2, 0xbabc, 0xbab6, 0xbab0, 0xbaab, 0xbaa5, 0xba9f, 0xba99, 0xba94, 0xba8e, 0xba88, 0xba82, 0xba7d, 
-    /* 0x00008ac0: */ 0xba77, 0xba71, 0xba6b, 0xba66, 0xba60, 0xba5a, 0xba54, 0xba4f, 0xba49, 0xba43, 0xba3d, 0xba38, 0xba32, 0xba2c, 0xba26, 0xba21, 
-    /* 0x00008ae0: */ 0xba1b, 0xba15, 0xba0f, 0xba0a, 0xba04, 0xb9fe, 0xb9f8, 0xb9f3, 0xb9ed, 0xb9e7, 0xb9e2, 0xb9dc, 0xb9d6, 0xb9d0, 0xb9cb, 0xb9c5, 
-    /* 0x00008b00: */ 0xb9bf, 0xb9b9, 0xb9b4, 0xb9ae, 0xb9a8, 0xb9a2, 0xb99d, 0xb997, 0xb991, 0xb98c, 0xb986, 0xb980, 0xb97a, 0xb975, 0xb96f, 0xb969, 
-    /* 0x00008b20: */ 0xb964, 0xb95e, 0xb958, 0xb952, 0xb94d, 0xb947, 0xb941, 0xb93c, 0xb936, 0xb930, 0xb92a, 0xb925, 0xb91f, 0xb919, 0xb914, 0xb90e, 
-    /* 0x00008b40: */ 0xb908, 0xb902, 0xb8fd, 0xb8f7, 0xb8f1, 0xb8ec, 0xb8e6, 0xb8e0, 0xb8db, 0xb8d5, 0xb8cf, 0xb8c9, 0xb8c4, 0xb8be, 0xb8b8, 0xb8b3, 
-    /* 0x00008b60: */ 0xb8ad, 0xb8a7, 0xb8a2, 0xb89c, 0xb896, 0xb890, 0xb88b, 0xb885, 0xb87f, 0xb87a, 0xb874, 0xb86e, 0xb869, 0xb863, 0xb85d, 0xb858, 
-    /* 0x00008b80: */ 0xb852, 0xb84c, 0xb847, 0xb841, 0xb83b, 0xb836, 0xb830, 0xb82a, 0xb825, 0xb81f, 0xb819, 0xb814, 0xb80e, 0xb808, 0xb803, 0xb7fd, 
-    /* 0x00008ba0: */ 0xb7f7, 0xb7f2, 0xb7ec, 0xb7e6, 0xb7e1, 0xb7db, 0xb7d5, 0xb7d0, 0xb7ca, 0xb7c4, 0xb7bf, 0xb7b9, 0xb7b3, 0xb7ae, 0xb7a8, 0xb7a2, 
-    /* 0x00008bc0: */ 0xb79d, 0xb797, 0xb791, 0xb78c, 0xb786, 0xb780, 0xb77b, 0xb775, 0xb76f, 0xb76a, 0xb764, 0xb75e, 0xb759, 0xb753, 0xb74e, 0xb748, 
-    /* 0x00008be0: */ 0xb742, 0xb73d, 0xb737, 0xb731, 0xb72c, 0xb726, 0xb720, 0xb71b, 0xb715, 0xb710, 0xb70a, 0xb704, 0xb6ff, 0xb6f9, 0xb6f3, 0xb6ee, 
-    /* 0x00008c00: */ 0xb6e8, 0xb6e2, 0xb6dd, 0xb6d7, 0xb6d2, 0xb6cc, 0xb6c6, 0xb6c1, 0xb6bb, 0xb6b5, 0xb6b0, 0xb6aa, 0xb6a5, 0xb69f, 0xb699, 0xb694, 
-    /* 0x00008c20: */ 0xb68e, 0xb689, 0xb683, 0xb67d, 0xb678, 0xb672, 0xb66c, 0xb667, 0xb661, 0xb65c, 0xb656, 0xb650, 0xb64b, 0xb645, 0xb640, 0xb63a, 
-    /* 0x00008c40: */ 0xb634, 0xb62f, 0xb629, 0xb624, 0xb61e, 0xb618, 0xb613, 0xb60d, 0xb608, 0xb602, 0xb5fc, 0xb5f7, 0xb5f1, 0xb5ec, 0xb5e6, 0xb5e1, 
-    /* 0x00008c60: */ 0xb5db, 0xb5d5, 0xb5d0, 0xb5ca, 0xb5c5, 0xb5bf, 0xb5b9, 0xb5b4, 0xb5ae, 0xb5a9, 0xb5a3, 0xb59d, 0xb598, 0xb592, 0xb58d, 0xb587, 
-    /* 0x00008c80: */ 0xb582, 0xb57c, 0xb576, 0xb571, 0xb56b, 0xb566, 0xb560, 0xb55b, 0xb555, 0xb54f, 0xb54a, 0xb544, 0xb53f, 0xb539, 0xb534, 0xb52e, 
-    /* 0x00008ca0: */ 0xb529, 0xb523, 0xb51d, 0xb518, 0xb512, 0xb50d, 0xb507, 0xb502, 0xb4fc, 0xb4f6, 0xb4f1, 0xb4eb, 0xb4e6, 0xb4e0, 0xb4db, 0xb4d5, 
-    /* 0x00008cc0: */ 0xb4d0, 0xb4ca, 0xb4c5, 0xb4bf, 0xb4b9, 0xb4b4, 0xb4ae, 0xb4a9, 0xb4a3, 0xb49e, 0xb498, 0xb493, 0xb48d, 0xb488, 0xb482, 0xb47d, 
-    /* 0x00008ce0: */ 0xb477, 0xb471, 0xb46c, 0xb466, 0xb461, 0xb45b, 0xb456, 0xb450, 0xb44b, 0xb445, 0xb440, 0xb43a, 0xb435, 0xb42f, 0xb42a, 0xb424, 
-    /* 0x00008d00: */ 0xb41f, 0xb419, 0xb413, 0xb40e, 0xb408, 0xb403, 0xb3fd, 0xb3f8, 0xb3f2, 0xb3ed, 0xb3e7, 0xb3e2, 0xb3dc, 0xb3d7, 0xb3d1, 0xb3cc, 
-    /* 0x00008d20: */ 0xb3c6, 0xb3c1, 0xb3bb, 0xb3b6, 0xb3b0, 0xb3ab, 0xb3a5, 0xb3a0, 0xb39a, 0xb395, 0xb38f, 0xb38a, 0xb384, 0xb37f, 0xb379, 0xb374, 
-    /* 0x00008d40: */ 0xb36e, 0xb369, 0xb363, 0xb35e, 0xb358, 0xb353, 0xb34d, 0xb348, 0xb342, 0xb33d, 0xb337, 0xb332, 0xb32c, 0xb327, 0xb321, 0xb31c, 
-    /* 0x00008d60: */ 0xb316, 0xb311, 0xb30c, 0xb306, 0xb301, 0xb2fb, 0xb2f6, 0xb2f0, 0xb2eb, 0xb2e5, 0xb2e0, 0xb2da, 0xb2d5, 0xb2cf, 0xb2ca, 0xb2c4, 
-    /* 0x00008d80: */ 0xb2bf, 0xb2b9, 0xb2b4, 0xb2af, 0xb2a9, 0xb2a4, 0xb29e, 0xb299, 0xb293, 0xb28e, 0xb288, 0xb283, 0xb27d, 0xb278, 0xb272, 0xb26d, 
-    /* 0x00008da0: */ 0xb268, 0xb262, 0xb25d, 0xb257, 0xb252, 0xb24c, 0xb247, 0xb241, 0xb23c, 0xb237, 0xb231, 0xb22c, 0xb226, 0xb221, 0xb21b, 0xb216, 
-    /* 0x00008dc0: */ 0xb210, 0xb20b, 0xb206, 0xb200, 0xb1fb, 0xb1f5, 0xb1f0, 0xb1ea, 0xb1e5, 0xb1e0, 0xb1da, 0xb1d5, 0xb1cf, 0xb1ca, 0xb1c4, 0xb1bf, 
-    /* 0x00008de0: */ 0xb1ba, 0xb1b4, 0xb1af, 0xb1a9, 0xb1a4, 0xb19e, 0xb199, 0xb194, 0xb18e, 0xb189, 0xb183, 0xb17e, 0xb179, 0xb173, 0xb16e, 0xb168, 
-    /* 0x00008e00: */ 0xb163, 0xb15d, 0xb158, 0xb153, 0xb14d, 0xb148, 0xb142, 0xb13d, 0xb138, 0xb132, 0xb12d, 0xb127, 0xb122, 0xb11d, 0xb117, 0xb112, 
-    /* 0x00008e20: */ 0xb10c, 0xb107, 0xb102, 0xb0fc, 0xb0f7, 0xb0f1, 0xb0ec, 0xb0e7, 0xb0e1, 0xb0dc, 0xb0d7, 0xb0d1, 0xb0cc, 0xb0c6, 0xb0c1, 0xb0bc, 
-    /* 0x00008e40: */ 0xb0b6, 0xb0b1, 0xb0ab, 0xb0a6, 0xb0a1, 0xb09b, 0xb096, 0xb091, 0xb08b, 0xb086, 0xb080, 0xb07b, 0xb076, 0xb070, 0xb06b, 0xb066, 
-    /* 0x00008e60: */ 0xb060, 0xb05b, 0xb055, 0xb050, 0xb04b, 0xb045, 0xb040, 0xb03b, 0xb035, 0xb030, 0xb02b, 0xb025, 0xb020, 0xb01a, 0xb015, 0xb010, 
-    /* 0x00008e80: */ 0xb00a, 0xb005, 0xb000, 0xaffa, 0xaff5, 0xaff0, 0xafea, 0xafe5, 0xafe0, 0xafda, 0xafd5, 0xafd0, 0xafca, 0xafc5, 0xafc0, 0xafba, 
-    /* 0x00008ea0: */ 0xafb5, 0xafb0, 0xafaa, 0xafa5, 0xafa0, 0xaf9a, 0xaf95, 0xaf90, 0xaf8a, 0xaf85, 0xaf80, 0xaf7a, 0xaf75, 0xaf70, 0xaf6a, 0xaf65, 
-    /* 0x00008ec0: */ 0xaf60, 0xaf5a, 0xaf55, 0xaf50, 0xaf4a, 0xaf45, 0xaf40, 0xaf3a, 0xaf35, 0xaf30, 0xaf2a, 0xaf25, 0xaf20, 0xaf1a, 0xaf15, 0xaf10, 
-    /* 0x00008ee0: */ 0xaf0b, 0xaf05, 0xaf00, 0xaefb, 0xaef5, 0xaef0, 0xaeeb, 0xaee5, 0xaee0, 0xaedb, 0xaed5, 0xaed0, 0xaecb, 0xaec6, 0xaec0, 0xaebb, 
-    /* 0x00008f00: */ 0xaeb6, 0xaeb0, 0xaeab, 0xaea6, 0xaea0, 0xae9b, 0xae96, 0xae91, 0xae8b, 0xae86, 0xae81, 0xae7b, 0xae76, 0xae71, 0xae6c, 0xae66, 
-    /* 0x00008f20: */ 0xae61, 0xae5c, 0xae56, 0xae51, 0xae4c, 0xae47, 0xae41, 0xae3c, 0xae37, 0xae32, 0xae2c, 0xae27, 0xae22, 0xae1c, 0xae17, 0xae12, 
-    /* 0x00008f40: */ 0xae0d, 0xae07, 0xae02, 0xadfd, 0xadf8, 0xadf2, 0xaded, 0xade8, 0xade3, 0xaddd, 0xadd8, 0xadd3, 0xadce, 0xadc8, 0xadc3, 0xadbe, 
-    /* 0x00008f60: */ 0xadb9, 0xadb3, 0xadae, 0xada9, 0xada4, 0xad9e, 0xad99, 0xad94, 0xad8f, 0xad89, 0xad84, 0xad7f, 0xad7a, 0xad74, 0xad6f, 0xad6a, 
-    /* 0x00008f80: */ 0xad65, 0xad5f, 0xad5a, 0xad55, 0xad50, 0xad4a, 0xad45, 0xad40, 0xad3b, 0xad36, 0xad30, 0xad2b, 0xad26, 0xad21, 0xad1b, 0xad16, 
-    /* 0x00008fa0: */ 0xad11, 0xad0c, 0xad07, 0xad01, 0xacfc, 0xacf7, 0xacf2, 0xacec, 0xace7, 0xace2, 0xacdd, 0xacd8, 0xacd2, 0xaccd, 0xacc8, 0xacc3, 
-    /* 0x00008fc0: */ 0xacbe, 0xacb8, 0xacb3, 0xacae, 0xaca9, 0xaca3, 0xac9e, 0xac99, 0xac94, 0xac8f, 0xac89, 0xac84, 0xac7f, 0xac7a, 0xac75, 0xac70, 
-    /* 0x00008fe0: */ 0xac6a, 0xac65, 0xac60, 0xac5b, 0xac56, 0xac50, 0xac4b, 0xac46, 0xac41, 0xac3c, 0xac36, 0xac31, 0xac2c, 0xac27, 0xac22, 0xac1d, 
-    /* 0x00009000: */ 0xac17, 0xac12, 0xac0d, 0xac08, 0xac03, 0xabfd, 0xabf8, 0xabf3, 0xabee, 0xabe9, 0xabe4, 0xabde, 0xabd9, 0xabd4, 0xabcf, 0xabca, 
-    /* 0x00009020: */ 0xabc5, 0xabbf, 0xabba, 0xabb5, 0xabb0, 0xabab, 0xaba6, 0xaba1, 0xab9b, 0xab96, 0xab91, 0xab8c, 0xab87, 0xab82, 0xab7c, 0xab77, 
-    /* 0x00009040: */ 0xab72, 0xab6d, 0xab68, 0xab63, 0xab5e, 0xab58, 0xab53, 0xab4e, 0xab49, 0xab44, 0xab3f, 0xab3a, 0xab34, 0xab2f, 0xab2a, 0xab25, 
-    /* 0x00009060: */ 0xab20, 0xab1b, 0xab16, 0xab11, 0xab0b, 0xab06, 0xab01, 0xaafc, 0xaaf7, 0xaaf2, 0xaaed, 0xaae8, 0xaae2, 0xaadd, 0xaad8, 0xaad3, 
-    /* 0x00009080: */ 0xaace, 0xaac9, 0xaac4, 0xaabf, 0xaaba, 0xaab4, 0xaaaf, 0xaaaa, 0xaaa5, 0xaaa0, 0xaa9b, 0xaa96, 0xaa91, 0xaa8c, 0xaa86, 0xaa81, 
-    /* 0x000090a0: */ 0xaa7c, 0xaa77, 0xaa72, 0xaa6d, 0xaa68, 0xaa63, 0xaa5e, 0xaa59, 0xaa53, 0xaa4e, 0xaa49, 0xaa44, 0xaa3f, 0xaa3a, 0xaa35, 0xaa30, 
-    /* 0x000090c0: */ 0xaa2b, 0xaa26, 0xaa21, 0xaa1b, 0xaa16, 0xaa11, 0xaa0c, 0xaa07, 0xaa02, 0xa9fd, 0xa9f8, 0xa9f3, 0xa9ee, 0xa9e9, 0xa9e4, 0xa9df, 
-    /* 0x000090e0: */ 0xa9d9, 0xa9d4, 0xa9cf, 0xa9ca, 0xa9c5, 0xa9c0, 0xa9bb, 0xa9b6, 0xa9b1, 0xa9ac, 0xa9a7, 0xa9a2, 0xa99d, 0xa998, 0xa993, 0xa98e, 
-    /* 0x00009100: */ 0xa988, 0xa983, 0xa97e, 0xa979, 0xa974, 0xa96f, 0xa96a, 0xa965, 0xa960, 0xa95b, 0xa956, 0xa951, 0xa94c, 0xa947, 0xa942, 0xa93d, 
-    /* 0x00009120: */ 0xa938, 0xa933, 0xa92e, 0xa929, 0xa924, 0xa91f, 0xa91a, 0xa914, 0xa90f, 0xa90a, 0xa905, 0xa900, 0xa8fb, 0xa8f6, 0xa8f1, 0xa8ec, 
-    /* 0x00009140: */ 0xa8e7, 0xa8e2, 0xa8dd, 0xa8d8, 0xa8d3, 0xa8ce, 0xa8c9, 0xa8c4, 0xa8bf, 0xa8ba, 0xa8b5, 0xa8b0, 0xa8ab, 0xa8a6, 0xa8a1, 0xa89c, 
-    /* 0x00009160: */ 0xa897, 0xa892, 0xa88d, 0xa888, 0xa883, 0xa87e, 0xa879, 0xa874, 0xa86f, 0xa86a, 0xa865, 0xa860, 0xa85b, 0xa856, 0xa851, 0xa84c, 
-    /* 0x00009180: */ 0xa847, 0xa842, 0xa83d, 0xa838, 0xa833, 0xa82e, 0xa829, 0xa824, 0xa81f, 0xa81a, 0xa815, 0xa810, 0xa80b, 0xa806, 0xa801, 0xa7fc, 
-    /* 0x000091a0: */ 0xa7f7, 0xa7f2, 0xa7ed, 0xa7e8, 0xa7e3, 0xa7de, 0xa7d9, 0xa7d4, 0xa7cf, 0xa7ca, 0xa7c6, 0xa7c1, 0xa7bc, 0xa7b7, 0xa7b2, 0xa7ad, 
-    /* 0x000091c0: */ 0xa7a8, 0xa7a3, 0xa79e, 0xa799, 0xa794, 0xa78f, 0xa78a, 0xa785, 0xa780, 0xa77b, 0xa776, 0xa771, 0xa76c, 0xa767, 0xa762, 0xa75d, 
-    /* 0x000091e0: */ 0xa758, 0xa754, 0xa74f, 0xa74a, 0xa745, 0xa740, 0xa73b, 0xa736, 0xa731, 0xa72c, 0xa727, 0xa722, 0xa71d, 0xa718, 0xa713, 0xa70e, 
-    /* 0x00009200: */ 0xa709, 0xa705, 0xa700, 0xa6fb, 0xa6f6, 0xa6f1, 0xa6ec, 0xa6e7, 0xa6e2, 0xa6dd, 0xa6d8, 0xa6d3, 0xa6ce, 0xa6c9, 0xa6c5, 0xa6c0, 
-    /* 0x00009220: */ 0xa6bb, 0xa6b6, 0xa6b1, 0xa6ac, 0xa6a7, 0xa6a2, 0xa69d, 0xa698, 0xa693, 0xa68f, 0xa68a, 0xa685, 0xa680, 0xa67b, 0xa676, 0xa671, 
-    /* 0x00009240: */ 0xa66c, 0xa667, 0xa662, 0xa65e, 0xa659, 0xa654, 0xa64f, 0xa64a, 0xa645, 0xa640, 0xa63b, 0xa636, 0xa632, 0xa62d, 0xa628, 0xa623, 
-    /* 0x00009260: */ 0xa61e, 0xa619, 0xa614, 0xa60f, 0xa60b, 0xa606, 0xa601, 0xa5fc, 0xa5f7, 0xa5f2, 0xa5ed, 0xa5e8, 0xa5e4, 0xa5df, 0xa5da, 0xa5d5, 
-    /* 0x00009280: */ 0xa5d0, 0xa5cb, 0xa5c6, 0xa5c1, 0xa5bd, 0xa5b8, 0xa5b3, 0xa5ae, 0xa5a9, 0xa5a4, 0xa59f, 0xa59b, 0xa596, 0xa591, 0xa58c, 0xa587, 
-    /* 0x000092a0: */ 0xa582, 0xa57e, 0xa579, 0xa574, 0xa56f, 0xa56a, 0xa565, 0xa560, 0xa55c, 0xa557, 0xa552, 0xa54d, 0xa548, 0xa543, 0xa53f, 0xa53a, 
-    /* 0x000092c0: */ 0xa535, 0xa530, 0xa52b, 0xa526, 0xa522, 0xa51d, 0xa518, 0xa513, 0xa50e, 0xa509, 0xa505, 0xa500, 0xa4fb, 0xa4f6, 0xa4f1, 0xa4ed, 
-    /* 0x000092e0: */ 0xa4e8, 0xa4e3, 0xa4de, 0xa4d9, 0xa4d4, 0xa4d0, 0xa4cb, 0xa4c6, 0xa4c1, 0xa4bc, 0xa4b8, 0xa4b3, 0xa4ae, 0xa4a9, 0xa4a4, 0xa4a0, 
-    /* 0x00009300: */ 0xa49b, 0xa496, 0xa491, 0xa48c, 0xa488, 0xa483, 0xa47e, 0xa479, 0xa474, 0xa470, 0xa46b, 0xa466, 0xa461, 0xa45c, 0xa458, 0xa453, 
-    /* 0x00009320: */ 0xa44e, 0xa449, 0xa445, 0xa440, 0xa43b, 0xa436, 0xa431, 0xa42d, 0xa428, 0xa423, 0xa41e, 0xa41a, 0xa415, 0xa410, 0xa40b, 0xa407, 
-    /* 0x00009340: */ 0xa402, 0xa3fd, 0xa3f8, 0xa3f3, 0xa3ef, 0xa3ea, 0xa3e5, 0xa3e0, 0xa3dc, 0xa3d7, 0xa3d2, 0xa3cd, 0xa3c9, 0xa3c4, 0xa3bf, 0xa3ba, 
-    /* 0x00009360: */ 0xa3b6, 0xa3b1, 0xa3ac, 0xa3a7, 0xa3a3, 0xa39e, 0xa399, 0xa394, 0xa390, 0xa38b, 0xa386, 0xa381, 0xa37d, 0xa378, 0xa373, 0xa36e, 
-    /* 0x00009380: */ 0xa36a, 0xa365, 0xa360, 0xa35c, 0xa357, 0xa352, 0xa34d, 0xa349, 0xa344, 0xa33f, 0xa33a, 0xa336, 0xa331, 0xa32c, 0xa328, 0xa323, 
-    /* 0x000093a0: */ 0xa31e, 0xa319, 0xa315, 0xa310, 0xa30b, 0xa307, 0xa302, 0xa2fd, 0xa2f8, 0xa2f4, 0xa2ef, 0xa2ea, 0xa2e6, 0xa2e1, 0xa2dc, 0xa2d7, 
-    /* 0x000093c0: */ 0xa2d3, 0xa2ce, 0xa2c9, 0xa2c5, 0xa2c0, 0xa2bb, 0xa2b7, 0xa2b2, 0xa2ad, 0xa2a9, 0xa2a4, 0xa29f, 0xa29a, 0xa296, 0xa291, 0xa28c, 
-    /* 0x000093e0: */ 0xa288, 0xa283, 0xa27e, 0xa27a, 0xa275, 0xa270, 0xa26c, 0xa267, 0xa262, 0xa25e, 0xa259, 0xa254, 0xa250, 0xa24b, 0xa246, 0xa242, 
-    /* 0x00009400: */ 0xa23d, 0xa238, 0xa234, 0xa22f, 0xa22a, 0xa226, 0xa221, 0xa21c, 0xa218, 0xa213, 0xa20e, 0xa20a, 0xa205, 0xa200, 0xa1fc, 0xa1f7, 
-    /* 0x00009420: */ 0xa1f2, 0xa1ee, 0xa1e9, 0xa1e4, 0xa1e0, 0xa1db, 0xa1d7, 0xa1d2, 0xa1cd, 0xa1c9, 0xa1c4, 0xa1bf, 0xa1bb, 0xa1b6, 0xa1b1, 0xa1ad, 
-    /* 0x00009440: */ 0xa1a8, 0xa1a3, 0xa19f, 0xa19a, 0xa196, 0xa191, 0xa18c, 0xa188, 0xa183, 0xa17e, 0xa17a, 0xa175, 0xa171, 0xa16c, 0xa167, 0xa163, 
-    /* 0x00009460: */ 0xa15e, 0xa15a, 0xa155, 0xa150, 0xa14c, 0xa147, 0xa142, 0xa13e, 0xa139, 0xa135, 0xa130, 0xa12b, 0xa127, 0xa122, 0xa11e, 0xa119, 
-    /* 0x00009480: */ 0xa114, 0xa110, 0xa10b, 0xa107, 0xa102, 0xa0fd, 0xa0f9, 0xa0f4, 0xa0f0, 0xa0eb, 0xa0e6, 0xa0e2, 0xa0dd, 0xa0d9, 0xa0d4, 0xa0d0, 
-    /* 0x000094a0: */ 0xa0cb, 0xa0c6, 0xa0c2, 0xa0bd, 0xa0b9, 0xa0b4, 0xa0af, 0xa0ab, 0xa0a6, 0xa0a2, 0xa09d, 0xa099, 0xa094, 0xa08f, 0xa08b, 0xa086, 
-    /* 0x000094c0: */ 0xa082, 0xa07d, 0xa079, 0xa074, 0xa070, 0xa06b, 0xa066, 0xa062, 0xa05d, 0xa059, 0xa054, 0xa050, 0xa04b, 0xa047, 0xa042, 0xa03d, 
-    /* 0x000094e0: */ 0xa039, 0xa034, 0xa030, 0xa02b, 0xa027, 0xa022, 0xa01e, 0xa019, 0xa015, 0xa010, 0xa00b, 0xa007, 0xa002, 0x9ffe, 0x9ff9, 0x9ff5, 
-    /* 0x00009500: */ 0x9ff0, 0x9fec, 0x9fe7, 0x9fe3, 0x9fde, 0x9fda, 0x9fd5, 0x9fd1, 0x9fcc, 0x9fc8, 0x9fc3, 0x9fbe, 0x9fba, 0x9fb5, 0x9fb1, 0x9fac, 
-    /* 0x00009520: */ 0x9fa8, 0x9fa3, 0x9f9f, 0x9f9a, 0x9f96, 0x9f91, 0x9f8d, 0x9f88, 0x9f84, 0x9f7f, 0x9f7b, 0x9f76, 0x9f72, 0x9f6d, 0x9f69, 0x9f64, 
-    /* 0x00009540: */ 0x9f60, 0x9f5b, 0x9f57, 0x9f52, 0x9f4e, 0x9f49, 0x9f45, 0x9f40, 0x9f3c, 0x9f37, 0x9f33, 0x9f2e, 0x9f2a, 0x9f25, 0x9f21, 0x9f1c, 
-    /* 0x00009560: */ 0x9f18, 0x9f14, 0x9f0f, 0x9f0b, 0x9f06, 0x9f02, 0x9efd, 0x9ef9, 0x9ef4, 0x9ef0, 0x9eeb, 0x9ee7, 0x9ee2, 0x9ede, 0x9ed9, 0x9ed5, 
-    /* 0x00009580: */ 0x9ed0, 0x9ecc, 0x9ec8, 0x9ec3, 0x9ebf, 0x9eba, 0x9eb6, 0x9eb1, 0x9ead, 0x9ea8, 0x9ea4, 0x9e9f, 0x9e9b, 0x9e97, 0x9e92, 0x9e8e, 
-    /* 0x000095a0: */ 0x9e89, 0x9e85, 0x9e80, 0x9e7c, 0x9e77, 0x9e73, 0x9e6f, 0x9e6a, 0x9e66, 0x9e61, 0x9e5d, 0x9e58, 0x9e54, 0x9e50, 0x9e4b, 0x9e47, 
-    /* 0x000095c0: */ 0x9e42, 0x9e3e, 0x9e39, 0x9e35, 0x9e31, 0x9e2c, 0x9e28, 0x9e23, 0x9e1f, 0x9e1a, 0x9e16, 0x9e12, 0x9e0d, 0x9e09, 0x9e04, 0x9e00, 
-    /* 0x000095e0: */ 0x9dfc, 0x9df7, 0x9df3, 0x9dee, 0x9dea, 0x9de6, 0x9de1, 0x9ddd, 0x9dd8, 0x9dd4, 0x9dd0, 0x9dcb, 0x9dc7, 0x9dc2, 0x9dbe, 0x9dba, 
-    /* 0x00009600: */ 0x9db5, 0x9db1, 0x9dac, 0x9da8, 0x9da4, 0x9d9f, 0x9d9b, 0x9d96, 0x9d92, 0x9d8e, 0x9d89, 0x9d85, 0x9d81, 0x9d7c, 0x9d78, 0x9d73, 
-    /* 0x00009620: */ 0x9d6f, 0x9d6b, 0x9d66, 0x9d62, 0x9d5e, 0x9d59, 0x9d55, 0x9d50, 0x9d4c, 0x9d48, 0x9d43, 0x9d3f, 0x9d3b, 0x9d36, 0x9d32, 0x9d2e, 
-    /* 0x00009640: */ 0x9d29, 0x9d25, 0x9d21, 0x9d1c, 0x9d18, 0x9d13, 0x9d0f, 0x9d0b, 0x9d06, 0x9d02, 0x9cfe, 0x9cf9, 0x9cf5, 0x9cf1, 0x9cec, 0x9ce8, 
-    /* 0x00009660: */ 0x9ce4, 0x9cdf, 0x9cdb, 0x9cd7, 0x9cd2, 0x9cce, 0x9cca, 0x9cc5, 0x9cc1, 0x9cbd, 0x9cb8, 0x9cb4, 0x9cb0, 0x9cab, 0x9ca7, 0x9ca3, 
-    /* 0x00009680: */ 0x9c9e, 0x9c9a, 0x9c96, 0x9c91, 0x9c8d, 0x9c89, 0x9c85, 0x9c80, 0x9c7c, 0x9c78, 0x9c73, 0x9c6f, 0x9c6b, 0x9c66, 0x9c62, 0x9c5e, 
-    /* 0x000096a0: */ 0x9c59, 0x9c55, 0x9c51, 0x9c4d, 0x9c48, 0x9c44, 0x9c40, 0x9c3b, 0x9c37, 0x9c33, 0x9c2e, 0x9c2a, 0x9c26, 0x9c22, 0x9c1d, 0x9c19, 
-    /* 0x000096c0: */ 0x9c15, 0x9c10, 0x9c0c, 0x9c08, 0x9c04, 0x9bff, 0x9bfb, 0x9bf7, 0x9bf3, 0x9bee, 0x9bea, 0x9be6, 0x9be1, 0x9bdd, 0x9bd9, 0x9bd5, 
-    /* 0x000096e0: */ 0x9bd0, 0x9bcc, 0x9bc8, 0x9bc4, 0x9bbf, 0x9bbb, 0x9bb7, 0x9bb2, 0x9bae, 0x9baa, 0x9ba6, 0x9ba1, 0x9b9d, 0x9b99, 0x9b95, 0x9b90, 
-    /* 0x00009700: */ 0x9b8c, 0x9b88, 0x9b84, 0x9b7f, 0x9b7b, 0x9b77, 0x9b73, 0x9b6e, 0x9b6a, 0x9b66, 0x9b62, 0x9b5e, 0x9b59, 0x9b55, 0x9b51, 0x9b4d, 
-    /* 0x00009720: */ 0x9b48, 0x9b44, 0x9b40, 0x9b3c, 0x9b37, 0x9b33, 0x9b2f, 0x9b2b, 0x9b27, 0x9b22, 0x9b1e, 0x9b1a, 0x9b16, 0x9b11, 0x9b0d, 0x9b09, 
-    /* 0x00009740: */ 0x9b05, 0x9b01, 0x9afc, 0x9af8, 0x9af4, 0x9af0, 0x9aec, 0x9ae7, 0x9ae3, 0x9adf, 0x9adb, 0x9ad7, 0x9ad2, 0x9ace, 0x9aca, 0x9ac6, 
-    /* 0x00009760: */ 0x9ac2, 0x9abd, 0x9ab9, 0x9ab5, 0x9ab1, 0x9aad, 0x9aa8, 0x9aa4, 0x9aa0, 0x9a9c, 0x9a98, 0x9a94, 0x9a8f, 0x9a8b, 0x9a87, 0x9a83, 
-    /* 0x00009780: */ 0x9a7f, 0x9a7a, 0x9a76, 0x9a72, 0x9a6e, 0x9a6a, 0x9a66, 0x9a61, 0x9a5d, 0x9a59, 0x9a55, 0x9a51, 0x9a4d, 0x9a48, 0x9a44, 0x9a40, 
-    /* 0x000097a0: */ 0x9a3c, 0x9a38, 0x9a34, 0x9a2f, 0x9a2b, 0x9a27, 0x9a23, 0x9a1f, 0x9a1b, 0x9a17, 0x9a12, 0x9a0e, 0x9a0a, 0x9a06, 0x9a02, 0x99fe, 
-    /* 0x000097c0: */ 0x99fa, 0x99f5, 0x99f1, 0x99ed, 0x99e9, 0x99e5, 0x99e1, 0x99dd, 0x99d8, 0x99d4, 0x99d0, 0x99cc, 0x99c8, 0x99c4, 0x99c0, 0x99bc, 
-    /* 0x000097e0: */ 0x99b7, 0x99b3, 0x99af, 0x99ab, 0x99a7, 0x99a3, 0x999f, 0x999b, 0x9997, 0x9992, 0x998e, 0x998a, 0x9986, 0x9982, 0x997e, 0x997a, 
-    /* 0x00009800: */ 0x9976, 0x9972, 0x996d, 0x9969, 0x9965, 0x9961, 0x995d, 0x9959, 0x9955, 0x9951, 0x994d, 0x9949, 0x9945, 0x9940, 0x993c, 0x9938, 
-    /* 0x00009820: */ 0x9934, 0x9930, 0x992c, 0x9928, 0x9924, 0x9920, 0x991c, 0x9918, 0x9914, 0x990f, 0x990b, 0x9907, 0x9903, 0x98ff, 0x98fb, 0x98f7, 
-    /* 0x00009840: */ 0x98f3, 0x98ef, 0x98eb, 0x98e7, 0x98e3, 0x98df, 0x98db, 0x98d7, 0x98d2, 0x98ce, 0x98ca, 0x98c6, 0x98c2, 0x98be, 0x98ba, 0x98b6, 
-    /* 0x00009860: */ 0x98b2, 0x98ae, 0x98aa, 0x98a6, 0x98a2, 0x989e, 0x989a, 0x9896, 0x9892, 0x988e, 0x988a, 0x9886, 0x9882, 0x987e, 0x9879, 0x9875, 
-    /* 0x00009880: */ 0x9871, 0x986d, 0x9869, 0x9865, 0x9861, 0x985d, 0x9859, 0x9855, 0x9851, 0x984d, 0x9849, 0x9845, 0x9841, 0x983d, 0x9839, 0x9835, 
-    /* 0x000098a0: */ 0x9831, 0x982d, 0x9829, 0x9825, 0x9821, 0x981d, 0x9819, 0x9815, 0x9811, 0x980d, 0x9809, 0x9805, 0x9801, 0x97fd, 0x97f9, 0x97f5, 
-    /* 0x000098c0: */ 0x97f1, 0x97ed, 0x97e9, 0x97e5, 0x97e1, 0x97dd, 0x97d9, 0x97d5, 0x97d1, 0x97cd, 0x97c9, 0x97c5, 0x97c1, 0x97bd, 0x97b9, 0x97b5, 
-    /* 0x000098e0: */ 0x97b1, 0x97ad, 0x97a9, 0x97a5, 0x97a1, 0x979e, 0x979a, 0x9796, 0x9792, 0x978e, 0x978a, 0x9786, 0x9782, 0x977e, 0x977a, 0x9776, 
-    /* 0x00009900: */ 0x9772, 0x976e, 0x976a, 0x9766, 0x9762, 0x975e, 0x975a, 0x9756, 0x9752, 0x974e, 0x974a, 0x9747, 0x9743, 0x973f, 0x973b, 0x9737, 
-    /* 0x00009920: */ 0x9733, 0x972f, 0x972b, 0x9727, 0x9723, 0x971f, 0x971b, 0x9717, 0x9713, 0x970f, 0x970c, 0x9708, 0x9704, 0x9700, 0x96fc, 0x96f8, 
-    /* 0x00009940: */ 0x96f4, 0x96f0, 0x96ec, 0x96e8, 0x96e4, 0x96e0, 0x96dd, 0x96d9, 0x96d5, 0x96d1, 0x96cd, 0x96c9, 0x96c5, 0x96c1, 0x96bd, 0x96b9, 
-    /* 0x00009960: */ 0x96b5, 0x96b2, 0x96ae, 0x96aa, 0x96a6, 0x96a2, 0x969e, 0x969a, 0x9696, 0x9692, 0x968f, 0x968b, 0x9687, 0x9683, 0x967f, 0x967b, 
-    /* 0x00009980: */ 0x9677, 0x9673, 0x9670, 0x966c, 0x9668, 0x9664, 0x9660, 0x965c, 0x9658, 0x9654, 0x9651, 0x964d, 0x9649, 0x9645, 0x9641, 0x963d, 
-    /* 0x000099a0: */ 0x9639, 0x9635, 0x9632, 0x962e, 0x962a, 0x9626, 0x9622, 0x961e, 0x961a, 0x9617, 0x9613, 0x960f, 0x960b, 0x9607, 0x9603, 0x9600, 
-    /* 0x000099c0: */ 0x95fc, 0x95f8, 0x95f4, 0x95f0, 0x95ec, 0x95e9, 0x95e5, 0x95e1, 0x95dd, 0x95d9, 0x95d5, 0x95d2, 0x95ce, 0x95ca, 0x95c6, 0x95c2, 
-    /* 0x000099e0: */ 0x95be, 0x95bb, 0x95b7, 0x95b3, 0x95af, 0x95ab, 0x95a8, 0x95a4, 0x95a0, 0x959c, 0x9598, 0x9594, 0x9591, 0x958d, 0x9589, 0x9585, 
-    /* 0x00009a00: */ 0x9581, 0x957e, 0x957a, 0x9576, 0x9572, 0x956e, 0x956b, 0x9567, 0x9563, 0x955f, 0x955b, 0x9558, 0x9554, 0x9550, 0x954c, 0x9549, 
-    /* 0x00009a20: */ 0x9545, 0x9541, 0x953d, 0x9539, 0x9536, 0x9532, 0x952e, 0x952a, 0x9526, 0x9523, 0x951f, 0x951b, 0x9517, 0x9514, 0x9510, 0x950c, 
-    /* 0x00009a40: */ 0x9508, 0x9505, 0x9501, 0x94fd, 0x94f9, 0x94f6, 0x94f2, 0x94ee, 0x94ea, 0x94e6, 0x94e3, 0x94df, 0x94db, 0x94d7, 0x94d4, 0x94d0, 
-    /* 0x00009a60: */ 0x94cc, 0x94c8, 0x94c5, 0x94c1, 0x94bd, 0x94ba, 0x94b6, 0x94b2, 0x94ae, 0x94ab, 0x94a7, 0x94a3, 0x949f, 0x949c, 0x9498, 0x9494, 
-    /* 0x00009a80: */ 0x9490, 0x948d, 0x9489, 0x9485, 0x9482, 0x947e, 0x947a, 0x9476, 0x9473, 0x946f, 0x946b, 0x9468, 0x9464, 0x9460, 0x945c, 0x9459, 
-    /* 0x00009aa0: */ 0x9455, 0x9451, 0x944e, 0x944a, 0x9446, 0x9442, 0x943f, 0x943b, 0x9437, 0x9434, 0x9430, 0x942c, 0x9429, 0x9425, 0x9421, 0x941e, 
-    /* 0x00009ac0: */ 0x941a, 0x9416, 0x9412, 0x940f, 0x940b, 0x9407, 0x9404, 0x9400, 0x93fc, 0x93f9, 0x93f5, 0x93f1, 0x93ee, 0x93ea, 0x93e6, 0x93e3, 
-    /* 0x00009ae0: */ 0x93df, 0x93db, 0x93d8, 0x93d4, 0x93d0, 0x93cd, 0x93c9, 0x93c5, 0x93c2, 0x93be, 0x93ba, 0x93b7, 0x93b3, 0x93af, 0x93ac, 0x93a8, 
-    /* 0x00009b00: */ 0x93a4, 0x93a1, 0x939d, 0x939a, 0x9396, 0x9392, 0x938f, 0x938b, 0x9387, 0x9384, 0x9380, 0x937c, 0x9379, 0x9375, 0x9371, 0x936e, 
-    /* 0x00009b20: */ 0x936a, 0x9367, 0x9363, 0x935f, 0x935c, 0x9358, 0x9354, 0x9351, 0x934d, 0x934a, 0x9346, 0x9342, 0x933f, 0x933b, 0x9338, 0x9334, 
-    /* 0x00009b40: */ 0x9330, 0x932d, 0x9329, 0x9325, 0x9322, 0x931e, 0x931b, 0x9317, 0x9313, 0x9310, 0x930c, 0x9309, 0x9305, 0x9301, 0x92fe, 0x92fa, 
-    /* 0x00009b60: */ 0x92f7, 0x92f3, 0x92f0, 0x92ec, 0x92e8, 0x92e5, 0x92e1, 0x92de, 0x92da, 0x92d6, 0x92d3, 0x92cf, 0x92cc, 0x92c8, 0x92c5, 0x92c1, 
-    /* 0x00009b80: */ 0x92bd, 0x92ba, 0x92b6, 0x92b3, 0x92af, 0x92ac, 0x92a8, 0x92a4, 0x92a1, 0x929d, 0x929a, 0x9296, 0x9293, 0x928f, 0x928c, 0x9288, 
-    /* 0x00009ba0: */ 0x9284, 0x9281, 0x927d, 0x927a, 0x9276, 0x9273, 0x926f, 0x926c, 0x9268, 0x9265, 0x9261, 0x925d, 0x925a, 0x9256, 0x9253, 0x924f, 
-    /* 0x00009bc0: */ 0x924c, 0x9248, 0x9245, 0x9241, 0x923e, 0x923a, 0x9237, 0x9233, 0x9230, 0x922c, 0x9229, 0x9225, 0x9221, 0x921e, 0x921a, 0x9217, 
-    /* 0x00009be0: */ 0x9213, 0x9210, 0x920c, 0x9209, 0x9205, 0x9202, 0x91fe, 0x91fb, 0x91f7, 0x91f4, 0x91f0, 0x91ed, 0x91e9, 0x91e6, 0x91e2, 0x91df, 
-    /* 0x00009c00: */ 0x91db, 0x91d8, 0x91d4, 0x91d1, 0x91cd, 0x91ca, 0x91c6, 0x91c3, 0x91bf, 0x91bc, 0x91b9, 0x91b5, 0x91b2, 0x91ae, 0x91ab, 0x91a7, 
-    /* 0x00009c20: */ 0x91a4, 0x91a0, 0x919d, 0x9199, 0x9196, 0x9192, 0x918f, 0x918b, 0x9188, 0x9184, 0x9181, 0x917e, 0x917a, 0x9177, 0x9173, 0x9170, 
-    /* 0x00009c40: */ 0x916c, 0x9169, 0x9165, 0x9162, 0x915e, 0x915b, 0x9158, 0x9154, 0x9151, 0x914d, 0x914a, 0x9146, 0x9143, 0x913f, 0x913c, 0x9139, 
-    /* 0x00009c60: */ 0x9135, 0x9132, 0x912e, 0x912b, 0x9127, 0x9124, 0x9121, 0x911d, 0x911a, 0x9116, 0x9113, 0x910f, 0x910c, 0x9109, 0x9105, 0x9102, 
-    /* 0x00009c80: */ 0x90fe, 0x90fb, 0x90f8, 0x90f4, 0x90f1, 0x90ed, 0x90ea, 0x90e7, 0x90e3, 0x90e0, 0x90dc, 0x90d9, 0x90d6, 0x90d2, 0x90cf, 0x90cb, 
-    /* 0x00009ca0: */ 0x90c8, 0x90c5, 0x90c1, 0x90be, 0x90ba, 0x90b7, 0x90b4, 0x90b0, 0x90ad, 0x90a9, 0x90a6, 0x90a3, 0x909f, 0x909c, 0x9099, 0x9095, 
-    /* 0x00009cc0: */ 0x9092, 0x908e, 0x908b, 0x9088, 0x9084, 0x9081, 0x907e, 0x907a, 0x9077, 0x9074, 0x9070, 0x906d, 0x9069, 0x9066, 0x9063, 0x905f, 
-    /* 0x00009ce0: */ 0x905c, 0x9059, 0x9055, 0x9052, 0x904f, 0x904b, 0x9048, 0x9045, 0x9041, 0x903e, 0x903b, 0x9037, 0x9034, 0x9031, 0x902d, 0x902a, 
-    /* 0x00009d00: */ 0x9027, 0x9023, 0x9020, 0x901d, 0x9019, 0x9016, 0x9013, 0x900f, 0x900c, 0x9009, 0x9005, 0x9002, 0x8fff, 0x8ffb, 0x8ff8, 0x8ff5, 
-    /* 0x00009d20: */ 0x8ff1, 0x8fee, 0x8feb, 0x8fe7, 0x8fe4, 0x8fe1, 0x8fdd, 0x8fda, 0x8fd7, 0x8fd4, 0x8fd0, 0x8fcd, 0x8fca, 0x8fc6, 0x8fc3, 0x8fc0, 
-    /* 0x00009d40: */ 0x8fbd, 0x8fb9, 0x8fb6, 0x8fb3, 0x8faf, 0x8fac, 0x8fa9, 0x8fa5, 0x8fa2, 0x8f9f, 0x8f9c, 0x8f98, 0x8f95, 0x8f92, 0x8f8f, 0x8f8b, 
-    /* 0x00009d60: */ 0x8f88, 0x8f85, 0x8f81, 0x8f7e, 0x8f7b, 0x8f78, 0x8f74, 0x8f71, 0x8f6e, 0x8f6b, 0x8f67, 0x8f64, 0x8f61, 0x8f5e, 0x8f5a, 0x8f57, 
-    /* 0x00009d80: */ 0x8f54, 0x8f51, 0x8f4d, 0x8f4a, 0x8f47, 0x8f44, 0x8f40, 0x8f3d, 0x8f3a, 0x8f37, 0x8f33, 0x8f30, 0x8f2d, 0x8f2a, 0x8f26, 0x8f23, 
-    /* 0x00009da0: */ 0x8f20, 0x8f1d, 0x8f19, 0x8f16, 0x8f13, 0x8f10, 0x8f0d, 0x8f09, 0x8f06, 0x8f03, 0x8f00, 0x8efc, 0x8ef9, 0x8ef6, 0x8ef3, 0x8ef0, 
-    /* 0x00009dc0: */ 0x8eec, 0x8ee9, 0x8ee6, 0x8ee3, 0x8ee0, 0x8edc, 0x8ed9, 0x8ed6, 0x8ed3, 0x8ecf, 0x8ecc, 0x8ec9, 0x8ec6, 0x8ec3, 0x8ebf, 0x8ebc, 
-    /* 0x00009de0: */ 0x8eb9, 0x8eb6, 0x8eb3, 0x8eb0, 0x8eac, 0x8ea9, 0x8ea6, 0x8ea3, 0x8ea0, 0x8e9c, 0x8e99, 0x8e96, 0x8e93, 0x8e90, 0x8e8d, 0x8e89, 
-    /* 0x00009e00: */ 0x8e86, 0x8e83, 0x8e80, 0x8e7d, 0x8e7a, 0x8e76, 0x8e73, 0x8e70, 0x8e6d, 0x8e6a, 0x8e67, 0x8e63, 0x8e60, 0x8e5d, 0x8e5a, 0x8e57, 
-    /* 0x00009e20: */ 0x8e54, 0x8e50, 0x8e4d, 0x8e4a, 0x8e47, 0x8e44, 0x8e41, 0x8e3e, 0x8e3a, 0x8e37, 0x8e34, 0x8e31, 0x8e2e, 0x8e2b, 0x8e28, 0x8e25, 
-    /* 0x00009e40: */ 0x8e21, 0x8e1e, 0x8e1b, 0x8e18, 0x8e15, 0x8e12, 0x8e0f, 0x8e0b, 0x8e08, 0x8e05, 0x8e02, 0x8dff, 0x8dfc, 0x8df9, 0x8df6, 0x8df3, 
-    /* 0x00009e60: */ 0x8def, 0x8dec, 0x8de9, 0x8de6, 0x8de3, 0x8de0, 0x8ddd, 0x8dda, 0x8dd7, 0x8dd4, 0x8dd0, 0x8dcd, 0x8dca, 0x8dc7, 0x8dc4, 0x8dc1, 
-    /* 0x00009e80: */ 0x8dbe, 0x8dbb, 0x8db8, 0x8db5, 0x8db1, 0x8dae, 0x8dab, 0x8da8, 0x8da5, 0x8da2, 0x8d9f, 0x8d9c, 0x8d99, 0x8d96, 0x8d93, 0x8d90, 
-    /* 0x00009ea0: */ 0x8d8d, 0x8d8a, 0x8d86, 0x8d83, 0x8d80, 0x8d7d, 0x8d7a, 0x8d77, 0x8d74, 0x8d71, 0x8d6e, 0x8d6b, 0x8d68, 0x8d65, 0x8d62, 0x8d5f, 
-    /* 0x00009ec0: */ 0x8d5c, 0x8d59, 0x8d56, 0x8d52, 0x8d4f, 0x8d4c, 0x8d49, 0x8d46, 0x8d43, 0x8d40, 0x8d3d, 0x8d3a, 0x8d37, 0x8d34, 0x8d31, 0x8d2e, 
-    /* 0x00009ee0: */ 0x8d2b, 0x8d28, 0x8d25, 0x8d22, 0x8d1f, 0x8d1c, 0x8d19, 0x8d16, 0x8d13, 0x8d10, 0x8d0d, 0x8d0a, 0x8d07, 0x8d04, 0x8d01, 0x8cfe, 
-    /* 0x00009f00: */ 0x8cfb, 0x8cf8, 0x8cf5, 0x8cf2, 0x8cef, 0x8cec, 0x8ce9, 0x8ce6, 0x8ce3, 0x8ce0, 0x8cdd, 0x8cda, 0x8cd7, 0x8cd4, 0x8cd1, 0x8cce, 
-    /* 0x00009f20: */ 0x8ccb, 0x8cc8, 0x8cc5, 0x8cc2, 0x8cbf, 0x8cbc, 0x8cb9, 0x8cb6, 0x8cb3, 0x8cb0, 0x8cad, 0x8caa, 0x8ca7, 0x8ca4, 0x8ca1, 0x8c9e, 
-    /* 0x00009f40: */ 0x8c9b, 0x8c98, 0x8c95, 0x8c92, 0x8c8f, 0x8c8c, 0x8c89, 0x8c86, 0x8c83, 0x8c81, 0x8c7e, 0x8c7b, 0x8c78, 0x8c75, 0x8c72, 0x8c6f, 
-    /* 0x00009f60: */ 0x8c6c, 0x8c69, 0x8c66, 0x8c63, 0x8c60, 0x8c5d, 0x8c5a, 0x8c57, 0x8c54, 0x8c51, 0x8c4e, 0x8c4c, 0x8c49, 0x8c46, 0x8c43, 0x8c40, 
-    /* 0x00009f80: */ 0x8c3d, 0x8c3a, 0x8c37, 0x8c34, 0x8c31, 0x8c2e, 0x8c2b, 0x8c28, 0x8c26, 0x8c23, 0x8c20, 0x8c1d, 0x8c1a, 0x8c17, 0x8c14, 0x8c11, 
-    /* 0x00009fa0: */ 0x8c0e, 0x8c0b, 0x8c08, 0x8c06, 0x8c03, 0x8c00, 0x8bfd, 0x8bfa, 0x8bf7, 0x8bf4, 0x8bf1, 0x8bee, 0x8bec, 0x8be9, 0x8be6, 0x8be3, 
-    /* 0x00009fc0: */ 0x8be0, 0x8bdd, 0x8bda, 0x8bd7, 0x8bd4, 0x8bd2, 0x8bcf, 0x8bcc, 0x8bc9, 0x8bc6, 0x8bc3, 0x8bc0, 0x8bbd, 0x8bbb, 0x8bb8, 0x8bb5, 
-    /* 0x00009fe0: */ 0x8bb2, 0x8baf, 0x8bac, 0x8ba9, 0x8ba7, 0x8ba4, 0x8ba1, 0x8b9e, 0x8b9b, 0x8b98, 0x8b95, 0x8b93, 0x8b90, 0x8b8d, 0x8b8a, 0x8b87, 
-    /* 0x0000a000: */ 0x8b84, 0x8b82, 0x8b7f, 0x8b7c, 0x8b79, 0x8b76, 0x8b73, 0x8b71, 0x8b6e, 0x8b6b, 0x8b68, 0x8b65, 0x8b62, 0x8b60, 0x8b5d, 0x8b5a, 
-    /* 0x0000a020: */ 0x8b57, 0x8b54, 0x8b51, 0x8b4f, 0x8b4c, 0x8b49, 0x8b46, 0x8b43, 0x8b41, 0x8b3e, 0x8b3b, 0x8b38, 0x8b35, 0x8b33, 0x8b30, 0x8b2d, 
-    /* 0x0000a040: */ 0x8b2a, 0x8b27, 0x8b25, 0x8b22, 0x8b1f, 0x8b1c, 0x8b19, 0x8b17, 0x8b14, 0x8b11, 0x8b0e, 0x8b0b, 0x8b09, 0x8b06, 0x8b03, 0x8b00, 
-    /* 0x0000a060: */ 0x8afd, 0x8afb, 0x8af8, 0x8af5, 0x8af2, 0x8af0, 0x8aed, 0x8aea, 0x8ae7, 0x8ae5, 0x8ae2, 0x8adf, 0x8adc, 0x8ad9, 0x8ad7, 0x8ad4, 
-    /* 0x0000a080: */ 0x8ad1, 0x8ace, 0x8acc, 0x8ac9, 0x8ac6, 0x8ac3, 0x8ac1, 0x8abe, 0x8abb, 0x8ab8, 0x8ab6, 0x8ab3, 0x8ab0, 0x8aad, 0x8aab, 0x8aa8, 
-    /* 0x0000a0a0: */ 0x8aa5, 0x8aa2, 0x8aa0, 0x8a9d, 0x8a9a, 0x8a98, 0x8a95, 0x8a92, 0x8a8f, 0x8a8d, 0x8a8a, 0x8a87, 0x8a84, 0x8a82, 0x8a7f, 0x8a7c, 
-    /* 0x0000a0c0: */ 0x8a7a, 0x8a77, 0x8a74, 0x8a71, 0x8a6f, 0x8a6c, 0x8a69, 0x8a67, 0x8a64, 0x8a61, 0x8a5f, 0x8a5c, 0x8a59, 0x8a56, 0x8a54, 0x8a51, 
-    /* 0x0000a0e0: */ 0x8a4e, 0x8a4c, 0x8a49, 0x8a46, 0x8a44, 0x8a41, 0x8a3e, 0x8a3c, 0x8a39, 0x8a36, 0x8a33, 0x8a31, 0x8a2e, 0x8a2b, 0x8a29, 0x8a26, 
-    /* 0x0000a100: */ 0x8a23, 0x8a21, 0x8a1e, 0x8a1b, 0x8a19, 0x8a16, 0x8a13, 0x8a11, 0x8a0e, 0x8a0b, 0x8a09, 0x8a06, 0x8a03, 0x8a01, 0x89fe, 0x89fb, 
-    /* 0x0000a120: */ 0x89f9, 0x89f6, 0x89f3, 0x89f1, 0x89ee, 0x89ec, 0x89e9, 0x89e6, 0x89e4, 0x89e1, 0x89de, 0x89dc, 0x89d9, 0x89d6, 0x89d4, 0x89d1, 
-    /* 0x0000a140: */ 0x89cf, 0x89cc, 0x89c9, 0x89c7, 0x89c4, 0x89c1, 0x89bf, 0x89bc, 0x89ba, 0x89b7, 0x89b4, 0x89b2, 0x89af, 0x89ac, 0x89aa, 0x89a7, 
-    /* 0x0000a160: */ 0x89a5, 0x89a2, 0x899f, 0x899d, 0x899a, 0x8998, 0x8995, 0x8992, 0x8990, 0x898d, 0x898b, 0x8988, 0x8985, 0x8983, 0x8980, 0x897e, 
-    /* 0x0000a180: */ 0x897b, 0x8978, 0x8976, 0x8973, 0x8971, 0x896e, 0x896b, 0x8969, 0x8966, 0x8964, 0x8961, 0x895f, 0x895c, 0x8959, 0x8957, 0x8954, 
-    /* 0x0000a1a0: */ 0x8952, 0x894f, 0x894d, 0x894a, 0x8947, 0x8945, 0x8942, 0x8940, 0x893d, 0x893b, 0x8938, 0x8936, 0x8933, 0x8930, 0x892e, 0x892b, 
-    /* 0x0000a1c0: */ 0x8929, 0x8926, 0x8924, 0x8921, 0x891f, 0x891c, 0x891a, 0x8917, 0x8915, 0x8912, 0x890f, 0x890d, 0x890a, 0x8908, 0x8905, 0x8903, 
-    /* 0x0000a1e0: */ 0x8900, 0x88fe, 0x88fb, 0x88f9, 0x88f6, 0x88f4, 0x88f1, 0x88ef, 0x88ec, 0x88ea, 0x88e7, 0x88e5, 0x88e2, 0x88e0, 0x88dd, 0x88db, 
-    /* 0x0000a200: */ 0x88d8, 0x88d6, 0x88d3, 0x88d1, 0x88ce, 0x88cc, 0x88c9, 0x88c7, 0x88c4, 0x88c2, 0x88bf, 0x88bd, 0x88ba, 0x88b8, 0x88b5, 0x88b3, 
-    /* 0x0000a220: */ 0x88b0, 0x88ae, 0x88ab, 0x88a9, 0x88a6, 0x88a4, 0x88a1, 0x889f, 0x889c, 0x889a, 0x8897, 0x8895, 0x8892, 0x8890, 0x888e, 0x888b, 
-    /* 0x0000a240: */ 0x8889, 0x8886, 0x8884, 0x8881, 0x887f, 0x887c, 0x887a, 0x8877, 0x8875, 0x8873, 0x8870, 0x886e, 0x886b, 0x8869, 0x8866, 0x8864, 
-    /* 0x0000a260: */ 0x8861, 0x885f, 0x885d, 0x885a, 0x8858, 0x8855, 0x8853, 0x8850, 0x884e, 0x884c, 0x8849, 0x8847, 0x8844, 0x8842, 0x883f, 0x883d, 
-    /* 0x0000a280: */ 0x883b, 0x8838, 0x8836, 0x8833, 0x8831, 0x882f, 0x882c, 0x882a, 0x8827, 0x8825, 0x8822, 0x8820, 0x881e, 0x881b, 0x8819, 0x8816, 
-    /* 0x0000a2a0: */ 0x8814, 0x8812, 0x880f, 0x880d, 0x880a, 0x8808, 0x8806, 0x8803, 0x8801, 0x87ff, 0x87fc, 0x87fa, 0x87f7, 0x87f5, 0x87f3, 0x87f0, 
-    /* 0x0000a2c0: */ 0x87ee, 0x87ec, 0x87e9, 0x87e7, 0x87e4, 0x87e2, 0x87e0, 0x87dd, 0x87db, 0x87d9, 0x87d6, 0x87d4, 0x87d2, 0x87cf, 0x87cd, 0x87ca, 
-    /* 0x0000a2e0: */ 0x87c8, 0x87c6, 0x87c3, 0x87c1, 0x87bf, 0x87bc, 0x87ba, 0x87b8, 0x87b5, 0x87b3, 0x87b1, 0x87ae, 0x87ac, 0x87aa, 0x87a7, 0x87a5, 
-    /* 0x0000a300: */ 0x87a3, 0x87a0, 0x879e, 0x879c, 0x8799, 0x8797, 0x8795, 0x8792, 0x8790, 0x878e, 0x878b, 0x8789, 0x8787, 0x8784, 0x8782, 0x8780, 
-    /* 0x0000a320: */ 0x877d, 0x877b, 0x8779, 0x8777, 0x8774, 0x8772, 0x8770, 0x876d, 0x876b, 0x8769, 0x8766, 0x8764, 0x8762, 0x8760, 0x875d, 0x875b, 
-    /* 0x0000a340: */ 0x8759, 0x8756, 0x8754, 0x8752, 0x8750, 0x874d, 0x874b, 0x8749, 0x8746, 0x8744, 0x8742, 0x8740, 0x873d, 0x873b, 0x8739, 0x8737, 
-    /* 0x0000a360: */ 0x8734, 0x8732, 0x8730, 0x872d, 0x872b, 0x8729, 0x8727, 0x8724, 0x8722, 0x8720, 0x871e, 0x871b, 0x8719, 0x8717, 0x8715, 0x8712, 
-    /* 0x0000a380: */ 0x8710, 0x870e, 0x870c, 0x8709, 0x8707, 0x8705, 0x8703, 0x8700, 0x86fe, 0x86fc, 0x86fa, 0x86f8, 0x86f5, 0x86f3, 0x86f1, 0x86ef, 
-    /* 0x0000a3a0: */ 0x86ec, 0x86ea, 0x86e8, 0x86e6, 0x86e4, 0x86e1, 0x86df, 0x86dd, 0x86db, 0x86d8, 0x86d6, 0x86d4, 0x86d2, 0x86d0, 0x86cd, 0x86cb, 
-    /* 0x0000a3c0: */ 0x86c9, 0x86c7, 0x86c5, 0x86c2, 0x86c0, 0x86be, 0x86bc, 0x86ba, 0x86b7, 0x86b5, 0x86b3, 0x86b1, 0x86af, 0x86ac, 0x86aa, 0x86a8, 
-    /* 0x0000a3e0: */ 0x86a6, 0x86a4, 0x86a2, 0x869f, 0x869d, 0x869b, 0x8699, 0x8697, 0x8695, 0x8692, 0x8690, 0x868e, 0x868c, 0x868a, 0x8688, 0x8685, 
-    /* 0x0000a400: */ 0x8683, 0x8681, 0x867f, 0x867d, 0x867b, 0x8678, 0x8676, 0x8674, 0x8672, 0x8670, 0x866e, 0x866c, 0x8669, 0x8667, 0x8665, 0x8663, 
-    /* 0x0000a420: */ 0x8661, 0x865f, 0x865d, 0x865a, 0x8658, 0x8656, 0x8654, 0x8652, 0x8650, 0x864e, 0x864c, 0x8649, 0x8647, 0x8645, 0x8643, 0x8641, 
-    /* 0x0000a440: */ 0x863f, 0x863d, 0x863b, 0x8639, 0x8636, 0x8634, 0x8632, 0x8630, 0x862e, 0x862c, 0x862a, 0x8628, 0x8626, 0x8624, 0x8621, 0x861f, 
-    /* 0x0000a460: */ 0x861d, 0x861b, 0x8619, 0x8617, 0x8615, 0x8613, 0x8611, 0x860f, 0x860d, 0x860a, 0x8608, 0x8606, 0x8604, 0x8602, 0x8600, 0x85fe, 
-    /* 0x0000a480: */ 0x85fc, 0x85fa, 0x85f8, 0x85f6, 0x85f4, 0x85f2, 0x85f0, 0x85ed, 0x85eb, 0x85e9, 0x85e7, 0x85e5, 0x85e3, 0x85e1, 0x85df, 0x85dd, 
-    /* 0x0000a4a0: */ 0x85db, 0x85d9, 0x85d7, 0x85d5, 0x85d3, 0x85d1, 0x85cf, 0x85cd, 0x85cb, 0x85c9, 0x85c7, 0x85c5, 0x85c2, 0x85c0, 0x85be, 0x85bc, 
-    /* 0x0000a4c0: */ 0x85ba, 0x85b8, 0x85b6, 0x85b4, 0x85b2, 0x85b0, 0x85ae, 0x85ac, 0x85aa, 0x85a8, 0x85a6, 0x85a4, 0x85a2, 0x85a0, 0x859e, 0x859c, 
-    /* 0x0000a4e0: */ 0x859a, 0x8598, 0x8596, 0x8594, 0x8592, 0x8590, 0x858e, 0x858c, 0x858a, 0x8588, 0x8586, 0x8584, 0x8582, 0x8580, 0x857e, 0x857c, 
-    /* 0x0000a500: */ 0x857a, 0x8578, 0x8576, 0x8574, 0x8572, 0x8570, 0x856e, 0x856c, 0x856a, 0x8568, 0x8566, 0x8564, 0x8562, 0x8561, 0x855f, 0x855d, 
-    /* 0x0000a520: */ 0x855b, 0x8559, 0x8557, 0x8555, 0x8553, 0x8551, 0x854f, 0x854d, 0x854b, 0x8549, 0x8547, 0x8545, 0x8543, 0x8541, 0x853f, 0x853d, 
-    /* 0x0000a540: */ 0x853b, 0x8539, 0x8538, 0x8536, 0x8534, 0x8532, 0x8530, 0x852e, 0x852c, 0x852a, 0x8528, 0x8526, 0x8524, 0x8522, 0x8520, 0x851f, 
-    /* 0x0000a560: */ 0x851d, 0x851b, 0x8519, 0x8517, 0x8515, 0x8513, 0x8511, 0x850f, 0x850d, 0x850b, 0x8509, 0x8508, 0x8506, 0x8504, 0x8502, 0x8500, 
-    /* 0x0000a580: */ 0x84fe, 0x84fc, 0x84fa, 0x84f8, 0x84f7, 0x84f5, 0x84f3, 0x84f1, 0x84ef, 0x84ed, 0x84eb, 0x84e9, 0x84e7, 0x84e6, 0x84e4, 0x84e2, 
-    /* 0x0000a5a0: */ 0x84e0, 0x84de, 0x84dc, 0x84da, 0x84d8, 0x84d7, 0x84d5, 0x84d3, 0x84d1, 0x84cf, 0x84cd, 0x84cb, 0x84ca, 0x84c8, 0x84c6, 0x84c4, 
-    /* 0x0000a5c0: */ 0x84c2, 0x84c0, 0x84be, 0x84bd, 0x84bb, 0x84b9, 0x84b7, 0x84b5, 0x84b3, 0x84b2, 0x84b0, 0x84ae, 0x84ac, 0x84aa, 0x84a8, 0x84a7, 
-    /* 0x0000a5e0: */ 0x84a5, 0x84a3, 0x84a1, 0x849f, 0x849d, 0x849c, 0x849a, 0x8498, 0x8496, 0x8494, 0x8493, 0x8491, 0x848f, 0x848d, 0x848b, 0x8489, 
-    /* 0x0000a600: */ 0x8488, 0x8486, 0x8484, 0x8482, 0x8480, 0x847f, 0x847d, 0x847b, 0x8479, 0x8477, 0x8476, 0x8474, 0x8472, 0x8470, 0x846e, 0x846d, 
-    /* 0x0000a620: */ 0x846b, 0x8469, 0x8467, 0x8466, 0x8464, 0x8462, 0x8460, 0x845e, 0x845d, 0x845b, 0x8459, 0x8457, 0x8456, 0x8454, 0x8452, 0x8450, 
-    /* 0x0000a640: */ 0x844f, 0x844d, 0x844b, 0x8449, 0x8447, 0x8446, 0x8444, 0x8442, 0x8440, 0x843f, 0x843d, 0x843b, 0x8439, 0x8438, 0x8436, 0x8434, 
-    /* 0x0000a660: */ 0x8433, 0x8431, 0x842f, 0x842d, 0x842c, 0x842a, 0x8428, 0x8426, 0x8425, 0x8423, 0x8421, 0x841f, 0x841e, 0x841c, 0x841a, 0x8419, 
-    /* 0x0000a680: */ 0x8417, 0x8415, 0x8413, 0x8412, 0x8410, 0x840e, 0x840d, 0x840b, 0x8409, 0x8407, 0x8406, 0x8404, 0x8402, 0x8401, 0x83ff, 0x83fd, 
-    /* 0x0000a6a0: */ 0x83fc, 0x83fa, 0x83f8, 0x83f6, 0x83f5, 0x83f3, 0x83f1, 0x83f0, 0x83ee, 0x83ec, 0x83eb, 0x83e9, 0x83e7, 0x83e6, 0x83e4, 0x83e2, 
-    /* 0x0000a6c0: */ 0x83e1, 0x83df, 0x83dd, 0x83dc, 0x83da, 0x83d8, 0x83d7, 0x83d5, 0x83d3, 0x83d2, 0x83d0, 0x83ce, 0x83cd, 0x83cb, 0x83c9, 0x83c8, 
-    /* 0x0000a6e0: */ 0x83c6, 0x83c4, 0x83c3, 0x83c1, 0x83bf, 0x83be, 0x83bc, 0x83ba, 0x83b9, 0x83b7, 0x83b6, 0x83b4, 0x83b2, 0x83b1, 0x83af, 0x83ad, 
-    /* 0x0000a700: */ 0x83ac, 0x83aa, 0x83a8, 0x83a7, 0x83a5, 0x83a4, 0x83a2, 0x83a0, 0x839f, 0x839d, 0x839c, 0x839a, 0x8398, 0x8397, 0x8395, 0x8393, 
-    /* 0x0000a720: */ 0x8392, 0x8390, 0x838f, 0x838d, 0x838b, 0x838a, 0x8388, 0x8387, 0x8385, 0x8383, 0x8382, 0x8380, 0x837f, 0x837d, 0x837c, 0x837a, 
-    /* 0x0000a740: */ 0x8378, 0x8377, 0x8375, 0x8374, 0x8372, 0x8370, 0x836f, 0x836d, 0x836c, 0x836a, 0x8369, 0x8367, 0x8365, 0x8364, 0x8362, 0x8361, 
-    /* 0x0000a760: */ 0x835f, 0x835e, 0x835c, 0x835a, 0x8359, 0x8357, 0x8356, 0x8354, 0x8353, 0x8351, 0x8350, 0x834e, 0x834d, 0x834b, 0x8349, 0x8348, 
-    /* 0x0000a780: */ 0x8346, 0x8345, 0x8343, 0x8342, 0x8340, 0x833f, 0x833d, 0x833c, 0x833a, 0x8339, 0x8337, 0x8336, 0x8334, 0x8332, 0x8331, 0x832f, 
-    /* 0x0000a7a0: */ 0x832e, 0x832c, 0x832b, 0x8329, 0x8328, 0x8326, 0x8325, 0x8323, 0x8322, 0x8320, 0x831f, 0x831d, 0x831c, 0x831a, 0x8319, 0x8317, 
-    /* 0x0000a7c0: */ 0x8316, 0x8314, 0x8313, 0x8311, 0x8310, 0x830e, 0x830d, 0x830b, 0x830a, 0x8308, 0x8307, 0x8305, 0x8304, 0x8302, 0x8301, 0x8300, 
-    /* 0x0000a7e0: */ 0x82fe, 0x82fd, 0x82fb, 0x82fa, 0x82f8, 0x82f7, 0x82f5, 0x82f4, 0x82f2, 0x82f1, 0x82ef, 0x82ee, 0x82ed, 0x82eb, 0x82ea, 0x82e8, 
-    /* 0x0000a800: */ 0x82e7, 0x82e5, 0x82e4, 0x82e2, 0x82e1, 0x82df, 0x82de, 0x82dd, 0x82db, 0x82da, 0x82d8, 0x82d7, 0x82d5, 0x82d4, 0x82d3, 0x82d1, 
-    /* 0x0000a820: */ 0x82d0, 0x82ce, 0x82cd, 0x82cb, 0x82ca, 0x82c9, 0x82c7, 0x82c6, 0x82c4, 0x82c3, 0x82c1, 0x82c0, 0x82bf, 0x82bd, 0x82bc, 0x82ba, 
-    /* 0x0000a840: */ 0x82b9, 0x82b8, 0x82b6, 0x82b5, 0x82b3, 0x82b2, 0x82b1, 0x82af, 0x82ae, 0x82ac, 0x82ab, 0x82aa, 0x82a8, 0x82a7, 0x82a5, 0x82a4, 
-    /* 0x0000a860: */ 0x82a3, 0x82a1, 0x82a0, 0x829f, 0x829d, 0x829c, 0x829a, 0x8299, 0x8298, 0x8296, 0x8295, 0x8294, 0x8292, 0x8291, 0x828f, 0x828e, 
-    /* 0x0000a880: */ 0x828d, 0x828b, 0x828a, 0x8289, 0x8287, 0x8286, 0x8285, 0x8283, 0x8282, 0x8281, 0x827f, 0x827e, 0x827d, 0x827b, 0x827a, 0x8279, 
-    /* 0x0000a8a0: */ 0x8277, 0x8276, 0x8275, 0x8273, 0x8272, 0x8271, 0x826f, 0x826e, 0x826d, 0x826b, 0x826a, 0x8269, 0x8267, 0x8266, 0x8265, 0x8263, 
-    /* 0x0000a8c0: */ 0x8262, 0x8261, 0x825f, 0x825e, 0x825d, 0x825b, 0x825a, 0x8259, 0x8257, 0x8256, 0x8255, 0x8254, 0x8252, 0x8251, 0x8250, 0x824e, 
-    /* 0x0000a8e0: */ 0x824d, 0x824c, 0x824b, 0x8249, 0x8248, 0x8247, 0x8245, 0x8244, 0x8243, 0x8242, 0x8240, 0x823f, 0x823e, 0x823c, 0x823b, 0x823a, 
-    /* 0x0000a900: */ 0x8239, 0x8237, 0x8236, 0x8235, 0x8234, 0x8232, 0x8231, 0x8230, 0x822e, 0x822d, 0x822c, 0x822b, 0x8229, 0x8228, 0x8227, 0x8226, 
-    /* 0x0000a920: */ 0x8224, 0x8223, 0x8222, 0x8221, 0x821f, 0x821e, 0x821d, 0x821c, 0x821b, 0x8219, 0x8218, 0x8217, 0x8216, 0x8214, 0x8213, 0x8212, 
-    /* 0x0000a940: */ 0x8211, 0x820f, 0x820e, 0x820d, 0x820c, 0x820b, 0x8209, 0x8208, 0x8207, 0x8206, 0x8205, 0x8203, 0x8202, 0x8201, 0x8200, 0x81fe, 
-    /* 0x0000a960: */ 0x81fd, 0x81fc, 0x81fb, 0x81fa, 0x81f8, 0x81f7, 0x81f6, 0x81f5, 0x81f4, 0x81f3, 0x81f1, 0x81f0, 0x81ef, 0x81ee, 0x81ed, 0x81eb, 
-    /* 0x0000a980: */ 0x81ea, 0x81e9, 0x81e8, 0x81e7, 0x81e6, 0x81e4, 0x81e3, 0x81e2, 0x81e1, 0x81e0, 0x81de, 0x81dd, 0x81dc, 0x81db, 0x81da, 0x81d9, 
-    /* 0x0000a9a0: */ 0x81d8, 0x81d6, 0x81d5, 0x81d4, 0x81d3, 0x81d2, 0x81d1, 0x81cf, 0x81ce, 0x81cd, 0x81cc, 0x81cb, 0x81ca, 0x81c9, 0x81c7, 0x81c6, 
-    /* 0x0000a9c0: */ 0x81c5, 0x81c4, 0x81c3, 0x81c2, 0x81c1, 0x81c0, 0x81be, 0x81bd, 0x81bc, 0x81bb, 0x81ba, 0x81b9, 0x81b8, 0x81b7, 0x81b5, 0x81b4, 
-    /* 0x0000a9e0: */ 0x81b3, 0x81b2, 0x81b1, 0x81b0, 0x81af, 0x81ae, 0x81ad, 0x81ab, 0x81aa, 0x81a9, 0x81a8, 0x81a7, 0x81a6, 0x81a5, 0x81a4, 0x81a3, 
-    /* 0x0000aa00: */ 0x81a2, 0x81a1, 0x819f, 0x819e, 0x819d, 0x819c, 0x819b, 0x819a, 0x8199, 0x8198, 0x8197, 0x8196, 0x8195, 0x8194, 0x8193, 0x8191, 
-    /* 0x0000aa20: */ 0x8190, 0x818f, 0x818e, 0x818d, 0x818c, 0x818b, 0x818a, 0x8189, 0x8188, 0x8187, 0x8186, 0x8185, 0x8184, 0x8183, 0x8182, 0x8181, 
-    /* 0x0000aa40: */ 0x817f, 0x817e, 0x817d, 0x817c, 0x817b, 0x817a, 0x8179, 0x8178, 0x8177, 0x8176, 0x8175, 0x8174, 0x8173, 0x8172, 0x8171, 0x8170, 
-    /* 0x0000aa60: */ 0x816f, 0x816e, 0x816d, 0x816c, 0x816b, 0x816a, 0x8169, 0x8168, 0x8167, 0x8166, 0x8165, 0x8164, 0x8163, 0x8162, 0x8161, 0x8160, 
-    /* 0x0000aa80: */ 0x815f, 0x815e, 0x815d, 0x815c, 0x815b, 0x815a, 0x8159, 0x8158, 0x8157, 0x8156, 0x8155, 0x8154, 0x8153, 0x8152, 0x8151, 0x8150, 
-    /* 0x0000aaa0: */ 0x814f, 0x814e, 0x814d, 0x814c, 0x814b, 0x814a, 0x8149, 0x8148, 0x8147, 0x8146, 0x8145, 0x8144, 0x8143, 0x8142, 0x8142, 0x8141, 
-    /* 0x0000aac0: */ 0x8140, 0x813f, 0x813e, 0x813d, 0x813c, 0x813b, 0x813a, 0x8139, 0x8138, 0x8137, 0x8136, 0x8135, 0x8134, 0x8133, 0x8132, 0x8131, 
-    /* 0x0000aae0: */ 0x8131, 0x8130, 0x812f, 0x812e, 0x812d, 0x812c, 0x812b, 0x812a, 0x8129, 0x8128, 0x8127, 0x8126, 0x8125, 0x8125, 0x8124, 0x8123, 
-    /* 0x0000ab00: */ 0x8122, 0x8121, 0x8120, 0x811f, 0x811e, 0x811d, 0x811c, 0x811c, 0x811b, 0x811a, 0x8119, 0x8118, 0x8117, 0x8116, 0x8115, 0x8114, 
-    /* 0x0000ab20: */ 0x8113, 0x8113, 0x8112, 0x8111, 0x8110, 0x810f, 0x810e, 0x810d, 0x810c, 0x810c, 0x810b, 0x810a, 0x8109, 0x8108, 0x8107, 0x8106, 
-    /* 0x0000ab40: */ 0x8106, 0x8105, 0x8104, 0x8103, 0x8102, 0x8101, 0x8100, 0x8100, 0x80ff, 0x80fe, 0x80fd, 0x80fc, 0x80fb, 0x80fa, 0x80fa, 0x80f9, 
-    /* 0x0000ab60: */ 0x80f8, 0x80f7, 0x80f6, 0x80f5, 0x80f5, 0x80f4, 0x80f3, 0x80f2, 0x80f1, 0x80f0, 0x80f0, 0x80ef, 0x80ee, 0x80ed, 0x80ec, 0x80eb, 
-    /* 0x0000ab80: */ 0x80eb, 0x80ea, 0x80e9, 0x80e8, 0x80e7, 0x80e7, 0x80e6, 0x80e5, 0x80e4, 0x80e3, 0x80e3, 0x80e2, 0x80e1, 0x80e0, 0x80df, 0x80df, 
-    /* 0x0000aba0: */ 0x80de, 0x80dd, 0x80dc, 0x80db, 0x80db, 0x80da, 0x80d9, 0x80d8, 0x80d7, 0x80d7, 0x80d6, 0x80d5, 0x80d4, 0x80d4, 0x80d3, 0x80d2, 
-    /* 0x0000abc0: */ 0x80d1, 0x80d0, 0x80d0, 0x80cf, 0x80ce, 0x80cd, 0x80cd, 0x80cc, 0x80cb, 0x80ca, 0x80ca, 0x80c9, 0x80c8, 0x80c7, 0x80c7, 0x80c6, 
-    /* 0x0000abe0: */ 0x80c5, 0x80c4, 0x80c4, 0x80c3, 0x80c2, 0x80c1, 0x80c1, 0x80c0, 0x80bf, 0x80be, 0x80be, 0x80bd, 0x80bc, 0x80bc, 0x80bb, 0x80ba, 
-    /* 0x0000ac00: */ 0x80b9, 0x80b9, 0x80b8, 0x80b7, 0x80b6, 0x80b6, 0x80b5, 0x80b4, 0x80b4, 0x80b3, 0x80b2, 0x80b1, 0x80b1, 0x80b0, 0x80af, 0x80af, 
-    /* 0x0000ac20: */ 0x80ae, 0x80ad, 0x80ad, 0x80ac, 0x80ab, 0x80aa, 0x80aa, 0x80a9, 0x80a8, 0x80a8, 0x80a7, 0x80a6, 0x80a6, 0x80a5, 0x80a4, 0x80a4, 
-    /* 0x0000ac40: */ 0x80a3, 0x80a2, 0x80a1, 0x80a1, 0x80a0, 0x809f, 0x809f, 0x809e, 0x809d, 0x809d, 0x809c, 0x809b, 0x809b, 0x809a, 0x8099, 0x8099, 
-    /* 0x0000ac60: */ 0x8098, 0x8098, 0x8097, 0x8096, 0x8096, 0x8095, 0x8094, 0x8094, 0x8093, 0x8092, 0x8092, 0x8091, 0x8090, 0x8090, 0x808f, 0x808e, 
-    /* 0x0000ac80: */ 0x808e, 0x808d, 0x808d, 0x808c, 0x808b, 0x808b, 0x808a, 0x8089, 0x8089, 0x8088, 0x8088, 0x8087, 0x8086, 0x8086, 0x8085, 0x8084, 
-    /* 0x0000aca0: */ 0x8084, 0x8083, 0x8083, 0x8082, 0x8081, 0x8081, 0x8080, 0x8080, 0x807f, 0x807e, 0x807e, 0x807d, 0x807d, 0x807c, 0x807b, 0x807b, 
-    /* 0x0000acc0: */ 0x807a, 0x807a, 0x8079, 0x8079, 0x8078, 0x8077, 0x8077, 0x8076, 0x8076, 0x8075, 0x8074, 0x8074, 0x8073, 0x8073, 0x8072, 0x8072, 
-    /* 0x0000ace0: */ 0x8071, 0x8070, 0x8070, 0x806f, 0x806f, 0x806e, 0x806e, 0x806d, 0x806d, 0x806c, 0x806b, 0x806b, 0x806a, 0x806a, 0x8069, 0x8069, 
-    /* 0x0000ad00: */ 0x8068, 0x8068, 0x8067, 0x8067, 0x8066, 0x8066, 0x8065, 0x8064, 0x8064, 0x8063, 0x8063, 0x8062, 0x8062, 0x8061, 0x8061, 0x8060, 
-    /* 0x0000ad20: */ 0x8060, 0x805f, 0x805f, 0x805e, 0x805e, 0x805d, 0x805d, 0x805c, 0x805c, 0x805b, 0x805b, 0x805a, 0x805a, 0x8059, 0x8059, 0x8058, 
-    /* 0x0000ad40: */ 0x8058, 0x8057, 0x8057, 0x8056, 0x8056, 0x8055, 0x8055, 0x8054, 0x8054, 0x8053, 0x8053, 0x8052, 0x8052, 0x8051, 0x8051, 0x8050, 
-    /* 0x0000ad60: */ 0x8050, 0x804f, 0x804f, 0x804e, 0x804e, 0x804d, 0x804d, 0x804d, 0x804c, 0x804c, 0x804b, 0x804b, 0x804a, 0x804a, 0x8049, 0x8049, 
-    /* 0x0000ad80: */ 0x8048, 0x8048, 0x8048, 0x8047, 0x8047, 0x8046, 0x8046, 0x8045, 0x8045, 0x8044, 0x8044, 0x8044, 0x8043, 0x8043, 0x8042, 0x8042, 
-    /* 0x0000ada0: */ 0x8041, 0x8041, 0x8041, 0x8040, 0x8040, 0x803f, 0x803f, 0x803e, 0x803e, 0x803e, 0x803d, 0x803d, 0x803c, 0x803c, 0x803c, 0x803b, 
-    /* 0x0000adc0: */ 0x803b, 0x803a, 0x803a, 0x803a, 0x8039, 0x8039, 0x8038, 0x8038, 0x8038, 0x8037, 0x8037, 0x8036, 0x8036, 0x8036, 0x8035, 0x8035, 
-    /* 0x0000ade0: */ 0x8034, 0x8034, 0x8034, 0x8033, 0x8033, 0x8033, 0x8032, 0x8032, 0x8031, 0x8031, 0x8031, 0x8030, 0x8030, 0x8030, 0x802f, 0x802f, 
-    /* 0x0000ae00: */ 0x802e, 0x802e, 0x802e, 0x802d, 0x802d, 0x802d, 0x802c, 0x802c, 0x802c, 0x802b, 0x802b, 0x802b, 0x802a, 0x802a, 0x802a, 0x8029, 
-    /* 0x0000ae20: */ 0x8029, 0x8029, 0x8028, 0x8028, 0x8028, 0x8027, 0x8027, 0x8027, 0x8026, 0x8026, 0x8026, 0x8025, 0x8025, 0x8025, 0x8024, 0x8024, 
-    /* 0x0000ae40: */ 0x8024, 0x8023, 0x8023, 0x8023, 0x8022, 0x8022, 0x8022, 0x8022, 0x8021, 0x8021, 0x8021, 0x8020, 0x8020, 0x8020, 0x801f, 0x801f, 
-    /* 0x0000ae60: */ 0x801f, 0x801f, 0x801e, 0x801e, 0x801e, 0x801d, 0x801d, 0x801d, 0x801d, 0x801c, 0x801c, 0x801c, 0x801c, 0x801b, 0x801b, 0x801b, 
-    /* 0x0000ae80: */ 0x801a, 0x801a, 0x801a, 0x801a, 0x8019, 0x8019, 0x8019, 0x8019, 0x8018, 0x8018, 0x8018, 0x8018, 0x8017, 0x8017, 0x8017, 0x8017, 
-    /* 0x0000aea0: */ 0x8016, 0x8016, 0x8016, 0x8016, 0x8015, 0x8015, 0x8015, 0x8015, 0x8014, 0x8014, 0x8014, 0x8014, 0x8014, 0x8013, 0x8013, 0x8013, 
-    /* 0x0000aec0: */ 0x8013, 0x8012, 0x8012, 0x8012, 0x8012, 0x8012, 0x8011, 0x8011, 0x8011, 0x8011, 0x8010, 0x8010, 0x8010, 0x8010, 0x8010, 0x800f, 
-    /* 0x0000aee0: */ 0x800f, 0x800f, 0x800f, 0x800f, 0x800e, 0x800e, 0x800e, 0x800e, 0x800e, 0x800e, 0x800d, 0x800d, 0x800d, 0x800d, 0x800d, 0x800c, 
-    /* 0x0000af00: */ 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 0x800a, 0x800a, 0x800a, 0x800a, 0x800a, 
-    /* 0x0000af20: */ 0x800a, 0x8009, 0x8009, 0x8009, 0x8009, 0x8009, 0x8009, 0x8009, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 
-    /* 0x0000af40: */ 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 
-    /* 0x0000af60: */ 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 
-    /* 0x0000af80: */ 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 
-    /* 0x0000afa0: */ 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 
-    /* 0x0000afc0: */ 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 
-    /* 0x0000afe0: */ 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 
-    /* 0x0000b000: */ 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 
-    /* 0x0000b020: */ 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 0x8002, 
-    /* 0x0000b040: */ 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 0x8003, 
-    /* 0x0000b060: */ 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8004, 0x8005, 0x8005, 0x8005, 0x8005, 
-    /* 0x0000b080: */ 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8005, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8006, 0x8007, 0x8007, 
-    /* 0x0000b0a0: */ 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8007, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8008, 0x8009, 0x8009, 
-    /* 0x0000b0c0: */ 0x8009, 0x8009, 0x8009, 0x8009, 0x8009, 0x800a, 0x800a, 0x800a, 0x800a, 0x800a, 0x800a, 0x800b, 0x800b, 0x800b, 0x800b, 0x800b, 
-    /* 0x0000b0e0: */ 0x800b, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x800c, 0x800d, 0x800d, 0x800d, 0x800d, 0x800d, 0x800e, 0x800e, 0x800e, 0x800e, 
-    /* 0x0000b100: */ 0x800e, 0x800e, 0x800f, 0x800f, 0x800f, 0x800f, 0x800f, 0x8010, 0x8010, 0x8010, 0x8010, 0x8010, 0x8011, 0x8011, 0x8011, 0x8011, 
-    /* 0x0000b120: */ 0x8012, 0x8012, 0x8012, 0x8012, 0x8012, 0x8013, 0x8013, 0x8013, 0x8013, 0x8014, 0x8014, 0x8014, 0x8014, 0x8014, 0x8015, 0x8015, 
-    /* 0x0000b140: */ 0x8015, 0x8015, 0x8016, 0x8016, 0x8016, 0x8016, 0x8017, 0x8017, 0x8017, 0x8017, 0x8018, 0x8018, 0x8018, 0x8018, 0x8019, 0x8019, 
-    /* 0x0000b160: */ 0x8019, 0x8019, 0x801a, 0x801a, 0x801a, 0x801a, 0x801b, 0x801b, 0x801b, 0x801c, 0x801c, 0x801c, 0x801c, 0x801d, 0x801d, 0x801d, 
-    /* 0x0000b180: */ 0x801d, 0x801e, 0x801e, 0x801e, 0x801f, 0x801f, 0x801f, 0x801f, 0x8020, 0x8020, 0x8020, 0x8021, 0x8021, 0x8021, 0x8022, 0x8022, 
-    /* 0x0000b1a0: */ 0x8022, 0x8022, 0x8023, 0x8023, 0x8023, 0x8024, 0x8024, 0x8024, 0x8025, 0x8025, 0x8025, 0x8026, 0x8026, 0x8026, 0x8027, 0x8027, 
-    /* 0x0000b1c0: */ 0x8027, 0x8028, 0x8028, 0x8028, 0x8029, 0x8029, 0x8029, 0x802a, 0x802a, 0x802a, 0x802b, 0x802b, 0x802b, 0x802c, 0x802c, 0x802c, 
-    /* 0x0000b1e0: */ 0x802d, 0x802d, 0x802d, 0x802e, 0x802e, 0x802e, 0x802f, 0x802f, 0x8030, 0x8030, 0x8030, 0x8031, 0x8031, 0x8031, 0x8032, 0x8032, 
-    /* 0x0000b200: */ 0x8033, 0x8033, 0x8033, 0x8034, 0x8034, 0x8034, 0x8035, 0x8035, 0x8036, 0x8036, 0x8036, 0x8037, 0x8037, 0x8038, 0x8038, 0x8038, 
-    /* 0x0000b220: */ 0x8039, 0x8039, 0x803a, 0x803a, 0x803a, 0x803b, 0x803b, 0x803c, 0x803c, 0x803c, 0x803d, 0x803d, 0x803e, 0x803e, 0x803e, 0x803f, 
-    /* 0x0000b240: */ 0x803f, 0x8040, 0x8040, 0x8041, 0x8041, 0x8041, 0x8042, 0x8042, 0x8043, 0x8043, 0x8044, 0x8044, 0x8044, 0x8045, 0x8045, 0x8046, 
-    /* 0x0000b260: */ 0x8046, 0x8047, 0x8047, 0x8048, 0x8048, 0x8048, 0x8049, 0x8049, 0x804a, 0x804a, 0x804b, 0x804b, 0x804c, 0x804c, 0x804d, 0x804d, 
-    /* 0x0000b280: */ 0x804d, 0x804e, 0x804e, 0x804f, 0x804f, 0x8050, 0x8050, 0x8051, 0x8051, 0x8052, 0x8052, 0x8053, 0x8053, 0x8054, 0x8054, 0x8055, 
-    /* 0x0000b2a0: */ 0x8055, 0x8056, 0x8056, 0x8057, 0x8057, 0x8058, 0x8058, 0x8059, 0x8059, 0x805a, 0x805a, 0x805b, 0x805b, 0x805c, 0x805c, 0x805d, 
-    /* 0x0000b2c0: */ 0x805d, 0x805e, 0x805e, 0x805f, 0x805f, 0x8060, 0x8060, 0x8061, 0x8061, 0x8062, 0x8062, 0x8063, 0x8063, 0x8064, 0x8064, 0x8065, 
-    /* 0x0000b2e0: */ 0x8066, 0x8066, 0x8067, 0x8067, 0x8068, 0x8068, 0x8069, 0x8069, 0x806a, 0x806a, 0x806b, 0x806b, 0x806c, 0x806d, 0x806d, 0x806e, 
-    /* 0x0000b300: */ 0x806e, 0x806f, 0x806f, 0x8070, 0x8070, 0x8071, 0x8072, 0x8072, 0x8073, 0x8073, 0x8074, 0x8074, 0x8075, 0x8076, 0x8076, 0x8077, 
-    /* 0x0000b320: */ 0x8077, 0x8078, 0x8079, 0x8079, 0x807a, 0x807a, 0x807b, 0x807b, 0x807c, 0x807d, 0x807d, 0x807e, 0x807e, 0x807f, 0x8080, 0x8080, 
-    /* 0x0000b340: */ 0x8081, 0x8081, 0x8082, 0x8083, 0x8083, 0x8084, 0x8084, 0x8085, 0x8086, 0x8086, 0x8087, 0x8088, 0x8088, 0x8089, 0x8089, 0x808a, 
-    /* 0x0000b360: */ 0x808b, 0x808b, 0x808c, 0x808d, 0x808d, 0x808e, 0x808e, 0x808f, 0x8090, 0x8090, 0x8091, 0x8092, 0x8092, 0x8093, 0x8094, 0x8094, 
-    /* 0x0000b380: */ 0x8095, 0x8096, 0x8096, 0x8097, 0x8098, 0x8098, 0x8099, 0x8099, 0x809a, 0x809b, 0x809b, 0x809c, 0x809d, 0x809d, 0x809e, 0x809f, 
-    /* 0x0000b3a0: */ 0x809f, 0x80a0, 0x80a1, 0x80a1, 0x80a2, 0x80a3, 0x80a4, 0x80a4, 0x80a5, 0x80a6, 0x80a6, 0x80a7, 0x80a8, 0x80a8, 0x80a9, 0x80aa, 
-    /* 0x0000b3c0: */ 0x80aa, 0x80ab, 0x80ac, 0x80ad, 0x80ad, 0x80ae, 0x80af, 0x80af, 0x80b0, 0x80b1, 0x80b1, 0x80b2, 0x80b3, 0x80b4, 0x80b4, 0x80b5, 
-    /* 0x0000b3e0: */ 0x80b6, 0x80b6, 0x80b7, 0x80b8, 0x80b9, 0x80b9, 0x80ba, 0x80bb, 0x80bc, 0x80bc, 0x80bd, 0x80be, 0x80be, 0x80bf, 0x80c0, 0x80c1, 
-    /* 0x0000b400: */ 0x80c1, 0x80c2, 0x80c3, 0x80c4, 0x80c4, 0x80c5, 0x80c6, 0x80c7, 0x80c7, 0x80c8, 0x80c9, 0x80ca, 0x80ca, 0x80cb, 0x80cc, 0x80cd, 
-    /* 0x0000b420: */ 0x80cd, 0x80ce, 0x80cf, 0x80d0, 0x80d0, 0x80d1, 0x80d2, 0x80d3, 0x80d4, 0x80d4, 0x80d5, 0x80d6, 0x80d7, 0x80d7, 0x80d8, 0x80d9, 
-    /* 0x0000b440: */ 0x80da, 0x80db, 0x80db, 0x80dc, 0x80dd, 0x80de, 0x80df, 0x80df, 0x80e0, 0x80e1, 0x80e2, 0x80e3, 0x80e3, 0x80e4, 0x80e5, 0x80e6, 
-    /* 0x0000b460: */ 0x80e7, 0x80e7, 0x80e8, 0x80e9, 0x80ea, 0x80eb, 0x80eb, 0x80ec, 0x80ed, 0x80ee, 0x80ef, 0x80f0, 0x80f0, 0x80f1, 0x80f2, 0x80f3, 
-    /* 0x0000b480: */ 0x80f4, 0x80f5, 0x80f5, 0x80f6, 0x80f7, 0x80f8, 0x80f9, 0x80fa, 0x80fa, 0x80fb, 0x80fc, 0x80fd, 0x80fe, 0x80ff, 0x8100, 0x8100, 
-    /* 0x0000b4a0: */ 0x8101, 0x8102, 0x8103, 0x8104, 0x8105, 0x8106, 0x8106, 0x8107, 0x8108, 0x8109, 0x810a, 0x810b, 0x810c, 0x810c, 0x810d, 0x810e, 
-    /* 0x0000b4c0: */ 0x810f, 0x8110, 0x8111, 0x8112, 0x8113, 0x8113, 0x8114, 0x8115, 0x8116, 0x8117, 0x8118, 0x8119, 0x811a, 0x811b, 0x811c, 0x811c, 
-    /* 0x0000b4e0: */ 0x811d, 0x811e, 0x811f, 0x8120, 0x8121, 0x8122, 0x8123, 0x8124, 0x8125, 0x8125, 0x8126, 0x8127, 0x8128, 0x8129, 0x812a, 0x812b, 
-    /* 0x0000b500: */ 0x812c, 0x812d, 0x812e, 0x812f, 0x8130, 0x8131, 0x8131, 0x8132, 0x8133, 0x8134, 0x8135, 0x8136, 0x8137, 0x8138, 0x8139, 0x813a, 
-    /* 0x0000b520: */ 0x813b, 0x813c, 0x813d, 0x813e, 0x813f, 0x8140, 0x8141, 0x8142, 0x8142, 0x8143, 0x8144, 0x8145, 0x8146, 0x8147, 0x8148, 0x8149, 
-    /* 0x0000b540: */ 0x814a, 0x814b, 0x814c, 0x814d, 0x814e, 0x814f, 0x8150, 0x8151, 0x8152, 0x8153, 0x8154, 0x8155, 0x8156, 0x8157, 0x8158, 0x8159, 
-    /* 0x0000b560: */ 0x815a, 0x815b, 0x815c, 0x815d, 0x815e, 0x815f, 0x8160, 0x8161, 0x8162, 0x8163, 0x8164, 0x8165, 0x8166, 0x8167, 0x8168, 0x8169, 
-    /* 0x0000b580: */ 0x816a, 0x816b, 0x816c, 0x816d, 0x816e, 0x816f, 0x8170, 0x8171, 0x8172, 0x8173, 0x8174, 0x8175, 0x8176, 0x8177, 0x8178, 0x8179, 
-    /* 0x0000b5a0: */ 0x817a, 0x817b, 0x817c, 0x817d, 0x817e, 0x817f, 0x8181, 0x8182, 0x8183, 0x8184, 0x8185, 0x8186, 0x8187, 0x8188, 0x8189, 0x818a, 
-    /* 0x0000b5c0: */ 0x818b, 0x818c, 0x818d, 0x818e, 0x818f, 0x8190, 0x8191, 0x8193, 0x8194, 0x8195, 0x8196, 0x8197, 0x8198, 0x8199, 0x819a, 0x819b, 
-    /* 0x0000b5e0: */ 0x819c, 0x819d, 0x819e, 0x819f, 0x81a1, 0x81a2, 0x81a3, 0x81a4, 0x81a5, 0x81a6, 0x81a7, 0x81a8, 0x81a9, 0x81aa, 0x81ab, 0x81ad, 
-    /* 0x0000b600: */ 0x81ae, 0x81af, 0x81b0, 0x81b1, 0x81b2, 0x81b3, 0x81b4, 0x81b5, 0x81b7, 0x81b8, 0x81b9, 0x81ba, 0x81bb, 0x81bc, 0x81bd, 0x81be, 
-    /* 0x0000b620: */ 0x81c0, 0x81c1, 0x81c2, 0x81c3, 0x81c4, 0x81c5, 0x81c6, 0x81c7, 0x81c9, 0x81ca, 0x81cb, 0x81cc, 0x81cd, 0x81ce, 0x81cf, 0x81d1, 
-    /* 0x0000b640: */ 0x81d2, 0x81d3, 0x81d4, 0x81d5, 0x81d6, 0x81d8, 0x81d9, 0x81da, 0x81db, 0x81dc, 0x81dd, 0x81de, 0x81e0, 0x81e1, 0x81e2, 0x81e3, 
-    /* 0x0000b660: */ 0x81e4, 0x81e6, 0x81e7, 0x81e8, 0x81e9, 0x81ea, 0x81eb, 0x81ed, 0x81ee, 0x81ef, 0x81f0, 0x81f1, 0x81f3, 0x81f4, 0x81f5, 0x81f6, 
-    /* 0x0000b680: */ 0x81f7, 0x81f8, 0x81fa, 0x81fb, 0x81fc, 0x81fd, 0x81fe, 0x8200, 0x8201, 0x8202, 0x8203, 0x8205, 0x8206, 0x8207, 0x8208, 0x8209, 
-    /* 0x0000b6a0: */ 0x820b, 0x820c, 0x820d, 0x820e, 0x820f, 0x8211, 0x8212, 0x8213, 0x8214, 0x8216, 0x8217, 0x8218, 0x8219, 0x821b, 0x821c, 0x821d, 
-    /* 0x0000b6c0: */ 0x821e, 0x821f, 0x8221, 0x8222, 0x8223, 0x8224, 0x8226, 0x8227, 0x8228, 0x8229, 0x822b, 0x822c, 0x822d, 0x822e, 0x8230, 0x8231, 
-    /* 0x0000b6e0: */ 0x8232, 0x8234, 0x8235, 0x8236, 0x8237, 0x8239, 0x823a, 0x823b, 0x823c, 0x823e, 0x823f, 0x8240, 0x8242, 0x8243, 0x8244, 0x8245, 
-    /* 0x0000b700: */ 0x8247, 0x8248, 0x8249, 0x824b, 0x824c, 0x824d, 0x824e, 0x8250, 0x8251, 0x8252, 0x8254, 0x8255, 0x8256, 0x8257, 0x8259, 0x825a, 
-    /* 0x0000b720: */ 0x825b, 0x825d, 0x825e, 0x825f, 0x8261, 0x8262, 0x8263, 0x8265, 0x8266, 0x8267, 0x8269, 0x826a, 0x826b, 0x826d, 0x826e, 0x826f, 
-    /* 0x0000b740: */ 0x8271, 0x8272, 0x8273, 0x8275, 0x8276, 0x8277, 0x8279, 0x827a, 0x827b, 0x827d, 0x827e, 0x827f, 0x8281, 0x8282, 0x8283, 0x8285, 
-    /* 0x0000b760: */ 0x8286, 0x8287, 0x8289, 0x828a, 0x828b, 0x828d, 0x828e, 0x828f, 0x8291, 0x8292, 0x8294, 0x8295, 0x8296, 0x8298, 0x8299, 0x829a, 
-    /* 0x0000b780: */ 0x829c, 0x829d, 0x829f, 0x82a0, 0x82a1, 0x82a3, 0x82a4, 0x82a5, 0x82a7, 0x82a8, 0x82aa, 0x82ab, 0x82ac, 0x82ae, 0x82af, 0x82b1, 
-    /* 0x0000b7a0: */ 0x82b2, 0x82b3, 0x82b5, 0x82b6, 0x82b8, 0x82b9, 0x82ba, 0x82bc, 0x82bd, 0x82bf, 0x82c0, 0x82c1, 0x82c3, 0x82c4, 0x82c6, 0x82c7, 
-    /* 0x0000b7c0: */ 0x82c9, 0x82ca, 0x82cb, 0x82cd, 0x82ce, 0x82d0, 0x82d1, 0x82d3, 0x82d4, 0x82d5, 0x82d7, 0x82d8, 0x82da, 0x82db, 0x82dd, 0x82de, 
-    /* 0x0000b7e0: */ 0x82df, 0x82e1, 0x82e2, 0x82e4, 0x82e5, 0x82e7, 0x82e8, 0x82ea, 0x82eb, 0x82ed, 0x82ee, 0x82ef, 0x82f1, 0x82f2, 0x82f4, 0x82f5, 
-    /* 0x0000b800: */ 0x82f7, 0x82f8, 0x82fa, 0x82fb, 0x82fd, 0x82fe, 0x8300, 0x8301, 0x8302, 0x8304, 0x8305, 0x8307, 0x8308, 0x830a, 0x830b, 0x830d, 
-    /* 0x0000b820: */ 0x830e, 0x8310, 0x8311, 0x8313, 0x8314, 0x8316, 0x8317, 0x8319, 0x831a, 0x831c, 0x831d, 0x831f, 0x8320, 0x8322, 0x8323, 0x8325, 
-    /* 0x0000b840: */ 0x8326, 0x8328, 0x8329, 0x832b, 0x832c, 0x832e, 0x832f, 0x8331, 0x8332, 0x8334, 0x8336, 0x8337, 0x8339, 0x833a, 0x833c, 0x833d, 
-    /* 0x0000b860: */ 0x833f, 0x8340, 0x8342, 0x8343, 0x8345, 0x8346, 0x8348, 0x8349, 0x834b, 0x834d, 0x834e, 0x8350, 0x8351, 0x8353, 0x8354, 0x8356, 
-    /* 0x0000b880: */ 0x8357, 0x8359, 0x835a, 0x835c, 0x835e, 0x835f, 0x8361, 0x8362, 0x8364, 0x8365, 0x8367, 0x8369, 0x836a, 0x836c, 0x836d, 0x836f, 
-    /* 0x0000b8a0: */ 0x8370, 0x8372, 0x8374, 0x8375, 0x8377, 0x8378, 0x837a, 0x837c, 0x837d, 0x837f, 0x8380, 0x8382, 0x8383, 0x8385, 0x8387, 0x8388, 
-    /* 0x0000b8c0: */ 0x838a, 0x838b, 0x838d, 0x838f, 0x8390, 0x8392, 0x8393, 0x8395, 0x8397, 0x8398, 0x839a, 0x839c, 0x839d, 0x839f, 0x83a0, 0x83a2, 
-    /* 0x0000b8e0: */ 0x83a4, 0x83a5, 0x83a7, 0x83a8, 0x83aa, 0x83ac, 0x83ad, 0x83af, 0x83b1, 0x83b2, 0x83b4, 0x83b6, 0x83b7, 0x83b9, 0x83ba, 0x83bc, 
-    /* 0x0000b900: */ 0x83be, 0x83bf, 0x83c1, 0x83c3, 0x83c4, 0x83c6, 0x83c8, 0x83c9, 0x83cb, 0x83cd, 0x83ce, 0x83d0, 0x83d2, 0x83d3, 0x83d5, 0x83d7, 
-    /* 0x0000b920: */ 0x83d8, 0x83da, 0x83dc, 0x83dd, 0x83df, 0x83e1, 0x83e2, 0x83e4, 0x83e6, 0x83e7, 0x83e9, 0x83eb, 0x83ec, 0x83ee, 0x83f0, 0x83f1, 
-    /* 0x0000b940: */ 0x83f3, 0x83f5, 0x83f6, 0x83f8, 0x83fa, 0x83fc, 0x83fd, 0x83ff, 0x8401, 0x8402, 0x8404, 0x8406, 0x8407, 0x8409, 0x840b, 0x840d, 
-    /* 0x0000b960: */ 0x840e, 0x8410, 0x8412, 0x8413, 0x8415, 0x8417, 0x8419, 0x841a, 0x841c, 0x841e, 0x841f, 0x8421, 0x8423, 0x8425, 0x8426, 0x8428, 
-    /* 0x0000b980: */ 0x842a, 0x842c, 0x842d, 0x842f, 0x8431, 0x8433, 0x8434, 0x8436, 0x8438, 0x8439, 0x843b, 0x843d, 0x843f, 0x8440, 0x8442, 0x8444, 
-    /* 0x0000b9a0: */ 0x8446, 0x8447, 0x8449, 0x844b, 0x844d, 0x844f, 0x8450, 0x8452, 0x8454, 0x8456, 0x8457, 0x8459, 0x845b, 0x845d, 0x845e, 0x8460, 
-    /* 0x0000b9c0: */ 0x8462, 0x8464, 0x8466, 0x8467, 0x8469, 0x846b, 0x846d, 0x846e, 0x8470, 0x8472, 0x8474, 0x8476, 0x8477, 0x8479, 0x847b, 0x847d, 
-    /* 0x0000b9e0: */ 0x847f, 0x8480, 0x8482, 0x8484, 0x8486, 0x8488, 0x8489, 0x848b, 0x848d, 0x848f, 0x8491, 0x8493, 0x8494, 0x8496, 0x8498, 0x849a, 
-    /* 0x0000ba00: */ 0x849c, 0x849d, 0x849f, 0x84a1, 0x84a3, 0x84a5, 0x84a7, 0x84a8, 0x84aa, 0x84ac, 0x84ae, 0x84b0, 0x84b2, 0x84b3, 0x84b5, 0x84b7, 
-    /* 0x0000ba20: */ 0x84b9, 0x84bb, 0x84bd, 0x84be, 0x84c0, 0x84c2, 0x84c4, 0x84c6, 0x84c8, 0x84ca, 0x84cb, 0x84cd, 0x84cf, 0x84d1, 0x84d3, 0x84d5, 
-    /* 0x0000ba40: */ 0x84d7, 0x84d8, 0x84da, 0x84dc, 0x84de, 0x84e0, 0x84e2, 0x84e4, 0x84e6, 0x84e7, 0x84e9, 0x84eb, 0x84ed, 0x84ef, 0x84f1, 0x84f3, 
-    /* 0x0000ba60: */ 0x84f5, 0x84f7, 0x84f8, 0x84fa, 0x84fc, 0x84fe, 0x8500, 0x8502, 0x8504, 0x8506, 0x8508, 0x8509, 0x850b, 0x850d, 0x850f, 0x8511, 
-    /* 0x0000ba80: */ 0x8513, 0x8515, 0x8517, 0x8519, 0x851b, 0x851d, 0x851f, 0x8520, 0x8522, 0x8524, 0x8526, 0x8528, 0x852a, 0x852c, 0x852e, 0x8530, 
-    /* 0x0000baa0: */ 0x8532, 0x8534, 0x8536, 0x8538, 0x8539, 0x853b, 0x853d, 0x853f, 0x8541, 0x8543, 0x8545, 0x8547, 0x8549, 0x854b, 0x854d, 0x854f, 
-    /* 0x0000bac0: */ 0x8551, 0x8553, 0x8555, 0x8557, 0x8559, 0x855b, 0x855d, 0x855f, 0x8561, 0x8562, 0x8564, 0x8566, 0x8568, 0x856a, 0x856c, 0x856e, 
-    /* 0x0000bae0: */ 0x8570, 0x8572, 0x8574, 0x8576, 0x8578, 0x857a, 0x857c, 0x857e, 0x8580, 0x8582, 0x8584, 0x8586, 0x8588, 0x858a, 0x858c, 0x858e, 
-    /* 0x0000bb00: */ 0x8590, 0x8592, 0x8594, 0x8596, 0x8598, 0x859a, 0x859c, 0x859e, 0x85a0, 0x85a2, 0x85a4, 0x85a6, 0x85a8, 0x85aa, 0x85ac, 0x85ae, 
-    /* 0x0000bb20: */ 0x85b0, 0x85b2, 0x85b4, 0x85b6, 0x85b8, 0x85ba, 0x85bc, 0x85be, 0x85c0, 0x85c2, 0x85c5, 0x85c7, 0x85c9, 0x85cb, 0x85cd, 0x85cf, 
-    /* 0x0000bb40: */ 0x85d1, 0x85d3, 0x85d5, 0x85d7, 0x85d9, 0x85db, 0x85dd, 0x85df, 0x85e1, 0x85e3, 0x85e5, 0x85e7, 0x85e9, 0x85eb, 0x85ed, 0x85f0, 
-    /* 0x0000bb60: */ 0x85f2, 0x85f4, 0x85f6, 0x85f8, 0x85fa, 0x85fc, 0x85fe, 0x8600, 0x8602, 0x8604, 0x8606, 0x8608, 0x860a, 0x860d, 0x860f, 0x8611, 
-    /* 0x0000bb80: */ 0x8613, 0x8615, 0x8617, 0x8619, 0x861b, 0x861d, 0x861f, 0x8621, 0x8624, 0x8626, 0x8628, 0x862a, 0x862c, 0x862e, 0x8630, 0x8632, 
-    /* 0x0000bba0: */ 0x8634, 0x8636, 0x8639, 0x863b, 0x863d, 0x863f, 0x8641, 0x8643, 0x8645, 0x8647, 0x8649, 0x864c, 0x864e, 0x8650, 0x8652, 0x8654, 
-    /* 0x0000bbc0: */ 0x8656, 0x8658, 0x865a, 0x865d, 0x865f, 0x8661, 0x8663, 0x8665, 0x8667, 0x8669, 0x866c, 0x866e, 0x8670, 0x8672, 0x8674, 0x8676, 
-    /* 0x0000bbe0: */ 0x8678, 0x867b, 0x867d, 0x867f, 0x8681, 0x8683, 0x8685, 0x8688, 0x868a, 0x868c, 0x868e, 0x8690, 0x8692, 0x8695, 0x8697, 0x8699, 
-    /* 0x0000bc00: */ 0x869b, 0x869d, 0x869f, 0x86a2, 0x86a4, 0x86a6, 0x86a8, 0x86aa, 0x86ac, 0x86af, 0x86b1, 0x86b3, 0x86b5, 0x86b7, 0x86ba, 0x86bc, 
-    /* 0x0000bc20: */ 0x86be, 0x86c0, 0x86c2, 0x86c5, 0x86c7, 0x86c9, 0x86cb, 0x86cd, 0x86d0, 0x86d2, 0x86d4, 0x86d6, 0x86d8, 0x86db, 0x86dd, 0x86df, 
-    /* 0x0000bc40: */ 0x86e1, 0x86e4, 0x86e6, 0x86e8, 0x86ea, 0x86ec, 0x86ef, 0x86f1, 0x86f3, 0x86f5, 0x86f8, 0x86fa, 0x86fc, 0x86fe, 0x8700, 0x8703, 
-    /* 0x0000bc60: */ 0x8705, 0x8707, 0x8709, 0x870c, 0x870e, 0x8710, 0x8712, 0x8715, 0x8717, 0x8719, 0x871b, 0x871e, 0x8720, 0x8722, 0x8724, 0x8727, 
-    /* 0x0000bc80: */ 0x8729, 0x872b, 0x872d, 0x8730, 0x8732, 0x8734, 0x8737, 0x8739, 0x873b, 0x873d, 0x8740, 0x8742, 0x8744, 0x8746, 0x8749, 0x874b, 
-    /* 0x0000bca0: */ 0x874d, 0x8750, 0x8752, 0x8754, 0x8756, 0x8759, 0x875b, 0x875d, 0x8760, 0x8762, 0x8764, 0x8766, 0x8769, 0x876b, 0x876d, 0x8770, 
-    /* 0x0000bcc0: */ 0x8772, 0x8774, 0x8777, 0x8779, 0x877b, 0x877d, 0x8780, 0x8782, 0x8784, 0x8787, 0x8789, 0x878b, 0x878e, 0x8790, 0x8792, 0x8795, 
-    /* 0x0000bce0: */ 0x8797, 0x8799, 0x879c, 0x879e, 0x87a0, 0x87a3, 0x87a5, 0x87a7, 0x87aa, 0x87ac, 0x87ae, 0x87b1, 0x87b3, 0x87b5, 0x87b8, 0x87ba, 
-    /* 0x0000bd00: */ 0x87bc, 0x87bf, 0x87c1, 0x87c3, 0x87c6, 0x87c8, 0x87ca, 0x87cd, 0x87cf, 0x87d2, 0x87d4, 0x87d6, 0x87d9, 0x87db, 0x87dd, 0x87e0, 
-    /* 0x0000bd20: */ 0x87e2, 0x87e4, 0x87e7, 0x87e9, 0x87ec, 0x87ee, 0x87f0, 0x87f3, 0x87f5, 0x87f7, 0x87fa, 0x87fc, 0x87ff, 0x8801, 0x8803, 0x8806, 
-    /* 0x0000bd40: */ 0x8808, 0x880a, 0x880d, 0x880f, 0x8812, 0x8814, 0x8816, 0x8819, 0x881b, 0x881e, 0x8820, 0x8822, 0x8825, 0x8827, 0x882a, 0x882c, 
-    /* 0x0000bd60: */ 0x882f, 0x8831, 0x8833, 0x8836, 0x8838, 0x883b, 0x883d, 0x883f, 0x8842, 0x8844, 0x8847, 0x8849, 0x884c, 0x884e, 0x8850, 0x8853, 
-    /* 0x0000bd80: */ 0x8855, 0x8858, 0x885a, 0x885d, 0x885f, 0x8861, 0x8864, 0x8866, 0x8869, 0x886b, 0x886e, 0x8870, 0x8873, 0x8875, 0x8877, 0x887a, 
-    /* 0x0000bda0: */ 0x887c, 0x887f, 0x8881, 0x8884, 0x8886, 0x8889, 0x888b, 0x888e, 0x8890, 0x8892, 0x8895, 0x8897, 0x889a, 0x889c, 0x889f, 0x88a1, 
-    /* 0x0000bdc0: */ 0x88a4, 0x88a6, 0x88a9, 0x88ab, 0x88ae, 0x88b0, 0x88b3, 0x88b5, 0x88b8, 0x88ba, 0x88bd, 0x88bf, 0x88c2, 0x88c4, 0x88c7, 0x88c9, 
-    /* 0x0000bde0: */ 0x88cc, 0x88ce, 0x88d1, 0x88d3, 0x88d6, 0x88d8, 0x88db, 0x88dd, 0x88e0, 0x88e2, 0x88e5, 0x88e7, 0x88ea, 0x88ec, 0x88ef, 0x88f1, 
-    /* 0x0000be00: */ 0x88f4, 0x88f6, 0x88f9, 0x88fb, 0x88fe, 0x8900, 0x8903, 0x8905, 0x8908, 0x890a, 0x890d, 0x890f, 0x8912, 0x8915, 0x8917, 0x891a, 
-    /* 0x0000be20: */ 0x891c, 0x891f, 0x8921, 0x8924, 0x8926, 0x8929, 0x892b, 0x892e, 0x8930, 0x8933, 0x8936, 0x8938, 0x893b, 0x893d, 0x8940, 0x8942, 
-    /* 0x0000be40: */ 0x8945, 0x8947, 0x894a, 0x894d, 0x894f, 0x8952, 0x8954, 0x8957, 0x8959, 0x895c, 0x895f, 0x8961, 0x8964, 0x8966, 0x8969, 0x896b, 
-    /* 0x0000be60: */ 0x896e, 0x8971, 0x8973, 0x8976, 0x8978, 0x897b, 0x897e, 0x8980, 0x8983, 0x8985, 0x8988, 0x898b, 0x898d, 0x8990, 0x8992, 0x8995, 
-    /* 0x0000be80: */ 0x8998, 0x899a, 0x899d, 0x899f, 0x89a2, 0x89a5, 0x89a7, 0x89aa, 0x89ac, 0x89af, 0x89b2, 0x89b4, 0x89b7, 0x89ba, 0x89bc, 0x89bf, 
-    /* 0x0000bea0: */ 0x89c1, 0x89c4, 0x89c7, 0x89c9, 0x89cc, 0x89cf, 0x89d1, 0x89d4, 0x89d6, 0x89d9, 0x89dc, 0x89de, 0x89e1, 0x89e4, 0x89e6, 0x89e9, 
-    /* 0x0000bec0: */ 0x89ec, 0x89ee, 0x89f1, 0x89f3, 0x89f6, 0x89f9, 0x89fb, 0x89fe, 0x8a01, 0x8a03, 0x8a06, 0x8a09, 0x8a0b, 0x8a0e, 0x8a11, 0x8a13, 
-    /* 0x0000bee0: */ 0x8a16, 0x8a19, 0x8a1b, 0x8a1e, 0x8a21, 0x8a23, 0x8a26, 0x8a29, 0x8a2b, 0x8a2e, 0x8a31, 0x8a33, 0x8a36, 0x8a39, 0x8a3c, 0x8a3e, 
-    /* 0x0000bf00: */ 0x8a41, 0x8a44, 0x8a46, 0x8a49, 0x8a4c, 0x8a4e, 0x8a51, 0x8a54, 0x8a56, 0x8a59, 0x8a5c, 0x8a5f, 0x8a61, 0x8a64, 0x8a67, 0x8a69, 
-    /* 0x0000bf20: */ 0x8a6c, 0x8a6f, 0x8a71, 0x8a74, 0x8a77, 0x8a7a, 0x8a7c, 0x8a7f, 0x8a82, 0x8a84, 0x8a87, 0x8a8a, 0x8a8d, 0x8a8f, 0x8a92, 0x8a95, 
-    /* 0x0000bf40: */ 0x8a98, 0x8a9a, 0x8a9d, 0x8aa0, 0x8aa2, 0x8aa5, 0x8aa8, 0x8aab, 0x8aad, 0x8ab0, 0x8ab3, 0x8ab6, 0x8ab8, 0x8abb, 0x8abe, 0x8ac1, 
-    /* 0x0000bf60: */ 0x8ac3, 0x8ac6, 0x8ac9, 0x8acc, 0x8ace, 0x8ad1, 0x8ad4, 0x8ad7, 0x8ad9, 0x8adc, 0x8adf, 0x8ae2, 0x8ae5, 0x8ae7, 0x8aea, 0x8aed, 
-    /* 0x0000bf80: */ 0x8af0, 0x8af2, 0x8af5, 0x8af8, 0x8afb, 0x8afd, 0x8b00, 0x8b03, 0x8b06, 0x8b09, 0x8b0b, 0x8b0e, 0x8b11, 0x8b14, 0x8b17, 0x8b19, 
-    /* 0x0000bfa0: */ 0x8b1c, 0x8b1f, 0x8b22, 0x8b25, 0x8b27, 0x8b2a, 0x8b2d, 0x8b30, 0x8b33, 0x8b35, 0x8b38, 0x8b3b, 0x8b3e, 0x8b41, 0x8b43, 0x8b46, 
-    /* 0x0000bfc0: */ 0x8b49, 0x8b4c, 0x8b4f, 0x8b51, 0x8b54, 0x8b57, 0x8b5a, 0x8b5d, 0x8b60, 0x8b62, 0x8b65, 0x8b68, 0x8b6b, 0x8b6e, 0x8b71, 0x8b73, 
-    /* 0x0000bfe0: */ 0x8b76, 0x8b79, 0x8b7c, 0x8b7f, 0x8b82, 0x8b84, 0x8b87, 0x8b8a, 0x8b8d, 0x8b90, 0x8b93, 0x8b95, 0x8b98, 0x8b9b, 0x8b9e, 0x8ba1, 
-    /* 0x0000c000: */ 0x8ba4, 0x8ba7, 0x8ba9, 0x8bac, 0x8baf, 0x8bb2, 0x8bb5, 0x8bb8, 0x8bbb, 0x8bbd, 0x8bc0, 0x8bc3, 0x8bc6, 0x8bc9, 0x8bcc, 0x8bcf, 
-    /* 0x0000c020: */ 0x8bd2, 0x8bd4, 0x8bd7, 0x8bda, 0x8bdd, 0x8be0, 0x8be3, 0x8be6, 0x8be9, 0x8bec, 0x8bee, 0x8bf1, 0x8bf4, 0x8bf7, 0x8bfa, 0x8bfd, 
-    /* 0x0000c040: */ 0x8c00, 0x8c03, 0x8c06, 0x8c08, 0x8c0b, 0x8c0e, 0x8c11, 0x8c14, 0x8c17, 0x8c1a, 0x8c1d, 0x8c20, 0x8c23, 0x8c26, 0x8c28, 0x8c2b, 
-    /* 0x0000c060: */ 0x8c2e, 0x8c31, 0x8c34, 0x8c37, 0x8c3a, 0x8c3d, 0x8c40, 0x8c43, 0x8c46, 0x8c49, 0x8c4c, 0x8c4e, 0x8c51, 0x8c54, 0x8c57, 0x8c5a, 
-    /* 0x0000c080: */ 0x8c5d, 0x8c60, 0x8c63, 0x8c66, 0x8c69, 0x8c6c, 0x8c6f, 0x8c72, 0x8c75, 0x8c78, 0x8c7b, 0x8c7e, 0x8c81, 0x8c83, 0x8c86, 0x8c89, 
-    /* 0x0000c0a0: */ 0x8c8c, 0x8c8f, 0x8c92, 0x8c95, 0x8c98, 0x8c9b, 0x8c9e, 0x8ca1, 0x8ca4, 0x8ca7, 0x8caa, 0x8cad, 0x8cb0, 0x8cb3, 0x8cb6, 0x8cb9, 
-    /* 0x0000c0c0: */ 0x8cbc, 0x8cbf, 0x8cc2, 0x8cc5, 0x8cc8, 0x8ccb, 0x8cce, 0x8cd1, 0x8cd4, 0x8cd7, 0x8cda, 0x8cdd, 0x8ce0, 0x8ce3, 0x8ce6, 0x8ce9, 
-    /* 0x0000c0e0: */ 0x8cec, 0x8cef, 0x8cf2, 0x8cf5, 0x8cf8, 0x8cfb, 0x8cfe, 0x8d01, 0x8d04, 0x8d07, 0x8d0a, 0x8d0d, 0x8d10, 0x8d13, 0x8d16, 0x8d19, 
-    /* 0x0000c100: */ 0x8d1c, 0x8d1f, 0x8d22, 0x8d25, 0x8d28, 0x8d2b, 0x8d2e, 0x8d31, 0x8d34, 0x8d37, 0x8d3a, 0x8d3d, 0x8d40, 0x8d43, 0x8d46, 0x8d49, 
-    /* 0x0000c120: */ 0x8d4c, 0x8d4f, 0x8d52, 0x8d56, 0x8d59, 0x8d5c, 0x8d5f, 0x8d62, 0x8d65, 0x8d68, 0x8d6b, 0x8d6e, 0x8d71, 0x8d74, 0x8d77, 0x8d7a, 
-    /* 0x0000c140: */ 0x8d7d, 0x8d80, 0x8d83, 0x8d86, 0x8d8a, 0x8d8d, 0x8d90, 0x8d93, 0x8d96, 0x8d99, 0x8d9c, 0x8d9f, 0x8da2, 0x8da5, 0x8da8, 0x8dab, 
-    /* 0x0000c160: */ 0x8dae, 0x8db1, 0x8db5, 0x8db8, 0x8dbb, 0x8dbe, 0x8dc1, 0x8dc4, 0x8dc7, 0x8dca, 0x8dcd, 0x8dd0, 0x8dd4, 0x8dd7, 0x8dda, 0x8ddd, 
-    /* 0x0000c180: */ 0x8de0, 0x8de3, 0x8de6, 0x8de9, 0x8dec, 0x8def, 0x8df3, 0x8df6, 0x8df9, 0x8dfc, 0x8dff, 0x8e02, 0x8e05, 0x8e08, 0x8e0b, 0x8e0f, 
-    /* 0x0000c1a0: */ 0x8e12, 0x8e15, 0x8e18, 0x8e1b, 0x8e1e, 0x8e21, 0x8e25, 0x8e28, 0x8e2b, 0x8e2e, 0x8e31, 0x8e34, 0x8e37, 0x8e3a, 0x8e3e, 0x8e41, 
-    /* 0x0000c1c0: */ 0x8e44, 0x8e47, 0x8e4a, 0x8e4d, 0x8e50, 0x8e54, 0x8e57, 0x8e5a, 0x8e5d, 0x8e60, 0x8e63, 0x8e67, 0x8e6a, 0x8e6d, 0x8e70, 0x8e73, 
-    /* 0x0000c1e0: */ 0x8e76, 0x8e7a, 0x8e7d, 0x8e80, 0x8e83, 0x8e86, 0x8e89, 0x8e8d, 0x8e90, 0x8e93, 0x8e96, 0x8e99, 0x8e9c, 0x8ea0, 0x8ea3, 0x8ea6, 
-    /* 0x0000c200: */ 0x8ea9, 0x8eac, 0x8eb0, 0x8eb3, 0x8eb6, 0x8eb9, 0x8ebc, 0x8ebf, 0x8ec3, 0x8ec6, 0x8ec9, 0x8ecc, 0x8ecf, 0x8ed3, 0x8ed6, 0x8ed9, 
-    /* 0x0000c220: */ 0x8edc, 0x8ee0, 0x8ee3, 0x8ee6, 0x8ee9, 0x8eec, 0x8ef0, 0x8ef3, 0x8ef6, 0x8ef9, 0x8efc, 0x8f00, 0x8f03, 0x8f06, 0x8f09, 0x8f0d, 
-    /* 0x0000c240: */ 0x8f10, 0x8f13, 0x8f16, 0x8f19, 0x8f1d, 0x8f20, 0x8f23, 0x8f26, 0x8f2a, 0x8f2d, 0x8f30, 0x8f33, 0x8f37, 0x8f3a, 0x8f3d, 0x8f40, 
-    /* 0x0000c260: */ 0x8f44, 0x8f47, 0x8f4a, 0x8f4d, 0x8f51, 0x8f54, 0x8f57, 0x8f5a, 0x8f5e, 0x8f61, 0x8f64, 0x8f67, 0x8f6b, 0x8f6e, 0x8f71, 0x8f74, 
-    /* 0x0000c280: */ 0x8f78, 0x8f7b, 0x8f7e, 0x8f81, 0x8f85, 0x8f88, 0x8f8b, 0x8f8f, 0x8f92, 0x8f95, 0x8f98, 0x8f9c, 0x8f9f, 0x8fa2, 0x8fa5, 0x8fa9, 
-    /* 0x0000c2a0: */ 0x8fac, 0x8faf, 0x8fb3, 0x8fb6, 0x8fb9, 0x8fbd, 0x8fc0, 0x8fc3, 0x8fc6, 0x8fca, 0x8fcd, 0x8fd0, 0x8fd4, 0x8fd7, 0x8fda, 0x8fdd, 
-    /* 0x0000c2c0: */ 0x8fe1, 0x8fe4, 0x8fe7, 0x8feb, 0x8fee, 0x8ff1, 0x8ff5, 0x8ff8, 0x8ffb, 0x8fff, 0x9002, 0x9005, 0x9009, 0x900c, 0x900f, 0x9013, 
-    /* 0x0000c2e0: */ 0x9016, 0x9019, 0x901d, 0x9020, 0x9023, 0x9027, 0x902a, 0x902d, 0x9031, 0x9034, 0x9037, 0x903b, 0x903e, 0x9041, 0x9045, 0x9048, 
-    /* 0x0000c300: */ 0x904b, 0x904f, 0x9052, 0x9055, 0x9059, 0x905c, 0x905f, 0x9063, 0x9066, 0x9069, 0x906d, 0x9070, 0x9074, 0x9077, 0x907a, 0x907e, 
-    /* 0x0000c320: */ 0x9081, 0x9084, 0x9088, 0x908b, 0x908e, 0x9092, 0x9095, 0x9099, 0x909c, 0x909f, 0x90a3, 0x90a6, 0x90a9, 0x90ad, 0x90b0, 0x90b4, 
-    /* 0x0000c340: */ 0x90b7, 0x90ba, 0x90be, 0x90c1, 0x90c5, 0x90c8, 0x90cb, 0x90cf, 0x90d2, 0x90d6, 0x90d9, 0x90dc, 0x90e0, 0x90e3, 0x90e7, 0x90ea, 
-    /* 0x0000c360: */ 0x90ed, 0x90f1, 0x90f4, 0x90f8, 0x90fb, 0x90fe, 0x9102, 0x9105, 0x9109, 0x910c, 0x910f, 0x9113, 0x9116, 0x911a, 0x911d, 0x9121, 
-    /* 0x0000c380: */ 0x9124, 0x9127, 0x912b, 0x912e, 0x9132, 0x9135, 0x9139, 0x913c, 0x913f, 0x9143, 0x9146, 0x914a, 0x914d, 0x9151, 0x9154, 0x9158, 
-    /* 0x0000c3a0: */ 0x915b, 0x915e, 0x9162, 0x9165, 0x9169, 0x916c, 0x9170, 0x9173, 0x9177, 0x917a, 0x917e, 0x9181, 0x9184, 0x9188, 0x918b, 0x918f, 
-    /* 0x0000c3c0: */ 0x9192, 0x9196, 0x9199, 0x919d, 0x91a0, 0x91a4, 0x91a7, 0x91ab, 0x91ae, 0x91b2, 0x91b5, 0x91b9, 0x91bc, 0x91bf, 0x91c3, 0x91c6, 
-    /* 0x0000c3e0: */ 0x91ca, 0x91cd, 0x91d1, 0x91d4, 0x91d8, 0x91db, 0x91df, 0x91e2, 0x91e6, 0x91e9, 0x91ed, 0x91f0, 0x91f4, 0x91f7, 0x91fb, 0x91fe, 
-    /* 0x0000c400: */ 0x9202, 0x9205, 0x9209, 0x920c, 0x9210, 0x9213, 0x9217, 0x921a, 0x921e, 0x9221, 0x9225, 0x9229, 0x922c, 0x9230, 0x9233, 0x9237, 
-    /* 0x0000c420: */ 0x923a, 0x923e, 0x9241, 0x9245, 0x9248, 0x924c, 0x924f, 0x9253, 0x9256, 0x925a, 0x925d, 0x9261, 0x9265, 0x9268, 0x926c, 0x926f, 
-    /* 0x0000c440: */ 0x9273, 0x9276, 0x927a, 0x927d, 0x9281, 0x9284, 0x9288, 0x928c, 0x928f, 0x9293, 0x9296, 0x929a, 0x929d, 0x92a1, 0x92a4, 0x92a8, 
-    /* 0x0000c460: */ 0x92ac, 0x92af, 0x92b3, 0x92b6, 0x92ba, 0x92bd, 0x92c1, 0x92c5, 0x92c8, 0x92cc, 0x92cf, 0x92d3, 0x92d6, 0x92da, 0x92de, 0x92e1, 
-    /* 0x0000c480: */ 0x92e5, 0x92e8, 0x92ec, 0x92f0, 0x92f3, 0x92f7, 0x92fa, 0x92fe, 0x9301, 0x9305, 0x9309, 0x930c, 0x9310, 0x9313, 0x9317, 0x931b, 
-    /* 0x0000c4a0: */ 0x931e, 0x9322, 0x9325, 0x9329, 0x932d, 0x9330, 0x9334, 0x9338, 0x933b, 0x933f, 0x9342, 0x9346, 0x934a, 0x934d, 0x9351, 0x9354, 
-    /* 0x0000c4c0: */ 0x9358, 0x935c, 0x935f, 0x9363, 0x9367, 0x936a, 0x936e, 0x9371, 0x9375, 0x9379, 0x937c, 0x9380, 0x9384, 0x9387, 0x938b, 0x938f, 
-    /* 0x0000c4e0: */ 0x9392, 0x9396, 0x939a, 0x939d, 0x93a1, 0x93a4, 0x93a8, 0x93ac, 0x93af, 0x93b3, 0x93b7, 0x93ba, 0x93be, 0x93c2, 0x93c5, 0x93c9, 
-    /* 0x0000c500: */ 0x93cd, 0x93d0, 0x93d4, 0x93d8, 0x93db, 0x93df, 0x93e3, 0x93e6, 0x93ea, 0x93ee, 0x93f1, 0x93f5, 0x93f9, 0x93fc, 0x9400, 0x9404, 
-    /* 0x0000c520: */ 0x9407, 0x940b, 0x940f, 0x9412, 0x9416, 0x941a, 0x941e, 0x9421, 0x9425, 0x9429, 0x942c, 0x9430, 0x9434, 0x9437, 0x943b, 0x943f, 
-    /* 0x0000c540: */ 0x9442, 0x9446, 0x944a, 0x944e, 0x9451, 0x9455, 0x9459, 0x945c, 0x9460, 0x9464, 0x9468, 0x946b, 0x946f, 0x9473, 0x9476, 0x947a, 
-    /* 0x0000c560: */ 0x947e, 0x9482, 0x9485, 0x9489, 0x948d, 0x9490, 0x9494, 0x9498, 0x949c, 0x949f, 0x94a3, 0x94a7, 0x94ab, 0x94ae, 0x94b2, 0x94b6, 
-    /* 0x0000c580: */ 0x94ba, 0x94bd, 0x94c1, 0x94c5, 0x94c8, 0x94cc, 0x94d0, 0x94d4, 0x94d7, 0x94db, 0x94df, 0x94e3, 0x94e6, 0x94ea, 0x94ee, 0x94f2, 
-    /* 0x0000c5a0: */ 0x94f6, 0x94f9, 0x94fd, 0x9501, 0x9505, 0x9508, 0x950c, 0x9510, 0x9514, 0x9517, 0x951b, 0x951f, 0x9523, 0x9526, 0x952a, 0x952e, 
-    /* 0x0000c5c0: */ 0x9532, 0x9536, 0x9539, 0x953d, 0x9541, 0x9545, 0x9549, 0x954c, 0x9550, 0x9554, 0x9558, 0x955b, 0x955f, 0x9563, 0x9567, 0x956b, 
-    /* 0x0000c5e0: */ 0x956e, 0x9572, 0x9576, 0x957a, 0x957e, 0x9581, 0x9585, 0x9589, 0x958d, 0x9591, 0x9594, 0x9598, 0x959c, 0x95a0, 0x95a4, 0x95a8, 
-    /* 0x0000c600: */ 0x95ab, 0x95af, 0x95b3, 0x95b7, 0x95bb, 0x95be, 0x95c2, 0x95c6, 0x95ca, 0x95ce, 0x95d2, 0x95d5, 0x95d9, 0x95dd, 0x95e1, 0x95e5, 
-    /* 0x0000c620: */ 0x95e9, 0x95ec, 0x95f0, 0x95f4, 0x95f8, 0x95fc, 0x9600, 0x9603, 0x9607, 0x960b, 0x960f, 0x9613, 0x9617, 0x961a, 0x961e, 0x9622, 
-    /* 0x0000c640: */ 0x9626, 0x962a, 0x962e, 0x9632, 0x9635, 0x9639, 0x963d, 0x9641, 0x9645, 0x9649, 0x964d, 0x9651, 0x9654, 0x9658, 0x965c, 0x9660, 
-    /* 0x0000c660: */ 0x9664, 0x9668, 0x966c, 0x9670, 0x9673, 0x9677, 0x967b, 0x967f, 0x9683, 0x9687, 0x968b, 0x968f, 0x9692, 0x9696, 0x969a, 0x969e, 
-    /* 0x0000c680: */ 0x96a2, 0x96a6, 0x96aa, 0x96ae, 0x96b2, 0x96b5, 0x96b9, 0x96bd, 0x96c1, 0x96c5, 0x96c9, 0x96cd, 0x96d1, 0x96d5, 0x96d9, 0x96dd, 
-    /* 0x0000c6a0: */ 0x96e0, 0x96e4, 0x96e8, 0x96ec, 0x96f0, 0x96f4, 0x96f8, 0x96fc, 0x9700, 0x9704, 0x9708, 0x970c, 0x970f, 0x9713, 0x9717, 0x971b, 
-    /* 0x0000c6c0: */ 0x971f, 0x9723, 0x9727, 0x972b, 0x972f, 0x9733, 0x9737, 0x973b, 0x973f, 0x9743, 0x9747, 0x974a, 0x974e, 0x9752, 0x9756, 0x975a, 
-    /* 0x0000c6e0: */ 0x975e, 0x9762, 0x9766, 0x976a, 0x976e, 0x9772, 0x9776, 0x977a, 0x977e, 0x9782, 0x9786, 0x978a, 0x978e, 0x9792, 0x9796, 0x979a, 
-    /* 0x0000c700: */ 0x979e, 0x97a1, 0x97a5, 0x97a9, 0x97ad, 0x97b1, 0x97b5, 0x97b9, 0x97bd, 0x97c1, 0x97c5, 0x97c9, 0x97cd, 0x97d1, 0x97d5, 0x97d9, 
-    /* 0x0000c720: */ 0x97dd, 0x97e1, 0x97e5, 0x97e9, 0x97ed, 0x97f1, 0x97f5, 0x97f9, 0x97fd, 0x9801, 0x9805, 0x9809, 0x980d, 0x9811, 0x9815, 0x9819, 
-    /* 0x0000c740: */ 0x981d, 0x9821, 0x9825, 0x9829, 0x982d, 0x9831, 0x9835, 0x9839, 0x983d, 0x9841, 0x9845, 0x9849, 0x984d, 0x9851, 0x9855, 0x9859, 
-    /* 0x0000c760: */ 0x985d, 0x9861, 0x9865, 0x9869, 0x986d, 0x9871, 0x9875, 0x9879, 0x987e, 0x9882, 0x9886, 0x988a, 0x988e, 0x9892, 0x9896, 0x989a, 
-    /* 0x0000c780: */ 0x989e, 0x98a2, 0x98a6, 0x98aa, 0x98ae, 0x98b2, 0x98b6, 0x98ba, 0x98be, 0x98c2, 0x98c6, 0x98ca, 0x98ce, 0x98d2, 0x98d7, 0x98db, 
-    /* 0x0000c7a0: */ 0x98df, 0x98e3, 0x98e7, 0x98eb, 0x98ef, 0x98f3, 0x98f7, 0x98fb, 0x98ff, 0x9903, 0x9907, 0x990b, 0x990f, 0x9914, 0x9918, 0x991c, 
-    /* 0x0000c7c0: */ 0x9920, 0x9924, 0x9928, 0x992c, 0x9930, 0x9934, 0x9938, 0x993c, 0x9940, 0x9945, 0x9949, 0x994d, 0x9951, 0x9955, 0x9959, 0x995d, 
-    /* 0x0000c7e0: */ 0x9961, 0x9965, 0x9969, 0x996d, 0x9972, 0x9976, 0x997a, 0x997e, 0x9982, 0x9986, 0x998a, 0x998e, 0x9992, 0x9997, 0x999b, 0x999f, 
-    /* 0x0000c800: */ 0x99a3, 0x99a7, 0x99ab, 0x99af, 0x99b3, 0x99b7, 0x99bc, 0x99c0, 0x99c4, 0x99c8, 0x99cc, 0x99d0, 0x99d4, 0x99d8, 0x99dd, 0x99e1, 
-    /* 0x0000c820: */ 0x99e5, 0x99e9, 0x99ed, 0x99f1, 0x99f5, 0x99fa, 0x99fe, 0x9a02, 0x9a06, 0x9a0a, 0x9a0e, 0x9a12, 0x9a17, 0x9a1b, 0x9a1f, 0x9a23, 
-    /* 0x0000c840: */ 0x9a27, 0x9a2b, 0x9a2f, 0x9a34, 0x9a38, 0x9a3c, 0x9a40, 0x9a44, 0x9a48, 0x9a4d, 0x9a51, 0x9a55, 0x9a59, 0x9a5d, 0x9a61, 0x9a66, 
-    /* 0x0000c860: */ 0x9a6a, 0x9a6e, 0x9a72, 0x9a76, 0x9a7a, 0x9a7f, 0x9a83, 0x9a87, 0x9a8b, 0x9a8f, 0x9a94, 0x9a98, 0x9a9c, 0x9aa0, 0x9aa4, 0x9aa8, 
-    /* 0x0000c880: */ 0x9aad, 0x9ab1, 0x9ab5, 0x9ab9, 0x9abd, 0x9ac2, 0x9ac6, 0x9aca, 0x9ace, 0x9ad2, 0x9ad7, 0x9adb, 0x9adf, 0x9ae3, 0x9ae7, 0x9aec, 
-    /* 0x0000c8a0: */ 0x9af0, 0x9af4, 0x9af8, 0x9afc, 0x9b01, 0x9b05, 0x9b09, 0x9b0d, 0x9b11, 0x9b16, 0x9b1a, 0x9b1e, 0x9b22, 0x9b27, 0x9b2b, 0x9b2f, 
-    /* 0x0000c8c0: */ 0x9b33, 0x9b37, 0x9b3c, 0x9b40, 0x9b44, 0x9b48, 0x9b4d, 0x9b51, 0x9b55, 0x9b59, 0x9b5e, 0x9b62, 0x9b66, 0x9b6a, 0x9b6e, 0x9b73, 
-    /* 0x0000c8e0: */ 0x9b77, 0x9b7b, 0x9b7f, 0x9b84, 0x9b88, 0x9b8c, 0x9b90, 0x9b95, 0x9b99, 0x9b9d, 0x9ba1, 0x9ba6, 0x9baa, 0x9bae, 0x9bb2, 0x9bb7, 
-    /* 0x0000c900: */ 0x9bbb, 0x9bbf, 0x9bc4, 0x9bc8, 0x9bcc, 0x9bd0, 0x9bd5, 0x9bd9, 0x9bdd, 0x9be1, 0x9be6, 0x9bea, 0x9bee, 0x9bf3, 0x9bf7, 0x9bfb, 
-    /* 0x0000c920: */ 0x9bff, 0x9c04, 0x9c08, 0x9c0c, 0x9c10, 0x9c15, 0x9c19, 0x9c1d, 0x9c22, 0x9c26, 0x9c2a, 0x9c2e, 0x9c33, 0x9c37, 0x9c3b, 0x9c40, 
-    /* 0x0000c940: */ 0x9c44, 0x9c48, 0x9c4d, 0x9c51, 0x9c55, 0x9c59, 0x9c5e, 0x9c62, 0x9c66, 0x9c6b, 0x9c6f, 0x9c73, 0x9c78, 0x9c7c, 0x9c80, 0x9c85, 
-    /* 0x0000c960: */ 0x9c89, 0x9c8d, 0x9c91, 0x9c96, 0x9c9a, 0x9c9e, 0x9ca3, 0x9ca7, 0x9cab, 0x9cb0, 0x9cb4, 0x9cb8, 0x9cbd, 0x9cc1, 0x9cc5, 0x9cca, 
-    /* 0x0000c980: */ 0x9cce, 0x9cd2, 0x9cd7, 0x9cdb, 0x9cdf, 0x9ce4, 0x9ce8, 0x9cec, 0x9cf1, 0x9cf5, 0x9cf9, 0x9cfe, 0x9d02, 0x9d06, 0x9d0b, 0x9d0f, 
-    /* 0x0000c9a0: */ 0x9d13, 0x9d18, 0x9d1c, 0x9d21, 0x9d25, 0x9d29, 0x9d2e, 0x9d32, 0x9d36, 0x9d3b, 0x9d3f, 0x9d43, 0x9d48, 0x9d4c, 0x9d50, 0x9d55, 
-    /* 0x0000c9c0: */ 0x9d59, 0x9d5e, 0x9d62, 0x9d66, 0x9d6b, 0x9d6f, 0x9d73, 0x9d78, 0x9d7c, 0x9d81, 0x9d85, 0x9d89, 0x9d8e, 0x9d92, 0x9d96, 0x9d9b, 
-    /* 0x0000c9e0: */ 0x9d9f, 0x9da4, 0x9da8, 0x9dac, 0x9db1, 0x9db5, 0x9dba, 0x9dbe, 0x9dc2, 0x9dc7, 0x9dcb, 0x9dd0, 0x9dd4, 0x9dd8, 0x9ddd, 0x9de1, 
-    /* 0x0000ca00: */ 0x9de6, 0x9dea, 0x9dee, 0x9df3, 0x9df7, 0x9dfc, 0x9e00, 0x9e04, 0x9e09, 0x9e0d, 0x9e12, 0x9e16, 0x9e1a, 0x9e1f, 0x9e23, 0x9e28, 
-    /* 0x0000ca20: */ 0x9e2c, 0x9e31, 0x9e35, 0x9e39, 0x9e3e, 0x9e42, 0x9e47, 0x9e4b, 0x9e50, 0x9e54, 0x9e58, 0x9e5d, 0x9e61, 0x9e66, 0x9e6a, 0x9e6f, 
-    /* 0x0000ca40: */ 0x9e73, 0x9e77, 0x9e7c, 0x9e80, 0x9e85, 0x9e89, 0x9e8e, 0x9e92, 0x9e97, 0x9e9b, 0x9e9f, 0x9ea4, 0x9ea8, 0x9ead, 0x9eb1, 0x9eb6, 
-    /* 0x0000ca60: */ 0x9eba, 0x9ebf, 0x9ec3, 0x9ec8, 0x9ecc, 0x9ed0, 0x9ed5, 0x9ed9, 0x9ede, 0x9ee2, 0x9ee7, 0x9eeb, 0x9ef0, 0x9ef4, 0x9ef9, 0x9efd, 
-    /* 0x0000ca80: */ 0x9f02, 0x9f06, 0x9f0b, 0x9f0f, 0x9f14, 0x9f18, 0x9f1c, 0x9f21, 0x9f25, 0x9f2a, 0x9f2e, 0x9f33, 0x9f37, 0x9f3c, 0x9f40, 0x9f45, 
-    /* 0x0000caa0: */ 0x9f49, 0x9f4e, 0x9f52, 0x9f57, 0x9f5b, 0x9f60, 0x9f64, 0x9f69, 0x9f6d, 0x9f72, 0x9f76, 0x9f7b, 0x9f7f, 0x9f84, 0x9f88, 0x9f8d, 
-    /* 0x0000cac0: */ 0x9f91, 0x9f96, 0x9f9a, 0x9f9f, 0x9fa3, 0x9fa8, 0x9fac, 0x9fb1, 0x9fb5, 0x9fba, 0x9fbe, 0x9fc3, 0x9fc8, 0x9fcc, 0x9fd1, 0x9fd5, 
-    /* 0x0000cae0: */ 0x9fda, 0x9fde, 0x9fe3, 0x9fe7, 0x9fec, 0x9ff0, 0x9ff5, 0x9ff9, 0x9ffe, 0xa002, 0xa007, 0xa00b, 0xa010, 0xa015, 0xa019, 0xa01e, 
-    /* 0x0000cb00: */ 0xa022, 0xa027, 0xa02b, 0xa030, 0xa034, 0xa039, 0xa03d, 0xa042, 0xa047, 0xa04b, 0xa050, 0xa054, 0xa059, 0xa05d, 0xa062, 0xa066, 
-    /* 0x0000cb20: */ 0xa06b, 0xa070, 0xa074, 0xa079, 0xa07d, 0xa082, 0xa086, 0xa08b, 0xa08f, 0xa094, 0xa099, 0xa09d, 0xa0a2, 0xa0a6, 0xa0ab, 0xa0af, 
-    /* 0x0000cb40: */ 0xa0b4, 0xa0b9, 0xa0bd, 0xa0c2, 0xa0c6, 0xa0cb, 0xa0d0, 0xa0d4, 0xa0d9, 0xa0dd, 0xa0e2, 0xa0e6, 0xa0eb, 0xa0f0, 0xa0f4, 0xa0f9, 
-    /* 0x0000cb60: */ 0xa0fd, 0xa102, 0xa107, 0xa10b, 0xa110, 0xa114, 0xa119, 0xa11e, 0xa122, 0xa127, 0xa12b, 0xa130, 0xa135, 0xa139, 0xa13e, 0xa142, 
-    /* 0x0000cb80: */ 0xa147, 0xa14c, 0xa150, 0xa155, 0xa15a, 0xa15e, 0xa163, 0xa167, 0xa16c, 0xa171, 0xa175, 0xa17a, 0xa17e, 0xa183, 0xa188, 0xa18c, 
-    /* 0x0000cba0: */ 0xa191, 0xa196, 0xa19a, 0xa19f, 0xa1a3, 0xa1a8, 0xa1ad, 0xa1b1, 0xa1b6, 0xa1bb, 0xa1bf, 0xa1c4, 0xa1c9, 0xa1cd, 0xa1d2, 0xa1d7, 
-    /* 0x0000cbc0: */ 0xa1db, 0xa1e0, 0xa1e4, 0xa1e9, 0xa1ee, 0xa1f2, 0xa1f7, 0xa1fc, 0xa200, 0xa205, 0xa20a, 0xa20e, 0xa213, 0xa218, 0xa21c, 0xa221, 
-    /* 0x0000cbe0: */ 0xa226, 0xa22a, 0xa22f, 0xa234, 0xa238, 0xa23d, 0xa242, 0xa246, 0xa24b, 0xa250, 0xa254, 0xa259, 0xa25e, 0xa262, 0xa267, 0xa26c, 
-    /* 0x0000cc00: */ 0xa270, 0xa275, 0xa27a, 0xa27e, 0xa283, 0xa288, 0xa28c, 0xa291, 0xa296, 0xa29a, 0xa29f, 0xa2a4, 0xa2a9, 0xa2ad, 0xa2b2, 0xa2b7, 
-    /* 0x0000cc20: */ 0xa2bb, 0xa2c0, 0xa2c5, 0xa2c9, 0xa2ce, 0xa2d3, 0xa2d7, 0xa2dc, 0xa2e1, 0xa2e6, 0xa2ea, 0xa2ef, 0xa2f4, 0xa2f8, 0xa2fd, 0xa302, 
-    /* 0x0000cc40: */ 0xa307, 0xa30b, 0xa310, 0xa315, 0xa319, 0xa31e, 0xa323, 0xa328, 0xa32c, 0xa331, 0xa336, 0xa33a, 0xa33f, 0xa344, 0xa349, 0xa34d, 
-    /* 0x0000cc60: */ 0xa352, 0xa357, 0xa35c, 0xa360, 0xa365, 0xa36a, 0xa36e, 0xa373, 0xa378, 0xa37d, 0xa381, 0xa386, 0xa38b, 0xa390, 0xa394, 0xa399, 
-    /* 0x0000cc80: */ 0xa39e, 0xa3a3, 0xa3a7, 0xa3ac, 0xa3b1, 0xa3b6, 0xa3ba, 0xa3bf, 0xa3c4, 0xa3c9, 0xa3cd, 0xa3d2, 0xa3d7, 0xa3dc, 0xa3e0, 0xa3e5, 
-    /* 0x0000cca0: */ 0xa3ea, 0xa3ef, 0xa3f3, 0xa3f8, 0xa3fd, 0xa402, 0xa407, 0xa40b, 0xa410, 0xa415, 0xa41a, 0xa41e, 0xa423, 0xa428, 0xa42d, 0xa431, 
-    /* 0x0000ccc0: */ 0xa436, 0xa43b, 0xa440, 0xa445, 0xa449, 0xa44e, 0xa453, 0xa458, 0xa45c, 0xa461, 0xa466, 0xa46b, 0xa470, 0xa474, 0xa479, 0xa47e, 
-    /* 0x0000cce0: */ 0xa483, 0xa488, 0xa48c, 0xa491, 0xa496, 0xa49b, 0xa4a0, 0xa4a4, 0xa4a9, 0xa4ae, 0xa4b3, 0xa4b8, 0xa4bc, 0xa4c1, 0xa4c6, 0xa4cb, 
-    /* 0x0000cd00: */ 0xa4d0, 0xa4d4, 0xa4d9, 0xa4de, 0xa4e3, 0xa4e8, 0xa4ed, 0xa4f1, 0xa4f6, 0xa4fb, 0xa500, 0xa505, 0xa509, 0xa50e, 0xa513, 0xa518, 
-    /* 0x0000cd20: */ 0xa51d, 0xa522, 0xa526, 0xa52b, 0xa530, 0xa535, 0xa53a, 0xa53f, 0xa543, 0xa548, 0xa54d, 0xa552, 0xa557, 0xa55c, 0xa560, 0xa565, 
-    /* 0x0000cd40: */ 0xa56a, 0xa56f, 0xa574, 0xa579, 0xa57e, 0xa582, 0xa587, 0xa58c, 0xa591, 0xa596, 0xa59b, 0xa59f, 0xa5a4, 0xa5a9, 0xa5ae, 0xa5b3, 
-    /* 0x0000cd60: */ 0xa5b8, 0xa5bd, 0xa5c1, 0xa5c6, 0xa5cb, 0xa5d0, 0xa5d5, 0xa5da, 0xa5df, 0xa5e4, 0xa5e8, 0xa5ed, 0xa5f2, 0xa5f7, 0xa5fc, 0xa601, 
-    /* 0x0000cd80: */ 0xa606, 0xa60b, 0xa60f, 0xa614, 0xa619, 0xa61e, 0xa623, 0xa628, 0xa62d, 0xa632, 0xa636, 0xa63b, 0xa640, 0xa645, 0xa64a, 0xa64f, 
-    /* 0x0000cda0: */ 0xa654, 0xa659, 0xa65e, 0xa662, 0xa667, 0xa66c, 0xa671, 0xa676, 0xa67b, 0xa680, 0xa685, 0xa68a, 0xa68f, 0xa693, 0xa698, 0xa69d, 
-    /* 0x0000cdc0: */ 0xa6a2, 0xa6a7, 0xa6ac, 0xa6b1, 0xa6b6, 0xa6bb, 0xa6c0, 0xa6c5, 0xa6c9, 0xa6ce, 0xa6d3, 0xa6d8, 0xa6dd, 0xa6e2, 0xa6e7, 0xa6ec, 
-    /* 0x0000cde0: */ 0xa6f1, 0xa6f6, 0xa6fb, 0xa700, 0xa705, 0xa709, 0xa70e, 0xa713, 0xa718, 0xa71d, 0xa722, 0xa727, 0xa72c, 0xa731, 0xa736, 0xa73b, 
-    /* 0x0000ce00: */ 0xa740, 0xa745, 0xa74a, 0xa74f, 0xa754, 0xa758, 0xa75d, 0xa762, 0xa767, 0xa76c, 0xa771, 0xa776, 0xa77b, 0xa780, 0xa785, 0xa78a, 
-    /* 0x0000ce20: */ 0xa78f, 0xa794, 0xa799, 0xa79e, 0xa7a3, 0xa7a8, 0xa7ad, 0xa7b2, 0xa7b7, 0xa7bc, 0xa7c1, 0xa7c6, 0xa7ca, 0xa7cf, 0xa7d4, 0xa7d9, 
-    /* 0x0000ce40: */ 0xa7de, 0xa7e3, 0xa7e8, 0xa7ed, 0xa7f2, 0xa7f7, 0xa7fc, 0xa801, 0xa806, 0xa80b, 0xa810, 0xa815, 0xa81a, 0xa81f, 0xa824, 0xa829, 
-    /* 0x0000ce60: */ 0xa82e, 0xa833, 0xa838, 0xa83d, 0xa842, 0xa847, 0xa84c, 0xa851, 0xa856, 0xa85b, 0xa860, 0xa865, 0xa86a, 0xa86f, 0xa874, 0xa879, 
-    /* 0x0000ce80: */ 0xa87e, 0xa883, 0xa888, 0xa88d, 0xa892, 0xa897, 0xa89c, 0xa8a1, 0xa8a6, 0xa8ab, 0xa8b0, 0xa8b5, 0xa8ba, 0xa8bf, 0xa8c4, 0xa8c9, 
-    /* 0x0000cea0: */ 0xa8ce, 0xa8d3, 0xa8d8, 0xa8dd, 0xa8e2, 0xa8e7, 0xa8ec, 0xa8f1, 0xa8f6, 0xa8fb, 0xa900, 0xa905, 0xa90a, 0xa90f, 0xa914, 0xa91a, 
-    /* 0x0000cec0: */ 0xa91f, 0xa924, 0xa929, 0xa92e, 0xa933, 0xa938, 0xa93d, 0xa942, 0xa947, 0xa94c, 0xa951, 0xa956, 0xa95b, 0xa960, 0xa965, 0xa96a, 
-    /* 0x0000cee0: */ 0xa96f, 0xa974, 0xa979, 0xa97e, 0xa983, 0xa988, 0xa98e, 0xa993, 0xa998, 0xa99d, 0xa9a2, 0xa9a7, 0xa9ac, 0xa9b1, 0xa9b6, 0xa9bb, 
-    /* 0x0000cf00: */ 0xa9c0, 0xa9c5, 0xa9ca, 0xa9cf, 0xa9d4, 0xa9d9, 0xa9df, 0xa9e4, 0xa9e9, 0xa9ee, 0xa9f3, 0xa9f8, 0xa9fd, 0xaa02, 0xaa07, 0xaa0c, 
-    /* 0x0000cf20: */ 0xaa11, 0xaa16, 0xaa1b, 0xaa21, 0xaa26, 0xaa2b, 0xaa30, 0xaa35, 0xaa3a, 0xaa3f, 0xaa44, 0xaa49, 0xaa4e, 0xaa53, 0xaa59, 0xaa5e, 
-    /* 0x0000cf40: */ 0xaa63, 0xaa68, 0xaa6d, 0xaa72, 0xaa77, 0xaa7c, 0xaa81, 0xaa86, 0xaa8c, 0xaa91, 0xaa96, 0xaa9b, 0xaaa0, 0xaaa5, 0xaaaa, 0xaaaf, 
-    /* 0x0000cf60: */ 0xaab4, 0xaaba, 0xaabf, 0xaac4, 0xaac9, 0xaace, 0xaad3, 0xaad8, 0xaadd, 0xaae2, 0xaae8, 0xaaed, 0xaaf2, 0xaaf7, 0xaafc, 0xab01, 
-    /* 0x0000cf80: */ 0xab06, 0xab0b, 0xab11, 0xab16, 0xab1b, 0xab20, 0xab25, 0xab2a, 0xab2f, 0xab34, 0xab3a, 0xab3f, 0xab44, 0xab49, 0xab4e, 0xab53, 
-    /* 0x0000cfa0: */ 0xab58, 0xab5e, 0xab63, 0xab68, 0xab6d, 0xab72, 0xab77, 0xab7c, 0xab82, 0xab87, 0xab8c, 0xab91, 0xab96, 0xab9b, 0xaba1, 0xaba6, 
-    /* 0x0000cfc0: */ 0xabab, 0xabb0, 0xabb5, 0xabba, 0xabbf, 0xabc5, 0xabca, 0xabcf, 0xabd4, 0xabd9, 0xabde, 0xabe4, 0xabe9, 0xabee, 0xabf3, 0xabf8, 
-    /* 0x0000cfe0: */ 0xabfd, 0xac03, 0xac08, 0xac0d, 0xac12, 0xac17, 0xac1d, 0xac22, 0xac27, 0xac2c, 0xac31, 0xac36, 0xac3c, 0xac41, 0xac46, 0xac4b, 
-    /* 0x0000d000: */ 0xac50, 0xac56, 0xac5b, 0xac60, 0xac65, 0xac6a, 0xac70, 0xac75, 0xac7a, 0xac7f, 0xac84, 0xac89, 0xac8f, 0xac94, 0xac99, 0xac9e, 
-    /* 0x0000d020: */ 0xaca3, 0xaca9, 0xacae, 0xacb3, 0xacb8, 0xacbe, 0xacc3, 0xacc8, 0xaccd, 0xacd2, 0xacd8, 0xacdd, 0xace2, 0xace7, 0xacec, 0xacf2, 
-    /* 0x0000d040: */ 0xacf7, 0xacfc, 0xad01, 0xad07, 0xad0c, 0xad11, 0xad16, 0xad1b, 0xad21, 0xad26, 0xad2b, 0xad30, 0xad36, 0xad3b, 0xad40, 0xad45, 
-    /* 0x0000d060: */ 0xad4a, 0xad50, 0xad55, 0xad5a, 0xad5f, 0xad65, 0xad6a, 0xad6f, 0xad74, 0xad7a, 0xad7f, 0xad84, 0xad89, 0xad8f, 0xad94, 0xad99, 
-    /* 0x0000d080: */ 0xad9e, 0xada4, 0xada9, 0xadae, 0xadb3, 0xadb9, 0xadbe, 0xadc3, 0xadc8, 0xadce, 0xadd3, 0xadd8, 0xaddd, 0xade3, 0xade8, 0xaded, 
-    /* 0x0000d0a0: */ 0xadf2, 0xadf8, 0xadfd, 0xae02, 0xae07, 0xae0d, 0xae12, 0xae17, 0xae1c, 0xae22, 0xae27, 0xae2c, 0xae32, 0xae37, 0xae3c, 0xae41, 
-    /* 0x0000d0c0: */ 0xae47, 0xae4c, 0xae51, 0xae56, 0xae5c, 0xae61, 0xae66, 0xae6c, 0xae71, 0xae76, 0xae7b, 0xae81, 0xae86, 0xae8b, 0xae91, 0xae96, 
-    /* 0x0000d0e0: */ 0xae9b, 0xaea0, 0xaea6, 0xaeab, 0xaeb0, 0xaeb6, 0xaebb, 0xaec0, 0xaec6, 0xaecb, 0xaed0, 0xaed5, 0xaedb, 0xaee0, 0xaee5, 0xaeeb, 
-    /* 0x0000d100: */ 0xaef0, 0xaef5, 0xaefb, 0xaf00, 0xaf05, 0xaf0b, 0xaf10, 0xaf15, 0xaf1a, 0xaf20, 0xaf25, 0xaf2a, 0xaf30, 0xaf35, 0xaf3a, 0xaf40, 
-    /* 0x0000d120: */ 0xaf45, 0xaf4a, 0xaf50, 0xaf55, 0xaf5a, 0xaf60, 0xaf65, 0xaf6a, 0xaf70, 0xaf75, 0xaf7a, 0xaf80, 0xaf85, 0xaf8a, 0xaf90, 0xaf95, 
-    /* 0x0000d140: */ 0xaf9a, 0xafa0, 0xafa5, 0xafaa, 0xafb0, 0xafb5, 0xafba, 0xafc0, 0xafc5, 0xafca, 0xafd0, 0xafd5, 0xafda, 0xafe0, 0xafe5, 0xafea, 
-    /* 0x0000d160: */ 0xaff0, 0xaff5, 0xaffa, 0xb000, 0xb005, 0xb00a, 0xb010, 0xb015, 0xb01a, 0xb020, 0xb025, 0xb02b, 0xb030, 0xb035, 0xb03b, 0xb040, 
-    /* 0x0000d180: */ 0xb045, 0xb04b, 0xb050, 0xb055, 0xb05b, 0xb060, 0xb066, 0xb06b, 0xb070, 0xb076, 0xb07b, 0xb080, 0xb086, 0xb08b, 0xb091, 0xb096, 
-    /* 0x0000d1a0: */ 0xb09b, 0xb0a1, 0xb0a6, 0xb0ab, 0xb0b1, 0xb0b6, 0xb0bc, 0xb0c1, 0xb0c6, 0xb0cc, 0xb0d1, 0xb0d7, 0xb0dc, 0xb0e1, 0xb0e7, 0xb0ec, 
-    /* 0x0000d1c0: */ 0xb0f1, 0xb0f7, 0xb0fc, 0xb102, 0xb107, 0xb10c, 0xb112, 0xb117, 0xb11d, 0xb122, 0xb127, 0xb12d, 0xb132, 0xb138, 0xb13d, 0xb142, 
-    /* 0x0000d1e0: */ 0xb148, 0xb14d, 0xb153, 0xb158, 0xb15d, 0xb163, 0xb168, 0xb16e, 0xb173, 0xb179, 0xb17e, 0xb183, 0xb189, 0xb18e, 0xb194, 0xb199, 
-    /* 0x0000d200: */ 0xb19e, 0xb1a4, 0xb1a9, 0xb1af, 0xb1b4, 0xb1ba, 0xb1bf, 0xb1c4, 0xb1ca, 0xb1cf, 0xb1d5, 0xb1da, 0xb1e0, 0xb1e5, 0xb1ea, 0xb1f0, 
-    /* 0x0000d220: */ 0xb1f5, 0xb1fb, 0xb200, 0xb206, 0xb20b, 0xb210, 0xb216, 0xb21b, 0xb221, 0xb226, 0xb22c, 0xb231, 0xb237, 0xb23c, 0xb241, 0xb247, 
-    /* 0x0000d240: */ 0xb24c, 0xb252, 0xb257, 0xb25d, 0xb262, 0xb268, 0xb26d, 0xb272, 0xb278, 0xb27d, 0xb283, 0xb288, 0xb28e, 0xb293, 0xb299, 0xb29e, 
-    /* 0x0000d260: */ 0xb2a4, 0xb2a9, 0xb2af, 0xb2b4, 0xb2b9, 0xb2bf, 0xb2c4, 0xb2ca, 0xb2cf, 0xb2d5, 0xb2da, 0xb2e0, 0xb2e5, 0xb2eb, 0xb2f0, 0xb2f6, 
-    /* 0x0000d280: */ 0xb2fb, 0xb301, 0xb306, 0xb30c, 0xb311, 0xb316, 0xb31c, 0xb321, 0xb327, 0xb32c, 0xb332, 0xb337, 0xb33d, 0xb342, 0xb348, 0xb34d, 
-    /* 0x0000d2a0: */ 0xb353, 0xb358, 0xb35e, 0xb363, 0xb369, 0xb36e, 0xb374, 0xb379, 0xb37f, 0xb384, 0xb38a, 0xb38f, 0xb395, 0xb39a, 0xb3a0, 0xb3a5, 
-    /* 0x0000d2c0: */ 0xb3ab, 0xb3b0, 0xb3b6, 0xb3bb, 0xb3c1, 0xb3c6, 0xb3cc, 0xb3d1, 0xb3d7, 0xb3dc, 0xb3e2, 0xb3e7, 0xb3ed, 0xb3f2, 0xb3f8, 0xb3fd, 
-    /* 0x0000d2e0: */ 0xb403, 0xb408, 0xb40e, 0xb413, 0xb419, 0xb41f, 0xb424, 0xb42a, 0xb42f, 0xb435, 0xb43a, 0xb440, 0xb445, 0xb44b, 0xb450, 0xb456, 
-    /* 0x0000d300: */ 0xb45b, 0xb461, 0xb466, 0xb46c, 0xb471, 0xb477, 0xb47d, 0xb482, 0xb488, 0xb48d, 0xb493, 0xb498, 0xb49e, 0xb4a3, 0xb4a9, 0xb4ae, 
-    /* 0x0000d320: */ 0xb4b4, 0xb4b9, 0xb4bf, 0xb4c5, 0xb4ca, 0xb4d0, 0xb4d5, 0xb4db, 0xb4e0, 0xb4e6, 0xb4eb, 0xb4f1, 0xb4f6, 0xb4fc, 0xb502, 0xb507, 
-    /* 0x0000d340: */ 0xb50d, 0xb512, 0xb518, 0xb51d, 0xb523, 0xb529, 0xb52e, 0xb534, 0xb539, 0xb53f, 0xb544, 0xb54a, 0xb54f, 0xb555, 0xb55b, 0xb560, 
-    /* 0x0000d360: */ 0xb566, 0xb56b, 0xb571, 0xb576, 0xb57c, 0xb582, 0xb587, 0xb58d, 0xb592, 0xb598, 0xb59d, 0xb5a3, 0xb5a9, 0xb5ae, 0xb5b4, 0xb5b9, 
-    /* 0x0000d380: */ 0xb5bf, 0xb5c5, 0xb5ca, 0xb5d0, 0xb5d5, 0xb5db, 0xb5e1, 0xb5e6, 0xb5ec, 0xb5f1, 0xb5f7, 0xb5fc, 0xb602, 0xb608, 0xb60d, 0xb613, 
-    /* 0x0000d3a0: */ 0xb618, 0xb61e, 0xb624, 0xb629, 0xb62f, 0xb634, 0xb63a, 0xb640, 0xb645, 0xb64b, 0xb650, 0xb656, 0xb65c, 0xb661, 0xb667, 0xb66c, 
-    /* 0x0000d3c0: */ 0xb672, 0xb678, 0xb67d, 0xb683, 0xb689, 0xb68e, 0xb694, 0xb699, 0xb69f, 0xb6a5, 0xb6aa, 0xb6b0, 0xb6b5, 0xb6bb, 0xb6c1, 0xb6c6, 
-    /* 0x0000d3e0: */ 0xb6cc, 0xb6d2, 0xb6d7, 0xb6dd, 0xb6e2, 0xb6e8, 0xb6ee, 0xb6f3, 0xb6f9, 0xb6ff, 0xb704, 0xb70a, 0xb710, 0xb715, 0xb71b, 0xb720, 
-    /* 0x0000d400: */ 0xb726, 0xb72c, 0xb731, 0xb737, 0xb73d, 0xb742, 0xb748, 0xb74e, 0xb753, 0xb759, 0xb75e, 0xb764, 0xb76a, 0xb76f, 0xb775, 0xb77b, 
-    /* 0x0000d420: */ 0xb780, 0xb786, 0xb78c, 0xb791, 0xb797, 0xb79d, 0xb7a2, 0xb7a8, 0xb7ae, 0xb7b3, 0xb7b9, 0xb7bf, 0xb7c4, 0xb7ca, 0xb7d0, 0xb7d5, 
-    /* 0x0000d440: */ 0xb7db, 0xb7e1, 0xb7e6, 0xb7ec, 0xb7f2, 0xb7f7, 0xb7fd, 0xb803, 0xb808, 0xb80e, 0xb814, 0xb819, 0xb81f, 0xb825, 0xb82a, 0xb830, 
-    /* 0x0000d460: */ 0xb836, 0xb83b, 0xb841, 0xb847, 0xb84c, 0xb852, 0xb858, 0xb85d, 0xb863, 0xb869, 0xb86e, 0xb874, 0xb87a, 0xb87f, 0xb885, 0xb88b, 
-    /* 0x0000d480: */ 0xb890, 0xb896, 0xb89c, 0xb8a2, 0xb8a7, 0xb8ad, 0xb8b3, 0xb8b8, 0xb8be, 0xb8c4, 0xb8c9, 0xb8cf, 0xb8d5, 0xb8db, 0xb8e0, 0xb8e6, 
-    /* 0x0000d4a0: */ 0xb8ec, 0xb8f1, 0xb8f7, 0xb8fd, 0xb902, 0xb908, 0xb90e, 0xb914, 0xb919, 0xb91f, 0xb925, 0xb92a, 0xb930, 0xb936, 0xb93c, 0xb941, 
-    /* 0x0000d4c0: */ 0xb947, 0xb94d, 0xb952, 0xb958, 0xb95e, 0xb964, 0xb969, 0xb96f, 0xb975, 0xb97a, 0xb980, 0xb986, 0xb98c, 0xb991, 0xb997, 0xb99d, 
-    /* 0x0000d4e0: */ 0xb9a2, 0xb9a8, 0xb9ae, 0xb9b4, 0xb9b9, 0xb9bf, 0xb9c5, 0xb9cb, 0xb9d0, 0xb9d6, 0xb9dc, 0xb9e2, 0xb9e7, 0xb9ed, 0xb9f3, 0xb9f8, 
-    /* 0x0000d500: */ 0xb9fe, 0xba04, 0xba0a, 0xba0f, 0xba15, 0xba1b, 0xba21, 0xba26, 0xba2c, 0xba32, 0xba38, 0xba3d, 0xba43, 0xba49, 0xba4f, 0xba54, 
-    /* 0x0000d520: */ 0xba5a, 0xba60, 0xba66, 0xba6b, 0xba71, 0xba77, 0xba7d, 0xba82, 0xba88, 0xba8e, 0xba94, 0xba99, 0xba9f, 0xbaa5, 0xbaab, 0xbab0, 
-    /* 0x0000d540: */ 0xbab6, 0xbabc, 0xbac2, 0xbac8, 0xbacd, 0xbad3, 0xbad9, 0xbadf, 0xbae4, 0xbaea, 0xbaf0, 0xbaf6, 0xbafb, 0xbb01, 0xbb07, 0xbb0d, 
-    /* 0x0000d560: */ 0xbb13, 0xbb18, 0xbb1e, 0xbb24, 0xbb2a, 0xbb2f, 0xbb35, 0xbb3b, 0xbb41, 0xbb47, 0xbb4c, 0xbb52, 0xbb58, 0xbb5e, 0xbb64, 0xbb69, 
-    /* 0x0000d580: */ 0xbb6f, 0xbb75, 0xbb7b, 0xbb80, 0xbb86, 0xbb8c, 0xbb92, 0xbb98, 0xbb9d, 0xbba3, 0xbba9, 0xbbaf, 0xbbb5, 0xbbba, 0xbbc0, 0xbbc6, 
-    /* 0x0000d5a0: */ 0xbbcc, 0xbbd2, 0xbbd7, 0xbbdd, 0xbbe3, 0xbbe9, 0xbbef, 0xbbf4, 0xbbfa, 0xbc00, 0xbc06, 0xbc0c, 0xbc12, 0xbc17, 0xbc1d, 0xbc23, 
-    /* 0x0000d5c0: */ 0xbc29, 0xbc2f, 0xbc34, 0xbc3a, 0xbc40, 0xbc46, 0xbc4c, 0xbc51, 0xbc57, 0xbc5d, 0xbc63, 0xbc69, 0xbc6f, 0xbc74, 0xbc7a, 0xbc80, 
-    /* 0x0000d5e0: */ 0xbc86, 0xbc8c, 0xbc92, 0xbc97, 0xbc9d, 0xbca3, 0xbca9, 0xbcaf, 0xbcb5, 0xbcba, 0xbcc0, 0xbcc6, 0xbccc, 0xbcd2, 0xbcd8, 0xbcdd, 
-    /* 0x0000d600: */ 0xbce3, 0xbce9, 0xbcef, 0xbcf5, 0xbcfb, 0xbd00, 0xbd06, 0xbd0c, 0xbd12, 0xbd18, 0xbd1e, 0xbd23, 0xbd29, 0xbd2f, 0xbd35, 0xbd3b, 
-    /* 0x0000d620: */ 0xbd41, 0xbd47, 0xbd4c, 0xbd52, 0xbd58, 0xbd5e, 0xbd64, 0xbd6a, 0xbd70, 0xbd75, 0xbd7b, 0xbd81, 0xbd87, 0xbd8d, 0xbd93, 0xbd99, 
-    /* 0x0000d640: */ 0xbd9e, 0xbda4, 0xbdaa, 0xbdb0, 0xbdb6, 0xbdbc, 0xbdc2, 0xbdc7, 0xbdcd, 0xbdd3, 0xbdd9, 0xbddf, 0xbde5, 0xbdeb, 0xbdf1, 0xbdf6, 
-    /* 0x0000d660: */ 0xbdfc, 0xbe02, 0xbe08, 0xbe0e, 0xbe14, 0xbe1a, 0xbe20, 0xbe25, 0xbe2b, 0xbe31, 0xbe37, 0xbe3d, 0xbe43, 0xbe49, 0xbe4f, 0xbe54, 
-    /* 0x0000d680: */ 0xbe5a, 0xbe60, 0xbe66, 0xbe6c, 0xbe72, 0xbe78, 0xbe7e, 0xbe84, 0xbe89, 0xbe8f, 0xbe95, 0xbe9b, 0xbea1, 0xbea7, 0xbead, 0xbeb3, 
-    /* 0x0000d6a0: */ 0xbeb9, 0xbebe, 0xbec4, 0xbeca, 0xbed0, 0xbed6, 0xbedc, 0xbee2, 0xbee8, 0xbeee, 0xbef4, 0xbefa, 0xbeff, 0xbf05, 0xbf0b, 0xbf11, 
-    /* 0x0000d6c0: */ 0xbf17, 0xbf1d, 0xbf23, 0xbf29, 0xbf2f, 0xbf35, 0xbf3b, 0xbf40, 0xbf46, 0xbf4c, 0xbf52, 0xbf58, 0xbf5e, 0xbf64, 0xbf6a, 0xbf70, 
-    /* 0x0000d6e0: */ 0xbf76, 0xbf7c, 0xbf82, 0xbf87, 0xbf8d, 0xbf93, 0xbf99, 0xbf9f, 0xbfa5, 0xbfab, 0xbfb1, 0xbfb7, 0xbfbd, 0xbfc3, 0xbfc9, 0xbfcf, 
-    /* 0x0000d700: */ 0xbfd4, 0xbfda, 0xbfe0, 0xbfe6, 0xbfec, 0xbff2, 0xbff8, 0xbffe, 0xc004, 0xc00a, 0xc010, 0xc016, 0xc01c, 0xc022, 0xc028, 0xc02e, 
-    /* 0x0000d720: */ 0xc033, 0xc039, 0xc03f, 0xc045, 0xc04b, 0xc051, 0xc057, 0xc05d, 0xc063, 0xc069, 0xc06f, 0xc075, 0xc07b, 0xc081, 0xc087, 0xc08d, 
-    /* 0x0000d740: */ 0xc093, 0xc099, 0xc09f, 0xc0a5, 0xc0ab, 0xc0b0, 0xc0b6, 0xc0bc, 0xc0c2, 0xc0c8, 0xc0ce, 0xc0d4, 0xc0da, 0xc0e0, 0xc0e6, 0xc0ec, 
-    /* 0x0000d760: */ 0xc0f2, 0xc0f8, 0xc0fe, 0xc104, 0xc10a, 0xc110, 0xc116, 0xc11c, 0xc122, 0xc128, 0xc12e, 0xc134, 0xc13a, 0xc140, 0xc146, 0xc14c, 
-    /* 0x0000d780: */ 0xc152, 0xc158, 0xc15e, 0xc164, 0xc16a, 0xc16f, 0xc175, 0xc17b, 0xc181, 0xc187, 0xc18d, 0xc193, 0xc199, 0xc19f, 0xc1a5, 0xc1ab, 
-    /* 0x0000d7a0: */ 0xc1b1, 0xc1b7, 0xc1bd, 0xc1c3, 0xc1c9, 0xc1cf, 0xc1d5, 0xc1db, 0xc1e1, 0xc1e7, 0xc1ed, 0xc1f3, 0xc1f9, 0xc1ff, 0xc205, 0xc20b, 
-    /* 0x0000d7c0: */ 0xc211, 0xc217, 0xc21d, 0xc223, 0xc229, 0xc22f, 0xc235, 0xc23b, 0xc241, 0xc247, 0xc24d, 0xc253, 0xc259, 0xc25f, 0xc265, 0xc26b, 
-    /* 0x0000d7e0: */ 0xc271, 0xc277, 0xc27d, 0xc283, 0xc289, 0xc28f, 0xc295, 0xc29b, 0xc2a1, 0xc2a7, 0xc2ad, 0xc2b3, 0xc2b9, 0xc2c0, 0xc2c6, 0xc2cc, 
-    /* 0x0000d800: */ 0xc2d2, 0xc2d8, 0xc2de, 0xc2e4, 0xc2ea, 0xc2f0, 0xc2f6, 0xc2fc, 0xc302, 0xc308, 0xc30e, 0xc314, 0xc31a, 0xc320, 0xc326, 0xc32c, 
-    /* 0x0000d820: */ 0xc332, 0xc338, 0xc33e, 0xc344, 0xc34a, 0xc350, 0xc356, 0xc35c, 0xc362, 0xc368, 0xc36e, 0xc374, 0xc37a, 0xc381, 0xc387, 0xc38d, 
-    /* 0x0000d840: */ 0xc393, 0xc399, 0xc39f, 0xc3a5, 0xc3ab, 0xc3b1, 0xc3b7, 0xc3bd, 0xc3c3, 0xc3c9, 0xc3cf, 0xc3d5, 0xc3db, 0xc3e1, 0xc3e7, 0xc3ed, 
-    /* 0x0000d860: */ 0xc3f3, 0xc3f9, 0xc400, 0xc406, 0xc40c, 0xc412, 0xc418, 0xc41e, 0xc424, 0xc42a, 0xc430, 0xc436, 0xc43c, 0xc442, 0xc448, 0xc44e, 
-    /* 0x0000d880: */ 0xc454, 0xc45a, 0xc461, 0xc467, 0xc46d, 0xc473, 0xc479, 0xc47f, 0xc485, 0xc48b, 0xc491, 0xc497, 0xc49d, 0xc4a3, 0xc4a9, 0xc4af, 
-    /* 0x0000d8a0: */ 0xc4b6, 0xc4bc, 0xc4c2, 0xc4c8, 0xc4ce, 0xc4d4, 0xc4da, 0xc4e0, 0xc4e6, 0xc4ec, 0xc4f2, 0xc4f8, 0xc4fe, 0xc505, 0xc50b, 0xc511, 
-    /* 0x0000d8c0: */ 0xc517, 0xc51d, 0xc523, 0xc529, 0xc52f, 0xc535, 0xc53b, 0xc541, 0xc548, 0xc54e, 0xc554, 0xc55a, 0xc560, 0xc566, 0xc56c, 0xc572, 
-    /* 0x0000d8e0: */ 0xc578, 0xc57e, 0xc584, 0xc58b, 0xc591, 0xc597, 0xc59d, 0xc5a3, 0xc5a9, 0xc5af, 0xc5b5, 0xc5bb, 0xc5c1, 0xc5c8, 0xc5ce, 0xc5d4, 
-    /* 0x0000d900: */ 0xc5da, 0xc5e0, 0xc5e6, 0xc5ec, 0xc5f2, 0xc5f8, 0xc5ff, 0xc605, 0xc60b, 0xc611, 0xc617, 0xc61d, 0xc623, 0xc629, 0xc62f, 0xc636, 
-    /* 0x0000d920: */ 0xc63c, 0xc642, 0xc648, 0xc64e, 0xc654, 0xc65a, 0xc660, 0xc667, 0xc66d, 0xc673, 0xc679, 0xc67f, 0xc685, 0xc68b, 0xc691, 0xc698, 
-    /* 0x0000d940: */ 0xc69e, 0xc6a4, 0xc6aa, 0xc6b0, 0xc6b6, 0xc6bc, 0xc6c2, 0xc6c9, 0xc6cf, 0xc6d5, 0xc6db, 0xc6e1, 0xc6e7, 0xc6ed, 0xc6f4, 0xc6fa, 
-    /* 0x0000d960: */ 0xc700, 0xc706, 0xc70c, 0xc712, 0xc718, 0xc71f, 0xc725, 0xc72b, 0xc731, 0xc737, 0xc73d, 0xc743, 0xc74a, 0xc750, 0xc756, 0xc75c, 
-    /* 0x0000d980: */ 0xc762, 0xc768, 0xc76e, 0xc775, 0xc77b, 0xc781, 0xc787, 0xc78d, 0xc793, 0xc799, 0xc7a0, 0xc7a6, 0xc7ac, 0xc7b2, 0xc7b8, 0xc7be, 
-    /* 0x0000d9a0: */ 0xc7c5, 0xc7cb, 0xc7d1, 0xc7d7, 0xc7dd, 0xc7e3, 0xc7ea, 0xc7f0, 0xc7f6, 0xc7fc, 0xc802, 0xc808, 0xc80f, 0xc815, 0xc81b, 0xc821, 
-    /* 0x0000d9c0: */ 0xc827, 0xc82d, 0xc834, 0xc83a, 0xc840, 0xc846, 0xc84c, 0xc852, 0xc859, 0xc85f, 0xc865, 0xc86b, 0xc871, 0xc877, 0xc87e, 0xc884, 
-    /* 0x0000d9e0: */ 0xc88a, 0xc890, 0xc896, 0xc89d, 0xc8a3, 0xc8a9, 0xc8af, 0xc8b5, 0xc8bb, 0xc8c2, 0xc8c8, 0xc8ce, 0xc8d4, 0xc8da, 0xc8e1, 0xc8e7, 
-    /* 0x0000da00: */ 0xc8ed, 0xc8f3, 0xc8f9, 0xc8ff, 0xc906, 0xc90c, 0xc912, 0xc918, 0xc91e, 0xc925, 0xc92b, 0xc931, 0xc937, 0xc93d, 0xc944, 0xc94a, 
-    /* 0x0000da20: */ 0xc950, 0xc956, 0xc95c, 0xc963, 0xc969, 0xc96f, 0xc975, 0xc97b, 0xc982, 0xc988, 0xc98e, 0xc994, 0xc99a, 0xc9a1, 0xc9a7, 0xc9ad, 
-    /* 0x0000da40: */ 0xc9b3, 0xc9b9, 0xc9c0, 0xc9c6, 0xc9cc, 0xc9d2, 0xc9d9, 0xc9df, 0xc9e5, 0xc9eb, 0xc9f1, 0xc9f8, 0xc9fe, 0xca04, 0xca0a, 0xca10, 
-    /* 0x0000da60: */ 0xca17, 0xca1d, 0xca23, 0xca29, 0xca30, 0xca36, 0xca3c, 0xca42, 0xca48, 0xca4f, 0xca55, 0xca5b, 0xca61, 0xca68, 0xca6e, 0xca74, 
-    /* 0x0000da80: */ 0xca7a, 0xca80, 0xca87, 0xca8d, 0xca93, 0xca99, 0xcaa0, 0xcaa6, 0xcaac, 0xcab2, 0xcab9, 0xcabf, 0xcac5, 0xcacb, 0xcad1, 0xcad8, 
-    /* 0x0000daa0: */ 0xcade, 0xcae4, 0xcaea, 0xcaf1, 0xcaf7, 0xcafd, 0xcb03, 0xcb0a, 0xcb10, 0xcb16, 0xcb1c, 0xcb23, 0xcb29, 0xcb2f, 0xcb35, 0xcb3c, 
-    /* 0x0000dac0: */ 0xcb42, 0xcb48, 0xcb4e, 0xcb55, 0xcb5b, 0xcb61, 0xcb67, 0xcb6e, 0xcb74, 0xcb7a, 0xcb80, 0xcb87, 0xcb8d, 0xcb93, 0xcb99, 0xcba0, 
-    /* 0x0000dae0: */ 0xcba6, 0xcbac, 0xcbb2, 0xcbb9, 0xcbbf, 0xcbc5, 0xcbcb, 0xcbd2, 0xcbd8, 0xcbde, 0xcbe4, 0xcbeb, 0xcbf1, 0xcbf7, 0xcbfd, 0xcc04, 
-    /* 0x0000db00: */ 0xcc0a, 0xcc10, 0xcc17, 0xcc1d, 0xcc23, 0xcc29, 0xcc30, 0xcc36, 0xcc3c, 0xcc42, 0xcc49, 0xcc4f, 0xcc55, 0xcc5c, 0xcc62, 0xcc68, 
-    /* 0x0000db20: */ 0xcc6e, 0xcc75, 0xcc7b, 0xcc81, 0xcc87, 0xcc8e, 0xcc94, 0xcc9a, 0xcca1, 0xcca7, 0xccad, 0xccb3, 0xccba, 0xccc0, 0xccc6, 0xcccd, 
-    /* 0x0000db40: */ 0xccd3, 0xccd9, 0xccdf, 0xcce6, 0xccec, 0xccf2, 0xccf9, 0xccff, 0xcd05, 0xcd0b, 0xcd12, 0xcd18, 0xcd1e, 0xcd25, 0xcd2b, 0xcd31, 
-    /* 0x0000db60: */ 0xcd37, 0xcd3e, 0xcd44, 0xcd4a, 0xcd51, 0xcd57, 0xcd5d, 0xcd63, 0xcd6a, 0xcd70, 0xcd76, 0xcd7d, 0xcd83, 0xcd89, 0xcd90, 0xcd96, 
-    /* 0x0000db80: */ 0xcd9c, 0xcda2, 0xcda9, 0xcdaf, 0xcdb5, 0xcdbc, 0xcdc2, 0xcdc8, 0xcdcf, 0xcdd5, 0xcddb, 0xcde2, 0xcde8, 0xcdee, 0xcdf4, 0xcdfb, 
-    /* 0x0000dba0: */ 0xce01, 0xce07, 0xce0e, 0xce14, 0xce1a, 0xce21, 0xce27, 0xce2d, 0xce34, 0xce3a, 0xce40, 0xce47, 0xce4d, 0xce53, 0xce5a, 0xce60, 
-    /* 0x0000dbc0: */ 0xce66, 0xce6c, 0xce73, 0xce79, 0xce7f, 0xce86, 0xce8c, 0xce92, 0xce99, 0xce9f, 0xcea5, 0xceac, 0xceb2, 0xceb8, 0xcebf, 0xcec5, 
-    /* 0x0000dbe0: */ 0xcecb, 0xced2, 0xced8, 0xcede, 0xcee5, 0xceeb, 0xcef1, 0xcef8, 0xcefe, 0xcf04, 0xcf0b, 0xcf11, 0xcf17, 0xcf1e, 0xcf24, 0xcf2a, 
-    /* 0x0000dc00: */ 0xcf31, 0xcf37, 0xcf3d, 0xcf44, 0xcf4a, 0xcf50, 0xcf57, 0xcf5d, 0xcf63, 0xcf6a, 0xcf70, 0xcf76, 0xcf7d, 0xcf83, 0xcf89, 0xcf90, 
-    /* 0x0000dc20: */ 0xcf96, 0xcf9c, 0xcfa3, 0xcfa9, 0xcfb0, 0xcfb6, 0xcfbc, 0xcfc3, 0xcfc9, 0xcfcf, 0xcfd6, 0xcfdc, 0xcfe2, 0xcfe9, 0xcfef, 0xcff5, 
-    /* 0x0000dc40: */ 0xcffc, 0xd002, 0xd008, 0xd00f, 0xd015, 0xd01c, 0xd022, 0xd028, 0xd02f, 0xd035, 0xd03b, 0xd042, 0xd048, 0xd04e, 0xd055, 0xd05b, 
-    /* 0x0000dc60: */ 0xd062, 0xd068, 0xd06e, 0xd075, 0xd07b, 0xd081, 0xd088, 0xd08e, 0xd094, 0xd09b, 0xd0a1, 0xd0a8, 0xd0ae, 0xd0b4, 0xd0bb, 0xd0c1, 
-    /* 0x0000dc80: */ 0xd0c7, 0xd0ce, 0xd0d4, 0xd0db, 0xd0e1, 0xd0e7, 0xd0ee, 0xd0f4, 0xd0fa, 0xd101, 0xd107, 0xd10e, 0xd114, 0xd11a, 0xd121, 0xd127, 
-    /* 0x0000dca0: */ 0xd12d, 0xd134, 0xd13a, 0xd141, 0xd147, 0xd14d, 0xd154, 0xd15a, 0xd160, 0xd167, 0xd16d, 0xd174, 0xd17a, 0xd180, 0xd187, 0xd18d, 
-    /* 0x0000dcc0: */ 0xd194, 0xd19a, 0xd1a0, 0xd1a7, 0xd1ad, 0xd1b4, 0xd1ba, 0xd1c0, 0xd1c7, 0xd1cd, 0xd1d3, 0xd1da, 0xd1e0, 0xd1e7, 0xd1ed, 0xd1f3, 
-    /* 0x0000dce0: */ 0xd1fa, 0xd200, 0xd207, 0xd20d, 0xd213, 0xd21a, 0xd220, 0xd227, 0xd22d, 0xd233, 0xd23a, 0xd240, 0xd247, 0xd24d, 0xd253, 0xd25a, 
-    /* 0x0000dd00: */ 0xd260, 0xd267, 0xd26d, 0xd274, 0xd27a, 0xd280, 0xd287, 0xd28d, 0xd294, 0xd29a, 0xd2a0, 0xd2a7, 0xd2ad, 0xd2b4, 0xd2ba, 0xd2c0, 
-    /* 0x0000dd20: */ 0xd2c7, 0xd2cd, 0xd2d4, 0xd2da, 0xd2e0, 0xd2e7, 0xd2ed, 0xd2f4, 0xd2fa, 0xd301, 0xd307, 0xd30d, 0xd314, 0xd31a, 0xd321, 0xd327, 
-    /* 0x0000dd40: */ 0xd32e, 0xd334, 0xd33a, 0xd341, 0xd347, 0xd34e, 0xd354, 0xd35a, 0xd361, 0xd367, 0xd36e, 0xd374, 0xd37b, 0xd381, 0xd387, 0xd38e, 
-    /* 0x0000dd60: */ 0xd394, 0xd39b, 0xd3a1, 0xd3a8, 0xd3ae, 0xd3b4, 0xd3bb, 0xd3c1, 0xd3c8, 0xd3ce, 0xd3d5, 0xd3db, 0xd3e2, 0xd3e8, 0xd3ee, 0xd3f5, 
-    /* 0x0000dd80: */ 0xd3fb, 0xd402, 0xd408, 0xd40f, 0xd415, 0xd41b, 0xd422, 0xd428, 0xd42f, 0xd435, 0xd43c, 0xd442, 0xd449, 0xd44f, 0xd455, 0xd45c, 
-    /* 0x0000dda0: */ 0xd462, 0xd469, 0xd46f, 0xd476, 0xd47c, 0xd483, 0xd489, 0xd48f, 0xd496, 0xd49c, 0xd4a3, 0xd4a9, 0xd4b0, 0xd4b6, 0xd4bd, 0xd4c3, 
-    /* 0x0000ddc0: */ 0xd4ca, 0xd4d0, 0xd4d6, 0xd4dd, 0xd4e3, 0xd4ea, 0xd4f0, 0xd4f7, 0xd4fd, 0xd504, 0xd50a, 0xd511, 0xd517, 0xd51d, 0xd524, 0xd52a, 
-    /* 0x0000dde0: */ 0xd531, 0xd537, 0xd53e, 0xd544, 0xd54b, 0xd551, 0xd558, 0xd55e, 0xd565, 0xd56b, 0xd571, 0xd578, 0xd57e, 0xd585, 0xd58b, 0xd592, 
-    /* 0x0000de00: */ 0xd598, 0xd59f, 0xd5a5, 0xd5ac, 0xd5b2, 0xd5b9, 0xd5bf, 0xd5c6, 0xd5cc, 0xd5d3, 0xd5d9, 0xd5df, 0xd5e6, 0xd5ec, 0xd5f3, 0xd5f9, 
-    /* 0x0000de20: */ 0xd600, 0xd606, 0xd60d, 0xd613, 0xd61a, 0xd620, 0xd627, 0xd62d, 0xd634, 0xd63a, 0xd641, 0xd647, 0xd64e, 0xd654, 0xd65b, 0xd661, 
-    /* 0x0000de40: */ 0xd668, 0xd66e, 0xd674, 0xd67b, 0xd681, 0xd688, 0xd68e, 0xd695, 0xd69b, 0xd6a2, 0xd6a8, 0xd6af, 0xd6b5, 0xd6bc, 0xd6c2, 0xd6c9, 
-    /* 0x0000de60: */ 0xd6cf, 0xd6d6, 0xd6dc, 0xd6e3, 0xd6e9, 0xd6f0, 0xd6f6, 0xd6fd, 0xd703, 0xd70a, 0xd710, 0xd717, 0xd71d, 0xd724, 0xd72a, 0xd731, 
-    /* 0x0000de80: */ 0xd737, 0xd73e, 0xd744, 0xd74b, 0xd751, 0xd758, 0xd75e, 0xd765, 0xd76b, 0xd772, 0xd778, 0xd77f, 0xd785, 0xd78c, 0xd792, 0xd799, 
-    /* 0x0000dea0: */ 0xd79f, 0xd7a6, 0xd7ac, 0xd7b3, 0xd7b9, 0xd7c0, 0xd7c6, 0xd7cd, 0xd7d3, 0xd7da, 0xd7e0, 0xd7e7, 0xd7ed, 0xd7f4, 0xd7fa, 0xd801, 
-    /* 0x0000dec0: */ 0xd807, 0xd80e, 0xd814, 0xd81b, 0xd821, 0xd828, 0xd82f, 0xd835, 0xd83c, 0xd842, 0xd849, 0xd84f, 0xd856, 0xd85c, 0xd863, 0xd869, 
-    /* 0x0000dee0: */ 0xd870, 0xd876, 0xd87d, 0xd883, 0xd88a, 0xd890, 0xd897, 0xd89d, 0xd8a4, 0xd8aa, 0xd8b1, 0xd8b7, 0xd8be, 0xd8c4, 0xd8cb, 0xd8d2, 
-    /* 0x0000df00: */ 0xd8d8, 0xd8df, 0xd8e5, 0xd8ec, 0xd8f2, 0xd8f9, 0xd8ff, 0xd906, 0xd90c, 0xd913, 0xd919, 0xd920, 0xd926, 0xd92d, 0xd933, 0xd93a, 
-    /* 0x0000df20: */ 0xd941, 0xd947, 0xd94e, 0xd954, 0xd95b, 0xd961, 0xd968, 0xd96e, 0xd975, 0xd97b, 0xd982, 0xd988, 0xd98f, 0xd996, 0xd99c, 0xd9a3, 
-    /* 0x0000df40: */ 0xd9a9, 0xd9b0, 0xd9b6, 0xd9bd, 0xd9c3, 0xd9ca, 0xd9d0, 0xd9d7, 0xd9dd, 0xd9e4, 0xd9eb, 0xd9f1, 0xd9f8, 0xd9fe, 0xda05, 0xda0b, 
-    /* 0x0000df60: */ 0xda12, 0xda18, 0xda1f, 0xda26, 0xda2c, 0xda33, 0xda39, 0xda40, 0xda46, 0xda4d, 0xda53, 0xda5a, 0xda60, 0xda67, 0xda6e, 0xda74, 
-    /* 0x0000df80: */ 0xda7b, 0xda81, 0xda88, 0xda8e, 0xda95, 0xda9b, 0xdaa2, 0xdaa9, 0xdaaf, 0xdab6, 0xdabc, 0xdac3, 0xdac9, 0xdad0, 0xdad6, 0xdadd, 
-    /* 0x0000dfa0: */ 0xdae4, 0xdaea, 0xdaf1, 0xdaf7, 0xdafe, 0xdb04, 0xdb0b, 0xdb12, 0xdb18, 0xdb1f, 0xdb25, 0xdb2c, 0xdb32, 0xdb39, 0xdb40, 0xdb46, 
-    /* 0x0000dfc0: */ 0xdb4d, 0xdb53, 0xdb5a, 0xdb60, 0xdb67, 0xdb6d, 0xdb74, 0xdb7b, 0xdb81, 0xdb88, 0xdb8e, 0xdb95, 0xdb9b, 0xdba2, 0xdba9, 0xdbaf, 
-    /* 0x0000dfe0: */ 0xdbb6, 0xdbbc, 0xdbc3, 0xdbca, 0xdbd0, 0xdbd7, 0xdbdd, 0xdbe4, 0xdbea, 0xdbf1, 0xdbf8, 0xdbfe, 0xdc05, 0xdc0b, 0xdc12, 0xdc18, 
-    /* 0x0000e000: */ 0xdc1f, 0xdc26, 0xdc2c, 0xdc33, 0xdc39, 0xdc40, 0xdc47, 0xdc4d, 0xdc54, 0xdc5a, 0xdc61, 0xdc67, 0xdc6e, 0xdc75, 0xdc7b, 0xdc82, 
-    /* 0x0000e020: */ 0xdc88, 0xdc8f, 0xdc96, 0xdc9c, 0xdca3, 0xdca9, 0xdcb0, 0xdcb6, 0xdcbd, 0xdcc4, 0xdcca, 0xdcd1, 0xdcd7, 0xdcde, 0xdce5, 0xdceb, 
-    /* 0x0000e040: */ 0xdcf2, 0xdcf8, 0xdcff, 0xdd06, 0xdd0c, 0xdd13, 0xdd19, 0xdd20, 0xdd27, 0xdd2d, 0xdd34, 0xdd3a, 0xdd41, 0xdd48, 0xdd4e, 0xdd55, 
-    /* 0x0000e060: */ 0xdd5b, 0xdd62, 0xdd69, 0xdd6f, 0xdd76, 0xdd7c, 0xdd83, 0xdd8a, 0xdd90, 0xdd97, 0xdd9d, 0xdda4, 0xddab, 0xddb1, 0xddb8, 0xddbe, 
-    /* 0x0000e080: */ 0xddc5, 0xddcc, 0xddd2, 0xddd9, 0xdddf, 0xdde6, 0xdded, 0xddf3, 0xddfa, 0xde00, 0xde07, 0xde0e, 0xde14, 0xde1b, 0xde22, 0xde28, 
-    /* 0x0000e0a0: */ 0xde2f, 0xde35, 0xde3c, 0xde43, 0xde49, 0xde50, 0xde56, 0xde5d, 0xde64, 0xde6a, 0xde71, 0xde78, 0xde7e, 0xde85, 0xde8b, 0xde92, 
-    /* 0x0000e0c0: */ 0xde99, 0xde9f, 0xdea6, 0xdeac, 0xdeb3, 0xdeba, 0xdec0, 0xdec7, 0xdece, 0xded4, 0xdedb, 0xdee1, 0xdee8, 0xdeef, 0xdef5, 0xdefc, 
-    /* 0x0000e0e0: */ 0xdf03, 0xdf09, 0xdf10, 0xdf16, 0xdf1d, 0xdf24, 0xdf2a, 0xdf31, 0xdf38, 0xdf3e, 0xdf45, 0xdf4b, 0xdf52, 0xdf59, 0xdf5f, 0xdf66, 
-    /* 0x0000e100: */ 0xdf6d, 0xdf73, 0xdf7a, 0xdf80, 0xdf87, 0xdf8e, 0xdf94, 0xdf9b, 0xdfa2, 0xdfa8, 0xdfaf, 0xdfb6, 0xdfbc, 0xdfc3, 0xdfc9, 0xdfd0, 
-    /* 0x0000e120: */ 0xdfd7, 0xdfdd, 0xdfe4, 0xdfeb, 0xdff1, 0xdff8, 0xdfff, 0xe005, 0xe00c, 0xe012, 0xe019, 0xe020, 0xe026, 0xe02d, 0xe034, 0xe03a, 
-    /* 0x0000e140: */ 0xe041, 0xe048, 0xe04e, 0xe055, 0xe05b, 0xe062, 0xe069, 0xe06f, 0xe076, 0xe07d, 0xe083, 0xe08a, 0xe091, 0xe097, 0xe09e, 0xe0a5, 
-    /* 0x0000e160: */ 0xe0ab, 0xe0b2, 0xe0b9, 0xe0bf, 0xe0c6, 0xe0cc, 0xe0d3, 0xe0da, 0xe0e0, 0xe0e7, 0xe0ee, 0xe0f4, 0xe0fb, 0xe102, 0xe108, 0xe10f, 
-    /* 0x0000e180: */ 0xe116, 0xe11c, 0xe123, 0xe12a, 0xe130, 0xe137, 0xe13e, 0xe144, 0xe14b, 0xe152, 0xe158, 0xe15f, 0xe166, 0xe16c, 0xe173, 0xe179, 
-    /* 0x0000e1a0: */ 0xe180, 0xe187, 0xe18d, 0xe194, 0xe19b, 0xe1a1, 0xe1a8, 0xe1af, 0xe1b5, 0xe1bc, 0xe1c3, 0xe1c9, 0xe1d0, 0xe1d7, 0xe1dd, 0xe1e4, 
-    /* 0x0000e1c0: */ 0xe1eb, 0xe1f1, 0xe1f8, 0xe1ff, 0xe205, 0xe20c, 0xe213, 0xe219, 0xe220, 0xe227, 0xe22d, 0xe234, 0xe23b, 0xe241, 0xe248, 0xe24f, 
-    /* 0x0000e1e0: */ 0xe255, 0xe25c, 0xe263, 0xe269, 0xe270, 0xe277, 0xe27d, 0xe284, 0xe28b, 0xe291, 0xe298, 0xe29f, 0xe2a5, 0xe2ac, 0xe2b3, 0xe2b9, 
-    /* 0x0000e200: */ 0xe2c0, 0xe2c7, 0xe2cd, 0xe2d4, 0xe2db, 0xe2e1, 0xe2e8, 0xe2ef, 0xe2f6, 0xe2fc, 0xe303, 0xe30a, 0xe310, 0xe317, 0xe31e, 0xe324, 
-    /* 0x0000e220: */ 0xe32b, 0xe332, 0xe338, 0xe33f, 0xe346, 0xe34c, 0xe353, 0xe35a, 0xe360, 0xe367, 0xe36e, 0xe374, 0xe37b, 0xe382, 0xe388, 0xe38f, 
-    /* 0x0000e240: */ 0xe396, 0xe39d, 0xe3a3, 0xe3aa, 0xe3b1, 0xe3b7, 0xe3be, 0xe3c5, 0xe3cb, 0xe3d2, 0xe3d9, 0xe3df, 0xe3e6, 0xe3ed, 0xe3f3, 0xe3fa, 
-    /* 0x0000e260: */ 0xe401, 0xe408, 0xe40e, 0xe415, 0xe41c, 0xe422, 0xe429, 0xe430, 0xe436, 0xe43d, 0xe444, 0xe44a, 0xe451, 0xe458, 0xe45f, 0xe465, 
-    /* 0x0000e280: */ 0xe46c, 0xe473, 0xe479, 0xe480, 0xe487, 0xe48d, 0xe494, 0xe49b, 0xe4a2, 0xe4a8, 0xe4af, 0xe4b6, 0xe4bc, 0xe4c3, 0xe4ca, 0xe4d0, 
-    /* 0x0000e2a0: */ 0xe4d7, 0xe4de, 0xe4e4, 0xe4eb, 0xe4f2, 0xe4f9, 0xe4ff, 0xe506, 0xe50d, 0xe513, 0xe51a, 0xe521, 0xe528, 0xe52e, 0xe535, 0xe53c, 
-    /* 0x0000e2c0: */ 0xe542, 0xe549, 0xe550, 0xe556, 0xe55d, 0xe564, 0xe56b, 0xe571, 0xe578, 0xe57f, 0xe585, 0xe58c, 0xe593, 0xe59a, 0xe5a0, 0xe5a7, 
-    /* 0x0000e2e0: */ 0xe5ae, 0xe5b4, 0xe5bb, 0xe5c2, 0xe5c8, 0xe5cf, 0xe5d6, 0xe5dd, 0xe5e3, 0xe5ea, 0xe5f1, 0xe5f7, 0xe5fe, 0xe605, 0xe60c, 0xe612, 
-    /* 0x0000e300: */ 0xe619, 0xe620, 0xe626, 0xe62d, 0xe634, 0xe63b, 0xe641, 0xe648, 0xe64f, 0xe655, 0xe65c, 0xe663, 0xe66a, 0xe670, 0xe677, 0xe67e, 
-    /* 0x0000e320: */ 0xe684, 0xe68b, 0xe692, 0xe699, 0xe69f, 0xe6a6, 0xe6ad, 0xe6b4, 0xe6ba, 0xe6c1, 0xe6c8, 0xe6ce, 0xe6d5, 0xe6dc, 0xe6e3, 0xe6e9, 
-    /* 0x0000e340: */ 0xe6f0, 0xe6f7, 0xe6fd, 0xe704, 0xe70b, 0xe712, 0xe718, 0xe71f, 0xe726, 0xe72d, 0xe733, 0xe73a, 0xe741, 0xe747, 0xe74e, 0xe755, 
-    /* 0x0000e360: */ 0xe75c, 0xe762, 0xe769, 0xe770, 0xe777, 0xe77d, 0xe784, 0xe78b, 0xe791, 0xe798, 0xe79f, 0xe7a6, 0xe7ac, 0xe7b3, 0xe7ba, 0xe7c1, 
-    /* 0x0000e380: */ 0xe7c7, 0xe7ce, 0xe7d5, 0xe7dc, 0xe7e2, 0xe7e9, 0xe7f0, 0xe7f6, 0xe7fd, 0xe804, 0xe80b, 0xe811, 0xe818, 0xe81f, 0xe826, 0xe82c, 
-    /* 0x0000e3a0: */ 0xe833, 0xe83a, 0xe841, 0xe847, 0xe84e, 0xe855, 0xe85b, 0xe862, 0xe869, 0xe870, 0xe876, 0xe87d, 0xe884, 0xe88b, 0xe891, 0xe898, 
-    /* 0x0000e3c0: */ 0xe89f, 0xe8a6, 0xe8ac, 0xe8b3, 0xe8ba, 0xe8c1, 0xe8c7, 0xe8ce, 0xe8d5, 0xe8dc, 0xe8e2, 0xe8e9, 0xe8f0, 0xe8f7, 0xe8fd, 0xe904, 
-    /* 0x0000e3e0: */ 0xe90b, 0xe911, 0xe918, 0xe91f, 0xe926, 0xe92c, 0xe933, 0xe93a, 0xe941, 0xe947, 0xe94e, 0xe955, 0xe95c, 0xe962, 0xe969, 0xe970, 
-    /* 0x0000e400: */ 0xe977, 0xe97d, 0xe984, 0xe98b, 0xe992, 0xe998, 0xe99f, 0xe9a6, 0xe9ad, 0xe9b3, 0xe9ba, 0xe9c1, 0xe9c8, 0xe9ce, 0xe9d5, 0xe9dc, 
-    /* 0x0000e420: */ 0xe9e3, 0xe9e9, 0xe9f0, 0xe9f7, 0xe9fe, 0xea04, 0xea0b, 0xea12, 0xea19, 0xea1f, 0xea26, 0xea2d, 0xea34, 0xea3b, 0xea41, 0xea48, 
-    /* 0x0000e440: */ 0xea4f, 0xea56, 0xea5c, 0xea63, 0xea6a, 0xea71, 0xea77, 0xea7e, 0xea85, 0xea8c, 0xea92, 0xea99, 0xeaa0, 0xeaa7, 0xeaad, 0xeab4, 
-    /* 0x0000e460: */ 0xeabb, 0xeac2, 0xeac8, 0xeacf, 0xead6, 0xeadd, 0xeae3, 0xeaea, 0xeaf1, 0xeaf8, 0xeaff, 0xeb05, 0xeb0c, 0xeb13, 0xeb1a, 0xeb20, 
-    /* 0x0000e480: */ 0xeb27, 0xeb2e, 0xeb35, 0xeb3b, 0xeb42, 0xeb49, 0xeb50, 0xeb56, 0xeb5d, 0xeb64, 0xeb6b, 0xeb72, 0xeb78, 0xeb7f, 0xeb86, 0xeb8d, 
-    /* 0x0000e4a0: */ 0xeb93, 0xeb9a, 0xeba1, 0xeba8, 0xebae, 0xebb5, 0xebbc, 0xebc3, 0xebca, 0xebd0, 0xebd7, 0xebde, 0xebe5, 0xebeb, 0xebf2, 0xebf9, 
-    /* 0x0000e4c0: */ 0xec00, 0xec06, 0xec0d, 0xec14, 0xec1b, 0xec22, 0xec28, 0xec2f, 0xec36, 0xec3d, 0xec43, 0xec4a, 0xec51, 0xec58, 0xec5f, 0xec65, 
-    /* 0x0000e4e0: */ 0xec6c, 0xec73, 0xec7a, 0xec80, 0xec87, 0xec8e, 0xec95, 0xec9b, 0xeca2, 0xeca9, 0xecb0, 0xecb7, 0xecbd, 0xecc4, 0xeccb, 0xecd2, 
-    /* 0x0000e500: */ 0xecd8, 0xecdf, 0xece6, 0xeced, 0xecf4, 0xecfa, 0xed01, 0xed08, 0xed0f, 0xed16, 0xed1c, 0xed23, 0xed2a, 0xed31, 0xed37, 0xed3e, 
-    /* 0x0000e520: */ 0xed45, 0xed4c, 0xed53, 0xed59, 0xed60, 0xed67, 0xed6e, 0xed74, 0xed7b, 0xed82, 0xed89, 0xed90, 0xed96, 0xed9d, 0xeda4, 0xedab, 
-    /* 0x0000e540: */ 0xedb2, 0xedb8, 0xedbf, 0xedc6, 0xedcd, 0xedd3, 0xedda, 0xede1, 0xede8, 0xedef, 0xedf5, 0xedfc, 0xee03, 0xee0a, 0xee11, 0xee17, 
-    /* 0x0000e560: */ 0xee1e, 0xee25, 0xee2c, 0xee32, 0xee39, 0xee40, 0xee47, 0xee4e, 0xee54, 0xee5b, 0xee62, 0xee69, 0xee70, 0xee76, 0xee7d, 0xee84, 
-    /* 0x0000e580: */ 0xee8b, 0xee92, 0xee98, 0xee9f, 0xeea6, 0xeead, 0xeeb4, 0xeeba, 0xeec1, 0xeec8, 0xeecf, 0xeed5, 0xeedc, 0xeee3, 0xeeea, 0xeef1, 
-    /* 0x0000e5a0: */ 0xeef7, 0xeefe, 0xef05, 0xef0c, 0xef13, 0xef19, 0xef20, 0xef27, 0xef2e, 0xef35, 0xef3b, 0xef42, 0xef49, 0xef50, 0xef57, 0xef5d, 
-    /* 0x0000e5c0: */ 0xef64, 0xef6b, 0xef72, 0xef79, 0xef7f, 0xef86, 0xef8d, 0xef94, 0xef9b, 0xefa1, 0xefa8, 0xefaf, 0xefb6, 0xefbd, 0xefc3, 0xefca, 
-    /* 0x0000e5e0: */ 0xefd1, 0xefd8, 0xefdf, 0xefe5, 0xefec, 0xeff3, 0xeffa, 0xf001, 0xf007, 0xf00e, 0xf015, 0xf01c, 0xf023, 0xf029, 0xf030, 0xf037, 
-    /* 0x0000e600: */ 0xf03e, 0xf045, 0xf04b, 0xf052, 0xf059, 0xf060, 0xf067, 0xf06d, 0xf074, 0xf07b, 0xf082, 0xf089, 0xf08f, 0xf096, 0xf09d, 0xf0a4, 
-    /* 0x0000e620: */ 0xf0ab, 0xf0b2, 0xf0b8, 0xf0bf, 0xf0c6, 0xf0cd, 0xf0d4, 0xf0da, 0xf0e1, 0xf0e8, 0xf0ef, 0xf0f6, 0xf0fc, 0xf103, 0xf10a, 0xf111, 
-    /* 0x0000e640: */ 0xf118, 0xf11e, 0xf125, 0xf12c, 0xf133, 0xf13a, 0xf140, 0xf147, 0xf14e, 0xf155, 0xf15c, 0xf163, 0xf169, 0xf170, 0xf177, 0xf17e, 
-    /* 0x0000e660: */ 0xf185, 0xf18b, 0xf192, 0xf199, 0xf1a0, 0xf1a7, 0xf1ad, 0xf1b4, 0xf1bb, 0xf1c2, 0xf1c9, 0xf1d0, 0xf1d6, 0xf1dd, 0xf1e4, 0xf1eb, 
-    /* 0x0000e680: */ 0xf1f2, 0xf1f8, 0xf1ff, 0xf206, 0xf20d, 0xf214, 0xf21a, 0xf221, 0xf228, 0xf22f, 0xf236, 0xf23d, 0xf243, 0xf24a, 0xf251, 0xf258, 
-    /* 0x0000e6a0: */ 0xf25f, 0xf265, 0xf26c, 0xf273, 0xf27a, 0xf281, 0xf288, 0xf28e, 0xf295, 0xf29c, 0xf2a3, 0xf2aa, 0xf2b0, 0xf2b7, 0xf2be, 0xf2c5, 
-    /* 0x0000e6c0: */ 0xf2cc, 0xf2d3, 0xf2d9, 0xf2e0, 0xf2e7, 0xf2ee, 0xf2f5, 0xf2fb, 0xf302, 0xf309, 0xf310, 0xf317, 0xf31e, 0xf324, 0xf32b, 0xf332, 
-    /* 0x0000e6e0: */ 0xf339, 0xf340, 0xf347, 0xf34d, 0xf354, 0xf35b, 0xf362, 0xf369, 0xf36f, 0xf376, 0xf37d, 0xf384, 0xf38b, 0xf392, 0xf398, 0xf39f, 
-    /* 0x0000e700: */ 0xf3a6, 0xf3ad, 0xf3b4, 0xf3bb, 0xf3c1, 0xf3c8, 0xf3cf, 0xf3d6, 0xf3dd, 0xf3e3, 0xf3ea, 0xf3f1, 0xf3f8, 0xf3ff, 0xf406, 0xf40c, 
-    /* 0x0000e720: */ 0xf413, 0xf41a, 0xf421, 0xf428, 0xf42f, 0xf435, 0xf43c, 0xf443, 0xf44a, 0xf451, 0xf457, 0xf45e, 0xf465, 0xf46c, 0xf473, 0xf47a, 
-    /* 0x0000e740: */ 0xf480, 0xf487, 0xf48e, 0xf495, 0xf49c, 0xf4a3, 0xf4a9, 0xf4b0, 0xf4b7, 0xf4be, 0xf4c5, 0xf4cc, 0xf4d2, 0xf4d9, 0xf4e0, 0xf4e7, 
-    /* 0x0000e760: */ 0xf4ee, 0xf4f5, 0xf4fb, 0xf502, 0xf509, 0xf510, 0xf517, 0xf51e, 0xf524, 0xf52b, 0xf532, 0xf539, 0xf540, 0xf547, 0xf54d, 0xf554, 
-    /* 0x0000e780: */ 0xf55b, 0xf562, 0xf569, 0xf570, 0xf576, 0xf57d, 0xf584, 0xf58b, 0xf592, 0xf599, 0xf59f, 0xf5a6, 0xf5ad, 0xf5b4, 0xf5bb, 0xf5c2, 
-    /* 0x0000e7a0: */ 0xf5c8, 0xf5cf, 0xf5d6, 0xf5dd, 0xf5e4, 0xf5eb, 0xf5f1, 0xf5f8, 0xf5ff, 0xf606, 0xf60d, 0xf614, 0xf61a, 0xf621, 0xf628, 0xf62f, 
-    /* 0x0000e7c0: */ 0xf636, 0xf63d, 0xf643, 0xf64a, 0xf651, 0xf658, 0xf65f, 0xf666, 0xf66c, 0xf673, 0xf67a, 0xf681, 0xf688, 0xf68f, 0xf695, 0xf69c, 
-    /* 0x0000e7e0: */ 0xf6a3, 0xf6aa, 0xf6b1, 0xf6b8, 0xf6be, 0xf6c5, 0xf6cc, 0xf6d3, 0xf6da, 0xf6e1, 0xf6e7, 0xf6ee, 0xf6f5, 0xf6fc, 0xf703, 0xf70a, 
-    /* 0x0000e800: */ 0xf711, 0xf717, 0xf71e, 0xf725, 0xf72c, 0xf733, 0xf73a, 0xf740, 0xf747, 0xf74e, 0xf755, 0xf75c, 0xf763, 0xf769, 0xf770, 0xf777, 
-    /* 0x0000e820: */ 0xf77e, 0xf785, 0xf78c, 0xf792, 0xf799, 0xf7a0, 0xf7a7, 0xf7ae, 0xf7b5, 0xf7bc, 0xf7c2, 0xf7c9, 0xf7d0, 0xf7d7, 0xf7de, 0xf7e5, 
-    /* 0x0000e840: */ 0xf7eb, 0xf7f2, 0xf7f9, 0xf800, 0xf807, 0xf80e, 0xf814, 0xf81b, 0xf822, 0xf829, 0xf830, 0xf837, 0xf83e, 0xf844, 0xf84b, 0xf852, 
-    /* 0x0000e860: */ 0xf859, 0xf860, 0xf867, 0xf86d, 0xf874, 0xf87b, 0xf882, 0xf889, 0xf890, 0xf896, 0xf89d, 0xf8a4, 0xf8ab, 0xf8b2, 0xf8b9, 0xf8c0, 
-    /* 0x0000e880: */ 0xf8c6, 0xf8cd, 0xf8d4, 0xf8db, 0xf8e2, 0xf8e9, 0xf8ef, 0xf8f6, 0xf8fd, 0xf904, 0xf90b, 0xf912, 0xf919, 0xf91f, 0xf926, 0xf92d, 
-    /* 0x0000e8a0: */ 0xf934, 0xf93b, 0xf942, 0xf948, 0xf94f, 0xf956, 0xf95d, 0xf964, 0xf96b, 0xf972, 0xf978, 0xf97f, 0xf986, 0xf98d, 0xf994, 0xf99b, 
-    /* 0x0000e8c0: */ 0xf9a1, 0xf9a8, 0xf9af, 0xf9b6, 0xf9bd, 0xf9c4, 0xf9cb, 0xf9d1, 0xf9d8, 0xf9df, 0xf9e6, 0xf9ed, 0xf9f4, 0xf9fb, 0xfa01, 0xfa08, 
-    /* 0x0000e8e0: */ 0xfa0f, 0xfa16, 0xfa1d, 0xfa24, 0xfa2a, 0xfa31, 0xfa38, 0xfa3f, 0xfa46, 0xfa4d, 0xfa54, 0xfa5a, 0xfa61, 0xfa68, 0xfa6f, 0xfa76, 
-    /* 0x0000e900: */ 0xfa7d, 0xfa83, 0xfa8a, 0xfa91, 0xfa98, 0xfa9f, 0xfaa6, 0xfaad, 0xfab3, 0xfaba, 0xfac1, 0xfac8, 0xfacf, 0xfad6, 0xfadd, 0xfae3, 
-    /* 0x0000e920: */ 0xfaea, 0xfaf1, 0xfaf8, 0xfaff, 0xfb06, 0xfb0c, 0xfb13, 0xfb1a, 0xfb21, 0xfb28, 0xfb2f, 0xfb36, 0xfb3c, 0xfb43, 0xfb4a, 0xfb51, 
-    /* 0x0000e940: */ 0xfb58, 0xfb5f, 0xfb66, 0xfb6c, 0xfb73, 0xfb7a, 0xfb81, 0xfb88, 0xfb8f, 0xfb96, 0xfb9c, 0xfba3, 0xfbaa, 0xfbb1, 0xfbb8, 0xfbbf, 
-    /* 0x0000e960: */ 0xfbc5, 0xfbcc, 0xfbd3, 0xfbda, 0xfbe1, 0xfbe8, 0xfbef, 0xfbf5, 0xfbfc, 0xfc03, 0xfc0a, 0xfc11, 0xfc18, 0xfc1f, 0xfc25, 0xfc2c, 
-    /* 0x0000e980: */ 0xfc33, 0xfc3a, 0xfc41, 0xfc48, 0xfc4f, 0xfc55, 0xfc5c, 0xfc63, 0xfc6a, 0xfc71, 0xfc78, 0xfc7e, 0xfc85, 0xfc8c, 0xfc93, 0xfc9a, 
-    /* 0x0000e9a0: */ 0xfca1, 0xfca8, 0xfcae, 0xfcb5, 0xfcbc, 0xfcc3, 0xfcca, 0xfcd1, 0xfcd8, 0xfcde, 0xfce5, 0xfcec, 0xfcf3, 0xfcfa, 0xfd01, 0xfd08, 
-    /* 0x0000e9c0: */ 0xfd0e, 0xfd15, 0xfd1c, 0xfd23, 0xfd2a, 0xfd31, 0xfd38, 0xfd3e, 0xfd45, 0xfd4c, 0xfd53, 0xfd5a, 0xfd61, 0xfd68, 0xfd6e, 0xfd75, 
-    /* 0x0000e9e0: */ 0xfd7c, 0xfd83, 0xfd8a, 0xfd91, 0xfd98, 0xfd9e, 0xfda5, 0xfdac, 0xfdb3, 0xfdba, 0xfdc1, 0xfdc7, 0xfdce, 0xfdd5, 0xfddc, 0xfde3, 
-    /* 0x0000ea00: */ 0xfdea, 0xfdf1, 0xfdf7, 0xfdfe, 0xfe05, 0xfe0c, 0xfe13, 0xfe1a, 0xfe21, 0xfe27, 0xfe2e, 0xfe35, 0xfe3c, 0xfe43, 0xfe4a, 0xfe51, 
-    /* 0x0000ea20: */ 0xfe57, 0xfe5e, 0xfe65, 0xfe6c, 0xfe73, 0xfe7a, 0xfe81, 0xfe87, 0xfe8e, 0xfe95, 0xfe9c, 0xfea3, 0xfeaa, 0xfeb1, 0xfeb7, 0xfebe, 
-    /* 0x0000ea40: */ 0xfec5, 0xfecc, 0xfed3, 0xfeda, 0xfee1, 0xfee7, 0xfeee, 0xfef5, 0xfefc, 0xff03, 0xff0a, 0xff11, 0xff17, 0xff1e, 0xff25, 0xff2c, 
-    /* 0x0000ea60: */ 0xff33, 0xff3a, 0xff41, 0xff47, 0xff4e, 0xff55, 0xff5c, 0xff63, 0xff6a, 0xff71, 0xff77, 0xff7e, 0xff85, 0xff8c, 0xff93, 0xff9a, 
-    /* 0x0000ea80: */ 0xffa1, 0xffa7, 0xffae, 0xffb5, 0xffbc, 0xffc3, 0xffca, 0xffd1, 0xffd7, 0xffde, 0xffe5, 0xffec, 0xfff3, 0xfffa, 
+    /* 0x00000000: */ 0x0000, 0x00c9, 0x0192, 0x025b, 0x0324, 0x03ed, 0x04b6, 0x057f, 0x0648, 0x0711, 0x07d9, 0x08a2, 0x096a, 0x0a33, 0x0afb, 0x0bc4, 
+    /* 0x00000020: */ 0x0c8c, 0x0d54, 0x0e1c, 0x0ee3, 0x0fab, 0x1072, 0x113a, 0x1201, 0x12c8, 0x138f, 0x1455, 0x151c, 0x15e2, 0x16a8, 0x176e, 0x1833, 
+    /* 0x00000040: */ 0x18f9, 0x19be, 0x1a82, 0x1b47, 0x1c0b, 0x1ccf, 0x1d93, 0x1e57, 0x1f1a, 0x1fdd, 0x209f, 0x2161, 0x2223, 0x22e5, 0x23a6, 0x2467, 
+    /* 0x00000060: */ 0x2528, 0x25e8, 0x26a8, 0x2767, 0x2826, 0x28e5, 0x29a3, 0x2a61, 0x2b1f, 0x2bdc, 0x2c99, 0x2d55, 0x2e11, 0x2ecc, 0x2f87, 0x3041, 
+    /* 0x00000080: */ 0x30fb, 0x31b5, 0x326e, 0x3326, 0x33df, 0x3496, 0x354d, 0x3604, 0x36ba, 0x376f, 0x3824, 0x38d9, 0x398c, 0x3a40, 0x3af2, 0x3ba5, 
+    /* 0x000000a0: */ 0x3c56, 0x3d07, 0x3db8, 0x3e68, 0x3f17, 0x3fc5, 0x4073, 0x4121, 0x41ce, 0x427a, 0x4325, 0x43d0, 0x447a, 0x4524, 0x45cd, 0x4675, 
+    /* 0x000000c0: */ 0x471c, 0x47c3, 0x4869, 0x490f, 0x49b4, 0x4a58, 0x4afb, 0x4b9d, 0x4c3f, 0x4ce0, 0x4d81, 0x4e20, 0x4ebf, 0x4f5d, 0x4ffb, 0x5097, 
+    /* 0x000000e0: */ 0x5133, 0x51ce, 0x5268, 0x5302, 0x539b, 0x5432, 0x54c9, 0x5560, 0x55f5, 0x568a, 0x571d, 0x57b0, 0x5842, 0x58d3, 0x5964, 0x59f3, 
+    /* 0x00000100: */ 0x5a82, 0x5b0f, 0x5b9c, 0x5c28, 0x5cb3, 0x5d3e, 0x5dc7, 0x5e4f, 0x5ed7, 0x5f5d, 0x5fe3, 0x6068, 0x60eb, 0x616e, 0x61f0, 0x6271, 
+    /* 0x00000120: */ 0x62f1, 0x6370, 0x63ee, 0x646c, 0x64e8, 0x6563, 0x65dd, 0x6656, 0x66cf, 0x6746, 0x67bc, 0x6832, 0x68a6, 0x6919, 0x698b, 0x69fd, 
+    /* 0x00000140: */ 0x6a6d, 0x6adc, 0x6b4a, 0x6bb7, 0x6c23, 0x6c8e, 0x6cf8, 0x6d61, 0x6dc9, 0x6e30, 0x6e96, 0x6efb, 0x6f5e, 0x6fc1, 0x7022, 0x7083, 
+    /* 0x00000160: */ 0x70e2, 0x7140, 0x719d, 0x71f9, 0x7254, 0x72ae, 0x7307, 0x735e, 0x73b5, 0x740a, 0x745f, 0x74b2, 0x7504, 0x7555, 0x75a5, 0x75f3, 
+    /* 0x00000180: */ 0x7641, 0x768d, 0x76d8, 0x7722, 0x776b, 0x77b3, 0x77fa, 0x783f, 0x7884, 0x78c7, 0x7909, 0x794a, 0x7989, 0x79c8, 0x7a05, 0x7a41, 
+    /* 0x000001a0: */ 0x7a7c, 0x7ab6, 0x7aee, 0x7b26, 0x7b5c, 0x7b91, 0x7bc5, 0x7bf8, 0x7c29, 0x7c59, 0x7c88, 0x7cb6, 0x7ce3, 0x7d0e, 0x7d39, 0x7d62, 
+    /* 0x000001c0: */ 0x7d89, 0x7db0, 0x7dd5, 0x7dfa, 0x7e1d, 0x7e3e, 0x7e5f, 0x7e7e, 0x7e9c, 0x7eb9, 0x7ed5, 0x7eef, 0x7f09, 0x7f21, 0x7f37, 0x7f4d, 
+    /* 0x000001e0: */ 0x7f61, 0x7f74, 0x7f86, 0x7f97, 0x7fa6, 0x7fb4, 0x7fc1, 0x7fcd, 0x7fd8, 0x7fe1, 0x7fe9, 0x7ff0, 0x7ff5, 0x7ff9, 0x7ffd, 0x7ffe, 
+    /* 0x00000200: */ 0x7fff, 
 };
@@ -0,0 +1,65 @@
+#include <string.h>
+#include <stdatomic.h>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include "telemetry.h"
+
+/* Tries before a reader sleeps one tick, it can only keep failing while the producer is preempted mid-write */
+#define TELEMETRY_READ_RETRIES          (8)
+
+static atomic_uint telemetry_sequence = 0;
+static telemetry_t telemetry_data = {
+    .pressure = 101325.0f,
+    .temperature = 25.0f,
+};
+static atomic_uint telemetry_humidity = 0;
+
+void telemetry_publish(const telemetry_t * telemetry) {
+    unsigned int sequence = atomic_load_explicit(&telemetry_sequence, memory_order_relaxed);
+
+    atomic_store_explicit(&telemetry_sequence, sequence + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+
+    telemetry_data.altitude = telemetry->altitude;
+    telemetry_data.speed = telemetry->speed;
+    telemetry_data.pressure = telemetry->pressure;
+    telemetry_data.temperature = telemetry->temperature;
+    telemetry_data.heading = telemetry->heading;
+    telemetry_data.roll = telemetry->roll;
+    telemetry_data.pitch = telemetry->pitch;
+    telemetry_data.sequence = (sequence + 2) / 2;
+
+    atomic_store_explicit(&telemetry_sequence, sequence + 2, memory_order_release);
+}
+
+void telemetry_publish_humidity(float humidity) {
+    uint32_t word;
+    memcpy(&word, &humidity, sizeof(word));
+    atomic_store_explicit(&telemetry_humidity, word, memory_order_relaxed);
+}
+
+void telemetry_read(telemetry_t * telemetry) {
+    for (int retries = 0; ; retries++) {
+        if (retries >= TELEMETRY_READ_RETRIES) {
+            vTaskDelay(1);
+            retries = 0;
+        }
+
+        unsigned int sequence = atomic_load_explicit(&telemetry_sequence, memory_order_acquire);
+        if (sequence & 1) {
+            continue;
+        }
+
+        *telemetry = telemetry_data;
+        atomic_thread_fence(memory_order_acquire);
+
+        if (sequence == atomic_load_explicit(&telemetry_sequence, memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    uint32_t word = atomic_load_explicit(&telemetry_humidity, memory_order_relaxed);
+    memcpy(&(telemetry->humidity), &word, sizeof(word));
+}
@@ -1,24 +1,34 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "freertos/semphr.h"
+#include "freertos/queue.h"
 
 #include "core2forAWS.h"
 #include "bluetooth.h"
 #include "speaker.h"
 #include "qmp6988.h"
 #include "sht3x.h"
-#include "sin_table.h"
 #include "vario.h"
+#include "vario_signal.h"
+#include "vario_sample.h"
+#include "ahrs.h"
+#include "vario_synth.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_err.h"
 #include "screen.h"
-#include "fir_filter.h"
+#include "kalman_filter.h"
 #include "config.h"
 #include "dps310.h"
 #include "qmc5883l.h"
+#include "mpu6886.h"
+#include "telemetry.h"
+#include "history.h"
+#include "boot.h"
 
 #define TAG "VARIO"
 
@@ -40,26 +50,32 @@
 #define log_reg(buffer, buffer_len)
 #endif
 
-static SemaphoreHandle_t vario_speed_mutex = NULL;
-static int32_t vario_speed = 0;
+#define VARIO_ALTITUDE_QUEUE_LENGTH             (DPS310_FIFO_DEPTH * 2)
 
-void vario_set_speed(int32_t speed /*cm per second*/) {
-    //log_i("vario_set_speed: %d", speed);
-    xSemaphoreTake(vario_speed_mutex, portMAX_DELAY);
-    vario_speed = speed;
-    xSemaphoreGive(vario_speed_mutex);
-}
+/* The UI is woken when a shown figure moves, speed noise below one step does not wake it on the ground */
+#define VARIO_UI_SPEED_STEP                     (10)
+/* Same for the compass and the motion gauge, in degrees */
+#define VARIO_UI_ATTITUDE_STEP                  (1)
 
-int32_t vario_get_speed(void) {
-    xSemaphoreTake(vario_speed_mutex, portMAX_DELAY);
-    uint32_t speed = vario_speed;
-    xSemaphoreGive(vario_speed_mutex);
+/* The magnetometer runs at 200 Hz, the attitude only needs its heading now and then */
+#define VARIO_QMC5883L_PERIOD_MS                (100)
 
-    return speed;
-}
+/* Bus counters are logged once a minute by the humidity loop, steady flight shows no driver installs */
+#define VARIO_I2C_STATS_PERIODS                 (120)
+
+/* Field in the MPU6886 body frame, only the latest one is kept for the attitude */
+typedef struct {
+    int64_t timestamp;
+    float field[3];
+} vario_magnet_sample_t;
+
+static QueueHandle_t altitude_queue = NULL;
+static QueueHandle_t magnet_queue = NULL;
+static kalman_filter_t * kalman = NULL;
+static vario_baro_fusion_t baro_fusion;
+static TaskHandle_t mpu6886_task_handle = NULL;
 
 static int16_t * sound_buffer = NULL;
-static fir_filter_t * filter = NULL;
 
 static speaker_device_t * speaker = NULL;
 static TaskHandle_t speaker_task_handle = NULL;
@@ -79,11 +95,7 @@ static TaskHandle_t qmc5883l_task_handle = NULL;
 //static uint8_t uart_buffer[UART_RX_BUF_SIZE+1];
 
 void vario_start(void) {
-    if (vario_speed_mutex == NULL) {
-        vario_speed_mutex = xSemaphoreCreateMutex();
-    }
-
-    sound_buffer = malloc(sizeof(int16_t) * OVERALL_TONE_SAMPLE_RATE * OVERALL_TONE_LIFT_CYCLE_MAXIMUM / 1000);
+    sound_buffer = malloc(sizeof(int16_t) * VARIO_SYNTH_BLOCK_SAMPLES_MAX);
 
 
     /*
@@ -95,40 +107,44 @@ void vario_start(void) {
     //int32_t sampling_bitwidth = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SAMPLING_BITWIDTH);
     //speaker = Speaker_Init(I2S_NUM_0, GPIO_NUM_12, GPIO_NUM_0, GPIO_NUM_2, GPIO_NUM_34, sampling_rate, sampling_bit_depth);
 
-    xTaskCreate(vario_speaker_loop, "SpeakerTask", 16384, NULL, tskIDLE_PRIORITY+3 , &speaker_task_handle);
-
-    int32_t speed_altitude_window = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW);
-    filter = init_fir_filter(speed_altitude_window, 0);
-
-    qmp6988 = qmp6988_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, QMP6988_I2C_ADDRESS_SDO_LOW);
-    if (qmp6988 != NULL) {
-        //qmp6988_check_chip_id(qmp6988);
-        qmp6988_set_standby(qmp6988, QMP6998_MEASUREMENT_STANDBY_5MS);
-        qmp6988_set_oversampling(qmp6988, QMP6988_OVERSAMPLING_COUNT_04, QMP6988_OVERSAMPLING_COUNT_32);
-        //qmp6988_set_iir_response_depth(qmp6988, QMP6988_IIR_RESPONSE_DEPTH_OFF);
-        qmp6988_start_periodic_measure(qmp6988);
-        xTaskCreate(vario_qmp6988_loop, "Qmp6998Task", 8192, NULL, tskIDLE_PRIORITY+5, &qmp6988_task_handle);
-    }
-
-//    dps310 = dps310_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, DPS310_I2C_SLAVE_ADDR);
-    dps310 = dps310_init_device(I2C_NUM_1, GPIO_NUM_21, GPIO_NUM_22, QMP6988_I2C_FAST_FREQUENCY, 0x76);
-    if (dps310 != NULL) {
-        xTaskCreate(vario_dps310_loop, "Dps310Task", 8192, NULL, tskIDLE_PRIORITY+5, &dps310_task_handle);
+    boot_stage_start(BOOT_STAGE_AUDIO);
+    if (xTaskCreate(vario_speaker_loop, "SpeakerTask", 16384, NULL, tskIDLE_PRIORITY+3 , &speaker_task_handle) != pdPASS) {
+        log_e("vario_start->xTaskCreate failed, no speaker task");
+        boot_stage_end(BOOT_STAGE_AUDIO, false);
     }
 
-    qmc5883l = qmc5883l_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, 0x0d);
-    if (qmc5883l != NULL) {
-        xTaskCreate(vario_qmc5883l_loop, "QMC5883Task", 8192, NULL, tskIDLE_PRIORITY+5, &qmc5883l_task_handle);
+    altitude_queue = xQueueCreate(VARIO_ALTITUDE_QUEUE_LENGTH, sizeof(vario_altitude_sample_t));
+    magnet_queue = xQueueCreate(1, sizeof(vario_magnet_sample_t));
+    int32_t accel_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ACCEL_NOISE);
+    int32_t bias_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_BIAS_NOISE);
+    int32_t altitude_noise = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_NOISE);
+    kalman = init_kalman_filter(accel_noise / 1000.0f, bias_noise / 1000.0f, altitude_noise / 100.0f);
+    vario_baro_fusion_init(&baro_fusion, altitude_noise / 100.0f);
+    boot_stage_start(BOOT_STAGE_BARO);
+    // The first altitude of either barometer is the fix, it fails once both of them gave up
+    boot_stage_expect(BOOT_STAGE_BARO, 2);
+    if (altitude_queue != NULL && magnet_queue != NULL && kalman != NULL) {
+        // Every sensor task brings its device up first, a slow one holds up neither the others nor the boot
+        if (xTaskCreate(vario_mpu6886_loop, "Mpu6886Task", 4096, NULL, tskIDLE_PRIORITY+5, &mpu6886_task_handle) != pdPASS) {
+            // The IMU task applies the altitudes, without it no barometer gets to a fix
+            log_e("vario_start->xTaskCreate failed, no mpu6886 task");
+            boot_stage_end(BOOT_STAGE_BARO, false);
+        }
+        if (xTaskCreate(vario_qmp6988_loop, "Qmp6998Task", 8192, NULL, tskIDLE_PRIORITY+5, &qmp6988_task_handle) != pdPASS) {
+            log_e("vario_start->xTaskCreate failed, no qmp6988 task");
+            boot_stage_drop(BOOT_STAGE_BARO);
+        }
+        if (xTaskCreate(vario_dps310_loop, "Dps310Task", 8192, NULL, tskIDLE_PRIORITY+5, &dps310_task_handle) != pdPASS) {
+            log_e("vario_start->xTaskCreate failed, no dps310 task");
+            boot_stage_drop(BOOT_STAGE_BARO);
+        }
     } else {
-        ESP_LOGE("QMC5883L", "qmc5883l_init_device failed");
-    }
-
-    sht3x = sht3x_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, ESP32_I2C_HIGH_FREQUENCY, SHT3X_I2C_ADDRESS_PIN2_LOW);
-    if (sht3x != NULL) {
-        sht3x_start_periodic_measure(sht3x, SHT3X_ACQUISITION_FREQUENCY_TWO, SHT3X_REPEATABILITY_HIGH);
-        sht3x_enable_art(sht3x);
-        xTaskCreate(vario_sht3x_loop, "Sht3xTask", 8192, NULL, tskIDLE_PRIORITY+2, &sht3x_task_handle);
+        // Without the estimator the barometers have nowhere to go, there is no fix for the audio to wait for
+        log_e("vario_start->estimator setup failed, barometers not started");
+        boot_stage_end(BOOT_STAGE_BARO, false);
     }
+    xTaskCreate(vario_qmc5883l_loop, "QMC5883Task", 8192, NULL, tskIDLE_PRIORITY+5, &qmc5883l_task_handle);
+    xTaskCreate(vario_sht3x_loop, "Sht3xTask", 8192, NULL, tskIDLE_PRIORITY+2, &sht3x_task_handle);
 }
 
 void vario_stop(void) {
@@ -143,6 +159,11 @@ void vario_stop(void) {
         sht3x = NULL;
     }
 
+    if (qmc5883l_task_handle != NULL) {
+        vTaskDelete(qmc5883l_task_handle);
+        qmc5883l_task_handle = NULL;
+    }
+
     if (qmp6988_task_handle != NULL) {
         vTaskDelete(qmp6988_task_handle);
         qmp6988_task_handle = NULL;
@@ -154,9 +175,25 @@ void vario_stop(void) {
         qmp6988 = NULL;
     }
 
-    if (filter != NULL) {
-        deinit_fir_filter(filter);
-        filter = NULL;
+    if (mpu6886_task_handle != NULL) {
+        vTaskDelete(mpu6886_task_handle);
+        mpu6886_task_handle = NULL;
+        MPU6886_StopStream();
+    }
+
+    if (kalman != NULL) {
+        deinit_kalman_filter(kalman);
+        kalman = NULL;
+    }
+
+    if (altitude_queue != NULL) {
+        vQueueDelete(altitude_queue);
+        altitude_queue = NULL;
+    }
+
+    if (magnet_queue != NULL) {
+        vQueueDelete(magnet_queue);
+        magnet_queue = NULL;
     }
     
     if (speaker_task_handle != NULL) {
@@ -175,51 +212,67 @@ void vario_stop(void) {
     }
 }
 
-void vario_dps310_loop(void * arguments) {
-
-    for ( ; ; ) {
-        int32_t time_window = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW);
-
-        uint8_t dps310_status;
-        if (ESP_OK == dps310_get_status(dps310, &dps310_status)) {
-            if ((dps310_status & MEAS_CFG_PRS_RDY_MASK) == MEAS_CFG_PRS_RDY) {
-                double temperature;
-                double pressure;
-                if (ESP_OK == dps310_fetch_result(dps310, &temperature, &pressure)) {
-                    static TickType_t last_ticks = 0;
-                    TickType_t ticks = xTaskGetTickCount();
-                    uint32_t current_delta_time = (pdTICKS_TO_MS(ticks - last_ticks));
-
-                    static int32_t last_average_delta_time = 125;
-                    int32_t average_delta_time = last_average_delta_time * (time_window - 1) / time_window + current_delta_time / time_window;
-
-                    static double last_average_altitude = 0.0;
-                    double current_altitude = 100000.0 * (pow(101325.0 / pressure, 1 / 5.257) - 1) * (temperature + 273.15) / 0.0065;
-                    double average_altitude = fir_filter_process(filter, current_altitude);
-
-                    int32_t speed = (average_altitude - last_average_altitude) / (double)average_delta_time;
+static void vario_process_pressure(vario_baro_sensor_t sensor, int64_t timestamp, vario_baro_value_t temperature, vario_baro_value_t pressure) {
+    if (altitude_queue == NULL) {
+        return;
+    }
 
-                    //log_i("current_delta_time:%d, average_delta_time:%d, last_average_delta_time:%d, current altitude:%f, average altitude:%f, last average altitude:%f, speed:%d", current_delta_time, average_delta_time, last_average_delta_time, current_altitude, average_altitude, last_average_altitude, speed);
+    /*
+        The adjustment is copied out of the snapshot only when a new configuration is published. Each sensor
+        reports from its own task, so each keeps its own copy.
+    */
+    static struct {
+        bool loaded;
+        uint32_t generation;
+        int32_t temperature_adjustment;
+    } cache[VARIO_BARO_COUNT];
+    if (!cache[sensor].loaded || config_snapshot_changed(cache[sensor].generation)) {
+        config_snapshot_t config;
+        config_read_snapshot(&config);
+        cache[sensor].loaded = true;
+        cache[sensor].generation = config.generation;
+        cache[sensor].temperature_adjustment = config.system[CONFIG_SYSTEM_TEMPERATURE_ADJUSTMENT];
+    }
 
-                    last_ticks = ticks;
-                    last_average_delta_time = average_delta_time;
-                    last_average_altitude = average_altitude;
+    vario_altitude_sample_t sample;
+    vario_altitude_sample_init(&sample, sensor, timestamp, temperature, pressure, cache[sensor].temperature_adjustment);
+    if (xQueueSend(altitude_queue, &sample, 0) != pdTRUE) {
+        log_e("vario_process_pressure->xQueueSend failed, altitude sample dropped");
+    }
+}
 
-                    vario_set_speed(speed);
+void vario_dps310_loop(void * arguments) {
+    boot_stage_start(BOOT_STAGE_DPS310);
+//    dps310 = dps310_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, DPS310_I2C_SLAVE_ADDR);
+    dps310 = dps310_init_device(I2C_NUM_1, GPIO_NUM_21, GPIO_NUM_22, QMP6988_I2C_FAST_FREQUENCY, 0x76);
+    if (dps310 != NULL) {
+        i2c_device_set_priority(dps310->i2c_interface, I2C_PRIORITY_HIGH);
+        dps310_start_fifo_measure(dps310, VARIO_DPS310_FIFO_READ_PERIOD_MS);
+    }
+    boot_stage_end(BOOT_STAGE_DPS310, dps310 != NULL);
+    if (dps310 == NULL) {
+        boot_stage_drop(BOOT_STAGE_BARO);
+        dps310_task_handle = NULL;
+        vTaskDelete(NULL);
+    }
 
-                    ui_set_altitude(current_altitude / 100000.0);
-                    ui_set_speed((double)speed / 100.0);
-                    ui_set_pressure(pressure);
-                    bluetooth_send_pressure((uint32_t)pressure);
+    static vario_dps310_result_t results[DPS310_FIFO_DEPTH];
+    vario_sample_clock_t sample_clock;
+    vario_sample_clock_init(&sample_clock, 1000000 / dps310->pressure_rate);
+    TickType_t last_wake_ticks = xTaskGetTickCount();
 
-                    int32_t temperature_adjustment = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_TEMPERATURE_ADJUSTMENT);
-                    ui_set_temperature(temperature + (double)temperature_adjustment / 1000.0);
-                } else {
-                    log_e("Read dps310 error");
-                }
+    for ( ; ; ) {
+        vTaskDelayUntil(&last_wake_ticks, pdMS_TO_TICKS(VARIO_DPS310_FIFO_READ_PERIOD_MS));
+
+        uint32_t count = 0;
+        if (ESP_OK == vario_dps310_fetch_fifo(dps310, results, DPS310_FIFO_DEPTH, &count)) {
+            int64_t timestamps[DPS310_FIFO_DEPTH];
+            vario_dps310_stamp_entries(&sample_clock, esp_timer_get_time(), count, timestamps);
+            for (uint32_t i = 0; i < count; i++) {
+                vario_process_pressure(VARIO_BARO_DPS310, timestamps[i], results[i].temperature, results[i].pressure);
             }
         } else {
-            log_e("vario_dps310_loop->dps310_get_status failed");
+            log_e("vario_dps310_loop->dps310_fetch_fifo failed");
         }
 
         uint8_t *data = heap_caps_malloc(UART_RX_BUF_SIZE+1, MALLOC_CAP_SPIRAM);
@@ -231,212 +284,349 @@ void vario_dps310_loop(void * arguments) {
             }
             free(data);
         }
-
-        vTaskDelay(pdMS_TO_TICKS(10));
     }
 }
 
 void vario_qmp6988_loop(void * arguments) {
-    //bluethroat_parameters_t bps;
+    boot_stage_start(BOOT_STAGE_QMP6988);
+    qmp6988 = qmp6988_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, QMP6988_I2C_ADDRESS_SDO_LOW);
+    if (qmp6988 != NULL) {
+        i2c_device_set_priority(qmp6988->i2c_interface, I2C_PRIORITY_HIGH);
+        //qmp6988_check_chip_id(qmp6988);
+        qmp6988_set_standby(qmp6988, QMP6998_MEASUREMENT_STANDBY_5MS);
+        qmp6988_set_oversampling(qmp6988, QMP6988_OVERSAMPLING_COUNT_04, QMP6988_OVERSAMPLING_COUNT_32);
+        //qmp6988_set_iir_response_depth(qmp6988, QMP6988_IIR_RESPONSE_DEPTH_OFF);
+        qmp6988_start_periodic_measure(qmp6988);
+    }
+    boot_stage_end(BOOT_STAGE_QMP6988, qmp6988 != NULL);
+    if (qmp6988 == NULL) {
+        boot_stage_drop(BOOT_STAGE_BARO);
+        qmp6988_task_handle = NULL;
+        vTaskDelete(NULL);
+    }
+
+    uint32_t period_us = qmp6988_get_measurement_period(qmp6988);
+    vario_sample_clock_t sample_clock;
+    vario_sample_clock_init(&sample_clock, period_us);
+    vario_qmp6988_poll_t poll;
+    vario_qmp6988_poll_init(&poll, period_us);
+    period_us -= period_us / VARIO_QMP6988_PERIOD_MARGIN;
+
+    uint32_t remainder_us = 0;
+    TickType_t last_wake_ticks = xTaskGetTickCount();
 
     for ( ; ; ) {
-        int32_t time_window = config_get_integer(CONFIG_NAMESPACE_SPEED, CONFIG_SPEED_ALTITUDE_WINDOW);
+        // Sleep until the next result is due, carrying the sub-tick remainder so the average rate follows the device
+        uint32_t wait_us = period_us + remainder_us;
+        TickType_t wait_ticks = wait_us / (portTICK_PERIOD_MS * 1000);
+        remainder_us = wait_us % (portTICK_PERIOD_MS * 1000);
+        vTaskDelayUntil(&last_wake_ticks, (wait_ticks > 0) ? wait_ticks : 1);
+
+        for ( ; ; ) {
+            vario_baro_value_t temperature;
+            vario_baro_value_t pressure;
+            int64_t read_time = esp_timer_get_time();
+            if (ESP_OK != vario_qmp6988_fetch_result(qmp6988, &temperature, &pressure)) {
+                log_e("Read qmp6988 error");
+                break;
+            }
 
-        static uint8_t last_qmp6988_status = QMP6988_DEVICE_STATUS_MEASURING;
-        uint8_t qmp6988_status;
-        if (ESP_OK == qmp6988_get_status(qmp6988, &qmp6988_status)) {
-            if (qmp6988_status == QMP6988_DEVICE_STATUS_READY && last_qmp6988_status != QMP6988_DEVICE_STATUS_READY) {
-                double temperature;
-                double pressure;
-                if (ESP_OK == qmp6988_fetch_result(qmp6988, &temperature, &pressure)) {
-                    static TickType_t last_ticks = 0;
-                    TickType_t ticks = xTaskGetTickCount();
-                    uint32_t current_delta_time = (pdTICKS_TO_MS(ticks - last_ticks));
+            // Result registers not refreshed yet, retry one tick later and restart the schedule from there
+            vario_qmp6988_read_t read = vario_qmp6988_poll(&poll, read_time, temperature, pressure);
+            if (read == VARIO_QMP6988_RETRY) {
+                vTaskDelay(1);
+                last_wake_ticks = xTaskGetTickCount();
+                remainder_us = 0;
+                continue;
+            }
+            // A sensor that stopped refreshing is read once per period again instead of every tick
+            if (read == VARIO_QMP6988_STALE) {
+                break;
+            }
 
-                    static int32_t last_average_delta_time = 80;
-                    int32_t average_delta_time = last_average_delta_time * (time_window - 1) / time_window + current_delta_time / time_window;
+            vario_process_pressure(VARIO_BARO_QMP6988, vario_sample_clock_stamp(&sample_clock, read_time), temperature, pressure);
+            break;
+        }
+    }
+}
 
-                    static double last_average_altitude = 0.0;
-                    double current_altitude = 100000.0 * (pow(101325.0 / pressure, 1 / 5.257) - 1) * (temperature + 273.15) / 0.0065;
-                    double average_altitude = fir_filter_process(filter, current_altitude);
+/* Fallback without the FIFO, one sample read from the output registers per period */
+static int vario_mpu6886_read_single(mpu6886_frame_t * frame, TickType_t * last_wake_ticks) {
+    vTaskDelayUntil(last_wake_ticks, pdMS_TO_TICKS(VARIO_MPU6886_PERIOD_MS));
+    frame->timestamp = esp_timer_get_time();
+    MPU6886_GetAccelAdc(&frame->accel[0], &frame->accel[1], &frame->accel[2]);
+    MPU6886_GetGyroAdc(&frame->gyro[0], &frame->gyro[1], &frame->gyro[2]);
+    return 1;
+}
 
-                    int32_t speed = (average_altitude - last_average_altitude) / (double)average_delta_time;
+/* Heading difference in degrees, the short way round */
+static int32_t vario_heading_difference(int32_t heading, int32_t shown) {
+    int32_t difference = (heading - shown + 540) % 360 - 180;
+    return abs(difference);
+}
 
-                    //log_i("current_delta_time:%d, average_delta_time:%d, last_average_delta_time:%d, current altitude:%f, average altitude:%f, last average altitude:%f, speed:%d", current_delta_time, average_delta_time, last_average_delta_time, current_altitude, average_altitude, last_average_altitude, speed);
+void vario_mpu6886_loop(void * arguments) {
+    static ahrs_t ahrs;
+    ahrs_init(&ahrs);
+    telemetry_t telemetry;
+    telemetry_read(&telemetry);
+    int32_t shown_altitude = INT32_MIN;
+    int32_t shown_speed = 0;
+    int32_t shown_pressure = INT32_MIN;
+    int32_t shown_temperature = INT32_MIN;
+    int32_t shown_heading = 0;
+    int32_t shown_roll = 0;
+    int32_t shown_pitch = 0;
+    int64_t last_magnet_timestamp = 0;
+    bool baro_fixed = false;
+    static mpu6886_frame_t frames[MPU6886_FIFO_FRAMES_MAX];
+
+    bool streaming = (MPU6886_StartStream(VARIO_MPU6886_ODR_HZ, VARIO_MPU6886_BATCH_FRAMES) == 0);
+    if (!streaming) {
+        log_e("vario_mpu6886_loop->MPU6886_StartStream failed, reading single samples");
+    }
+    vario_imu_clock_t imu_clock;
+    vario_imu_clock_init(&imu_clock, streaming ? MPU6886_GetStreamPeriod() : VARIO_MPU6886_PERIOD_MS * 1000, esp_timer_get_time());
+    TickType_t last_wake_ticks = xTaskGetTickCount();
 
-                    last_ticks = ticks;
-                    last_average_delta_time = average_delta_time;
-                    last_average_altitude = average_altitude;
+    for ( ; ; ) {
+        int count;
+        if (streaming) {
+            // A missed watermark interrupt only delays the batch, the FIFO is read anyway
+            MPU6886_WaitStream(pdMS_TO_TICKS(VARIO_MPU6886_PERIOD_MS * 2));
+            count = MPU6886_ReadStream(frames, MPU6886_FIFO_FRAMES_MAX);
+            if (count < 0) {
+                log_e("vario_mpu6886_loop->MPU6886_ReadStream failed");
+                count = 0;
+            }
+        } else {
+            count = vario_mpu6886_read_single(&frames[0], &last_wake_ticks);
+        }
 
-                    vario_set_speed(speed);
+        for (int i = 0; i < count; i++) {
+            vario_imu_frame_update(&imu_clock, &ahrs, kalman, &frames[i]);
+        }
+        int64_t now = imu_clock.last_timestamp;
 
-                    ui_set_altitude(current_altitude / 100000.0);
-                    ui_set_speed((double)speed / 100.0);
-                    ui_set_pressure(pressure);
-                    bluetooth_send_pressure((uint32_t)pressure);
+        // The gyro carries the heading between magnetometer reads
+        vario_magnet_sample_t magnet;
+        if (xQueueReceive(magnet_queue, &magnet, 0) == pdTRUE) {
+            ahrs_update_magnetometer(&ahrs, magnet.field, vario_delta_time(last_magnet_timestamp, magnet.timestamp));
+            last_magnet_timestamp = magnet.timestamp;
+        }
 
-                    int32_t temperature_adjustment = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_TEMPERATURE_ADJUSTMENT);
-                    ui_set_temperature(temperature + (double)temperature_adjustment / 1000.0);
-                } else {
-                    log_e("Read qmp6988 error");
-                }
+        // Both barometers are brought to the estimator time, only the reference one is shown and sent
+        vario_altitude_sample_t sample;
+        while (xQueueReceive(altitude_queue, &sample, 0) == pdTRUE) {
+            vario_altitude_sample_apply(&sample, &baro_fusion, kalman, now);
+            if (!baro_fixed) {
+                baro_fixed = true;
+                boot_stage_end(BOOT_STAGE_BARO, true);
+            }
+            if (sample.sensor == baro_fusion.reference) {
+                telemetry.pressure = sample.pressure;
+                telemetry.temperature = sample.temperature;
+                bluetooth_send_pressure((uint32_t)sample.pressure);
             }
-            last_qmp6988_status = qmp6988_status;
-        } else {
-            log_e("vario_qmp6988_loop->qmp6988_get_status failed");
         }
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+        // Only producer of the snapshot, readers never hold it up
+        telemetry.altitude = kalman->altitude;
+        telemetry.speed = (int32_t)(kalman->velocity * 100.0f);
+        telemetry.heading = ahrs_get_heading(&ahrs);
+        ahrs_get_tilt(&ahrs, &telemetry.roll, &telemetry.pitch);
+        telemetry_publish(&telemetry);
+
+        // Altitude in m, pressure in 0.1 hPa and temperature in 0.1 degree as displayed
+        uint32_t events = 0;
+        int32_t altitude = (int32_t)lroundf(telemetry.altitude);
+        if (altitude != shown_altitude || abs(telemetry.speed - shown_speed) >= VARIO_UI_SPEED_STEP) {
+            shown_altitude = altitude;
+            shown_speed = telemetry.speed;
+            events |= UI_EVENT_FLIGHT;
+        }
+        int32_t pressure = (int32_t)lroundf(telemetry.pressure / 10.0f);
+        int32_t temperature = (int32_t)lroundf(telemetry.temperature * 10.0f);
+        if (pressure != shown_pressure || temperature != shown_temperature) {
+            shown_pressure = pressure;
+            shown_temperature = temperature;
+            events |= UI_EVENT_ENVIRONMENT;
+        }
+        int32_t heading = (int32_t)lroundf(telemetry.heading);
+        int32_t roll = (int32_t)lroundf(telemetry.roll);
+        int32_t pitch = (int32_t)lroundf(telemetry.pitch);
+        if (vario_heading_difference(heading, shown_heading) >= VARIO_UI_ATTITUDE_STEP ||
+            abs(roll - shown_roll) >= VARIO_UI_ATTITUDE_STEP || abs(pitch - shown_pitch) >= VARIO_UI_ATTITUDE_STEP) {
+            shown_heading = heading;
+            shown_roll = roll;
+            shown_pitch = pitch;
+            events |= UI_EVENT_ATTITUDE;
+        }
+        if (history_add(now, telemetry.altitude, telemetry.speed)) {
+            events |= UI_EVENT_HISTORY;
+        }
+        if (events) {
+            ui_notify(events);
+        }
     }
 }
 
+static void vario_log_i2c_latency(const char * name, I2CDevice_t device) {
+    i2c_latency_t latency;
+    if (device != NULL && i2c_device_get_latency(device, &latency) == ESP_OK) {
+        log_i("I2C %s latency p50 %u p95 %u p99 %u max %u us", name, i2c_latency_percentile(&latency, 50),
+            i2c_latency_percentile(&latency, 95), i2c_latency_percentile(&latency, 99), latency.max_us);
+    }
+}
+
+static void vario_log_i2c_stats(void) {
+    for (i2c_port_t port = I2C_NUM_0; port < I2C_NUM_MAX; port++) {
+        i2c_bus_stats_t stats;
+        if (i2c_get_bus_stats(port, &stats) == ESP_OK && stats.transactions > 0) {
+            log_i("I2C%d installs %u clock changes %u transactions %u in %u windows errors %u timeouts %u, wait mean %llu max %u us, bus mean %llu max %u us",
+                port, stats.installs, stats.clock_changes, stats.transactions, stats.windows, stats.errors, stats.timeouts,
+                stats.wait_us / stats.transactions, stats.wait_max_us, stats.latency_us / stats.transactions, stats.latency_max_us);
+        }
+    }
+    vario_log_i2c_latency("dps310", (dps310 != NULL) ? dps310->i2c_interface : NULL);
+    vario_log_i2c_latency("qmp6988", (qmp6988 != NULL) ? qmp6988->i2c_interface : NULL);
+    vario_log_i2c_latency("qmc5883l", (qmc5883l != NULL) ? qmc5883l->i2c_interface : NULL);
+    vario_log_i2c_latency("sht3x", (sht3x != NULL) ? sht3x->i2c_interface : NULL);
+}
+
 void vario_sht3x_loop(void * arguments) {
+    boot_stage_start(BOOT_STAGE_SHT3X);
+    sht3x = sht3x_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, ESP32_I2C_HIGH_FREQUENCY, SHT3X_I2C_ADDRESS_PIN2_LOW);
+    if (sht3x != NULL) {
+        // Humidity and heading can wait behind the barometers sharing their bus
+        i2c_device_set_priority(sht3x->i2c_interface, I2C_PRIORITY_LOW);
+        sht3x_start_periodic_measure(sht3x, SHT3X_ACQUISITION_FREQUENCY_TWO, SHT3X_REPEATABILITY_HIGH);
+        sht3x_enable_art(sht3x);
+    }
+    boot_stage_end(BOOT_STAGE_SHT3X, sht3x != NULL);
+    if (sht3x == NULL) {
+        sht3x_task_handle = NULL;
+        vTaskDelete(NULL);
+    }
+
+    int32_t shown_humidity = INT32_MIN;
+    uint32_t periods = 0;
+
     for ( ; ; ) {
         double temperature = 0.0f;
         double humidity = 0.0f;
 
         esp_err_t ret = sht3x_fetch_result(sht3x, &temperature, &humidity);
         if (ret == ESP_OK) {
-            ui_set_humidity(humidity);
+            telemetry_publish_humidity(humidity);
+            int32_t shown = (int32_t)lround(humidity * 10.0);
+            if (shown != shown_humidity) {
+                shown_humidity = shown;
+                ui_notify(UI_EVENT_ENVIRONMENT);
+            }
         } else {
             log_i("vario_sht3x_loop->sht3x_fetch_result failed, return %x", ret);
         }
 
+        if (++periods % VARIO_I2C_STATS_PERIODS == 0) {
+            vario_log_i2c_stats();
+        }
+
         vTaskDelay(pdMS_TO_TICKS(500));
     }
 }
 
-void vario_speaker_loop(void * arguemnts) {
-    //bluethroat_parameters_t bps;
-/*
-    uint32_t lift_freq;
-    uint32_t lift_freq_phase = 0;
-    uint32_t lift_cycle;
-    uint32_t lift_duty;
-
-    uint32_t sink_basefreq;
-    uint32_t sink_harmonic;
-    uint32_t sink_cycle;
-    uint32_t sink_basefreq_phase = 0;
-    uint32_t sink_harmonic_phase = 0;
-*/
+static void vario_load_tone_config(const config_snapshot_t * config, vario_tone_config_t * tone_config) {
+    tone_config->lift_freq_min = config->sound[CONFIG_SOUND_LIFT_FREQUENCY_MINIMUM];
+    tone_config->lift_freq_max = config->sound[CONFIG_SOUND_LIFT_FREQUENCY_MAXIMUM];
+    tone_config->lift_freq_factor = config->sound[CONFIG_SOUND_LIFT_FREQUENCY_FACTOR];
+    tone_config->lift_cycle_min = config->sound[CONFIG_SOUND_LIFT_CYCLE_MINIMUM];
+    tone_config->lift_cycle_max = config->sound[CONFIG_SOUND_LIFT_CYCLE_MAXIMUM];
+    tone_config->lift_cycle_factor = config->sound[CONFIG_SOUND_LIFT_CYCLE_FACTOR];
+    tone_config->lift_duty_min = config->sound[CONFIG_SOUND_LIFT_DUTY_MINMUM];
+    tone_config->lift_duty_max = config->sound[CONFIG_SOUND_LIFT_DUTY_MAXMUM];
+    tone_config->lift_duty_factor = config->sound[CONFIG_SOUND_LIFT_DUTY_FACTOR];
+    tone_config->sink_freq_min = config->sound[CONFIG_SOUND_SINK_FREQUENCY_MINIMUM];
+    tone_config->sink_freq_max = config->sound[CONFIG_SOUND_SINK_FREQUENCY_MAXIMUM];
+    tone_config->sink_freq_factor = config->sound[CONFIG_SOUND_SINK_FREQUENCY_FACTOR];
+    tone_config->sink_diff_percent = config->sound[CONFIG_SOUND_SINK_DUAL_TONE_FACTOR];
+    tone_config->lift_start = config->sound[CONFIG_SOUND_THRESHOLD_LIFT_START_SPEED];
+    tone_config->lift_stop = config->sound[CONFIG_SOUND_THRESHOLD_LIFT_STOP_SPEED];
+    tone_config->sink_start = config->sound[CONFIG_SOUND_THRESHOLD_SINK_START_SPEED];
+    tone_config->sink_stop = config->sound[CONFIG_SOUND_THRESHOLD_SINK_STOP_SPEED];
+}
 
+void vario_speaker_loop(void * arguemnts) {
+#ifdef CONFIG_VARIO_AUDIO_LOW_RATE
+    int32_t sampling_rate = VARIO_SYNTH_LOW_SAMPLE_RATE;
+#else
     int32_t sampling_rate = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SAMPLING_RATE);
+#endif
     int32_t sampling_bitwidth = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SAMPLING_BITWIDTH);
-    speaker = Speaker_Init(I2S_NUM_0, GPIO_NUM_12, GPIO_NUM_0, GPIO_NUM_2, GPIO_NUM_34, sampling_rate, sampling_bitwidth);
-
-    for ( ; ; ) {
-        int32_t lift_freq_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_MINIMUM);
-        int32_t lift_freq_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_MAXIMUM);
-        int32_t lift_freq_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_FREQUENCY_FACTOR);
-        int32_t lift_cycle_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_MINIMUM);
-        int32_t lift_cycle_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_MAXIMUM);
-        int32_t lift_cycle_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_CYCLE_FACTOR);
-        int32_t lift_duty_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_MINMUM);
-        int32_t lift_duty_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_MAXMUM);
-        int32_t lift_duty_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_LIFT_DUTY_FACTOR);
-        int32_t sink_freq_min = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_MINIMUM);
-        int32_t sink_freq_max = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_MAXIMUM);
-        int32_t sink_freq_factor = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_FREQUENCY_FACTOR);
-        int32_t sink_diff_percent = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_SINK_DUAL_TONE_FACTOR);
-        int32_t lift_start = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_LIFT_START_SPEED);
-        int32_t lift_stop = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_LIFT_STOP_SPEED);
-        int32_t sink_start = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_SINK_START_SPEED);
-        int32_t sink_stop = config_get_integer(CONFIG_NAMESPACE_SOUND, CONFIG_SOUND_THRESHOLD_SINK_STOP_SPEED);
-        int32_t volume = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_VOLUME);
-        int32_t auto_poweroff_timeout = config_get_integer(CONFIG_NAMESPACE_SYSTEM, CONFIG_SYSTEM_AUTO_POWEROFF_TIMEOUT);
-    
-        static int32_t last_speed = 0;
-        int32_t speed = (vario_get_speed() & 0xfffffff0);
-    
-        uint32_t data_length = 0;
-
-        //log_i("current speed is: %d, last speed is: %d", speed, last_speed);
-        typedef enum { VARIO_STATUS_LIFTING, VARIO_STATUS_GLIDING, VARIO_STATUS_SINKING } vario_status_t;
-        static vario_status_t status = VARIO_STATUS_GLIDING;
-        if (speed != last_speed) {
-            if (status == VARIO_STATUS_GLIDING) {
-                if (speed >= lift_start) {
-                    status = VARIO_STATUS_LIFTING;
-                } else if (speed <= sink_start) {
-                    status = VARIO_STATUS_SINKING;
-                }
-            } else if (status == VARIO_STATUS_LIFTING) {
-                if (speed <= sink_start) {
-                    status = VARIO_STATUS_SINKING;
-                } else if (speed < lift_stop) {
-                    status = VARIO_STATUS_GLIDING;
-                }
-            } else {
-                if (speed >= lift_start) {
-                    status = VARIO_STATUS_LIFTING;
-                } else if (speed > sink_stop) {
-                    status = VARIO_STATUS_GLIDING;
-                }
-            }
-
-            if (status == VARIO_STATUS_LIFTING) {
-                int32_t lift_freq = lift_freq_max - (lift_freq_max - lift_freq_min) * lift_freq_factor / (speed + lift_freq_factor);
-                int32_t lift_cycle = lift_cycle_min + (lift_cycle_max - lift_cycle_min) * lift_cycle_factor / (speed + lift_cycle_factor);
-                int32_t lift_duty = lift_duty_min + (lift_duty_max - lift_duty_min) * lift_duty_factor / (speed + lift_duty_factor);
-
-                lift_freq = lift_freq * SIN_TABLE_DATA_COUNT / sampling_rate;
-                lift_cycle = lift_cycle * sampling_rate / 1000;
-                lift_duty = lift_duty * sampling_rate / 1000;
-
-                register_t i = 0;
-                static int32_t lift_freq_phase = 0;
-
-                for ( ; i<lift_duty; i++) {
-                    lift_freq_phase = (lift_freq_phase + lift_freq) % SIN_TABLE_DATA_COUNT;
-                    sound_buffer[i] = volume * sin_table[lift_freq_phase] / 100;
-                }
-
-                for ( ; i<lift_cycle; i++) {
-                    sound_buffer[i] = 0;
-                }
-
-                data_length = lift_cycle;
 
-            } else if (status == VARIO_STATUS_SINKING) {
-                int32_t sink_basefreq = sink_freq_min + (sink_freq_max - sink_freq_min) * sink_freq_factor / (sink_freq_factor - speed);
-                int32_t sink_harmonic = sink_basefreq + sink_basefreq * sink_diff_percent / 100;
+    static vario_synth_t synth;
+    vario_synth_init(&synth, sampling_rate);
+    /* Block sized DMA buffers, a write blocks until one of them is free so the loop runs at the audio rate */
+    boot_stage_start(BOOT_STAGE_SPEAKER);
+    speaker = Speaker_Init(I2S_NUM_0, GPIO_NUM_12, GPIO_NUM_0, GPIO_NUM_2, GPIO_NUM_34, synth.sample_rate, sampling_bitwidth, VARIO_SYNTH_DMA_BUFFER_COUNT, synth.block_samples);
+    boot_stage_end(BOOT_STAGE_SPEAKER, speaker != NULL);
+    // The estimator has no speed before its first altitude, the tone is valid from then on
+    bool audio_ready = false;
+
+    // Only values copied out of the snapshot are kept across the blocking writes
+    static config_snapshot_t config;
+    bool config_loaded = false;
+    vario_tone_config_t tone_config;
+    int32_t volume = 0;
+    int32_t auto_poweroff_timeout = 0;
+
+    vario_tone_t tone = {.status = VARIO_STATUS_GLIDING};
+
+    typedef enum { VARIO_SOUND_STATE_OFF, VARIO_SOUND_STATE_ON } sound_state_t;
+    sound_state_t sound_state = VARIO_SOUND_STATE_OFF;
+    TickType_t last_ticks = xTaskGetTickCount();
+    uint32_t underruns = 0;
 
-                sink_basefreq = sink_basefreq * SIN_TABLE_DATA_COUNT / sampling_rate;
-                sink_harmonic = sink_harmonic * SIN_TABLE_DATA_COUNT / sampling_rate;
-                int32_t sink_cycle = 500 * sampling_rate / 1000;
-
-                static int32_t sink_basefreq_phase = 0;
-                static int32_t sink_harmonic_phase = 0;
-
-                for (register_t i = 0; i<sink_cycle; i++) {
-                    sink_basefreq_phase = (sink_basefreq_phase + sink_basefreq) % SIN_TABLE_DATA_COUNT;
-                    sink_harmonic_phase = (sink_basefreq_phase + sink_harmonic) % SIN_TABLE_DATA_COUNT;
-                    sound_buffer[i] = volume * (sin_table[sink_basefreq_phase] / 2 + sin_table[sink_harmonic_phase] / 2) / 100;
-                }
-
-                data_length = sink_cycle;
-            }
+    for ( ; ; ) {
+        /* Tone constants are only derived again when a new configuration is published */
+        if (!config_loaded || config_snapshot_changed(config.generation)) {
+            config_read_snapshot(&config);
+            config_loaded = true;
+            vario_load_tone_config(&config, &tone_config);
+            volume = config.system[CONFIG_SYSTEM_VOLUME];
+            auto_poweroff_timeout = config.system[CONFIG_SYSTEM_AUTO_POWEROFF_TIMEOUT];
+        }
 
-            last_speed = speed;
+        if (!audio_ready && boot_stage_ended(BOOT_STAGE_BARO)) {
+            audio_ready = true;
+            // Without a barometer there is no speed to sound, the vario is not audible
+            boot_stage_end(BOOT_STAGE_AUDIO, speaker != NULL && boot_stage_ok(BOOT_STAGE_BARO));
         }
 
-        typedef enum { VARIO_SOUND_STATE_OFF, VARIO_SOUND_STATE_ON } sound_state_t;
-        static sound_state_t sound_state = VARIO_SOUND_STATE_OFF;
+        telemetry_t telemetry;
+        telemetry_read(&telemetry);
+        vario_tone_update(&tone_config, telemetry.speed, &tone);
 
-        static TickType_t last_ticks = 0;
         TickType_t ticks = xTaskGetTickCount();
 
-        if (status != VARIO_STATUS_GLIDING) {
+        if (tone.status != VARIO_STATUS_GLIDING) {
             last_ticks = ticks;
             if (sound_state == VARIO_SOUND_STATE_OFF) {
                 Core2ForAWS_Speaker_Enable(1);
                 sound_state = VARIO_SOUND_STATE_ON;
             }
-            //log_i("write data begin for status: %d, speed: %d, length: %d", status, speed, data_length);
-            Speaker_WriteBuff(speaker, (uint8_t *)sound_buffer, data_length * sizeof(uint16_t), portMAX_DELAY);
-            //log_i("write data end for status: %d, speed: %d, length: %d", status, speed, data_length);
+        }
+
+        if (vario_synth_render(&synth, &tone, volume, sound_buffer, synth.block_samples)) {
+            Speaker_WriteBuff(speaker, (uint8_t *)sound_buffer, synth.block_samples * sizeof(int16_t), portMAX_DELAY);
+            if (Speaker_GetUnderruns(speaker) != underruns) {
+                underruns = Speaker_GetUnderruns(speaker);
+                ESP_LOGW("VARIO", "I2S underruns %u, the speaker task was kept from writing for more than %dms", underruns,
+                    VARIO_SYNTH_DMA_BUFFER_COUNT * VARIO_SYNTH_BLOCK_MS);
+            }
         } else {
+            Speaker_EndStream(speaker);
+            /* DMA buffers are cleared once drained, nothing has to be written while gliding */
             if (pdTICKS_TO_MS(ticks - last_ticks) > auto_poweroff_timeout) {
                 ESP_LOGI("VARIO", "Scheduled power off after %dms", auto_poweroff_timeout);
                 Axp192_PowerOff();
@@ -446,24 +636,41 @@ void vario_speaker_loop(void * arguemnts) {
                     sound_state = VARIO_SOUND_STATE_OFF;
                 }
             }
-        }
 
-        vTaskDelay(pdMS_TO_TICKS(10));
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
     }
 }
 
 void vario_qmc5883l_loop(void * arguments) {
-    #define _PI_ (3.1415926535897932384626);
+    boot_stage_start(BOOT_STAGE_QMC5883L);
+    qmc5883l = qmc5883l_init_device(I2C_NUM_0, GPIO_NUM_32, GPIO_NUM_33, QMP6988_I2C_FAST_FREQUENCY, 0x0d);
+    if (qmc5883l != NULL) {
+        i2c_device_set_priority(qmc5883l->i2c_interface, I2C_PRIORITY_LOW);
+    }
+    boot_stage_end(BOOT_STAGE_QMC5883L, qmc5883l != NULL);
+    if (qmc5883l == NULL) {
+        ESP_LOGE("QMC5883L", "qmc5883l_init_device failed");
+        qmc5883l_task_handle = NULL;
+        vTaskDelete(NULL);
+    }
+
     for ( ; ; ) {
         double x, y, z;
         if (ESP_OK == qmc5883l_fetch_result(qmc5883l, &x, &y, &z)) {
-            double angle = atan2(y, -x) * 180.0 / _PI_;
-            //ESP_LOGE("QMC5883L", "qmc5883l_fetch_result get angle: %f", angle);
-            rotate_compass(angle);
+            // Axes turned into the MPU6886 frame, half a turn about x, as the heading of the former atan2(y, -x) when level
+            vario_magnet_sample_t magnet;
+            magnet.timestamp = esp_timer_get_time();
+            magnet.field[0] = (float)x;
+            magnet.field[1] = (float)-y;
+            magnet.field[2] = (float)-z;
+            if (magnet_queue != NULL) {
+                xQueueOverwrite(magnet_queue, &magnet);
+            }
         } else {
             ESP_LOGE("QMC5883L", "qmc5883l_fetch_result return error");
         }
 
-        vTaskDelay(pdMS_TO_TICKS(100));
+        vTaskDelay(pdMS_TO_TICKS(VARIO_QMC5883L_PERIOD_MS));
     }
 }
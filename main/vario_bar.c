@@ -0,0 +1,165 @@
+#include "vario_bar.h"
+
+#define VARIO_BAR_HEIGHT                (240)
+#define VARIO_BAR_UNIT_PITCH            (14)
+#define VARIO_BAR_UNIT_HEIGHT           (13)
+/* The gliding unit between both halves is one pixel taller than the others */
+#define VARIO_BAR_GLIDE_TOP             (VARIO_BAR_UNITS * VARIO_BAR_UNIT_PITCH + 1)
+#define VARIO_BAR_GLIDE_HEIGHT          (VARIO_BAR_UNIT_PITCH)
+#define VARIO_BAR_SINK_TOP              (VARIO_BAR_GLIDE_TOP + VARIO_BAR_GLIDE_HEIGHT + 1)
+#define VARIO_BAR_SPEED_MAX             (VARIO_BAR_UNITS * VARIO_BAR_UNIT_SPEED)
+
+#define VARIO_BAR_COLOR_BORDER          LV_COLOR_GRAY
+#define VARIO_BAR_COLOR_GLIDE           LV_COLOR_ORANGE
+#define VARIO_BAR_COLOR_LIFT            LV_COLOR_GREEN
+#define VARIO_BAR_COLOR_SINK            LV_COLOR_RED
+
+typedef struct {
+    int32_t speed;
+} vario_bar_ext_t;
+
+/* Lift unit 0 and sink unit 0 touch the gliding unit */
+static lv_coord_t vario_bar_lift_top(int unit) {
+    return (VARIO_BAR_UNITS - 1 - unit) * VARIO_BAR_UNIT_PITCH + 1;
+}
+
+static lv_coord_t vario_bar_sink_top(int unit) {
+    return VARIO_BAR_SINK_TOP + unit * VARIO_BAR_UNIT_PITCH;
+}
+
+/* Filled pixels of a unit, speed is positive towards the unit */
+static lv_coord_t vario_bar_fill(int32_t speed, int unit) {
+    int32_t part = speed - unit * VARIO_BAR_UNIT_SPEED;
+    part = (part > VARIO_BAR_UNIT_SPEED) ? VARIO_BAR_UNIT_SPEED : ((part < 0) ? 0 : part);
+    return (lv_coord_t)(part * VARIO_BAR_UNIT_HEIGHT / VARIO_BAR_UNIT_SPEED);
+}
+
+static void vario_bar_draw_rect(const lv_obj_t * bar, const lv_area_t * clip_area, lv_draw_rect_dsc_t * dsc,
+                                lv_coord_t x, lv_coord_t y, lv_coord_t width, lv_coord_t height, lv_color_t color) {
+    if (width <= 0 || height <= 0) {
+        return;
+    }
+
+    lv_area_t area;
+    area.x1 = bar->coords.x1 + x;
+    area.y1 = bar->coords.y1 + y;
+    area.x2 = area.x1 + width - 1;
+    area.y2 = area.y1 + height - 1;
+
+    lv_area_t visible;
+    if (_lv_area_intersect(&visible, &area, clip_area)) {
+        dsc->bg_color = color;
+        lv_draw_rect(&area, clip_area, dsc);
+    }
+}
+
+static void vario_bar_draw_scale(const lv_obj_t * bar, const lv_area_t * clip_area, lv_draw_rect_dsc_t * dsc, lv_coord_t left, int32_t speed) {
+    lv_area_t scale;
+    scale.x1 = bar->coords.x1 + left;
+    scale.y1 = bar->coords.y1;
+    scale.x2 = scale.x1 + VARIO_BAR_WIDTH - 1;
+    scale.y2 = scale.y1 + VARIO_BAR_HEIGHT - 1;
+    if (!_lv_area_is_on(&scale, clip_area)) {
+        return;
+    }
+
+    // Outline, one pixel rules around every unit
+    vario_bar_draw_rect(bar, clip_area, dsc, left, 0, 1, VARIO_BAR_HEIGHT, VARIO_BAR_COLOR_BORDER);
+    vario_bar_draw_rect(bar, clip_area, dsc, left + VARIO_BAR_WIDTH - 1, 0, 1, VARIO_BAR_HEIGHT, VARIO_BAR_COLOR_BORDER);
+    for (int i = 0; i <= VARIO_BAR_UNITS; i++) {
+        vario_bar_draw_rect(bar, clip_area, dsc, left, i * VARIO_BAR_UNIT_PITCH, VARIO_BAR_WIDTH, 1, VARIO_BAR_COLOR_BORDER);
+        vario_bar_draw_rect(bar, clip_area, dsc, left, VARIO_BAR_SINK_TOP - 1 + i * VARIO_BAR_UNIT_PITCH, VARIO_BAR_WIDTH, 1, VARIO_BAR_COLOR_BORDER);
+    }
+
+    vario_bar_draw_rect(bar, clip_area, dsc, left + 1, VARIO_BAR_GLIDE_TOP, VARIO_BAR_WIDTH - 2, VARIO_BAR_GLIDE_HEIGHT, VARIO_BAR_COLOR_GLIDE);
+
+    // Lift fills upwards from the bottom of a unit, sink downwards from its top
+    for (int i = 0; i < VARIO_BAR_UNITS; i++) {
+        lv_coord_t lift = vario_bar_fill(speed, i);
+        lv_coord_t sink = vario_bar_fill(-speed, i);
+        vario_bar_draw_rect(bar, clip_area, dsc, left + 1, vario_bar_lift_top(i) + VARIO_BAR_UNIT_HEIGHT - lift, VARIO_BAR_WIDTH - 2, lift, VARIO_BAR_COLOR_LIFT);
+        vario_bar_draw_rect(bar, clip_area, dsc, left + 1, vario_bar_sink_top(i), VARIO_BAR_WIDTH - 2, sink, VARIO_BAR_COLOR_SINK);
+    }
+}
+
+static lv_design_res_t vario_bar_design(lv_obj_t * bar, const lv_area_t * clip_area, lv_design_mode_t mode) {
+    // Transparent between the scales, the parent background shows through
+    if (mode == LV_DESIGN_COVER_CHK) {
+        return LV_DESIGN_RES_NOT_COVER;
+    }
+
+    if (mode == LV_DESIGN_DRAW_MAIN) {
+        const vario_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
+        lv_draw_rect_dsc_t dsc;
+        lv_draw_rect_dsc_init(&dsc);
+
+        vario_bar_draw_scale(bar, clip_area, &dsc, 0, ext->speed);
+        vario_bar_draw_scale(bar, clip_area, &dsc, lv_obj_get_width(bar) - VARIO_BAR_WIDTH, ext->speed);
+    }
+
+    return LV_DESIGN_RES_OK;
+}
+
+lv_obj_t * vario_bar_create(lv_obj_t * parent) {
+    lv_obj_t * bar = lv_obj_create(parent, NULL);
+    if (bar == NULL) {
+        return NULL;
+    }
+
+    vario_bar_ext_t * ext = lv_obj_allocate_ext_attr(bar, sizeof(vario_bar_ext_t));
+    if (ext == NULL) {
+        lv_obj_del(bar);
+        return NULL;
+    }
+    ext->speed = 0;
+
+    lv_obj_reset_style_list(bar, LV_OBJ_PART_MAIN);
+    lv_obj_set_design_cb(bar, vario_bar_design);
+    lv_obj_set_click(bar, false);
+    lv_obj_set_pos(bar, 0, 0);
+    lv_obj_set_size(bar, lv_obj_get_width(parent), VARIO_BAR_HEIGHT);
+
+    return bar;
+}
+
+void vario_bar_set_speed(lv_obj_t * bar, int32_t speed) {
+    vario_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
+    speed = (speed > VARIO_BAR_SPEED_MAX) ? VARIO_BAR_SPEED_MAX : ((speed < -VARIO_BAR_SPEED_MAX) ? -VARIO_BAR_SPEED_MAX : speed);
+    if (speed == ext->speed) {
+        return;
+    }
+
+    // Rows of the units whose fill moved, the same span on both scales
+    lv_coord_t top = VARIO_BAR_HEIGHT;
+    lv_coord_t bottom = -1;
+    for (int i = 0; i < VARIO_BAR_UNITS; i++) {
+        if (vario_bar_fill(speed, i) != vario_bar_fill(ext->speed, i)) {
+            top = LV_MATH_MIN(top, vario_bar_lift_top(i));
+            bottom = LV_MATH_MAX(bottom, vario_bar_lift_top(i) + VARIO_BAR_UNIT_HEIGHT - 1);
+        }
+        if (vario_bar_fill(-speed, i) != vario_bar_fill(-ext->speed, i)) {
+            top = LV_MATH_MIN(top, vario_bar_sink_top(i));
+            bottom = LV_MATH_MAX(bottom, vario_bar_sink_top(i) + VARIO_BAR_UNIT_HEIGHT - 1);
+        }
+    }
+    ext->speed = speed;
+
+    if (bottom < top) {
+        return;
+    }
+
+    lv_area_t area;
+    area.y1 = bar->coords.y1 + top;
+    area.y2 = bar->coords.y1 + bottom;
+    area.x1 = bar->coords.x1 + 1;
+    area.x2 = bar->coords.x1 + VARIO_BAR_WIDTH - 2;
+    lv_obj_invalidate_area(bar, &area);
+    area.x2 = bar->coords.x2 - 1;
+    area.x1 = area.x2 - VARIO_BAR_WIDTH + 3;
+    lv_obj_invalidate_area(bar, &area);
+}
+
+int32_t vario_bar_get_speed(const lv_obj_t * bar) {
+    const vario_bar_ext_t * ext = lv_obj_get_ext_attr(bar);
+    return ext->speed;
+}
@@ -0,0 +1,76 @@
+#include <string.h>
+
+#include "vario_sample.h"
+
+void vario_altitude_sample_init(vario_altitude_sample_t * sample, vario_baro_sensor_t sensor, int64_t timestamp,
+                                vario_baro_value_t temperature, vario_baro_value_t pressure, int32_t temperature_adjustment) {
+    sample->timestamp = timestamp;
+    sample->sensor = sensor;
+#ifdef CONFIG_BARO_FIXED_POINT_COMPENSATION
+    sample->altitude = vario_pressure_to_altitude_fixed(temperature, pressure) / 1000.0f;
+    sample->pressure = (float)pressure / (1 << VARIO_FIXED_PRESSURE_SHIFT);
+    sample->temperature = (float)(temperature * 10 + temperature_adjustment) / 1000.0f;
+#else
+    sample->altitude = vario_pressure_to_altitude(temperature, pressure);
+    sample->pressure = pressure;
+    sample->temperature = temperature + (double)temperature_adjustment / 1000.0;
+#endif
+}
+
+void vario_altitude_sample_apply(const vario_altitude_sample_t * sample, vario_baro_fusion_t * fusion, kalman_filter_t * kalman, int64_t now) {
+    vario_baro_fusion_update(fusion, kalman, sample->sensor, sample->altitude, (now - sample->timestamp) / 1000000.0f);
+}
+
+void vario_qmp6988_poll_init(vario_qmp6988_poll_t * poll, uint32_t period_us) {
+    memset(poll, 0, sizeof(vario_qmp6988_poll_t));
+    poll->period_us = period_us;
+}
+
+vario_qmp6988_read_t vario_qmp6988_poll(vario_qmp6988_poll_t * poll, int64_t read_time, vario_baro_value_t temperature, vario_baro_value_t pressure) {
+    bool repeated = poll->started && temperature == poll->temperature && pressure == poll->pressure;
+    if (repeated && read_time - poll->read_time <= poll->period_us + poll->period_us / VARIO_QMP6988_PERIOD_MARGIN) {
+        if (poll->retries < VARIO_QMP6988_RETRIES_MAX) {
+            poll->retries++;
+            return VARIO_QMP6988_RETRY;
+        }
+        poll->retries = 0;
+        return VARIO_QMP6988_STALE;
+    }
+
+    poll->started = true;
+    poll->retries = 0;
+    poll->read_time = read_time;
+    poll->temperature = temperature;
+    poll->pressure = pressure;
+    return VARIO_QMP6988_FRESH;
+}
+
+void vario_dps310_stamp_entries(vario_sample_clock_t * sample_clock, int64_t drain_time, uint32_t count, int64_t * timestamps) {
+    // The period is taken before the entries move the sample clock
+    int64_t period_us = vario_sample_clock_period(sample_clock);
+    for (uint32_t i = 0; i < count; i++) {
+        timestamps[i] = vario_sample_clock_stamp(sample_clock, drain_time - (count - 1 - i) * period_us);
+    }
+}
+
+void vario_imu_clock_init(vario_imu_clock_t * imu_clock, int64_t period_us, int64_t now) {
+    vario_sample_clock_init(&imu_clock->sample_clock, period_us);
+    imu_clock->last_timestamp = now;
+}
+
+void vario_imu_update(ahrs_t * ahrs, kalman_filter_t * kalman, const float accel[3], const float gyro[3], float delta_time) {
+    ahrs_update(ahrs, accel, gyro, delta_time);
+    kalman_filter_predict(kalman, ahrs_vertical_acceleration(ahrs, accel), delta_time);
+}
+
+void vario_imu_frame_update(vario_imu_clock_t * imu_clock, ahrs_t * ahrs, kalman_filter_t * kalman, const mpu6886_frame_t * frame) {
+    // Frames are dated back from the read one sample period apart, the sample clock takes out the read latency
+    int64_t timestamp = vario_sample_clock_stamp(&imu_clock->sample_clock, frame->timestamp);
+    float delta_time = vario_delta_time(imu_clock->last_timestamp, timestamp);
+    imu_clock->last_timestamp = timestamp;
+
+    float accel[3];
+    float gyro[3];
+    MPU6886_GetFrameData(frame, accel, gyro);
+    vario_imu_update(ahrs, kalman, accel, gyro, delta_time);
+}
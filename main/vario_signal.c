@@ -0,0 +1,248 @@
+#include <math.h>
+
+#include "vario_signal.h"
+
+/* Barometric formula with the measured temperature, altitude in m relative to the standard sea level pressure */
+double vario_pressure_to_altitude(double temperature, double pressure) {
+    return (pow(101325.0 / pressure, 1 / 5.257) - 1) * (temperature + 273.15) / 0.0065;
+}
+
+/* (101325 / p)^(1 / 5.257) - 1 in Q30, p = VARIO_ALTITUDE_TABLE_PRESSURE_MIN + index * 128 Pa */
+static const int32_t vario_altitude_table[VARIO_ALTITUDE_TABLE_SIZE] = {
+    279734404, 278638681, 277548485, 276463765, 275384470, 274310551, 273241958, 272178643,
+    271120559, 270067658, 269019893, 267977219, 266939591, 265906963, 264879292, 263856534,
+    262838645, 261825584, 260817308, 259813776, 258814947, 257820781, 256831238, 255846277,
+    254865862, 253889952, 252918510, 251951499, 250988881, 250030620, 249076680, 248127025,
+    247181620, 246240429, 245303419, 244370556, 243441805, 242517133, 241596509, 240679898,
+    239767269, 238858591, 237953832, 237052961, 236155947, 235262761, 234373371, 233487749,
+    232605866, 231727692, 230853198, 229982357, 229115141, 228251521, 227391471, 226534963,
+    225681971, 224832468, 223986428, 223143826, 222304634, 221468829, 220636385, 219807278,
+    218981482, 218158974, 217339729, 216523725, 215710936, 214901341, 214094915, 213291637,
+    212491484, 211694433, 210900462, 210109550, 209321675, 208536816, 207754951, 206976059,
+    206200120, 205427114, 204657019, 203889815, 203125484, 202364005, 201605358, 200849524,
+    200096485, 199346220, 198598712, 197853942, 197111891, 196372542, 195635875, 194901874,
+    194170520, 193441797, 192715686, 191992171, 191271234, 190552859, 189837029, 189123727,
+    188412937, 187704643, 186998829, 186295478, 185594576, 184896106, 184200053, 183506401,
+    182815136, 182126242, 181439704, 180755508, 180073639, 179394082, 178716823, 178041848,
+    177369142, 176698692, 176030484, 175364504, 174700738, 174039173, 173379795, 172722592,
+    172067549, 171414655, 170763895, 170115258, 169468731, 168824300, 168181953, 167541679,
+    166903465, 166267298, 165633167, 165001059, 164370963, 163742868, 163116760, 162492630,
+    161870465, 161250254, 160631985, 160015649, 159401232, 158788726, 158178118, 157569397,
+    156962554, 156357578, 155754457, 155153182, 154553742, 153956127, 153360326, 152766331,
+    152174129, 151583712, 150995070, 150408193, 149823071, 149239695, 148658054, 148078140,
+    147499943, 146923454, 146348664, 145775563, 145204142, 144634392, 144066304, 143499870,
+    142935080, 142371926, 141810399, 141250490, 140692191, 140135494, 139580389, 139026869,
+    138474925, 137924549, 137375733, 136828468, 136282748, 135738562, 135195905, 134654767,
+    134115142, 133577020, 133040395, 132505260, 131971605, 131439424, 130908710, 130379454,
+    129851650, 129325291, 128800368, 128276875, 127754805, 127234150, 126714904, 126197059,
+    125680609, 125165546, 124651865, 124139557, 123628617, 123119037, 122610811, 122103932,
+    121598394, 121094191, 120591315, 120089760, 119589521, 119090590, 118592962, 118096629,
+    117601587, 117107828, 116615347, 116124138, 115634194, 115145509, 114658079, 114171896,
+    113686954, 113203249, 112720775, 112239524, 111759493, 111280674, 110803063, 110326654,
+    109851441, 109377420, 108904583, 108432926, 107962444, 107493131, 107024982, 106557991,
+    106092154, 105627465, 105163918, 104701509, 104240232, 103780083, 103321057, 102863147,
+    102406350, 101950661, 101496073, 101042584, 100590187, 100138878, 99688652, 99239504,
+    98791430, 98344424, 97898483, 97453601, 97009774, 96566998, 96125267, 95684577,
+    95244924, 94806303, 94368709, 93932139, 93496588, 93062052, 92628526, 92196005,
+    91764487, 91333965, 90904437, 90475897, 90048343, 89621769, 89196171, 88771546,
+    88347889, 87925196, 87503463, 87082686, 86662862, 86243986, 85826054, 85409063,
+    84993008, 84577885, 84163692, 83750423, 83338076, 82926646, 82516129, 82106523,
+    81697823, 81290025, 80883126, 80477123, 80072011, 79667787, 79264447, 78861989,
+    78460408, 78059700, 77659863, 77260893, 76862787, 76465540, 76069150, 75673613,
+    75278926, 74885086, 74492088, 74099931, 73708610, 73318122, 72928464, 72539633,
+    72151625, 71764438, 71378068, 70992512, 70607767, 70223829, 69840696, 69458364,
+    69076831, 68696093, 68316148, 67936991, 67558621, 67181034, 66804228, 66428199,
+    66052944, 65678460, 65304745, 64931796, 64559609, 64188183, 63817513, 63447598,
+    63078434, 62710018, 62342348, 61975421, 61609235, 61243786, 60879072, 60515090,
+    60151837, 59789311, 59427509, 59066428, 58706066, 58346420, 57987487, 57629266,
+    57271752, 56914945, 56558840, 56203436, 55848730, 55494720, 55141403, 54788776,
+    54436838, 54085585, 53735015, 53385126, 53035915, 52687380, 52339518, 51992328,
+    51645806, 51299951, 50954759, 50610230, 50266359, 49923146, 49580587, 49238680,
+    48897424, 48556815, 48216852, 47877533, 47538854, 47200815, 46863412, 46526643,
+    46190507, 45855001, 45520122, 45185870, 44852241, 44519233, 44186845, 43855074,
+    43523918, 43193375, 42863443, 42534120, 42205404, 41877292, 41549783, 41222875,
+    40896565, 40570852, 40245734, 39921208, 39597273, 39273927, 38951167, 38628992,
+    38307400, 37986389, 37665956, 37346101, 37026820, 36708113, 36389977, 36072411,
+    35755412, 35438979, 35123110, 34807802, 34493055, 34178866, 33865234, 33552157,
+    33239632, 32927658, 32616234, 32305357, 31995026, 31685239, 31375994, 31067290,
+    30759124, 30451496, 30144403, 29837843, 29531816, 29226318, 28921350, 28616908,
+    28312991, 28009597, 27706726, 27404375, 27102542, 26801226, 26500426, 26200139,
+    25900364, 25601100, 25302344, 25004096, 24706354, 24409115, 24112380, 23816145,
+    23520410, 23225172, 22930431, 22636185, 22342432, 22049170, 21756399, 21464117,
+    21172322, 20881013, 20590188, 20299846, 20009985, 19720604, 19431701, 19143275,
+    18855325, 18567849, 18280846, 17994313, 17708251, 17422656, 17137529, 16852867,
+    16568670, 16284935, 16001662, 15718848, 15436493, 15154596, 14873154, 14592167,
+    14311633, 14031551, 13751919, 13472736, 13194002, 12915714, 12637871, 12360472,
+    12083515, 11807000, 11530925, 11255289, 10980090, 10705327, 10430999, 10157105,
+    9883643, 9610613, 9338012, 9065839, 8794095, 8522776, 8251882, 7981412,
+    7711365, 7441738, 7172532, 6903745, 6635375, 6367422, 6099884, 5832760,
+    5566049, 5299749, 5033861, 4768382, 4503311, 4238647, 3974389, 3710536,
+    3447086, 3184040, 2921394, 2659149, 2397303, 2135855, 1874804, 1614149,
+    1353888, 1094021, 834547, 575464, 316771, 58468, -199447, -456975,
+    -714117, -970874, -1227247, -1483237, -1738846, -1994073, -2248921, -2503390,
+    -2757482, -3011196, -3264536, -3517500, -3770091, -4022310, -4274157, -4525633,
+    -4776740, -5027478, -5277849, -5527853, -5777492, -6026766, -6275677, -6524224,
+    -6772411, -7020236, -7267702, -7514809, -7761558, -8007950, -8253987, -8499668,
+    -8744996, -8989970, -9234592, -9478863, -9722784, -9966355, -10209578, -10452453,
+    -10694982, -10937165, -11179003, -11420497, -11661648, -11902457, -12142925, -12383053,
+    -12622841, -12862290, -13101402, -13340177, -13578616, -13816720, -14054490, -14291927,
+    -14529031, -14765803, -15002245, -15238356, -15474139, -15709593, -15944720, -16179520,
+    -16413995, -16648145,
+};
+
+/* 1 / 0.0065 m/K in mm per 0.01 K, Q16 */
+#define VARIO_ALTITUDE_SCALE                    (100824615LL)
+
+/* Altitude in mm, same formula as vario_pressure_to_altitude without any floating point operation */
+int32_t vario_pressure_to_altitude_fixed(int32_t temperature, int32_t pressure) {
+    const int32_t step_shift = VARIO_ALTITUDE_TABLE_STEP_SHIFT + VARIO_FIXED_PRESSURE_SHIFT;
+    int32_t offset = pressure - (VARIO_ALTITUDE_TABLE_PRESSURE_MIN << VARIO_FIXED_PRESSURE_SHIFT);
+
+    // Out of the table the end segments are extrapolated
+    int32_t index = offset >> step_shift;
+    if (index < 0) {
+        index = 0;
+    } else if (index > VARIO_ALTITUDE_TABLE_SIZE - 2) {
+        index = VARIO_ALTITUDE_TABLE_SIZE - 2;
+    }
+    int32_t fraction = offset - (index << step_shift);
+
+    int64_t ratio = vario_altitude_table[index] +
+        (((int64_t)(vario_altitude_table[index + 1] - vario_altitude_table[index]) * fraction) >> step_shift);
+    int64_t kelvin = temperature + 27315;
+
+    return (((ratio * kelvin) >> 14) * VARIO_ALTITUDE_SCALE) >> 32;
+}
+
+/* Seconds between two timestamps in us, clamped so a stalled or repeated read cannot upset the filter */
+float vario_delta_time(int64_t last_timestamp, int64_t timestamp) {
+    float delta_time = (timestamp - last_timestamp) / 1000000.0f;
+    if (delta_time < VARIO_DELTA_TIME_MIN) {
+        return VARIO_DELTA_TIME_MIN;
+    }
+    return (delta_time > VARIO_DELTA_TIME_MAX) ? VARIO_DELTA_TIME_MAX : delta_time;
+}
+
+void vario_sample_clock_init(vario_sample_clock_t * sample_clock, int64_t period_us) {
+    sample_clock->started = false;
+    sample_clock->ready = 0;
+    sample_clock->last_read = 0;
+    sample_clock->period = period_us << VARIO_SAMPLE_CLOCK_SHIFT;
+}
+
+int64_t vario_sample_clock_period(const vario_sample_clock_t * sample_clock) {
+    return sample_clock->period >> VARIO_SAMPLE_CLOCK_SHIFT;
+}
+
+int64_t vario_sample_clock_stamp(vario_sample_clock_t * sample_clock, int64_t read_time) {
+    int64_t read = read_time << VARIO_SAMPLE_CLOCK_SHIFT;
+    int64_t predicted = sample_clock->ready + sample_clock->period;
+
+    if (!sample_clock->started || read - predicted > sample_clock->period) {
+        sample_clock->ready = read;
+    } else {
+        // Every sample is read once, so the mean read interval is the device period whatever the read latency
+        sample_clock->period += (read - sample_clock->last_read - sample_clock->period) / VARIO_SAMPLE_CLOCK_PERIOD_WEIGHT;
+        // A read can not come before its data, an early one pulls the clock back, a late one only nudges it
+        sample_clock->ready = (read <= predicted) ? read : predicted + (read - predicted) / VARIO_SAMPLE_CLOCK_LATE_WEIGHT;
+    }
+    sample_clock->started = true;
+    sample_clock->last_read = read;
+
+    return sample_clock->ready >> VARIO_SAMPLE_CLOCK_SHIFT;
+}
+
+void vario_baro_fusion_init(vario_baro_fusion_t * fusion, float altitude_noise) {
+    for (int i = 0; i < VARIO_BARO_COUNT; i++) {
+        fusion->channels[i].offset = 0.0f;
+        fusion->channels[i].variance = altitude_noise * altitude_noise;
+        fusion->channels[i].samples = 0;
+    }
+    fusion->reference = -1;
+}
+
+void vario_baro_fusion_update(vario_baro_fusion_t * fusion, kalman_filter_t * kalman, vario_baro_sensor_t sensor, float altitude, float age) {
+    vario_baro_channel_t * channel = &fusion->channels[sensor];
+
+    if (!kalman->initialized) {
+        kalman_filter_update(kalman, altitude);
+        fusion->reference = sensor;
+        channel->samples = 1;
+        return;
+    }
+
+    float aligned = altitude + kalman->velocity * age;
+
+    // First sample of another sensor only measures how far it reads from the reference
+    if (channel->samples == 0) {
+        channel->offset = aligned - kalman->altitude;
+        channel->samples = 1;
+        return;
+    }
+
+    aligned -= channel->offset;
+    float residual = aligned - kalman->altitude;
+
+    // Innovation variance less the part the estimator itself is unsure about is the sensor noise
+    float variance = residual * residual - kalman->covariance[0][0];
+    channel->variance += (variance - channel->variance) * VARIO_BARO_VARIANCE_WEIGHT;
+    channel->variance = (channel->variance < VARIO_BARO_VARIANCE_MIN) ? VARIO_BARO_VARIANCE_MIN : channel->variance;
+
+    if (sensor != fusion->reference) {
+        channel->offset += residual * VARIO_BARO_OFFSET_WEIGHT;
+    }
+    channel->samples++;
+
+    // Measured variances only set the relative weights, the quietest sensor keeps the configured altitude noise
+    float variance_min = channel->variance;
+    for (int i = 0; i < VARIO_BARO_COUNT; i++) {
+        if (fusion->channels[i].samples > 0 && fusion->channels[i].variance < variance_min) {
+            variance_min = fusion->channels[i].variance;
+        }
+    }
+
+    kalman_filter_update_with_variance(kalman, aligned, kalman->altitude_variance * channel->variance / variance_min);
+}
+
+/*
+    Move the lift/glide/sink status through its hysteresis thresholds, then derive the tone parameters.
+    speed in cm/s, tone->status carries the state between calls.
+*/
+void vario_tone_update(const vario_tone_config_t * config, int32_t speed, vario_tone_t * tone) {
+    if (tone->status == VARIO_STATUS_GLIDING) {
+        if (speed >= config->lift_start) {
+            tone->status = VARIO_STATUS_LIFTING;
+        } else if (speed <= config->sink_start) {
+            tone->status = VARIO_STATUS_SINKING;
+        }
+    } else if (tone->status == VARIO_STATUS_LIFTING) {
+        if (speed <= config->sink_start) {
+            tone->status = VARIO_STATUS_SINKING;
+        } else if (speed < config->lift_stop) {
+            tone->status = VARIO_STATUS_GLIDING;
+        }
+    } else {
+        if (speed >= config->lift_start) {
+            tone->status = VARIO_STATUS_LIFTING;
+        } else if (speed > config->sink_stop) {
+            tone->status = VARIO_STATUS_GLIDING;
+        }
+    }
+
+    if (tone->status == VARIO_STATUS_LIFTING) {
+        tone->frequency = config->lift_freq_max - (config->lift_freq_max - config->lift_freq_min) * config->lift_freq_factor / (speed + config->lift_freq_factor);
+        tone->harmonic = 0;
+        tone->cycle = config->lift_cycle_min + (config->lift_cycle_max - config->lift_cycle_min) * config->lift_cycle_factor / (speed + config->lift_cycle_factor);
+        tone->duty = config->lift_duty_min + (config->lift_duty_max - config->lift_duty_min) * config->lift_duty_factor / (speed + config->lift_duty_factor);
+    } else if (tone->status == VARIO_STATUS_SINKING) {
+        tone->frequency = config->sink_freq_min + (config->sink_freq_max - config->sink_freq_min) * config->sink_freq_factor / (config->sink_freq_factor - speed);
+        tone->harmonic = tone->frequency + tone->frequency * config->sink_diff_percent / 100;
+        tone->cycle = VARIO_TONE_SINK_CYCLE;
+        tone->duty = VARIO_TONE_SINK_CYCLE;
+    } else {
+        tone->frequency = 0;
+        tone->harmonic = 0;
+        tone->cycle = 0;
+        tone->duty = 0;
+    }
+}
\ No newline at end of file
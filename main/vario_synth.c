@@ -0,0 +1,115 @@
+#include "sin_table.h"
+#include "vario_synth.h"
+
+#define VARIO_SYNTH_GAIN_MAX                    ((1 << VARIO_SYNTH_GAIN_SHIFT) - 1)
+#define VARIO_SYNTH_QUARTER_SHIFT               (30)
+#define VARIO_SYNTH_FRACTION_BITS               (16)
+#define VARIO_SYNTH_INDEX_SHIFT                 (VARIO_SYNTH_QUARTER_SHIFT - SIN_TABLE_QUARTER_BITS - VARIO_SYNTH_FRACTION_BITS)
+#define VARIO_SYNTH_INDEX_MASK                  ((1 << (SIN_TABLE_QUARTER_BITS + VARIO_SYNTH_FRACTION_BITS)) - 1)
+
+uint32_t vario_synth_frequency_to_step(const vario_synth_t * synth, int32_t frequency) {
+    return (uint32_t)(((uint64_t)frequency << 32) / synth->sample_rate);
+}
+
+int32_t vario_synth_sine(uint32_t phase) {
+    uint32_t quarter = phase >> VARIO_SYNTH_QUARTER_SHIFT;
+    uint32_t position = (phase >> VARIO_SYNTH_INDEX_SHIFT) & VARIO_SYNTH_INDEX_MASK;
+
+    /* Second and fourth quarters run the table backwards, one LSB short so the guard entry is the last read */
+    if (quarter & 1) {
+        position = VARIO_SYNTH_INDEX_MASK - position;
+    }
+
+    uint32_t index = position >> VARIO_SYNTH_FRACTION_BITS;
+    int32_t fraction = position & ((1 << VARIO_SYNTH_FRACTION_BITS) - 1);
+    int32_t value = sin_table[index] + (((sin_table[index + 1] - sin_table[index]) * fraction) >> VARIO_SYNTH_FRACTION_BITS);
+
+    return (quarter & 2) ? -value : value;
+}
+
+void vario_synth_init(vario_synth_t * synth, uint32_t sample_rate) {
+    if (sample_rate > VARIO_SYNTH_SAMPLE_RATE_MAX) {
+        sample_rate = VARIO_SYNTH_SAMPLE_RATE_MAX;
+    }
+
+    synth->sample_rate = sample_rate;
+    synth->block_samples = sample_rate * VARIO_SYNTH_BLOCK_MS / 1000;
+    synth->status = VARIO_STATUS_GLIDING;
+    synth->phase = 0;
+    synth->harmonic_phase = 0;
+    synth->step = 0;
+    synth->harmonic_step = 0;
+    synth->position = 0;
+    synth->cycle = 0;
+    synth->duty = 0;
+    synth->gain = 0;
+    synth->gain_step = VARIO_SYNTH_GAIN_MAX / (sample_rate * VARIO_SYNTH_RAMP_MS / 1000);
+}
+
+bool vario_synth_render(vario_synth_t * synth, const vario_tone_t * tone, int32_t volume, int16_t * block, uint32_t count) {
+    int32_t gain_max = ((volume > 100) ? 100 : ((volume < 0) ? 0 : volume)) * VARIO_SYNTH_GAIN_MAX / 100;
+
+    /*
+        A new status is only taken once the previous voice has faded out, so lift and sink tones never switch
+        at full scale. A beep then starts right away instead of wherever the previous cadence had stopped.
+    */
+    bool starting = (tone->status != synth->status && synth->gain == 0);
+    if (starting) {
+        synth->status = tone->status;
+        synth->position = 0;
+    }
+    bool switching = (tone->status != synth->status);
+    if (synth->status == VARIO_STATUS_GLIDING && synth->gain == 0) {
+        return false;
+    }
+
+    /* While fading out the pitch and cadence hold, so the last beep keeps its tone */
+    uint32_t step_target = synth->step;
+    uint32_t harmonic_step_target = synth->harmonic_step;
+    if (!switching && synth->status != VARIO_STATUS_GLIDING) {
+        step_target = vario_synth_frequency_to_step(synth, tone->frequency);
+        harmonic_step_target = (synth->status == VARIO_STATUS_SINKING) ? vario_synth_frequency_to_step(synth, tone->harmonic) : step_target;
+        synth->cycle = (uint32_t)tone->cycle * synth->sample_rate / 1000;
+        synth->duty = (uint32_t)tone->duty * synth->sample_rate / 1000;
+    }
+
+    /* Nothing to glide from out of silence */
+    if (starting) {
+        synth->step = step_target;
+        synth->harmonic_step = harmonic_step_target;
+    }
+
+    int32_t step_delta = ((int32_t)step_target - (int32_t)synth->step) / (int32_t)count;
+    int32_t harmonic_step_delta = ((int32_t)harmonic_step_target - (int32_t)synth->harmonic_step) / (int32_t)count;
+
+    for (uint32_t i = 0; i < count; i++) {
+        synth->step += step_delta;
+        synth->harmonic_step += harmonic_step_delta;
+        synth->phase += synth->step;
+        synth->harmonic_phase += synth->harmonic_step;
+
+        bool sounding = !switching && ((synth->status == VARIO_STATUS_SINKING) || (synth->status == VARIO_STATUS_LIFTING && synth->position < synth->duty));
+        int32_t gain_target = sounding ? gain_max : 0;
+        if (synth->gain < gain_target) {
+            synth->gain = (synth->gain + synth->gain_step > gain_target) ? gain_target : synth->gain + synth->gain_step;
+        } else if (synth->gain > gain_target) {
+            synth->gain = (synth->gain - synth->gain_step < gain_target) ? gain_target : synth->gain - synth->gain_step;
+        }
+
+        if (synth->cycle != 0 && ++synth->position >= synth->cycle) {
+            synth->position = 0;
+        }
+
+        int32_t value = vario_synth_sine(synth->phase);
+        if (synth->status == VARIO_STATUS_SINKING) {
+            value = (value + vario_synth_sine(synth->harmonic_phase)) / 2;
+        }
+        block[i] = (int16_t)((value * synth->gain) >> VARIO_SYNTH_GAIN_SHIFT);
+    }
+
+    /* The per sample deltas are truncated, land exactly on the target at the block end */
+    synth->step = step_target;
+    synth->harmonic_step = harmonic_step_target;
+
+    return true;
+}
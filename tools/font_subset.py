@@ -0,0 +1,228 @@
+#!/usr/bin/env python3
+"""
+Cuts a glyph subset out of an LVGL font source file and writes it RLE compressed in the binary layout read by
+main/font_loader.c. Only fonts with 4 bpp plain bitmaps and one contiguous character range are handled, which
+is what the lv_font_arial_rounded_mt_* sources are.
+
+Layout, little endian:
+    header      "BTF1", u8 bpp, u8 bitmap_format, u8 glyph_count, u8 reserved,
+                i16 line_height, i16 base_line, i16 underline_position, i16 underline_thickness,
+                u16 kern_scale, u16 kern_count, u32 range_start, u32 bitmap_size
+    glyphs      u16 codepoint - range_start, u16 adv_w, u32 bitmap_index, u8 box_w, u8 box_h, i8 ofs_x, i8 ofs_y
+    kerning     kern_count pairs of u8 glyph ids, then kern_count i8 values
+    bitmap      bitmap_size bytes, the last one is padding for the decoder reading ahead
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"BTF1"
+BPP = 4
+FORMAT_PLAIN = 0
+FORMAT_COMPRESSED = 1
+FORMAT_COMPRESSED_NO_PREFILTER = 2
+
+GLYPH_RE = re.compile(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), "
+                      r"\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}")
+
+
+class FontError(Exception):
+    pass
+
+
+def array_body(source, name):
+    match = re.search(r"\b" + name + r"\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    if match is None:
+        raise FontError("no %s array" % name)
+    return re.sub(r"/\*.*?\*/", "", match.group(1), flags=re.S)
+
+
+def integers(body):
+    return [int(value, 0) for value in re.findall(r"-?(?:0x[0-9a-fA-F]+|\d+)", body)]
+
+
+def field(source, name):
+    match = re.search(r"\." + name + r"\s*=\s*(-?\d+)", source)
+    if match is None:
+        raise FontError("no %s" % name)
+    return int(match.group(1))
+
+
+def parse(path):
+    with open(path) as handle:
+        source = handle.read()
+
+    if field(source, "bpp") != BPP or field(source, "bitmap_format") != FORMAT_PLAIN:
+        raise FontError("only %d bpp plain bitmaps are supported" % BPP)
+    cmaps = array_body(source, "cmaps")
+    if field(source, "cmap_num") != 1 or "FORMAT0_TINY" not in cmaps:
+        raise FontError("only one contiguous character range is supported")
+
+    font = {
+        "size": int(re.search(r"Size: (\d+) px", source).group(1)),
+        "line_height": field(source, "line_height"),
+        "base_line": field(source, "base_line"),
+        "underline_position": field(source, "underline_position"),
+        "underline_thickness": field(source, "underline_thickness"),
+        "kern_scale": field(source, "kern_scale"),
+        "range_start": field(cmaps, "range_start"),
+        "range_length": field(cmaps, "range_length"),
+        "glyph_id_start": field(cmaps, "glyph_id_start"),
+        "bitmap": bytes(integers(array_body(source, "glyph_bitmap"))),
+        "glyphs": [tuple(int(value) for value in match) for match in GLYPH_RE.findall(array_body(source, "glyph_dsc"))],
+        "kerning": [],
+    }
+
+    if field(source, "kern_classes") == 0 and "kern_pair_glyph_ids" in source:
+        ids = integers(array_body(source, "kern_pair_glyph_ids"))
+        values = integers(array_body(source, "kern_pair_values"))
+        font["kerning"] = [(ids[2 * i], ids[2 * i + 1], values[i]) for i in range(len(values))]
+
+    return font
+
+
+def pixels(bitmap, index, width, height):
+    """Plain glyphs are one stream of nibbles, high one first, rows are not padded"""
+    values = []
+    for i in range(width * height):
+        byte = bitmap[index + i // 2]
+        values.append(byte >> 4 if i % 2 == 0 else byte & 0xF)
+    return values
+
+
+class BitWriter:
+    def __init__(self):
+        self.data = bytearray()
+        self.length = 0
+
+    def write(self, value, bits):
+        for shift in range(bits - 1, -1, -1):
+            if self.length % 8 == 0:
+                self.data.append(0)
+            if (value >> shift) & 1:
+                self.data[-1] |= 0x80 >> (self.length % 8)
+            self.length += 1
+
+
+def rle(values, bits):
+    """
+    Mirrors rle_next() in lv_font_fmt_txt.c: a literal equal to the one before starts a run of 1 bits, a 0 bit or
+    the end of a 6 bit counter after eleven of them is followed by a literal that never starts a run itself
+    """
+    writer = BitWriter()
+    i = 0
+    previous = None
+    may_repeat = False
+    while i < len(values):
+        value = values[i]
+        writer.write(value, bits)
+        i += 1
+        if not may_repeat or value != previous:
+            previous = value
+            may_repeat = True
+            continue
+
+        run = 0
+        while i + run < len(values) and values[i + run] == value:
+            run += 1
+        if run <= 10:
+            writer.write((1 << run) - 1, run)
+            i += run
+            if i < len(values):
+                writer.write(0, 1)
+        else:
+            counter = min(run - 10, 63)
+            writer.write(0x7FF, 11)
+            writer.write(counter, 6)
+            i += 10 + counter
+        may_repeat = False
+
+    return bytes(writer.data)
+
+
+def compress(values, width, prefilter):
+    if prefilter:
+        values = values[:width] + [values[i] ^ values[i - width] for i in range(width, len(values))]
+    return rle(values, BPP)
+
+
+def subset(font, characters):
+    codepoints = sorted(set(ord(character) for character in characters))
+    first = font["range_start"]
+    for codepoint in codepoints:
+        if codepoint < first or codepoint >= first + font["range_length"]:
+            raise FontError("U+%04X is not in the font" % codepoint)
+
+    ids = {}
+    glyphs = []
+    for codepoint in codepoints:
+        glyph_id = font["glyph_id_start"] + codepoint - first
+        ids[glyph_id] = len(glyphs) + 1
+        index, adv_w, box_w, box_h, ofs_x, ofs_y = font["glyphs"][glyph_id]
+        glyphs.append((codepoint, adv_w, box_w, box_h, ofs_x, ofs_y, pixels(font["bitmap"], index, box_w, box_h)))
+
+    kerning = sorted((ids[left], ids[right], value) for left, right, value in font["kerning"]
+                     if left in ids and right in ids)
+
+    # Whichever of the two RLE flavours is smaller for the whole font
+    best = None
+    for bitmap_format in (FORMAT_COMPRESSED, FORMAT_COMPRESSED_NO_PREFILTER):
+        blobs = [compress(glyph[6], glyph[2], bitmap_format == FORMAT_COMPRESSED) for glyph in glyphs]
+        if best is None or sum(map(len, blobs)) < sum(map(len, best[1])):
+            best = (bitmap_format, blobs)
+
+    return codepoints, glyphs, kerning, best
+
+
+def write(path, font, characters):
+    codepoints, glyphs, kerning, (bitmap_format, blobs) = subset(font, characters)
+    range_start = codepoints[0]
+
+    records = bytearray()
+    bitmap = bytearray()
+    for glyph, blob in zip(glyphs, blobs):
+        codepoint, adv_w, box_w, box_h, ofs_x, ofs_y, _ = glyph
+        records += struct.pack("<HHIBBbb", codepoint - range_start, adv_w, len(bitmap), box_w, box_h, ofs_x, ofs_y)
+        bitmap += blob
+    bitmap.append(0)
+
+    header = struct.pack("<4sBBBBhhhhHHII", MAGIC, BPP, bitmap_format, len(glyphs), 0,
+                         font["line_height"], font["base_line"], font["underline_position"],
+                         font["underline_thickness"], font["kern_scale"], len(kerning), range_start, len(bitmap))
+    kern_ids = bytes(value for left, right, _ in kerning for value in (left, right))
+    kern_values = struct.pack("<%db" % len(kerning), *(value for _, _, value in kerning))
+
+    with open(path, "wb") as handle:
+        handle.write(header + records + kern_ids + kern_values + bitmap)
+
+    plain = sum((glyph[2] * glyph[3] + 1) // 2 for glyph in glyphs)
+    return len(font["bitmap"]), plain, len(bitmap), bitmap_format
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--characters", default="0123456789.-", help="glyphs to keep")
+    parser.add_argument("--prefix", default="digits", help="output files are <prefix>_<size>.fnt")
+    parser.add_argument("--output", required=True, help="directory of the spiffs image")
+    parser.add_argument("--quiet", action="store_true")
+    parser.add_argument("fonts", nargs="+", help="lv_font_*.c sources")
+    args = parser.parse_args()
+
+    os.makedirs(args.output, exist_ok=True)
+    for source in args.fonts:
+        try:
+            font = parse(source)
+            path = os.path.join(args.output, "%s_%d.fnt" % (args.prefix, font["size"]))
+            full, plain, packed, bitmap_format = write(path, font, args.characters)
+        except (FontError, OSError, AttributeError) as error:
+            sys.exit("%s: %s" % (source, error))
+        if not args.quiet:
+            print("%s: bitmap %d bytes, subset %d, compressed %d (format %d)" %
+                  (path, full, plain, packed, bitmap_format))
+
+
+if __name__ == "__main__":
+    main()